@@ -0,0 +1,89 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "IGESio::IGESio" for configuration "Debug"
+set_property(TARGET IGESio::IGESio APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(IGESio::IGESio PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libigesio.a"
+  )
+
+list(APPEND _cmake_import_check_targets IGESio::IGESio )
+list(APPEND _cmake_import_check_files_for_IGESio::IGESio "${_IMPORT_PREFIX}/lib/libigesio.a" )
+
+# Import target "IGESio::common" for configuration "Debug"
+set_property(TARGET IGESio::common APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(IGESio::common PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libigesio_common.a"
+  )
+
+list(APPEND _cmake_import_check_targets IGESio::common )
+list(APPEND _cmake_import_check_files_for_IGESio::common "${_IMPORT_PREFIX}/lib/libigesio_common.a" )
+
+# Import target "IGESio::utils" for configuration "Debug"
+set_property(TARGET IGESio::utils APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(IGESio::utils PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libigesio_utils.a"
+  )
+
+list(APPEND _cmake_import_check_targets IGESio::utils )
+list(APPEND _cmake_import_check_files_for_IGESio::utils "${_IMPORT_PREFIX}/lib/libigesio_utils.a" )
+
+# Import target "IGESio::numerics" for configuration "Debug"
+set_property(TARGET IGESio::numerics APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(IGESio::numerics PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libigesio_numerics.a"
+  )
+
+list(APPEND _cmake_import_check_targets IGESio::numerics )
+list(APPEND _cmake_import_check_files_for_IGESio::numerics "${_IMPORT_PREFIX}/lib/libigesio_numerics.a" )
+
+# Import target "IGESio::entities" for configuration "Debug"
+set_property(TARGET IGESio::entities APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(IGESio::entities PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libigesio_entities.a"
+  )
+
+list(APPEND _cmake_import_check_targets IGESio::entities )
+list(APPEND _cmake_import_check_files_for_IGESio::entities "${_IMPORT_PREFIX}/lib/libigesio_entities.a" )
+
+# Import target "IGESio::models" for configuration "Debug"
+set_property(TARGET IGESio::models APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(IGESio::models PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libigesio_models.a"
+  )
+
+list(APPEND _cmake_import_check_targets IGESio::models )
+list(APPEND _cmake_import_check_files_for_IGESio::models "${_IMPORT_PREFIX}/lib/libigesio_models.a" )
+
+# Import target "IGESio::graphics" for configuration "Debug"
+set_property(TARGET IGESio::graphics APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(IGESio::graphics PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libigesio_graphics.a"
+  )
+
+list(APPEND _cmake_import_check_targets IGESio::graphics )
+list(APPEND _cmake_import_check_files_for_IGESio::graphics "${_IMPORT_PREFIX}/lib/libigesio_graphics.a" )
+
+# Import target "IGESio::igesio_glad_gl_core_43" for configuration "Debug"
+set_property(TARGET IGESio::igesio_glad_gl_core_43 APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(IGESio::igesio_glad_gl_core_43 PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libigesio_glad_gl_core_43.a"
+  )
+
+list(APPEND _cmake_import_check_targets IGESio::igesio_glad_gl_core_43 )
+list(APPEND _cmake_import_check_files_for_IGESio::igesio_glad_gl_core_43 "${_IMPORT_PREFIX}/lib/libigesio_glad_gl_core_43.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/igesio_glad_gl_core_43.dir/third_party/glad_gl_core_43/src/gl.c.o"
+  "CMakeFiles/igesio_glad_gl_core_43.dir/third_party/glad_gl_core_43/src/gl.c.o.d"
+  "libigesio_glad_gl_core_43.a"
+  "libigesio_glad_gl_core_43.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/igesio_glad_gl_core_43.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
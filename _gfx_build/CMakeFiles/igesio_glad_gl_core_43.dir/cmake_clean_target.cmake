@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libigesio_glad_gl_core_43.a"
+)
@@ -0,0 +1,58 @@
+
+####### Expanded from @PACKAGE_INIT@ by configure_package_config_file() #######
+####### Any changes to this file will be overwritten by the next CMake run ####
+####### The input file was IGESioConfig.cmake.in                            ########
+
+get_filename_component(PACKAGE_PREFIX_DIR "${CMAKE_CURRENT_LIST_DIR}/../../../" ABSOLUTE)
+
+macro(set_and_check _var _file)
+  set(${_var} "${_file}")
+  if(NOT EXISTS "${_file}")
+    message(FATAL_ERROR "File or directory ${_file} referenced by variable ${_var} does not exist !")
+  endif()
+endmacro()
+
+macro(check_required_components _NAME)
+  foreach(comp ${${_NAME}_FIND_COMPONENTS})
+    if(NOT ${_NAME}_${comp}_FOUND)
+      if(${_NAME}_FIND_REQUIRED_${comp})
+        set(${_NAME}_FOUND FALSE)
+      endif()
+    endif()
+  endforeach()
+endmacro()
+
+####################################################################################
+
+include(CMakeFindDependencyMacro)
+
+# Handle Eigen dependency if enabled.
+# Eigen is exposed through IGESio's public headers, so a consumer of the
+# installed package must have a discoverable Eigen3 (it is not bundled).
+if(ON)
+    find_dependency(Eigen3 REQUIRED)
+endif()
+
+# Threads is a PUBLIC dependency of IGESio::common
+# (std::thread/std::async backend for igesio/common/parallel.h)
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+find_dependency(Threads)
+
+# NOTE: Boost (Boost.Math, header-only) is a PRIVATE build-time dependency
+# and is not part of the installed interface, so it is not required here.
+
+# Include the targets file
+include("${CMAKE_CURRENT_LIST_DIR}/IGESioTargets.cmake")
+
+# Attach Eigen to the imported target here. It cannot be part of the
+# install(EXPORT) link interface because a FetchContent-built Eigen is a
+# non-exported real target (the export step would fail), so the dependency
+# found by find_dependency(Eigen3) above is appended afterwards instead.
+if(ON)
+    set_property(TARGET IGESio::common APPEND PROPERTY
+        INTERFACE_LINK_LIBRARIES Eigen3::Eigen
+    )
+endif()
+
+# Check that all required components are found
+check_required_components(IGESio)
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/igesio.dir/reader.cpp.o"
+  "CMakeFiles/igesio.dir/reader.cpp.o.d"
+  "CMakeFiles/igesio.dir/writer.cpp.o"
+  "CMakeFiles/igesio.dir/writer.cpp.o.d"
+  "libigesio.a"
+  "libigesio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/igesio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/id_generator.cpp" "src/common/CMakeFiles/igesio_common.dir/id_generator.cpp.o" "gcc" "src/common/CMakeFiles/igesio_common.dir/id_generator.cpp.o.d"
+  "/root/repo/src/common/iges_metadata.cpp" "src/common/CMakeFiles/igesio_common.dir/iges_metadata.cpp.o" "gcc" "src/common/CMakeFiles/igesio_common.dir/iges_metadata.cpp.o.d"
+  "/root/repo/src/common/iges_parameter_vector.cpp" "src/common/CMakeFiles/igesio_common.dir/iges_parameter_vector.cpp.o" "gcc" "src/common/CMakeFiles/igesio_common.dir/iges_parameter_vector.cpp.o.d"
+  "/root/repo/src/common/serialization.cpp" "src/common/CMakeFiles/igesio_common.dir/serialization.cpp.o" "gcc" "src/common/CMakeFiles/igesio_common.dir/serialization.cpp.o.d"
+  "/root/repo/src/common/validation_result.cpp" "src/common/CMakeFiles/igesio_common.dir/validation_result.cpp.o" "gcc" "src/common/CMakeFiles/igesio_common.dir/validation_result.cpp.o.d"
+  "/root/repo/src/common/versions.cpp" "src/common/CMakeFiles/igesio_common.dir/versions.cpp.o" "gcc" "src/common/CMakeFiles/igesio_common.dir/versions.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/igesio_common.dir/id_generator.cpp.o"
+  "CMakeFiles/igesio_common.dir/id_generator.cpp.o.d"
+  "CMakeFiles/igesio_common.dir/iges_metadata.cpp.o"
+  "CMakeFiles/igesio_common.dir/iges_metadata.cpp.o.d"
+  "CMakeFiles/igesio_common.dir/iges_parameter_vector.cpp.o"
+  "CMakeFiles/igesio_common.dir/iges_parameter_vector.cpp.o.d"
+  "CMakeFiles/igesio_common.dir/serialization.cpp.o"
+  "CMakeFiles/igesio_common.dir/serialization.cpp.o.d"
+  "CMakeFiles/igesio_common.dir/validation_result.cpp.o"
+  "CMakeFiles/igesio_common.dir/validation_result.cpp.o.d"
+  "CMakeFiles/igesio_common.dir/versions.cpp.o"
+  "CMakeFiles/igesio_common.dir/versions.cpp.o.d"
+  "libigesio_common.a"
+  "libigesio_common.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/igesio_common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
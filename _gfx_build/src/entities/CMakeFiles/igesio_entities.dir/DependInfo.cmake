@@ -0,0 +1,81 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/entities/curves/algorithms.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms.cpp.o.d"
+  "/root/repo/src/entities/curves/algorithms/curve_curve_intersection.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/curve_curve_intersection.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/curve_curve_intersection.cpp.o.d"
+  "/root/repo/src/entities/curves/algorithms/curve_discretization.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/curve_discretization.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/curve_discretization.cpp.o.d"
+  "/root/repo/src/entities/curves/algorithms/curve_line_intersection.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/curve_line_intersection.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/curve_line_intersection.cpp.o.d"
+  "/root/repo/src/entities/curves/algorithms/curve_segment_tree.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/curve_segment_tree.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/curve_segment_tree.cpp.o.d"
+  "/root/repo/src/entities/curves/algorithms/extremal_polygon.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/extremal_polygon.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/extremal_polygon.cpp.o.d"
+  "/root/repo/src/entities/curves/algorithms/polygonal_approximation.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/polygonal_approximation.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/algorithms/polygonal_approximation.cpp.o.d"
+  "/root/repo/src/entities/curves/circular_arc.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/circular_arc.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/circular_arc.cpp.o.d"
+  "/root/repo/src/entities/curves/composite_curve.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/composite_curve.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/composite_curve.cpp.o.d"
+  "/root/repo/src/entities/curves/conic_arc.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/conic_arc.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/conic_arc.cpp.o.d"
+  "/root/repo/src/entities/curves/copious_data.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/copious_data.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/copious_data.cpp.o.d"
+  "/root/repo/src/entities/curves/copious_data_base.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/copious_data_base.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/copious_data_base.cpp.o.d"
+  "/root/repo/src/entities/curves/curve_on_a_parametric_surface.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/curve_on_a_parametric_surface.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/curve_on_a_parametric_surface.cpp.o.d"
+  "/root/repo/src/entities/curves/line.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/line.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/line.cpp.o.d"
+  "/root/repo/src/entities/curves/linear_path.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/linear_path.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/linear_path.cpp.o.d"
+  "/root/repo/src/entities/curves/nurbs_algorithms.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/nurbs_algorithms.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/nurbs_algorithms.cpp.o.d"
+  "/root/repo/src/entities/curves/nurbs_conversion.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/nurbs_conversion.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/nurbs_conversion.cpp.o.d"
+  "/root/repo/src/entities/curves/parametric_spline_curve.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/parametric_spline_curve.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/parametric_spline_curve.cpp.o.d"
+  "/root/repo/src/entities/curves/point.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/point.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/point.cpp.o.d"
+  "/root/repo/src/entities/curves/rational_b_spline_curve.cpp" "src/entities/CMakeFiles/igesio_entities.dir/curves/rational_b_spline_curve.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/curves/rational_b_spline_curve.cpp.o.d"
+  "/root/repo/src/entities/de/de_color.cpp" "src/entities/CMakeFiles/igesio_entities.dir/de/de_color.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/de/de_color.cpp.o.d"
+  "/root/repo/src/entities/de/de_label_display_associativity.cpp" "src/entities/CMakeFiles/igesio_entities.dir/de/de_label_display_associativity.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/de/de_label_display_associativity.cpp.o.d"
+  "/root/repo/src/entities/de/de_level.cpp" "src/entities/CMakeFiles/igesio_entities.dir/de/de_level.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/de/de_level.cpp.o.d"
+  "/root/repo/src/entities/de/de_line_font_pattern.cpp" "src/entities/CMakeFiles/igesio_entities.dir/de/de_line_font_pattern.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/de/de_line_font_pattern.cpp.o.d"
+  "/root/repo/src/entities/de/de_structure.cpp" "src/entities/CMakeFiles/igesio_entities.dir/de/de_structure.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/de/de_structure.cpp.o.d"
+  "/root/repo/src/entities/de/de_transformation_matrix.cpp" "src/entities/CMakeFiles/igesio_entities.dir/de/de_transformation_matrix.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/de/de_transformation_matrix.cpp.o.d"
+  "/root/repo/src/entities/de/de_view.cpp" "src/entities/CMakeFiles/igesio_entities.dir/de/de_view.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/de/de_view.cpp.o.d"
+  "/root/repo/src/entities/de/raw_entity_de.cpp" "src/entities/CMakeFiles/igesio_entities.dir/de/raw_entity_de.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/de/raw_entity_de.cpp.o.d"
+  "/root/repo/src/entities/entity_base.cpp" "src/entities/CMakeFiles/igesio_entities.dir/entity_base.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/entity_base.cpp.o.d"
+  "/root/repo/src/entities/entity_type.cpp" "src/entities/CMakeFiles/igesio_entities.dir/entity_type.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/entity_type.cpp.o.d"
+  "/root/repo/src/entities/factory.cpp" "src/entities/CMakeFiles/igesio_entities.dir/factory.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/factory.cpp.o.d"
+  "/root/repo/src/entities/interfaces/i_curve.cpp" "src/entities/CMakeFiles/igesio_entities.dir/interfaces/i_curve.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/interfaces/i_curve.cpp.o.d"
+  "/root/repo/src/entities/interfaces/i_geometry.cpp" "src/entities/CMakeFiles/igesio_entities.dir/interfaces/i_geometry.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/interfaces/i_geometry.cpp.o.d"
+  "/root/repo/src/entities/interfaces/i_restricted_surface.cpp" "src/entities/CMakeFiles/igesio_entities.dir/interfaces/i_restricted_surface.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/interfaces/i_restricted_surface.cpp.o.d"
+  "/root/repo/src/entities/interfaces/i_surface.cpp" "src/entities/CMakeFiles/igesio_entities.dir/interfaces/i_surface.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/interfaces/i_surface.cpp.o.d"
+  "/root/repo/src/entities/meshes/mesh_entity.cpp" "src/entities/CMakeFiles/igesio_entities.dir/meshes/mesh_entity.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/meshes/mesh_entity.cpp.o.d"
+  "/root/repo/src/entities/pd.cpp" "src/entities/CMakeFiles/igesio_entities.dir/pd.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/pd.cpp.o.d"
+  "/root/repo/src/entities/structures/color_definition.cpp" "src/entities/CMakeFiles/igesio_entities.dir/structures/color_definition.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/structures/color_definition.cpp.o.d"
+  "/root/repo/src/entities/structures/null_entity.cpp" "src/entities/CMakeFiles/igesio_entities.dir/structures/null_entity.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/structures/null_entity.cpp.o.d"
+  "/root/repo/src/entities/structures/unsupported_entity.cpp" "src/entities/CMakeFiles/igesio_entities.dir/structures/unsupported_entity.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/structures/unsupported_entity.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/curve_surface_intersection.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/curve_surface_intersection.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/curve_surface_intersection.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/curve_surface_inversion.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/curve_surface_inversion.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/curve_surface_inversion.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/minimum_distance.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/minimum_distance.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/minimum_distance.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/restricted_surface_mesh.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/restricted_surface_mesh.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/restricted_surface_mesh.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/surface_boundary_edges.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_boundary_edges.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_boundary_edges.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/surface_cell_tree.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_cell_tree.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_cell_tree.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/surface_line_intersection.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_line_intersection.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_line_intersection.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/surface_tessellation_tolerance.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_tessellation_tolerance.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_tessellation_tolerance.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/tessellation_cache.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/tessellation_cache.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/tessellation_cache.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/tessellation_sidecar.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/tessellation_sidecar.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/tessellation_sidecar.cpp.o.d"
+  "/root/repo/src/entities/surfaces/algorithms/watertight_mesh.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/watertight_mesh.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/algorithms/watertight_mesh.cpp.o.d"
+  "/root/repo/src/entities/surfaces/plane.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/plane.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/plane.cpp.o.d"
+  "/root/repo/src/entities/surfaces/rational_b_spline_surface.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/rational_b_spline_surface.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/rational_b_spline_surface.cpp.o.d"
+  "/root/repo/src/entities/surfaces/ruled_surface.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/ruled_surface.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/ruled_surface.cpp.o.d"
+  "/root/repo/src/entities/surfaces/surface_of_revolution.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/surface_of_revolution.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/surface_of_revolution.cpp.o.d"
+  "/root/repo/src/entities/surfaces/tabulated_cylinder.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/tabulated_cylinder.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/tabulated_cylinder.cpp.o.d"
+  "/root/repo/src/entities/surfaces/trimmed_surface.cpp" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/trimmed_surface.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/surfaces/trimmed_surface.cpp.o.d"
+  "/root/repo/src/entities/transformations/transformation_matrix.cpp" "src/entities/CMakeFiles/igesio_entities.dir/transformations/transformation_matrix.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/transformations/transformation_matrix.cpp.o.d"
+  "/root/repo/src/entities/views/curve_view.cpp" "src/entities/CMakeFiles/igesio_entities.dir/views/curve_view.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/views/curve_view.cpp.o.d"
+  "/root/repo/src/entities/views/surface_view.cpp" "src/entities/CMakeFiles/igesio_entities.dir/views/surface_view.cpp.o" "gcc" "src/entities/CMakeFiles/igesio_entities.dir/views/surface_view.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/numerics/CMakeFiles/igesio_numerics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/utils/CMakeFiles/igesio_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,129 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/igesio_entities.dir/curves/algorithms.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/curve_curve_intersection.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/curve_curve_intersection.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/curve_discretization.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/curve_discretization.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/curve_line_intersection.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/curve_line_intersection.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/curve_segment_tree.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/curve_segment_tree.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/extremal_polygon.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/extremal_polygon.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/polygonal_approximation.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/algorithms/polygonal_approximation.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/circular_arc.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/circular_arc.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/composite_curve.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/composite_curve.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/conic_arc.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/conic_arc.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/copious_data.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/copious_data.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/copious_data_base.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/copious_data_base.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/curve_on_a_parametric_surface.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/curve_on_a_parametric_surface.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/line.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/line.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/linear_path.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/linear_path.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/nurbs_algorithms.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/nurbs_algorithms.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/nurbs_conversion.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/nurbs_conversion.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/parametric_spline_curve.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/parametric_spline_curve.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/point.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/point.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/curves/rational_b_spline_curve.cpp.o"
+  "CMakeFiles/igesio_entities.dir/curves/rational_b_spline_curve.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/de/de_color.cpp.o"
+  "CMakeFiles/igesio_entities.dir/de/de_color.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/de/de_label_display_associativity.cpp.o"
+  "CMakeFiles/igesio_entities.dir/de/de_label_display_associativity.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/de/de_level.cpp.o"
+  "CMakeFiles/igesio_entities.dir/de/de_level.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/de/de_line_font_pattern.cpp.o"
+  "CMakeFiles/igesio_entities.dir/de/de_line_font_pattern.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/de/de_structure.cpp.o"
+  "CMakeFiles/igesio_entities.dir/de/de_structure.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/de/de_transformation_matrix.cpp.o"
+  "CMakeFiles/igesio_entities.dir/de/de_transformation_matrix.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/de/de_view.cpp.o"
+  "CMakeFiles/igesio_entities.dir/de/de_view.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/de/raw_entity_de.cpp.o"
+  "CMakeFiles/igesio_entities.dir/de/raw_entity_de.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/entity_base.cpp.o"
+  "CMakeFiles/igesio_entities.dir/entity_base.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/entity_type.cpp.o"
+  "CMakeFiles/igesio_entities.dir/entity_type.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/factory.cpp.o"
+  "CMakeFiles/igesio_entities.dir/factory.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/interfaces/i_curve.cpp.o"
+  "CMakeFiles/igesio_entities.dir/interfaces/i_curve.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/interfaces/i_geometry.cpp.o"
+  "CMakeFiles/igesio_entities.dir/interfaces/i_geometry.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/interfaces/i_restricted_surface.cpp.o"
+  "CMakeFiles/igesio_entities.dir/interfaces/i_restricted_surface.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/interfaces/i_surface.cpp.o"
+  "CMakeFiles/igesio_entities.dir/interfaces/i_surface.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/meshes/mesh_entity.cpp.o"
+  "CMakeFiles/igesio_entities.dir/meshes/mesh_entity.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/pd.cpp.o"
+  "CMakeFiles/igesio_entities.dir/pd.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/structures/color_definition.cpp.o"
+  "CMakeFiles/igesio_entities.dir/structures/color_definition.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/structures/null_entity.cpp.o"
+  "CMakeFiles/igesio_entities.dir/structures/null_entity.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/structures/unsupported_entity.cpp.o"
+  "CMakeFiles/igesio_entities.dir/structures/unsupported_entity.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/curve_surface_intersection.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/curve_surface_intersection.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/curve_surface_inversion.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/curve_surface_inversion.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/minimum_distance.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/minimum_distance.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/restricted_surface_mesh.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/restricted_surface_mesh.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_boundary_edges.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_boundary_edges.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_cell_tree.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_cell_tree.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_line_intersection.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_line_intersection.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_tessellation_tolerance.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/surface_tessellation_tolerance.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/tessellation_cache.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/tessellation_cache.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/tessellation_sidecar.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/tessellation_sidecar.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/watertight_mesh.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/algorithms/watertight_mesh.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/plane.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/plane.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/rational_b_spline_surface.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/rational_b_spline_surface.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/ruled_surface.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/ruled_surface.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/surface_of_revolution.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/surface_of_revolution.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/tabulated_cylinder.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/tabulated_cylinder.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/surfaces/trimmed_surface.cpp.o"
+  "CMakeFiles/igesio_entities.dir/surfaces/trimmed_surface.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/transformations/transformation_matrix.cpp.o"
+  "CMakeFiles/igesio_entities.dir/transformations/transformation_matrix.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/views/curve_view.cpp.o"
+  "CMakeFiles/igesio_entities.dir/views/curve_view.cpp.o.d"
+  "CMakeFiles/igesio_entities.dir/views/surface_view.cpp.o"
+  "CMakeFiles/igesio_entities.dir/views/surface_view.cpp.o.d"
+  "libigesio_entities.a"
+  "libigesio_entities.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/igesio_entities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
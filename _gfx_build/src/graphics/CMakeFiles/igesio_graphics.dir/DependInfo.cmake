@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/graphics/core/camera.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/core/camera.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/core/camera.cpp.o.d"
+  "/root/repo/src/graphics/core/i_entity_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/core/i_entity_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/core/i_entity_graphics.cpp.o.d"
+  "/root/repo/src/graphics/core/level_of_detail.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/core/level_of_detail.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/core/level_of_detail.cpp.o.d"
+  "/root/repo/src/graphics/core/open_gl.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/core/open_gl.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/core/open_gl.cpp.o.d"
+  "/root/repo/src/graphics/core/pick_registry.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/core/pick_registry.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/core/pick_registry.cpp.o.d"
+  "/root/repo/src/graphics/core/ray.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/core/ray.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/core/ray.cpp.o.d"
+  "/root/repo/src/graphics/core/surface_edge_buffer.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/core/surface_edge_buffer.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/core/surface_edge_buffer.cpp.o.d"
+  "/root/repo/src/graphics/core/texture.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/core/texture.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/core/texture.cpp.o.d"
+  "/root/repo/src/graphics/curves/circular_arc_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/circular_arc_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/circular_arc_graphics.cpp.o.d"
+  "/root/repo/src/graphics/curves/composite_curve_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/composite_curve_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/composite_curve_graphics.cpp.o.d"
+  "/root/repo/src/graphics/curves/conic_arc_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/conic_arc_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/conic_arc_graphics.cpp.o.d"
+  "/root/repo/src/graphics/curves/copious_data_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/copious_data_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/copious_data_graphics.cpp.o.d"
+  "/root/repo/src/graphics/curves/curve_on_a_parametric_surface_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/curve_on_a_parametric_surface_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/curve_on_a_parametric_surface_graphics.cpp.o.d"
+  "/root/repo/src/graphics/curves/i_curve_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/i_curve_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/i_curve_graphics.cpp.o.d"
+  "/root/repo/src/graphics/curves/line_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/line_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/line_graphics.cpp.o.d"
+  "/root/repo/src/graphics/curves/point_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/point_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/point_graphics.cpp.o.d"
+  "/root/repo/src/graphics/curves/rational_b_spline_curve_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/rational_b_spline_curve_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/curves/rational_b_spline_curve_graphics.cpp.o.d"
+  "/root/repo/src/graphics/factory.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/factory.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/factory.cpp.o.d"
+  "/root/repo/src/graphics/graphics_registry.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/graphics_registry.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/graphics_registry.cpp.o.d"
+  "/root/repo/src/graphics/meshes/triangle_mesh_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/meshes/triangle_mesh_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/meshes/triangle_mesh_graphics.cpp.o.d"
+  "/root/repo/src/graphics/renderer.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/renderer.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/renderer.cpp.o.d"
+  "/root/repo/src/graphics/shader_registry.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/shader_registry.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/shader_registry.cpp.o.d"
+  "/root/repo/src/graphics/surfaces/i_surface_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/surfaces/i_surface_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/surfaces/i_surface_graphics.cpp.o.d"
+  "/root/repo/src/graphics/surfaces/rational_b_spline_surface_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/surfaces/rational_b_spline_surface_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/surfaces/rational_b_spline_surface_graphics.cpp.o.d"
+  "/root/repo/src/graphics/surfaces/restricted_surface_graphics.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/surfaces/restricted_surface_graphics.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/surfaces/restricted_surface_graphics.cpp.o.d"
+  "/root/repo/src/graphics/surfaces/surface_mesh.cpp" "src/graphics/CMakeFiles/igesio_graphics.dir/surfaces/surface_mesh.cpp.o" "gcc" "src/graphics/CMakeFiles/igesio_graphics.dir/surfaces/surface_mesh.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/numerics/CMakeFiles/igesio_numerics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/utils/CMakeFiles/igesio_utils.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/entities/CMakeFiles/igesio_entities.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/models/CMakeFiles/igesio_models.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/CMakeFiles/igesio_glad_gl_core_43.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
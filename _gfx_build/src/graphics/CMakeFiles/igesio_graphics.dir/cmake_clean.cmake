@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/igesio_graphics.dir/core/camera.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/core/camera.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/core/i_entity_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/core/i_entity_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/core/level_of_detail.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/core/level_of_detail.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/core/open_gl.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/core/open_gl.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/core/pick_registry.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/core/pick_registry.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/core/ray.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/core/ray.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/core/surface_edge_buffer.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/core/surface_edge_buffer.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/core/texture.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/core/texture.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/curves/circular_arc_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/curves/circular_arc_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/curves/composite_curve_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/curves/composite_curve_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/curves/conic_arc_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/curves/conic_arc_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/curves/copious_data_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/curves/copious_data_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/curves/curve_on_a_parametric_surface_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/curves/curve_on_a_parametric_surface_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/curves/i_curve_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/curves/i_curve_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/curves/line_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/curves/line_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/curves/point_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/curves/point_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/curves/rational_b_spline_curve_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/curves/rational_b_spline_curve_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/factory.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/factory.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/graphics_registry.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/graphics_registry.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/meshes/triangle_mesh_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/meshes/triangle_mesh_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/renderer.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/renderer.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/shader_registry.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/shader_registry.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/surfaces/i_surface_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/surfaces/i_surface_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/surfaces/rational_b_spline_surface_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/surfaces/rational_b_spline_surface_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/surfaces/restricted_surface_graphics.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/surfaces/restricted_surface_graphics.cpp.o.d"
+  "CMakeFiles/igesio_graphics.dir/surfaces/surface_mesh.cpp.o"
+  "CMakeFiles/igesio_graphics.dir/surfaces/surface_mesh.cpp.o.d"
+  "libigesio_graphics.a"
+  "libigesio_graphics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/igesio_graphics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
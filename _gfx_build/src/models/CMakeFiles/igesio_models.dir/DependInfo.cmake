@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/models/assembly.cpp" "src/models/CMakeFiles/igesio_models.dir/assembly.cpp.o" "gcc" "src/models/CMakeFiles/igesio_models.dir/assembly.cpp.o.d"
+  "/root/repo/src/models/clearance.cpp" "src/models/CMakeFiles/igesio_models.dir/clearance.cpp.o" "gcc" "src/models/CMakeFiles/igesio_models.dir/clearance.cpp.o.d"
+  "/root/repo/src/models/flatten.cpp" "src/models/CMakeFiles/igesio_models.dir/flatten.cpp.o" "gcc" "src/models/CMakeFiles/igesio_models.dir/flatten.cpp.o.d"
+  "/root/repo/src/models/global_param.cpp" "src/models/CMakeFiles/igesio_models.dir/global_param.cpp.o" "gcc" "src/models/CMakeFiles/igesio_models.dir/global_param.cpp.o.d"
+  "/root/repo/src/models/iges_data.cpp" "src/models/CMakeFiles/igesio_models.dir/iges_data.cpp.o" "gcc" "src/models/CMakeFiles/igesio_models.dir/iges_data.cpp.o.d"
+  "/root/repo/src/models/ray_caster.cpp" "src/models/CMakeFiles/igesio_models.dir/ray_caster.cpp.o" "gcc" "src/models/CMakeFiles/igesio_models.dir/ray_caster.cpp.o.d"
+  "/root/repo/src/models/scene.cpp" "src/models/CMakeFiles/igesio_models.dir/scene.cpp.o" "gcc" "src/models/CMakeFiles/igesio_models.dir/scene.cpp.o.d"
+  "/root/repo/src/models/selection_set.cpp" "src/models/CMakeFiles/igesio_models.dir/selection_set.cpp.o" "gcc" "src/models/CMakeFiles/igesio_models.dir/selection_set.cpp.o.d"
+  "/root/repo/src/models/tessellation.cpp" "src/models/CMakeFiles/igesio_models.dir/tessellation.cpp.o" "gcc" "src/models/CMakeFiles/igesio_models.dir/tessellation.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/numerics/CMakeFiles/igesio_numerics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/utils/CMakeFiles/igesio_utils.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/entities/CMakeFiles/igesio_entities.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
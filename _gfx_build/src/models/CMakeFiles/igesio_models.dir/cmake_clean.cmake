@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/igesio_models.dir/assembly.cpp.o"
+  "CMakeFiles/igesio_models.dir/assembly.cpp.o.d"
+  "CMakeFiles/igesio_models.dir/clearance.cpp.o"
+  "CMakeFiles/igesio_models.dir/clearance.cpp.o.d"
+  "CMakeFiles/igesio_models.dir/flatten.cpp.o"
+  "CMakeFiles/igesio_models.dir/flatten.cpp.o.d"
+  "CMakeFiles/igesio_models.dir/global_param.cpp.o"
+  "CMakeFiles/igesio_models.dir/global_param.cpp.o.d"
+  "CMakeFiles/igesio_models.dir/iges_data.cpp.o"
+  "CMakeFiles/igesio_models.dir/iges_data.cpp.o.d"
+  "CMakeFiles/igesio_models.dir/ray_caster.cpp.o"
+  "CMakeFiles/igesio_models.dir/ray_caster.cpp.o.d"
+  "CMakeFiles/igesio_models.dir/scene.cpp.o"
+  "CMakeFiles/igesio_models.dir/scene.cpp.o.d"
+  "CMakeFiles/igesio_models.dir/selection_set.cpp.o"
+  "CMakeFiles/igesio_models.dir/selection_set.cpp.o.d"
+  "CMakeFiles/igesio_models.dir/tessellation.cpp.o"
+  "CMakeFiles/igesio_models.dir/tessellation.cpp.o.d"
+  "libigesio_models.a"
+  "libigesio_models.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/igesio_models.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
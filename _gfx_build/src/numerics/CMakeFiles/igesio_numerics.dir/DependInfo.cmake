@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/numerics/analysis/integration.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/analysis/integration.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/analysis/integration.cpp.o.d"
+  "/root/repo/src/numerics/analysis/optimization.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/analysis/optimization.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/analysis/optimization.cpp.o.d"
+  "/root/repo/src/numerics/core/combinatorics.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/core/combinatorics.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/core/combinatorics.cpp.o.d"
+  "/root/repo/src/numerics/core/tolerance.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/core/tolerance.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/core/tolerance.cpp.o.d"
+  "/root/repo/src/numerics/geometric/bounding_box.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/geometric/bounding_box.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/geometric/bounding_box.cpp.o.d"
+  "/root/repo/src/numerics/geometric/bvh.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/geometric/bvh.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/geometric/bvh.cpp.o.d"
+  "/root/repo/src/numerics/geometric/polygon.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/geometric/polygon.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/geometric/polygon.cpp.o.d"
+  "/root/repo/src/numerics/geometric/polygon_triangulation.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/geometric/polygon_triangulation.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/geometric/polygon_triangulation.cpp.o.d"
+  "/root/repo/src/numerics/meshes/algorithms/adjacency.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/meshes/algorithms/adjacency.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/meshes/algorithms/adjacency.cpp.o.d"
+  "/root/repo/src/numerics/meshes/algorithms/reordering.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/meshes/algorithms/reordering.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/meshes/algorithms/reordering.cpp.o.d"
+  "/root/repo/src/numerics/meshes/algorithms/simplification.cpp" "src/numerics/CMakeFiles/igesio_numerics.dir/meshes/algorithms/simplification.cpp.o" "gcc" "src/numerics/CMakeFiles/igesio_numerics.dir/meshes/algorithms/simplification.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/igesio_numerics.dir/analysis/integration.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/analysis/integration.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/analysis/optimization.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/analysis/optimization.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/core/combinatorics.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/core/combinatorics.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/core/tolerance.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/core/tolerance.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/geometric/bounding_box.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/geometric/bounding_box.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/geometric/bvh.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/geometric/bvh.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/geometric/polygon.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/geometric/polygon.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/geometric/polygon_triangulation.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/geometric/polygon_triangulation.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/meshes/algorithms/adjacency.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/meshes/algorithms/adjacency.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/meshes/algorithms/reordering.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/meshes/algorithms/reordering.cpp.o.d"
+  "CMakeFiles/igesio_numerics.dir/meshes/algorithms/simplification.cpp.o"
+  "CMakeFiles/igesio_numerics.dir/meshes/algorithms/simplification.cpp.o.d"
+  "libigesio_numerics.a"
+  "libigesio_numerics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/igesio_numerics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libigesio_numerics.a"
+)
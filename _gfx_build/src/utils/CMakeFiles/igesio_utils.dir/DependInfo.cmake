@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utils/iges_binary_reader.cpp" "src/utils/CMakeFiles/igesio_utils.dir/iges_binary_reader.cpp.o" "gcc" "src/utils/CMakeFiles/igesio_utils.dir/iges_binary_reader.cpp.o.d"
+  "/root/repo/src/utils/iges_string_utils.cpp" "src/utils/CMakeFiles/igesio_utils.dir/iges_string_utils.cpp.o" "gcc" "src/utils/CMakeFiles/igesio_utils.dir/iges_string_utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
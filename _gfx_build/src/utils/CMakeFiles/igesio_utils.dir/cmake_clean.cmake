@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/igesio_utils.dir/iges_binary_reader.cpp.o"
+  "CMakeFiles/igesio_utils.dir/iges_binary_reader.cpp.o.d"
+  "CMakeFiles/igesio_utils.dir/iges_string_utils.cpp.o"
+  "CMakeFiles/igesio_utils.dir/iges_string_utils.cpp.o.d"
+  "libigesio_utils.a"
+  "libigesio_utils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/igesio_utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
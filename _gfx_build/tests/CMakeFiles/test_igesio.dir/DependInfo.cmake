@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/test_reader.cpp" "tests/CMakeFiles/test_igesio.dir/test_reader.cpp.o" "gcc" "tests/CMakeFiles/test_igesio.dir/test_reader.cpp.o.d"
+  "/root/repo/tests/test_writer.cpp" "tests/CMakeFiles/test_igesio.dir/test_writer.cpp.o" "gcc" "tests/CMakeFiles/test_igesio.dir/test_writer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/CMakeFiles/igesio.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/graphics/CMakeFiles/igesio_graphics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/models/CMakeFiles/igesio_models.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/entities/CMakeFiles/igesio_entities.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/utils/CMakeFiles/igesio_utils.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/numerics/CMakeFiles/igesio_numerics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/CMakeFiles/igesio_glad_gl_core_43.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
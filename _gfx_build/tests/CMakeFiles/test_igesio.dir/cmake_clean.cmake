@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_igesio.dir/test_reader.cpp.o"
+  "CMakeFiles/test_igesio.dir/test_reader.cpp.o.d"
+  "CMakeFiles/test_igesio.dir/test_writer.cpp.o"
+  "CMakeFiles/test_igesio.dir/test_writer.cpp.o.d"
+  "test_igesio"
+  "test_igesio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_igesio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_gfx_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_igesio "/root/repo/_gfx_build/tests/test_igesio")
+set_tests_properties(test_igesio PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;32;add_test;/root/repo/tests/CMakeLists.txt;0;")
+subdirs("common")
+subdirs("utils")
+subdirs("numerics")
+subdirs("entities")
+subdirs("models")
+subdirs("graphics")
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/common/test_errors.cpp" "tests/common/CMakeFiles/test_common.dir/test_errors.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_errors.cpp.o.d"
+  "/root/repo/tests/common/test_id_generator.cpp" "tests/common/CMakeFiles/test_common.dir/test_id_generator.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_id_generator.cpp.o.d"
+  "/root/repo/tests/common/test_iges_metadata.cpp" "tests/common/CMakeFiles/test_common.dir/test_iges_metadata.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_iges_metadata.cpp.o.d"
+  "/root/repo/tests/common/test_iges_parameter_vector.cpp" "tests/common/CMakeFiles/test_common.dir/test_iges_parameter_vector.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_iges_parameter_vector.cpp.o.d"
+  "/root/repo/tests/common/test_lazy_cache.cpp" "tests/common/CMakeFiles/test_common.dir/test_lazy_cache.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_lazy_cache.cpp.o.d"
+  "/root/repo/tests/common/test_parallel.cpp" "tests/common/CMakeFiles/test_common.dir/test_parallel.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_parallel.cpp.o.d"
+  "/root/repo/tests/common/test_serialization_FromIgesXxx.cpp" "tests/common/CMakeFiles/test_common.dir/test_serialization_FromIgesXxx.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_serialization_FromIgesXxx.cpp.o.d"
+  "/root/repo/tests/common/test_serialization_ToIgesXxx.cpp" "tests/common/CMakeFiles/test_common.dir/test_serialization_ToIgesXxx.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_serialization_ToIgesXxx.cpp.o.d"
+  "/root/repo/tests/common/test_validation_result.cpp" "tests/common/CMakeFiles/test_common.dir/test_validation_result.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_validation_result.cpp.o.d"
+  "/root/repo/tests/common/test_versions.cpp" "tests/common/CMakeFiles/test_common.dir/test_versions.cpp.o" "gcc" "tests/common/CMakeFiles/test_common.dir/test_versions.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_common.dir/test_errors.cpp.o"
+  "CMakeFiles/test_common.dir/test_errors.cpp.o.d"
+  "CMakeFiles/test_common.dir/test_id_generator.cpp.o"
+  "CMakeFiles/test_common.dir/test_id_generator.cpp.o.d"
+  "CMakeFiles/test_common.dir/test_iges_metadata.cpp.o"
+  "CMakeFiles/test_common.dir/test_iges_metadata.cpp.o.d"
+  "CMakeFiles/test_common.dir/test_iges_parameter_vector.cpp.o"
+  "CMakeFiles/test_common.dir/test_iges_parameter_vector.cpp.o.d"
+  "CMakeFiles/test_common.dir/test_lazy_cache.cpp.o"
+  "CMakeFiles/test_common.dir/test_lazy_cache.cpp.o.d"
+  "CMakeFiles/test_common.dir/test_parallel.cpp.o"
+  "CMakeFiles/test_common.dir/test_parallel.cpp.o.d"
+  "CMakeFiles/test_common.dir/test_serialization_FromIgesXxx.cpp.o"
+  "CMakeFiles/test_common.dir/test_serialization_FromIgesXxx.cpp.o.d"
+  "CMakeFiles/test_common.dir/test_serialization_ToIgesXxx.cpp.o"
+  "CMakeFiles/test_common.dir/test_serialization_ToIgesXxx.cpp.o.d"
+  "CMakeFiles/test_common.dir/test_validation_result.cpp.o"
+  "CMakeFiles/test_common.dir/test_validation_result.cpp.o.d"
+  "CMakeFiles/test_common.dir/test_versions.cpp.o"
+  "CMakeFiles/test_common.dir/test_versions.cpp.o.d"
+  "test_common"
+  "test_common.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,84 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/entities/curves/algorithms/test_curve_discretization.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/algorithms/test_curve_discretization.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/algorithms/test_curve_discretization.cpp.o.d"
+  "/root/repo/tests/entities/curves/algorithms/test_extremal_polygon.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/algorithms/test_extremal_polygon.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/algorithms/test_extremal_polygon.cpp.o.d"
+  "/root/repo/tests/entities/curves/algorithms/test_polygonal_approximation.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/algorithms/test_polygonal_approximation.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/algorithms/test_polygonal_approximation.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_algorithms.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_algorithms.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_algorithms.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_circular_arc.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_circular_arc.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_circular_arc.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_composite_curve.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_composite_curve.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_composite_curve.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_composite_curve_edit.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_composite_curve_edit.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_composite_curve_edit.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_conic_arc.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_conic_arc.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_conic_arc.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_copious_data.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_copious_data.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_copious_data.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_curve_curve_intersection.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_curve_curve_intersection.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_curve_curve_intersection.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_curve_line_intersection.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_curve_line_intersection.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_curve_line_intersection.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_curve_on_a_parametric_surface.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_curve_on_a_parametric_surface.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_curve_on_a_parametric_surface.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_i_curve.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_i_curve.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_i_curve.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_line.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_line.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_line.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_linear_path.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_linear_path.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_linear_path.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_nurbs_approximation_algorithms.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_nurbs_approximation_algorithms.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_nurbs_approximation_algorithms.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_parametric_spline_curve.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_parametric_spline_curve.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_parametric_spline_curve.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_point.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_point.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_point.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_rational_b_spline_curve.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_rational_b_spline_curve.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_rational_b_spline_curve.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_rational_b_spline_curve_edit.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_rational_b_spline_curve_edit.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_rational_b_spline_curve_edit.cpp.o.d"
+  "/root/repo/tests/entities/curves/test_signed_curvature.cpp" "tests/entities/CMakeFiles/test_entities.dir/curves/test_signed_curvature.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/curves/test_signed_curvature.cpp.o.d"
+  "/root/repo/tests/entities/de/test_de_color.cpp" "tests/entities/CMakeFiles/test_entities.dir/de/test_de_color.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/de/test_de_color.cpp.o.d"
+  "/root/repo/tests/entities/de/test_de_level.cpp" "tests/entities/CMakeFiles/test_entities.dir/de/test_de_level.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/de/test_de_level.cpp.o.d"
+  "/root/repo/tests/entities/de/test_de_line_font_pattern.cpp" "tests/entities/CMakeFiles/test_entities.dir/de/test_de_line_font_pattern.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/de/test_de_line_font_pattern.cpp.o.d"
+  "/root/repo/tests/entities/de/test_raw_entity_de.cpp" "tests/entities/CMakeFiles/test_entities.dir/de/test_raw_entity_de.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/de/test_raw_entity_de.cpp.o.d"
+  "/root/repo/tests/entities/de/test_raw_entity_de_is_valid.cpp" "tests/entities/CMakeFiles/test_entities.dir/de/test_raw_entity_de_is_valid.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/de/test_raw_entity_de_is_valid.cpp.o.d"
+  "/root/repo/tests/entities/meshes/test_mesh_entity.cpp" "tests/entities/CMakeFiles/test_entities.dir/meshes/test_mesh_entity.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/meshes/test_mesh_entity.cpp.o.d"
+  "/root/repo/tests/entities/structures/test_color_definition.cpp" "tests/entities/CMakeFiles/test_entities.dir/structures/test_color_definition.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/structures/test_color_definition.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_curve_surface_intersection.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_curve_surface_intersection.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_curve_surface_intersection.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_curve_surface_inversion.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_curve_surface_inversion.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_curve_surface_inversion.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_i_surface.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_i_surface.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_i_surface.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_minimum_distance.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_minimum_distance.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_minimum_distance.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_plane.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_plane.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_plane.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_rational_b_spline_surface.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_rational_b_spline_surface.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_rational_b_spline_surface.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_rational_b_spline_surface_edit.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_rational_b_spline_surface_edit.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_rational_b_spline_surface_edit.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_restricted_surface_mesh.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_restricted_surface_mesh.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_restricted_surface_mesh.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_ruled_surface.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_ruled_surface.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_ruled_surface.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_surface_boundary_edges.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_surface_boundary_edges.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_surface_boundary_edges.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_surface_line_intersection.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_surface_line_intersection.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_surface_line_intersection.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_surface_of_revolution.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_surface_of_revolution.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_surface_of_revolution.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_surface_tessellation_tolerance.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_surface_tessellation_tolerance.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_surface_tessellation_tolerance.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_tabulated_cylinder.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_tabulated_cylinder.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_tabulated_cylinder.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_tessellation_cache.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_tessellation_cache.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_tessellation_cache.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_tessellation_sidecar.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_tessellation_sidecar.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_tessellation_sidecar.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_trimmed_surface.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_trimmed_surface.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_trimmed_surface.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_trimmed_surface_edit.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_trimmed_surface_edit.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_trimmed_surface_edit.cpp.o.d"
+  "/root/repo/tests/entities/surfaces/test_watertight_mesh.cpp" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_watertight_mesh.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/surfaces/test_watertight_mesh.cpp.o.d"
+  "/root/repo/tests/entities/test_entity_base.cpp" "tests/entities/CMakeFiles/test_entities.dir/test_entity_base.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/test_entity_base.cpp.o.d"
+  "/root/repo/tests/entities/test_entity_parameter_data.cpp" "tests/entities/CMakeFiles/test_entities.dir/test_entity_parameter_data.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/test_entity_parameter_data.cpp.o.d"
+  "/root/repo/tests/entities/test_entity_type.cpp" "tests/entities/CMakeFiles/test_entities.dir/test_entity_type.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/test_entity_type.cpp.o.d"
+  "/root/repo/tests/entities/test_factory.cpp" "tests/entities/CMakeFiles/test_entities.dir/test_factory.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/test_factory.cpp.o.d"
+  "/root/repo/tests/entities/test_geometry_revision.cpp" "tests/entities/CMakeFiles/test_entities.dir/test_geometry_revision.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/test_geometry_revision.cpp.o.d"
+  "/root/repo/tests/entities/test_pointer_container.cpp" "tests/entities/CMakeFiles/test_entities.dir/test_pointer_container.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/test_pointer_container.cpp.o.d"
+  "/root/repo/tests/entities/transformations/test_transformation_matrix.cpp" "tests/entities/CMakeFiles/test_entities.dir/transformations/test_transformation_matrix.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/transformations/test_transformation_matrix.cpp.o.d"
+  "/root/repo/tests/entities/views/test_curve_view.cpp" "tests/entities/CMakeFiles/test_entities.dir/views/test_curve_view.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/views/test_curve_view.cpp.o.d"
+  "/root/repo/tests/entities/views/test_surface_view.cpp" "tests/entities/CMakeFiles/test_entities.dir/views/test_surface_view.cpp.o" "gcc" "tests/entities/CMakeFiles/test_entities.dir/views/test_surface_view.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/CMakeFiles/igesio.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/graphics/CMakeFiles/igesio_graphics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/models/CMakeFiles/igesio_models.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/entities/CMakeFiles/igesio_entities.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/utils/CMakeFiles/igesio_utils.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/numerics/CMakeFiles/igesio_numerics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/CMakeFiles/igesio_glad_gl_core_43.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
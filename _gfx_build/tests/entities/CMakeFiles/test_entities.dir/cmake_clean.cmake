@@ -0,0 +1,121 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_entities.dir/curves/algorithms/test_curve_discretization.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/algorithms/test_curve_discretization.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/algorithms/test_extremal_polygon.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/algorithms/test_extremal_polygon.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/algorithms/test_polygonal_approximation.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/algorithms/test_polygonal_approximation.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_algorithms.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_algorithms.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_circular_arc.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_circular_arc.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_composite_curve.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_composite_curve.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_composite_curve_edit.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_composite_curve_edit.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_conic_arc.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_conic_arc.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_copious_data.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_copious_data.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_curve_curve_intersection.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_curve_curve_intersection.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_curve_line_intersection.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_curve_line_intersection.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_curve_on_a_parametric_surface.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_curve_on_a_parametric_surface.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_i_curve.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_i_curve.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_line.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_line.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_linear_path.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_linear_path.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_nurbs_approximation_algorithms.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_nurbs_approximation_algorithms.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_parametric_spline_curve.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_parametric_spline_curve.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_point.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_point.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_rational_b_spline_curve.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_rational_b_spline_curve.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_rational_b_spline_curve_edit.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_rational_b_spline_curve_edit.cpp.o.d"
+  "CMakeFiles/test_entities.dir/curves/test_signed_curvature.cpp.o"
+  "CMakeFiles/test_entities.dir/curves/test_signed_curvature.cpp.o.d"
+  "CMakeFiles/test_entities.dir/de/test_de_color.cpp.o"
+  "CMakeFiles/test_entities.dir/de/test_de_color.cpp.o.d"
+  "CMakeFiles/test_entities.dir/de/test_de_level.cpp.o"
+  "CMakeFiles/test_entities.dir/de/test_de_level.cpp.o.d"
+  "CMakeFiles/test_entities.dir/de/test_de_line_font_pattern.cpp.o"
+  "CMakeFiles/test_entities.dir/de/test_de_line_font_pattern.cpp.o.d"
+  "CMakeFiles/test_entities.dir/de/test_raw_entity_de.cpp.o"
+  "CMakeFiles/test_entities.dir/de/test_raw_entity_de.cpp.o.d"
+  "CMakeFiles/test_entities.dir/de/test_raw_entity_de_is_valid.cpp.o"
+  "CMakeFiles/test_entities.dir/de/test_raw_entity_de_is_valid.cpp.o.d"
+  "CMakeFiles/test_entities.dir/meshes/test_mesh_entity.cpp.o"
+  "CMakeFiles/test_entities.dir/meshes/test_mesh_entity.cpp.o.d"
+  "CMakeFiles/test_entities.dir/structures/test_color_definition.cpp.o"
+  "CMakeFiles/test_entities.dir/structures/test_color_definition.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_curve_surface_intersection.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_curve_surface_intersection.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_curve_surface_inversion.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_curve_surface_inversion.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_i_surface.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_i_surface.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_minimum_distance.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_minimum_distance.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_plane.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_plane.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_rational_b_spline_surface.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_rational_b_spline_surface.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_rational_b_spline_surface_edit.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_rational_b_spline_surface_edit.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_restricted_surface_mesh.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_restricted_surface_mesh.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_ruled_surface.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_ruled_surface.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_surface_boundary_edges.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_surface_boundary_edges.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_surface_line_intersection.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_surface_line_intersection.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_surface_of_revolution.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_surface_of_revolution.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_surface_tessellation_tolerance.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_surface_tessellation_tolerance.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_tabulated_cylinder.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_tabulated_cylinder.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_tessellation_cache.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_tessellation_cache.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_tessellation_sidecar.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_tessellation_sidecar.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_trimmed_surface.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_trimmed_surface.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_trimmed_surface_edit.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_trimmed_surface_edit.cpp.o.d"
+  "CMakeFiles/test_entities.dir/surfaces/test_watertight_mesh.cpp.o"
+  "CMakeFiles/test_entities.dir/surfaces/test_watertight_mesh.cpp.o.d"
+  "CMakeFiles/test_entities.dir/test_entity_base.cpp.o"
+  "CMakeFiles/test_entities.dir/test_entity_base.cpp.o.d"
+  "CMakeFiles/test_entities.dir/test_entity_parameter_data.cpp.o"
+  "CMakeFiles/test_entities.dir/test_entity_parameter_data.cpp.o.d"
+  "CMakeFiles/test_entities.dir/test_entity_type.cpp.o"
+  "CMakeFiles/test_entities.dir/test_entity_type.cpp.o.d"
+  "CMakeFiles/test_entities.dir/test_factory.cpp.o"
+  "CMakeFiles/test_entities.dir/test_factory.cpp.o.d"
+  "CMakeFiles/test_entities.dir/test_geometry_revision.cpp.o"
+  "CMakeFiles/test_entities.dir/test_geometry_revision.cpp.o.d"
+  "CMakeFiles/test_entities.dir/test_pointer_container.cpp.o"
+  "CMakeFiles/test_entities.dir/test_pointer_container.cpp.o.d"
+  "CMakeFiles/test_entities.dir/transformations/test_transformation_matrix.cpp.o"
+  "CMakeFiles/test_entities.dir/transformations/test_transformation_matrix.cpp.o.d"
+  "CMakeFiles/test_entities.dir/views/test_curve_view.cpp.o"
+  "CMakeFiles/test_entities.dir/views/test_curve_view.cpp.o.d"
+  "CMakeFiles/test_entities.dir/views/test_surface_view.cpp.o"
+  "CMakeFiles/test_entities.dir/views/test_surface_view.cpp.o.d"
+  "test_entities"
+  "test_entities.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_entities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
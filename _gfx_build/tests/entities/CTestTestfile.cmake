@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/entities
+# Build directory: /root/repo/_gfx_build/tests/entities
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_entities "/root/repo/_gfx_build/tests/entities/test_entities")
+set_tests_properties(test_entities PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/entities/CMakeLists.txt;83;add_test;/root/repo/tests/entities/CMakeLists.txt;0;")
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/graphics/test_composite_render.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_composite_render.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_composite_render.cpp.o.d"
+  "/root/repo/tests/graphics/test_graphics_registry.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_graphics_registry.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_graphics_registry.cpp.o.d"
+  "/root/repo/tests/graphics/test_level_of_detail.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_level_of_detail.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_level_of_detail.cpp.o.d"
+  "/root/repo/tests/graphics/test_mesh_staging.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_mesh_staging.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_mesh_staging.cpp.o.d"
+  "/root/repo/tests/graphics/test_override_pull.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_override_pull.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_override_pull.cpp.o.d"
+  "/root/repo/tests/graphics/test_pick_registry.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_pick_registry.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_pick_registry.cpp.o.d"
+  "/root/repo/tests/graphics/test_picking_reconcile.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_picking_reconcile.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_picking_reconcile.cpp.o.d"
+  "/root/repo/tests/graphics/test_renderer_smoke.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_renderer_smoke.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_renderer_smoke.cpp.o.d"
+  "/root/repo/tests/graphics/test_scene_reconcile.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_scene_reconcile.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_scene_reconcile.cpp.o.d"
+  "/root/repo/tests/graphics/test_scene_walk.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_scene_walk.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_scene_walk.cpp.o.d"
+  "/root/repo/tests/graphics/test_selection_pull.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_selection_pull.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_selection_pull.cpp.o.d"
+  "/root/repo/tests/graphics/test_shader_registry.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_shader_registry.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_shader_registry.cpp.o.d"
+  "/root/repo/tests/graphics/test_surface_edge_render.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_surface_edge_render.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_surface_edge_render.cpp.o.d"
+  "/root/repo/tests/graphics/test_surface_mesh.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_surface_mesh.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_surface_mesh.cpp.o.d"
+  "/root/repo/tests/graphics/test_triangle_mesh_render.cpp" "tests/graphics/CMakeFiles/test_graphics.dir/test_triangle_mesh_render.cpp.o" "gcc" "tests/graphics/CMakeFiles/test_graphics.dir/test_triangle_mesh_render.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/CMakeFiles/igesio.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/graphics/CMakeFiles/igesio_graphics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/models/CMakeFiles/igesio_models.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/entities/CMakeFiles/igesio_entities.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/utils/CMakeFiles/igesio_utils.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/numerics/CMakeFiles/igesio_numerics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/CMakeFiles/igesio_glad_gl_core_43.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_graphics.dir/test_composite_render.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_composite_render.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_graphics_registry.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_graphics_registry.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_level_of_detail.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_level_of_detail.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_mesh_staging.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_mesh_staging.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_override_pull.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_override_pull.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_pick_registry.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_pick_registry.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_picking_reconcile.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_picking_reconcile.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_renderer_smoke.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_renderer_smoke.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_scene_reconcile.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_scene_reconcile.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_scene_walk.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_scene_walk.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_selection_pull.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_selection_pull.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_shader_registry.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_shader_registry.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_surface_edge_render.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_surface_edge_render.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_surface_mesh.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_surface_mesh.cpp.o.d"
+  "CMakeFiles/test_graphics.dir/test_triangle_mesh_render.cpp.o"
+  "CMakeFiles/test_graphics.dir/test_triangle_mesh_render.cpp.o.d"
+  "test_graphics"
+  "test_graphics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_graphics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/graphics
+# Build directory: /root/repo/_gfx_build/tests/graphics
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_graphics "/root/repo/_gfx_build/tests/graphics/test_graphics")
+set_tests_properties(test_graphics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/graphics/CMakeLists.txt;27;add_test;/root/repo/tests/graphics/CMakeLists.txt;0;")
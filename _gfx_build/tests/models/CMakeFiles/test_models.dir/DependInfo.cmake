@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/models/test_assembly.cpp" "tests/models/CMakeFiles/test_models.dir/test_assembly.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_assembly.cpp.o.d"
+  "/root/repo/tests/models/test_assembly_coords.cpp" "tests/models/CMakeFiles/test_models.dir/test_assembly_coords.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_assembly_coords.cpp.o.d"
+  "/root/repo/tests/models/test_clearance.cpp" "tests/models/CMakeFiles/test_models.dir/test_clearance.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_clearance.cpp.o.d"
+  "/root/repo/tests/models/test_flatten.cpp" "tests/models/CMakeFiles/test_models.dir/test_flatten.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_flatten.cpp.o.d"
+  "/root/repo/tests/models/test_global_param.cpp" "tests/models/CMakeFiles/test_models.dir/test_global_param.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_global_param.cpp.o.d"
+  "/root/repo/tests/models/test_initial_tree.cpp" "tests/models/CMakeFiles/test_models.dir/test_initial_tree.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_initial_tree.cpp.o.d"
+  "/root/repo/tests/models/test_non_iges_entity.cpp" "tests/models/CMakeFiles/test_models.dir/test_non_iges_entity.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_non_iges_entity.cpp.o.d"
+  "/root/repo/tests/models/test_ray_caster.cpp" "tests/models/CMakeFiles/test_models.dir/test_ray_caster.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_ray_caster.cpp.o.d"
+  "/root/repo/tests/models/test_scene.cpp" "tests/models/CMakeFiles/test_models.dir/test_scene.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_scene.cpp.o.d"
+  "/root/repo/tests/models/test_selection_set.cpp" "tests/models/CMakeFiles/test_models.dir/test_selection_set.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_selection_set.cpp.o.d"
+  "/root/repo/tests/models/test_tessellation.cpp" "tests/models/CMakeFiles/test_models.dir/test_tessellation.cpp.o" "gcc" "tests/models/CMakeFiles/test_models.dir/test_tessellation.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/CMakeFiles/igesio.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/graphics/CMakeFiles/igesio_graphics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/models/CMakeFiles/igesio_models.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/entities/CMakeFiles/igesio_entities.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/utils/CMakeFiles/igesio_utils.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/numerics/CMakeFiles/igesio_numerics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/CMakeFiles/igesio_glad_gl_core_43.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_models.dir/test_assembly.cpp.o"
+  "CMakeFiles/test_models.dir/test_assembly.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_assembly_coords.cpp.o"
+  "CMakeFiles/test_models.dir/test_assembly_coords.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_clearance.cpp.o"
+  "CMakeFiles/test_models.dir/test_clearance.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_flatten.cpp.o"
+  "CMakeFiles/test_models.dir/test_flatten.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_global_param.cpp.o"
+  "CMakeFiles/test_models.dir/test_global_param.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_initial_tree.cpp.o"
+  "CMakeFiles/test_models.dir/test_initial_tree.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_non_iges_entity.cpp.o"
+  "CMakeFiles/test_models.dir/test_non_iges_entity.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_ray_caster.cpp.o"
+  "CMakeFiles/test_models.dir/test_ray_caster.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_scene.cpp.o"
+  "CMakeFiles/test_models.dir/test_scene.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_selection_set.cpp.o"
+  "CMakeFiles/test_models.dir/test_selection_set.cpp.o.d"
+  "CMakeFiles/test_models.dir/test_tessellation.cpp.o"
+  "CMakeFiles/test_models.dir/test_tessellation.cpp.o.d"
+  "test_models"
+  "test_models.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_models.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
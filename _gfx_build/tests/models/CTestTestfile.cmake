@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/models
+# Build directory: /root/repo/_gfx_build/tests/models
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_models "/root/repo/_gfx_build/tests/models/test_models")
+set_tests_properties(test_models PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/models/CMakeLists.txt;22;add_test;/root/repo/tests/models/CMakeLists.txt;0;")
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/numerics/test_bounding_box.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_bounding_box.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_bounding_box.cpp.o.d"
+  "/root/repo/tests/numerics/test_bvh.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_bvh.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_bvh.cpp.o.d"
+  "/root/repo/tests/numerics/test_combinatorics.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_combinatorics.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_combinatorics.cpp.o.d"
+  "/root/repo/tests/numerics/test_constexpr_math.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_constexpr_math.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_constexpr_math.cpp.o.d"
+  "/root/repo/tests/numerics/test_integration.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_integration.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_integration.cpp.o.d"
+  "/root/repo/tests/numerics/test_matrix.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_matrix.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_matrix.cpp.o.d"
+  "/root/repo/tests/numerics/test_mesh_adjacency.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_adjacency.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_adjacency.cpp.o.d"
+  "/root/repo/tests/numerics/test_mesh_bvh.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_bvh.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_bvh.cpp.o.d"
+  "/root/repo/tests/numerics/test_mesh_line_intersection.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_line_intersection.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_line_intersection.cpp.o.d"
+  "/root/repo/tests/numerics/test_mesh_reordering.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_reordering.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_reordering.cpp.o.d"
+  "/root/repo/tests/numerics/test_mesh_simplification.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_simplification.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_mesh_simplification.cpp.o.d"
+  "/root/repo/tests/numerics/test_optimization.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_optimization.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_optimization.cpp.o.d"
+  "/root/repo/tests/numerics/test_polygon.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_polygon.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_polygon.cpp.o.d"
+  "/root/repo/tests/numerics/test_polygon_triangulation.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_polygon_triangulation.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_polygon_triangulation.cpp.o.d"
+  "/root/repo/tests/numerics/test_tolerance.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_tolerance.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_tolerance.cpp.o.d"
+  "/root/repo/tests/numerics/test_triangle_mesh.cpp" "tests/numerics/CMakeFiles/test_numerics.dir/test_triangle_mesh.cpp.o" "gcc" "tests/numerics/CMakeFiles/test_numerics.dir/test_triangle_mesh.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/numerics/CMakeFiles/igesio_numerics.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
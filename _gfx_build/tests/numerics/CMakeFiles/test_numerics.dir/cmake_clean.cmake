@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_numerics.dir/test_bounding_box.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_bounding_box.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_bvh.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_bvh.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_combinatorics.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_combinatorics.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_constexpr_math.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_constexpr_math.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_integration.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_integration.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_matrix.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_matrix.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_mesh_adjacency.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_mesh_adjacency.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_mesh_bvh.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_mesh_bvh.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_mesh_line_intersection.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_mesh_line_intersection.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_mesh_reordering.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_mesh_reordering.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_mesh_simplification.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_mesh_simplification.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_optimization.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_optimization.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_polygon.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_polygon.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_polygon_triangulation.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_polygon_triangulation.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_tolerance.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_tolerance.cpp.o.d"
+  "CMakeFiles/test_numerics.dir/test_triangle_mesh.cpp.o"
+  "CMakeFiles/test_numerics.dir/test_triangle_mesh.cpp.o.d"
+  "test_numerics"
+  "test_numerics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numerics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
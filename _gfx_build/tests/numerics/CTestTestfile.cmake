@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/numerics
+# Build directory: /root/repo/_gfx_build/tests/numerics
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_numerics "/root/repo/_gfx_build/tests/numerics/test_numerics")
+set_tests_properties(test_numerics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/numerics/CMakeLists.txt;23;add_test;/root/repo/tests/numerics/CMakeLists.txt;0;")
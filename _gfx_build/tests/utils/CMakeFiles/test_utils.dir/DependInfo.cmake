@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/utils/test_iges_binary_reader.cpp" "tests/utils/CMakeFiles/test_utils.dir/test_iges_binary_reader.cpp.o" "gcc" "tests/utils/CMakeFiles/test_utils.dir/test_iges_binary_reader.cpp.o.d"
+  "/root/repo/tests/utils/test_iges_string_utils_basic.cpp" "tests/utils/CMakeFiles/test_utils.dir/test_iges_string_utils_basic.cpp.o" "gcc" "tests/utils/CMakeFiles/test_utils.dir/test_iges_string_utils_basic.cpp.o.d"
+  "/root/repo/tests/utils/test_iges_string_utils_global_section.cpp" "tests/utils/CMakeFiles/test_utils.dir/test_iges_string_utils_global_section.cpp.o" "gcc" "tests/utils/CMakeFiles/test_utils.dir/test_iges_string_utils_global_section.cpp.o.d"
+  "/root/repo/tests/utils/test_iges_string_utils_line_assertion.cpp" "tests/utils/CMakeFiles/test_utils.dir/test_iges_string_utils_line_assertion.cpp.o" "gcc" "tests/utils/CMakeFiles/test_utils.dir/test_iges_string_utils_line_assertion.cpp.o.d"
+  "/root/repo/tests/utils/test_iges_string_utils_serialization.cpp" "tests/utils/CMakeFiles/test_utils.dir/test_iges_string_utils_serialization.cpp.o" "gcc" "tests/utils/CMakeFiles/test_utils.dir/test_iges_string_utils_serialization.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/utils/CMakeFiles/igesio_utils.dir/DependInfo.cmake"
+  "/root/repo/_gfx_build/src/common/CMakeFiles/igesio_common.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_utils.dir/test_iges_binary_reader.cpp.o"
+  "CMakeFiles/test_utils.dir/test_iges_binary_reader.cpp.o.d"
+  "CMakeFiles/test_utils.dir/test_iges_string_utils_basic.cpp.o"
+  "CMakeFiles/test_utils.dir/test_iges_string_utils_basic.cpp.o.d"
+  "CMakeFiles/test_utils.dir/test_iges_string_utils_global_section.cpp.o"
+  "CMakeFiles/test_utils.dir/test_iges_string_utils_global_section.cpp.o.d"
+  "CMakeFiles/test_utils.dir/test_iges_string_utils_line_assertion.cpp.o"
+  "CMakeFiles/test_utils.dir/test_iges_string_utils_line_assertion.cpp.o.d"
+  "CMakeFiles/test_utils.dir/test_iges_string_utils_serialization.cpp.o"
+  "CMakeFiles/test_utils.dir/test_iges_string_utils_serialization.cpp.o.d"
+  "test_utils"
+  "test_utils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
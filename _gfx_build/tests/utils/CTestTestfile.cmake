@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/utils
+# Build directory: /root/repo/_gfx_build/tests/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_utils "/root/repo/_gfx_build/tests/utils/test_utils")
+set_tests_properties(test_utils PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/utils/CMakeLists.txt;15;add_test;/root/repo/tests/utils/CMakeLists.txt;0;")
@@ -18,10 +18,12 @@
 #include <sstream>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <igesio/reader.h>
 #include <igesio/entities/interfaces/i_surface.h>
+#include <igesio/entities/surfaces/algorithms/tessellation_sidecar.h>
 #include <igesio/graphics/core/material_property.h>
 
 #ifdef IGESIO_STL_EXTENSION_ENABLED
@@ -227,6 +229,8 @@ IgesViewerGUI::IgesViewerGUI(
 }
 
 IgesViewerGUI::~IgesViewerGUI() {
+    SaveTessellationSidecars();
+
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
@@ -332,7 +336,23 @@ void IgesViewerGUI::LoadFile(const std::string& filename, const bool replace) {
         type_name = "IGES";
         loader = [this](const std::string& path) {
             const auto iges = igesio::ReadIges(path);
-            return iges.RootPtr();
+            auto root = iges.RootPtr();
+            // 前回の終了時に保存したテッセレーション結果を共有キャッシュへ戻し、
+            // 内容の変わっていないエンティティのテッセレーションを省略する
+            const std::string sidecar = path + entities::kTessellationSidecarExtension;
+            if (root) {
+                const auto loaded = entities::LoadTessellationSidecar(
+                        sidecar, root->FindEntities(
+                                [](const entities::IEntityIdentifier&) { return true; },
+                                true),
+                        entities::GetSharedTessellationCache());
+                if (loaded > 0) {
+                    std::cout << "Loaded " << loaded << " cached tessellation(s) from "
+                              << sidecar << std::endl;
+                }
+                sidecars_.emplace_back(sidecar, root);
+            }
+            return root;
         };
     }
 
@@ -343,6 +363,10 @@ void IgesViewerGUI::LoadFileByType(
         const std::string& filename, bool replace,
         const std::string& type_name,
         const std::function<std::shared_ptr<models::Assembly>(const std::string&)>& loader) {
+    // 置き換える前に、読込済みモデルのテッセレーション結果を保存する
+    // (同じファイルを読み直す場合にも、保存した結果を読み込めるよう先に行う)
+    if (replace) SaveTessellationSidecars();
+
     try {
         const auto child = loader(filename);
         if (!child) {
@@ -362,6 +386,23 @@ void IgesViewerGUI::LoadFileByType(
     }
 }
 
+void IgesViewerGUI::SaveTessellationSidecars() {
+    for (const auto& [path, weak_root] : sidecars_) {
+        const auto root = weak_root.lock();
+        // 一掃済みのモデルは対象外
+        if (!root) continue;
+        const auto all = root->FindEntities(
+                [](const entities::IEntityIdentifier&) { return true; }, true);
+        if (!entities::SaveTessellationSidecar(
+                path, all, entities::GetSharedTessellationCache())) {
+            std::cerr << "Failed to save tessellation cache: " << path << std::endl;
+        }
+    }
+    sidecars_.erase(std::remove_if(sidecars_.begin(), sidecars_.end(),
+                                   [](const auto& s) { return s.second.expired(); }),
+                    sidecars_.end());
+}
+
 void IgesViewerGUI::AttachLoadedAssembly(
         const std::shared_ptr<models::Assembly>& child, const bool replace) {
     if (replace) {
@@ -18,6 +18,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "igesio/graphics/core/gl_backend.h"
@@ -99,6 +100,9 @@ class IgesViewerGUI {
     bool show_all_ = true;
     /// @brief 起動時に一度だけ読み込むファイル (IGES/STL)
     std::string initial_iges_file_;
+    /// @brief 読み込んだIGESファイルのテッセレーションのサイドカーファイルのパスと、
+    ///        そのモデルのAssembly (モデルの置き換え時・終了時に保存する)
+    std::vector<std::pair<std::string, std::weak_ptr<models::Assembly>>> sidecars_;
 
  public:
     /// @brief コンストラクタ
@@ -167,6 +171,12 @@ class IgesViewerGUI {
     void AttachLoadedAssembly(const std::shared_ptr<models::Assembly>& child,
                               bool replace);
 
+    /// @brief 読み込んだIGESファイルのテッセレーション結果をサイドカーファイルへ保存する
+    /// @note 共有テッセレーションキャッシュが保持する結果のうち、各モデルの
+    ///       エンティティの現在の形状に対応するものを保存する. 次回の読み込み時には
+    ///       内容の変わっていないエンティティのテッセレーションを省略できる
+    void SaveTessellationSidecars();
+
     /// @brief 型別フィルタUI用のキャッシュへ登録する (検証診断の表示を含む)
     /// @note 描画オブジェクト自体はレンダラがSceneツリーとの突き合わせで
     ///       遅延生成するため、ここではUI状態のみを構築する
@@ -0,0 +1,122 @@
+/**
+ * @file common/lazy_cache.h
+ * @brief 複数スレッドから参照できる遅延構築キャッシュ
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note エンティティの形状から導出する値 (領域判定・弧長テーブル・BVH等) を、
+ *       最初の参照時に一度だけ構築して共有するために使用する. 構築済みの値は
+ *       std::shared_ptrのアトミックな読み書きにより公開するため、参照時にロックは
+ *       取らない. 構築のみ排他的に行い、同時に参照した他のスレッドは構築の完了を
+ *       待ってその結果を使用する (std::call_onceと同様の意味論).
+ */
+#ifndef IGESIO_COMMON_LAZY_CACHE_H_
+#define IGESIO_COMMON_LAZY_CACHE_H_
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+
+
+namespace igesio {
+
+/// @brief 複数スレッドから参照できる遅延構築キャッシュ
+/// @tparam T キャッシュする値の型
+/// @tparam Key 値の有効性を判定するキーの型 (形状のリビジョン等). キーを用いない
+///         (Resetでのみ無効化する) 場合は既定の`std::nullptr_t`とする
+/// @note Getは任意のスレッドから同時に呼び出してよい. 同じキーに対する構築は
+///       高々一度だけ行われ、構築中に呼び出した他のスレッドは完了を待つ.
+///       構築関数が例外を送出した場合は何も保持せず、次の呼び出しで再び構築する.
+/// @note Resetおよび異なるキーでのGetは保持する値を置き換える. 置き換え前に
+///       Getで取得したstd::shared_ptrは有効なままである.
+/// @note 構築関数の中から同じキャッシュのGetを呼び出してはならない (デッドロックする)
+/// @note コピーすると、コピー元が保持する値をコピー先と共有する
+template <typename T, typename Key = std::nullptr_t>
+class LazyCache {
+    /// @brief 保持する値とそのキー
+    struct Entry {
+        /// @brief 構築時のキー
+        Key key;
+        /// @brief 構築した値
+        T value;
+    };
+
+    /// @brief 構築済みの値. std::atomic_load/std::atomic_storeでのみ読み書きする
+    std::shared_ptr<const Entry> entry_;
+    /// @brief 構築を排他的に行うためのミューテックス
+    std::mutex build_mutex_;
+
+ public:
+    /// @brief デフォルトコンストラクタ (値を保持しない)
+    LazyCache() = default;
+    /// @brief コピーコンストラクタ (保持する値を共有する)
+    LazyCache(const LazyCache& other) : entry_(other.Load()) {}
+    /// @brief コピー代入演算子 (保持する値を共有する)
+    LazyCache& operator=(const LazyCache& other) {
+        if (this != &other) Store(other.Load());
+        return *this;
+    }
+    /// @brief デストラクタ
+    ~LazyCache() = default;
+
+    /// @brief キーに対応する値を取得する (未構築の場合は構築する)
+    /// @tparam Builder 引数を取らず、Tに変換できる値を返す呼び出し可能型
+    /// @param key 値のキー. 保持する値のキーと異なる場合は再構築する
+    /// @param build 値を構築する関数
+    /// @return 構築済みの値
+    /// @throw buildが送出した例外
+    template <typename Builder>
+    std::shared_ptr<const T> Get(const Key& key, const Builder& build) {
+        if (auto entry = Load(); entry && entry->key == key) {
+            return Alias(std::move(entry));
+        }
+
+        std::lock_guard<std::mutex> lock(build_mutex_);
+        // 待機中に他のスレッドが構築した場合はその結果を使用する
+        if (auto entry = Load(); entry && entry->key == key) {
+            return Alias(std::move(entry));
+        }
+        auto entry = std::make_shared<const Entry>(Entry{key, build()});
+        Store(entry);
+        return Alias(std::move(entry));
+    }
+
+    /// @brief 値を取得する (未構築の場合は構築する)
+    /// @note キーを用いない (Key = std::nullptr_t) 場合に使用する
+    template <typename Builder>
+    std::shared_ptr<const T> Get(const Builder& build) {
+        return Get(Key{}, build);
+    }
+
+    /// @brief キーに対応する値を保持している場合はそれを返す (構築はしない)
+    /// @param key 値のキー
+    /// @return 保持する値. 未構築またはキーが異なる場合はnullptr
+    std::shared_ptr<const T> Peek(const Key& key = Key{}) const {
+        auto entry = Load();
+        if (!entry || !(entry->key == key)) return nullptr;
+        return Alias(std::move(entry));
+    }
+
+    /// @brief 保持する値を破棄する
+    void Reset() noexcept { Store(nullptr); }
+
+ private:
+    /// @brief entry_をアトミックに読み出す
+    std::shared_ptr<const Entry> Load() const noexcept {
+        return std::atomic_load(&entry_);
+    }
+    /// @brief entry_をアトミックに書き込む
+    void Store(std::shared_ptr<const Entry> entry) noexcept {
+        std::atomic_store(&entry_, std::move(entry));
+    }
+    /// @brief エントリの所有権を共有し、値のみを指すポインタを作成する
+    static std::shared_ptr<const T> Alias(std::shared_ptr<const Entry> entry) noexcept {
+        const T* value = &entry->value;
+        return std::shared_ptr<const T>(std::move(entry), value);
+    }
+};
+
+}  // namespace igesio
+
+#endif  // IGESIO_COMMON_LAZY_CACHE_H_
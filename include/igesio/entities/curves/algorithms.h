@@ -17,6 +17,8 @@
 #include "igesio/entities/interfaces/i_curve.h"
 
 // curves/algorithms下の関数を取得
+#include "igesio/entities/curves/algorithms/curve_curve_intersection.h"
+#include "igesio/entities/curves/algorithms/curve_discretization.h"
 #include "igesio/entities/curves/algorithms/curve_line_intersection.h"
 
 
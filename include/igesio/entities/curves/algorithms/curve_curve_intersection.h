@@ -0,0 +1,111 @@
+/**
+ * @file entities/curves/algorithms/curve_curve_intersection.h
+ * @brief 曲線と曲線の交点計算
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * ICurveの具象クラスに依存せず、以下のAPIのみを使用する:
+ *   - TryGetDerivatives(t, 1) : モデル空間の点C(t)と1階導関数C'(t)
+ *   - GetParameterRange() / IsClosed() / GetBoundingBox()
+ *   - GetLinearSegments() : 折れ線近似で直線部を分割しないために使用する
+ *
+ * ### アルゴリズム概要
+ * 1. 広域判定: 各曲線を許容距離chord_toleranceで折れ線近似し、辺の
+ *    バウンディングボックスのBVHを構築する. 一方の曲線の各辺について、
+ *    ボックスが重なる他方の辺を列挙する. 直線部は1辺として扱うため、
+ *    線分・折れ線どうしの判定は辺の数に比例する.
+ * 2. 候補の絞り込み: 辺どうしの最近接点の距離が、両曲線の折れ線化誤差と
+ *    toleranceの和以下の組のみを候補とする. 平行な辺の組では、重なり区間の
+ *    端点を候補とする.
+ * 3. 精密化: 候補の辺上の最近接点に対応するパラメータ (s, t) を初期値として、
+ *    |C1(s) - C2(t)|^2 を減衰付きガウス・ニュートン法で最小化する.
+ *    最終的な距離gapがtolerance以下の点を交点とする (接する交点も含む).
+ *    接する交点では候補ごとの収束点が散らばるため、chord_toleranceより近く
+ *    パラメータの中点でも距離がtolerance以下の解は1つの接触点に統合する.
+ *
+ * パラメータ空間 (トリム境界のUV曲線等、z=0平面上の曲線) での判定には
+ * planarを指定する. 点と導関数のz成分を無視し、xy平面上で交点を求める.
+ */
+#ifndef IGESIO_ENTITIES_CURVES_ALGORITHMS_CURVE_CURVE_INTERSECTION_H_
+#define IGESIO_ENTITIES_CURVES_ALGORITHMS_CURVE_CURVE_INTERSECTION_H_
+
+#include <memory>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/interfaces/i_curve.h"
+
+
+
+namespace igesio::entities {
+
+/// @brief 曲線と曲線の交点情報
+struct CurveCurveIntersection {
+    /// @brief 交点の座標 (C1(t1)とC2(t2)の中点)
+    Vector3d position;
+    /// @brief 1つ目の曲線のパラメータ
+    double t1;
+    /// @brief 2つ目の曲線のパラメータ
+    double t2;
+    /// @brief C1(t1)とC2(t2)の距離
+    double gap;
+};
+
+/// @brief IntersectCurvesの探索制御パラメータ
+struct CurveCurveIntersectionParams {
+    /// @brief [モデル単位] 距離がこの値以下の点を交点とみなす
+    double tolerance = 1e-6;
+    /// @brief [モデル単位] 広域判定に用いる折れ線近似の許容距離
+    /// @note 0以下の場合は、曲線ごとにバウンディングボックスの対角線長の
+    ///       1/1000を用いる. 小さくすると候補が減るが折れ線化のコストが増加する
+    double chord_tolerance = 0.0;
+    /// @brief trueの場合、z成分を無視してxy平面 (パラメータ空間) 上で判定する
+    bool planar = false;
+    /// @brief ガウス・ニュートン法の最大反復回数
+    int max_iter = 50;
+    /// @brief 収束判定の許容誤差 (パラメータの更新幅)
+    double convergence_tol = 1e-12;
+    /// @brief 重複解の除去に使用する空間距離の許容誤差
+    double dedup_tol = 1e-6;
+};
+
+/// @brief 2つの曲線の交点を計算する
+/// @param curve1 1つ目の曲線 (有限なパラメータ範囲を持つこと)
+/// @param curve2 2つ目の曲線 (有限なパラメータ範囲を持つこと)
+/// @param params 探索制御パラメータ
+/// @return gap <= params.toleranceの交点のリスト (重複除去済み・t1昇順ソート済み)
+/// @throw std::invalid_argument いずれかの曲線のパラメータ範囲が無限の場合
+/// @note 曲線が一致する (重なる) 区間では、区間の端点付近の点が返される.
+///       区間全体を1つの結果として表すことはしない
+/// @note curve1とcurve2に同じ曲線を渡した場合、自己交差ではなく
+///       曲線全体が重なる区間として扱われる
+std::vector<CurveCurveIntersection> IntersectCurves(
+        const ICurve& curve1, const ICurve& curve2,
+        const CurveCurveIntersectionParams& params = {});
+
+/// @brief 一括判定する曲線の組
+struct CurvePair {
+    /// @brief 1つ目の曲線
+    std::shared_ptr<const ICurve> first;
+    /// @brief 2つ目の曲線
+    std::shared_ptr<const ICurve> second;
+};
+
+/// @brief 複数の曲線の組について、交点をまとめて計算する
+/// @param pairs 曲線の組のリスト
+/// @param params 探索制御パラメータ (全ての組で共通)
+/// @return 各組の交点のリスト (pairsと同じ順序. 各要素はIntersectCurvesと同じ結果)
+/// @throw std::invalid_argument いずれかの曲線がnullptrの場合、または
+///        パラメータ範囲が無限の場合
+/// @note 複数の組に現れる曲線の折れ線近似は一度だけ構築して共有する.
+///       折れ線近似の構築と各組の判定は、それぞれ並列に行う (common/parallel.h).
+///       モデル全体のトリム境界の検証等、多数の組をまとめて判定する場合に用いる
+std::vector<std::vector<CurveCurveIntersection>> IntersectCurvePairs(
+        const std::vector<CurvePair>& pairs,
+        const CurveCurveIntersectionParams& params = {});
+
+}  // namespace igesio::entities
+
+#endif  // IGESIO_ENTITIES_CURVES_ALGORITHMS_CURVE_CURVE_INTERSECTION_H_
@@ -0,0 +1,122 @@
+/**
+ * @file entities/curves/algorithms/curve_discretization.h
+ * @brief 許容量に基づく曲線の適応的な折れ線化
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * 描画 (graphics::ICurveGraphics)・範囲選択のサンプリング・曲面の境界エッジ
+ * (ComputeRestrictedSurfaceEdges) で共通に用いる、曲線の折れ線化.
+ *
+ * ### アルゴリズム概要
+ * 1. パラメータ範囲の両端・角点 (GetCornerParams)・直線部 (GetLinearSegments) の
+ *    端点で範囲を区切る.
+ * 2. 直線部の区間は1区間、それ以外の区間はinitial_segments等分を初期区間とする.
+ * 3. 各区間の中点を評価し、弦高 (中点と弦の距離)・角度 (区間内の接線の回転角.
+ *    両半区間の弦のなす角の2倍で近似)・辺長のいずれかが許容量を超える区間を
+ *    2分割する. これを全ての区間が
+ *    許容量を満たすか、max_depthに達するまで繰り返す.
+ *
+ * 評価は分割の段階ごとに、その段階で必要な全てのパラメータ値をまとめて
+ * ICurve::TryGetPointsAt で行う (変換行列の取得を1回にまとめる).
+ * 評価した点には任意の写像 (ワールド変換、基底曲面による S(B(t)) 等) を適用でき、
+ * 許容量は写像後の空間で判定する. また、スクリーンへの射影を与えた場合は、
+ * 画面上の弦高・辺長 [px] による許容量も併用できる.
+ *
+ * 判定は中点のみで行うため、中点で弦と交わるような局所的な特徴 (S字等) は
+ * 見落としうる. 初期区間数はこれを抑えるために用いる.
+ */
+#ifndef IGESIO_ENTITIES_CURVES_ALGORITHMS_CURVE_DISCRETIZATION_H_
+#define IGESIO_ENTITIES_CURVES_ALGORITHMS_CURVE_DISCRETIZATION_H_
+
+#include <array>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/interfaces/i_curve.h"
+
+
+
+namespace igesio::entities {
+
+/// @brief 曲線の折れ線化・曲面のテッセレーションの許容量
+/// @note 各値は0以下の場合に無効. 全て無効の場合は許容量による適応的な分割を行わない
+///       (曲線は初期区間のみとなる)
+struct TessellationTolerance {
+    /// @brief [モデル単位] 弦高 (折れ線・三角形の辺と曲線・曲面の距離) の許容量
+    double chord_height = 0.0;
+    /// @brief [rad] 辺に沿う接線 (曲面の場合は法線) の回転角の許容量
+    double angle = 0.0;
+    /// @brief [モデル単位] 折れ線・三角形の辺の長さの上限
+    double max_edge_length = 0.0;
+
+    /// @brief いずれかの許容量が有効かどうか
+    bool IsEnabled() const {
+        return chord_height > 0.0 || angle > 0.0 || max_edge_length > 0.0;
+    }
+};
+
+/// @brief スクリーン空間の許容量
+/// @note projectが未設定、または各値が0以下の場合に無効
+struct CurveScreenTolerance {
+    /// @brief (写像後の) 点をスクリーン座標 [px] へ射影する関数.
+    ///        射影できない点 (視点の背後等) ではstd::nulloptを返す
+    std::function<std::optional<Vector2d>(const Vector3d&)> project;
+    /// @brief [px] 画面上の弦高の許容量
+    double chord_height = 0.0;
+    /// @brief [px] 画面上の辺の長さの上限
+    double max_edge_length = 0.0;
+
+    /// @brief いずれかの許容量が有効かどうか
+    bool IsEnabled() const {
+        return static_cast<bool>(project)
+            && (chord_height > 0.0 || max_edge_length > 0.0);
+    }
+};
+
+/// @brief DiscretizeCurveの制御パラメータ
+struct CurveDiscretizationParams {
+    /// @brief (写像後の空間における) 許容量
+    TessellationTolerance tolerance;
+    /// @brief スクリーン空間の許容量
+    CurveScreenTolerance screen;
+    /// @brief 直線部以外の区間の初期分割数 (1以上)
+    int initial_segments = 4;
+    /// @brief 初期区間を2分割する回数の上限 (0以上)
+    int max_depth = 10;
+};
+
+/// @brief 曲線上の点 (TryGetPointAtの値) に適用する写像.
+///        写像できない点ではstd::nulloptを返す
+using CurvePointMap = std::function<std::optional<Vector3d>(const Vector3d&)>;
+
+/// @brief 折れ線化した曲線の一部 (評価できない点を含まない連続部分)
+struct CurvePolyline {
+    /// @brief 各頂点のパラメータ値 (昇順)
+    std::vector<double> params;
+    /// @brief 各頂点の座標 (写像後)
+    std::vector<Vector3d> points;
+};
+
+/// @brief 曲線を許容量に基づき適応的に折れ線化する
+/// @param curve 対象の曲線
+/// @param range 折れ線化するパラメータ範囲 {開始, 終了} (有限値. 無限の範囲は
+///        呼び出し側でクランプすること)
+/// @param params 制御パラメータ
+/// @param map 評価点に適用する写像 (nullptrの場合は恒等写像)
+/// @return 折れ線群. 曲線・写像が評価できない点で分割し、2点以上のもののみを返す.
+///         範囲が空 (range[1] <= range[0]) の場合は空
+/// @throw std::invalid_argument rangeが有限でない場合
+/// @note 角点・直線部の端点は必ず頂点に含まれる. 直線部の区間は、許容量を
+///       超えない限り分割しない (写像が直線を保たない場合は許容量で分割される)
+std::vector<CurvePolyline> DiscretizeCurve(
+        const ICurve& curve, const std::array<double, 2>& range,
+        const CurveDiscretizationParams& params = {},
+        const CurvePointMap& map = nullptr);
+
+}  // namespace igesio::entities
+
+#endif  // IGESIO_ENTITIES_CURVES_ALGORITHMS_CURVE_DISCRETIZATION_H_
@@ -9,6 +9,7 @@
 #define IGESIO_ENTITIES_CURVES_CURVE_ON_A_PARAMETRIC_SURFACE_H_
 
 #include <memory>
+#include <optional>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -177,14 +178,6 @@ class CurveOnAParametricSurface : public EntityBase, public virtual ICurve3D {
     std::optional<CurveDerivatives>
     TryGetDefinedDerivatives(const double, const unsigned int) const override;
 
-    /// @brief 曲線の [t_start, t_end] 間の長さを取得する
-    /// @param start パラメータ範囲の開始値
-    /// @param end パラメータ範囲の終了値
-    /// @return 曲線の t ∈ [start, end] 間の長さ
-    /// @throw std::invalid_argument start >= endの場合、
-    ///        startまたはendがパラメータ範囲外の場合
-    double Length(const double, const double) const override;
-
     /// @brief 定義空間における曲線のバウンディングボックスを取得する
     numerics::BoundingBox GetDefinedBoundingBox() const override;
 
@@ -255,8 +248,30 @@ class CurveOnAParametricSurface : public EntityBase, public virtual ICurve3D {
     ///         - 曲面Sまたは曲線Cが未解決
     ///         - 逆射影または設定に失敗した
     /// @note S・Cの参照が解決済みであること (読み込みの参照解決後) を前提とする。
+    /// @note InvertOmittedBaseCurve()とReconstructOmittedBaseCurve(uv_points)を
+    ///       順に呼び出すことと等価
     std::shared_ptr<ICurve> ReconstructOmittedBaseCurve();
 
+    /// @brief 省略されたベース曲線Bのパラメータ空間の点列を求める (再構築の前半)
+    ///
+    /// モデル空間曲線Cを曲面Sのパラメータ空間へ逆射影する。自身は変更せず、
+    /// エンティティも生成しないため、異なるType 142に対して並列に実行できる
+    /// (読み込み時の一括再構築で使用する)。
+    ///
+    /// @return B = S^{-1}∘C 上の点列 (u, v, 0). ReconstructOmittedBaseCurve()が
+    ///         `nullptr`を返す条件 (Bが省略されていない・S/Cが未解決・逆射影の失敗)
+    ///         では`std::nullopt`
+    /// @note 曲面Sの格子サンプル索引 (ISurface::GetPointLocator) は、同じ曲面Sを
+    ///       参照するType 142の間で共有される
+    std::optional<std::vector<Vector3d>> InvertOmittedBaseCurve() const;
+
+    /// @brief InvertOmittedBaseCurve()の点列からベース曲線Bを生成し設定する
+    ///        (再構築の後半)
+    /// @param uv_points InvertOmittedBaseCurve()が返した点列
+    /// @return 再構築したB (呼び出し側でモデルへ登録する). Bが省略されていない場合、
+    ///         Cが未解決の場合、または生成・設定に失敗した場合は`nullptr`
+    std::shared_ptr<ICurve> ReconstructOmittedBaseCurve(const std::vector<Vector3d>&);
+
 
 
  protected:
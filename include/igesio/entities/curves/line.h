@@ -8,8 +8,10 @@
 #ifndef IGESIO_ENTITIES_CURVES_LINE_H_
 #define IGESIO_ENTITIES_CURVES_LINE_H_
 
+#include <array>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "igesio/entities/interfaces/i_curve.h"
 #include "igesio/entities/entity_base.h"
@@ -125,6 +127,10 @@ class Line : public EntityBase, public virtual ICurve3D {
     /// @brief 定義空間における曲線のバウンディングボックスを取得する
     numerics::BoundingBox GetDefinedBoundingBox() const override;
 
+    /// @brief 直線部のパラメータ区間リストを返す
+    /// @return パラメータ範囲全体 {GetParameterRange()} (半直線・直線では無限区間)
+    std::vector<std::array<double, 2>> GetLinearSegments() const override;
+
 
 
     /**
@@ -145,6 +151,10 @@ class Line : public EntityBase, public virtual ICurve3D {
 
 
  protected:
+    /// @brief 曲線を厳密に表すNURBS曲線を作成する
+    /// @return 線分の場合は1次のNURBS曲線. 半直線・直線の場合はnullptr
+    std::shared_ptr<RationalBSplineCurve> ConvertToNurbs() const override;
+
     /// @brief エンティティ自身が参照する変換行列に従い、座標orベクトルを変換する
     /// @param input 変換前の座標orベクトル v
     /// @param is_point 座標を変換する場合は`true`、ベクトルを変換する場合は`false`
@@ -115,6 +115,10 @@ class LinearPath : public CopiousDataBase,
 
 
  protected:
+    /// @brief 曲線を厳密に表すNURBS曲線を作成する
+    /// @return 弧長をノットとする1次のNURBS曲線 (パラメータも一致する)
+    std::shared_ptr<RationalBSplineCurve> ConvertToNurbs() const override;
+
     /// @brief エンティティ自身が参照する変換行列に従い、座標orベクトルを変換する
     /// @param input 変換前の座標orベクトル v
     /// @param is_point 座標を変換する場合は`true`、ベクトルを変換する場合は`false`
@@ -1,6 +1,6 @@
 /**
  * @file entities/curves/nurbs_algorithms.h
- * @brief 任意曲線の NURBS 近似アルゴリズムの公開 API
+ * @brief 任意曲線・曲面の NURBS 近似アルゴリズムの公開 API
  * @author Yayoi Habami
  * @date 2026-04-11
  * @copyright 2026 Yayoi Habami
@@ -16,6 +16,8 @@
 #include "igesio/numerics/core/matrix.h"
 #include "igesio/entities/interfaces/i_curve.h"
 #include "igesio/entities/curves/rational_b_spline_curve.h"
+#include "igesio/entities/interfaces/i_surface.h"
+#include "igesio/entities/surfaces/rational_b_spline_surface.h"
 
 
 
@@ -42,6 +44,24 @@ struct NurbsEndpointTangents {
     std::optional<Vector3d> end;
 };
 
+/// @brief NURBS曲面近似オプション
+struct NurbsSurfaceApproxOptions {
+    /// @brief u方向のB-スプラインの次数
+    unsigned int u_degree = 3;
+    /// @brief v方向のB-スプラインの次数
+    unsigned int v_degree = 3;
+    /// @brief 許容最大近似誤差ε
+    double tolerance = 1e-4;
+    /// @brief u方向の制御点数の上限（反復打ち切り条件）
+    unsigned int max_u_control_points = 100;
+    /// @brief v方向の制御点数の上限（反復打ち切り条件）
+    unsigned int max_v_control_points = 100;
+    /// @brief 制御点初期数推定の方向変化角閾値 θ_tol [rad]
+    double angle_per_segment = kPi/4.0;
+    /// @brief 1方向あたりのサンプル数の上限（ISurface版のみ使用）
+    unsigned int max_samples_per_direction = 400;
+};
+
 
 
 /// @brief 離散点列からNURBS曲線を近似する（コア実装）
@@ -69,6 +89,39 @@ std::shared_ptr<RationalBSplineCurve> ApproximateWithNurbs(
     std::optional<std::array<double, 2>> param_range = std::nullopt,
     const NurbsApproxOptions& options = {});
 
+/// @brief 点グリッドからNURBS曲面を近似する（コア実装）
+/// @param points  点グリッド Q_{i,j} ([i][j]; iがu方向、jがv方向のインデックス)
+/// @param options 近似オプション
+/// @return 近似された RationalBSplineSurface（パラメータ範囲 [0, 1]×[0, 1]）
+/// @throw std::invalid_argument グリッドが矩形でない場合、
+///        または次数に対して各方向の点数が不足している場合
+/// @throw igesio::ComputationError 全ての行（または列）が1点に縮退している場合
+/// @note テンソル積の最小二乗近似を、u方向（各列）とv方向（各行）の
+///       曲線近似の2パスに分離して行う。各パスの係数行列は全ての列（行）で
+///       共通のため一度だけ分解し、列（行）ごとの求解を並列に実行する。
+///       誤差が許容値を超える間、各方向で誤差がε/2を超える全てのノットスパンに
+///       中点のノットを挿入する（制御点数の上限を超える場合は誤差の大きい
+///       スパンを優先する）。いずれのスパンも挿入対象とならない場合は、誤差の
+///       大きい方向の誤差最大のスパンのみを細分する。4隅の点は補間される
+std::shared_ptr<RationalBSplineSurface> ApproximateSurfaceWithNurbs(
+    const std::vector<std::vector<Vector3d>>& points,
+    const NurbsSurfaceApproxOptions& options = {});
+
+/// @brief 連続曲面からNURBS曲面を近似する（ISurface ラッパー）
+/// @param surface     近似対象の曲面
+/// @param param_range 近似するパラメータ範囲 {u_min, u_max, v_min, v_max}
+///                    （std::nulloptの場合surface.GetParameterRange()を使用）
+/// @param options     近似オプション
+/// @return 近似された RationalBSplineSurface（パラメータ範囲 [0, 1]×[0, 1]）
+/// @throw std::invalid_argument param_rangeが有限でない場合、
+///        またはsurfaceの評価に失敗した場合
+/// @note 2階偏導関数の粗推定から各方向のサンプル数を決め、
+///       等間隔グリッドをサンプリングしてコア実装に渡す
+std::shared_ptr<RationalBSplineSurface> ApproximateSurfaceWithNurbs(
+    const ISurface& surface,
+    std::optional<std::array<double, 4>> param_range = std::nullopt,
+    const NurbsSurfaceApproxOptions& options = {});
+
 }  // namespace igesio::entities
 
 #endif  // IGESIO_ENTITIES_CURVES_NURBS_ALGORITHMS_H_
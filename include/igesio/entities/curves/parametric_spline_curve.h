@@ -229,6 +229,11 @@ class ParametricSplineCurve : public EntityBase, public virtual ICurve3D {
 
 
  protected:
+    /// @brief 曲線を厳密に表すNURBS曲線を作成する
+    /// @return 各セグメントをBézierに変換したNURBS曲線 (パラメータも一致する).
+    ///         ブレークポイントで不連続な場合はnullptr
+    std::shared_ptr<RationalBSplineCurve> ConvertToNurbs() const override;
+
     /// @brief エンティティ自身が参照する変換行列に従い、座標orベクトルを変換する
     /// @param input 変換前の座標orベクトル v
     /// @param is_point 座標を変換する場合は`true`、ベクトルを変換する場合は`false`
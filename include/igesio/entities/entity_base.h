@@ -9,6 +9,7 @@
 #define IGESIO_ENTITIES_ENTITY_BASE_H_
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -557,6 +558,49 @@ bool CreatesTransformationCycle(
         const ObjectID& self_id,
         const ITransformation& transformation);
 
+/// @brief 同期キーへ (ObjectID, GeometryRevision) を順序通りに結合する
+/// @param seed 現在のキー値
+/// @param entity 結合するエンティティ
+/// @return 結合後のキー値
+/// @note boost::hash_combine方式. リビジョンの総和では参照先交換時に増減が
+///       相殺しうるため、同一性(ID)と値(rev)をハッシュで畳み込む
+inline uint64_t CombineGeometryKey(uint64_t seed,
+                                   const IEntityIdentifier& entity) {
+    constexpr uint64_t kGolden = 0x9e3779b97f4a7c15ULL;
+    seed ^= std::hash<ObjectID>{}(entity.GetID())
+            + kGolden + (seed << 6) + (seed >> 2);
+    seed ^= entity.GeometryRevision() + kGolden + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+/// @brief エンティティ自身・DE変換チェーン・物理従属子を再帰的にキーへ結合する
+/// @param seed 現在のキー値
+/// @param entity 起点エンティティ
+/// @return 結合後のキー値
+/// @note テッセレーション・NURBS変換等が読む参照先 (DE変換行列・複合曲線の子・トリム面の境界・
+///       ルールド面の子曲線等) の形状変更を、派生データ (描画・変換結果のキャッシュ) の
+///       再構築要否として検知するための走査. DE変換チェーンの循環はSetReference側で防止済み.
+///       物理従属はDAGであり循環しない前提
+inline uint64_t CombineGeometryKeyRecursive(
+        uint64_t seed, const IEntityIdentifier& entity) {
+    seed = CombineGeometryKey(seed, entity);
+    const auto* base = dynamic_cast<const EntityBase*>(&entity);
+    if (base == nullptr) return seed;
+
+    // DE変換チェーン (共有TransformationMatrixの編集を参照元の再同期として検知)
+    for (auto t = base->GetTransformationMatrix().GetPointer();
+         t != nullptr; t = t->GetRefTransformation()) {
+        seed = CombineGeometryKey(seed, *t);
+    }
+    // 物理従属子 (未解決参照はスキップ. 解決時は集合の変化としてキーに現れる)
+    for (const auto& cid : base->GetChildIDs()) {
+        if (const auto child = base->GetChildEntity(cid)) {
+            seed = CombineGeometryKeyRecursive(seed, *child);
+        }
+    }
+    return seed;
+}
+
 }  // namespace igesio::entities
 
 #endif  // IGESIO_ENTITIES_ENTITY_BASE_H_
@@ -8,8 +8,14 @@
 #ifndef IGESIO_ENTITIES_INTERFACES_I_CURVE_H_
 #define IGESIO_ENTITIES_INTERFACES_I_CURVE_H_
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <vector>
 
+#include "igesio/common/lazy_cache.h"
 #include "igesio/numerics/core/matrix.h"
 #include "igesio/entities/interfaces/i_entity_identifier.h"
 #include "igesio/entities/interfaces/i_geometry.h"
@@ -18,6 +24,8 @@
 
 namespace igesio::entities {
 
+class RationalBSplineCurve;
+
 /// @brief 曲線の導関数
 struct CurveDerivatives {
     /// @brief n階までの導関数 C(t), C'(t), ..., C^(n)(t)
@@ -64,6 +72,60 @@ struct CurveDerivatives {
 ///         - `GetDefinedBoundingBox`: IGeometry由来
 class ICurve : public virtual IEntityIdentifier,
                public virtual IGeometry {
+ private:
+    /// @brief 弧長テーブルの初期区間数
+    static constexpr unsigned int kArcLengthInitialSegments = 16;
+    /// @brief 弧長テーブルの各区間における速さ |C'(t)| の近似次数
+    static constexpr size_t kArcLengthFitDegree = 10;
+    /// @brief 弧長テーブルの各区間における近似の許容誤差 (区間長に対する相対値)
+    static constexpr double kArcLengthRelTolerance = 1e-9;
+
+    /// @brief 弧長テーブルの1区間
+    /// @note 区間を[-1, 1]に正規化した変数ξについて、速さ |C'(t)| (ξあたり) を
+    ///       ルジャンドル級数で近似し、その積分として区間内の弧長 s(t) を表す
+    struct ArcLengthSegment {
+        /// @brief 区間のパラメータ範囲 [t0, t1]
+        double t0, t1;
+        /// @brief 区間両端における曲線始点からの弧長 s(t0), s(t1)
+        double s0, s1;
+        /// @brief ds/dξ のルジャンドル級数の係数
+        std::array<double, kArcLengthFitDegree + 1> coefficients;
+    };
+
+    /// @brief 弧長パラメータ化キャッシュ
+    struct ArcLengthTable {
+        /// @brief パラメータ順に並んだ区間リスト
+        std::vector<ArcLengthSegment> segments;
+    };
+
+    /// @brief 弧長パラメータ化キャッシュ.
+    ///        遅延構築・形状キー (CombineGeometryKeyRecursive) 変更時に再構築
+    mutable LazyCache<ArcLengthTable, uint64_t> arc_length_table_;
+
+    /// @brief 弧長テーブルを取得する (未構築または形状変更後の場合は構築する)
+    /// @return 弧長テーブル
+    /// @throw std::out_of_range 曲線が有限でない場合
+    /// @note 同一インスタンスに対して同時に呼び出してよい (構築は一度だけ行われる)
+    std::shared_ptr<const ArcLengthTable> GetArcLengthTable() const;
+
+    /// @brief 弧長テーブルを構築する (GetArcLengthTableの構築関数)
+    ArcLengthTable ComputeArcLengthTable() const;
+
+    /// @brief NURBS変換結果 (変換できない曲線の場合はnullptr) のキャッシュ.
+    ///        遅延構築・形状キー (CombineGeometryKeyRecursive) 変更時に再構築
+    mutable LazyCache<std::shared_ptr<const RationalBSplineCurve>, uint64_t>
+    nurbs_cache_;
+
+ protected:
+    /// @brief 曲線を厳密に表すNURBS曲線を作成する
+    /// @return 定義空間における曲線と同一形状のNURBS曲線.
+    ///         厳密に表せない曲線の場合はnullptr (デフォルト)
+    /// @note パラメータ範囲は元の曲線と一致させるが、範囲内のパラメータ化は
+    ///       一致しなくてよい (円弧の有理2次表現など). 変換行列は`ToNurbs`が設定する
+    virtual std::shared_ptr<RationalBSplineCurve> ConvertToNurbs() const {
+        return nullptr;
+    }
+
  public:
     /// @brief デストラクタ
     virtual ~ICurve() = default;
@@ -215,6 +277,46 @@ class ICurve : public virtual IEntityIdentifier,
     ///        startまたはendがパラメータ範囲外の場合
     virtual double Length(const double, const double) const;
 
+    /// @brief 曲線の始点からの弧長がsとなるパラメータ値 t を取得する
+    /// @param s 始点からの弧長 (0 ≤ s ≤ Length())
+    /// @return s(t) = s を満たすパラメータ値 t
+    /// @throw std::out_of_range 曲線が有限でない場合、sが範囲外の場合
+    /// @note 初回呼び出し時に弧長テーブル (s(t)の区分多項式近似) を構築し、
+    ///       以降は形状キー (CombineGeometryKeyRecursive) が変わるまで再利用する.
+    ///       構築後の1回の問い合わせは区間数nに対してO(log n)で、曲線の評価を行わない
+    /// @note 形状キーは物理従属子を含むため、CompositeCurveの構成曲線など
+    ///       子エンティティの編集でもテーブルは再構築される
+    /// @note パラメータ範囲が退化している (t_start == t_end) 場合は長さ0の曲線として扱い、
+    ///       s = 0 に対して t_start を返す
+    /// @note `Length(start, end)`をオーバーライドするサブクラスは、
+    ///       同じ基準の長さとなるよう本関数もオーバーライドすること
+    virtual double ParameterAtLength(const double) const;
+
+    /// @brief 曲線を弧長でn-1等分するパラメータ値を取得する
+    /// @param n 点の数 (始点と終点を含む; n ≥ 2)
+    /// @return 始点から終点まで、弧長が等間隔となるn個のパラメータ値
+    /// @throw std::invalid_argument n < 2の場合
+    /// @throw std::out_of_range 曲線が有限でない場合
+    /// @note 閉曲線の場合、先頭と末尾の点は一致する
+    std::vector<double> ParametersAtEqualArcLength(const unsigned int) const;
+
+    /// @brief 曲線を弧長でn-1等分する点を取得する
+    /// @param n 点の数 (始点と終点を含む; n ≥ 2)
+    /// @return 始点から終点まで、弧長が等間隔となるn個の点 (モデル空間)
+    /// @throw std::invalid_argument n < 2の場合
+    /// @throw std::out_of_range 曲線が有限でない場合
+    std::vector<Vector3d> PointsAtEqualArcLength(const unsigned int) const;
+
+    /// @brief 曲線を厳密に表すNURBS曲線を取得する
+    /// @return 曲線と同一形状のNURBS曲線. 曲線自身と同じ変換行列を参照する.
+    ///         NURBSで厳密に表せない曲線 (半直線・複合曲線等) の場合はnullptr
+    /// @note 結果は形状キー (自身・変換行列・物理従属子のGeometryRevision) ごとに
+    ///       キャッシュされ、形状が変更されるまで同じインスタンスを返す
+    /// @note パラメータ範囲は元の曲線と一致するが、範囲内の点 C(t) は一致するとは
+    ///       限らない (円弧・円錐曲線は有理2次表現のパラメータとなる)
+    /// @note 同一インスタンスに対して同時に呼び出してよい (変換は一度だけ行われる)
+    std::shared_ptr<const RationalBSplineCurve> ToNurbs() const;
+
     /// @brief 参照法線 n̂ に対する符号付き曲率 κ_s(t) を計算する
     /// @param t パラメータ値
     /// @param reference_normal 符号の基準となる法線ベクトル（正規化不要）
@@ -285,6 +387,15 @@ class ICurve : public virtual IEntityIdentifier,
     ///         指定されたパラメータ値がパラメータ範囲外の場合は`std::nullopt`
     std::optional<Vector3d> TryGetPointAt(const double) const;
 
+    /// @brief 複数のパラメータ値における曲線上の点 C(t) をまとめて取得する
+    /// @param ts パラメータ値の列
+    /// @return 各パラメータ値に対応する点 (`TryGetPointAt(ts[i])`と同じ値).
+    ///         パラメータ範囲外の点は`std::nullopt`
+    /// @note エンティティの変換行列の取得を1回にまとめるため、多数の点を評価する
+    ///       場合 (折れ線化等) は`TryGetPointAt`を繰り返すよりも効率がよい
+    std::vector<std::optional<Vector3d>>
+    TryGetPointsAt(const std::vector<double>&) const;
+
     /// @brief 曲線上の接線ベクトル T(t) を取得する
     /// @param t パラメータ値
     /// @return 曲線上の正規化された接線ベクトル (tx, ty, tz).
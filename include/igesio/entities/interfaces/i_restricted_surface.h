@@ -14,6 +14,7 @@
 #include <optional>
 #include <vector>
 
+#include "igesio/common/lazy_cache.h"
 #include "igesio/numerics/geometric/polygon.h"
 #include "igesio/entities/interfaces/i_curve.h"
 #include "igesio/entities/interfaces/i_surface.h"
@@ -42,8 +43,15 @@ class IRestrictedSurface : public virtual ISurface {
         std::optional<numerics::CurveContainmentPolygons> outer;
         /// @brief 内側境界(穴)の包含多角形リスト
         std::vector<numerics::CurveContainmentPolygons> inner;
+        /// @brief outerの内外判定を高速化する格子 (outerが有効な場合のみ有効)
+        std::optional<numerics::PolygonContainmentGrid> outer_grid;
+        /// @brief innerの各要素の内外判定を高速化する格子 (innerと同じ順序)
+        std::vector<numerics::PolygonContainmentGrid> inner_grids;
     };
 
+    /// @brief 境界曲線から包含多角形キャッシュを作成する (GetDomainCacheの構築関数)
+    DomainCache ComputeDomainCache() const;
+
  protected:
     /// @brief ComputeContainmentPolygonsに渡す初期分割数
     static constexpr int kContainmentPolygonDivisions = 32;
@@ -52,18 +60,24 @@ class IRestrictedSurface : public virtual ISurface {
     /// @note 具象クラスが構築・編集時に設定する (144ではN1フラグに対応)
     bool outer_is_boundary_of_d_ = true;
     /// @brief 内外判定キャッシュ。遅延構築・変更時無効化。
-    mutable std::optional<DomainCache> domain_cache_;
+    /// @note 複数スレッドから同時に参照・構築してよい (LazyCache)
+    mutable LazyCache<DomainCache> domain_cache_;
 
-    /// @brief 包含多角形キャッシュを構築する
-    /// @note domain_cache_が有効な場合は何もしない。同一インスタンスに対して同時に
-    ///       呼び出してはならない (内部のdomain_cache_を非同期に書き込むため)。
+    /// @brief 包含多角形キャッシュを取得する (未構築の場合は構築する)
+    /// @return 構築済みのキャッシュ
+    /// @note 同一インスタンスに対して同時に呼び出してよい (構築は一度だけ行われる)。
     ///       境界曲線が未解決/退化/非閉でテッセレーションが例外を投げても、当該境界を
     ///       スキップして処理全体を止めない (グレースフル劣化)。
-    void BuildDomainCache() const;
+    std::shared_ptr<const DomainCache> GetDomainCache() const;
+
+    /// @brief 包含多角形キャッシュを構築する
+    /// @note domain_cache_が有効な場合は何もしない (GetDomainCacheを参照)
+    void BuildDomainCache() const { GetDomainCache(); }
 
     /// @brief 領域判定キャッシュを無効化する
-    /// @note 具象クラスの境界編集 (Set/Add/Remove系) から呼ぶこと
-    void InvalidateDomainCache() const noexcept { domain_cache_ = std::nullopt; }
+    /// @note 具象クラスの境界編集 (Set/Add/Remove系) から呼ぶこと。境界編集は
+    ///       領域判定と同時に行ってはならない
+    void InvalidateDomainCache() const noexcept { domain_cache_.Reset(); }
 
  public:
     /// @brief デストラクタ
@@ -128,6 +142,8 @@ class IRestrictedSurface : public virtual ISurface {
 
     /// @brief (u, v) がトリム後の有効なドメイン内かどうかを判定する
     /// @note キャッシュが未構築の場合はBuildDomainCache()を呼び出す
+    /// @note 各境界の包含多角形に対する格子 (PolygonContainmentGrid) を用いるため、
+    ///       境界から離れた点はO(1)、境界付近の点は近傍の辺の数に比例する時間で判定する
     bool IsInDomain(const double u, const double v) const override;
 
 
@@ -142,10 +158,12 @@ class IRestrictedSurface : public virtual ISurface {
     /// @brief トリム領域の外側包含多角形を取得する (テッセレーション用)
     /// @return 外側境界の包含多角形。outer_is_boundary_of_d_=trueまたは構築失敗時は
     ///         std::nullopt。キャッシュ未構築の場合は構築する。
+    ///         参照は境界を編集する (キャッシュを無効化する) まで有効
     const std::optional<numerics::CurveContainmentPolygons>&
     GetOuterDomainPolygon() const;
     /// @brief トリム領域の内側包含多角形(穴)を取得する (テッセレーション用)
     /// @return 内側境界(穴)の包含多角形リスト。キャッシュ未構築の場合は構築する。
+    ///         参照は境界を編集する (キャッシュを無効化する) まで有効
     const std::vector<numerics::CurveContainmentPolygons>&
     GetInnerDomainPolygons() const;
 };
@@ -8,9 +8,14 @@
 #ifndef IGESIO_ENTITIES_INTERFACES_I_SURFACE_H_
 #define IGESIO_ENTITIES_INTERFACES_I_SURFACE_H_
 
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include "igesio/common/lazy_cache.h"
 #include "igesio/numerics/core/matrix.h"
 #include "igesio/numerics/analysis/integration.h"
 #include "igesio/entities/interfaces/i_entity_identifier.h"
@@ -21,6 +26,9 @@
 
 namespace igesio::entities {
 
+class RationalBSplineSurface;
+class SurfacePointLocator;
+
 /// @brief 無限パラメータ範囲を持つ曲面を離散化/探索する際のクランプ値
 /// @note 無限平面・半直線状の曲面などの無限端をこの値で打ち切る。境界エッジ生成・
 ///       交差判定でサンプリング範囲を一致させるためのentities層の共有定数
@@ -87,6 +95,26 @@ class SurfaceDerivatives {
 ///         - `GetDefinedBoundingBox`: IGeometry由来
 class ISurface : public virtual IEntityIdentifier,
                  public virtual IGeometry {
+ private:
+    /// @brief NURBS変換結果 (変換できない曲面の場合はnullptr) のキャッシュ.
+    ///        遅延構築・形状キー (CombineGeometryKeyRecursive) 変更時に再構築
+    mutable LazyCache<std::shared_ptr<const RationalBSplineSurface>, uint64_t>
+    nurbs_cache_;
+
+    /// @brief 最近点探索の索引のキャッシュ. 遅延構築・形状キーまたは
+    ///        格子サンプル数 (キーの第2・第3要素) の変更時に再構築
+    mutable LazyCache<std::shared_ptr<const SurfacePointLocator>,
+                      std::tuple<uint64_t, int, int>> point_locator_cache_;
+
+ protected:
+    /// @brief 曲面を厳密に表すNURBS曲面を作成する
+    /// @return 定義空間における曲面と同一形状のNURBS曲面.
+    ///         厳密に表せない曲面の場合はnullptr (デフォルト)
+    /// @note 範囲内のパラメータ化は一致しなくてよい. 変換行列は`ToNurbs`が設定する
+    virtual std::shared_ptr<RationalBSplineSurface> ConvertToNurbs() const {
+        return nullptr;
+    }
+
  public:
     /// @brief デストラクタ
     virtual ~ISurface() = default;
@@ -146,6 +174,28 @@ class ISurface : public virtual IEntityIdentifier,
     ///       角を立てる (ハードエッジ化する) ために使用する
     virtual std::vector<double> GetUCreaseParameters() const;
 
+    /// @brief 曲面を厳密に表すNURBS曲面を取得する
+    /// @return 曲面と同一形状のNURBS曲面. 曲面自身と同じ変換行列を参照する.
+    ///         NURBSで厳密に表せない曲面 (無限平面・トリム面等) の場合はnullptr
+    /// @note 結果は形状キー (自身・変換行列・物理従属子のGeometryRevision) ごとに
+    ///       キャッシュされ、形状が変更されるまで同じインスタンスを返す
+    /// @note パラメータ範囲・パラメータ化は元の曲面と一致するとは限らない
+    ///       (例: 回転曲面のv方向は有理2次表現のパラメータとなる)
+    /// @note 同一インスタンスに対して同時に呼び出してよい (変換は一度だけ行われる)
+    std::shared_ptr<const RationalBSplineSurface> ToNurbs() const;
+
+    /// @brief 格子サンプルによる最近点探索の索引を取得する
+    /// @param u_samples u方向の格子サンプル数
+    /// @param v_samples v方向の格子サンプル数
+    /// @return モデル空間の曲面上の格子サンプル点の索引
+    ///         (surfaces/algorithms/curve_surface_inversion.h). 点の逆射影の
+    ///         初期値探索に用いる
+    /// @note 結果は形状キーと格子サンプル数ごとにキャッシュされ、同じ曲面上の
+    ///       点・曲線の逆射影で共有される
+    /// @note 同一インスタンスに対して同時に呼び出してよい (構築は一度だけ行われる)
+    std::shared_ptr<const SurfacePointLocator>
+    GetPointLocator(const int u_samples, const int v_samples) const;
+
 
 
     /**
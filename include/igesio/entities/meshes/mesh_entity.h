@@ -14,8 +14,10 @@
 #include <optional>
 #include <utility>
 
+#include "igesio/common/lazy_cache.h"
 #include "igesio/numerics/core/matrix.h"
 #include "igesio/numerics/geometric/bounding_box.h"
+#include "igesio/numerics/geometric/bvh.h"
 #include "igesio/numerics/meshes/triangle_mesh.h"
 #include "igesio/entities/non_iges_entity_base.h"
 #include "igesio/entities/interfaces/i_geometry.h"
@@ -52,6 +54,14 @@ class MeshEntity : public NonIgesEntityBase, public IGeometry {
     ///       (描画は次回Drawで自動的に再同期される)
     void SetMesh(numerics::TriangleMeshd mesh);
 
+    /// @brief メッシュの三角形に対するBVHを取得する
+    /// @return 三角形番号をプリミティブ番号とするBVH (numerics::BuildMeshBvh)
+    /// @note 初回呼び出し時に構築し、SetMeshでメッシュを差し替えるまで
+    ///       同じBVHを返す. レイ交差 (ピッキング等) の加速に使用する
+    /// @note 同一インスタンスに対して同時に呼び出してよい (構築は一度だけ行われる).
+    ///       参照はSetMeshを呼び出すまで有効
+    const numerics::Bvh& GetBvh() const;
+
     /// @brief 定義空間におけるバウンディングボックスを取得する
     /// @return 全頂点を包含する軸平行バウンディングボックス.
     ///         頂点が無い場合は空のBoundingBox
@@ -68,6 +78,8 @@ class MeshEntity : public NonIgesEntityBase, public IGeometry {
  private:
     /// @brief 保持する三角形メッシュ
     numerics::TriangleMeshd mesh_;
+    /// @brief mesh_に対するBVHのキャッシュ. 遅延構築・SetMesh時に破棄
+    mutable LazyCache<numerics::Bvh> bvh_;
 };
 
 }  // namespace igesio::entities
@@ -10,9 +10,15 @@
 #define IGESIO_ENTITIES_SURFACES_ALGORITHMS_H_
 
 // surfaces/algorithms下の関数を取得
+#include "igesio/entities/surfaces/algorithms/curve_surface_intersection.h"
 #include "igesio/entities/surfaces/algorithms/curve_surface_inversion.h"
+#include "igesio/entities/surfaces/algorithms/minimum_distance.h"
 #include "igesio/entities/surfaces/algorithms/restricted_surface_mesh.h"
 #include "igesio/entities/surfaces/algorithms/surface_boundary_edges.h"
 #include "igesio/entities/surfaces/algorithms/surface_line_intersection.h"
+#include "igesio/entities/surfaces/algorithms/surface_tessellation_tolerance.h"
+#include "igesio/entities/surfaces/algorithms/tessellation_cache.h"
+#include "igesio/entities/surfaces/algorithms/tessellation_sidecar.h"
+#include "igesio/entities/surfaces/algorithms/watertight_mesh.h"
 
 #endif  // IGESIO_ENTITIES_SURFACES_ALGORITHMS_H_
@@ -0,0 +1,113 @@
+/**
+ * @file entities/surfaces/algorithms/curve_surface_intersection.h
+ * @brief 曲線と曲面の交点計算
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * ICurve・ISurfaceの具象クラスに依存せず、以下のAPIのみを使用する:
+ *   - ICurve::TryGetDerivatives(t, 1) / GetLinearSegments()
+ *   - ISurface::TryGetDerivatives(u, v, 1) / TryGetPointAt(u, v) /
+ *     GetParameterRange()
+ *   - IRestrictedSurface::GetBaseSurface() (制限面の広域判定)
+ *
+ * ### アルゴリズム概要
+ * 1. 広域判定: 曲線を許容距離chord_toleranceで折れ線近似する (直線部は1辺).
+ *    曲面はuvパラメータ範囲をu_samples×v_samplesのセルに分割し、各セルの
+ *    四隅と中心の点から、中心の双線形補間からのずれ (膨らみ) だけ拡大した
+ *    ボックスを求めてBVHを構築する. 曲線の各辺について、ボックスが重なる
+ *    セルを列挙する.
+ * 2. 精密化: 辺上のセル中心に最も近い点のパラメータtとセル中心の (u, v) を
+ *    初期値として、|C(t) - S(u, v)|^2 を減衰付きガウス・ニュートン法で
+ *    最小化する. 最終的な距離gapがtolerance以下の点を交点とする.
+ *
+ * 制限面 (TrimmedSurface等) はドメイン外で評価できないため、広域判定のセルは
+ * 基底曲面上に構築し、精密化はドメイン内でのみ行う (ドメイン外の交点は返さない).
+ */
+#ifndef IGESIO_ENTITIES_SURFACES_ALGORITHMS_CURVE_SURFACE_INTERSECTION_H_
+#define IGESIO_ENTITIES_SURFACES_ALGORITHMS_CURVE_SURFACE_INTERSECTION_H_
+
+#include <memory>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/interfaces/i_curve.h"
+#include "igesio/entities/interfaces/i_surface.h"
+
+
+
+namespace igesio::entities {
+
+/// @brief 曲線と曲面の交点情報
+struct CurveSurfaceIntersection {
+    /// @brief 交点の座標 (C(t)とS(u, v)の中点)
+    Vector3d position;
+    /// @brief 曲線パラメータt
+    double t;
+    /// @brief 曲面パラメータu
+    double u;
+    /// @brief 曲面パラメータv
+    double v;
+    /// @brief C(t)とS(u, v)の距離
+    double gap;
+};
+
+/// @brief IntersectCurveWithSurfaceの探索制御パラメータ
+struct CurveSurfaceIntersectionParams {
+    /// @brief [モデル単位] 距離がこの値以下の点を交点とみなす
+    double tolerance = 1e-6;
+    /// @brief [モデル単位] 広域判定に用いる曲線の折れ線近似の許容距離
+    /// @note 0以下の場合は、曲線のバウンディングボックスの対角線長の1/1000を用いる
+    double chord_tolerance = 0.0;
+    /// @brief 広域判定のu方向のセル数
+    int u_samples = 16;
+    /// @brief 広域判定のv方向のセル数
+    int v_samples = 16;
+    /// @brief ガウス・ニュートン法の最大反復回数
+    int max_iter = 50;
+    /// @brief 収束判定の許容誤差 (パラメータの更新幅)
+    double convergence_tol = 1e-12;
+    /// @brief 重複解の除去に使用する空間距離の許容誤差
+    double dedup_tol = 1e-6;
+};
+
+/// @brief 曲線と曲面の交点を計算する
+/// @param curve 曲線 (有限なパラメータ範囲を持つこと)
+/// @param surface 曲面
+/// @param params 探索制御パラメータ
+/// @return gap <= params.toleranceの交点のリスト (重複除去済み・t昇順ソート済み)
+/// @throw std::invalid_argument 曲線のパラメータ範囲が無限の場合、
+///        またはu_samples, v_samplesが1未満の場合
+/// @note uvパラメータ範囲が無限の曲面は、IntersectSurfaceWithLineと同様に
+///       制限面のドメインの範囲、または±kInfiniteParamClampにクランプする
+/// @note 曲線が曲面上にある区間では、候補ごとに収束した点が (重複除去のうえ)
+///       返される. 区間全体を1つの結果として表すことはしない
+std::vector<CurveSurfaceIntersection> IntersectCurveWithSurface(
+        const ICurve& curve, const ISurface& surface,
+        const CurveSurfaceIntersectionParams& params = {});
+
+/// @brief 一括判定する曲線と曲面の組
+struct CurveSurfacePair {
+    /// @brief 曲線
+    std::shared_ptr<const ICurve> curve;
+    /// @brief 曲面
+    std::shared_ptr<const ISurface> surface;
+};
+
+/// @brief 複数の曲線と曲面の組について、交点をまとめて計算する
+/// @param pairs 曲線と曲面の組のリスト
+/// @param params 探索制御パラメータ (全ての組で共通)
+/// @return 各組の交点のリスト (pairsと同じ順序. 各要素は
+///         IntersectCurveWithSurfaceと同じ結果)
+/// @throw std::invalid_argument いずれかの曲線・曲面がnullptrの場合、
+///        曲線のパラメータ範囲が無限の場合、またはparamsが不正な場合
+/// @note 複数の組に現れる曲線の折れ線近似・曲面のセルのBVHは一度だけ構築して
+///       共有する. これらの構築と各組の判定は、それぞれ並列に行う (common/parallel.h)
+std::vector<std::vector<CurveSurfaceIntersection>> IntersectCurveSurfacePairs(
+        const std::vector<CurveSurfacePair>& pairs,
+        const CurveSurfaceIntersectionParams& params = {});
+
+}  // namespace igesio::entities
+
+#endif  // IGESIO_ENTITIES_SURFACES_ALGORITHMS_CURVE_SURFACE_INTERSECTION_H_
@@ -14,12 +14,17 @@
  * ### アルゴリズム概要
  * 1. C(r)を折れ線近似して点列 P_0..P_m を得る (`ComputeApproximatePolygon`)。
  * 2. 各P_iをS上へ最近点射影 (ガウス・ニュートン法) して (u_i, v_i) を得る。
- *    直前点の解をウォームスタートに用い、先頭点のみ格子探索で初期値を決める。
+ *    直前点の解をウォームスタートに用い、先頭点とウォームスタートが失敗した点
+ *    のみ格子サンプルの最近傍探索 (`SurfacePointLocator`) で初期値を決める。
+ *    格子サンプルの索引は曲面の形状ごとにキャッシュされ
+ *    (`ISurface::GetPointLocator`)、同じ曲面上の複数の曲線で共有される。
  * 3. seam (閉方向のラップ) やpole (退化) で連続性が切れる箇所を検出し、
  *    `split_at_discontinuities` が真なら複数の連続弧 (collection) に分割する。
  *
- * `InvertPointOntoSurface` (単点射影) と`InvertCurveOntoSurface` (曲線射影) は
- * いずれも`ISurface`のTryGetDerivatives(u,v,1)`のみに依存する。
+ * `InvertPointOntoSurface` (単点射影)・`ProjectPointOntoSurface` (初期値探索付きの
+ * 単点射影)・`InvertCurveOntoSurface` (曲線射影) は、反復にはいずれも
+ * `ISurface`のTryGetDerivatives(u,v,1)`のみを用いる (初期値探索の格子サンプルは
+ * TryGetPointAtで評価する)。
  *
  * @note Type 142は単一の連続弧を仮定するため`split_at_discontinuities=false`
  *       (既定) で1要素を取り出して用いる。Type 141/143 (TYPE=1) では
@@ -35,6 +40,7 @@
 #include <vector>
 
 #include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/geometric/bvh.h"
 #include "igesio/entities/interfaces/i_curve.h"
 #include "igesio/entities/interfaces/i_surface.h"
 
@@ -72,6 +78,48 @@ struct CurveInversionParams {
     bool split_at_discontinuities = false;
 };
 
+/// @brief 曲面上の格子サンプルによる最近点探索の索引
+/// @note 射影の初期値探索に用いる. 曲面のパラメータ範囲 (無限範囲は曲面の
+///       代表寸法でクランプ) の内部をu_samples × v_samples点の格子で評価し、
+///       モデル空間のサンプル点からBVHを構築する. 格子の配置は
+///       `CurveInversionParams::grid_u`/`grid_v`による格子探索と同じであり、
+///       最近傍探索の結果も総当たりの格子探索と一致する.
+///       通常は`ISurface::GetPointLocator`でキャッシュされたものを用いる
+class SurfacePointLocator {
+ public:
+    /// @brief コンストラクタ
+    /// @param surface 対象の曲面 (モデル空間で評価する)
+    /// @param u_samples u方向の格子サンプル数
+    /// @param v_samples v方向の格子サンプル数
+    /// @note 穴領域等で評価できない格子点はサンプルに含めない
+    SurfacePointLocator(const ISurface& surface, int u_samples, int v_samples);
+
+    /// @brief u方向の格子サンプル数を取得する
+    int USamples() const { return u_samples_; }
+    /// @brief v方向の格子サンプル数を取得する
+    int VSamples() const { return v_samples_; }
+    /// @brief 評価できたサンプル点の数を取得する
+    size_t SampleCount() const { return points_.size(); }
+
+    /// @brief 点に最も近いサンプル点のパラメータを求める
+    /// @param point 探索の基準点 (モデル空間)
+    /// @return 最も近いサンプル点の (u, v). 同じ距離の場合は格子の走査順
+    ///         (u優先) で先のもの. サンプル点が無い場合は`std::nullopt`
+    std::optional<std::array<double, 2>> FindNearestSample(const Vector3d&) const;
+
+ private:
+    /// @brief u方向の格子サンプル数
+    int u_samples_;
+    /// @brief v方向の格子サンプル数
+    int v_samples_;
+    /// @brief 各サンプル点のパラメータ (u, v)
+    std::vector<std::array<double, 2>> parameters_;
+    /// @brief 各サンプル点の座標 (モデル空間)
+    std::vector<Vector3d> points_;
+    /// @brief サンプル点のBVH (プリミティブ番号はpoints_の添字)
+    numerics::Bvh bvh_;
+};
+
 /// @brief 点Pを曲面S上へ最近点射影し、パラメータ (u, v) を求める
 ///
 /// 残差 r(u,v) = S(u,v) - P を最小化するガウス・ニュートン反復で解く。
@@ -88,6 +136,21 @@ std::optional<std::array<double, 2>> InvertPointOntoSurface(
         const std::array<double, 2>& init_uv,
         const CurveInversionParams& params = {});
 
+/// @brief 点Pを曲面S上へ最近点射影し、パラメータ (u, v) を求める (初期値の探索付き)
+///
+/// 初期値を格子サンプルの最近傍探索 (`ISurface::GetPointLocator`) で決め、
+/// 上記と同じガウス・ニュートン反復で解く。
+///
+/// @param surface    射影先の曲面
+/// @param model_point 射影する点P (モデル空間)
+/// @param params     探索制御パラメータ (grid_u, grid_vを初期値探索に使用する)
+/// @return 収束した (u, v)。穴領域・退化・非収束で失敗した場合は `std::nullopt`
+/// @note 曲面の格子サンプル索引はキャッシュされ、同一の曲面に対する同時の
+///       呼び出しの間でも共有される (構築は一度だけ行われる)
+std::optional<std::array<double, 2>> ProjectPointOntoSurface(
+        const ISurface& surface, const Vector3d& model_point,
+        const CurveInversionParams& params = {});
+
 /// @brief モデル空間曲線Cを曲面Sのパラメータ空間へ逆射影する
 ///
 /// Cを折れ線近似し、各点を`InvertPointOntoSurface`で (u,v) 化して連続弧を構成する。
@@ -101,6 +164,8 @@ std::optional<std::array<double, 2>> InvertPointOntoSurface(
 ///         `split_at_discontinuities=false`のときは最大1要素 (Type 142用)
 /// @note CとSはいずれもモデル空間で評価する (前方変換と対称)。両者が同一の
 ///       モデル空間に存在すること (well-formedなIGES) を前提とする。
+/// @note 曲面の格子サンプル索引はキャッシュされ、同一の曲面に対する同時の
+///       呼び出しの間でも共有される (構築は一度だけ行われる)
 std::vector<ParamSpaceArc> InvertCurveOntoSurface(
         const ISurface& surface, const ICurve& model_curve,
         const CurveInversionParams& params = {});
@@ -0,0 +1,143 @@
+/**
+ * @file entities/surfaces/algorithms/minimum_distance.h
+ * @brief 曲線・曲面間の最短距離 (クリアランス) の計算
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * 曲線×曲線・曲線×曲面・曲面×曲面の最短距離と、それを与える両者の点を求める.
+ * ICurve・ISurfaceの具象クラスに依存せず、以下のAPIのみを使用する:
+ *   - ICurve::TryGetDerivatives(t, 2) / GetLinearSegments()
+ *   - ISurface::TryGetDerivatives(u, v, 2) / TryGetPointAt(u, v) /
+ *     GetParameterRange()
+ *   - IRestrictedSurface::GetBaseSurface() / GetOuterUVBoundary() /
+ *     GetInnerUVBoundaryAt(i)
+ *
+ * ### アルゴリズム概要
+ * 1. 部分パッチへの分割: 曲線は許容距離chord_toleranceで折れ線近似した各辺、
+ *    曲面はuvパラメータ範囲のu_samples×v_samplesの各セルを部分パッチとし、
+ *    部分パッチを含むボックスのBVHを構築する (曲線×曲面の交点計算と共通).
+ * 2. 分枝限定法: 2つのBVHのノードの組を、ボックス間の距離 (下界) の小さい順に
+ *    訪問する (numerics::FindNearestPairInBvhs). 下界が既知の最短距離
+ *    (上界) から改善しない組は枝刈りする.
+ * 3. 精密化: 訪問した部分パッチの組について、代表点から |A(x) - B(y)|^2 を
+ *    パラメータ範囲内でニュートン法 (直線探索付き) で最小化し、
+ *    得られた距離で上界を更新する.
+ *
+ * 制限面 (TrimmedSurface等) は、ドメイン内で評価できる点のみを対象とする.
+ * 最短距離を与える点がトリム境界上にある場合に備え、基底曲面上の境界曲線
+ * S(B(t)) も曲線として扱い、同じ手順で最短距離を求めて最小のものを採用する.
+ * 制限面の変換ビュー (SurfaceView) も、元の制限面と同様に扱う.
+ */
+#ifndef IGESIO_ENTITIES_SURFACES_ALGORITHMS_MINIMUM_DISTANCE_H_
+#define IGESIO_ENTITIES_SURFACES_ALGORITHMS_MINIMUM_DISTANCE_H_
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/interfaces/i_curve.h"
+#include "igesio/entities/interfaces/i_geometry.h"
+#include "igesio/entities/interfaces/i_surface.h"
+
+
+
+namespace igesio::entities {
+
+/// @brief 最短距離の計算結果
+struct MinimumDistanceResult {
+    /// @brief 最短距離
+    double distance;
+    /// @brief 一方 (第1引数) の最近点
+    Vector3d point_a;
+    /// @brief 他方 (第2引数) の最近点
+    Vector3d point_b;
+    /// @brief point_aのパラメータ (曲線: {t, 0}, 曲面: {u, v})
+    std::array<double, 2> params_a;
+    /// @brief point_bのパラメータ (曲線: {t, 0}, 曲面: {u, v})
+    std::array<double, 2> params_b;
+};
+
+/// @brief MinimumDistanceの探索制御パラメータ
+struct MinimumDistanceParams {
+    /// @brief [モデル単位] 分枝限定法の打ち切りの許容量
+    /// @note 下界にこの値を加えても既知の最短距離を下回らない部分パッチの組は
+    ///       訪問しない. 大きくすると速くなるが、結果は真の最短距離より
+    ///       最大でこの値だけ大きくなりうる
+    double tolerance = 1e-6;
+    /// @brief [モデル単位] 曲線の折れ線近似の許容距離
+    /// @note 0以下の場合は、曲線のバウンディングボックスの対角線長の1/1000を用いる
+    double chord_tolerance = 0.0;
+    /// @brief 曲面のu方向のセル数
+    int u_samples = 16;
+    /// @brief 曲面のv方向のセル数
+    int v_samples = 16;
+    /// @brief 精密化の反復法の最大反復回数
+    int max_iter = 50;
+    /// @brief 収束判定の許容誤差 (パラメータの更新幅)
+    double convergence_tol = 1e-12;
+};
+
+/// @brief 2つの曲線の最短距離を計算する
+/// @param curve_a 一方の曲線 (有限なパラメータ範囲を持つこと)
+/// @param curve_b 他方の曲線 (有限なパラメータ範囲を持つこと)
+/// @param params 探索制御パラメータ
+/// @return 最短距離と最近点. 評価できる点がない場合は`std::nullopt`
+/// @throw std::invalid_argument 曲線のパラメータ範囲が無限の場合、
+///        またはparamsが不正な場合
+std::optional<MinimumDistanceResult> MinimumDistance(
+        const ICurve& curve_a, const ICurve& curve_b,
+        const MinimumDistanceParams& params = {});
+
+/// @brief 曲線と曲面の最短距離を計算する
+/// @param curve 曲線 (有限なパラメータ範囲を持つこと)
+/// @param surface 曲面
+/// @param params 探索制御パラメータ
+/// @return 最短距離と最近点 (point_aが曲線側). 評価できる点がない場合は
+///         `std::nullopt`
+/// @throw std::invalid_argument 曲線のパラメータ範囲が無限の場合、
+///        またはparamsが不正な場合
+/// @note uvパラメータ範囲が無限の曲面は、IntersectCurveWithSurfaceと同様に
+///       制限面のドメインの範囲、または±kInfiniteParamClampにクランプする
+std::optional<MinimumDistanceResult> MinimumDistance(
+        const ICurve& curve, const ISurface& surface,
+        const MinimumDistanceParams& params = {});
+
+/// @brief 2つの曲面の最短距離を計算する
+/// @param surface_a 一方の曲面
+/// @param surface_b 他方の曲面
+/// @param params 探索制御パラメータ
+/// @return 最短距離と最近点. 評価できる点がない場合は`std::nullopt`
+/// @throw std::invalid_argument paramsが不正な場合
+/// @note 無限範囲の扱いは曲線と曲面の場合と同じ
+std::optional<MinimumDistanceResult> MinimumDistance(
+        const ISurface& surface_a, const ISurface& surface_b,
+        const MinimumDistanceParams& params = {});
+
+/// @brief 一括計算する幾何要素の組
+/// @note 各要素はICurveまたはISurfaceであること
+struct GeometryPair {
+    /// @brief 一方の要素
+    std::shared_ptr<const IGeometry> first;
+    /// @brief 他方の要素
+    std::shared_ptr<const IGeometry> second;
+};
+
+/// @brief 複数の組について、最短距離をまとめて計算する
+/// @param pairs 曲線・曲面の組のリスト
+/// @param params 探索制御パラメータ (全ての組で共通)
+/// @return 各組の結果 (pairsと同じ順序. 各要素はMinimumDistanceと同じ結果)
+/// @throw std::invalid_argument いずれかの要素がnullptr・曲線でも曲面でもない
+///        場合、曲線のパラメータ範囲が無限の場合、またはparamsが不正な場合
+/// @note 複数の組に現れる要素の部分パッチのBVHは一度だけ構築して共有する.
+///       これらの構築と各組の計算は、それぞれ並列に行う (common/parallel.h)
+std::vector<std::optional<MinimumDistanceResult>> MinimumDistancePairs(
+        const std::vector<GeometryPair>& pairs,
+        const MinimumDistanceParams& params = {});
+
+}  // namespace igesio::entities
+
+#endif  // IGESIO_ENTITIES_SURFACES_ALGORITHMS_MINIMUM_DISTANCE_H_
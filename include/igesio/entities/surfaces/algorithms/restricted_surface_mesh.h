@@ -25,12 +25,23 @@
  * キー化して重複排除するため、隣接する葉は境界カットを含め必ず同一頂点を共有する
  * (クラックフリーの保証)。境界が通らない領域は base_div の粗さで分割されるため、
  * 細い形状・欠け角の脱落が起きる境界近傍にのみ細分コストを払う。
+ *
+ * 許容量 (RestrictedSurfaceMeshParams::tolerance) を指定した場合は、各ルートの
+ * 深さを基底曲面の曲率の見積もり (EstimateSubdivisionDepth) からも決める。
+ * 平坦な領域は粗いルートのまま、曲率の大きい領域 (フィレット等) のみを細分する。
+ * 境界が通過するルートは、曲率から決めた深さよりkBoundaryExtraDepth段深くする。
+ *
+ * 深さ場を決めた後の葉の三角分割 (頂点の評価を含む) は、ルートセル単位で
+ * 並列に行う。各ルートは頂点をルート内でのみ重複排除し、ルートの境界上の頂点は
+ * 結合時に仮想最細格子のキーで重複排除する。結合はルートの順に行うため、
+ * 出力 (頂点・三角形の順序を含む) はスレッド数によらず直列処理と一致する。
  */
 #ifndef IGESIO_ENTITIES_SURFACES_ALGORITHMS_RESTRICTED_SURFACE_MESH_H_
 #define IGESIO_ENTITIES_SURFACES_ALGORITHMS_RESTRICTED_SURFACE_MESH_H_
 
 #include "igesio/numerics/meshes/triangle_mesh.h"
 #include "igesio/entities/interfaces/i_restricted_surface.h"
+#include "igesio/entities/surfaces/algorithms/surface_tessellation_tolerance.h"
 
 
 
@@ -44,9 +55,24 @@ struct RestrictedSurfaceMeshParams {
     /// @brief 境界セルを細分する四分木の最大深さ
     /// @note 局所的に実効分割数が base_div * 2^max_depth まで上がる
     ///       (既定では 32 * 4 = 128 相当)。細い形状・欠け角の脱落を救済する
+    /// @note toleranceが有効な場合は、曲率による細分の最大深さも兼ねる
     int max_depth = 2;
+    /// @brief 弦高・角度・最大辺長の許容量 (既定: 無効)
+    /// @note 有効な場合、各ルートを許容量を満たす深さまで細分する。平坦な曲面を
+    ///       少ない三角形で表すため、base_divは小さく (8程度)、max_depthは
+    ///       大きく (5程度) 設定することを想定する
+    TessellationTolerance tolerance;
+    /// @brief 1つの曲面をルートセル単位で並列にテッセレーションするか
+    /// @note 出力は並列・直列で一致する (キャッシュのキーには含めない)。
+    ///       葉の数が少ない曲面は、trueでも直列に処理する
+    bool parallel = true;
 };
 
+/// @brief 許容量を指定した場合に、境界が通過するルートを曲率による深さより
+///        深くする段数
+/// @note 許容量を指定しない場合、境界ルートは常にmax_depthまで細分する
+inline constexpr int kBoundaryExtraDepth = 2;
+
 /// @brief 制限付き曲面 (Type 143/144等) を三角形メッシュへテッセレーションする
 ///
 /// 境界駆動の制限付き四分木により、トリム境界近傍を適応的に細分しつつ、
@@ -24,6 +24,7 @@
 #include "igesio/entities/interfaces/i_curve.h"
 #include "igesio/entities/interfaces/i_surface.h"
 #include "igesio/entities/interfaces/i_restricted_surface.h"
+#include "igesio/entities/curves/algorithms/curve_discretization.h"
 
 
 
@@ -40,10 +41,15 @@ struct SurfaceBoundaryEdges {
 /// @brief 境界エッジ生成の制御パラメータ
 struct SurfaceBoundaryEdgeParams {
     /// @brief 1ループ (1本の境界曲線/アイソ辺) あたりの分割数
+    /// @note toleranceが有効な場合、境界曲線 (S(B(t))) には用いない
     int divisions = 64;
     /// @brief 閉じた方向の継ぎ目辺を含めるか
     /// @note falseの場合、IsUClosed()/IsVClosed()がtrueの方向の両端アイソ辺を除外する
     bool include_seams = false;
+    /// @brief 境界曲線 S(B(t)) の折れ線化の許容量 (モデル空間)
+    /// @note 有効な場合は等間隔分割の代わりにDiscretizeCurveで適応的に折れ線化する
+    ///       (直線の境界曲線も、曲面上で曲がる区間は許容量に応じて分割される)
+    TessellationTolerance tolerance;
 };
 
 /// @brief 曲線の等間隔サンプルに、開区間内の角点パラメータを併合した列を返す
@@ -18,8 +18,14 @@
  * 交点条件 F(u,v,t) = S(u,v) - L(t) = 0 を多変数ニュートン法で解く。
  * ヤコビアン J = [Su | Sv | -(p1-p0)] (3×3) はTryGetDerivativesから構築する。
  *
- * 収束への多スタートのため、uvパラメータ空間をN×N格子でサンプリングし、
- * 各格子点から線上への射影を初期tとして使用する。
+ * 初期値の生成方式は`SurfaceLineIntersectionMethod`で選択する:
+ *   - kGridNewton: uvパラメータ空間をN×N格子でサンプリングし、
+ *     各格子点から線上への射影を初期tとして使用する多スタート。
+ *   - kSubdivision: 曲面のNURBS表現 (ISurface::ToNurbs) を有理Bézierパッチに
+ *     分解し、制御網を再帰的に分割する。線を含む2平面に対する制御点の符号と
+ *     線パラメータの範囲 (凸包性) で交差しない領域を棄却し、残った平坦な領域の
+ *     中心からニュートン法を開始する。計算量は固定の格子数ではなく候補領域数に
+ *     比例し、線が触れない曲面では曲面の評価を一切行わない。
  */
 #ifndef IGESIO_ENTITIES_SURFACES_ALGORITHMS_SURFACE_LINE_INTERSECTION_H_
 #define IGESIO_ENTITIES_SURFACES_ALGORITHMS_SURFACE_LINE_INTERSECTION_H_
@@ -47,10 +53,25 @@ struct SurfaceLineIntersection {
     double t;
 };
 
+/// @brief IntersectSurfaceWithLineの初期値の生成方式
+enum class SurfaceLineIntersectionMethod {
+    /// @brief uv格子の各点からニュートン法を開始する
+    kGridNewton,
+    /// @brief NURBS制御網の再帰分割で候補領域を絞り、各領域からニュートン法を開始する
+    /// @note NURBSで表せない曲面 (ToNurbsがnullptrを返すトリム面・無限平面等) では
+    ///       kGridNewtonにフォールバックする
+    kSubdivision,
+};
+
 /// @brief IntersectSurfaceWithLineの探索制御パラメータ
 struct SurfaceLineIntersectionParams {
+    /// @brief 初期値の生成方式
+    SurfaceLineIntersectionMethod method =
+            SurfaceLineIntersectionMethod::kGridNewton;
     /// @brief u方向の初期格子サンプル数
-    /// @note 増やすと多重解の検出精度が上がるが計算コストが増加する
+    /// @note 増やすと多重解の検出精度が上がるが計算コストが増加する.
+    ///       kSubdivisionでは、NURBS表現のパラメータ化が元の曲面と異なる場合に
+    ///       交点の (u, v) を元の曲面上で求め直す初期値探索にのみ使用する
     int u_samples = 20;
     /// @brief v方向の初期格子サンプル数
     int v_samples = 20;
@@ -60,13 +81,20 @@ struct SurfaceLineIntersectionParams {
     double convergence_tol = 1e-9;
     /// @brief 重複解の除去に使用する3D空間距離の許容誤差
     double dedup_tol = 1e-6;
+    /// @brief kSubdivision: 再帰分割の最大深さ (u, vいずれかの分割ごとに1増える)
+    int max_subdivision_depth = 16;
+    /// @brief kSubdivision: ニュートン法を開始する領域の平坦度
+    /// @note 制御点と、四隅の制御点による双線形補間との差の最大値が、
+    ///       制御網の大きさのこの値倍以下となった領域からニュートン法を開始する.
+    ///       ニュートン法が失敗した領域は最大深さまで分割を続ける
+    double subdivision_flatness = 0.05;
 };
 
 /// @brief 曲面と直線（半直線・線分を含む）の交点を計算する
 ///
 /// 交点条件 S(u,v) = L(t) を多変数ニュートン法で求解する。
-/// 初期値として uvパラメータ空間を格子サンプリングし、各サンプル点を
-/// 線分への射影によってtの初期値を生成する多スタート戦略を採用する。
+/// 初期値はparams.methodに従い、uvパラメータ空間の格子サンプリング
+/// (kGridNewton) またはNURBS制御網の再帰分割 (kSubdivision) で生成する。
 ///
 /// 穴のある曲面（TrimmedSurface等）では、ニュートン法の各反復で
 /// TryGetDerivativesがnulloptを返した場合にその探索を打ち切る。
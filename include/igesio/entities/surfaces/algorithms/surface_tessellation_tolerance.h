@@ -0,0 +1,75 @@
+/**
+ * @file entities/surfaces/algorithms/surface_tessellation_tolerance.h
+ * @brief 曲面のテッセレーションの許容量 (TessellationTolerance) に基づく分割数の推定
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * 弦高 (chord height)・角度・最大辺長の許容量から、曲面のパラメータ範囲を
+ * どこまで細かく分割すべきかを推定する. TessellateRestrictedSurface (四分木) と
+ * graphics::BuildGeneralSurfaceMesh (テンソル積格子) の適応的な分割に共通で用いる.
+ *
+ * ### 推定方法
+ * パラメータ空間の線分 (Δu, Δv) に沿う曲面上の曲線 C(s) = S(u + sΔu, v + sΔv)
+ * (s ∈ [0,1]) について、TryGetDerivatives(u, v, 2) から
+ *   - C'  = S_u Δu + S_v Δv                    (弦の長さの近似)
+ *   - C'' = S_uu Δu² + 2 S_uv ΔuΔv + S_vv Δv²
+ * を求め、線分を2^d等分したときの各量を以下で見積もる:
+ *   - 弦高: |C''| / 8 / 4^d
+ *   - 角度 (接線の回転角): |C' × C''| / |C'|² / 2^d
+ *   - 辺長: |C'| / 2^d
+ * いずれも標本点での値であり、標本点の間に局所的な特徴 (鋭いフィレット等) が
+ * ある場合は過小評価となりうる.
+ */
+#ifndef IGESIO_ENTITIES_SURFACES_ALGORITHMS_SURFACE_TESSELLATION_TOLERANCE_H_
+#define IGESIO_ENTITIES_SURFACES_ALGORITHMS_SURFACE_TESSELLATION_TOLERANCE_H_
+
+#include <array>
+#include <vector>
+
+#include "igesio/entities/interfaces/i_surface.h"
+#include "igesio/entities/curves/algorithms/curve_discretization.h"  // TessellationTolerance
+
+
+
+namespace igesio::entities {
+
+/// @brief パラメータ矩形を一様に分割する際に必要な2分割の回数を推定する
+/// @param surface 対象の曲面 (制限面の場合は基底曲面を渡すこと)
+/// @param u_range uの範囲 {開始, 終了}
+/// @param v_range vの範囲 {開始, 終了}
+/// @param tolerance 許容量
+/// @param max_depth 戻り値の上限 (0以上)
+/// @return 矩形をu・v方向にそれぞれ2^d等分したとき、全ての小矩形の辺と対角線が
+///         許容量を満たすと見積もられる最小のd (max_depthでクランプ).
+///         許容量が無効の場合は0
+/// @note 矩形内の3×3の標本点で評価する. 評価できない標本点は除く
+int EstimateSubdivisionDepth(
+        const ISurface& surface, const std::array<double, 2>& u_range,
+        const std::array<double, 2>& v_range,
+        const TessellationTolerance& tolerance, int max_depth);
+
+/// @brief ComputeAdaptiveStationsの初期区間数
+/// @note 周期的な曲面で両端が一致する場合にも曲率を捉えられるよう、1より大きくする
+inline constexpr int kAdaptiveInitialIntervals = 4;
+
+/// @brief 1方向のパラメータ範囲を、許容量を満たすよう適応的に分割する
+/// @param surface 対象の曲面
+/// @param along_u trueの場合はu方向、falseの場合はv方向を分割する
+/// @param range 分割する方向のパラメータ範囲 {開始, 終了} (有限値)
+/// @param probes 他方のパラメータの標本値 (各区間をこれらの値の上で評価する)
+/// @param tolerance 許容量
+/// @param max_depth 初期区間を2分割する回数の上限 (0以上)
+/// @return 分割点 (range[0], range[1]を含む昇順).
+///         許容量が無効の場合は初期区間 (kAdaptiveInitialIntervals等分) の分割点
+/// @note 初期区間から始め、いずれかの標本値で許容量を満たさない区間を再帰的に
+///       2分割する. 分割の判定は区間の両端と中点での見積もりの最大値による
+std::vector<double> ComputeAdaptiveStations(
+        const ISurface& surface, bool along_u, const std::array<double, 2>& range,
+        const std::vector<double>& probes,
+        const TessellationTolerance& tolerance, int max_depth);
+
+}  // namespace igesio::entities
+
+#endif  // IGESIO_ENTITIES_SURFACES_ALGORITHMS_SURFACE_TESSELLATION_TOLERANCE_H_
@@ -0,0 +1,221 @@
+/**
+ * @file entities/surfaces/algorithms/tessellation_cache.h
+ * @brief エンティティの形状リビジョンをキーとするテッセレーション結果のキャッシュ
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * テッセレーションは描画 (RestrictedSurfaceGraphics)、レイキャスト
+ * (models::RayCaster)、メッシュ出力 (models::TessellateAssembly) 等で同じ曲面に
+ * 対して繰り返し行われる. TessellationCacheは、その結果を
+ * (エンティティのID, 形状キー, テッセレーションパラメータのハッシュ) ごとに保持し、
+ * 形状が変わらない限り再利用する.
+ *
+ * 形状キーは entities::CombineGeometryKeyRecursive による、自身・DE変換チェーン・
+ * 物理従属子の (ID, GeometryRevision) の結合値であり、描画の再同期の判定
+ * (IEntityGraphics::CurrentGeometryKey) と同じ規則で形状の変更を検知する.
+ * 形状が変わったエンティティの古いエントリは、新しい結果の登録時に破棄する.
+ *
+ * 保持するメッシュの合計メモリ量が上限を超えた場合は、最も長く参照されていない
+ * エントリから破棄する (LRU). 既定では、描画・レイキャスト・メッシュ出力は
+ * プロセス内で共有されるキャッシュ (GetSharedTessellationCache) を用いるため、
+ * 形状を変更していないモデルの再表示・再出力ではテッセレーションを省略できる.
+ */
+#ifndef IGESIO_ENTITIES_SURFACES_ALGORITHMS_TESSELLATION_CACHE_H_
+#define IGESIO_ENTITIES_SURFACES_ALGORITHMS_TESSELLATION_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "igesio/common/id_generator.h"
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/entities/interfaces/i_entity_identifier.h"
+#include "igesio/entities/interfaces/i_restricted_surface.h"
+#include "igesio/entities/surfaces/algorithms/restricted_surface_mesh.h"
+#include "igesio/entities/surfaces/algorithms/watertight_mesh.h"
+
+
+
+namespace igesio::entities {
+
+/// @brief TessellationCacheの既定のメモリ上限 [byte] (256 MiB)
+inline constexpr std::size_t kDefaultTessellationCacheBudget = 256u << 20;
+
+/// @brief テッセレーション結果のキー
+struct TessellationCacheKey {
+    /// @brief 対象のID (エンティティ、または複数のエンティティを代表するID)
+    ObjectID id;
+    /// @brief 形状キー (CombineGeometryKeyRecursiveの結合値等)
+    std::uint64_t geometry = 0;
+    /// @brief テッセレーションの方式とパラメータのハッシュ
+    std::uint64_t params = 0;
+
+    /// @brief 等価比較
+    bool operator==(const TessellationCacheKey& other) const {
+        return id == other.id && geometry == other.geometry && params == other.params;
+    }
+};
+
+/// @brief エンティティのテッセレーション結果のキーを作成する
+/// @param entity 対象のエンティティ
+/// @param params テッセレーションの方式とパラメータのハッシュ
+/// @return キー (形状キーはCombineGeometryKeyRecursive(0, entity))
+TessellationCacheKey MakeTessellationCacheKey(
+        const IEntityIdentifier& entity, std::uint64_t params);
+
+/// @brief TessellateRestrictedSurfaceのパラメータのハッシュ
+/// @note 方式ごとに異なる種別値を含めるため、他の方式のハッシュとは衝突しにくい
+/// @note 各パラメータのFNV-1aであり、標準ライブラリの実装によらず同じ値となる
+///       (サイドカーファイルにそのまま保存する)
+std::uint64_t HashTessellationParams(const RestrictedSurfaceMeshParams& params);
+
+/// @brief TessellateWatertightのパラメータのハッシュ
+std::uint64_t HashTessellationParams(const WatertightMeshParams& params);
+
+/// @brief メッシュが保持するメモリ量の見積もり [byte]
+std::size_t EstimateMeshMemory(const numerics::TriangleMeshf& mesh);
+
+/// @brief TessellationCacheの統計
+struct TessellationCacheStats {
+    /// @brief キャッシュから結果を返した回数
+    std::size_t hits = 0;
+    /// @brief テッセレーションを行った回数
+    std::size_t misses = 0;
+    /// @brief メモリ上限により破棄したエントリ数 (形状の変更による破棄は含まない)
+    std::size_t evictions = 0;
+};
+
+/// @brief テッセレーション結果のLRUキャッシュ
+/// @note 全てのメンバ関数は任意のスレッドから同時に呼び出してよい.
+///       テッセレーション (GetOrBuildのbuild) はロックの外で行うため、同じキーを
+///       同時に要求した場合は重複して構築しうる (先に登録された結果を全員が返す)
+class TessellationCache {
+ public:
+    /// @brief コンストラクタ
+    /// @param memory_budget 保持するメッシュの合計メモリ量の上限 [byte].
+    ///        0の場合は結果を保持しない
+    explicit TessellationCache(
+            std::size_t memory_budget = kDefaultTessellationCacheBudget)
+            : memory_budget_(memory_budget) {}
+
+    // コピーを禁止
+    TessellationCache(const TessellationCache&) = delete;
+    TessellationCache& operator=(const TessellationCache&) = delete;
+
+    /// @brief キーに対応する結果を取得する (保持していない場合は構築して登録する)
+    /// @tparam Builder 引数を取らず、numerics::TriangleMeshfを返す呼び出し可能型
+    /// @param key キー
+    /// @param build テッセレーションを行う関数
+    /// @return テッセレーション結果
+    /// @throw buildが送出した例外 (この場合は何も登録しない)
+    template <typename Builder>
+    std::shared_ptr<const numerics::TriangleMeshf> GetOrBuild(
+            const TessellationCacheKey& key, const Builder& build) {
+        if (auto mesh = Find(key)) return mesh;
+        return Insert(key, std::make_shared<const numerics::TriangleMeshf>(build()));
+    }
+
+    /// @brief 制限付き曲面のテッセレーション (TessellateRestrictedSurface) を取得する
+    /// @param surface 対象の曲面
+    /// @param params テッセレーションのパラメータ
+    /// @return テッセレーション結果
+    std::shared_ptr<const numerics::TriangleMeshf> GetRestrictedSurfaceMesh(
+            const IRestrictedSurface& surface,
+            const RestrictedSurfaceMeshParams& params = {});
+
+    /// @brief キーに対応する結果を保持している場合はそれを返す
+    /// @return 保持する結果. 保持していない場合はnullptr (missesに計上する)
+    /// @note 取得したエントリを最も新しく参照されたものとする
+    std::shared_ptr<const numerics::TriangleMeshf> Find(const TessellationCacheKey& key);
+
+    /// @brief 結果を登録する
+    /// @param key キー
+    /// @param mesh テッセレーション結果
+    /// @return 登録した結果. 同じキーが既に登録されている場合はその結果
+    /// @note 同じID・パラメータで形状キーの異なるエントリ (形状の変更前の結果) を
+    ///       破棄する. 登録後にメモリ上限を超える場合は古いエントリから破棄する
+    ///       (登録した結果自身が上限を超える場合は保持しない)
+    std::shared_ptr<const numerics::TriangleMeshf> Insert(
+            const TessellationCacheKey& key,
+            std::shared_ptr<const numerics::TriangleMeshf> mesh);
+
+    /// @brief 指定したID・形状キーの全てのエントリ (パラメータ違い) を取得する
+    /// @param id 対象のID
+    /// @param geometry 形状キー
+    /// @return (パラメータのハッシュ, 結果) の列
+    /// @note 参照順・統計は変更しない (保存等の走査用)
+    std::vector<std::pair<std::uint64_t, std::shared_ptr<const numerics::TriangleMeshf>>>
+    GetEntries(const ObjectID& id, std::uint64_t geometry) const;
+
+    /// @brief メモリ上限を変更する (超過分は古いエントリから破棄する)
+    void SetMemoryBudget(std::size_t memory_budget);
+    /// @brief メモリ上限を取得する
+    std::size_t GetMemoryBudget() const;
+    /// @brief 保持するメッシュの合計メモリ量の見積もりを取得する
+    std::size_t GetMemoryUsage() const;
+    /// @brief 保持するエントリ数を取得する
+    std::size_t GetEntryCount() const;
+    /// @brief 統計を取得する
+    TessellationCacheStats GetStats() const;
+    /// @brief 全てのエントリを破棄し、統計を初期化する
+    void Clear();
+
+ private:
+    /// @brief キーのID・パラメータのハッシュ (形状キーは含めない)
+    struct SlotHash {
+        std::size_t operator()(const TessellationCacheKey& key) const;
+    };
+    /// @brief キーのID・パラメータの等価比較 (形状キーは比較しない)
+    struct SlotEqual {
+        bool operator()(const TessellationCacheKey& a, const TessellationCacheKey& b) const {
+            return a.id == b.id && a.params == b.params;
+        }
+    };
+    /// @brief エントリ
+    struct Entry {
+        /// @brief キー
+        TessellationCacheKey key;
+        /// @brief テッセレーション結果
+        std::shared_ptr<const numerics::TriangleMeshf> mesh;
+        /// @brief メモリ量の見積もり
+        std::size_t bytes = 0;
+    };
+
+    /// @brief 古いエントリを上限以下になるまで破棄する (ロックを取得した状態で呼ぶ)
+    void EvictLocked();
+    /// @brief エントリを破棄する (ロックを取得した状態で呼ぶ)
+    void EraseLocked(std::list<Entry>::iterator it);
+
+    /// @brief 排他制御用のミューテックス
+    mutable std::mutex mutex_;
+    /// @brief エントリ (先頭が最も新しく参照されたもの)
+    std::list<Entry> entries_;
+    /// @brief (ID, パラメータ) からエントリへの索引
+    /// @note 同じID・パラメータのエントリは高々1つ (形状キーの異なるものは
+    ///       Insertで置き換える) のため、形状キーは参照先のエントリで照合する
+    std::unordered_map<TessellationCacheKey, std::list<Entry>::iterator,
+                       SlotHash, SlotEqual> index_;
+    /// @brief メモリ上限
+    std::size_t memory_budget_;
+    /// @brief 保持するメッシュの合計メモリ量
+    std::size_t memory_usage_ = 0;
+    /// @brief 統計
+    TessellationCacheStats stats_;
+};
+
+/// @brief プロセス内で共有されるテッセレーションキャッシュを取得する
+/// @note 描画 (RestrictedSurfaceGraphics)・レイキャスト (models::RayCaster)・
+///       メッシュ出力 (models::TessellateAssembly) が用いる. 結果を保持しない
+///       ようにするには SetMemoryBudget(0) とする
+TessellationCache& GetSharedTessellationCache();
+
+}  // namespace igesio::entities
+
+#endif  // IGESIO_ENTITIES_SURFACES_ALGORITHMS_TESSELLATION_CACHE_H_
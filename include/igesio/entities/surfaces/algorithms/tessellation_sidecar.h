@@ -0,0 +1,74 @@
+/**
+ * @file entities/surfaces/algorithms/tessellation_sidecar.h
+ * @brief テッセレーション結果のディスクへの保存・読み込み (サイドカーファイル)
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * 大きなモデルの再読み込み時にテッセレーションを省略するため、TessellationCacheが
+ * 保持する結果をIGESファイルと並べたファイル (既定の拡張子は ".igesc") へ保存し、
+ * 次回の読み込み時にキャッシュへ戻す.
+ *
+ * ObjectIDは読み込みごとに異なるため、ファイル上の結果はエンティティの内容
+ * (ComputeEntityContentHash: 型・フォーム番号・PDのポインタ以外の値と、DE変換チェーン・
+ * 物理従属子の内容) のハッシュで識別する. 読み込み時には現在のエンティティの
+ * 内容ハッシュと一致する結果のみを、そのエンティティのキー
+ * (MakeTessellationCacheKey) で登録するため、内容が変わったエンティティは通常通り
+ * 再テッセレーションされる.
+ *
+ * ファイルはPOSIX環境ではメモリマップして読み込む (Windowsでは一括読み込み).
+ * 破損・切り詰められたファイルは範囲検査により検出し、何も登録しない.
+ */
+#ifndef IGESIO_ENTITIES_SURFACES_ALGORITHMS_TESSELLATION_SIDECAR_H_
+#define IGESIO_ENTITIES_SURFACES_ALGORITHMS_TESSELLATION_SIDECAR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "igesio/entities/interfaces/i_entity_identifier.h"
+#include "igesio/entities/surfaces/algorithms/tessellation_cache.h"
+
+
+
+namespace igesio::entities {
+
+/// @brief サイドカーファイルの既定の拡張子 (元のファイルのパスに付加する)
+inline constexpr const char* kTessellationSidecarExtension = ".igesc";
+
+/// @brief エンティティの内容のハッシュを計算する
+/// @param entity 対象のエンティティ
+/// @return 型・フォーム番号・PDのポインタ以外の値、DE変換チェーン・物理従属子の
+///         内容を結合したハッシュ. EntityBaseでない場合はstd::nullopt
+/// @note ObjectID・リビジョンに依存しないため、同じファイルを読み直した場合や
+///       同じ内容で作成した場合は同じ値となる. 値はプロセス・環境をまたいで安定する
+std::optional<std::uint64_t> ComputeEntityContentHash(const IEntityIdentifier& entity);
+
+/// @brief キャッシュが保持する結果のうち、エンティティの現在の形状に対応するものを保存する
+/// @param path 保存先のパス (既存のファイルは上書きする)
+/// @param entities 対象のエンティティ
+/// @param cache 結果を保持するキャッシュ
+/// @return 保存に成功した場合はtrue
+/// @note 同じ内容のエンティティの結果は1つにまとめて保存する
+bool SaveTessellationSidecar(
+        const std::string& path,
+        const std::vector<std::shared_ptr<IEntityIdentifier>>& entities,
+        const TessellationCache& cache);
+
+/// @brief サイドカーファイルから、エンティティの内容に一致する結果をキャッシュへ登録する
+/// @param path サイドカーファイルのパス
+/// @param entities 対象のエンティティ
+/// @param cache 登録先のキャッシュ
+/// @return 登録した結果の数. ファイルが存在しない・破損している場合は0
+std::size_t LoadTessellationSidecar(
+        const std::string& path,
+        const std::vector<std::shared_ptr<IEntityIdentifier>>& entities,
+        TessellationCache& cache);
+
+}  // namespace igesio::entities
+
+#endif  // IGESIO_ENTITIES_SURFACES_ALGORITHMS_TESSELLATION_SIDECAR_H_
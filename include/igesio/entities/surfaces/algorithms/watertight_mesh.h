@@ -0,0 +1,80 @@
+/**
+ * @file entities/surfaces/algorithms/watertight_mesh.h
+ * @brief 複数の曲面の、共有境界で隙間なく接続された三角形メッシュ生成
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * TessellateRestrictedSurfaceは面ごとに独立に境界の交差点を求めるため、
+ * 隣接する面のメッシュは共有境界で頂点が一致せず、T字接合や隙間が生じる.
+ * TessellateWatertightは、面の間で共有される境界を1度だけ離散化し、その頂点を
+ * 隣接する全ての面で共有することで、溶接・修復なしに隙間のないメッシュを得る.
+ *
+ * ### アルゴリズム概要
+ * 1. 各面の境界ループ (外側境界・穴. 境界のない面はパラメータ矩形) を、
+ *    境界曲線の角点で区間 (ピース) に分ける.
+ * 2. 他のピースの端点が内部に乗るピースをその点で分割し (T字の解消)、
+ *    端点を距離merge_toleranceでまとめて頂点とする.
+ * 3. 両端の頂点が同じで、中点が互いに乗るピースを1つの共有辺とみなす.
+ *    共有辺は代表のピースで許容量に基づき離散化し、他のピースへは各点を
+ *    射影してuvを求める (空間上の位置は代表の点を用いる).
+ *    同じ面の継ぎ目 (閉じた曲面のu=u0とu=u1等) も共有辺として接続される.
+ * 4. 各面のuv空間に、許容量に基づくテンソル積格子 (ComputeAdaptiveStations) を
+ *    張り、境界から離れた領域内のセルはそのまま2つの三角形に分割する.
+ *    境界と残したセルの間の領域は、境界の離散化点とセルの角のみを頂点として
+ *    耳切り法 (numerics::TriangulatePolygon) で分割する. このため面の境界辺は
+ *    共有辺の離散化と正確に一致する.
+ *
+ * 1.と4.は面ごとに、3.の離散化は共有辺ごとに並列に行う (common/parallel.h).
+ */
+#ifndef IGESIO_ENTITIES_SURFACES_ALGORITHMS_WATERTIGHT_MESH_H_
+#define IGESIO_ENTITIES_SURFACES_ALGORITHMS_WATERTIGHT_MESH_H_
+
+#include <memory>
+#include <vector>
+
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/entities/interfaces/i_surface.h"
+#include "igesio/entities/surfaces/algorithms/surface_tessellation_tolerance.h"
+
+
+
+namespace igesio::entities {
+
+/// @brief TessellateWatertightの既定の角度の許容量 [rad] (15度)
+inline constexpr double kWatertightAngle = 0.2617993877991494;
+
+/// @brief TessellateWatertightの制御パラメータ
+struct WatertightMeshParams {
+    /// @brief 境界の離散化と面の格子の許容量 (既定: 角度kWatertightAngle)
+    /// @note 無効の場合、境界は端点のみ (閉じた境界はkAdaptiveInitialIntervals等分)、
+    ///       格子はkAdaptiveInitialIntervals等分となる
+    TessellationTolerance tolerance{0.0, kWatertightAngle, 0.0};
+    /// @brief 境界の区間・格子の初期区間を2分割する回数の上限
+    int max_depth = 6;
+    /// @brief [モデル単位] 境界の端点が一致する、または点が境界上にあるとみなす距離
+    double merge_tolerance = 1e-6;
+};
+
+/// @brief 複数の曲面を、共有する境界で隙間なく接続された1つのメッシュにする
+/// @param faces 対象の曲面 (制限面、またはSurfaceView等による配置済みの曲面).
+///        空間上で一致する境界を共有境界とみなすため、全て同じ座標系に置くこと
+/// @param params 制御パラメータ
+/// @return 三角形メッシュ (positions/normalsを持ち、uvsは持たない).
+///         面ごとに1つの面グループ (facesの順. 名前は空) を持つ
+/// @throw std::invalid_argument merge_toleranceが正でない、または
+///        max_depthが負の場合
+/// @note 共有境界の頂点は隣接する面で共有され、その法線は各面の法線の平均となる.
+///       三角形の向きは各面のuv空間で反時計回り (S_u × S_v の向き) であり、
+///       面の向きの統一は行わない
+/// @note パラメータ範囲が有限でない曲面、境界の端点が評価できない面は
+///       出力に含めない (面グループは三角形数0となる).
+///       3つ以上の面が共有する境界は全ての面で同じ頂点を用いる (非多様体)
+numerics::TriangleMeshf TessellateWatertight(
+        const std::vector<std::shared_ptr<const ISurface>>& faces,
+        const WatertightMeshParams& params = {});
+
+}  // namespace igesio::entities
+
+#endif  // IGESIO_ENTITIES_SURFACES_ALGORITHMS_WATERTIGHT_MESH_H_
@@ -18,6 +18,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "igesio/common/lazy_cache.h"
 #include "igesio/numerics/core/matrix.h"
 #include "igesio/numerics/geometric/bounding_box.h"
 #include "igesio/entities/interfaces/i_curve.h"
@@ -164,18 +165,31 @@ class BoundedPlane : public EntityBase, public virtual IRestrictedSurface {
     /// @brief 境界閉曲線 (PTR)。Physically Dependent。
     PointerContainer<false, ICurve> boundary_;
 
+    /// @brief UV境界と定義空間bboxのキャッシュ
+    struct BoundaryCache {
+        /// @brief UV空間の外側境界曲線 (閉ポリライン)。退化時はnullptr
+        std::shared_ptr<const ICurve> uv_boundary;
+        /// @brief 有界領域の定義空間バウンディングボックス。退化時はstd::nullopt
+        std::optional<numerics::BoundingBox> defined_bbox;
+    };
+
     /// @brief 基底曲面 (定義空間Plane)。遅延構築・キャッシュ
-    mutable std::shared_ptr<Plane> base_surface_;
-    /// @brief UV空間の外側境界曲線 (閉ポリライン)。遅延構築・キャッシュ
-    mutable std::shared_ptr<const ICurve> uv_boundary_;
-    /// @brief 有界領域の定義空間バウンディングボックス。遅延構築・キャッシュ
-    mutable std::optional<numerics::BoundingBox> defined_bbox_;
+    mutable LazyCache<std::shared_ptr<const Plane>> base_surface_;
+    /// @brief UV境界・定義空間bbox。遅延構築・キャッシュ
+    mutable LazyCache<BoundaryCache> boundary_cache_;
 
-    /// @brief UV境界・定義空間bboxのキャッシュを構築する (未構築かつ境界解決済み時のみ)
+    /// @brief UV境界・定義空間bboxのキャッシュを取得する (未構築の場合は構築する)
+    /// @return キャッシュ。境界が未解決の場合は構築せずnullptr
     /// @note 境界曲線をモデル空間で離散化し、モデル空間フレームへ内積射影して
     ///       (u, v) 化、閉LinearPathと定義空間点群bboxを生成する。境界が
-    ///       未解決・退化の場合は何もしない (グレースフル劣化)。
-    void EnsureBoundaryCache() const;
+    ///       退化している場合は空のキャッシュとなる (グレースフル劣化)。
+    /// @note 同一インスタンスに対して同時に呼び出してよい
+    std::shared_ptr<const BoundaryCache> EnsureBoundaryCache() const;
+
+    /// @brief 境界曲線からUV境界・定義空間bboxを作成する
+    ///        (EnsureBoundaryCacheの構築関数)
+    /// @param boundary 境界曲線 (解決済み)
+    BoundaryCache ComputeBoundaryCache(const ICurve& boundary) const;
 
     /// @brief 基底曲面・UV境界・定義空間bbox・ドメイン判定キャッシュを無効化する
     void InvalidateGeometryCaches() const noexcept;
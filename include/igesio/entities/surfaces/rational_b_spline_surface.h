@@ -381,6 +381,10 @@ class RationalBSplineSurface : public EntityBase, public virtual ISurface {
 
 
  protected:
+    /// @brief 曲面を厳密に表すNURBS曲面を作成する
+    /// @return 自身と同じNURBS曲面 (複製)
+    std::shared_ptr<RationalBSplineSurface> ConvertToNurbs() const override;
+
     /// @brief エンティティ自身が参照する変換行列に従い、座標orベクトルを変換する
     /// @param input 変換前の座標orベクトル v
     /// @param is_point 座標を変換する場合は`true`、ベクトルを変換する場合は`false`
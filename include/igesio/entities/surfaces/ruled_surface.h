@@ -247,6 +247,13 @@ class RuledSurface : public EntityBase, public virtual ISurface {
 
 
  protected:
+    /// @brief 曲面を厳密に表すNURBS曲面を作成する
+    /// @return u方向を2曲線の共通のNURBS、v方向を1次としたNURBS曲面.
+    ///         いずれかの曲線がNURBSに変換できない場合、または変換後の2曲線の
+    ///         同一パラメータの点が元の曲面の同じ母線上にない場合 (例: パラメータ化の
+    ///         異なる円弧と線分の組) はnullptr
+    std::shared_ptr<RationalBSplineSurface> ConvertToNurbs() const override;
+
     /// @brief エンティティ自身が参照する変換行列に従い、座標orベクトルを変換する
     /// @param input 変換前の座標orベクトル v
     /// @param is_point 座標を変換する場合は`true`、ベクトルを変換する場合は`false`
@@ -213,6 +213,11 @@ class SurfaceOfRevolution : public EntityBase, public virtual ISurface {
 
 
  protected:
+    /// @brief 曲面を厳密に表すNURBS曲面を作成する
+    /// @return u方向を母線のNURBS、v方向を有理2次の円弧としたNURBS曲面.
+    ///         母線がNURBSに変換できない場合はnullptr
+    std::shared_ptr<RationalBSplineSurface> ConvertToNurbs() const override;
+
     /// @brief エンティティ自身が参照する変換行列に従い、座標orベクトルを変換する
     /// @param input 変換前の座標orベクトル v
     /// @param is_point 座標を変換する場合は`true`、ベクトルを変換する場合は`false`
@@ -216,6 +216,11 @@ class TabulatedCylinder : public EntityBase, public virtual ISurface {
 
 
  protected:
+    /// @brief 曲面を厳密に表すNURBS曲面を作成する
+    /// @return u方向を準線のNURBS、v方向を1次としたNURBS曲面 (パラメータも
+    ///         準線の変換に準ずる). 準線がNURBSに変換できない場合はnullptr
+    std::shared_ptr<RationalBSplineSurface> ConvertToNurbs() const override;
+
     /// @brief エンティティ自身が参照する変換行列に従い、座標orベクトルを変換する
     /// @param input 変換前の座標orベクトル v
     /// @param is_point 座標を変換する場合は`true`、ベクトルを変換する場合は`false`
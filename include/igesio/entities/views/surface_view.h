@@ -99,6 +99,13 @@ class SurfaceView : public ISurface {
         return base_->GetChildIDs();
     }
 
+    /// @brief 元曲面を取得する
+    /// @note ビューは畳み込み済みのため、戻り値はSurfaceViewではない
+    const std::shared_ptr<const ISurface>& GetBase() const { return base_; }
+
+    /// @brief 基準階層までの累積変換を取得する (M_entityは含まない)
+    const Matrix4d& GetPlacement() const { return placement_; }
+
 
 
     /**
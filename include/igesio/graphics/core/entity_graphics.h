@@ -25,6 +25,7 @@
 #include "igesio/entities/interfaces/i_entity_identifier.h"
 #include "igesio/entities/interfaces/i_geometry.h"
 #include "igesio/entities/entity_base.h"
+#include "igesio/entities/curves/algorithms/curve_discretization.h"
 #include "igesio/entities/curves/algorithms/curve_line_intersection.h"
 #include "igesio/entities/surfaces/algorithms/surface_line_intersection.h"
 #include "igesio/graphics/core/i_entity_graphics.h"
@@ -34,49 +35,6 @@
 
 namespace igesio::graphics {
 
-/// @brief 同期キーへ (ObjectID, GeometryRevision) を順序通りに結合する
-/// @param seed 現在のキー値
-/// @param entity 結合するエンティティ
-/// @return 結合後のキー値
-/// @note boost::hash_combine方式. リビジョンの総和では参照先交換時に増減が
-///       相殺しうるため、同一性(ID)と値(rev)をハッシュで畳み込む
-inline uint64_t CombineGeometryKey(uint64_t seed,
-                                   const entities::IEntityIdentifier& entity) {
-    constexpr uint64_t kGolden = 0x9e3779b97f4a7c15ULL;
-    seed ^= std::hash<ObjectID>{}(entity.GetID())
-            + kGolden + (seed << 6) + (seed >> 2);
-    seed ^= entity.GeometryRevision() + kGolden + (seed << 6) + (seed >> 2);
-    return seed;
-}
-
-/// @brief エンティティ自身・DE変換チェーン・物理従属子を再帰的にキーへ結合する
-/// @param seed 現在のキー値
-/// @param entity 起点エンティティ
-/// @return 結合後のキー値
-/// @note テッセレーションが読む参照先 (DE変換行列・複合曲線の子・トリム面の境界・
-///       ルールド面の子曲線等) の形状変更を、親グラフィックスの再同期要否として
-///       検知するための走査. DE変換チェーンの循環はSetReference側で防止済み.
-///       物理従属はDAGであり循環しない前提
-inline uint64_t CombineGeometryKeyRecursive(
-        uint64_t seed, const entities::IEntityIdentifier& entity) {
-    seed = CombineGeometryKey(seed, entity);
-    const auto* base = dynamic_cast<const entities::EntityBase*>(&entity);
-    if (base == nullptr) return seed;
-
-    // DE変換チェーン (共有TransformationMatrixの編集を参照元の再同期として検知)
-    for (auto t = base->GetTransformationMatrix().GetPointer();
-         t != nullptr; t = t->GetRefTransformation()) {
-        seed = CombineGeometryKey(seed, *t);
-    }
-    // 物理従属子 (未解決参照はスキップ. 解決時は集合の変化としてキーに現れる)
-    for (const auto& cid : base->GetChildIDs()) {
-        if (const auto child = base->GetChildEntity(cid)) {
-            seed = CombineGeometryKeyRecursive(seed, *child);
-        }
-    }
-    return seed;
-}
-
 /// @brief エンティティの描画情報を管理するクラス
 /// @tparam T エンティティの型
 /// @tparam has_surfaces Tがサーフェスを持つか (デフォルト: false)
@@ -211,7 +169,7 @@ class EntityGraphics : public IEntityGraphics {
     ///       GetChildIDs経由で結合されるため、通常はオーバーライド不要
     uint64_t CurrentGeometryKey() const override {
         if (!entity_) return 0;
-        return CombineGeometryKeyRecursive(0, *entity_);
+        return entities::CombineGeometryKeyRecursive(0, *entity_);
     }
 
     /// @brief エンティティの描画を行う
@@ -307,6 +265,17 @@ class EntityGraphics : public IEntityGraphics {
         }
     }
 
+    /// @brief 描画するLODレベルを選択する (既定: 子要素へカスケード)
+    /// @note 複合ノードは子要素のSelectLevelOfDetailを呼ぶ (子に面が含まれる場合).
+    ///       子のワールド変換はSetWorldTransformで伝播済みのため、viewのみを渡す
+    void SelectLevelOfDetail(const LodView& view) override {
+        for (auto& [st, list] : child_graphics_) {
+            for (auto& child : list) {
+                if (child) child->SelectLevelOfDetail(view);
+            }
+        }
+    }
+
     /// @brief 子要素の描画オブジェクトを追加する (複合ノード化)
     /// @param graphics 追加する描画オブジェクト
     /// @note graphicsがnullptrの場合は何もしない. 子のShaderIdでバケットへ格納する.
@@ -643,6 +612,22 @@ class EntityGraphics : public IEntityGraphics {
         return bb;
     }
 
+    /// @brief ワールド座標系における軸平行バウンディングボックスを取得する
+    /// @note エンティティのBB (親空間) の頂点にworld_transform_を適用して包含する.
+    ///       点・直線状に退化したBBや、回転でないワールド変換 (スケール等) でも
+    ///       アフィン変換の凸性により保守的な範囲となる
+    std::optional<std::pair<Vector3d, Vector3d>>
+    GetWorldAxisAlignedBounds() const override {
+        auto geom = std::dynamic_pointer_cast<const entities::IGeometry>(entity_);
+        if (!geom) return std::nullopt;
+
+        const auto bb = geom->GetBoundingBox();
+        if (!bb.IsFinite()) return std::nullopt;
+        auto vertices = bb.GetFiniteVertices();
+        for (auto& v : vertices) v = ToWorld(world_transform_, v);
+        return AxisAlignedBoundsOf(vertices);
+    }
+
 
 
  protected:
@@ -657,44 +642,40 @@ class EntityGraphics : public IEntityGraphics {
         return Vector3d(w.x(), w.y(), w.z());
     }
 
-    /// @brief 曲線区間[ta,tb]を画面弦長基準で再帰的に細分し、中間点を追加する
-    /// @param curve 対象の曲線
-    /// @param params サンプリング制御パラメータ (適応分割の射影状態を含む)
-    /// @param wt world_transform_ (double)
-    /// @param ta, wa 区間始点のパラメータとワールド座標 (out には未追加)
-    /// @param tb, wb 区間終点のパラメータとワールド座標 (caller が後で追加)
-    /// @param depth 残り再帰深さ
-    /// @param out 中間点の追加先 (ta側からtb側の順で追加; 両端は含めない)
-    static void RefineCurveSegment(
-            const entities::ICurve& curve, const SelectionSampleParams& params,
-            const igesio::Matrix4d& wt, double ta, const Vector3d& wa,
-            double tb, const Vector3d& wb, int depth,
-            std::vector<Vector3d>& out) {
-        if (depth <= 0) return;
-        const auto sa = WorldToScreen(params.adaptive_view_proj,
-                params.adaptive_width, params.adaptive_height, wa);
-        const auto sb = WorldToScreen(params.adaptive_view_proj,
-                params.adaptive_width, params.adaptive_height, wb);
-        if (!sa || !sb) return;  // 射影不能ならこれ以上細分しない
-        const double dx = sa->x() - sb->x(), dy = sa->y() - sb->y();
-        const double tol = params.adaptive_max_chord_px;
-        if (dx * dx + dy * dy <= tol * tol) return;  // 画面上で十分短い
-
-        const double tm = 0.5 * (ta + tb);
-        const auto pm = curve.TryGetPointAt(tm);
-        if (!pm) return;
-        const Vector3d wm = ToWorld(wt, *pm);
-        RefineCurveSegment(curve, params, wt, ta, wa, tm, wm, depth - 1, out);
-        out.push_back(wm);
-        RefineCurveSegment(curve, params, wt, tm, wm, tb, wb, depth - 1, out);
+    /// @brief 範囲選択用の曲線の折れ線化パラメータを作成する
+    /// @param params サンプリング制御パラメータ
+    /// @return curve_samplesを初期分割数とするパラメータ.
+    ///         params.adaptive_refine時は画面上の辺長 (adaptive_max_chord_px) を
+    ///         上限として、adaptive_max_depth回まで区間を細分する
+    /// @note 射影はワールド座標の点に対して行うため、DiscretizeCurveには
+    ///       ワールド座標への写像を渡すこと
+    static entities::CurveDiscretizationParams MakeSelectionDiscretizationParams(
+            const SelectionSampleParams& params) {
+        entities::CurveDiscretizationParams dp;
+        dp.initial_segments = std::max(1, params.curve_samples);
+        dp.max_depth = 0;
+        if (params.adaptive_refine) {
+            dp.max_depth = params.adaptive_max_depth;
+            dp.screen.max_edge_length = params.adaptive_max_chord_px;
+            dp.screen.project = [vp = params.adaptive_view_proj,
+                                 w = params.adaptive_width,
+                                 h = params.adaptive_height](const Vector3d& p)
+                    -> std::optional<Vector2d> {
+                const auto s = WorldToScreen(vp, w, h, p);
+                if (!s) return std::nullopt;
+                return Vector2d(s->x(), s->y());
+            };
+        }
+        return dp;
     }
 
     /// @brief 曲線を折れ線群へサンプリングする
     /// @param curve 対象の曲線
     /// @param params サンプリング制御パラメータ
     /// @param wt world_transform_ (double)
-    /// @return ワールド座標のサンプル. nulloptの点で折れ線を分割する。
-    ///         params.adaptive_refine時は画面弦長基準で区間を細分する
+    /// @return ワールド座標のサンプル. 評価できない点で折れ線を分割する.
+    ///         折れ線化は描画と共通のentities::DiscretizeCurveによる
+    ///         (MakeSelectionDiscretizationParamsを参照)
     static SelectionSamples SampleCurve(
             const entities::ICurve& curve, const SelectionSampleParams& params,
             const igesio::Matrix4d& wt) {
@@ -703,33 +684,14 @@ class EntityGraphics : public IEntityGraphics {
         if (std::isinf(t0)) t0 = -kInfiniteParamClamp;
         if (std::isinf(t1)) t1 = kInfiniteParamClamp;
 
-        const int n = std::max(1, params.curve_samples);
         SelectionSamples result;
-        std::vector<Vector3d> current;
-        bool has_prev = false;
-        double prev_t = 0.0;
-        Vector3d prev_w;
-        for (int i = 0; i <= n; ++i) {
-            const double t = t0 + (t1 - t0) * static_cast<double>(i) / n;
-            const auto p = curve.TryGetPointAt(t);
-            if (!p) {
-                if (!current.empty()) {
-                    result.polylines.push_back(std::move(current));
-                    current.clear();
-                }
-                has_prev = false;
-                continue;
-            }
-            const Vector3d wp = ToWorld(wt, *p);
-            // 直前点との間を画面弦長基準で細分する (中間点のみ追加)
-            if (has_prev && params.adaptive_refine) {
-                RefineCurveSegment(curve, params, wt, prev_t, prev_w, t, wp,
-                                   params.adaptive_max_depth, current);
-            }
-            current.push_back(wp);
-            prev_t = t; prev_w = wp; has_prev = true;
+        for (auto& polyline : entities::DiscretizeCurve(
+                curve, {t0, t1}, MakeSelectionDiscretizationParams(params),
+                [&wt](const Vector3d& p) -> std::optional<Vector3d> {
+                    return ToWorld(wt, p);
+                })) {
+            result.polylines.push_back(std::move(polyline.points));
         }
-        if (!current.empty()) result.polylines.push_back(std::move(current));
         return result;
     }
 
@@ -61,9 +61,10 @@ constexpr Enum kLineStrip = 0x0003;  // GL_LINE_STRIP
 constexpr Enum kTriangles = 0x0004;  // GL_TRIANGLES
 constexpr Enum kPatches   = 0x000E;  // GL_PATCHES
 // データ型
-constexpr Enum kUnsignedByte = 0x1401;  // GL_UNSIGNED_BYTE
-constexpr Enum kUnsignedInt  = 0x1405;  // GL_UNSIGNED_INT
-constexpr Enum kFloat        = 0x1406;  // GL_FLOAT
+constexpr Enum kUnsignedByte  = 0x1401;  // GL_UNSIGNED_BYTE
+constexpr Enum kUnsignedShort = 0x1403;  // GL_UNSIGNED_SHORT
+constexpr Enum kUnsignedInt   = 0x1405;  // GL_UNSIGNED_INT
+constexpr Enum kFloat         = 0x1406;  // GL_FLOAT
 // ピクセルフォーマット
 constexpr Enum kRgb  = 0x1907;  // GL_RGB
 constexpr Enum kRgba = 0x1908;  // GL_RGBA
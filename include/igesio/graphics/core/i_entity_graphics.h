@@ -8,7 +8,9 @@
 #ifndef IGESIO_GRAPHICS_CORE_I_ENTITY_GRAPHICS_H_
 #define IGESIO_GRAPHICS_CORE_I_ENTITY_GRAPHICS_H_
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -25,6 +27,7 @@
 #include "igesio/graphics/core/material_property.h"
 #include "igesio/graphics/core/ray.h"
 #include "igesio/graphics/core/draw_context.h"
+#include "igesio/graphics/core/level_of_detail.h"
 #include "igesio/graphics/core/shader_id.h"
 
 
@@ -218,6 +221,13 @@ class IEntityGraphics {
     virtual void Draw(gl::Uint, const std::pair<float, float>&,
                       const DrawContext&) const = 0;
 
+    /// @brief 描画時のビューから、描画する詳細度 (LOD) のレベルを選択する
+    /// @param view 描画時のビュー (カメラの行列・ビューポート・選択パラメータ)
+    /// @note 複数のLODレベルを持つクラス (ISurfaceGraphics等) がオーバーライドし、
+    ///       次回以降のDrawで描くレベルを切り替える. GLは呼ばない.
+    ///       レンダラが毎フレーム、描画の直前に呼ぶ. デフォルト実装は何もしない
+    virtual void SelectLevelOfDetail(const LodView&) {}
+
     /// @brief エンティティをセットアップする (NVI; 非virtual)
     /// @note 内部で参照するエンティティの状態に基づいて、描画用のリソースを
     ///       再セットアップ (DoSynchronize) し、末尾で同期キーを記録する.
@@ -390,6 +400,41 @@ class IEntityGraphics {
     /// @note ピッキング時の代表深度の算出に用いる
     /// @note エンティティ由来でGPU生成物に依存しない (GPU転送なしで成立)。
     virtual std::optional<numerics::BoundingBox> GetWorldBoundingBox() const = 0;
+
+    /// @brief ワールド座標系における軸平行バウンディングボックスを取得する
+    /// @return {最小点, 最大点}. 有限のBBを定義できない場合はstd::nullopt
+    /// @note ピッキング・範囲選択の広域判定 (シーンBVH) に用いるため、
+    ///       エンティティ全体を包含する保守的な範囲であればよい.
+    ///       GetWorldBoundingBoxと異なり、点・直線状に退化したBBや
+    ///       回転でないワールド変換でも範囲を返すことが望ましい
+    /// @note デフォルト実装はGetWorldBoundingBoxの頂点を包含する範囲を返す
+    virtual std::optional<std::pair<Vector3d, Vector3d>>
+    GetWorldAxisAlignedBounds() const {
+        const auto bb = GetWorldBoundingBox();
+        if (!bb) return std::nullopt;
+        return AxisAlignedBoundsOf(bb->GetFiniteVertices());
+    }
+
+
+
+ protected:
+    /// @brief 点群を包含する軸平行バウンディングボックスを求める
+    /// @param points 点群
+    /// @return {最小点, 最大点}. 点群が空の場合、または非有限の成分を含む場合は
+    ///         std::nullopt
+    static std::optional<std::pair<Vector3d, Vector3d>>
+    AxisAlignedBoundsOf(const std::vector<Vector3d>& points) {
+        if (points.empty()) return std::nullopt;
+        Vector3d lower = points.front(), upper = points.front();
+        for (const auto& p : points) {
+            for (int axis = 0; axis < 3; ++axis) {
+                if (!std::isfinite(p[axis])) return std::nullopt;
+                lower[axis] = std::min(lower[axis], p[axis]);
+                upper[axis] = std::max(upper[axis], p[axis]);
+            }
+        }
+        return std::make_pair(lower, upper);
+    }
 };
 
 }  // namespace igesio::graphics
@@ -0,0 +1,159 @@
+/**
+ * @file graphics/core/level_of_detail.h
+ * @brief 面メッシュの詳細度 (LOD) の構築と、画面上の大きさによる選択
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note GLに依存しない純粋な処理 (単体テスト可能)。
+ *
+ * @details
+ * 面の描画クラス (ISurfaceGraphics / RestrictedSurfaceGraphics) は、許容量を
+ * 段階的に粗くした複数のメッシュ (LODレベル) を1つの頂点・インデックス列へ
+ * 連結して転送し、描画時にレベルに対応するインデックス範囲のみを描く。
+ *
+ * レベルは、弦高の許容量の外接球の直径に対する比 (相対誤差) を持つ。
+ * 描画時には外接球の画面上の直径 [px] を見積もり (EstimateProjectedSize)、
+ * 画面上の誤差 (相対誤差 × 直径) が許容量を超えない最も粗いレベルを選ぶ
+ * (SelectLodLevel)。ズーム操作で境界付近を往復した際にレベルが頻繁に
+ * 切り替わらない (ポッピングしない) よう、切り替えにはヒステリシスを設ける。
+ */
+#ifndef IGESIO_GRAPHICS_CORE_LEVEL_OF_DETAIL_H_
+#define IGESIO_GRAPHICS_CORE_LEVEL_OF_DETAIL_H_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/graphics/core/gl_types.h"
+
+
+
+namespace igesio::graphics {
+
+/// @brief 画面上の誤差の許容量の既定値 [px]
+inline constexpr double kDefaultLodScreenError = 1.0;
+/// @brief レベルを切り替える際のヒステリシスの既定値 (許容量に対する比)
+/// @note 粗いレベルへは誤差が許容量/(1+h)以下となるまで切り替えず、細かい
+///       レベルへは誤差が許容量×(1+h)を超えるまで切り替えない
+inline constexpr double kDefaultLodHysteresis = 0.25;
+
+/// @brief LODレベルの選択パラメータ
+struct LodSelectionParams {
+    /// @brief LODによる描画を有効にするか (無効の場合は常に最も細かいレベル)
+    bool enabled = true;
+    /// @brief [px] 画面上の誤差の許容量
+    double max_screen_error = kDefaultLodScreenError;
+    /// @brief ヒステリシス (許容量に対する比. 0以上)
+    double hysteresis = kDefaultLodHysteresis;
+};
+
+/// @brief 描画時のビュー (LODレベルの選択に用いる)
+struct LodView {
+    /// @brief ビュー行列
+    Matrix4f view = Matrix4f::Identity();
+    /// @brief 投影行列
+    Matrix4f projection = Matrix4f::Identity();
+    /// @brief [px] ビューポートの高さ
+    float viewport_height = 0.0f;
+    /// @brief 選択パラメータ
+    LodSelectionParams params;
+};
+
+/// @brief 1つのLODレベル (連結したインデックス列内の範囲)
+struct LodLevel {
+    /// @brief インデックス列内の先頭位置
+    std::size_t index_offset = 0;
+    /// @brief インデックス数
+    std::size_t index_count = 0;
+    /// @brief 弦高の許容量の、外接球の直径に対する比
+    double relative_error = 0.0;
+};
+
+/// @brief LOD付きメッシュのステージング (GPU転送前のCPUデータ)
+struct LodMeshStaging {
+    /// @brief 全レベルのinterleaved頂点列 (頂点あたり {x, y, z, nx, ny, nz, u, v})
+    std::vector<float> vertices;
+    /// @brief 全レベルのインデックス列 (頂点番号はvertices全体に対する)
+    std::vector<gl::Uint> indices;
+    /// @brief 各レベル (細かい順)
+    std::vector<LodLevel> levels;
+    /// @brief 最も細かいレベルの外接球の中心 (メッシュの座標系)
+    Vector3d center = Vector3d::Zero();
+    /// @brief 最も細かいレベルの外接球の半径 (空の場合は0)
+    double radius = 0.0;
+
+    /// @brief 全てのデータを破棄する
+    void Clear() { *this = LodMeshStaging(); }
+};
+
+/// @brief LODレベルを追加する
+/// @param staging 追加先
+/// @param mesh 追加するメッシュ (既存のレベルより粗い許容量で生成したもの)
+/// @param relative_error meshの弦高の許容量の、外接球の直径に対する比
+/// @note 最初に追加したメッシュから外接球を求める
+/// @note 追加前にメッシュを描画向けに並べ替える (numerics::OptimizeForRendering)
+/// @note meshの三角形数が直前のレベル以上の場合は追加せず、直前のレベルの
+///       相対誤差をrelative_errorへ引き上げる (細かいメッシュは粗い許容量も満たす)
+void AppendLodLevel(LodMeshStaging& staging, const numerics::TriangleMeshf& mesh,
+                    const double relative_error);
+
+/// @brief 描画クラスが保持するLODの状態
+struct LodDrawState {
+    /// @brief 各レベル (細かい順. 転送済みのインデックス列内の範囲)
+    std::vector<LodLevel> levels;
+    /// @brief 描画するレベル
+    std::size_t current = 0;
+    /// @brief 外接球の中心 (メッシュの座標系)
+    Vector3d center = Vector3d::Zero();
+    /// @brief 外接球の半径
+    double radius = 0.0;
+
+    /// @brief ステージングのレベル・外接球を引き継ぐ (選択中のレベルは維持する)
+    void Assign(const LodMeshStaging& staging) {
+        levels = staging.levels;
+        center = staging.center;
+        radius = staging.radius;
+        if (current >= levels.size()) current = 0;
+    }
+
+    /// @brief 描画時のビューからレベルを選択する
+    /// @param view 描画時のビュー
+    /// @param world_transform メッシュの座標系からワールド座標系への変換行列
+    void Select(const LodView& view, const Matrix4d& world_transform);
+
+    /// @brief 描画するインデックス列内の範囲を返す
+    /// @param index_count 転送済みのインデックス数 (レベルが無い場合に全体を描く)
+    /// @return {先頭位置, インデックス数}
+    std::pair<std::size_t, std::size_t> CurrentRange(
+            const std::size_t index_count) const {
+        if (current >= levels.size()) return {0, index_count};
+        return {levels[current].index_offset, levels[current].index_count};
+    }
+};
+
+/// @brief 外接球の画面上の直径を見積もる
+/// @param view 描画時のビュー
+/// @param world_transform 外接球の座標系からワールド座標系への変換行列
+/// @param center 外接球の中心
+/// @param radius 外接球の半径
+/// @return [px] 画面上の直径. 視点が外接球の内側または背後にある場合は無限大
+double EstimateProjectedSize(const LodView& view, const Matrix4d& world_transform,
+                             const Vector3d& center, const double radius);
+
+/// @brief 画面上の大きさからLODレベルを選択する
+/// @param levels 各レベル (細かい順)
+/// @param projected_size [px] 外接球の画面上の直径
+/// @param current 現在のレベル
+/// @param params 選択パラメータ
+/// @return 選択したレベル. levelsが空、またはLODが無効の場合は0
+/// @note 画面上の誤差 (relative_error × projected_size) が許容量以下の最も粗い
+///       レベルを選ぶ. ただし、現在のレベルからの切り替えにはヒステリシスを設ける
+std::size_t SelectLodLevel(const std::vector<LodLevel>& levels,
+                           const double projected_size, const std::size_t current,
+                           const LodSelectionParams& params = {});
+
+}  // namespace igesio::graphics
+
+#endif  // IGESIO_GRAPHICS_CORE_LEVEL_OF_DETAIL_H_
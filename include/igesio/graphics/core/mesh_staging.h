@@ -8,15 +8,19 @@
  *       メッシュを、汎用曲面シェーダー (ShaderId::kGeneralSurface) の
  *       頂点レイアウトへinterleaveする。転送系の描画クラス
  *       (ISurfaceGraphics / RestrictedSurfaceGraphics / TriangleMeshGraphics)
- *       が共用する。
+ *       が共用する。インデックス列は、頂点数が16ビットに収まる場合は
+ *       16ビットへ詰めて転送量を半減する (PackIndices)。
  */
 #ifndef IGESIO_GRAPHICS_CORE_MESH_STAGING_H_
 #define IGESIO_GRAPHICS_CORE_MESH_STAGING_H_
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 
 #include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/graphics/core/gl_types.h"
 
 
 
@@ -57,6 +61,51 @@ std::vector<float> BuildInterleavedVertices(
     return interleaved;
 }
 
+/// @brief 16ビットのインデックスで表せる頂点数の上限 (この値未満)
+inline constexpr std::size_t kShortIndexVertexLimit = 65536;
+
+/// @brief GPU転送用に詰めたインデックス列
+struct PackedIndices {
+    /// @brief 要素の型 (gl::kUnsignedShort / gl::kUnsignedInt)
+    gl::Enum type = gl::kUnsignedInt;
+    /// @brief インデックス数
+    std::size_t count = 0;
+    /// @brief 詰めたインデックス列 (count * IndexSize() バイト)
+    std::vector<std::uint8_t> bytes;
+
+    /// @brief 1要素のバイト数
+    std::size_t IndexSize() const {
+        return (type == gl::kUnsignedShort) ? sizeof(std::uint16_t)
+                                            : sizeof(std::uint32_t);
+    }
+};
+
+/// @brief インデックス列を、頂点数に応じた最小の型 (16/32ビット) へ詰める
+/// @param indices インデックス列 (各値はvertex_count未満であること)
+/// @param vertex_count 頂点数
+/// @return 詰めたインデックス列. vertex_countがkShortIndexVertexLimit未満なら16ビット
+/// @note プリミティブリスタートは使用しないため、16ビットでも0xFFFFを頂点番号に使える
+template <typename Index>
+PackedIndices PackIndices(const std::vector<Index>& indices,
+                          const std::size_t vertex_count) {
+    PackedIndices packed;
+    packed.type = (vertex_count < kShortIndexVertexLimit)
+            ? gl::kUnsignedShort : gl::kUnsignedInt;
+    packed.count = indices.size();
+    packed.bytes.resize(packed.count * packed.IndexSize());
+    for (std::size_t i = 0; i < packed.count; ++i) {
+        std::uint8_t* dst = packed.bytes.data() + i * packed.IndexSize();
+        if (packed.type == gl::kUnsignedShort) {
+            const auto value = static_cast<std::uint16_t>(indices[i]);
+            std::memcpy(dst, &value, sizeof(value));
+        } else {
+            const auto value = static_cast<std::uint32_t>(indices[i]);
+            std::memcpy(dst, &value, sizeof(value));
+        }
+    }
+    return packed;
+}
+
 }  // namespace igesio::graphics
 
 #endif  // IGESIO_GRAPHICS_CORE_MESH_STAGING_H_
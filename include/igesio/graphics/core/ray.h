@@ -62,6 +62,10 @@ struct RayIntersectionParams {
     /// @note Intersectが消費する。ピッキング経路ではPickEntitiesが
     ///       エンティティ毎に上書きするため、手設定は基本不要
     double curve_hit_tolerance = 1.0;
+    /// @brief 最も近いヒットのみを求めるか
+    /// @note trueの場合、PickEntitiesはシーンBVHを手前から走査し、既知の最近傍
+    ///       より奥のエンティティの判定を打ち切る (戻り値は高々1件)
+    bool closest_hit_only = false;
 };
 
 /// @brief スクリーン空間の矩形領域 [px]（左上原点・GLFW準拠）
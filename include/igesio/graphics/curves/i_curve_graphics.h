@@ -6,6 +6,7 @@
  * @copyright 2025 Yayoi Habami
  * @brief このクラスは、ICurveを継承した全エンティティの描画を行う。
  *        曲線のパラメータ範囲で離散化を行い、OpenGLのVAOとVBOを使用して描画する。
+ *        離散化は許容量に基づく適応的な折れ線化 (entities::DiscretizeCurve) による。
  */
 #ifndef IGESIO_GRAPHICS_CURVES_I_CURVE_GRAPHICS_H_
 #define IGESIO_GRAPHICS_CURVES_I_CURVE_GRAPHICS_H_
@@ -14,6 +15,7 @@
 #include <utility>
 
 #include "igesio/entities/interfaces/i_curve.h"
+#include "igesio/entities/curves/algorithms/curve_discretization.h"
 #include "igesio/graphics/core/entity_graphics.h"
 
 
@@ -67,6 +69,8 @@ class ICurveGraphics
     /// @brief エンティティをセットアップする
     /// @note 内部で参照するエンティティの状態に基づいて、
     ///       描画用のリソースを再セットアップする
+    /// @note 曲線はGetDisplayCurveToleranceの許容量で折れ線化する
+    ///       (直線部は分割せず、曲率の大きい区間のみを細分する)
     void DoSynchronize() override;
 
 
@@ -79,6 +83,15 @@ class ICurveGraphics
             gl::Uint, [[maybe_unused]] const std::pair<float, float>&) const override;
 };
 
+/// @brief 描画用の曲線の折れ線化の許容量を、曲線の大きさから求める
+/// @param curve 対象の曲線
+/// @return 弦高をバウンディングボックスの対角線長のkDisplayChordRatio倍、
+///         角度をkDisplayAngleとした許容量 (詳細度0の曲面の描画と同じ;
+///         GetDisplayTessellationTolerance). バウンディングボックスが
+///         有限でない場合は角度のみを指定する
+entities::TessellationTolerance GetDisplayCurveTolerance(
+        const entities::ICurve& curve);
+
 }  // namespace igesio::graphics
 
 #endif  // IGESIO_GRAPHICS_CURVES_I_CURVE_GRAPHICS_H_
@@ -17,6 +17,7 @@
 
 #include "igesio/entities/meshes/mesh_entity.h"
 #include "igesio/graphics/core/entity_graphics.h"
+#include "igesio/graphics/core/mesh_staging.h"
 #include "igesio/graphics/core/surface_edge_buffer.h"
 
 
@@ -91,6 +92,8 @@ class TriangleMeshGraphics
     gl::Uint ebo_ = 0;
     /// @brief 転送済みのインデックス数 (DrawElements用)
     int index_count_ = 0;
+    /// @brief 転送済みのインデックスの型 (DrawElements用)
+    gl::Enum index_type_ = gl::kUnsignedInt;
 
     /// @brief 全ユニークエッジの線分バッファ (kWireFrame表示用)
     SurfaceEdgeBuffer all_edge_buffer_;
@@ -100,8 +103,8 @@ class TriangleMeshGraphics
     /// @brief CPUステージング: interleaved頂点 (8つのfloat/頂点)
     /// @note Cleanupでは破棄しない (PrewarmCpuの結果を保持する)
     std::vector<float> staging_vertices_;
-    /// @brief CPUステージング: 三角形インデックス
-    std::vector<gl::Uint> staging_indices_;
+    /// @brief CPUステージング: 三角形インデックス (16/32ビットへ詰めたもの)
+    PackedIndices staging_indices_;
     /// @brief CPUステージング: 全エッジの線分頂点列 (Cleanupでは破棄しない)
     std::vector<float> staging_all_edges_;
     /// @brief CPUステージング: 特徴エッジの線分頂点列 (Cleanupでは破棄しない)
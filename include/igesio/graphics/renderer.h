@@ -9,6 +9,7 @@
 #define IGESIO_GRAPHICS_RENDERER_H_
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -21,12 +22,14 @@
 #include "igesio/common/errors.h"
 #include "igesio/entities/interfaces/i_entity_identifier.h"
 #include "igesio/models/scene.h"
+#include "igesio/numerics/geometric/bvh.h"
 #include "igesio/graphics/core/i_open_gl.h"
 #include "igesio/graphics/core/camera.h"
 #include "igesio/graphics/core/draw_context.h"
 #include "igesio/graphics/core/light.h"
 #include "igesio/graphics/core/texture.h"
 #include "igesio/graphics/core/i_entity_graphics.h"
+#include "igesio/graphics/core/level_of_detail.h"
 #include "igesio/graphics/core/ray.h"
 #include "igesio/graphics/core/shader_code.h"
 #include "igesio/graphics/factory.h"
@@ -68,6 +71,9 @@ struct GraphicsSettings {
     bool enable_transparency = false;
     /// @brief 表示モード (面/面エッジの描画組み合わせ)
     DisplayMode display_mode = DisplayMode::kShaded;
+    /// @brief 面の詳細度 (LOD) の選択パラメータ
+    /// @note 毎フレーム、面の画面上の大きさからLODレベルを選択する
+    LodSelectionParams lod;
 };
 
 /// @brief 表示フィルタ (レンダラ単位のビュー状態)
@@ -202,6 +208,20 @@ class EntityRenderer {
     /// @note 構造再構築 (visible_list_変化) またはCPU準備 (PrewarmCpu) で
     ///       シェーダー型集合が変わりうる時に立てる. 変化が無い間はバケットを再利用する
     bool draw_buckets_dirty_ = true;
+    /// @brief ピック・範囲選択の広域判定に用いるシーンBVH
+    /// @note visible_list_の各要素のワールド軸平行BB
+    ///       (GetWorldAxisAlignedBounds) から構築する. プリミティブ番号は
+    ///       pick_bounded_の添字
+    numerics::Bvh pick_bvh_;
+    /// @brief pick_bvh_の各プリミティブに対応するvisible_list_の添字
+    std::vector<std::size_t> pick_bounded_;
+    /// @brief 有限な軸平行BBを持たないvisible_list_の添字 (常に狭域判定する)
+    std::vector<std::size_t> pick_unbounded_;
+    /// @brief pick_bvh_構築時のvisible_list_各要素の同期キー (CurrentGeometryKey)
+    std::vector<uint64_t> pick_bvh_keys_;
+    /// @brief pick_bvh_の再構築が必要か
+    /// @note 構造再構築 (visible_list_変化) で立てる. 形状変化は同期キーで検知する
+    bool pick_bvh_dirty_ = true;
     /// @brief 表示フィルタ (ビュー状態)
     DisplayFilter display_filter_;
     /// @brief エンティティ毎の描画プロパティのオーバーライド
@@ -438,8 +458,11 @@ class EntityRenderer {
     /// @param screen_x 曲線ヒットのピクセル換算に使う基準スクリーンx座標 [px]
     /// @param screen_y 曲線ヒットのピクセル換算に使う基準スクリーンy座標 [px]
     /// @param params 探索制御パラメータ
-    /// @return distance昇順のヒットリスト（重複除去済み）
+    /// @return distance昇順のヒットリスト（重複除去済み）.
+    ///         params.closest_hit_onlyがtrueの場合は最も近いヒットのみ
     /// @note 曲線ヒット許容量はエンティティ毎の代表深度でピクセル換算される
+    /// @note シーンBVHでレイ (曲線ヒット許容量だけ拡大) と交差しうるエンティティ
+    ///       に絞り込んでから狭域判定 (Intersect) を行う
     std::vector<EntityHit> PickEntities(
             const Ray&, double screen_x, double screen_y,
             const RayIntersectionParams& = {});
@@ -449,7 +472,8 @@ class EntityRenderer {
     /// @param mode 判定種別（内包／交差）
     /// @param params サンプリング制御パラメータ
     /// @return 条件を満たすエンティティIDのリスト（順不同）
-    /// @note 粗カリングはBBのスクリーンAABBがrectと重なるかのみで行う（保守的）
+    /// @note 粗カリングはシーンBVHのノードを矩形の視錐台で枝刈りした後、
+    ///       BBのスクリーンAABBがrectと重なるかで行う（いずれも保守的）
     /// @note kOblique投影モードでは正しい結果を返さない (TODO: 未対応)
     std::vector<ObjectID> PickEntitiesInRect(
             const ScreenRect&, BoxSelectionMode,
@@ -550,6 +574,12 @@ class EntityRenderer {
     ///       準備対象があればdraw_buckets_dirty_を立てる.
     void PrepareCpuGeometries();
 
+    /// @brief ピック用のシーンBVH (pick_bvh_) をvisible_list_と突き合わせる
+    /// @note PickEntities/PickEntitiesInRectの冒頭 (PrepareCpuGeometries後) で呼ぶ.
+    ///       pick_bvh_dirty_が立っている場合、または要素のいずれかの同期キーが
+    ///       構築時から変化した場合に再構築する. 変化が無い間は再利用する
+    void EnsurePickBvh();
+
     /// @brief 可視エンティティのジオメトリをGPUへ再同期する (GPU相)
     /// @note Drawの冒頭 (PrepareCpuGeometries後) で呼ぶ. visible_list_の各要素について
     ///       同期キーの不一致 (NeedsResync) を検査し、Synchronize()でGPU転送する.
@@ -607,6 +637,10 @@ class EntityRenderer {
                       const std::optional<std::array<float, 3>>& inherited_color,
                       const std::optional<float>& inherited_opacity);
 
+    /// @brief 可視リストの各描画オブジェクトの詳細度 (LOD) を現在のカメラで選択する
+    /// @note GLは呼ばない. Draw毎に描画リストの実行前に呼ぶ
+    void SelectLevelsOfDetail();
+
     /// @brief キャッシュした描画リストをシェーダー単位で描画する
     /// @param ctx 表示コンテキスト (選択ハイライト等をPULLする)
     void ExecuteDrawList(const DrawContext& ctx);
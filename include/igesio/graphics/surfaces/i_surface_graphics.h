@@ -8,6 +8,7 @@
 #ifndef IGESIO_GRAPHICS_SURFACES_I_SURFACE_GRAPHICS_H_
 #define IGESIO_GRAPHICS_SURFACES_I_SURFACE_GRAPHICS_H_
 
+#include <cstddef>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -15,6 +16,8 @@
 
 #include "igesio/entities/interfaces/i_surface.h"
 #include "igesio/graphics/core/entity_graphics.h"
+#include "igesio/graphics/core/level_of_detail.h"
+#include "igesio/graphics/core/mesh_staging.h"
 #include "igesio/graphics/core/surface_edge_buffer.h"
 
 
@@ -29,9 +32,12 @@ class ISurfaceGraphics
     gl::Uint ebo_ = 0;
 
     /// @brief 面のinterleaved頂点列 (頂点あたり {x, y, z, nx, ny, nz, u, v})
+    /// @note 全LODレベルの頂点を連結したもの
     std::vector<float> vertices_;
-    /// @brief 面のインデックスデータ
-    std::vector<gl::Uint> indices_;
+    /// @brief 面のインデックスデータ (全LODレベルを連結し、16/32ビットへ詰めたもの)
+    PackedIndices indices_;
+    /// @brief LODレベルと、描画するレベル
+    LodDrawState lod_;
     /// @brief 境界エッジ (パラメータ矩形の4アイソ辺) の線分バッファ
     SurfaceEdgeBuffer edge_buffer_;
 
@@ -96,6 +102,17 @@ class ISurfaceGraphics
     /// @note SSBO等のOpenGLリソースを解放する
     void Cleanup() override;
 
+    /// @brief 描画時のビューから、描画するLODレベルを選択する
+    void SelectLevelOfDetail(const LodView& view) override {
+        lod_.Select(view, GetWorldTransformD());
+    }
+
+    /// @brief 描画するLODレベル (0が最も細かい)
+    std::size_t GetCurrentLodLevel() const { return lod_.current; }
+
+    /// @brief LODレベルの数 (同期前は0)
+    std::size_t GetLodLevelCount() const { return lod_.levels.size(); }
+
  protected:
     /// @brief エンティティの描画を行う
     /// @param shader プログラムシェーダーのID
@@ -103,6 +120,7 @@ class ISurfaceGraphics
     void DrawImpl(gl::Uint, const std::pair<float, float>&) const override;
 
     /// @brief 描画用の頂点/法線データとインデックスデータを生成する
+    /// @note kDisplayLodLevelCount段階の許容量で生成し、LODレベルとして連結する
     void GenerateSurfaceData();
 };
 
@@ -8,6 +8,7 @@
 #ifndef IGESIO_GRAPHICS_SURFACES_RESTRICTED_SURFACE_GRAPHICS_H_
 #define IGESIO_GRAPHICS_SURFACES_RESTRICTED_SURFACE_GRAPHICS_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <unordered_set>
@@ -17,6 +18,8 @@
 #include "igesio/numerics/core/matrix.h"
 #include "igesio/entities/interfaces/i_restricted_surface.h"
 #include "igesio/graphics/core/entity_graphics.h"
+#include "igesio/graphics/core/level_of_detail.h"
+#include "igesio/graphics/core/mesh_staging.h"
 #include "igesio/graphics/core/surface_edge_buffer.h"
 
 
@@ -27,7 +30,9 @@ namespace igesio::graphics {
 /// @note Type 144 (TrimmedSurface)、Type 143 (BoundedSurface)、Type 108の有界平面
 ///       (BoundedPlane) を共通に扱う。メッシュ生成は制限付き曲面共通のテッセレーション
 ///       (entities::TessellateRestrictedSurface) に委譲する。境界駆動の制限付き
-///       四分木により、トリム境界近傍を適応的に細分する。
+///       四分木により、トリム境界近傍と、曲面の大きさに応じた許容量
+///       (GetDisplayTessellationTolerance) を満たさない曲率の大きい領域を
+///       適応的に細分する。
 class RestrictedSurfaceGraphics
     : public EntityGraphics<entities::IRestrictedSurface, true> {
     /// @brief 面のVBO
@@ -36,9 +41,12 @@ class RestrictedSurfaceGraphics
     gl::Uint ebo_ = 0;
 
     /// @brief 面のinterleaved頂点列 (頂点あたり {x, y, z, nx, ny, nz, tu, tv})
+    /// @note 全LODレベルの頂点を連結したもの
     std::vector<float> vertices_;
-    /// @brief 面のインデックスデータ
-    std::vector<gl::Uint> indices_;
+    /// @brief 面のインデックスデータ (全LODレベルを連結し、16/32ビットへ詰めたもの)
+    PackedIndices indices_;
+    /// @brief LODレベルと、描画するレベル
+    LodDrawState lod_;
     /// @brief 境界エッジ (外周/内周トリム境界) の線分バッファ
     SurfaceEdgeBuffer edge_buffer_;
 
@@ -46,9 +54,7 @@ class RestrictedSurfaceGraphics
     /// @note GL転送前のCPU側データ。前倒しテッセレーション結果をシェーダー
     ///       レイアウトへinterleaveしてここへ置き、DoSynchronize (GLスレッド) が
     ///       vertices_/indices_へ移してGPUへ転送する。
-    std::vector<float> pending_vertices_;
-    /// @brief 三角形インデックスのステージング
-    std::vector<gl::Uint> pending_indices_;
+    LodMeshStaging pending_mesh_;
     /// @brief 境界エッジループ (モデル空間の折れ線群) のステージング
     std::vector<std::vector<Vector3d>> pending_edge_loops_;
     /// @brief pending_*が現在の幾何キーで構築済みか (冪等判定用)
@@ -108,8 +114,9 @@ class RestrictedSurfaceGraphics
 
     /// @brief 描画用CPUデータ (テッセレーション+interleave・境界エッジ) を事前構築する
     /// @note GL呼び出しを含まないため、レンダラから並列に呼べる。結果は
-    ///       pending_vertices_/pending_indices_/pending_edge_loops_へ格納する。
-    ///       同一同期キーでは再構築しない。
+    ///       pending_mesh_/pending_edge_loops_へ格納する。
+    ///       面はkDisplayLodLevelCount段階の許容量でテッセレーションし、
+    ///       LODレベルとして連結する。同一同期キーでは再構築しない。
     void PrewarmCpu() override;
 
     /// @brief エンティティをセットアップする (GL転送)
@@ -120,6 +127,17 @@ class RestrictedSurfaceGraphics
     /// @brief OpenGLリソースを解放する
     void Cleanup() override;
 
+    /// @brief 描画時のビューから、描画するLODレベルを選択する
+    void SelectLevelOfDetail(const LodView& view) override {
+        lod_.Select(view, GetWorldTransformD());
+    }
+
+    /// @brief 描画するLODレベル (0が最も細かい)
+    std::size_t GetCurrentLodLevel() const { return lod_.current; }
+
+    /// @brief LODレベルの数 (同期前は0)
+    std::size_t GetLodLevelCount() const { return lod_.levels.size(); }
+
     /// @brief 範囲選択用に制限付き曲面をサンプリングする
     /// @param params サンプリング制御パラメータ
     /// @return トリム境界(外周/内周)の閉ループ折れ線と、トリム領域内の内部グリッド点
@@ -137,13 +155,13 @@ class RestrictedSurfaceGraphics
  private:
     /// @brief UV境界曲線を基底曲面S(u,v)で3D化したワールド折れ線をresultへ追加する
     /// @param uv_boundary UV空間の境界曲線 (TryGetPointAtが(u,v,0)を返す)
-    /// @param n_samples サンプル分割数
+    /// @param params サンプリング制御パラメータ (curve_samplesを初期分割数とする)
     /// @param result 追加先 (polylinesへ折れ線を追加)
     /// @note GetOuterUVBoundary()等はUV空間の曲線を返すため、選択用の3D点を得るには
     ///       基底曲面で評価する必要がある。トリム境界はドメイン端のため、ドメイン制限を
     ///       受けない基底S(u,v)で評価し、配置(M_entity込みのワールド変換)を適用する
     void AppendBoundaryWorldPolyline(
-            const entities::ICurve& uv_boundary, int n_samples,
+            const entities::ICurve& uv_boundary, const SelectionSampleParams& params,
             SelectionSamples& result) const;
 };
 
@@ -11,8 +11,10 @@
 #ifndef IGESIO_GRAPHICS_SURFACES_SURFACE_MESH_H_
 #define IGESIO_GRAPHICS_SURFACES_SURFACE_MESH_H_
 
+#include "igesio/numerics/geometric/bounding_box.h"
 #include "igesio/numerics/meshes/triangle_mesh.h"
 #include "igesio/entities/interfaces/i_surface.h"
+#include "igesio/entities/surfaces/algorithms/surface_tessellation_tolerance.h"
 
 
 
@@ -25,7 +27,7 @@ struct GeneralSurfaceMesh {
     numerics::TriangleMeshf mesh;
     /// @brief uサンプル行数 (折れ目の二重化を含む実際の行数)
     int u_row_count = 0;
-    /// @brief v方向分割数
+    /// @brief v方向分割数 (v方向の頂点数 - 1)
     int v_div = 0;
 };
 
@@ -41,6 +43,55 @@ struct GeneralSurfaceMesh {
 GeneralSurfaceMesh BuildGeneralSurfaceMesh(
         const entities::ISurface& surface, int u_div, int v_div);
 
+/// @brief 許容量に基づく適応的な格子で、汎用曲面の三角形メッシュを生成する
+/// @param surface 対象の曲面
+/// @param tolerance 弦高・角度・最大辺長の許容量
+/// @param max_depth 各方向の初期区間を2分割する回数の上限
+/// @return 生成したメッシュデータ
+/// @note u・v方向それぞれの分割点をentities::ComputeAdaptiveStationsで決め、
+///       そのテンソル積格子を張る (曲率の大きいu (v) の範囲にのみ行 (列) を
+///       集める). 折れ目・退化点の扱いは一様分割の場合と同じ.
+///       toleranceが無効の場合はentities::kAdaptiveInitialIntervals等分の格子となる
+GeneralSurfaceMesh BuildGeneralSurfaceMesh(
+        const entities::ISurface& surface,
+        const entities::TessellationTolerance& tolerance, int max_depth = 6);
+
+/// @brief 描画用のテッセレーションの許容量を、曲面の大きさから求める
+/// @param surface 対象の曲面
+/// @param lod_level 詳細度 (LOD) のレベル (0が最も細かい)
+/// @return 弦高をバウンディングボックスの対角線長のGetDisplayLodRelativeError倍、
+///         角度をkDisplayAngleのkDisplayLodChordScale^(lod_level/2)倍
+///         (kDisplayLodMaxAngleで上限) とした許容量. バウンディングボックスが
+///         有限でない場合は角度のみを指定する
+entities::TessellationTolerance GetDisplayTessellationTolerance(
+        const entities::ISurface& surface, int lod_level = 0);
+
+/// @brief 描画用のテッセレーションの許容量を、バウンディングボックスの大きさから求める
+/// @param bb 対象のバウンディングボックス
+/// @param lod_level 詳細度 (LOD) のレベル (0が最も細かい)
+/// @return GetDisplayTessellationTolerance(const entities::ISurface&, int) と同じ規則の
+///         許容量. 曲線の折れ線化 (GetDisplayCurveTolerance) と共通に用いる
+entities::TessellationTolerance GetDisplayTessellationTolerance(
+        const numerics::BoundingBox& bb, int lod_level = 0);
+
+/// @brief 描画用の弦高の許容量の、バウンディングボックスの対角線長に対する比
+/// @param lod_level 詳細度 (LOD) のレベル (0が最も細かい)
+/// @return kDisplayChordRatio * kDisplayLodChordScale^lod_level
+double GetDisplayLodRelativeError(int lod_level);
+
+/// @brief 描画用の弦高の許容量の、バウンディングボックスの対角線長に対する比
+inline constexpr double kDisplayChordRatio = 1e-3;
+/// @brief 描画用の角度の許容量 [rad] (15度)
+inline constexpr double kDisplayAngle = 0.2617993877991494;
+
+/// @brief 描画用に生成する詳細度 (LOD) のレベル数
+inline constexpr int kDisplayLodLevelCount = 4;
+/// @brief LODのレベルが1段粗くなるごとに弦高の許容量に掛ける倍率
+/// @note 弦高は角度の2乗に比例するため、角度の許容量にはこの平方根を掛ける
+inline constexpr double kDisplayLodChordScale = 4.0;
+/// @brief LODの角度の許容量の上限 [rad] (90度)
+inline constexpr double kDisplayLodMaxAngle = 1.5707963267948966;
+
 }  // namespace igesio::graphics
 
 #endif  // IGESIO_GRAPHICS_SURFACES_SURFACE_MESH_H_
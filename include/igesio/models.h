@@ -18,6 +18,13 @@
 #include "igesio/models/assembly.h"
 #include "igesio/models/flatten.h"
 
+// アセンブリに対するヘッドレスなレイキャスト・クリアランス計算
+#include "igesio/models/ray_caster.h"
+#include "igesio/models/clearance.h"
+
+// アセンブリの曲面の隙間のないメッシュ化
+#include "igesio/models/tessellation.h"
+
 // IGESデータ (トップレベルコンテナ)
 #include "igesio/models/iges_data.h"
 
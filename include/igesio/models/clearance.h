@@ -0,0 +1,78 @@
+/**
+ * @file models/clearance.h
+ * @brief Assembly内のエンティティ間のクリアランス (最短距離) の一括計算
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 部品間の干渉・クリアランス検査を想定し、Assemblyの曲線・曲面の全ての組に
+ *       ついてワールド空間の最短距離を求める. ワールド空間のバウンディングボックスの
+ *       BVHで、max_distanceより離れた組を狭域判定 (entities::MinimumDistancePairs)
+ *       の前に除く.
+ */
+#ifndef IGESIO_MODELS_CLEARANCE_H_
+#define IGESIO_MODELS_CLEARANCE_H_
+
+#include <limits>
+#include <vector>
+
+#include "igesio/common/id_generator.h"
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/surfaces/algorithms/minimum_distance.h"
+#include "igesio/models/assembly.h"
+
+
+
+namespace igesio::models {
+
+/// @brief クリアランス計算のパラメータ
+struct ClearanceParams {
+    /// @brief [モデル単位] この距離以下の組のみを返す
+    /// @note 有限値を指定すると、ワールド空間のバウンディングボックスの距離が
+    ///       これを超える組を狭域判定の前に除く. 無限大 (既定) では全ての組を計算する
+    double max_distance = std::numeric_limits<double>::infinity();
+    /// @brief 曲線を対象とするか
+    bool include_curves = true;
+    /// @brief 曲面を対象とするか
+    bool include_surfaces = true;
+    /// @brief 同じAssemblyに直接属するエンティティ同士の組を除くか
+    /// @note trueの場合、異なる部品 (Assembly) 間のクリアランスのみを求める
+    bool skip_same_assembly = false;
+    /// @brief 各組の最短距離の探索制御パラメータ
+    /// @note 許容量 (tolerance, chord_tolerance) はワールド空間の長さとして扱う
+    entities::MinimumDistanceParams distance;
+};
+
+/// @brief 2つのエンティティ間のクリアランス
+struct ClearanceResult {
+    /// @brief 一方のエンティティのID (Assemblyの列挙順で先のもの)
+    ObjectID id_a;
+    /// @brief 他方のエンティティのID
+    ObjectID id_b;
+    /// @brief ワールド空間の最短距離
+    double distance;
+    /// @brief id_a側の最近点 (ワールド空間)
+    Vector3d point_a;
+    /// @brief id_b側の最近点 (ワールド空間)
+    Vector3d point_b;
+};
+
+/// @brief Assembly内の曲線・曲面の全ての組について、クリアランスを計算する
+/// @param assembly 対象のAssembly (全子孫を含む)
+/// @param params 計算パラメータ
+/// @return 最短距離がmax_distance以下の組のリスト (distance昇順. 同じ距離の組は
+///         Assemblyの列挙順に並ぶ)
+/// @throw std::invalid_argument max_distanceが負またはNaNの場合、
+///        またはparams.distanceが不正な場合
+/// @note 各エンティティはワールド配置のビュー (Assembly::GetCurveView/GetSurfaceView)
+///       として評価する. 以下は対象としない. 表示状態 (Display) は考慮しない.
+///       - 物理従属 (kPhysicallyDependent) のエンティティ (親を通じて評価される)
+///       - パラメータ範囲が無限の曲線 (最短距離の探索範囲を定められない)
+/// @note 子孫エンティティの遅延幾何キャッシュ (Assembly::PrepareGeometryCaches) を
+///       事前構築した上で、各組を並列に計算する (common/parallel.h).
+///       計算中はAssemblyのエンティティを編集しないこと.
+std::vector<ClearanceResult> ComputeClearances(
+        const Assembly& assembly, const ClearanceParams& params = {});
+
+}  // namespace igesio::models
+
+#endif  // IGESIO_MODELS_CLEARANCE_H_
@@ -0,0 +1,208 @@
+/**
+ * @file models/ray_caster.h
+ * @brief Assemblyに対するヘッドレスなレイキャスト (一括・並列)
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 描画層 (graphics::EntityRenderer::PickEntities) に依存せず、カメラ・GL
+ *       オブジェクトなしでAssemblyの曲線・曲面・メッシュとレイの交差を求める.
+ *       干渉・クリアランス検査のように多数のレイを撃つ用途を想定し、構築時に
+ *       ワールド空間の加速構造 (エンティティのBVH) を一度だけ作り、以降のクエリは
+ *       読み取り専用・並列に行う.
+ */
+#ifndef IGESIO_MODELS_RAY_CASTER_H_
+#define IGESIO_MODELS_RAY_CASTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "igesio/common/id_generator.h"
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/geometric/bvh.h"
+#include "igesio/entities/surfaces/algorithms/restricted_surface_mesh.h"
+#include "igesio/entities/surfaces/algorithms/surface_line_intersection.h"
+#include "igesio/models/assembly.h"
+
+
+
+namespace igesio::models {
+
+/// @brief ワールド空間のレイ (半直線)
+struct Ray {
+    /// @brief 始点
+    Vector3d origin = Vector3d::Zero();
+    /// @brief 方向ベクトル (正規化不要. ゼロベクトルの場合はヒットなし)
+    Vector3d direction = Vector3d::UnitZ();
+    /// @brief 始点からの最大距離 [モデル単位]. これより遠いヒットは返さない
+    double max_distance = std::numeric_limits<double>::infinity();
+};
+
+/// @brief レイとエンティティの交差結果
+struct RayCastHit {
+    /// @brief ヒットしたエンティティのID
+    ObjectID id;
+    /// @brief ワールド空間の交点座標
+    /// @note 曲線の場合はレイに最も近い曲線上の点
+    Vector3d position;
+    /// @brief ray.originからのレイ方向の距離
+    double distance;
+};
+
+/// @brief レイキャストのヒットの集め方
+enum class RayCastMode {
+    /// @brief 最も近いヒットのみを求める (遠い候補の判定を打ち切る)
+    kFirstHit,
+    /// @brief 全てのヒットを求める
+    kAllHits,
+};
+
+/// @brief 曲面の狭域判定の方式
+enum class SurfaceRayMode {
+    /// @brief 曲面そのもの (IntersectSurfaceWithLine) と判定する
+    kExact,
+    /// @brief 構築時にテッセレーションしたメッシュと判定する
+    /// @note 交点はメッシュ上の点 (弦誤差を含む). パラメータ範囲が無限の
+    ///       非制限曲面はテッセレーションできないため、kExactで判定する
+    kTessellated,
+};
+
+/// @brief RayCasterの構築・判定パラメータ
+struct RayCasterParams {
+    /// @brief 曲線を判定対象とするか
+    bool include_curves = true;
+    /// @brief 曲面を判定対象とするか
+    bool include_surfaces = true;
+    /// @brief メッシュ (MeshEntity) を判定対象とするか
+    bool include_meshes = true;
+
+    /// @brief [モデル単位] レイからこの距離以内にある曲線をヒットとみなす
+    /// @note エンティティのモデル空間で判定する (剛体の配置ではワールド距離に等しい)
+    double curve_hit_tolerance = 1e-3;
+    /// @brief 曲線の初期格子サンプル数 (CurveLineIntersectionParams::curve_samples)
+    int curve_samples = 20;
+
+    /// @brief 曲面の狭域判定の方式
+    SurfaceRayMode surface_mode = SurfaceRayMode::kExact;
+    /// @brief kExactにおける初期値の生成方式
+    /// @note 既定のkSubdivisionはNURBS制御網の分割でレイから遠い領域を早期に
+    ///       除くため、格子の全点からニュートン法を開始するkGridNewtonより速い
+    entities::SurfaceLineIntersectionMethod surface_method =
+            entities::SurfaceLineIntersectionMethod::kSubdivision;
+    /// @brief 曲面のu方向のサンプル数
+    /// @note kExactでは初期格子、kTessellatedでは非制限曲面の格子分割数に用いる
+    int surface_u_samples = 10;
+    /// @brief 曲面のv方向のサンプル数 (surface_u_samplesと同様)
+    int surface_v_samples = 10;
+    /// @brief kTessellatedにおける制限付き曲面のテッセレーションパラメータ
+    /// @note 結果は共有テッセレーションキャッシュ (entities::GetSharedTessellationCache)
+    ///       から取得するため、形状を変更していない曲面は再テッセレーションしない
+    entities::RestrictedSurfaceMeshParams restricted_mesh;
+
+    /// @brief ニュートン法の収束判定の許容誤差
+    double convergence_tol = 1e-9;
+    /// @brief 同一エンティティ内の重複ヒットの除去に使用する3D空間距離の許容誤差
+    double dedup_tol = 1e-6;
+};
+
+/// @brief Assemblyに対するレイキャスタ
+/// @note 構築時のAssemblyのスナップショットに対して判定する. 各エンティティの
+///       ワールド配置 (Assembly::ResolvePlacement) と、テッセレーション・BVHを
+///       構築時に固定して保持するため、Assemblyの構造・形状・大域変換を変更した
+///       場合は作り直すこと (GetRevision()とAssembly::Revision()の比較で検知できる).
+/// @note 物理従属 (kPhysicallyDependent) のエンティティは親を通じて判定される
+///       ため対象としない (Assembly::GetWorldBoundingBoxと同じ規則).
+///       表示状態 (Display) は考慮しない.
+/// @note CastRay/CastRaysは同一インスタンスに対して複数スレッドから同時に
+///       呼び出してよい. ただし判定中はAssemblyのエンティティを編集しないこと.
+class RayCaster {
+ public:
+    /// @brief コンストラクタ
+    /// @param assembly 判定対象のAssembly (全子孫を含む)
+    /// @param params 構築・判定パラメータ
+    /// @note 子孫エンティティの遅延幾何キャッシュ (Assembly::PrepareGeometryCaches)
+    ///       と、メッシュのBVH・曲面のテッセレーションを並列に事前構築する
+    explicit RayCaster(const Assembly& assembly, const RayCasterParams& params = {});
+
+    /// @brief デストラクタ
+    ~RayCaster();
+    /// @brief ムーブコンストラクタ
+    RayCaster(RayCaster&&) noexcept;
+    /// @brief ムーブ代入演算子
+    RayCaster& operator=(RayCaster&&) noexcept;
+    /// @brief コピーコンストラクタ (削除)
+    RayCaster(const RayCaster&) = delete;
+    /// @brief コピー代入演算子 (削除)
+    RayCaster& operator=(const RayCaster&) = delete;
+
+    /// @brief 1本のレイを判定する
+    /// @param ray ワールド空間のレイ
+    /// @param mode ヒットの集め方
+    /// @return distance昇順のヒットのリスト. kFirstHitの場合は高々1件
+    /// @note 同じdistanceのヒットは、構築時のエンティティの列挙順に並ぶ
+    std::vector<RayCastHit> CastRay(
+            const Ray& ray, RayCastMode mode = RayCastMode::kFirstHit) const;
+
+    /// @brief 複数のレイをまとめて判定する
+    /// @param rays レイの配列の先頭
+    /// @param count レイの数
+    /// @param mode ヒットの集め方 (全てのレイで共通)
+    /// @return 各レイのヒットのリスト (raysと同じ順序. 各要素はCastRayと同じ結果)
+    /// @note レイごとに並列に判定する (common/parallel.h)
+    std::vector<std::vector<RayCastHit>> CastRays(
+            const Ray* rays, std::size_t count,
+            RayCastMode mode = RayCastMode::kFirstHit) const;
+
+    /// @brief 複数のレイをまとめて判定する
+    /// @param rays レイのリスト
+    /// @param mode ヒットの集め方 (全てのレイで共通)
+    /// @return 各レイのヒットのリスト (raysと同じ順序)
+    std::vector<std::vector<RayCastHit>> CastRays(
+            const std::vector<Ray>& rays,
+            RayCastMode mode = RayCastMode::kFirstHit) const {
+        return CastRays(rays.data(), rays.size(), mode);
+    }
+
+    /// @brief 判定対象のエンティティ数を取得する
+    std::size_t GetTargetCount() const;
+
+    /// @brief 構築時のAssemblyのリビジョンを取得する
+    /// @return 構築時のAssembly::Revision(). 現在値と異なる場合は作り直すこと
+    std::uint64_t GetRevision() const { return revision_; }
+
+    /// @brief 構築・判定パラメータを取得する
+    const RayCasterParams& GetParams() const { return params_; }
+
+ private:
+    /// @brief 判定対象のエンティティ (ray_caster.cppで定義)
+    struct Target;
+
+    /// @brief 1つのエンティティとレイの交差を求める
+    /// @param target 対象のエンティティ
+    /// @param origin レイの始点 (ワールド)
+    /// @param direction 正規化済みのレイの方向 (ワールド)
+    /// @param max_distance 最大距離
+    /// @return distance昇順のヒットのリスト
+    std::vector<RayCastHit> IntersectTarget(
+            const Target& target, const Vector3d& origin,
+            const Vector3d& direction, double max_distance) const;
+
+    /// @brief 構築・判定パラメータ
+    RayCasterParams params_;
+    /// @brief 判定対象のエンティティ (Assemblyの列挙順)
+    std::vector<Target> targets_;
+    /// @brief ワールド空間のバウンディングボックスを持つ対象 (targets_の添字)
+    /// @note bvh_のプリミティブ番号はこの配列の添字
+    std::vector<std::size_t> bounded_;
+    /// @brief バウンディングボックスが有限でない対象 (常に狭域判定する)
+    std::vector<std::size_t> unbounded_;
+    /// @brief bounded_のワールド空間バウンディングボックスのBVH
+    numerics::Bvh bvh_;
+    /// @brief 構築時のAssemblyのリビジョン
+    std::uint64_t revision_ = 0;
+};
+
+}  // namespace igesio::models
+
+#endif  // IGESIO_MODELS_RAY_CASTER_H_
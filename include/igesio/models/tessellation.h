@@ -0,0 +1,42 @@
+/**
+ * @file models/tessellation.h
+ * @brief Assembly内の曲面の、隙間のない1つの三角形メッシュへの変換
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note STL出力 (extensions::WriteStl) 等で溶接・修復を要しないメッシュを得るため、
+ *       Assemblyの全ての曲面をワールド空間で entities::TessellateWatertight に渡し、
+ *       隣接する面 (部品間を含む) の共有境界の頂点を共有させる.
+ */
+#ifndef IGESIO_MODELS_TESSELLATION_H_
+#define IGESIO_MODELS_TESSELLATION_H_
+
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/entities/surfaces/algorithms/watertight_mesh.h"
+#include "igesio/models/assembly.h"
+
+
+
+namespace igesio::models {
+
+/// @brief Assembly内の曲面を、共有境界で隙間なく接続された1つのメッシュにする
+/// @param assembly 対象のAssembly (全子孫を含む)
+/// @param params 制御パラメータ (許容量はワールド空間の長さとして扱う)
+/// @return 三角形メッシュ. 曲面ごとに1つの面グループを持ち、その名前は
+///         エンティティのID (ToString(ObjectID)). 面グループはAssemblyの列挙順に並ぶ
+/// @throw std::invalid_argument paramsが不正な場合
+/// @note 各曲面はワールド配置のビュー (Assembly::GetSurfaceView) として分割する.
+///       物理従属 (kPhysicallyDependent) の曲面 (制限面の基底曲面等) は対象としない.
+///       表示状態 (Display) は考慮しない
+/// @note 結果は共有テッセレーションキャッシュ (entities::GetSharedTessellationCache) に
+///       AssemblyのID・各曲面の形状とワールド配置・paramsをキーとして保持し、
+///       これらが変わらない限り再計算しない
+/// @note 子孫エンティティの遅延幾何キャッシュ (Assembly::PrepareGeometryCaches) を
+///       事前構築した上で、面ごとに並列に分割する. 計算中はAssemblyの
+///       エンティティを編集しないこと.
+numerics::TriangleMeshf TessellateAssembly(
+        const Assembly& assembly, const entities::WatertightMeshParams& params = {});
+
+}  // namespace igesio::models
+
+#endif  // IGESIO_MODELS_TESSELLATION_H_
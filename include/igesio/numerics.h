@@ -15,6 +15,7 @@
 #include "igesio/numerics/core/combinatorics.h"
 
 // 数値解析 (数値積分、最適化・求根)
+#include "igesio/numerics/analysis/gauss_quadrature.h"
 #include "igesio/numerics/analysis/integration.h"
 #include "igesio/numerics/analysis/optimization.h"
 
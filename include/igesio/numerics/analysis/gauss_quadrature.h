@@ -0,0 +1,769 @@
+/**
+ * @file numerics/analysis/gauss_quadrature.h
+ * @brief テンプレート版のガウス求積 (ガウス=ルジャンドル、ガウス=クロンロッド)
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note `integration.h`の関数群は被積分関数を`std::function`で受け取るため、
+ *       評価ごとに間接呼び出しが発生する. 本ヘッダの関数は被積分関数の型を
+ *       テンプレート引数に取り、呼び出しをインライン展開できる. 曲線長・曲面積
+ *       など、評価回数の多い内部計算ではこちらを使用する.
+ */
+#ifndef IGESIO_NUMERICS_ANALYSIS_GAUSS_QUADRATURE_H_
+#define IGESIO_NUMERICS_ANALYSIS_GAUSS_QUADRATURE_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <queue>
+#include <vector>
+
+#include "igesio/numerics/core/tolerance.h"
+
+
+
+namespace igesio::numerics {
+
+/// @brief 分点・重みの表を持つガウス=ルジャンドル求積法の最大点数
+constexpr size_t kGaussLegendreTableMaxPoints = 20;
+
+/// @brief ガウス=クロンロッド求積法 (G7-K15) の1区間あたりの評価点数
+constexpr size_t kGaussKronrodPoints = 15;
+
+/// @brief 隠蔽用名前空間
+/// @note 直接使用しないこと
+namespace detail {
+
+/// @brief n点ガウス=ルジャンドル求積法の分点表 ([-1, 1]上, 昇順)
+/// @note n = 1, 2, ..., 20の分点を順に連結したもの.
+///       n点の分点は`GaussLegendreTableOffset(n)`から始まるn個の要素
+constexpr std::array<double, 210> kGaussLegendreNodes = {
+    // n = 1
+    0.0,
+    // n = 2
+    -0.5773502691896257, 0.5773502691896257,
+    // n = 3
+    -0.7745966692414834, 0.0, 0.7745966692414834,
+    // n = 4
+    -0.8611363115940526, -0.33998104358485626, 0.33998104358485626, 0.8611363115940526,
+    // n = 5
+    -0.906179845938664, -0.5384693101056831, 0.0, 0.5384693101056831, 0.906179845938664,
+    // n = 6
+    -0.932469514203152, -0.6612093864662645, -0.2386191860831969, 0.2386191860831969,
+    0.6612093864662645, 0.932469514203152,
+    // n = 7
+    -0.9491079123427585, -0.7415311855993945, -0.4058451513773972, 0.0,
+    0.4058451513773972, 0.7415311855993945, 0.9491079123427585,
+    // n = 8
+    -0.9602898564975363, -0.7966664774136267, -0.525532409916329, -0.1834346424956498,
+    0.1834346424956498, 0.525532409916329, 0.7966664774136267, 0.9602898564975363,
+    // n = 9
+    -0.9681602395076261, -0.8360311073266358, -0.6133714327005904, -0.3242534234038089,
+    0.0, 0.3242534234038089, 0.6133714327005904, 0.8360311073266358, 0.9681602395076261,
+    // n = 10
+    -0.9739065285171717, -0.8650633666889845, -0.6794095682990244, -0.4333953941292472,
+    -0.14887433898163122, 0.14887433898163122, 0.4333953941292472, 0.6794095682990244,
+    0.8650633666889845, 0.9739065285171717,
+    // n = 11
+    -0.978228658146057, -0.8870625997680953, -0.7301520055740494, -0.5190961292068118,
+    -0.26954315595234496, 0.0, 0.26954315595234496, 0.5190961292068118,
+    0.7301520055740494, 0.8870625997680953, 0.978228658146057,
+    // n = 12
+    -0.9815606342467192, -0.9041172563704749, -0.7699026741943047, -0.5873179542866175,
+    -0.3678314989981802, -0.1252334085114689, 0.1252334085114689, 0.3678314989981802,
+    0.5873179542866175, 0.7699026741943047, 0.9041172563704749, 0.9815606342467192,
+    // n = 13
+    -0.9841830547185881, -0.9175983992229779, -0.8015780907333099, -0.6423493394403402,
+    -0.44849275103644687, -0.2304583159551348, 0.0, 0.2304583159551348,
+    0.44849275103644687, 0.6423493394403402, 0.8015780907333099, 0.9175983992229779,
+    0.9841830547185881,
+    // n = 14
+    -0.9862838086968123, -0.9284348836635735, -0.827201315069765, -0.6872929048116855,
+    -0.5152486363581541, -0.31911236892788974, -0.10805494870734367,
+    0.10805494870734367, 0.31911236892788974, 0.5152486363581541, 0.6872929048116855,
+    0.827201315069765, 0.9284348836635735, 0.9862838086968123,
+    // n = 15
+    -0.9879925180204854, -0.937273392400706, -0.8482065834104272, -0.7244177313601701,
+    -0.5709721726085388, -0.3941513470775634, -0.20119409399743451, 0.0,
+    0.20119409399743451, 0.3941513470775634, 0.5709721726085388, 0.7244177313601701,
+    0.8482065834104272, 0.937273392400706, 0.9879925180204854,
+    // n = 16
+    -0.9894009349916499, -0.9445750230732326, -0.8656312023878318, -0.755404408355003,
+    -0.6178762444026438, -0.45801677765722737, -0.2816035507792589,
+    -0.09501250983763744, 0.09501250983763744, 0.2816035507792589, 0.45801677765722737,
+    0.6178762444026438, 0.755404408355003, 0.8656312023878318, 0.9445750230732326,
+    0.9894009349916499,
+    // n = 17
+    -0.9905754753144174, -0.9506755217687678, -0.8802391537269859, -0.7815140038968014,
+    -0.6576711592166907, -0.5126905370864769, -0.3512317634538763, -0.17848418149584785,
+    0.0, 0.17848418149584785, 0.3512317634538763, 0.5126905370864769,
+    0.6576711592166907, 0.7815140038968014, 0.8802391537269859, 0.9506755217687678,
+    0.9905754753144174,
+    // n = 18
+    -0.9915651684209309, -0.9558239495713977, -0.8926024664975557, -0.8037049589725231,
+    -0.6916870430603532, -0.5597708310739475, -0.41175116146284263, -0.2518862256915055,
+    -0.0847750130417353, 0.0847750130417353, 0.2518862256915055, 0.41175116146284263,
+    0.5597708310739475, 0.6916870430603532, 0.8037049589725231, 0.8926024664975557,
+    0.9558239495713977, 0.9915651684209309,
+    // n = 19
+    -0.9924068438435844, -0.96020815213483, -0.9031559036148179, -0.8227146565371428,
+    -0.7209661773352294, -0.600545304661681, -0.46457074137596094, -0.31656409996362983,
+    -0.16035864564022537, 0.0, 0.16035864564022537, 0.31656409996362983,
+    0.46457074137596094, 0.600545304661681, 0.7209661773352294, 0.8227146565371428,
+    0.9031559036148179, 0.96020815213483, 0.9924068438435844,
+    // n = 20
+    -0.9931285991850949, -0.9639719272779138, -0.912234428251326, -0.8391169718222188,
+    -0.7463319064601508, -0.636053680726515, -0.5108670019508271, -0.37370608871541955,
+    -0.22778585114164507, -0.07652652113349734, 0.07652652113349734,
+    0.22778585114164507, 0.37370608871541955, 0.5108670019508271, 0.636053680726515,
+    0.7463319064601508, 0.8391169718222188, 0.912234428251326, 0.9639719272779138,
+    0.9931285991850949
+};
+
+/// @brief n点ガウス=ルジャンドル求積法の重み表
+/// @note 並びは`kGaussLegendreNodes`と同じ
+constexpr std::array<double, 210> kGaussLegendreWeights = {
+    // n = 1
+    2.0,
+    // n = 2
+    1.0, 1.0,
+    // n = 3
+    0.5555555555555556, 0.8888888888888888, 0.5555555555555556,
+    // n = 4
+    0.34785484513745385, 0.6521451548625461, 0.6521451548625461, 0.34785484513745385,
+    // n = 5
+    0.23692688505618908, 0.47862867049936647, 0.5688888888888889, 0.47862867049936647,
+    0.23692688505618908,
+    // n = 6
+    0.17132449237917036, 0.3607615730481386, 0.46791393457269104, 0.46791393457269104,
+    0.3607615730481386, 0.17132449237917036,
+    // n = 7
+    0.1294849661688697, 0.27970539148927664, 0.3818300505051189, 0.4179591836734694,
+    0.3818300505051189, 0.27970539148927664, 0.1294849661688697,
+    // n = 8
+    0.10122853629037626, 0.22238103445337448, 0.31370664587788727, 0.362683783378362,
+    0.362683783378362, 0.31370664587788727, 0.22238103445337448, 0.10122853629037626,
+    // n = 9
+    0.08127438836157441, 0.1806481606948574, 0.26061069640293544, 0.31234707704000286,
+    0.3302393550012598, 0.31234707704000286, 0.26061069640293544, 0.1806481606948574,
+    0.08127438836157441,
+    // n = 10
+    0.06667134430868814, 0.1494513491505806, 0.21908636251598204, 0.26926671930999635,
+    0.29552422471475287, 0.29552422471475287, 0.26926671930999635, 0.21908636251598204,
+    0.1494513491505806, 0.06667134430868814,
+    // n = 11
+    0.05566856711617366, 0.1255803694649046, 0.18629021092773426, 0.23319376459199048,
+    0.26280454451024665, 0.2729250867779006, 0.26280454451024665, 0.23319376459199048,
+    0.18629021092773426, 0.1255803694649046, 0.05566856711617366,
+    // n = 12
+    0.04717533638651183, 0.10693932599531843, 0.16007832854334622, 0.20316742672306592,
+    0.2334925365383548, 0.24914704581340277, 0.24914704581340277, 0.2334925365383548,
+    0.20316742672306592, 0.16007832854334622, 0.10693932599531843, 0.04717533638651183,
+    // n = 13
+    0.04048400476531588, 0.09212149983772845, 0.13887351021978725, 0.17814598076194574,
+    0.2078160475368885, 0.22628318026289723, 0.2325515532308739, 0.22628318026289723,
+    0.2078160475368885, 0.17814598076194574, 0.13887351021978725, 0.09212149983772845,
+    0.04048400476531588,
+    // n = 14
+    0.03511946033175186, 0.08015808715976021, 0.12151857068790319, 0.15720316715819355,
+    0.18553839747793782, 0.2051984637212956, 0.2152638534631578, 0.2152638534631578,
+    0.2051984637212956, 0.18553839747793782, 0.15720316715819355, 0.12151857068790319,
+    0.08015808715976021, 0.03511946033175186,
+    // n = 15
+    0.03075324199611727, 0.07036604748810812, 0.10715922046717194, 0.13957067792615432,
+    0.16626920581699392, 0.1861610000155622, 0.19843148532711158, 0.2025782419255613,
+    0.19843148532711158, 0.1861610000155622, 0.16626920581699392, 0.13957067792615432,
+    0.10715922046717194, 0.07036604748810812, 0.03075324199611727,
+    // n = 16
+    0.027152459411754096, 0.062253523938647894, 0.09515851168249279,
+    0.12462897125553388, 0.14959598881657674, 0.16915651939500254, 0.18260341504492358,
+    0.1894506104550685, 0.1894506104550685, 0.18260341504492358, 0.16915651939500254,
+    0.14959598881657674, 0.12462897125553388, 0.09515851168249279, 0.062253523938647894,
+    0.027152459411754096,
+    // n = 17
+    0.02414830286854793, 0.0554595293739872, 0.08503614831717918, 0.11188384719340397,
+    0.13513636846852548, 0.15404576107681028, 0.16800410215645004, 0.17656270536699264,
+    0.17944647035620653, 0.17656270536699264, 0.16800410215645004, 0.15404576107681028,
+    0.13513636846852548, 0.11188384719340397, 0.08503614831717918, 0.0554595293739872,
+    0.02414830286854793,
+    // n = 18
+    0.02161601352648331, 0.0497145488949698, 0.07642573025488905, 0.10094204410628717,
+    0.12255520671147846, 0.14064291467065065, 0.15468467512626524, 0.16427648374583273,
+    0.1691423829631436, 0.1691423829631436, 0.16427648374583273, 0.15468467512626524,
+    0.14064291467065065, 0.12255520671147846, 0.10094204410628717, 0.07642573025488905,
+    0.0497145488949698, 0.02161601352648331,
+    // n = 19
+    0.019461788229726478, 0.0448142267656996, 0.06904454273764123, 0.09149002162245,
+    0.11156664554733399, 0.12875396253933621, 0.1426067021736066, 0.15276604206585967,
+    0.15896884339395434, 0.1610544498487837, 0.15896884339395434, 0.15276604206585967,
+    0.1426067021736066, 0.12875396253933621, 0.11156664554733399, 0.09149002162245,
+    0.06904454273764123, 0.0448142267656996, 0.019461788229726478,
+    // n = 20
+    0.017614007139152118, 0.04060142980038694, 0.06267204833410907, 0.08327674157670475,
+    0.10193011981724044, 0.11819453196151841, 0.13168863844917664, 0.14209610931838204,
+    0.14917298647260374, 0.15275338713072584, 0.15275338713072584, 0.14917298647260374,
+    0.14209610931838204, 0.13168863844917664, 0.11819453196151841, 0.10193011981724044,
+    0.08327674157670475, 0.06267204833410907, 0.04060142980038694, 0.017614007139152118
+};
+
+/// @brief n点の分点・重みが始まる表中の位置
+/// @param n 点数 (1 <= n <= kGaussLegendreTableMaxPoints)
+constexpr size_t GaussLegendreTableOffset(const size_t n) {
+    return n * (n - 1) / 2;
+}
+
+/// @brief 15点クロンロッド求積法の分点 ([-1, 1]上, 昇順)
+/// @note 奇数番目 (1, 3, ..., 13) の分点は7点ガウス=ルジャンドル求積法の分点と一致する
+constexpr std::array<double, kGaussKronrodPoints> kKronrod15Nodes = {
+    -0.991455371120812639206854697526329, -0.949107912342758524526189684047851,
+    -0.864864423359769072789712788640926, -0.741531185599394439863864773280788,
+    -0.586087235467691130294144845693013, -0.405845151377397166906606412076961,
+    -0.207784955007898467600689403773245, 0.0,
+    0.207784955007898467600689403773245, 0.405845151377397166906606412076961,
+    0.586087235467691130294144845693013, 0.741531185599394439863864773280788,
+    0.864864423359769072789712788640926, 0.949107912342758524526189684047851,
+    0.991455371120812639206854697526329
+};
+
+/// @brief 15点クロンロッド求積法の重み
+constexpr std::array<double, kGaussKronrodPoints> kKronrod15Weights = {
+    0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+    0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+    0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+    0.204432940075298892414161999234649, 0.209482141084727828012999174891714,
+    0.204432940075298892414161999234649, 0.190350578064785409913256402421014,
+    0.169004726639267902826583426598550, 0.140653259715525918745189590510238,
+    0.104790010322250183839876322541518, 0.063092092629978553290700663189204,
+    0.022935322010529224963732008058970
+};
+
+/// @brief クロンロッド分点上での7点ガウス=ルジャンドル求積法の重み
+/// @note ガウス分点でない位置の重みは0
+constexpr std::array<double, kGaussKronrodPoints> kGauss7WeightsOnKronrod = {
+    0.0, 0.129484966168869693270611432679082,
+    0.0, 0.279705391489276667901467771423780,
+    0.0, 0.381830050505118944950369775488975,
+    0.0, 0.417959183673469387755102040816327,
+    0.0, 0.381830050505118944950369775488975,
+    0.0, 0.279705391489276667901467771423780,
+    0.0, 0.129484966168869693270611432679082,
+    0.0
+};
+
+}  // namespace detail
+
+
+
+/**
+ * ガウス=ルジャンドル求積法 (固定次数)
+ */
+
+/// @brief n点ガウス=ルジャンドル求積法による数値積分 (分割なし)
+/// @tparam Func double(double)と互換な呼び出し可能型
+/// @param f 被積分関数 f(x) (x ∈ [x_min, x_max])
+/// @param range 積分区間の範囲 [x_min, x_max]
+/// @param n_points ガウス点の数 (1 <= n_points <= kGaussLegendreTableMaxPoints)
+/// @return 積分値 ∫[x_min, x_max] f(x) dx. n_pointsが範囲外の場合は0
+/// @note 2n-1次までの多項式を厳密に積分する
+template <typename Func>
+double GaussLegendreFixed(const Func& f, const std::array<double, 2>& range,
+                          const size_t n_points) {
+    if (n_points == 0 || n_points > kGaussLegendreTableMaxPoints) return 0.0;
+
+    // x = a·t + b (t ∈ [-1, 1])
+    const double half_width = (range[1] - range[0]) / 2.0;
+    const double center = (range[1] + range[0]) / 2.0;
+
+    const size_t offset = detail::GaussLegendreTableOffset(n_points);
+    double integral = 0.0;
+    for (size_t i = 0; i < n_points; ++i) {
+        integral += detail::kGaussLegendreWeights[offset + i]
+                  * f(half_width * detail::kGaussLegendreNodes[offset + i] + center);
+    }
+    return half_width * integral;
+}
+
+/// @brief N点ガウス=ルジャンドル求積法による数値積分 (点数をコンパイル時に指定)
+/// @tparam N ガウス点の数 (1 <= N <= kGaussLegendreTableMaxPoints)
+/// @tparam Func double(double)と互換な呼び出し可能型
+/// @param f 被積分関数 f(x) (x ∈ [x_min, x_max])
+/// @param range 積分区間の範囲 [x_min, x_max]
+/// @return 積分値 ∫[x_min, x_max] f(x) dx
+template <size_t N, typename Func>
+double GaussLegendreFixed(const Func& f, const std::array<double, 2>& range) {
+    static_assert(N >= 1 && N <= kGaussLegendreTableMaxPoints,
+                  "GaussLegendreFixed: N must be in [1, 20].");
+    const double half_width = (range[1] - range[0]) / 2.0;
+    const double center = (range[1] + range[0]) / 2.0;
+
+    constexpr size_t offset = detail::GaussLegendreTableOffset(N);
+    double integral = 0.0;
+    for (size_t i = 0; i < N; ++i) {
+        integral += detail::kGaussLegendreWeights[offset + i]
+                  * f(half_width * detail::kGaussLegendreNodes[offset + i] + center);
+    }
+    return half_width * integral;
+}
+
+
+
+/**
+ * 適応型ガウス=クロンロッド求積法 (G7-K15)
+ */
+
+/// @brief 誤差推定付きの数値積分結果
+struct QuadratureResult {
+    /// @brief 積分値
+    double value = 0.0;
+    /// @brief 推定絶対誤差
+    double error = 0.0;
+    /// @brief 被積分関数の評価回数
+    size_t n_evaluations = 0;
+    /// @brief 推定誤差が許容誤差以下となったか
+    /// @note falseの場合、最大分割数に達したか、区間幅が浮動小数の分解能に達した
+    bool converged = false;
+};
+
+/// @brief 1区間に対するG7-K15求積 (バッチ評価版)
+/// @tparam BatchFunc `void(const std::array<double, 15>& x, std::array<double, 15>& fx)`
+///         と互換な呼び出し可能型. 区間内の15点xにおける被積分関数値をfxへ書き込む
+/// @param f 被積分関数 (15点をまとめて評価する)
+/// @param range 積分区間の範囲 [x_min, x_max]
+/// @return 15点クロンロッド則による積分値と、7点ガウス則との差に基づく推定誤差
+/// @note 15点を一度に渡すため、複数パラメータをまとめて評価できる被積分関数
+///       (基底関数の区間探索を共有するNURBSなど) はその経路を利用できる
+/// @note 推定誤差はQUADPACK (qk15) と同じ方法で、|K15 - G7| を
+///       被積分関数の変動量で補正したもの
+template <typename BatchFunc>
+QuadratureResult GaussKronrod15Batch(const BatchFunc& f,
+                                     const std::array<double, 2>& range) {
+    const double half_width = (range[1] - range[0]) / 2.0;
+    const double center = (range[1] + range[0]) / 2.0;
+
+    std::array<double, kGaussKronrodPoints> x;
+    std::array<double, kGaussKronrodPoints> fx;
+    for (size_t i = 0; i < kGaussKronrodPoints; ++i) {
+        x[i] = half_width * detail::kKronrod15Nodes[i] + center;
+    }
+    f(x, fx);
+
+    double kronrod = 0.0;
+    double gauss = 0.0;
+    for (size_t i = 0; i < kGaussKronrodPoints; ++i) {
+        kronrod += detail::kKronrod15Weights[i] * fx[i];
+        gauss += detail::kGauss7WeightsOnKronrod[i] * fx[i];
+    }
+
+    // 被積分関数の平均からの変動量 ∫|f - mean| (QUADPACKのresasc)
+    const double mean = kronrod / 2.0;
+    double asc = 0.0;
+    for (size_t i = 0; i < kGaussKronrodPoints; ++i) {
+        asc += detail::kKronrod15Weights[i] * std::fabs(fx[i] - mean);
+    }
+
+    const double abs_half_width = std::fabs(half_width);
+    double error = std::fabs((kronrod - gauss) * half_width);
+    asc *= abs_half_width;
+    if (asc != 0.0 && error != 0.0) {
+        error = asc * std::min(1.0, std::pow(200.0 * error / asc, 1.5));
+    }
+
+    QuadratureResult result;
+    result.value = kronrod * half_width;
+    result.error = error;
+    result.n_evaluations = kGaussKronrodPoints;
+    return result;
+}
+
+/// @brief 15点クロンロッド則の節点における関数値から、ルジャンドル級数の係数を求める
+/// @tparam Degree 級数の次数 (Degree ≤ 10)
+/// @param fx `GaussKronrod15Batch`が評価した15点における関数値
+/// @return 区間を[-1, 1]に正規化した変数ξについて、f ≈ Σ c_j P_j(ξ) となる
+///         係数 c_0, ..., c_Degree. c_0·(区間幅) はK15則の積分値に一致する
+/// @note 係数はK15則による離散射影で求めるため、(22 - Degree)次以下の多項式に
+///       対して厳密. 末尾の係数の大きさは、級数の打ち切り誤差の目安となる
+template <size_t Degree>
+std::array<double, Degree + 1> LegendreCoefficientsFromKronrod15(
+        const std::array<double, kGaussKronrodPoints>& fx) {
+    static_assert(Degree <= 10, "Degree must be 10 or less");
+
+    std::array<double, Degree + 1> coefficients{};
+    for (size_t i = 0; i < kGaussKronrodPoints; ++i) {
+        // 3項漸化式 (n+1)P_{n+1} = (2n+1)ξP_n - nP_{n-1}
+        const double xi = detail::kKronrod15Nodes[i];
+        const double wf = detail::kKronrod15Weights[i] * fx[i];
+        double p_prev = 1.0, p_curr = xi;
+        coefficients[0] += wf;
+        if (Degree >= 1) coefficients[1] += wf * xi;
+        for (size_t n = 1; n < Degree; ++n) {
+            const double p_next = ((2.0 * n + 1.0) * xi * p_curr - n * p_prev) / (n + 1.0);
+            p_prev = p_curr;
+            p_curr = p_next;
+            coefficients[n + 1] += wf * p_curr;
+        }
+    }
+    for (size_t j = 0; j <= Degree; ++j) {
+        coefficients[j] *= (2.0 * j + 1.0) / 2.0;
+    }
+    return coefficients;
+}
+
+/// @brief 1区間に対するG7-K15求積
+/// @tparam Func double(double)と互換な呼び出し可能型
+/// @param f 被積分関数 f(x)
+/// @param range 積分区間の範囲 [x_min, x_max]
+/// @return 積分値と推定誤差
+template <typename Func>
+QuadratureResult GaussKronrod15(const Func& f, const std::array<double, 2>& range) {
+    return GaussKronrod15Batch(
+        [&f](const std::array<double, kGaussKronrodPoints>& x,
+             std::array<double, kGaussKronrodPoints>& fx) {
+            for (size_t i = 0; i < kGaussKronrodPoints; ++i) fx[i] = f(x[i]);
+        }, range);
+}
+
+/// @brief 適応型ガウス=クロンロッド求積法による数値積分 (バッチ評価版)
+/// @tparam BatchFunc `GaussKronrod15Batch`を参照
+/// @param f 被積分関数 (15点をまとめて評価する)
+/// @param range 積分区間の範囲 [x_min, x_max]. x_min > x_maxの場合は符号が反転する
+/// @param tolerance 許容誤差. 全区間の推定誤差の和が
+///        max(abs_tol, rel_tol·|積分値|) 以下となるまで分割する
+/// @param max_subdivisions 区間の最大分割回数
+/// @return 積分値と推定誤差
+/// @note 推定誤差が最大の区間を優先して二等分する大域的適応法 (QUADPACKのqag相当).
+///       滑らかな被積分関数では1区間 (15回の評価) で収束することが多い
+template <typename BatchFunc>
+QuadratureResult AdaptiveGaussKronrodBatch(
+        const BatchFunc& f, const std::array<double, 2>& range,
+        const Tolerance& tolerance = Tolerance(),
+        const size_t max_subdivisions = 200) {
+    QuadratureResult total;
+    if (range[0] == range[1]) {
+        total.converged = true;
+        return total;
+    }
+    if (range[0] > range[1]) {
+        total = AdaptiveGaussKronrodBatch(f, {range[1], range[0]},
+                                          tolerance, max_subdivisions);
+        total.value = -total.value;
+        return total;
+    }
+
+    /// 部分区間とその積分結果
+    struct Panel {
+        std::array<double, 2> range;
+        QuadratureResult result;
+        bool operator<(const Panel& other) const {
+            return result.error < other.result.error;
+        }
+    };
+
+    const auto is_converged = [&tolerance](const double value, const double error) {
+        return error <= std::max(tolerance.abs_tol,
+                                 tolerance.rel_tol * std::fabs(value));
+    };
+
+    Panel first{range, GaussKronrod15Batch(f, range)};
+    total.value = first.result.value;
+    total.error = first.result.error;
+    total.n_evaluations = first.result.n_evaluations;
+    if (is_converged(total.value, total.error)) {
+        total.converged = true;
+        return total;
+    }
+
+    // 誤差の大きい区間から順に二等分する
+    std::priority_queue<Panel> panels;
+    panels.push(first);
+    for (size_t i = 0; i < max_subdivisions; ++i) {
+        Panel worst = panels.top();
+        const double mid = (worst.range[0] + worst.range[1]) / 2.0;
+        if (mid <= worst.range[0] || mid >= worst.range[1]) {
+            // これ以上分割できない (浮動小数精度の限界)
+            break;
+        }
+        panels.pop();
+
+        Panel left{{worst.range[0], mid},
+                   GaussKronrod15Batch(f, {worst.range[0], mid})};
+        Panel right{{mid, worst.range[1]},
+                    GaussKronrod15Batch(f, {mid, worst.range[1]})};
+        total.value += left.result.value + right.result.value
+                     - worst.result.value;
+        total.error += left.result.error + right.result.error
+                     - worst.result.error;
+        total.n_evaluations += left.result.n_evaluations
+                             + right.result.n_evaluations;
+        panels.push(left);
+        panels.push(right);
+
+        if (is_converged(total.value, total.error)) {
+            total.converged = true;
+            break;
+        }
+    }
+
+    // 差分更新による丸め誤差の蓄積を避けるため、最終値は区間ごとに再集計する
+    double value = 0.0, error = 0.0;
+    while (!panels.empty()) {
+        value += panels.top().result.value;
+        error += panels.top().result.error;
+        panels.pop();
+    }
+    total.value = value;
+    total.error = error;
+    return total;
+}
+
+/// @brief 適応型ガウス=クロンロッド求積法による数値積分
+/// @tparam Func double(double)と互換な呼び出し可能型
+/// @param f 被積分関数 f(x)
+/// @param range 積分区間の範囲 [x_min, x_max]
+/// @param tolerance 許容誤差
+/// @param max_subdivisions 区間の最大分割回数
+/// @return 積分値と推定誤差
+template <typename Func>
+QuadratureResult AdaptiveGaussKronrod(
+        const Func& f, const std::array<double, 2>& range,
+        const Tolerance& tolerance = Tolerance(),
+        const size_t max_subdivisions = 200) {
+    return AdaptiveGaussKronrodBatch(
+        [&f](const std::array<double, kGaussKronrodPoints>& x,
+             std::array<double, kGaussKronrodPoints>& fx) {
+            for (size_t i = 0; i < kGaussKronrodPoints; ++i) fx[i] = f(x[i]);
+        }, range, tolerance, max_subdivisions);
+}
+
+/// @brief 適応型ガウス=クロンロッド求積法による2重積分
+/// @tparam Func double(double, double)と互換な呼び出し可能型
+/// @param f 被積分関数 f(x, y)
+/// @param range 積分区間の範囲 [x_min, x_max, y_min, y_max]
+/// @param tolerance 許容誤差
+/// @param max_subdivisions 各1次元積分における区間の最大分割回数
+/// @return 積分値 ∫[y_min, y_max] ∫[x_min, x_max] f(x, y) dx dy と推定誤差
+/// @note 逐次積分 g(y) = ∫f(x, y) dx を外側で積分する. 内側の許容誤差は
+///       外側の区間幅で割って配分するため、内側の誤差の総和は外側と同程度に収まる.
+///       トリム境界のような被積分関数の不連続も、内側の1次元適応分割で局所的に扱える
+/// @note 不連続点が区間端とその最も外側の節点の間にある場合、G7とK15の差に
+///       現れないため推定誤差が過小となる. 不連続を含む被積分関数では、
+///       推定誤差は目安として扱うこと
+template <typename Func>
+QuadratureResult AdaptiveGaussKronrod2D(
+        const Func& f, const std::array<double, 4>& range,
+        const Tolerance& tolerance = Tolerance(),
+        const size_t max_subdivisions = 200) {
+    const double y_width = std::fabs(range[3] - range[2]);
+    if (range[0] == range[1] || y_width == 0.0) {
+        QuadratureResult empty;
+        empty.converged = true;
+        return empty;
+    }
+
+    // 許容誤差を内側・外側に半分ずつ配分する
+    const Tolerance inner_tol(tolerance.abs_tol / (2.0 * y_width), tolerance.rel_tol);
+    const Tolerance outer_tol(tolerance.abs_tol / 2.0, tolerance.rel_tol);
+
+    size_t n_evaluations = 0;
+    double inner_error = 0.0;
+    bool inner_converged = true;
+    auto outer = AdaptiveGaussKronrodBatch(
+        [&](const std::array<double, kGaussKronrodPoints>& y,
+            std::array<double, kGaussKronrodPoints>& gy) {
+            double max_error = 0.0;
+            for (size_t i = 0; i < kGaussKronrodPoints; ++i) {
+                const double yi = y[i];
+                auto inner = AdaptiveGaussKronrod(
+                    [&f, yi](const double x) { return f(x, yi); },
+                    {range[0], range[1]}, inner_tol, max_subdivisions);
+                gy[i] = inner.value;
+                n_evaluations += inner.n_evaluations;
+                max_error = std::max(max_error, inner.error);
+                inner_converged = inner_converged && inner.converged;
+            }
+            inner_error = std::max(inner_error, max_error);
+        }, {range[2], range[3]}, outer_tol, max_subdivisions);
+
+    outer.error += inner_error * y_width;
+    outer.n_evaluations = n_evaluations;
+    outer.converged = outer.converged && inner_converged;
+    return outer;
+}
+
+/// @brief 2次元の矩形領域に対するGenz-Malik則 (7次, 埋め込み5次) の求積結果
+struct CubatureRegion2D {
+    /// @brief 領域の範囲 [x_min, x_max, y_min, y_max]
+    std::array<double, 4> range;
+    /// @brief 積分値と推定誤差
+    QuadratureResult result;
+    /// @brief 次に分割すべき軸 (0: x, 1: y)
+    int split_axis = 0;
+
+    bool operator<(const CubatureRegion2D& other) const {
+        return result.error < other.result.error;
+    }
+};
+
+/// @brief 1つの矩形領域に対するGenz-Malik則 (17点) による求積
+/// @tparam Func double(double, double)と互換な呼び出し可能型
+/// @param f 被積分関数 f(x, y)
+/// @param range 積分領域の範囲 [x_min, x_max, y_min, y_max] (x_min < x_max, y_min < y_max)
+/// @return 7次則による積分値と、埋め込み5次則との差を推定誤差とした結果.
+///         併せて4階差分が大きい方の軸を分割軸として返す
+/// @note A. C. Genz and A. A. Malik (1980) の完全対称則. 2次元では17点で
+///       7次までの多項式を厳密に積分する
+template <typename Func>
+CubatureRegion2D GenzMalik2D(const Func& f, const std::array<double, 4>& range) {
+    // 節点位置 (半幅に対する比) と重み (領域の面積で正規化済み)
+    constexpr double kLambda2 = 0.35856858280031809199;  // sqrt(9/70)
+    constexpr double kLambda4 = 0.94868329805051379960;  // sqrt(9/10)
+    constexpr double kLambda5 = 0.68824720161168529772;  // sqrt(9/19)
+    constexpr double kW1 = -3816.0 / 19683.0;
+    constexpr double kW2 = 980.0 / 6561.0;
+    constexpr double kW3 = 1020.0 / 19683.0;
+    constexpr double kW4 = 200.0 / 19683.0;
+    constexpr double kW5 = 6859.0 / 78732.0;
+    constexpr double kE1 = -971.0 / 729.0;
+    constexpr double kE2 = 245.0 / 486.0;
+    constexpr double kE3 = 65.0 / 1458.0;
+    constexpr double kE4 = 25.0 / 729.0;
+
+    const double cx = (range[0] + range[1]) / 2.0;
+    const double cy = (range[2] + range[3]) / 2.0;
+    const double hx = (range[1] - range[0]) / 2.0;
+    const double hy = (range[3] - range[2]) / 2.0;
+    const double area = 4.0 * hx * hy;
+
+    const double f0 = f(cx, cy);
+    // 各軸上の点: [軸][λ2の±, λ4の±]
+    const double fx2 = f(cx - kLambda2 * hx, cy) + f(cx + kLambda2 * hx, cy);
+    const double fx4 = f(cx - kLambda4 * hx, cy) + f(cx + kLambda4 * hx, cy);
+    const double fy2 = f(cx, cy - kLambda2 * hy) + f(cx, cy + kLambda2 * hy);
+    const double fy4 = f(cx, cy - kLambda4 * hy) + f(cx, cy + kLambda4 * hy);
+    const double f_diag4 = f(cx - kLambda4 * hx, cy - kLambda4 * hy)
+                         + f(cx + kLambda4 * hx, cy - kLambda4 * hy)
+                         + f(cx - kLambda4 * hx, cy + kLambda4 * hy)
+                         + f(cx + kLambda4 * hx, cy + kLambda4 * hy);
+    const double f_diag5 = f(cx - kLambda5 * hx, cy - kLambda5 * hy)
+                         + f(cx + kLambda5 * hx, cy - kLambda5 * hy)
+                         + f(cx - kLambda5 * hx, cy + kLambda5 * hy)
+                         + f(cx + kLambda5 * hx, cy + kLambda5 * hy);
+
+    const double sum2 = fx2 + fy2;
+    const double sum4 = fx4 + fy4;
+    const double rule7 = kW1 * f0 + kW2 * sum2 + kW3 * sum4
+                       + kW4 * f_diag4 + kW5 * f_diag5;
+    const double rule5 = kE1 * f0 + kE2 * sum2 + kE3 * sum4 + kE4 * f_diag4;
+
+    // 4階差分の大きい軸ほど被積分関数の変化が急なため、その軸で分割する
+    constexpr double kRatio = (kLambda2 * kLambda2) / (kLambda4 * kLambda4);
+    const double diff_x = std::fabs(fx2 - 2.0 * f0 - kRatio * (fx4 - 2.0 * f0));
+    const double diff_y = std::fabs(fy2 - 2.0 * f0 - kRatio * (fy4 - 2.0 * f0));
+
+    CubatureRegion2D region;
+    region.range = range;
+    region.result.value = area * rule7;
+    region.result.error = std::fabs(area * (rule7 - rule5));
+    region.result.n_evaluations = 17;
+    if (diff_x == diff_y) {
+        region.split_axis = (std::fabs(hx) >= std::fabs(hy)) ? 0 : 1;
+    } else {
+        region.split_axis = (diff_x > diff_y) ? 0 : 1;
+    }
+    return region;
+}
+
+/// @brief 適応型キュバチャ (Genz-Malik則) による2重積分
+/// @tparam Func double(double, double)と互換な呼び出し可能型
+/// @param f 被積分関数 f(x, y)
+/// @param range 積分領域の範囲 [x_min, x_max, y_min, y_max]. 下限 > 上限の軸では符号が反転する
+/// @param tolerance 許容誤差. 全領域の推定誤差の和が
+///        max(abs_tol, rel_tol·|積分値|) 以下となるまで分割する
+/// @param max_subdivisions 領域の最大分割回数
+/// @return 積分値 ∫[y_min, y_max] ∫[x_min, x_max] f(x, y) dx dy と推定誤差
+/// @note 推定誤差が最大の矩形を4階差分の大きい軸で二等分する大域的適応法.
+///       逐次積分 (`AdaptiveGaussKronrod2D`) より評価回数が少なく、
+///       曲面積のように緩い許容誤差で多数回呼び出す用途に向く
+template <typename Func>
+QuadratureResult AdaptiveCubature2D(
+        const Func& f, const std::array<double, 4>& range,
+        const Tolerance& tolerance = Tolerance(),
+        const size_t max_subdivisions = 2000) {
+    QuadratureResult total;
+    if (range[0] == range[1] || range[2] == range[3]) {
+        total.converged = true;
+        return total;
+    }
+    if (range[0] > range[1] || range[2] > range[3]) {
+        const bool flip_x = range[0] > range[1];
+        const bool flip_y = range[2] > range[3];
+        total = AdaptiveCubature2D(
+            f, {std::min(range[0], range[1]), std::max(range[0], range[1]),
+                std::min(range[2], range[3]), std::max(range[2], range[3])},
+            tolerance, max_subdivisions);
+        if (flip_x != flip_y) total.value = -total.value;
+        return total;
+    }
+
+    const auto is_converged = [&tolerance](const double value, const double error) {
+        return error <= std::max(tolerance.abs_tol,
+                                 tolerance.rel_tol * std::fabs(value));
+    };
+
+    auto first = GenzMalik2D(f, range);
+    total = first.result;
+    if (is_converged(total.value, total.error)) {
+        total.converged = true;
+        return total;
+    }
+
+    // 誤差の大きい領域から順に二等分する
+    std::priority_queue<CubatureRegion2D> regions;
+    regions.push(first);
+    for (size_t i = 0; i < max_subdivisions; ++i) {
+        const CubatureRegion2D worst = regions.top();
+        const size_t lo = 2 * worst.split_axis;
+        const double mid = (worst.range[lo] + worst.range[lo + 1]) / 2.0;
+        if (mid <= worst.range[lo] || mid >= worst.range[lo + 1]) {
+            // これ以上分割できない (浮動小数精度の限界)
+            break;
+        }
+        regions.pop();
+
+        auto lower_range = worst.range;
+        auto upper_range = worst.range;
+        lower_range[lo + 1] = mid;
+        upper_range[lo] = mid;
+        auto lower = GenzMalik2D(f, lower_range);
+        auto upper = GenzMalik2D(f, upper_range);
+        total.value += lower.result.value + upper.result.value
+                     - worst.result.value;
+        total.error += lower.result.error + upper.result.error
+                     - worst.result.error;
+        total.n_evaluations += lower.result.n_evaluations
+                             + upper.result.n_evaluations;
+        regions.push(lower);
+        regions.push(upper);
+
+        if (is_converged(total.value, total.error)) {
+            total.converged = true;
+            break;
+        }
+    }
+
+    // 差分更新による丸め誤差の蓄積を避けるため、最終値は領域ごとに再集計する
+    double value = 0.0, error = 0.0;
+    while (!regions.empty()) {
+        value += regions.top().result.value;
+        error += regions.top().result.error;
+        regions.pop();
+    }
+    total.value = value;
+    total.error = error;
+    return total;
+}
+
+}  // namespace igesio::numerics
+
+#endif  // IGESIO_NUMERICS_ANALYSIS_GAUSS_QUADRATURE_H_
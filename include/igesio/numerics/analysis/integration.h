@@ -14,6 +14,7 @@
 #include <functional>
 #include <limits>
 
+#include "igesio/numerics/analysis/gauss_quadrature.h"
 #include "igesio/numerics/core/tolerance.h"
 
 
@@ -21,12 +22,16 @@
 namespace igesio::numerics {
 
 /// @brief ガウス=ルジャンドル求積法による数値積分のサポート点の最大数
-constexpr size_t kGaussLegendreIntegrateMaxPoints = 5;
+constexpr size_t kGaussLegendreIntegrateMaxPoints = kGaussLegendreTableMaxPoints;
+/// @brief ガウス=ルジャンドル求積法による数値積分のサポート点の既定数
+constexpr size_t kGaussLegendreIntegrateDefaultPoints = 5;
 
 /// @brief 積分方法の列挙型
 enum class IntegrateMethod {
     /// @brief ガウス=ルジャンドル求積法
     kGaussLegendre,
+    /// @brief 適応型ガウス=クロンロッド求積法 (G7-K15)
+    kGaussKronrod,
 };
 
 /// @brief 数値積分の手法とパラメータを指定する構造体
@@ -34,19 +39,27 @@ struct IntegrationOptions {
     /// @brief 積分手法（デフォルトはガウス=ルジャンドル求積法）
     IntegrateMethod method = IntegrateMethod::kGaussLegendre;
     /// @brief ガウス点の数（デフォルトは5点、ガウス=ルジャンドル求積法用）
-    size_t n_points = kGaussLegendreIntegrateMaxPoints;
+    size_t n_points = kGaussLegendreIntegrateDefaultPoints;
 
     /// @brief 最大再帰深度 (無限ループ防止用)
     size_t max_recursion_depth = 20;
 
+    /// @brief 区間の最大分割回数 (ガウス=クロンロッド求積法用)
+    size_t max_subdivisions = 200;
+
     /// @brief ガウス=ルジャンドル求積法の推奨設定
-    /// @param n_points ガウス点の数（デフォルトは最大値）
+    /// @param n_points ガウス点の数（デフォルトは5点）
     /// @param max_recursion_depth 最大再帰深度 (無限ループ防止用)
     /// @return ガウス=ルジャンドル求積法用の`IntegrationOptions`
     static IntegrationOptions GaussLegendre(
-            const size_t n_points = kGaussLegendreIntegrateMaxPoints,
+            const size_t n_points = kGaussLegendreIntegrateDefaultPoints,
             const size_t max_recursion_depth = 20);
 
+    /// @brief 適応型ガウス=クロンロッド求積法の推奨設定
+    /// @param max_subdivisions 区間の最大分割回数
+    /// @return ガウス=クロンロッド求積法用の`IntegrationOptions`
+    static IntegrationOptions GaussKronrod(const size_t max_subdivisions = 200);
+
     /// @brief 積分手法の確認
     /// @param options 積分オプション
     /// @throw std::invalid_argument サポートされていない積分手法が指定された場合、
@@ -59,7 +72,7 @@ struct IntegrationOptions {
 /// @param range 積分区間の範囲 [x_min, x_max]
 /// @param n_intervals 積分区間の分割数;
 ///        0を指定した場合、常に0を返す (自動推定は行わない).
-/// @param n_points ガウス点の数（デフォルトは5点）
+/// @param n_points ガウス点の数（デフォルトは5点、最大20点）
 /// @return 積分値 ∫[x_min, x_max] f(x) dx
 /// @throw std::invalid_argument n_pointsがサポート範囲外の場合
 /// @note n_intervalsだけ積分区間 [x_min, x_max] を等分割し、
@@ -67,7 +80,7 @@ struct IntegrationOptions {
 /// @note 特に指定がなければ、`Integrate`関数の使用を推奨する.
 double GaussLegendreIntegrate(const std::function<double(double)>&,
         const std::array<double, 2>&, const size_t,
-        const size_t = kGaussLegendreIntegrateMaxPoints);
+        const size_t = kGaussLegendreIntegrateDefaultPoints);
 
 /// @brief 数値積分 ∫ f(x) dx を行う
 /// @param f 被積分関数 f(x) (x ∈ [x_min, x_max])
@@ -81,6 +94,8 @@ double GaussLegendreIntegrate(const std::function<double(double)>&,
 ///       この際、曲線が複雑な区間は細かく、単純な区間は粗く分割されるよう計算する.
 ///       このため、`GaussLegendreIntegrate`などで単に`n_intervals`を指定して積分する
 ///       よりも (同じ計算コストで) 高精度な積分が期待できる.
+/// @note 被積分関数の評価回数が多い場合は、`std::function`を介さない
+///       `AdaptiveGaussKronrod` (gauss_quadrature.h) の使用も検討すること.
 double Integrate(const std::function<double(double)>&,
                  const std::array<double, 2>&, const Tolerance& = Tolerance(),
                  const IntegrationOptions& = IntegrationOptions::GaussLegendre());
@@ -0,0 +1,431 @@
+/**
+ * @file numerics/geometric/bvh.h
+ * @brief 軸平行バウンディングボックスの階層 (BVH) と線分/半直線/直線・領域・
+ *        最近傍・最近接対による走査
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note プリミティブ (三角形・エンティティ等) の軸平行バウンディングボックス
+ *       のみから構築する汎用の加速構造. プリミティブ固有の交差判定は走査時の
+ *       コールバックが担う (例: numerics/meshes/algorithms/mesh_bvh.h).
+ */
+#ifndef IGESIO_NUMERICS_GEOMETRIC_BVH_H_
+#define IGESIO_NUMERICS_GEOMETRIC_BVH_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+
+
+
+namespace igesio::numerics {
+
+/// @brief BVHのノード
+/// @note 内部ノードの子は連続して配置され、左の子が`first`、右の子が`first + 1`
+///       となる. 葉ノードは`Bvh::primitive_indices`の[first, first + count)を持つ
+struct BvhNode {
+    /// @brief ノードのバウンディングボックスの最小点
+    Vector3d lower = Vector3d::Zero();
+    /// @brief ノードのバウンディングボックスの最大点
+    Vector3d upper = Vector3d::Zero();
+    /// @brief 葉ノード: primitive_indices内の先頭位置. 内部ノード: 左の子の番号
+    std::uint32_t first = 0;
+    /// @brief 葉ノード: プリミティブ数 (>0). 内部ノード: 0
+    std::uint32_t count = 0;
+
+    /// @brief 葉ノードか
+    bool IsLeaf() const { return count > 0; }
+};
+
+/// @brief 軸平行バウンディングボックスの階層 (Bounding Volume Hierarchy)
+/// @note ノードはフラットな配列に保持し、nodes[0]を根とする.
+///       プリミティブが無い場合はノードも持たない
+struct Bvh {
+    /// @brief ノード列 (nodes[0]が根)
+    std::vector<BvhNode> nodes;
+    /// @brief 葉ノードが参照するプリミティブ番号の並び
+    std::vector<std::uint32_t> primitive_indices;
+
+    /// @brief プリミティブを持たないか
+    bool IsEmpty() const { return nodes.empty(); }
+    /// @brief プリミティブ数を取得する
+    std::size_t PrimitiveCount() const { return primitive_indices.size(); }
+};
+
+/// @brief BVH構築の制御パラメータ
+struct BvhBuildParams {
+    /// @brief 葉ノードの最大プリミティブ数 (1以上)
+    std::size_t max_leaf_size = 4;
+    /// @brief SAH (Surface Area Heuristic) の評価に用いるビン数 (2以上)
+    /// @note 各ノードで3軸それぞれを等間隔のビンに分け、ビン境界のうち
+    ///       SAHコストが最小となる位置で分割する
+    std::size_t bin_count = 16;
+};
+
+/// @brief プリミティブのバウンディングボックス列からBVHを構築する
+/// @param lowers 各プリミティブのバウンディングボックスの最小点
+/// @param uppers 各プリミティブのバウンディングボックスの最大点
+/// @param params 構築の制御パラメータ
+/// @return 構築したBVH. プリミティブ番号はlowers/uppersの添字に対応する
+/// @throw std::invalid_argument lowersとuppersのサイズが異なる場合、
+///        プリミティブ数がuint32_tで表せない場合、またはparamsが不正な場合
+/// @note 各ノードのボックスは、走査時の丸め誤差でプリミティブ境界上の交差を
+///       取りこぼさないよう、座標の大きさに対して微小に拡大して保持する
+Bvh BuildBvh(const std::vector<Vector3d>&, const std::vector<Vector3d>&,
+             const BvhBuildParams& = {});
+
+
+
+namespace detail {
+
+/// @brief BVH走査用のレイ (方向ベクトルの逆数を事前計算したもの)
+class BvhRay {
+ public:
+    /// @brief コンストラクタ
+    /// @param origin 始点
+    /// @param direction 方向ベクトル (ゼロベクトルでないこと)
+    /// @param padding ノードのボックスを各軸に拡大する量 (0以上)
+    BvhRay(const Vector3d& origin, const Vector3d& direction,
+           const double padding = 0.0)
+            : origin_(origin), direction_(direction), padding_(padding) {
+        for (int axis = 0; axis < 3; ++axis) {
+            inverse_[axis] = (direction[axis] != 0.0)
+                           ? 1.0 / direction[axis] : 0.0;
+        }
+    }
+
+    /// @brief ノードのボックスとの交差区間の始点を求める
+    /// @param node 対象ノード
+    /// @param t_min パラメータ範囲の下限
+    /// @param t_max パラメータ範囲の上限
+    /// @return 交差する場合は区間 [t_min, t_max] に制限した進入パラメータ.
+    ///         交差しない場合は`std::nullopt`
+    /// @note 方向成分が0の軸はスラブの内外のみで判定する (0×∞によるNaNの回避)
+    std::optional<double> Enter(const BvhNode& node,
+                                double t_min, double t_max) const {
+        for (int axis = 0; axis < 3; ++axis) {
+            const double lower = node.lower[axis] - padding_;
+            const double upper = node.upper[axis] + padding_;
+            if (direction_[axis] == 0.0) {
+                if (origin_[axis] < lower || origin_[axis] > upper) {
+                    return std::nullopt;
+                }
+                continue;
+            }
+            double t0 = (lower - origin_[axis]) * inverse_[axis];
+            double t1 = (upper - origin_[axis]) * inverse_[axis];
+            if (t0 > t1) std::swap(t0, t1);
+            t_min = std::max(t_min, t0);
+            t_max = std::min(t_max, t1);
+            if (t_min > t_max) return std::nullopt;
+        }
+        return t_min;
+    }
+
+ private:
+    /// @brief 始点
+    Vector3d origin_;
+    /// @brief 方向ベクトル
+    Vector3d direction_;
+    /// @brief 方向ベクトルの各成分の逆数 (成分が0の軸は未使用)
+    Vector3d inverse_ = Vector3d::Zero();
+    /// @brief ノードのボックスの拡大量
+    double padding_ = 0.0;
+};
+
+}  // namespace detail
+
+/// @brief 線 p(t) = origin + t*direction から距離padding以内を通過しうる
+///        プリミティブを走査する
+/// @tparam Visitor `bool(std::uint32_t primitive, double& t_max)`の呼び出し可能型.
+///         t_maxを縮めると以降の走査範囲が狭まり (最近傍探索)、
+///         trueを返すと走査を打ち切る (任意ヒット探索)
+/// @param bvh 対象のBVH
+/// @param origin 線の始点
+/// @param direction 線の方向ベクトル (ゼロベクトルの場合は何も走査しない)
+/// @param t_min パラメータ範囲の下限 (-∞可)
+/// @param t_max パラメータ範囲の上限 (+∞可)
+/// @param padding 各ノードのボックスを各軸に拡大する量 (0以上).
+///        線からの距離に許容量を持つ判定 (曲線のピック等) に用いる
+/// @param visit 葉ノードの各プリミティブに対して呼ばれる処理
+/// @note 子ノードは進入パラメータの小さい順に訪問する. 進入パラメータが
+///       その時点のt_maxを超えるノードは訪問しない (t_maxと等しい場合は訪問する)
+template <typename Visitor>
+void TraverseBvh(const Bvh& bvh, const Vector3d& origin,
+                 const Vector3d& direction, const double t_min, double t_max,
+                 const double padding, Visitor&& visit) {
+    if (bvh.IsEmpty()) return;
+    if (direction[0] == 0.0 && direction[1] == 0.0 && direction[2] == 0.0) return;
+    const detail::BvhRay ray(origin, direction, padding);
+    const auto root_enter = ray.Enter(bvh.nodes[0], t_min, t_max);
+    if (!root_enter) return;
+
+    // (ノード番号, 進入パラメータ) のスタック
+    std::vector<std::pair<std::uint32_t, double>> stack;
+    stack.reserve(64);
+    stack.emplace_back(0, *root_enter);
+    while (!stack.empty()) {
+        const auto [index, enter] = stack.back();
+        stack.pop_back();
+        if (enter > t_max) continue;  // より近いヒットが見つかっている
+
+        const auto& node = bvh.nodes[index];
+        if (node.IsLeaf()) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+                if (visit(bvh.primitive_indices[i], t_max)) return;
+            }
+            continue;
+        }
+
+        // 遠い子を先に積み、近い子から訪問する
+        const auto left = ray.Enter(bvh.nodes[node.first], t_min, t_max);
+        const auto right = ray.Enter(bvh.nodes[node.first + 1], t_min, t_max);
+        if (left && right) {
+            if (*left <= *right) {
+                stack.emplace_back(node.first + 1, *right);
+                stack.emplace_back(node.first, *left);
+            } else {
+                stack.emplace_back(node.first, *left);
+                stack.emplace_back(node.first + 1, *right);
+            }
+        } else if (left) {
+            stack.emplace_back(node.first, *left);
+        } else if (right) {
+            stack.emplace_back(node.first + 1, *right);
+        }
+    }
+}
+
+/// @brief 線 p(t) = origin + t*direction と交差しうるプリミティブを走査する
+/// @tparam Visitor `bool(std::uint32_t primitive, double& t_max)`の呼び出し可能型.
+///         t_maxを縮めると以降の走査範囲が狭まり (最近傍探索)、
+///         trueを返すと走査を打ち切る (任意ヒット探索)
+/// @param bvh 対象のBVH
+/// @param origin 線の始点
+/// @param direction 線の方向ベクトル (ゼロベクトルの場合は何も走査しない)
+/// @param t_min パラメータ範囲の下限 (-∞可)
+/// @param t_max パラメータ範囲の上限 (+∞可)
+/// @param visit 葉ノードの各プリミティブに対して呼ばれる処理
+/// @note ボックスを拡大しない (padding = 0) 走査. 訪問順は上記と同じ
+template <typename Visitor>
+void TraverseBvh(const Bvh& bvh, const Vector3d& origin,
+                 const Vector3d& direction, const double t_min,
+                 const double t_max, Visitor&& visit) {
+    TraverseBvh(bvh, origin, direction, t_min, t_max, 0.0,
+                std::forward<Visitor>(visit));
+}
+
+/// @brief ボックスに対する判定で枝刈りしながらプリミティブを走査する
+/// @tparam Predicate `bool(const Vector3d& lower, const Vector3d& upper)`の
+///         呼び出し可能型. ボックス内にクエリ領域と重なる部分がありうる場合に
+///         trueを返すこと (falseを返したノードの部分木は訪問しない)
+/// @tparam Visitor `void(std::uint32_t primitive)`の呼び出し可能型
+/// @param bvh 対象のBVH
+/// @param may_overlap ノードのボックスに対する判定
+/// @param visit 判定を通過した葉ノードの各プリミティブに対して呼ばれる処理
+/// @note 視錐台・領域によるカリング等、線以外のクエリに用いる. 訪問順は不定
+template <typename Predicate, typename Visitor>
+void QueryBvh(const Bvh& bvh, Predicate&& may_overlap, Visitor&& visit) {
+    if (bvh.IsEmpty()) return;
+    std::vector<std::uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const auto& node = bvh.nodes[stack.back()];
+        stack.pop_back();
+        if (!may_overlap(node.lower, node.upper)) continue;
+        if (node.IsLeaf()) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+                visit(bvh.primitive_indices[i]);
+            }
+            continue;
+        }
+        stack.push_back(node.first + 1);
+        stack.push_back(node.first);
+    }
+}
+
+/// @brief 点からボックスまでの距離の2乗を求める
+/// @param point 点
+/// @param lower ボックスの最小点
+/// @param upper ボックスの最大点
+/// @return 距離の2乗. 点がボックス内にある場合は0
+inline double SquaredDistanceToBox(const Vector3d& point, const Vector3d& lower,
+                                   const Vector3d& upper) {
+    double distance_sq = 0.0;
+    for (int axis = 0; axis < 3; ++axis) {
+        const double excess = std::max({lower[axis] - point[axis],
+                                        point[axis] - upper[axis], 0.0});
+        distance_sq += excess * excess;
+    }
+    return distance_sq;
+}
+
+/// @brief 点に最も近いプリミティブを探索する (分枝限定法)
+/// @tparam Distance `double(std::uint32_t primitive)`の呼び出し可能型.
+///         点からプリミティブまでの距離の2乗を返すこと. プリミティブは
+///         自身のボックス内にあること (ボックスまでの距離を下界として枝刈りする)
+/// @param bvh 対象のBVH
+/// @param point 探索の基準点
+/// @param distance_sq プリミティブまでの距離の2乗を求める処理
+/// @return 距離が最小のプリミティブ (同じ距離の場合は番号が最小のもの).
+///         BVHが空の場合は`std::nullopt`
+/// @note 子ノードはボックスまでの距離の小さい順に訪問する
+template <typename Distance>
+std::optional<std::uint32_t> FindNearestInBvh(
+        const Bvh& bvh, const Vector3d& point, Distance&& distance_sq) {
+    if (bvh.IsEmpty()) return std::nullopt;
+    std::optional<std::uint32_t> nearest;
+    double best = std::numeric_limits<double>::infinity();
+
+    // (ノード番号, ボックスまでの距離の2乗) のスタック
+    std::vector<std::pair<std::uint32_t, double>> stack;
+    stack.reserve(64);
+    stack.emplace_back(0, SquaredDistanceToBox(
+            point, bvh.nodes[0].lower, bvh.nodes[0].upper));
+    while (!stack.empty()) {
+        const auto [index, bound] = stack.back();
+        stack.pop_back();
+        if (bound > best) continue;  // より近いプリミティブが見つかっている
+
+        const auto& node = bvh.nodes[index];
+        if (node.IsLeaf()) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+                const auto prim = bvh.primitive_indices[i];
+                const double d = distance_sq(prim);
+                if (d < best || (d == best && nearest && prim < *nearest)) {
+                    best = d;
+                    nearest = prim;
+                }
+            }
+            continue;
+        }
+
+        // 遠い子を先に積み、近い子から訪問する
+        const auto& left = bvh.nodes[node.first];
+        const auto& right = bvh.nodes[node.first + 1];
+        const double d_left = SquaredDistanceToBox(point, left.lower, left.upper);
+        const double d_right = SquaredDistanceToBox(point, right.lower, right.upper);
+        if (d_left <= d_right) {
+            stack.emplace_back(node.first + 1, d_right);
+            stack.emplace_back(node.first, d_left);
+        } else {
+            stack.emplace_back(node.first, d_left);
+            stack.emplace_back(node.first + 1, d_right);
+        }
+    }
+    return nearest;
+}
+
+/// @brief 2つのボックス間の距離の2乗を求める
+/// @param lower_a ボックスAの最小点
+/// @param upper_a ボックスAの最大点
+/// @param lower_b ボックスBの最小点
+/// @param upper_b ボックスBの最大点
+/// @return 距離の2乗. ボックスが重なる場合は0
+inline double SquaredDistanceBetweenBoxes(
+        const Vector3d& lower_a, const Vector3d& upper_a,
+        const Vector3d& lower_b, const Vector3d& upper_b) {
+    double distance_sq = 0.0;
+    for (int axis = 0; axis < 3; ++axis) {
+        const double gap = std::max({lower_a[axis] - upper_b[axis],
+                                     lower_b[axis] - upper_a[axis], 0.0});
+        distance_sq += gap * gap;
+    }
+    return distance_sq;
+}
+
+/// @brief 2つのBVHのプリミティブの組のうち、最も近い組を探索する (分枝限定法)
+/// @tparam Distance `double(std::uint32_t primitive_a, std::uint32_t primitive_b)`の
+///         呼び出し可能型. 組の距離の2乗を返すこと. プリミティブは自身の
+///         ボックス内にあること (ボックス間の距離を下界として枝刈りする)
+/// @param bvh_a 一方のBVH
+/// @param bvh_b 他方のBVH
+/// @param distance_sq プリミティブの組の距離の2乗を求める処理
+/// @param tolerance 枝刈りの許容量 (0以上). 下界の距離にこの値を加えても
+///        既知の最短距離を下回らないノードの組は訪問しない
+/// @return 距離が最小の組 (primitive_a, primitive_b). tolerance = 0の場合、
+///         同じ距離の組は (primitive_a, primitive_b) の辞書順で最小のもの.
+///         いずれかのBVHが空の場合は`std::nullopt`
+/// @note ノードの組は、葉でない側 (双方が葉でない場合はボックスの大きい側) を
+///       分割し、ボックス間の距離の小さい順に訪問する
+template <typename Distance>
+std::optional<std::pair<std::uint32_t, std::uint32_t>> FindNearestPairInBvhs(
+        const Bvh& bvh_a, const Bvh& bvh_b, Distance&& distance_sq,
+        const double tolerance = 0.0) {
+    if (bvh_a.IsEmpty() || bvh_b.IsEmpty()) return std::nullopt;
+    std::optional<std::pair<std::uint32_t, std::uint32_t>> nearest;
+    double best = std::numeric_limits<double>::infinity();
+    const auto pruned = [&](const double bound) {
+        return std::sqrt(bound) + tolerance > std::sqrt(best);
+    };
+    const auto bound_of = [&](const std::uint32_t a, const std::uint32_t b) {
+        return SquaredDistanceBetweenBoxes(
+                bvh_a.nodes[a].lower, bvh_a.nodes[a].upper,
+                bvh_b.nodes[b].lower, bvh_b.nodes[b].upper);
+    };
+
+    // (ノード番号A, ノード番号B, ボックス間の距離の2乗) のスタック
+    struct Entry {
+        std::uint32_t a;
+        std::uint32_t b;
+        double bound;
+    };
+    std::vector<Entry> stack;
+    stack.reserve(64);
+    stack.push_back({0, 0, bound_of(0, 0)});
+    while (!stack.empty()) {
+        const auto entry = stack.back();
+        stack.pop_back();
+        if (pruned(entry.bound)) continue;  // より近い組が見つかっている
+
+        const auto& node_a = bvh_a.nodes[entry.a];
+        const auto& node_b = bvh_b.nodes[entry.b];
+        if (node_a.IsLeaf() && node_b.IsLeaf()) {
+            for (std::uint32_t i = node_a.first; i < node_a.first + node_a.count; ++i) {
+                for (std::uint32_t j = node_b.first;
+                     j < node_b.first + node_b.count; ++j) {
+                    const std::pair<std::uint32_t, std::uint32_t> pair = {
+                            bvh_a.primitive_indices[i], bvh_b.primitive_indices[j]};
+                    const double d = distance_sq(pair.first, pair.second);
+                    if (d < best || (d == best && nearest && pair < *nearest)) {
+                        best = d;
+                        nearest = pair;
+                    }
+                }
+            }
+            continue;
+        }
+
+        // 分割する側を決め、遠い子の組を先に積む
+        const bool split_a = !node_a.IsLeaf() && (node_b.IsLeaf() ||
+                (node_a.upper - node_a.lower).squaredNorm() >=
+                (node_b.upper - node_b.lower).squaredNorm());
+        const auto& split = split_a ? node_a : node_b;
+        Entry first = split_a ? Entry{split.first, entry.b, 0.0}
+                              : Entry{entry.a, split.first, 0.0};
+        Entry second = split_a ? Entry{split.first + 1, entry.b, 0.0}
+                               : Entry{entry.a, split.first + 1, 0.0};
+        first.bound = bound_of(first.a, first.b);
+        second.bound = bound_of(second.a, second.b);
+        if (first.bound <= second.bound) {
+            stack.push_back(second);
+            stack.push_back(first);
+        } else {
+            stack.push_back(first);
+            stack.push_back(second);
+        }
+    }
+    return nearest;
+}
+
+}  // namespace igesio::numerics
+
+#endif  // IGESIO_NUMERICS_GEOMETRIC_BVH_H_
@@ -8,6 +8,8 @@
 #ifndef IGESIO_NUMERICS_GEOMETRIC_POLYGON_H_
 #define IGESIO_NUMERICS_GEOMETRIC_POLYGON_H_
 
+#include <cstdint>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -75,6 +77,91 @@ bool IsPointInPolygon(
     const Vector3d& point,
     const CurveContainmentPolygons& polygons);
 
+
+
+/**
+ * 内外判定の高速化
+ */
+
+/// @brief 1つの多角形の辺を格子のセル・行ごとに分類した索引
+/// @note PolygonContainmentGridの構成要素. 辺iは頂点iから頂点 (i+1) % M への辺
+struct PolygonEdgeGrid {
+    /// @brief cell_windingにおいて、winding numberがセル内で一定でないことを表す値
+    static constexpr int kVaryingWinding = std::numeric_limits<int>::min();
+
+    /// @brief 各行 (y方向の帯) と交わる辺の、row_edges内の範囲 (ny+1要素)
+    std::vector<std::uint32_t> row_offsets;
+    /// @brief 各行と交わる辺の番号 (行ごとに連続して格納)
+    std::vector<std::uint32_t> row_edges;
+    /// @brief 各セルと交わる辺の、cell_edges内の範囲 (nx*ny+1要素)
+    std::vector<std::uint32_t> cell_offsets;
+    /// @brief 各セルと交わる辺の番号 (セルごとに連続して格納)
+    std::vector<std::uint32_t> cell_edges;
+    /// @brief 辺と交わらないセルのwinding number (セル内で一定).
+    ///        辺と交わるセルはkVaryingWinding
+    std::vector<int> cell_winding;
+};
+
+/// @brief CurveContainmentPolygonsの内外判定を高速化する一様格子
+///
+/// 外包・内包多角形を包含する矩形をnx×nyのセルに分割し、各セル・各行と
+/// 交わる辺を保持する. 辺と交わらないセルはwinding numberを事前に求めておく
+/// ため、境界から離れた点の判定はO(1)、境界付近の点の判定は近傍の辺の数に
+/// 比例する時間で行える.
+/// @note 辺とセルの対応は辺のバウンディングボックスにより保守的に求める
+/// @note 構築元の多角形の頂点を参照せずに保持するため、多角形を変更した場合は
+///       再構築すること
+struct PolygonContainmentGrid {
+    /// @brief 格子の範囲の最小x座標
+    double x_min = 0.0;
+    /// @brief 格子の範囲の最小y座標
+    double y_min = 0.0;
+    /// @brief 格子の範囲の最大x座標
+    double x_max = 0.0;
+    /// @brief 格子の範囲の最大y座標
+    double y_max = 0.0;
+    /// @brief x方向のセル幅の逆数 (範囲の幅が0の場合は0)
+    double inv_cell_width = 0.0;
+    /// @brief y方向のセル幅の逆数 (範囲の幅が0の場合は0)
+    double inv_cell_height = 0.0;
+    /// @brief 隣接セル間の距離の下限 (最近傍辺の探索の打ち切りに使用する)
+    double cell_size = 0.0;
+    /// @brief セル番号の丸め誤差に備えた距離の余裕
+    double slack = 0.0;
+    /// @brief x方向のセル数 (0の場合は格子が無効)
+    int nx = 0;
+    /// @brief y方向のセル数
+    int ny = 0;
+    /// @brief 外包多角形の辺の索引
+    PolygonEdgeGrid circumscribed;
+    /// @brief 内包多角形の辺の索引
+    PolygonEdgeGrid inscribed;
+    /// @brief 近似多角形のcurve_paramsが昇順に並んでいるか (二分探索の可否)
+    bool approximate_sorted = false;
+
+    /// @brief 格子が無効 (構築されていない) か
+    bool IsEmpty() const noexcept { return nx == 0; }
+};
+
+/// @brief 内外判定を高速化する格子を構築する
+/// @param polygons 閉曲線C(u)の内包・外包・近似多角形
+/// @return 構築した格子. 頂点に有限でない座標が含まれる場合などは無効な格子
+/// @note セル数は外包・内包多角形の辺の総数と同程度となるよう決める
+PolygonContainmentGrid BuildPolygonContainmentGrid(
+    const CurveContainmentPolygons& polygons);
+
+/// @brief 格子を用いて、点が閉曲線C(u)の内部に存在するかを判定する
+/// @param point 判定する点 (x, y 成分のみ使用)
+/// @param polygons 閉曲線C(u)の内包・外包・近似多角形
+/// @param grid polygonsから構築した格子 (BuildPolygonContainmentGrid)
+/// @return 点が曲線C(u)の内部に存在する場合 true.
+///         IsPointInPolygon(point, polygons) と同じ結果を返す
+/// @note gridが無効な場合はIsPointInPolygon(point, polygons)に委譲する
+bool IsPointInPolygon(
+    const Vector3d& point,
+    const CurveContainmentPolygons& polygons,
+    const PolygonContainmentGrid& grid);
+
 }  // namespace igesio::numerics
 
 #endif  // IGESIO_NUMERICS_GEOMETRIC_POLYGON_H_
@@ -0,0 +1,50 @@
+/**
+ * @file numerics/geometric/polygon_triangulation.h
+ * @brief 穴あき多角形の三角形分割 (耳切り法)
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * 外周と穴からなる平面多角形を、頂点を追加せずに三角形分割する.
+ * 各穴は、穴の最も右 (x最大) の頂点から外周へ橋 (往復する2辺) を架けて
+ * 外周に併合し (Eberlyの方法)、得られた1つの多角形を耳切り法で分割する.
+ * 耳は新たに生じる対角線が最短のものから切り、帯状の多角形でも1頂点からの
+ * 扇状の細い三角形が生じないようにする.
+ *
+ * 出力の三角形は入力の全ての辺をちょうど1回ずつ含む (橋は往復で相殺される).
+ * このため、辺を共有する複数の多角形を別々に分割しても、分割結果は共有辺で
+ * 隙間なく接続される.
+ */
+#ifndef IGESIO_NUMERICS_GEOMETRIC_POLYGON_TRIANGULATION_H_
+#define IGESIO_NUMERICS_GEOMETRIC_POLYGON_TRIANGULATION_H_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+
+
+
+namespace igesio::numerics {
+
+/// @brief 穴あき多角形を耳切り法で三角形分割する
+/// @param points 頂点座標
+/// @param outer 外周の頂点番号 (pointsの添字. 向きは問わない)
+/// @param holes 各穴の頂点番号 (向きは問わない)
+/// @return 三角形 (pointsの添字の3つ組. いずれも反時計回り)
+/// @throw std::out_of_range 頂点番号がpointsの範囲外の場合
+/// @note 外周・穴は互いに交差せず、各穴が外周の内部にあることを前提とする.
+///       n頂点・h個の穴の多角形から n + 2h - 2 個の三角形を生成する.
+///       自己交差などで耳が見つからない場合も分割を続け (向きの反転した三角形を
+///       含みうる)、入力の辺をちょうど1回ずつ含むという性質は保つ
+/// @note 3頂点未満のループは無視する
+std::vector<std::array<std::uint32_t, 3>> TriangulatePolygon(
+        const std::vector<Vector2d>& points,
+        const std::vector<std::uint32_t>& outer,
+        const std::vector<std::vector<std::uint32_t>>& holes = {});
+
+}  // namespace igesio::numerics
+
+#endif  // IGESIO_NUMERICS_GEOMETRIC_POLYGON_TRIANGULATION_H_
@@ -0,0 +1,114 @@
+/**
+ * @file numerics/meshes/algorithms/adjacency.h
+ * @brief 三角形メッシュ (TriangleMeshT) の隣接関係 (頂点→三角形・エッジ→三角形)
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * 法線の再計算 (RecomputeNormals)・エッジ抽出 (ExtractMeshEdges)・簡略化
+ * (SimplifyMesh) が共有する隣接関係. 一度構築して各アルゴリズムへ渡すことで、
+ * それぞれが隣接関係を作り直すことを避ける.
+ *
+ * ハッシュ表は使わず、エッジを64bit整数へパックしたキー (頂点番号を
+ * キーとした三角形の一覧も同様) をLSD基数ソートで並べて構築する.
+ * 基数ソートはチャンクごとのヒストグラムと散布に分けて並列に実行するため、
+ * 数千万三角形のメッシュでも各段が線形時間でスレッド数に応じて速くなる.
+ * 基数ソートは安定なため、結果はスレッド数によらず同一となる.
+ */
+#ifndef IGESIO_NUMERICS_MESHES_ALGORITHMS_ADJACENCY_H_
+#define IGESIO_NUMERICS_MESHES_ALGORITHMS_ADJACENCY_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "igesio/numerics/meshes/triangle_mesh.h"
+
+
+
+namespace igesio::numerics {
+
+/// @brief メッシュのアルゴリズムを並列に実行する最小の三角形数
+/// @note これ未満のメッシュではスレッド生成の負担が上回るため直列で実行する
+inline constexpr std::size_t kMinParallelTriangleCount = 65536;
+
+/// @brief メッシュの隣接関係 (CSR形式)
+/// @note 同じ頂点を複数回含む退化三角形は、頂点の一覧にその回数だけ現れる.
+///       同一頂点を結ぶ長さゼロのエッジは列挙しない
+struct MeshAdjacency {
+    /// @brief 頂点ごとの三角形の一覧の開始位置 (頂点数+1要素)
+    std::vector<std::uint32_t> vertex_offsets;
+    /// @brief 頂点ごとの三角形の一覧 (各頂点の中では三角形番号の昇順)
+    std::vector<std::uint32_t> vertex_triangles;
+    /// @brief ユニークエッジ (各ペアは昇順; [0] < [1]. 全体も辞書順に並ぶ)
+    std::vector<std::array<std::uint32_t, 2>> edges;
+    /// @brief エッジごとの三角形の一覧の開始位置 (エッジ数+1要素)
+    std::vector<std::uint32_t> edge_offsets;
+    /// @brief エッジごとの三角形の一覧 (各エッジの中では三角形番号の昇順)
+    std::vector<std::uint32_t> edge_triangles;
+
+    /// @brief 頂点数を取得する
+    std::size_t VertexCount() const {
+        return vertex_offsets.empty() ? 0 : vertex_offsets.size() - 1;
+    }
+    /// @brief ユニークエッジ数を取得する
+    std::size_t EdgeCount() const { return edges.size(); }
+    /// @brief 頂点を含む三角形の数 (退化三角形は含む回数だけ数える)
+    std::size_t VertexTriangleCount(const std::size_t vertex) const {
+        return vertex_offsets[vertex + 1] - vertex_offsets[vertex];
+    }
+    /// @brief エッジを含む三角形の数 (1=境界, 2=多様体, 3以上=非多様体)
+    std::size_t EdgeTriangleCount(const std::size_t edge) const {
+        return edge_offsets[edge + 1] - edge_offsets[edge];
+    }
+};
+
+/// @brief インデックス列から隣接関係を構築する
+/// @param indices 三角形インデックス (3要素で1三角形. 端数は無視する)
+/// @param vertex_count 頂点数 (indicesの各値はこれ未満であること)
+/// @param with_vertex_triangles 頂点→三角形の一覧を構築するか
+///        (falseの場合vertex_offsets/vertex_trianglesは空. エッジのみが必要な場合に使う)
+/// @return 隣接関係
+MeshAdjacency BuildMeshAdjacency(const std::vector<std::uint32_t>& indices,
+                                 const std::size_t vertex_count,
+                                 const bool with_vertex_triangles = true);
+
+/// @brief メッシュの隣接関係を構築する
+/// @param mesh 対象のメッシュ (Validateを通る整合したメッシュであること)
+/// @param with_vertex_triangles 頂点→三角形の一覧を構築するか
+template <typename Scalar>
+MeshAdjacency BuildMeshAdjacency(const TriangleMeshT<Scalar>& mesh,
+                                 const bool with_vertex_triangles = true) {
+    return BuildMeshAdjacency(mesh.indices, mesh.VertexCount(), with_vertex_triangles);
+}
+
+/// @brief インデックス列から全ユニークエッジを抽出する
+/// @param indices 三角形インデックス (3要素で1三角形. 端数は無視する)
+/// @param vertex_count 頂点数 (indicesの各値はこれ未満であること)
+/// @return 全ユニークエッジ (各ペアは昇順; [0] < [1]. 全体も辞書順に並ぶ)
+/// @note 三角形の一覧を持たないため、BuildMeshAdjacencyより軽い
+std::vector<std::array<std::uint32_t, 2>> ExtractUniqueEdges(
+        const std::vector<std::uint32_t>& indices, const std::size_t vertex_count);
+
+namespace detail {
+
+/// @brief キー (と付随する値) を安定に並べるLSD基数ソート (隣接関係の構築の内部実装)
+/// @param[in,out] keys キー (ビット [first_bit, last_bit) のみを比較する)
+/// @param[in,out] values 付随する値 (keysと同じ長さ. nullptrの場合はキーのみ)
+/// @param first_bit 比較する最下位ビット
+/// @param last_bit 比較する最上位ビットの次のビット
+/// @param chunk_count 要素列を分割するチャンクの数 (各チャンクを並列に処理する)
+/// @note 結果はchunk_countによらず同一. BuildMeshAdjacency等はチャンク数を
+///       要素数とハードウェア並列度から決める
+void RadixSortKeys(std::vector<std::uint64_t>& keys,
+                   std::vector<std::uint32_t>* values,
+                   const unsigned int first_bit, const unsigned int last_bit,
+                   const std::size_t chunk_count);
+
+}  // namespace detail
+
+}  // namespace igesio::numerics
+
+#endif  // IGESIO_NUMERICS_MESHES_ALGORITHMS_ADJACENCY_H_
@@ -8,12 +8,13 @@
 #ifndef IGESIO_NUMERICS_MESHES_ALGORITHMS_EDGES_H_
 #define IGESIO_NUMERICS_MESHES_ALGORITHMS_EDGES_H_
 
-#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
 
+#include "igesio/common/parallel.h"
+#include "igesio/numerics/meshes/algorithms/adjacency.h"
 #include "igesio/numerics/meshes/algorithms/normals.h"
 #include "igesio/numerics/meshes/triangle_mesh.h"
 
@@ -29,8 +30,10 @@ struct MeshEdgeSet {
     std::vector<std::array<std::uint32_t, 2>> feature_edges;
 };
 
-/// @brief メッシュのユニークエッジと特徴エッジを抽出する
+/// @brief メッシュのユニークエッジと特徴エッジを抽出する (構築済みの隣接関係を用いる)
 /// @param mesh 対象のメッシュ (Validateを通る整合したメッシュであること)
+/// @param adjacency meshの隣接関係 (BuildMeshAdjacency(mesh)の結果.
+///        頂点→三角形の一覧は用いない)
 /// @param crease_angle_cos 折り目判定のしきい値. 隣接2面の単位面法線の内積が
 ///        この値を下回るエッジを折り目とする (例: cos(30°))
 /// @return エッジ抽出結果. 特徴エッジは以下のいずれかを満たすエッジ:
@@ -39,100 +42,69 @@ struct MeshEdgeSet {
 ///         - 折り目 (隣接2枚の面法線の内積がしきい値未満)
 ///         - 退化三角形が隣接する (面法線が計算不能のため安全側で特徴扱い)
 /// @note 同一頂点を結ぶ長さゼロのエッジ (退化三角形の重複インデックス) は
-///       列挙から除外する
+///       列挙から除外する. エッジの分類は大規模なメッシュでは並列に行う
 template <typename Scalar>
 MeshEdgeSet ExtractMeshEdges(const TriangleMeshT<Scalar>& mesh,
+                             const MeshAdjacency& adjacency,
                              const double crease_angle_cos) {
     MeshEdgeSet result;
-    const auto triangle_count = mesh.TriangleCount();
-    if (triangle_count == 0) return result;
+    if (mesh.TriangleCount() == 0) return result;
 
     const auto face_normals = ComputeFaceNormals(mesh);
 
-    // (小さい頂点番号, 大きい頂点番号, 三角形番号) を全三角形分列挙する
-    struct EdgeRecord {
-        std::uint32_t v0, v1, tri;
-    };
-    std::vector<EdgeRecord> records;
-    records.reserve(mesh.indices.size());
-    for (std::size_t t = 0; t < triangle_count; ++t) {
-        for (int k = 0; k < 3; ++k) {
-            const auto a = mesh.indices[3 * t + k];
-            const auto b = mesh.indices[3 * t + (k + 1) % 3];
-            if (a == b) continue;  // 長さゼロのエッジは除外
-            records.push_back({std::min(a, b), std::max(a, b),
-                               static_cast<std::uint32_t>(t)});
+    // エッジごとの隣接三角形の数と二面角で分類する
+    const auto edge_count = adjacency.EdgeCount();
+    std::vector<std::uint8_t> is_feature(edge_count, 0);
+    ParallelFor(edge_count, [&](const std::size_t e) {
+        const std::size_t adjacent_count = adjacency.EdgeTriangleCount(e);
+        if (adjacent_count != 2) {  // 境界または非多様体
+            is_feature[e] = 1;
+            return;
         }
-    }
-    std::sort(records.begin(), records.end(),
-              [](const EdgeRecord& l, const EdgeRecord& r) {
-                  return (l.v0 != r.v0) ? (l.v0 < r.v0) : (l.v1 < r.v1);
-              });
-
-    // 同一 (v0, v1) のラン = 1ユニークエッジとして隣接数と二面角で分類する
-    for (std::size_t i = 0; i < records.size();) {
-        std::size_t j = i;
-        while (j < records.size() && records[j].v0 == records[i].v0 &&
-               records[j].v1 == records[i].v1) {
-            ++j;
+        const auto first = adjacency.edge_offsets[e];
+        const auto n0 = face_normals.col(adjacency.edge_triangles[first]);
+        const auto n1 = face_normals.col(adjacency.edge_triangles[first + 1]);
+        if (n0.squaredNorm() == Scalar(0) || n1.squaredNorm() == Scalar(0)) {
+            is_feature[e] = 1;  // 退化三角形絡みは安全側で特徴扱い
+        } else {
+            is_feature[e] = static_cast<double>(n0.dot(n1)) < crease_angle_cos;
         }
-        const std::array<std::uint32_t, 2> edge = {records[i].v0, records[i].v1};
-        result.all_edges.push_back(edge);
+    }, kMinParallelTriangleCount);
 
-        const std::size_t adjacent_count = j - i;
-        bool is_feature = (adjacent_count != 2);  // 境界または非多様体
-        if (adjacent_count == 2) {
-            const auto n0 = face_normals.col(records[i].tri);
-            const auto n1 = face_normals.col(records[i + 1].tri);
-            if (n0.squaredNorm() == Scalar(0) || n1.squaredNorm() == Scalar(0)) {
-                is_feature = true;  // 退化三角形絡みは安全側で特徴扱い
-            } else {
-                is_feature = static_cast<double>(n0.dot(n1)) < crease_angle_cos;
-            }
-        }
-        if (is_feature) result.feature_edges.push_back(edge);
-        i = j;
+    result.all_edges = adjacency.edges;
+    for (std::size_t e = 0; e < edge_count; ++e) {
+        if (is_feature[e]) result.feature_edges.push_back(adjacency.edges[e]);
     }
     return result;
 }
 
+/// @brief メッシュのユニークエッジと特徴エッジを抽出する
+/// @param mesh 対象のメッシュ (Validateを通る整合したメッシュであること)
+/// @param crease_angle_cos 折り目判定のしきい値 (詳細は隣接関係を受け取る多重定義を参照)
+/// @return エッジ抽出結果
+/// @note 隣接関係を構築して抽出する. 隣接関係を他のアルゴリズム (法線の再計算等)
+///       と共有する場合は、隣接関係を受け取る多重定義を使うこと
+template <typename Scalar>
+MeshEdgeSet ExtractMeshEdges(const TriangleMeshT<Scalar>& mesh,
+                             const double crease_angle_cos) {
+    if (mesh.TriangleCount() == 0) return {};
+    return ExtractMeshEdges(mesh, BuildMeshAdjacency(mesh, false), crease_angle_cos);
+}
+
 /// @brief メッシュの全ユニークエッジを抽出する (分類なしの軽量版)
 /// @param mesh 対象のメッシュ (Validateを通る整合したメッシュであること)
 /// @return 全ユニークエッジ (各ペアは昇順; [0] < [1]).
 ///         ExtractMeshEdgesのall_edgesと同じ集合
-/// @note 特徴エッジの分類 (面法線計算・隣接数の評価) を行わないため、
-///       エッジ集合だけが必要な用途 (範囲選択サンプリング等) では
+/// @note 特徴エッジの分類 (面法線計算・隣接数の評価) と三角形の一覧の構築を
+///       行わないため、エッジ集合だけが必要な用途 (範囲選択サンプリング等) では
 ///       ExtractMeshEdgesより大幅に軽い. エッジを64bit整数へパックして
-///       PODソートでユニーク化する
+///       基数ソートでユニーク化する (大規模なメッシュでは並列に行う)
 /// @note 同一頂点を結ぶ長さゼロのエッジ (退化三角形の重複インデックス) は
 ///       列挙から除外する
 template <typename Scalar>
 std::vector<std::array<std::uint32_t, 2>> ExtractUniqueEdges(
         const TriangleMeshT<Scalar>& mesh) {
-    // (小頂点番号 << 32) | 大頂点番号 へパックして全エッジを列挙する
-    std::vector<std::uint64_t> packed;
-    packed.reserve(mesh.indices.size());
-    const auto triangle_count = mesh.TriangleCount();
-    for (std::size_t t = 0; t < triangle_count; ++t) {
-        for (int k = 0; k < 3; ++k) {
-            const auto a = mesh.indices[3 * t + k];
-            const auto b = mesh.indices[3 * t + (k + 1) % 3];
-            if (a == b) continue;  // 長さゼロのエッジは除外
-            packed.push_back(
-                    (static_cast<std::uint64_t>(std::min(a, b)) << 32) |
-                    static_cast<std::uint64_t>(std::max(a, b)));
-        }
-    }
-    std::sort(packed.begin(), packed.end());
-    packed.erase(std::unique(packed.begin(), packed.end()), packed.end());
-
-    std::vector<std::array<std::uint32_t, 2>> edges;
-    edges.reserve(packed.size());
-    for (const auto key : packed) {
-        edges.push_back({static_cast<std::uint32_t>(key >> 32),
-                         static_cast<std::uint32_t>(key & 0xffffffffULL)});
-    }
-    return edges;
+    return ExtractUniqueEdges(mesh.indices, mesh.VertexCount());
 }
 
 }  // namespace igesio::numerics
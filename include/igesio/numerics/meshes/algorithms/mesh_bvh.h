@@ -0,0 +1,253 @@
+/**
+ * @file numerics/meshes/algorithms/mesh_bvh.h
+ * @brief BVHを用いた三角形メッシュ (TriangleMeshT) と直線/半直線/線分の交差判定
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 三角形のバウンディングボックスからBVH (numerics/geometric/bvh.h) を
+ *       構築し、線形走査版 (mesh_line_intersection.h) と同じ判定・同じ結果を
+ *       部分木の枝刈りにより高速に求める. 最近傍・任意ヒット・全ヒットの
+ *       各クエリと、複数の線をまとめて判定する (並列実行する) 版を提供する.
+ */
+#ifndef IGESIO_NUMERICS_MESHES_ALGORITHMS_MESH_BVH_H_
+#define IGESIO_NUMERICS_MESHES_ALGORITHMS_MESH_BVH_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "igesio/common/parallel.h"
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/geometric/bounding_box.h"
+#include "igesio/numerics/geometric/bvh.h"
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/numerics/meshes/algorithms/mesh_line_intersection.h"
+
+
+
+namespace igesio::numerics {
+
+/// @brief 複数の線による一括判定の各クエリ
+struct MeshLineQuery {
+    /// @brief 線の始点
+    Vector3d p0 = Vector3d::Zero();
+    /// @brief 線の方向を定める点 (方向ベクトルはp1-p0)
+    Vector3d p1 = Vector3d::Zero();
+};
+
+/// @brief メッシュの三角形に対するBVHを構築する
+/// @tparam Scalar メッシュのスカラー型 (float / double)
+/// @param mesh 対象のメッシュ (Validateを通る整合したメッシュであること)
+/// @param params 構築の制御パラメータ
+/// @return プリミティブ番号を三角形番号とするBVH
+/// @note BVHはメッシュの頂点位置・インデックスを参照せずに保持するため、
+///       メッシュを変更した場合は再構築すること
+template <typename Scalar>
+Bvh BuildMeshBvh(const TriangleMeshT<Scalar>& mesh,
+                 const BvhBuildParams& params = {}) {
+    const auto triangle_count = mesh.TriangleCount();
+    std::vector<Vector3d> lowers(triangle_count), uppers(triangle_count);
+    for (std::size_t tri = 0; tri < triangle_count; ++tri) {
+        Vector3d lower =
+                mesh.positions.col(mesh.indices[3 * tri]).template cast<double>();
+        Vector3d upper = lower;
+        for (int k = 1; k < 3; ++k) {
+            const Vector3d v = mesh.positions.col(
+                    mesh.indices[3 * tri + k]).template cast<double>();
+            for (int axis = 0; axis < 3; ++axis) {
+                lower[axis] = std::min(lower[axis], v[axis]);
+                upper[axis] = std::max(upper[axis], v[axis]);
+            }
+        }
+        lowers[tri] = lower;
+        uppers[tri] = upper;
+    }
+    return BuildBvh(lowers, uppers, params);
+}
+
+/// @brief BVHを用いてメッシュと直線/半直線/線分の交差点を求める
+/// @tparam Scalar メッシュのスカラー型 (float / double. 計算はdoubleで行う)
+/// @param mesh 対象のメッシュ
+/// @param bvh meshから構築したBVH (BuildMeshBvh)
+/// @param p0 線の始点
+/// @param p1 線の方向を定める点 (方向ベクトルはp1-p0)
+/// @param direction_type 線の種類 (kSegment: 0<=t<=1, kRay: t>=0, kLine: 制限なし)
+/// @param params 交差判定の制御パラメータ
+/// @return 交差点のリスト. 線形走査版のIntersectMeshWithLineと同じ結果
+///         (t昇順・重複除去済み) を返す
+template <typename Scalar>
+std::vector<MeshRayHit> IntersectMeshWithLine(
+        const TriangleMeshT<Scalar>& mesh, const Bvh& bvh,
+        const Vector3d& p0, const Vector3d& p1,
+        const BoundingBox::DirectionType direction_type,
+        const MeshIntersectionParams& params = {}) {
+    std::vector<MeshRayHit> hits;
+    const Vector3d dir = p1 - p0;
+    const double dir_norm = dir.norm();
+    if (dir_norm == 0.0) return hits;  // 方向が定義できない
+
+    const auto t_range = detail::LineParameterRange(direction_type);
+    TraverseBvh(bvh, p0, dir, t_range.first, t_range.second,
+                [&](const std::uint32_t tri, double&) {
+        if (auto hit = detail::IntersectTriangle(
+                    mesh, tri, p0, dir, dir_norm, t_range, params)) {
+            hits.push_back(*hit);
+        }
+        return false;
+    });
+    return detail::SortAndDeduplicateHits(
+            std::move(hits), dir_norm, params.dedup_tol);
+}
+
+/// @brief BVHを用いてメッシュと直線/半直線/線分の最も近い交差点を求める
+/// @tparam Scalar メッシュのスカラー型 (float / double. 計算はdoubleで行う)
+/// @param mesh 対象のメッシュ
+/// @param bvh meshから構築したBVH (BuildMeshBvh)
+/// @param p0 線の始点
+/// @param p1 線の方向を定める点 (方向ベクトルはp1-p0)
+/// @param direction_type 線の種類 (kSegment: 0<=t<=1, kRay: t>=0, kLine: 制限なし)
+/// @param params 交差判定の制御パラメータ (parallel_tolのみ使用する)
+/// @return tが最小の交差点 (同じtの場合は三角形番号が最小のもの).
+///         IntersectMeshWithLineの先頭要素と一致する. 交差しない場合は`std::nullopt`
+/// @note kLineの場合は「最も近い」ではなくtが最小 (負の側で最も遠い) の
+///       交差点となる
+template <typename Scalar>
+std::optional<MeshRayHit> FindClosestMeshHit(
+        const TriangleMeshT<Scalar>& mesh, const Bvh& bvh,
+        const Vector3d& p0, const Vector3d& p1,
+        const BoundingBox::DirectionType direction_type,
+        const MeshIntersectionParams& params = {}) {
+    const Vector3d dir = p1 - p0;
+    const double dir_norm = dir.norm();
+    if (dir_norm == 0.0) return std::nullopt;
+
+    std::optional<MeshRayHit> closest;
+    const auto t_range = detail::LineParameterRange(direction_type);
+    TraverseBvh(bvh, p0, dir, t_range.first, t_range.second,
+                [&](const std::uint32_t tri, double& t_max) {
+        const auto hit = detail::IntersectTriangle(
+                mesh, tri, p0, dir, dir_norm, {t_range.first, t_max}, params);
+        if (hit && (!closest || hit->t < closest->t ||
+                    (hit->t == closest->t &&
+                     hit->triangle_index < closest->triangle_index))) {
+            closest = hit;
+            t_max = hit->t;  // これより遠い部分木は訪問しない
+        }
+        return false;
+    });
+    return closest;
+}
+
+/// @brief BVHを用いてメッシュと直線/半直線/線分が交差するかを判定する
+/// @tparam Scalar メッシュのスカラー型 (float / double. 計算はdoubleで行う)
+/// @param mesh 対象のメッシュ
+/// @param bvh meshから構築したBVH (BuildMeshBvh)
+/// @param p0 線の始点
+/// @param p1 線の方向を定める点 (方向ベクトルはp1-p0)
+/// @param direction_type 線の種類 (kSegment: 0<=t<=1, kRay: t>=0, kLine: 制限なし)
+/// @param params 交差判定の制御パラメータ (parallel_tolのみ使用する)
+/// @return いずれかの三角形と交差する場合はtrue
+/// @note 最初に見つかった交差で走査を打ち切る (遮蔽判定等に使用する)
+template <typename Scalar>
+bool HasMeshHit(
+        const TriangleMeshT<Scalar>& mesh, const Bvh& bvh,
+        const Vector3d& p0, const Vector3d& p1,
+        const BoundingBox::DirectionType direction_type,
+        const MeshIntersectionParams& params = {}) {
+    const Vector3d dir = p1 - p0;
+    const double dir_norm = dir.norm();
+    if (dir_norm == 0.0) return false;
+
+    bool found = false;
+    const auto t_range = detail::LineParameterRange(direction_type);
+    TraverseBvh(bvh, p0, dir, t_range.first, t_range.second,
+                [&](const std::uint32_t tri, double&) {
+        found = detail::IntersectTriangle(
+                mesh, tri, p0, dir, dir_norm, t_range, params).has_value();
+        return found;
+    });
+    return found;
+}
+
+
+
+/**
+ * 複数の線による一括判定
+ */
+
+/// @brief 複数の線について、メッシュとの交差点をまとめて求める
+/// @tparam Scalar メッシュのスカラー型 (float / double)
+/// @param mesh 対象のメッシュ
+/// @param bvh meshから構築したBVH (BuildMeshBvh)
+/// @param lines 線のリスト
+/// @param direction_type 線の種類 (全ての線で共通)
+/// @param params 交差判定の制御パラメータ
+/// @return 各線の交差点のリスト (linesと同じ順序)
+/// @note 線ごとに並列に判定する (common/parallel.h)
+template <typename Scalar>
+std::vector<std::vector<MeshRayHit>> IntersectMeshWithLines(
+        const TriangleMeshT<Scalar>& mesh, const Bvh& bvh,
+        const std::vector<MeshLineQuery>& lines,
+        const BoundingBox::DirectionType direction_type,
+        const MeshIntersectionParams& params = {}) {
+    std::vector<std::vector<MeshRayHit>> results(lines.size());
+    ParallelFor(lines.size(), [&](const std::size_t i) {
+        results[i] = IntersectMeshWithLine(
+                mesh, bvh, lines[i].p0, lines[i].p1, direction_type, params);
+    });
+    return results;
+}
+
+/// @brief 複数の線について、メッシュとの最も近い交差点をまとめて求める
+/// @tparam Scalar メッシュのスカラー型 (float / double)
+/// @param mesh 対象のメッシュ
+/// @param bvh meshから構築したBVH (BuildMeshBvh)
+/// @param lines 線のリスト
+/// @param direction_type 線の種類 (全ての線で共通)
+/// @param params 交差判定の制御パラメータ
+/// @return 各線の最も近い交差点 (linesと同じ順序. 交差しない線は`std::nullopt`)
+/// @note 線ごとに並列に判定する (common/parallel.h)
+template <typename Scalar>
+std::vector<std::optional<MeshRayHit>> FindClosestMeshHits(
+        const TriangleMeshT<Scalar>& mesh, const Bvh& bvh,
+        const std::vector<MeshLineQuery>& lines,
+        const BoundingBox::DirectionType direction_type,
+        const MeshIntersectionParams& params = {}) {
+    std::vector<std::optional<MeshRayHit>> results(lines.size());
+    ParallelFor(lines.size(), [&](const std::size_t i) {
+        results[i] = FindClosestMeshHit(
+                mesh, bvh, lines[i].p0, lines[i].p1, direction_type, params);
+    });
+    return results;
+}
+
+/// @brief 複数の線について、メッシュと交差するかをまとめて判定する
+/// @tparam Scalar メッシュのスカラー型 (float / double)
+/// @param mesh 対象のメッシュ
+/// @param bvh meshから構築したBVH (BuildMeshBvh)
+/// @param lines 線のリスト
+/// @param direction_type 線の種類 (全ての線で共通)
+/// @param params 交差判定の制御パラメータ
+/// @return 各線が交差するか (linesと同じ順序)
+/// @note 線ごとに並列に判定する (common/parallel.h). std::vector<bool>は
+///       要素ごとの並列書き込みができないため、判定結果は一時配列へ書き込む
+template <typename Scalar>
+std::vector<bool> HasMeshHits(
+        const TriangleMeshT<Scalar>& mesh, const Bvh& bvh,
+        const std::vector<MeshLineQuery>& lines,
+        const BoundingBox::DirectionType direction_type,
+        const MeshIntersectionParams& params = {}) {
+    std::vector<char> found(lines.size(), 0);
+    ParallelFor(lines.size(), [&](const std::size_t i) {
+        found[i] = HasMeshHit(mesh, bvh, lines[i].p0, lines[i].p1,
+                              direction_type, params) ? 1 : 0;
+    });
+    return std::vector<bool>(found.begin(), found.end());
+}
+
+}  // namespace igesio::numerics
+
+#endif  // IGESIO_NUMERICS_MESHES_ALGORITHMS_MESH_BVH_H_
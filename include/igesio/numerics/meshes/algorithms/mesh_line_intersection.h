@@ -4,9 +4,8 @@
  * @author Yayoi Habami
  * @date 2026-06-11
  * @copyright 2026 Yayoi Habami
- * @note Möller–Trumbore法による全三角形の線形走査. ピッキングのような
- *       単発のクエリには十分な性能のため、加速構造 (BVH等) は必要になった
- *       時点で本階層へ追加する (将来課題).
+ * @note Möller–Trumbore法による全三角形の線形走査. 大規模メッシュや
+ *       多数のクエリにはBVHを用いる版 (mesh_bvh.h) を使用すること.
  */
 #ifndef IGESIO_NUMERICS_MESHES_ALGORITHMS_MESH_LINE_INTERSECTION_H_
 #define IGESIO_NUMERICS_MESHES_ALGORITHMS_MESH_LINE_INTERSECTION_H_
@@ -14,6 +13,9 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "igesio/numerics/core/matrix.h"
@@ -54,6 +56,106 @@ struct MeshIntersectionParams {
     double dedup_tol = 1e-6;
 };
 
+namespace detail {
+
+/// @brief 線種に対応する線パラメータの範囲を取得する
+/// @param direction_type 線の種類
+/// @return (t_min, t_max). kSegment: [0, 1], kRay: [0, ∞), kLine: (-∞, ∞)
+inline std::pair<double, double> LineParameterRange(
+        const BoundingBox::DirectionType direction_type) {
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    switch (direction_type) {
+        case BoundingBox::DirectionType::kSegment: return {0.0, 1.0};
+        case BoundingBox::DirectionType::kRay:     return {0.0, kInf};
+        default:                                   return {-kInf, kInf};
+    }
+}
+
+/// @brief 1つの三角形と線の交差点を求める (Möller–Trumbore法)
+/// @tparam Scalar メッシュのスカラー型
+/// @param mesh 対象のメッシュ
+/// @param tri 三角形の番号
+/// @param p0 線の始点
+/// @param dir 線の方向ベクトル (p1-p0)
+/// @param dir_norm 方向ベクトルのノルム (>0)
+/// @param t_range 線パラメータの範囲 (境界値を含む)
+/// @param params 交差判定の制御パラメータ (parallel_tolのみ使用する)
+/// @return 交差点. 交差しない・平行・退化の場合は`std::nullopt`
+template <typename Scalar>
+std::optional<MeshRayHit> IntersectTriangle(
+        const TriangleMeshT<Scalar>& mesh, const std::size_t tri,
+        const Vector3d& p0, const Vector3d& dir, const double dir_norm,
+        const std::pair<double, double>& t_range,
+        const MeshIntersectionParams& params) {
+    const Vector3d v0 =
+            mesh.positions.col(mesh.indices[3 * tri]).template cast<double>();
+    const Vector3d v1 = mesh.positions.col(
+            mesh.indices[3 * tri + 1]).template cast<double>();
+    const Vector3d v2 = mesh.positions.col(
+            mesh.indices[3 * tri + 2]).template cast<double>();
+    const Vector3d edge1 = v1 - v0;
+    const Vector3d edge2 = v2 - v0;
+
+    // 平行・退化はスケール不変の相対判定でスキップする
+    const Vector3d pvec = dir.cross(edge2);
+    const double det = edge1.dot(pvec);
+    const double scale = edge1.norm() * edge2.norm() * dir_norm;
+    if (std::abs(det) <= params.parallel_tol * scale) return std::nullopt;
+
+    const double inv_det = 1.0 / det;
+    const Vector3d tvec = p0 - v0;
+    const double u = tvec.dot(pvec) * inv_det;
+    if (u < 0.0 || u > 1.0) return std::nullopt;
+    const Vector3d qvec = tvec.cross(edge1);
+    const double v = dir.dot(qvec) * inv_det;
+    if (v < 0.0 || u + v > 1.0) return std::nullopt;
+
+    // 線種に応じたパラメータ範囲の確認 (境界値は含む)
+    const double line_t = edge2.dot(qvec) * inv_det;
+    if (line_t < t_range.first || line_t > t_range.second) return std::nullopt;
+
+    return MeshRayHit{line_t, p0 + line_t * dir,
+                      static_cast<std::uint32_t>(tri), u, v};
+}
+
+/// @brief 交差点をt昇順に並べ、共有エッジ・共有頂点上の重複を除去する
+/// @param hits 交差点のリスト
+/// @param dir_norm 線の方向ベクトルのノルム (>0)
+/// @param dedup_tol 重複とみなす3D空間距離
+/// @return t昇順 (同じtの場合は三角形番号の昇順) の重複除去済みリスト.
+///         重複する交差点は近い方 (tが小さい方) を残す
+/// @note 交点はすべて同一直線上にあるため、距離がdedup_tol以下となりうるのは
+///       tの差がdedup_tol/dir_norm以下の交差点のみである. そのため直前の
+///       近傍のみと比較する (ヒット数に対して線形時間)
+inline std::vector<MeshRayHit> SortAndDeduplicateHits(
+        std::vector<MeshRayHit> hits, const double dir_norm,
+        const double dedup_tol) {
+    std::sort(hits.begin(), hits.end(),
+              [](const MeshRayHit& l, const MeshRayHit& r) {
+                  if (l.t != r.t) return l.t < r.t;
+                  return l.triangle_index < r.triangle_index;
+              });
+
+    // 丸め誤差を考慮し、比較対象とするtの窓は2倍の幅とする
+    const double window = 2.0 * dedup_tol / dir_norm;
+    std::vector<MeshRayHit> deduped;
+    deduped.reserve(hits.size());
+    for (const auto& hit : hits) {
+        bool duplicate = false;
+        for (auto it = deduped.rbegin();
+             it != deduped.rend() && hit.t - it->t <= window; ++it) {
+            if ((it->position - hit.position).norm() <= dedup_tol) {
+                duplicate = true;
+                break;
+            }
+        }
+        if (!duplicate) deduped.push_back(hit);
+    }
+    return deduped;
+}
+
+}  // namespace detail
+
 /// @brief メッシュと直線/半直線/線分の交差点を求める
 /// @tparam Scalar メッシュのスカラー型 (float / double. 計算はdoubleで行う)
 /// @param mesh 対象のメッシュ (Validateを通る整合したメッシュであること)
@@ -62,6 +164,8 @@ struct MeshIntersectionParams {
 /// @param direction_type 線の種類 (kSegment: 0<=t<=1, kRay: t>=0, kLine: 制限なし)
 /// @param params 交差判定の制御パラメータ
 /// @return 交差点のリスト (t昇順・重複除去済み). p0とp1が一致する場合は空リスト
+/// @note 全三角形を線形に走査する. 同一メッシュへ繰り返し問い合わせる場合は
+///       BVHを用いる版 (mesh_bvh.h) を使用すること
 /// @note 表裏は区別しない (裏面側からの交差もヒットする)
 /// @note 三角形の境界 (辺・頂点) 上のヒットは、数値誤差により隣接三角形の
 ///       いずれか一方または両方で検出される (両方の場合はdedup_tolで1つに
@@ -77,64 +181,16 @@ std::vector<MeshRayHit> IntersectMeshWithLine(
     const double dir_norm = dir.norm();
     if (dir_norm == 0.0) return hits;  // 方向が定義できない
 
+    const auto t_range = detail::LineParameterRange(direction_type);
     const auto triangle_count = mesh.TriangleCount();
     for (std::size_t tri = 0; tri < triangle_count; ++tri) {
-        const Vector3d v0 =
-                mesh.positions.col(mesh.indices[3 * tri]).template cast<double>();
-        const Vector3d v1 = mesh.positions.col(
-                mesh.indices[3 * tri + 1]).template cast<double>();
-        const Vector3d v2 = mesh.positions.col(
-                mesh.indices[3 * tri + 2]).template cast<double>();
-        const Vector3d edge1 = v1 - v0;
-        const Vector3d edge2 = v2 - v0;
-
-        // Möller–Trumbore法. 平行・退化はスケール不変の相対判定でスキップする
-        const Vector3d pvec = dir.cross(edge2);
-        const double det = edge1.dot(pvec);
-        const double scale = edge1.norm() * edge2.norm() * dir_norm;
-        if (std::abs(det) <= params.parallel_tol * scale) continue;
-
-        const double inv_det = 1.0 / det;
-        const Vector3d tvec = p0 - v0;
-        const double u = tvec.dot(pvec) * inv_det;
-        if (u < 0.0 || u > 1.0) continue;
-        const Vector3d qvec = tvec.cross(edge1);
-        const double v = dir.dot(qvec) * inv_det;
-        if (v < 0.0 || u + v > 1.0) continue;
-
-        // 線種に応じたパラメータ範囲の確認 (境界値は含む)
-        const double line_t = edge2.dot(qvec) * inv_det;
-        if (direction_type == BoundingBox::DirectionType::kRay &&
-            line_t < 0.0) {
-            continue;
-        }
-        if (direction_type == BoundingBox::DirectionType::kSegment &&
-            (line_t < 0.0 || line_t > 1.0)) {
-            continue;
+        if (auto hit = detail::IntersectTriangle(
+                    mesh, tri, p0, dir, dir_norm, t_range, params)) {
+            hits.push_back(*hit);
         }
-
-        hits.push_back({line_t, p0 + line_t * dir,
-                        static_cast<std::uint32_t>(tri), u, v});
     }
-
-    std::sort(hits.begin(), hits.end(),
-              [](const MeshRayHit& l, const MeshRayHit& r) {
-                  return l.t < r.t;
-              });
-
-    // 共有エッジ・共有頂点上の重複ヒットを除去する (t昇順のため近い方が残る)
-    std::vector<MeshRayHit> deduped;
-    deduped.reserve(hits.size());
-    for (const auto& hit : hits) {
-        const bool duplicate = std::any_of(
-                deduped.begin(), deduped.end(),
-                [&hit, &params](const MeshRayHit& kept) {
-                    return (kept.position - hit.position).norm() <=
-                           params.dedup_tol;
-                });
-        if (!duplicate) deduped.push_back(hit);
-    }
-    return deduped;
+    return detail::SortAndDeduplicateHits(
+            std::move(hits), dir_norm, params.dedup_tol);
 }
 
 }  // namespace igesio::numerics
@@ -9,22 +9,66 @@
 #define IGESIO_NUMERICS_MESHES_ALGORITHMS_NORMALS_H_
 
 #include <cstddef>
+#include <thread>
 
+#include "igesio/common/parallel.h"
 #include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/meshes/algorithms/adjacency.h"
 #include "igesio/numerics/meshes/triangle_mesh.h"
 
 
 
 namespace igesio::numerics {
 
+/// @brief 頂点法線を面積重み平均で再計算する (構築済みの隣接関係を用いる)
+/// @param[in,out] mesh 対象のメッシュ (normalsチャンネルを上書きする)
+/// @param adjacency meshの隣接関係 (BuildMeshAdjacency(mesh)の結果)
+/// @note 各三角形の外積を並列に求めた後、各頂点が頂点→三角形の一覧から
+///       自身の法線を集める (頂点ごとに書き込み先が分かれるため排他は不要).
+///       頂点ごとの加算順は三角形番号の昇順のため、結果は直列の
+///       RecomputeNormals(mesh)とビット単位で一致する
+template <typename Scalar>
+void RecomputeNormals(TriangleMeshT<Scalar>& mesh, const MeshAdjacency& adjacency) {
+    using Vec3 = Eigen::Matrix<Scalar, 3, 1>;
+    const auto triangle_count = mesh.TriangleCount();
+    Eigen::Matrix<Scalar, 3, Eigen::Dynamic> crosses(
+            3, static_cast<Eigen::Index>(triangle_count));
+    ParallelFor(triangle_count, [&](const std::size_t t) {
+        const Vec3 p0 = mesh.positions.col(mesh.indices[3 * t]);
+        const Vec3 edge1 = Vec3(mesh.positions.col(mesh.indices[3 * t + 1])) - p0;
+        const Vec3 edge2 = Vec3(mesh.positions.col(mesh.indices[3 * t + 2])) - p0;
+        crosses.col(static_cast<Eigen::Index>(t)) = edge1.cross(edge2);
+    }, kMinParallelTriangleCount);
+
+    mesh.normals.resize(3, mesh.positions.cols());
+    ParallelFor(mesh.VertexCount(), [&](const std::size_t v) {
+        Vec3 sum = Vec3::Zero();
+        for (auto a = adjacency.vertex_offsets[v]; a < adjacency.vertex_offsets[v + 1]; ++a) {
+            sum += crosses.col(adjacency.vertex_triangles[a]);
+        }
+        const Scalar norm = sum.norm();
+        if (norm > Scalar(0)) sum /= norm;
+        mesh.normals.col(static_cast<Eigen::Index>(v)) = sum;
+    }, kMinParallelTriangleCount);
+}
+
 /// @brief 頂点法線を面積重み平均で再計算する
 /// @param[in,out] mesh 対象のメッシュ (normalsチャンネルを上書きする)
 /// @note 各三角形の外積 (大きさ=面積の2倍) を頂点へ加算して正規化する.
 ///       面積重みは頂点まわりの面の大きさに応じた自然な平均を与える.
 ///       退化三角形 (外積がゼロ) は寄与しない. どの面にも属さない頂点の
 ///       法線はゼロベクトルとなる
+/// @note 大規模なメッシュ (kMinParallelTriangleCount以上) かつ複数スレッドを
+///       使える場合は、隣接関係を構築して並列に計算する. 隣接関係を他の
+///       アルゴリズムと共有する場合は、隣接関係を受け取る多重定義を使うこと
 template <typename Scalar>
 void RecomputeNormals(TriangleMeshT<Scalar>& mesh) {
+    if (mesh.TriangleCount() >= kMinParallelTriangleCount &&
+        std::thread::hardware_concurrency() > 1) {
+        RecomputeNormals(mesh, BuildMeshAdjacency(mesh));
+        return;
+    }
+
     using Vec3 = Eigen::Matrix<Scalar, 3, 1>;
     mesh.normals.setZero(3, mesh.positions.cols());
 
@@ -51,6 +95,7 @@ void RecomputeNormals(TriangleMeshT<Scalar>& mesh) {
 /// @param mesh 対象のメッシュ
 /// @return 三角形毎の単位面法線 (3×三角形数; 各列が1三角形).
 ///         退化三角形 (外積がゼロ) はゼロベクトル
+/// @note 大規模なメッシュ (kMinParallelTriangleCount以上) では並列に計算する
 template <typename Scalar>
 Eigen::Matrix<Scalar, 3, Eigen::Dynamic> ComputeFaceNormals(
         const TriangleMeshT<Scalar>& mesh) {
@@ -59,7 +104,7 @@ Eigen::Matrix<Scalar, 3, Eigen::Dynamic> ComputeFaceNormals(
     Eigen::Matrix<Scalar, 3, Eigen::Dynamic> normals;
     normals.setZero(3, static_cast<Eigen::Index>(triangle_count));
 
-    for (std::size_t t = 0; t < triangle_count; ++t) {
+    ParallelFor(triangle_count, [&](const std::size_t t) {
         const Vec3 p0 = mesh.positions.col(mesh.indices[3 * t]);
         const Vec3 edge1 = Vec3(mesh.positions.col(mesh.indices[3 * t + 1])) - p0;
         const Vec3 edge2 = Vec3(mesh.positions.col(mesh.indices[3 * t + 2])) - p0;
@@ -68,7 +113,7 @@ Eigen::Matrix<Scalar, 3, Eigen::Dynamic> ComputeFaceNormals(
         if (norm > Scalar(0)) {
             normals.col(static_cast<Eigen::Index>(t)) = cross / norm;
         }
-    }
+    }, kMinParallelTriangleCount);
     return normals;
 }
 
@@ -0,0 +1,138 @@
+/**
+ * @file numerics/meshes/algorithms/quantization.h
+ * @brief 三角形メッシュ (TriangleMeshT) の頂点属性の量子化
+ *        (位置のsnorm16化・法線の八面体符号化)
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 位置はバウンディングボックスの中心と半径で正規化してsnorm16とし
+ *       (頂点あたり6バイト. 単精度の12バイトの1/2)、法線は単位八面体へ写して
+ *       2成分のsnorm16とする (頂点あたり4バイト. 単精度の12バイトの1/3).
+ *       位置の量子化誤差はバウンディングボックスの各辺の長さの1/65534以下.
+ */
+#ifndef IGESIO_NUMERICS_MESHES_ALGORITHMS_QUANTIZATION_H_
+#define IGESIO_NUMERICS_MESHES_ALGORITHMS_QUANTIZATION_H_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/meshes/triangle_mesh.h"
+
+
+
+namespace igesio::numerics {
+
+/// @brief [-1, 1] の値をsnorm16へ量子化する (範囲外はクランプ)
+inline std::int16_t QuantizeSnorm16(const double value) {
+    const double clamped = std::clamp(value, -1.0, 1.0);
+    return static_cast<std::int16_t>(std::lround(clamped * 32767.0));
+}
+
+/// @brief snorm16を [-1, 1] の値へ戻す
+/// @note -32768は-32767と同じく-1とする (OpenGLの正規化規則と同じ)
+inline double DequantizeSnorm16(const std::int16_t value) {
+    return std::max(static_cast<double>(value) / 32767.0, -1.0);
+}
+
+/// @brief 単位ベクトルを八面体符号化する
+/// @param n 単位ベクトル (正規化されていなくてもよい)
+/// @return 2成分のsnorm16. nがゼロベクトルの場合は (0, 0) ((0, 0, 1)へ戻る)
+inline std::array<std::int16_t, 2> EncodeOctahedral(const Vector3d& n) {
+    const double l1 = std::abs(n.x()) + std::abs(n.y()) + std::abs(n.z());
+    if (!(l1 > 0.0)) return {0, 0};
+    double x = n.x() / l1, y = n.y() / l1;
+    // 下半球は対角線で折り返して正方形の角へ写す
+    if (n.z() < 0.0) {
+        const double fx = (1.0 - std::abs(y)) * (x >= 0.0 ? 1.0 : -1.0);
+        const double fy = (1.0 - std::abs(x)) * (y >= 0.0 ? 1.0 : -1.0);
+        x = fx;
+        y = fy;
+    }
+    return {QuantizeSnorm16(x), QuantizeSnorm16(y)};
+}
+
+/// @brief 八面体符号化した単位ベクトルを戻す
+/// @param encoded EncodeOctahedralの結果
+/// @return 単位ベクトル
+inline Vector3d DecodeOctahedral(const std::array<std::int16_t, 2>& encoded) {
+    Vector3d n(DequantizeSnorm16(encoded[0]), DequantizeSnorm16(encoded[1]), 0.0);
+    n.z() = 1.0 - std::abs(n.x()) - std::abs(n.y());
+    const double t = std::max(-n.z(), 0.0);
+    n.x() += (n.x() >= 0.0) ? -t : t;
+    n.y() += (n.y() >= 0.0) ? -t : t;
+    return n.normalized();
+}
+
+/// @brief snorm16へ量子化した頂点位置
+/// @note 元の位置は offset + scale.cwiseProduct(Dequantize(values)) で戻る
+struct QuantizedPositions {
+    /// @brief 正規化の中心 (バウンディングボックスの中心)
+    Vector3d offset = Vector3d::Zero();
+    /// @brief 正規化の半径 (バウンディングボックスの各辺の長さの1/2)
+    Vector3d scale = Vector3d::Zero();
+    /// @brief 量子化した位置 (頂点あたり3要素を連結したもの)
+    std::vector<std::int16_t> values;
+
+    /// @brief 指定した頂点の位置を戻す
+    Vector3d Dequantize(const std::size_t vertex) const {
+        return offset + scale.cwiseProduct(Vector3d(
+                DequantizeSnorm16(values[3 * vertex]),
+                DequantizeSnorm16(values[3 * vertex + 1]),
+                DequantizeSnorm16(values[3 * vertex + 2])));
+    }
+};
+
+/// @brief 頂点位置をsnorm16へ量子化する
+/// @param mesh 対象のメッシュ
+/// @return 量子化した位置. 頂点が無い場合はvaluesが空
+/// @note 厚みの無い軸 (バウンディングボックスの辺の長さが0) は scale = 0 とする
+template <typename Scalar>
+QuantizedPositions QuantizePositions(const TriangleMeshT<Scalar>& mesh) {
+    QuantizedPositions result;
+    const auto vertex_count = mesh.VertexCount();
+    if (vertex_count == 0) return result;
+
+    const Vector3d lower = mesh.positions.rowwise().minCoeff().template cast<double>();
+    const Vector3d upper = mesh.positions.rowwise().maxCoeff().template cast<double>();
+    result.offset = 0.5 * (lower + upper);
+    result.scale = 0.5 * (upper - lower);
+
+    result.values.resize(3 * vertex_count);
+    for (std::size_t v = 0; v < vertex_count; ++v) {
+        const auto col = static_cast<Eigen::Index>(v);
+        for (int i = 0; i < 3; ++i) {
+            const double s = result.scale[i];
+            const double p = static_cast<double>(mesh.positions(i, col));
+            result.values[3 * v + i] = (s > 0.0)
+                    ? QuantizeSnorm16((p - result.offset[i]) / s) : 0;
+        }
+    }
+    return result;
+}
+
+/// @brief 頂点法線を八面体符号化する
+/// @param mesh 対象のメッシュ
+/// @return 符号化した法線 (頂点あたり2要素を連結したもの). 法線が無い場合は空
+template <typename Scalar>
+std::vector<std::int16_t> QuantizeNormals(const TriangleMeshT<Scalar>& mesh) {
+    std::vector<std::int16_t> result;
+    if (!mesh.HasNormals()) return result;
+
+    result.reserve(2 * mesh.VertexCount());
+    for (Eigen::Index c = 0; c < mesh.normals.cols(); ++c) {
+        const auto encoded = EncodeOctahedral(
+                mesh.normals.col(c).template cast<double>());
+        result.push_back(encoded[0]);
+        result.push_back(encoded[1]);
+    }
+    return result;
+}
+
+}  // namespace igesio::numerics
+
+#endif  // IGESIO_NUMERICS_MESHES_ALGORITHMS_QUANTIZATION_H_
@@ -0,0 +1,82 @@
+/**
+ * @file numerics/meshes/algorithms/simplification.h
+ * @brief 三角形メッシュ (TriangleMeshT) の二次誤差尺度 (QEM) による簡略化
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @details
+ * M. Garland and P. Heckbert, "Surface Simplification Using Quadric Error
+ * Metrics" の辺縮約による. 各頂点に、元の隣接面の平面までの距離の2乗和を
+ * 表す二次形式 (quadric) を持たせ、縮約後の頂点位置での値が小さい辺から
+ * 順に縮約する. 詳細度 (LOD) の生成や、軽量化した書き出しに用いる.
+ *
+ * - 特徴の保持: ExtractMeshEdgesの特徴エッジ (境界・非多様体・折り目) と
+ *   面グループの境界を特徴線とし、特徴線上の頂点は特徴線に沿ってのみ
+ *   縮約する. 特徴線の端点・分岐点は動かさない.
+ * - 縮約の拒否: 面の向きが反転する縮約と、多様体性を壊す縮約
+ *   (link conditionを満たさないもの) は行わない.
+ * - 並列化: 三角形を空間的に近いクラスタへ分け、クラスタ間で共有する
+ *   頂点を固定して各クラスタを並列に簡略化した後、全体を直列に仕上げる
+ *   (クラスタ境界に残る細かい三角形をこの仕上げで縮約する).
+ */
+#ifndef IGESIO_NUMERICS_MESHES_ALGORITHMS_SIMPLIFICATION_H_
+#define IGESIO_NUMERICS_MESHES_ALGORITHMS_SIMPLIFICATION_H_
+
+#include <cstddef>
+#include <limits>
+
+#include "igesio/numerics/meshes/algorithms/conversion.h"
+#include "igesio/numerics/meshes/triangle_mesh.h"
+
+
+
+namespace igesio::numerics {
+
+/// @brief メッシュ簡略化のパラメータ
+struct MeshSimplificationParams {
+    /// @brief 目標の三角形数 (これ以下になった時点で終える. 0=誤差の上限のみで止める)
+    std::size_t target_triangle_count = 0;
+    /// @brief 許容する誤差の上限 (長さの単位)
+    /// @note 縮約後の頂点から、元の隣接面の平面までの距離の2乗和の平方根.
+    ///       個々の平面までの距離の上限となる
+    double max_error = std::numeric_limits<double>::infinity();
+    /// @brief 特徴線 (境界・非多様体・折り目・面グループの境界) を保持するか
+    bool preserve_features = true;
+    /// @brief 折り目判定のしきい値 (ExtractMeshEdgesのcrease_angle_cos. 既定はcos(30°))
+    double crease_angle_cos = 0.86602540378443865;
+    /// @brief クラスタ並列で実行するか
+    bool parallel = true;
+    /// @brief 並列実行時の1クラスタあたりの三角形数
+    /// @note 三角形数がこの2倍未満のメッシュは直列で実行する
+    std::size_t cluster_triangle_count = 16384;
+};
+
+/// @brief メッシュを簡略化する (倍精度)
+/// @param mesh 対象のメッシュ (Validateを通る整合したメッシュであること)
+/// @param params パラメータ
+/// @param[out] result_error 実際に生じた誤差の上限 (縮約した辺の誤差の最大値.
+///             nullptrの場合は返さない)
+/// @return 簡略化したメッシュ. 三角形は元の順序を保ち (面グループの範囲は
+///         残った三角形で付け直す)、頂点は参照されるもののみを元の順序で残す.
+///         法線・UVは縮約した辺に沿って補間する
+/// @note 縮約できる辺が無くなった場合は、目標の三角形数に届かなくても終える.
+///       退化三角形 (同じ頂点を含むもの) は取り除く
+TriangleMeshd SimplifyMesh(const TriangleMeshd& mesh,
+                           const MeshSimplificationParams& params = {},
+                           double* result_error = nullptr);
+
+/// @brief メッシュを簡略化する
+/// @tparam Scalar スカラー型 (float / double)
+/// @note 内部では倍精度で計算する. 詳細はTriangleMeshdの多重定義を参照
+template <typename Scalar>
+TriangleMeshT<Scalar> SimplifyMesh(const TriangleMeshT<Scalar>& mesh,
+                                   const MeshSimplificationParams& params = {},
+                                   double* result_error = nullptr) {
+    return CastScalar<Scalar>(SimplifyMesh(
+            CastScalar<double>(mesh), params, result_error));
+}
+
+}  // namespace igesio::numerics
+
+#endif  // IGESIO_NUMERICS_MESHES_ALGORITHMS_SIMPLIFICATION_H_
@@ -194,12 +194,16 @@ ReadIgesIntermediate(const std::string&, const bool = false);
 /// @param intermediate 中間データ構造
 /// @param prepare_caches エンティティのキャッシュを事前構築するかどうか
 ///        (TrimmedSurfaceの領域判定キャッシュなど). デフォルトはtrue.
+/// @param reconstruct_base_curves ベース曲線Bが省略されたType 142について、
+///        読み込み時にBを再構築するかどうか. デフォルトはtrue. falseの場合は
+///        BPTR=0のまま読み込み、必要に応じてReconstructOmittedBaseCurvesを呼び出す.
 /// @return 生成されたIgesDataクラス
 /// @throw igesio::DataFormatError パラメータの数や形式が不正な場合や、
 ///        参照されているエンティティが存在しない場合など
 models::IgesData
 ConvertFromIntermediate(const models::IntermediateIgesData&,
-                        const bool prepare_caches = true);
+                        const bool prepare_caches = true,
+                        const bool reconstruct_base_curves = true);
 
 /// @brief IGESファイルを読み込み、IgesDataクラスを返す
 /// @param file_path 読み込むIGESファイルのパス
@@ -207,6 +211,8 @@ ConvertFromIntermediate(const models::IntermediateIgesData&,
 ///        現状はDEセクションのデータ形式の検証のみを行う.
 /// @param prepare_caches エンティティのキャッシュを事前構築するかどうか
 ///        (TrimmedSurfaceの領域判定キャッシュなど). デフォルトはtrue.
+/// @param reconstruct_base_curves ベース曲線Bが省略されたType 142について、
+///        読み込み時にBを再構築するかどうか. デフォルトはtrue.
 /// @return 生成されたIgesDataクラス
 /// @throw igesio::FileOpenError ファイルが開けなかった場合
 /// @throw igesio::LineFormatError 行の長さが規定値以外の場合
@@ -215,8 +221,21 @@ ConvertFromIntermediate(const models::IntermediateIgesData&,
 ///        エンティティのPDパラメータが不正な場合や、参照が未解決の場合に発生する.
 /// @note 仕様に厳密には従っていないIGESファイルも存在するため、
 ///       validate_strictlyをtrueにする際は注意が必要.
-models::IgesData ReadIges(const std::string&,
-                          const bool = false, const bool = true);
+models::IgesData ReadIges(const std::string&, const bool = false,
+                          const bool = true, const bool = true);
+
+/// @brief ベース曲線Bが省略されたType 142についてBをC・Sから再構築する
+///
+/// BPTR=0 (CATIA 等) の CurveOnAParametricSurfaceは、参照解決後にモデル空間曲線Cと
+/// 曲面Sからパラメータ空間のベース曲線 B = S^{-1}∘C を再構築できる. 再構築したBは
+/// 出力時に DE/BPTR を付与するためrootへ登録する.
+/// @param root 全エンティティが登録され参照解決済みのルート Assembly
+/// @note 逆射影は各Type 142について並列に行い、Bの生成とrootへの登録は
+///       rootの列挙順に逐次行う (スレッド数によらず逐次実行と同じ登録順となる).
+/// @note ConvertFromIntermediate / ReadIgesでreconstruct_base_curves = falseを
+///       指定した場合に、再構築を遅延して行うために使用する. 再構築済みの
+///       Type 142は対象外のため、複数回呼び出してもよい.
+void ReconstructOmittedBaseCurves(models::Assembly& root);
 
 }  // namespace igesio
 
@@ -0,0 +1,299 @@
+/**
+ * @file entities/curves/algorithms/curve_curve_intersection.cpp
+ * @brief 曲線と曲線の交点計算の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/entities/curves/algorithms/curve_curve_intersection.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "igesio/common/parallel.h"
+#include "entities/curves/algorithms/curve_segment_tree.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+namespace i_ent = igesio::entities;
+using i_ent::ICurve;
+using i_ent::CurveSegmentTree;
+using i_ent::CurveCurveIntersection;
+using i_ent::CurveCurveIntersectionParams;
+using igesio::Vector3d;
+
+/// @brief 2辺が平行とみなす sin^2(なす角) の閾値
+constexpr double kParallelSinSq = 1e-12;
+/// @brief ガウス・ニュートン法の減衰係数 (正規方程式の対角に加える相対量)
+/// @note 接する交点・重なる区間でヤコビアンが退化しても反復を継続するために加える
+constexpr double kDamping = 1e-12;
+
+
+
+/// @brief 点と1階導関数
+struct PointDerivative {
+    /// @brief 点C(t)
+    Vector3d point;
+    /// @brief 1階導関数C'(t)
+    Vector3d d1;
+};
+
+/// @brief 曲線の点と1階導関数をモデル空間で評価する
+/// @param planar trueの場合はz成分を0とする
+std::optional<PointDerivative> Evaluate(
+        const ICurve& curve, const double t, const bool planar) {
+    const auto deriv = curve.TryGetDerivatives(t, 1);
+    if (!deriv) return std::nullopt;
+    PointDerivative result{(*deriv)[0], (*deriv)[1]};
+    if (planar) {
+        result.point.z() = 0.0;
+        result.d1.z() = 0.0;
+    }
+    return result;
+}
+
+/// @brief 2線分 p0→p1, q0→q1 の最近接点のパラメータ (各線分上で[0,1]) を求める
+/// @return 最近接点のパラメータ組 {a, b}. 平行な場合は、重なり区間の端点と
+///         なりうる各端点の射影 (最大4組) を返す
+std::vector<std::array<double, 2>> ClosestSegmentParams(
+        const Vector3d& p0, const Vector3d& p1,
+        const Vector3d& q0, const Vector3d& q1) {
+    const auto clamp01 = [](const double x) { return std::clamp(x, 0.0, 1.0); };
+    const Vector3d d1 = p1 - p0;
+    const Vector3d d2 = q1 - q0;
+    const Vector3d r = p0 - q0;
+    const double a = d1.squaredNorm();
+    const double e = d2.squaredNorm();
+    const double f = d2.dot(r);
+
+    // 長さゼロの辺は点として扱う
+    if (a <= 0.0 && e <= 0.0) return {{0.0, 0.0}};
+    if (a <= 0.0) return {{0.0, clamp01(f / e)}};
+    const double c = d1.dot(r);
+    if (e <= 0.0) return {{clamp01(-c / a), 0.0}};
+
+    const double b = d1.dot(d2);
+    const double denom = a * e - b * b;
+    if (denom <= kParallelSinSq * a * e) {
+        // 平行: 各端点を他方の辺へ射影した組
+        return {{0.0, clamp01(f / e)},
+                {1.0, clamp01((p1 - q0).dot(d2) / e)},
+                {clamp01(-c / a), 0.0},
+                {clamp01((q1 - p0).dot(d1) / a), 1.0}};
+    }
+
+    double s = clamp01((b * f - c * e) / denom);
+    double t = (b * s + f) / e;
+    if (t < 0.0) {
+        t = 0.0;
+        s = clamp01(-c / a);
+    } else if (t > 1.0) {
+        t = 1.0;
+        s = clamp01((b - c) / a);
+    }
+    return {{s, t}};
+}
+
+/// @brief 初期値 (s, t) から |C1(s) - C2(t)|^2 を最小化し、交点を求める
+/// @return 最終的な距離がtolerance以下の場合は交点、それ以外はnullopt
+/// @note 正規方程式 (J^T J + λI) Δ = -J^T r (J = [C1' | -C2']) による
+///       減衰付きガウス・ニュートン法. パラメータは各曲線の範囲にクランプする
+std::optional<CurveCurveIntersection> Refine(
+        const ICurve& curve1, const ICurve& curve2,
+        double s, double t, const CurveCurveIntersectionParams& params) {
+    const auto range1 = curve1.GetParameterRange();
+    const auto range2 = curve2.GetParameterRange();
+    for (int iter = 0; iter < params.max_iter; ++iter) {
+        const auto e1 = Evaluate(curve1, s, params.planar);
+        const auto e2 = Evaluate(curve2, t, params.planar);
+        if (!e1 || !e2) return std::nullopt;
+
+        const Vector3d r = e1->point - e2->point;
+        const double a11 = e1->d1.squaredNorm();
+        const double a22 = e2->d1.squaredNorm();
+        const double a12 = -e1->d1.dot(e2->d1);
+        const double g1 = e1->d1.dot(r);
+        const double g2 = -e2->d1.dot(r);
+        const double lambda = kDamping * (a11 + a22);
+        const double m11 = a11 + lambda;
+        const double m22 = a22 + lambda;
+        const double det = m11 * m22 - a12 * a12;
+        if (!(det > 0.0)) break;  // 両曲線とも速度ゼロ (カスプ等)
+
+        const double s_new = std::clamp(
+                s - (m22 * g1 - a12 * g2) / det, range1[0], range1[1]);
+        const double t_new = std::clamp(
+                t - (m11 * g2 - a12 * g1) / det, range2[0], range2[1]);
+        const double step = std::max(std::abs(s_new - s), std::abs(t_new - t));
+        s = s_new;
+        t = t_new;
+        if (step <= params.convergence_tol) break;
+    }
+
+    const auto e1 = Evaluate(curve1, s, params.planar);
+    const auto e2 = Evaluate(curve2, t, params.planar);
+    if (!e1 || !e2) return std::nullopt;
+    const double gap = (e1->point - e2->point).norm();
+    if (gap > params.tolerance) return std::nullopt;
+    return CurveCurveIntersection{
+            0.5 * (e1->point + e2->point), s, t, gap};
+}
+
+/// @brief 重複解を除去し、(t1, t2) の昇順に並べる
+/// @param merge_dist 同じ接触点とみなしうる空間距離の上限 (広域判定の分解能)
+/// @note 空間距離がdedup_tol未満の解に加え、距離がmerge_dist未満かつ両解の
+///       パラメータの中点でも距離がtolerance以下の解を同じ接触点とみなし、
+///       gapの小さい方を残す. 接する交点では、候補ごとの収束点がdedup_tolを
+///       超えて散らばるため
+void DeduplicateAndSort(std::vector<CurveCurveIntersection>& results,
+                        const ICurve& curve1, const ICurve& curve2,
+                        const double merge_dist,
+                        const CurveCurveIntersectionParams& params) {
+    std::sort(results.begin(), results.end(),
+              [](const CurveCurveIntersection& a, const CurveCurveIntersection& b) {
+        return a.t1 < b.t1 || (a.t1 == b.t1 && a.t2 < b.t2);
+    });
+    const auto same_contact = [&](const CurveCurveIntersection& a,
+                                  const CurveCurveIntersection& b) {
+        const double dist = (a.position - b.position).norm();
+        if (dist < params.dedup_tol) return true;
+        if (dist >= merge_dist) return false;
+        const auto e1 = Evaluate(curve1, 0.5 * (a.t1 + b.t1), params.planar);
+        const auto e2 = Evaluate(curve2, 0.5 * (a.t2 + b.t2), params.planar);
+        return e1 && e2 && (e1->point - e2->point).norm() <= params.tolerance;
+    };
+
+    std::vector<CurveCurveIntersection> kept;
+    kept.reserve(results.size());
+    for (const auto& r : results) {
+        const auto it = std::find_if(kept.begin(), kept.end(),
+                [&](const CurveCurveIntersection& k) { return same_contact(k, r); });
+        if (it == kept.end()) {
+            kept.push_back(r);
+        } else if (r.gap < it->gap) {
+            *it = r;
+        }
+    }
+    results = std::move(kept);
+}
+
+/// @brief 曲線の折れ線化の許容距離を決定する
+double ChordToleranceFor(const ICurve& curve,
+                         const CurveCurveIntersectionParams& params) {
+    return params.chord_tolerance > 0.0
+            ? params.chord_tolerance : i_ent::DefaultChordTolerance(curve);
+}
+
+/// @brief 折れ線近似済みの2曲線の交点を計算する
+std::vector<CurveCurveIntersection> IntersectSegmentTrees(
+        const ICurve& curve1, const CurveSegmentTree& tree1,
+        const ICurve& curve2, const CurveSegmentTree& tree2,
+        const CurveCurveIntersectionParams& params) {
+    std::vector<CurveCurveIntersection> results;
+    // 辺どうしの距離がこれ以下であれば、弧どうしが交差しうる
+    const double reach = 2.0 * (tree1.chord_tolerance + tree2.chord_tolerance) +
+                         params.tolerance;
+    // tree1のボックスは2*chord1だけ拡大済みのため、残りを問い合わせ側に加える
+    const Vector3d pad = Vector3d::Constant(
+            2.0 * tree2.chord_tolerance + params.tolerance);
+
+    for (std::size_t j = 0; j < tree2.EdgeCount(); ++j) {
+        const Vector3d& q0 = tree2.points[j];
+        const Vector3d& q1 = tree2.points[j + 1];
+        const Vector3d lower = q0.cwiseMin(q1) - pad;
+        const Vector3d upper = q0.cwiseMax(q1) + pad;
+        i_num::QueryBvh(tree1.bvh, [&](const Vector3d& lo, const Vector3d& hi) {
+            return (lo.array() <= upper.array()).all() &&
+                   (lower.array() <= hi.array()).all();
+        }, [&](const std::uint32_t i) {
+            const Vector3d& p0 = tree1.points[i];
+            const Vector3d& p1 = tree1.points[i + 1];
+            for (const auto& [a, b] : ClosestSegmentParams(p0, p1, q0, q1)) {
+                const Vector3d pa = p0 + a * (p1 - p0);
+                const Vector3d qb = q0 + b * (q1 - q0);
+                if ((pa - qb).norm() > reach) continue;
+
+                const double s = tree1.params[i] +
+                        a * (tree1.params[i + 1] - tree1.params[i]);
+                const double t = tree2.params[j] +
+                        b * (tree2.params[j + 1] - tree2.params[j]);
+                if (auto hit = Refine(curve1, curve2, s, t, params)) {
+                    results.push_back(*hit);
+                }
+            }
+        });
+    }
+
+    DeduplicateAndSort(results, curve1, curve2,
+                       std::min(tree1.chord_tolerance, tree2.chord_tolerance),
+                       params);
+    return results;
+}
+
+}  // namespace
+
+
+
+/**
+ * 曲線と曲線の交点計算
+ */
+
+std::vector<CurveCurveIntersection> i_ent::IntersectCurves(
+        const ICurve& curve1, const ICurve& curve2,
+        const CurveCurveIntersectionParams& params) {
+    const auto tree1 = BuildCurveSegmentTree(
+            curve1, ChordToleranceFor(curve1, params), params.planar);
+    const auto tree2 = BuildCurveSegmentTree(
+            curve2, ChordToleranceFor(curve2, params), params.planar);
+    return IntersectSegmentTrees(curve1, tree1, curve2, tree2, params);
+}
+
+std::vector<std::vector<CurveCurveIntersection>> i_ent::IntersectCurvePairs(
+        const std::vector<CurvePair>& pairs,
+        const CurveCurveIntersectionParams& params) {
+    // 組に現れる曲線を列挙する (同じ曲線の折れ線近似は共有する)
+    std::vector<const ICurve*> curves;
+    std::unordered_map<const ICurve*, std::size_t> curve_indices;
+    std::vector<std::array<std::size_t, 2>> pair_indices(pairs.size());
+    for (std::size_t k = 0; k < pairs.size(); ++k) {
+        const std::array<const ICurve*, 2> members = {
+                pairs[k].first.get(), pairs[k].second.get()};
+        for (std::size_t m = 0; m < 2; ++m) {
+            if (!members[m]) {
+                throw std::invalid_argument(
+                    "IntersectCurvePairs: curves must not be null.");
+            }
+            if (!members[m]->IsFinite()) {
+                throw std::invalid_argument(
+                    "IntersectCurvePairs: curves must have a finite "
+                    "parameter range.");
+            }
+            const auto [it, inserted] =
+                    curve_indices.emplace(members[m], curves.size());
+            if (inserted) curves.push_back(members[m]);
+            pair_indices[k][m] = it->second;
+        }
+    }
+
+    std::vector<CurveSegmentTree> trees(curves.size());
+    igesio::ParallelFor(curves.size(), [&](const std::size_t i) {
+        trees[i] = BuildCurveSegmentTree(
+                *curves[i], ChordToleranceFor(*curves[i], params), params.planar);
+    });
+
+    std::vector<std::vector<CurveCurveIntersection>> results(pairs.size());
+    igesio::ParallelFor(pairs.size(), [&](const std::size_t k) {
+        const auto [i, j] = pair_indices[k];
+        results[k] = IntersectSegmentTrees(
+                *curves[i], trees[i], *curves[j], trees[j], params);
+    });
+    return results;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file entities/curves/algorithms/curve_discretization.cpp
+ * @brief 許容量に基づく曲線の適応的な折れ線化の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/entities/curves/algorithms/curve_discretization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+namespace i_ent = igesio::entities;
+using igesio::Vector2d;
+using igesio::Vector3d;
+using i_ent::CurveDiscretizationParams;
+
+/// @brief 折れ線の頂点の候補
+struct Station {
+    /// @brief パラメータ値
+    double t;
+    /// @brief 写像後の座標 (評価できない場合はstd::nullopt)
+    std::optional<Vector3d> point;
+};
+
+/// @brief 点と線分の距離
+template <typename Vector>
+double SegmentDistance(const Vector& p, const Vector& a, const Vector& b) {
+    const Vector ab = b - a;
+    const double len_sq = ab.squaredNorm();
+    if (len_sq == 0.0) return (p - a).norm();
+    const double s = std::clamp((p - a).dot(ab) / len_sq, 0.0, 1.0);
+    return (p - (a + s * ab)).norm();
+}
+
+/// @brief パラメータ値の列を評価し、写像を適用する
+std::vector<std::optional<Vector3d>> Evaluate(
+        const i_ent::ICurve& curve, const std::vector<double>& ts,
+        const i_ent::CurvePointMap& map) {
+    auto points = curve.TryGetPointsAt(ts);
+    if (map) {
+        for (auto& p : points) {
+            if (p) p = map(*p);
+        }
+    }
+    return points;
+}
+
+/// @brief 区間 [a, b] を中点 m で2分割すべきかを判定する
+bool NeedsSplit(const std::optional<Vector3d>& a, const std::optional<Vector3d>& m,
+                const std::optional<Vector3d>& b,
+                const CurveDiscretizationParams& params) {
+    // 評価できる範囲とできない範囲の境界は、分割して位置を絞り込む.
+    // 全て評価できない区間はそれ以上分割しない
+    if (!a || !b) return (a || b || m);
+    if (!m) return true;
+
+    const auto& tol = params.tolerance;
+    if (tol.max_edge_length > 0.0 && (*b - *a).norm() > tol.max_edge_length) {
+        return true;
+    }
+    if (tol.chord_height > 0.0
+            && SegmentDistance(*m, *a, *b) > tol.chord_height) {
+        return true;
+    }
+    if (tol.angle > 0.0) {
+        const Vector3d d0 = *m - *a, d1 = *b - *m;
+        const double n0 = d0.norm(), n1 = d1.norm();
+        if (n0 > 0.0 && n1 > 0.0) {
+            // 区間内の接線の回転角は、両半区間の弦のなす角の約2倍となる
+            const double c = std::clamp(d0.dot(d1) / (n0 * n1), -1.0, 1.0);
+            if (2.0 * std::acos(c) > tol.angle) return true;
+        } else if (n0 + n1 > 0.0) {
+            // 両端が一致する (閉じた) 区間
+            return true;
+        }
+    }
+
+    const auto& screen = params.screen;
+    if (screen.IsEnabled()) {
+        const auto sa = screen.project(*a);
+        const auto sm = screen.project(*m);
+        const auto sb = screen.project(*b);
+        // 射影できない場合は画面上の判定を行わない
+        if (sa && sm && sb) {
+            if (screen.max_edge_length > 0.0
+                    && (*sb - *sa).norm() > screen.max_edge_length) {
+                return true;
+            }
+            if (screen.chord_height > 0.0
+                    && SegmentDistance(*sm, *sa, *sb) > screen.chord_height) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// @brief 初期区間の分割点を求める
+/// @return 昇順の分割点 (range[0], range[1]を含む)
+std::vector<double> InitialParams(
+        const i_ent::ICurve& curve, const double t0, const double t1,
+        const int initial_segments) {
+    const double eps = (t1 - t0) * 1e-9;
+    const auto linear_segments = curve.GetLinearSegments();
+
+    // 角点・直線部の端点で範囲を区切る
+    std::vector<double> breaks = {t0, t1};
+    for (const double tc : curve.GetCornerParams()) {
+        if (tc > t0 + eps && tc < t1 - eps) breaks.push_back(tc);
+    }
+    for (const auto& [s, e] : linear_segments) {
+        if (s > t0 + eps && s < t1 - eps) breaks.push_back(s);
+        if (e > t0 + eps && e < t1 - eps) breaks.push_back(e);
+    }
+    std::sort(breaks.begin(), breaks.end());
+    breaks.erase(std::unique(breaks.begin(), breaks.end(),
+                             [eps](const double a, const double b) {
+                                 return std::abs(a - b) <= eps;
+                             }),
+                 breaks.end());
+
+    std::vector<double> ts;
+    for (std::size_t i = 0; i + 1 < breaks.size(); ++i) {
+        const double a = breaks[i], b = breaks[i + 1];
+        const bool is_linear = std::any_of(
+                linear_segments.begin(), linear_segments.end(),
+                [&](const std::array<double, 2>& seg) {
+                    return seg[0] <= a + eps && b <= seg[1] + eps;
+                });
+        const int n = is_linear ? 1 : initial_segments;
+        for (int k = 0; k < n; ++k) {
+            ts.push_back(a + (b - a) * static_cast<double>(k) / n);
+        }
+    }
+    ts.push_back(breaks.back());
+    return ts;
+}
+
+}  // namespace
+
+
+
+std::vector<i_ent::CurvePolyline> i_ent::DiscretizeCurve(
+        const ICurve& curve, const std::array<double, 2>& range,
+        const CurveDiscretizationParams& params, const CurvePointMap& map) {
+    if (!std::isfinite(range[0]) || !std::isfinite(range[1])) {
+        throw std::invalid_argument("DiscretizeCurve: range must be finite.");
+    }
+    if (!(range[1] > range[0])) return {};
+
+    // 初期区間の分割点を評価する
+    const auto initial_ts = InitialParams(
+            curve, range[0], range[1], std::max(1, params.initial_segments));
+    const auto initial_points = Evaluate(curve, initial_ts, map);
+    std::vector<Station> stations;
+    stations.reserve(initial_ts.size());
+    for (std::size_t i = 0; i < initial_ts.size(); ++i) {
+        stations.push_back({initial_ts[i], initial_points[i]});
+    }
+    // 各区間 (stations[i], stations[i + 1]) の分割判定が未了かどうか
+    std::vector<bool> active(stations.size() - 1, true);
+
+    // 分割の段階ごとに、判定が未了の全区間の中点をまとめて評価する
+    for (int depth = 0; depth < std::max(0, params.max_depth); ++depth) {
+        std::vector<double> mid_ts;
+        for (std::size_t i = 0; i + 1 < stations.size(); ++i) {
+            if (active[i]) {
+                mid_ts.push_back(0.5 * (stations[i].t + stations[i + 1].t));
+            }
+        }
+        if (mid_ts.empty()) break;
+        const auto mids = Evaluate(curve, mid_ts, map);
+
+        std::vector<Station> next_stations;
+        std::vector<bool> next_active;
+        next_stations.reserve(stations.size() + mid_ts.size());
+        std::size_t k = 0;
+        for (std::size_t i = 0; i + 1 < stations.size(); ++i) {
+            next_stations.push_back(stations[i]);
+            if (!active[i]) {
+                next_active.push_back(false);
+                continue;
+            }
+            const auto& mid = mids[k];
+            const double tm = mid_ts[k++];
+            if (NeedsSplit(stations[i].point, mid, stations[i + 1].point, params)) {
+                next_stations.push_back({tm, mid});
+                next_active.push_back(true);
+                next_active.push_back(true);
+            } else {
+                next_active.push_back(false);
+            }
+        }
+        next_stations.push_back(stations.back());
+        stations = std::move(next_stations);
+        active = std::move(next_active);
+    }
+
+    // 評価できない点で分割する
+    std::vector<CurvePolyline> polylines;
+    CurvePolyline current;
+    const auto flush = [&]() {
+        if (current.points.size() >= 2) polylines.push_back(std::move(current));
+        current = {};
+    };
+    for (const auto& station : stations) {
+        if (!station.point) {
+            flush();
+            continue;
+        }
+        current.params.push_back(station.t);
+        current.points.push_back(*station.point);
+    }
+    flush();
+    return polylines;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file entities/curves/algorithms/curve_segment_tree.cpp
+ * @brief 曲線の折れ線近似とその辺のBVHの実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "entities/curves/algorithms/curve_segment_tree.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "igesio/numerics/core/tolerance.h"
+#include "entities/curves/algorithms/polygonal_approximation.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+namespace i_ent = igesio::entities;
+using igesio::Vector3d;
+
+/// @brief 既定の折れ線化許容距離の、バウンディングボックス対角線長に対する比
+constexpr double kDefaultChordRatio = 1e-3;
+/// @brief バウンディングボックスから大きさを求められない場合の既定の許容距離
+constexpr double kFallbackChordTolerance = 1e-3;
+/// @brief 折れ線近似の前に、パラメータ範囲を等分する区間数
+/// @note 反復二分法は区間の中点のみで平坦さを判定するため、中点が偶然弦上に
+///       ある区間 (対称なジグザグ等) を1辺としてしまう. 広域判定の見落としを
+///       防ぐため、直線部を除く範囲をあらかじめこの数に分割しておく
+constexpr int kMinSpans = 8;
+
+/// @brief 折れ線近似の固定点 (直線部の端点・角点・等分点) を求める
+/// @return 固定点を頂点とする多角形 (ComputeApproximatePolygonのinscribedに渡す)
+i_num::PolygonData CollectFixedPoints(const i_ent::ICurve& curve) {
+    const auto [t_min, t_max] = curve.GetParameterRange();
+    const auto linear_segments = curve.GetLinearSegments();
+    const auto inside_linear = [&](const double t) {
+        return std::any_of(linear_segments.begin(), linear_segments.end(),
+                [t](const std::array<double, 2>& seg) {
+            return seg[0] < t && t < seg[1];
+        });
+    };
+
+    std::vector<double> params = curve.GetCornerParams();
+    for (const auto& seg : linear_segments) {
+        params.push_back(seg[0]);
+        params.push_back(seg[1]);
+    }
+    for (int i = 1; i < kMinSpans; ++i) {
+        const double t = t_min + (t_max - t_min) * i / kMinSpans;
+        if (!inside_linear(t)) params.push_back(t);
+    }
+    std::sort(params.begin(), params.end());
+    params.erase(std::unique(params.begin(), params.end()), params.end());
+
+    i_num::PolygonData fixed;
+    for (const double t : params) {
+        if (t < t_min || t > t_max) continue;
+        const auto point = curve.TryGetPointAt(t);
+        if (!point) continue;
+        fixed.vertices.push_back(*point);
+        fixed.on_curve.push_back(true);
+        fixed.curve_params.push_back(t);
+    }
+    return fixed;
+}
+
+}  // namespace
+
+
+
+double i_ent::DefaultChordTolerance(const ICurve& curve) {
+    const auto bb = curve.GetBoundingBox();
+    if (bb.IsEmpty() || !bb.IsFinite()) return kFallbackChordTolerance;
+
+    const auto sizes = bb.GetSizes();
+    const double diagonal = std::sqrt(
+            sizes[0] * sizes[0] + sizes[1] * sizes[1] + sizes[2] * sizes[2]);
+    if (!(diagonal > i_num::kGeometryTolerance)) return kFallbackChordTolerance;
+    return diagonal * kDefaultChordRatio;
+}
+
+i_ent::CurveSegmentTree i_ent::BuildCurveSegmentTree(
+        const ICurve& curve, const double chord_tolerance, const bool planar) {
+    if (!curve.IsFinite()) {
+        throw std::invalid_argument(
+            "BuildCurveSegmentTree: curve must have a finite parameter range.");
+    }
+
+    CurveSegmentTree tree;
+    tree.chord_tolerance = chord_tolerance;
+    auto polygon = ComputeApproximatePolygon(
+            curve, CollectFixedPoints(curve), {}, chord_tolerance);
+    tree.points = std::move(polygon.vertices);
+    tree.params = std::move(polygon.curve_params);
+
+    // 閉曲線では末尾の頂点 (= 始点) が除かれているため、始点を終端として加える
+    if (curve.IsClosed() && !tree.points.empty()) {
+        tree.points.push_back(tree.points.front());
+        tree.params.push_back(curve.GetParameterRange()[1]);
+    }
+    if (planar) {
+        for (auto& p : tree.points) p.z() = 0.0;
+    }
+
+    // 弧は辺から高々chord_tolerance程度 (中点判定のため余裕を見て2倍) 離れる
+    const double margin = 2.0 * chord_tolerance;
+    const Vector3d pad = Vector3d::Constant(margin);
+    const auto edge_count = tree.EdgeCount();
+    std::vector<Vector3d> lowers(edge_count), uppers(edge_count);
+    for (std::size_t i = 0; i < edge_count; ++i) {
+        lowers[i] = tree.points[i].cwiseMin(tree.points[i + 1]) - pad;
+        uppers[i] = tree.points[i].cwiseMax(tree.points[i + 1]) + pad;
+    }
+    tree.bvh = i_num::BuildBvh(lowers, uppers);
+    return tree;
+}
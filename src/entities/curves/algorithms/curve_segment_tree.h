@@ -0,0 +1,65 @@
+/**
+ * @file entities/curves/algorithms/curve_segment_tree.h
+ * @brief 曲線の折れ線近似とその辺のBVH (内部実装)
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 本ファイルは内部実装用であり、公開APIには含めない.
+ *       曲線×曲線・曲線×曲面の交差判定の広域判定 (broad phase) に用いる.
+ */
+#ifndef SRC_ENTITIES_CURVES_ALGORITHMS_CURVE_SEGMENT_TREE_H_
+#define SRC_ENTITIES_CURVES_ALGORITHMS_CURVE_SEGMENT_TREE_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/geometric/bvh.h"
+#include "igesio/entities/interfaces/i_curve.h"
+
+
+
+namespace igesio::entities {
+
+/// @brief 曲線の折れ線近似と、その各辺のバウンディングボックスのBVH
+/// @note 辺iは points[i] → points[i+1] であり、曲線パラメータ
+///       [params[i], params[i+1]] に対応する. 閉曲線では末尾に始点を
+///       (パラメータ範囲の終端として) 加え、ループを閉じる
+struct CurveSegmentTree {
+    /// @brief 折れ線の頂点 (モデル空間. planarの場合はz=0へ射影済み)
+    std::vector<Vector3d> points;
+    /// @brief 各頂点の曲線パラメータ (昇順)
+    std::vector<double> params;
+    /// @brief 折れ線化の許容距離 (辺と弧の中点との距離)
+    double chord_tolerance = 0.0;
+    /// @brief 各辺のBVH (プリミティブ番号は辺番号)
+    /// @note 各辺のボックスは、弧が辺から離れうる量として
+    ///       chord_toleranceの2倍だけ拡大してある
+    numerics::Bvh bvh;
+
+    /// @brief 辺の数を取得する
+    std::size_t EdgeCount() const {
+        return points.size() < 2 ? 0 : points.size() - 1;
+    }
+};
+
+/// @brief 曲線の大きさから折れ線化の許容距離の既定値を求める
+/// @param curve 対象の曲線
+/// @return バウンディングボックスの対角線長の1/1000.
+///         バウンディングボックスが空・無限・退化している場合は1e-3
+double DefaultChordTolerance(const ICurve& curve);
+
+/// @brief 曲線を折れ線近似し、各辺のBVHを構築する
+/// @param curve 対象の曲線 (有限なパラメータ範囲を持つこと)
+/// @param chord_tolerance 折れ線化の許容距離 (正の値)
+/// @param planar trueの場合、頂点をz=0平面へ射影する (パラメータ空間の曲線用)
+/// @return 折れ線近似とBVH
+/// @throw std::invalid_argument curveのパラメータ範囲が無限の場合
+/// @note 直線部 (GetLinearSegments) は分割せず1辺として扱うため、
+///       直線部の辺は曲線と厳密に一致する
+CurveSegmentTree BuildCurveSegmentTree(
+        const ICurve& curve, double chord_tolerance, bool planar);
+
+}  // namespace igesio::entities
+
+#endif  // SRC_ENTITIES_CURVES_ALGORITHMS_CURVE_SEGMENT_TREE_H_
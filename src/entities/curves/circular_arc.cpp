@@ -14,6 +14,7 @@
 
 #include "igesio/numerics/core/tolerance.h"
 #include "igesio/common/iges_parameter_vector.h"
+#include "./nurbs_conversion.h"
 
 namespace {
 
@@ -268,6 +269,29 @@ double CircularArc::EndAngle() const {
 
 
 
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<i_ent::RationalBSplineCurve> CircularArc::ConvertToNurbs() const {
+    const auto [start_angle, end_angle] = GetParameterRange();
+    auto arc = i_ent::detail::MakeUnitArc(start_angle, end_angle);
+
+    // 単位円を半径倍し、中心 (x_c, y_c, z_t) へ平行移動する
+    igesio::Matrix4d placement = igesio::Matrix4d::Identity();
+    placement(0, 0) = placement(1, 1) = Radius();
+    for (int i = 0; i < 3; ++i) placement(i, 3) = center_(i);
+    i_ent::detail::ApplyAffine(arc, placement);
+
+    const auto nurbs = i_ent::detail::Assemble(arc);
+    if (!nurbs) return nullptr;
+    auto curve = i_ent::detail::MakeCurve(*nurbs);
+    curve->SetCurveType(i_ent::RationalBSplineCurveType::kCircularArc);
+    return curve;
+}
+
+
+
 /**
  * ファクトリ関数
  */
@@ -8,6 +8,7 @@
  */
 #include "igesio/entities/curves/conic_arc.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <memory>
@@ -16,6 +17,7 @@
 #include <vector>
 
 #include "igesio/numerics/core/tolerance.h"
+#include "./nurbs_conversion.h"
 
 namespace {
 
@@ -381,6 +383,49 @@ double ConicArc::EllipseEndAngle() const {
 
 
 
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<i_ent::RationalBSplineCurve> ConicArc::ConvertToNurbs() const {
+    const auto [t_start, t_end] = GetParameterRange();
+    if (!(t_start < t_end)) return nullptr;
+
+    // 各区間の接線の回転角がπ未満となるよう分割する. 放物線・双曲線は
+    // 1区間で回転角がπ未満となり、楕円は中心角π/2以下の区間に分割する
+    const auto type = GetConicType();
+    int n_segments = 1;
+    if (type == ConicType::kEllipse) {
+        n_segments = std::max(1, static_cast<int>(std::ceil(
+                (t_end - t_start) / (igesio::kPi / 2.0) - i_num::kAngleTolerance)));
+    }
+    std::vector<double> breakpoints;
+    for (int i = 0; i <= n_segments; ++i) {
+        breakpoints.push_back(t_start + (t_end - t_start) * i / n_segments);
+    }
+    breakpoints.back() = t_end;
+
+    const auto bezier = i_ent::detail::ConicToBezier(*this, breakpoints);
+    if (!bezier) return nullptr;
+    const auto nurbs = i_ent::detail::Assemble(*bezier);
+    if (!nurbs) return nullptr;
+    auto curve = i_ent::detail::MakeCurve(*nurbs);
+    switch (type) {
+        case ConicType::kEllipse:
+            curve->SetCurveType(i_ent::RationalBSplineCurveType::kEllipticArc);
+            break;
+        case ConicType::kParabola:
+            curve->SetCurveType(i_ent::RationalBSplineCurveType::kParabolicArc);
+            break;
+        case ConicType::kHyperbola:
+            curve->SetCurveType(i_ent::RationalBSplineCurveType::kHyperbolicArc);
+            break;
+    }
+    return curve;
+}
+
+
+
 /**
  * ファクトリ関数
  */
@@ -529,7 +574,7 @@ ConicArc::TryGetParabolaDerivatives(const double t, const unsigned int n) const
 
     if (!i_num::IsApproxZero(A) && !i_num::IsApproxZero(E)) {   // Y = k * X^2
         double x_coef = (xs < xe) ? 1.0 : -1.0;
-        for (unsigned int k = 0; k < n; ++k) {
+        for (unsigned int k = 0; k <= n; ++k) {
             if (k == 0) {
                 result[k] = Vector3d{x_coef*t, -(A/E)*t*t, z_t};
             } else if (k == 1) {
@@ -541,7 +586,7 @@ ConicArc::TryGetParabolaDerivatives(const double t, const unsigned int n) const
         }
     } else if (!i_num::IsApproxZero(C) && !i_num::IsApproxZero(D)) {   // X = k * Y^2
         double y_coef = (ys < ye) ? 1.0 : -1.0;
-        for (unsigned int k = 0; k < n; ++k) {
+        for (unsigned int k = 0; k <= n; ++k) {
             if (k == 0) {
                 result[k] = Vector3d{-(C/D)*t*t, y_coef*t, z_t};
             } else if (k == 1) {
@@ -582,7 +627,7 @@ ConicArc::TryGetHyperbolaDerivatives(const double t, const unsigned int n) const
         double a = std::sqrt(-F / A), b = std::sqrt(F / C);
         double sgn = (ys < ye) ? 1.0 : -1.0;
 
-        for (unsigned int k = 0; k < n; ++k) {
+        for (unsigned int k = 0; k <= n; ++k) {
             if (k == 0) {
                 result[k] = Vector3d{a / std::cos(t), sgn * b * std::tan(t), z_t};
             } else if (k == 1) {
@@ -597,7 +642,7 @@ ConicArc::TryGetHyperbolaDerivatives(const double t, const unsigned int n) const
         double a = std::sqrt(F / A), b = std::sqrt(-F / C);
         double sgn = (xs < xe) ? 1.0 : -1.0;
 
-        for (unsigned int k = 0; k < n; ++k) {
+        for (unsigned int k = 0; k <= n; ++k) {
             if (k == 0) {
                 result[k] = Vector3d{sgn * a * std::tan(t), b / std::cos(t), z_t};
             } else if (k == 1) {
@@ -10,6 +10,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
@@ -507,14 +508,6 @@ CurveOnSurface::TryGetDefinedDerivatives(const double t, const unsigned int n) c
     return result;
 }
 
-double CurveOnSurface::Length(const double start, const double end) const {
-    auto curve_ptr = curve_.TryGetEntity<ICurve>();
-    if (!curve_ptr) {
-        return ICurve::Length(start, end);
-    }
-    return curve_ptr.value()->Length(start, end);
-}
-
 i_num::BoundingBox CurveOnSurface::GetDefinedBoundingBox() const {
     auto curve_ptr = curve_.TryGetEntity<ICurve>();
     if (!curve_ptr) {
@@ -659,26 +652,45 @@ bool CurveOnSurface::SetPreferredRepresentation(const PreferredRepresentation pr
     return false;  // 無効な値
 }
 
-std::shared_ptr<i_ent::ICurve> CurveOnSurface::ReconstructOmittedBaseCurve() {
+std::optional<std::vector<Vector3d>>
+CurveOnSurface::InvertOmittedBaseCurve() const {
     // BPTR=0 (省略) かつS・Cが解決済みのときのみ再構築する
-    if (base_curve_.GetID() != IDGenerator::UnsetID()) return nullptr;
-    if (!surface_.IsPointerSet() || !curve_.IsPointerSet()) return nullptr;
+    if (base_curve_.GetID() != IDGenerator::UnsetID()) return std::nullopt;
+    if (!surface_.IsPointerSet() || !curve_.IsPointerSet()) return std::nullopt;
 
     auto surf_opt = surface_.TryGetEntity<ISurface>();
     auto curve_opt = curve_.TryGetEntity<ICurve>();
-    if (!surf_opt || !curve_opt) return nullptr;
+    if (!surf_opt || !curve_opt) return std::nullopt;
 
-    // 再構築はbest-effort。逆射影・近似・ドメイン包含チェック等で例外が出ても
-    // 読み込み全体を止めずnullptrを返す (当該境界は非致命的にスキップ)。
+    // 再構築はbest-effort。逆射影で例外が出ても読み込み全体を止めず
+    // std::nulloptを返す (当該境界は非致命的にスキップ)。
     try {
         // CをSのパラメータ空間へ逆射影する (単一弧モード; Type 142は連続を仮定)
         auto arcs = InvertCurveOntoSurface(*surf_opt.value(), *curve_opt.value(), {});
-        if (arcs.empty() || arcs.front().uv_points.size() < 2) return nullptr;
+        if (arcs.empty() || arcs.front().uv_points.size() < 2) return std::nullopt;
+        return std::move(arcs.front().uv_points);
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+std::shared_ptr<i_ent::ICurve> CurveOnSurface::ReconstructOmittedBaseCurve() {
+    const auto uv_points = InvertOmittedBaseCurve();
+    if (!uv_points) return nullptr;
+    return ReconstructOmittedBaseCurve(*uv_points);
+}
 
+std::shared_ptr<i_ent::ICurve> CurveOnSurface::ReconstructOmittedBaseCurve(
+        const std::vector<Vector3d>& uv_points) {
+    if (base_curve_.GetID() != IDGenerator::UnsetID()) return nullptr;
+    auto curve_opt = curve_.TryGetEntity<ICurve>();
+    if (!curve_opt || uv_points.size() < 2) return nullptr;
+
+    // 近似・ドメイン包含チェック等で例外が出てもnullptrを返す (best-effort)
+    try {
         // パラメータ空間のベース曲線Bを生成する。トリム境界Cが閉ループならBも閉じ、
         // 退化点列は除去する (下流テッセレーションが閉曲線・非退化を前提とするため)。
-        auto base = BuildParamSpaceBaseCurve(
-                arcs.front().uv_points, curve_opt.value()->IsClosed());
+        auto base = BuildParamSpaceBaseCurve(uv_points, curve_opt.value()->IsClosed());
         if (!base) return nullptr;
         // B は曲面のパラメータ空間にあるため EUF=05 (2D Parametric)・物理従属に設定
         base->SetEntityUseFlag(i_ent::EntityUseFlag::k2DParametric);
@@ -8,12 +8,14 @@
 #include "igesio/entities/curves/line.h"
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "igesio/numerics/core/tolerance.h"
+#include "./nurbs_conversion.h"
 
 namespace {
 
@@ -214,6 +216,10 @@ i_num::BoundingBox Line::GetDefinedBoundingBox() const {
     return i_num::BoundingBox(min, sizes, is_line);
 }
 
+std::vector<std::array<double, 2>> Line::GetLinearSegments() const {
+    return {GetParameterRange()};
+}
+
 
 
 
@@ -231,6 +237,26 @@ std::pair<const Vector3d, const Vector3d> Line::GetAnchorPoints() const {
 }
 
 
+
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<i_ent::RationalBSplineCurve> Line::ConvertToNurbs() const {
+    // 半直線・直線は有限のNURBSで表せない
+    if (GetLineType() != LineType::kSegment) return nullptr;
+
+    const auto [t_start, t_end] = GetParameterRange();
+    const auto nurbs = i_ent::detail::Assemble(i_ent::detail::MakePolyline(
+            {start_point_, terminate_point_}, {t_start, t_end}));
+    if (!nurbs) return nullptr;
+    auto curve = i_ent::detail::MakeCurve(*nurbs);
+    curve->SetCurveType(i_ent::RationalBSplineCurveType::kLine);
+    return curve;
+}
+
+
+
 /**
  * ファクトリ関数
  */
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "igesio/numerics/core/tolerance.h"
+#include "./nurbs_conversion.h"
 
 namespace {
 
@@ -306,6 +307,33 @@ double LinearPath::Length(const double start, const double end) const {
 }
 
 
+
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<i_ent::RationalBSplineCurve> LinearPath::ConvertToNurbs() const {
+    const size_t n = GetCount();
+    if (n < 2) return nullptr;
+
+    // 頂点列 (kPlanarLoopの場合は先頭へ戻る線分を加える) と累積弧長
+    std::vector<Vector3d> points;
+    for (size_t i = 0; i < n; ++i) points.push_back(Coordinate(i));
+    if (GetDataType() == CopiousDataType::kPlanarLoop) points.push_back(Coordinate(0));
+    std::vector<double> lengths = {0.0};
+    for (size_t i = 1; i < points.size(); ++i) {
+        lengths.push_back(lengths.back() + (points[i] - points[i - 1]).norm());
+    }
+
+    const auto polyline = i_ent::detail::MakePolyline(points, lengths);
+    if (polyline.segments.empty()) return nullptr;
+    const auto nurbs = i_ent::detail::Assemble(polyline);
+    if (!nurbs) return nullptr;
+    return i_ent::detail::MakeCurve(*nurbs);
+}
+
+
+
 /**
  * ファクトリ関数
  */
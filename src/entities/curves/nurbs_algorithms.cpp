@@ -11,12 +11,14 @@
 #include <cmath>
 #include <functional>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
 #include <Eigen/Dense>
 
 #include "igesio/common/errors.h"
+#include "igesio/common/parallel.h"
 #include "igesio/numerics/core/matrix.h"
 
 namespace {
@@ -344,47 +346,99 @@ int FindKnotSpan(
     return lo;
 }
 
-/// @brief B-スプライン基底関数 B_{i,m}(t) を評価する（de Boor 三角スキーム）
-/// @param i     制御点インデックス (0 <= i <= k)
+/// @brief ノットスパン内で非ゼロとなる B-スプライン基底関数を評価する
+/// @param span  ノットスパンのインデックス j（FindKnotSpanの戻り値）
 /// @param m     B-スプラインの次数
 /// @param t     パラメータ値
 /// @param knots ノットベクトル（0-indexed, サイズ k+m+2）
-/// @return B_{i,m}(t) の値
-double EvalBasis(
-        int i, int m, double t,
-        const std::vector<double>& knots) {
-    const int k = static_cast<int>(knots.size()) - m - 2;
-
-    // 三角スキームの底辺: d[j] = B_{i+j,0}(t)
-    std::vector<double> d(m + 1, 0.0);
-    if (t >= 1.0) {
-        // t=1.0 はFindKnotSpanで求めたスパンspanにのみ寄与する
-        const int span = FindKnotSpan(1.0, m, k, knots);
-        const int j_active = span - i;
-        if (j_active >= 0 && j_active <= m) d[j_active] = 1.0;
-    } else {
-        for (int j = 0; j <= m; ++j) {
-            const double lo = knots[i + j];
-            const double hi = knots[i + j + 1];
-            d[j] = (lo <= t && t < hi) ? 1.0 : 0.0;
+/// @param N     出力先（サイズ m+1）。N[q] = B_{j-m+q,m}(t)
+/// @param work  作業領域（サイズ 2(m+1) 以上; 呼び出し側で使い回す）
+/// @note Piegl & Tiller, The NURBS Book, Algorithm A2.2
+void EvalNonzeroBasis(
+        int span, int m, double t,
+        const std::vector<double>& knots, double* N,
+        std::vector<double>& work) {
+    double* left  = work.data();
+    double* right = work.data() + m + 1;
+    N[0] = 1.0;
+    for (int j = 1; j <= m; ++j) {
+        left[j]  = t - knots[span + 1 - j];
+        right[j] = knots[span + j] - t;
+        double saved = 0.0;
+        for (int q = 0; q < j; ++q) {
+            const double denom = right[q + 1] + left[j - q];
+            const double temp  = (denom != 0.0) ? N[q] / denom : 0.0;
+            N[q]  = saved + right[q + 1] * temp;
+            saved = left[j - q] * temp;
         }
+        N[j] = saved;
+    }
+}
+
+/// @brief 各サンプル点における非ゼロ基底関数のキャッシュ
+/// @note サンプル l の非ゼロ基底は B_{span-m}, ..., B_{span} の m+1 個のみ。
+///       ノット挿入時は影響を受けるサンプルのみ再評価する
+struct BasisCache {
+    /// @brief B-スプラインの次数
+    int m = 0;
+    /// @brief 各サンプルのノットスパン（サイズ L+1）
+    std::vector<int> spans;
+    /// @brief 各サンプルの非ゼロ基底関数値（サイズ (L+1)*(m+1)）
+    std::vector<double> values;
+
+    /// @brief サンプルlの非ゼロ基底関数値の先頭へのポインタ
+    const double* At(size_t l) const { return values.data() + l * (m + 1); }
+};
+
+/// @brief サンプル点における非ゼロ基底関数のキャッシュを構築する
+/// @param t_bar コード長パラメータ
+/// @param m     B-スプラインの次数
+/// @param k     制御点の最大インデックス
+/// @param knots ノットベクトル
+/// @return 全サンプルの基底関数キャッシュ
+BasisCache BuildBasisCache(
+        const std::vector<double>& t_bar,
+        unsigned int m, unsigned int k,
+        const std::vector<double>& knots) {
+    BasisCache cache;
+    cache.m = static_cast<int>(m);
+    cache.spans.resize(t_bar.size());
+    cache.values.resize(t_bar.size() * (m + 1));
+    std::vector<double> work(2 * (m + 1));
+    for (size_t l = 0; l < t_bar.size(); ++l) {
+        cache.spans[l] = FindKnotSpan(
+            t_bar[l], static_cast<int>(m), static_cast<int>(k), knots);
+        EvalNonzeroBasis(cache.spans[l], static_cast<int>(m), t_bar[l], knots,
+                         cache.values.data() + l * (m + 1), work);
     }
+    return cache;
+}
 
-    // de Boor 再帰
-    for (int p = 1; p <= m; ++p) {
-        for (int j = 0; j <= m - p; ++j) {
-            const double t0 = knots[i + j];
-            const double t1 = knots[i + j + p];
-            const double t2 = knots[i + j + 1];
-            const double t3 = knots[i + j + p + 1];
-            const double a =
-                (t1 > t0) ? (t - t0) / (t1 - t0) : 0.0;
-            const double b =
-                (t3 > t2) ? (t3 - t) / (t3 - t2) : 0.0;
-            d[j] = a * d[j] + b * d[j + 1];
+/// @brief ノット挿入後に基底関数キャッシュを更新する
+/// @param cache 更新するキャッシュ（挿入前のノットで構築されたもの）
+/// @param t_bar コード長パラメータ
+/// @param k     挿入後の制御点の最大インデックス
+/// @param knots 挿入後のノットベクトル
+/// @param s     挿入したノットを含んでいた（挿入前の）ノットスパン
+/// @note 挿入前のスパンが [s-m, s+m] のサンプルのみ再評価する。それより後ろの
+///       サンプルは基底関数が変化せず、インデックスが1つずれるだけである
+void UpdateBasisCache(
+        BasisCache& cache,
+        const std::vector<double>& t_bar,
+        unsigned int k,
+        const std::vector<double>& knots, int s) {
+    const int m = cache.m;
+    std::vector<double> work(2 * (m + 1));
+    for (size_t l = 0; l < t_bar.size(); ++l) {
+        const int span = cache.spans[l];
+        if (span > s + m) {
+            ++cache.spans[l];
+        } else if (span >= s - m) {
+            cache.spans[l] = FindKnotSpan(t_bar[l], m, static_cast<int>(k), knots);
+            EvalNonzeroBasis(cache.spans[l], m, t_bar[l], knots,
+                             cache.values.data() + l * (m + 1), work);
         }
     }
-    return d[0];
 }
 
 
@@ -445,69 +499,172 @@ Matrix3Xd FixEndpointControls(
 // 内部制御点の最小二乗求解
 // =========================================================================
 
-/// @brief 最小二乗用の残差行列Rを計算する
-/// @param samples  サンプル点列
-/// @param t_bar    コード長パラメータ
-/// @param P_fixed  端点制御点行列（端点インデックスのみ有効）
-/// @param m        B-スプラインの次数
-/// @param k        制御点の最大インデックス
-/// @param r        端点で固定する制御点数（片側）
-/// @param knots    ノットベクトル
-/// @return (L-1)×3 の残差行列R
-MatrixXd ComputeResidual(
+/// @brief 固定制御点の寄与を除いたサンプル点（最小二乗の右辺）を計算する
+/// @param samples サンプル点列
+/// @param cache   基底関数キャッシュ
+/// @param P_fixed 端点制御点行列（端点インデックスのみ有効）
+/// @param l       サンプルのインデックス
+/// @param k       制御点の最大インデックス
+/// @param r       端点で固定する制御点数（片側）
+/// @return Q_l - Σ_{固定 i} B_i(t_l) P_i
+Vector3d ComputeResidual(
         const std::vector<Vector3d>& samples,
-        const std::vector<double>& t_bar,
+        const BasisCache& cache,
         const Matrix3Xd& P_fixed,
-        unsigned int m, unsigned int k, unsigned int r,
-        const std::vector<double>& knots) {
-    const int L = static_cast<int>(t_bar.size()) - 1;
-    MatrixXd R = MatrixXd::Zero(L - 1, 3);
-
-    for (int l = 1; l < L; ++l) {
-        const double t  = t_bar[l];
-        Vector3d residual = samples[l];
-
-        // 始点側固定制御点の寄与を除く
-        for (unsigned int i = 0; i < r; ++i) {
-            residual -= EvalBasis(static_cast<int>(i), m, t, knots)
-                        * P_fixed.col(static_cast<int>(i));
+        size_t l, unsigned int k, unsigned int r) {
+    const int m = cache.m;
+    const double* N = cache.At(l);
+    Vector3d residual = samples[l];
+    for (int q = 0; q <= m; ++q) {
+        const int i = cache.spans[l] - m + q;
+        if (i < static_cast<int>(r) || i > static_cast<int>(k - r)) {
+            residual -= N[q] * P_fixed.col(i);
         }
-        // 終点側固定制御点の寄与を除く
-        for (unsigned int i = k - r + 1; i <= k; ++i) {
-            residual -= EvalBasis(static_cast<int>(i), m, t, knots)
-                        * P_fixed.col(static_cast<int>(i));
-        }
-        R.row(l - 1) = residual.transpose();
     }
-    return R;
+    return residual;
 }
 
-/// @brief 基底行列 B̂ を構築する
-/// @param m     B-スプラインの次数
+/// @brief 基底行列 B̂ を構築する（帯行列解法が失敗した場合のフォールバック用）
+/// @param cache 基底関数キャッシュ
 /// @param k     制御点の最大インデックス
 /// @param r     端点で固定する制御点数（片側）
-/// @param t_bar コード長パラメータ（内部点 t_bar[1..L-1] を使用）
-/// @param knots ノットベクトル
 /// @return (L-1)×(k-2r+1) の基底行列 B̂
 MatrixXd BuildBasisMatrix(
-        unsigned int m, unsigned int k, unsigned int r,
-        const std::vector<double>& t_bar,
-        const std::vector<double>& knots) {
-    const int L      = static_cast<int>(t_bar.size()) - 1;
+        const BasisCache& cache, unsigned int k, unsigned int r) {
+    const int L      = static_cast<int>(cache.spans.size()) - 1;
+    const int m      = cache.m;
     const int n_free =
         static_cast<int>(k) - 2 * static_cast<int>(r) + 1;
     MatrixXd B_hat = MatrixXd::Zero(L - 1, n_free);
 
     for (int l = 1; l < L; ++l) {
-        const double t = t_bar[l];
-        for (int j = 0; j < n_free; ++j) {
-            B_hat(l - 1, j) = EvalBasis(
-                static_cast<int>(r) + j, m, t, knots);
+        const double* N = cache.At(l);
+        for (int q = 0; q <= m; ++q) {
+            const int j = cache.spans[l] - m + q - static_cast<int>(r);
+            if (0 <= j && j < n_free) B_hat(l - 1, j) = N[q];
         }
     }
     return B_hat;
 }
 
+/// @brief 正規方程式 B̂ᵀB̂ を帯行列として組み立て、帯コレスキー分解する
+/// @param cache 基底関数キャッシュ
+/// @param k     制御点の最大インデックス
+/// @param r     端点で固定する制御点数（片側）
+/// @return 下三角帯に格納した分解結果 G (G(i, i-d) = band[i*(m+1) + d])。
+///         正定値でない場合はstd::nullopt
+/// @note 正規方程式は半帯幅mの帯行列となるため、非ゼロ基底のみから組み立て、
+///       O(L m² + n m²) で分解する。係数行列はサンプル点の座標に依存しないため、
+///       同じパラメータ・ノットを共有する複数の点列で使い回せる
+std::optional<std::vector<double>> FactorNormalEquations(
+        const BasisCache& cache, unsigned int k, unsigned int r) {
+    const int L      = static_cast<int>(cache.spans.size()) - 1;
+    const int m      = cache.m;
+    const int n_free =
+        static_cast<int>(k) - 2 * static_cast<int>(r) + 1;
+    const int w      = m + 1;  // 帯の幅（対角を含む下三角側）
+
+    // 下三角帯 A(i, i-d) = band[i*w + d]
+    std::vector<double> band(static_cast<size_t>(n_free) * w, 0.0);
+    for (int l = 1; l < L; ++l) {
+        const double* N = cache.At(l);
+        const int j0 = cache.spans[l] - m - static_cast<int>(r);
+        for (int q = 0; q <= m; ++q) {
+            const int i = j0 + q;
+            if (i < 0 || i >= n_free) continue;
+            for (int p = 0; p <= q; ++p) {
+                const int j = j0 + p;
+                if (j < 0) continue;
+                band[static_cast<size_t>(i) * w + (i - j)] += N[q] * N[p];
+            }
+        }
+    }
+
+    // 帯コレスキー分解 A = G Gᵀ (Gはbandに上書き)
+    for (int i = 0; i < n_free; ++i) {
+        for (int j = std::max(0, i - m); j <= i; ++j) {
+            double sum = band[static_cast<size_t>(i) * w + (i - j)];
+            for (int p = std::max(0, i - m); p < j; ++p) {
+                sum -= band[static_cast<size_t>(i) * w + (i - p)]
+                     * band[static_cast<size_t>(j) * w + (j - p)];
+            }
+            if (i == j) {
+                const double diag = band[static_cast<size_t>(i) * w];
+                if (!(sum > 1e-12 * diag) || diag <= 0.0) return std::nullopt;
+                band[static_cast<size_t>(i) * w] = std::sqrt(sum);
+            } else {
+                band[static_cast<size_t>(i) * w + (i - j)] =
+                    sum / band[static_cast<size_t>(j) * w];
+            }
+        }
+    }
+    return band;
+}
+
+/// @brief 内部制御点を最小二乗法で求める
+/// @param samples サンプル点列
+/// @param cache   基底関数キャッシュ
+/// @param factor  FactorNormalEquationsの戻り値
+/// @param P_fixed 端点制御点行列（端点インデックスのみ有効）
+/// @param k       制御点の最大インデックス
+/// @param r       端点で固定する制御点数（片側）
+/// @return 内部制御点 3×(k-2r+1)
+/// @note 帯コレスキー分解済みの正規方程式 (B̂ᵀB̂) X = B̂ᵀR を前進・後退代入で解く。
+///       いずれかの内部基底の台にサンプルが無いなど、正定値でない場合
+///       (factorがstd::nullopt) は B̂ の列ピボット付きQR分解で解く
+Matrix3Xd SolveFreeControlPoints(
+        const std::vector<Vector3d>& samples,
+        const BasisCache& cache,
+        const std::optional<std::vector<double>>& factor,
+        const Matrix3Xd& P_fixed,
+        unsigned int k, unsigned int r) {
+    const int L      = static_cast<int>(samples.size()) - 1;
+    const int m      = cache.m;
+    const int n_free =
+        static_cast<int>(k) - 2 * static_cast<int>(r) + 1;
+    const int w      = m + 1;
+
+    if (!factor) {
+        const MatrixXd B_hat = BuildBasisMatrix(cache, k, r);
+        MatrixXd R_mat(L - 1, 3);
+        for (int l = 1; l < L; ++l) {
+            R_mat.row(l - 1) =
+                ComputeResidual(samples, cache, P_fixed, l, k, r).transpose();
+        }
+        return B_hat.colPivHouseholderQr().solve(R_mat).transpose();
+    }
+    const auto& band = *factor;
+
+    // 右辺 B̂ᵀR
+    MatrixXd rhs = MatrixXd::Zero(n_free, 3);
+    for (int l = 1; l < L; ++l) {
+        const double* N = cache.At(l);
+        const Vector3d residual =
+            ComputeResidual(samples, cache, P_fixed, l, k, r);
+        const int j0 = cache.spans[l] - m - static_cast<int>(r);
+        for (int q = 0; q <= m; ++q) {
+            const int i = j0 + q;
+            if (i < 0 || i >= n_free) continue;
+            rhs.row(i) += N[q] * residual.transpose();
+        }
+    }
+
+    // 前進代入 G y = rhs、後退代入 Gᵀ x = y
+    for (int i = 0; i < n_free; ++i) {
+        for (int p = std::max(0, i - m); p < i; ++p) {
+            rhs.row(i) -= band[static_cast<size_t>(i) * w + (i - p)] * rhs.row(p);
+        }
+        rhs.row(i) /= band[static_cast<size_t>(i) * w];
+    }
+    for (int i = n_free - 1; i >= 0; --i) {
+        for (int p = i + 1; p <= std::min(n_free - 1, i + m); ++p) {
+            rhs.row(i) -= band[static_cast<size_t>(p) * w + (p - i)] * rhs.row(p);
+        }
+        rhs.row(i) /= band[static_cast<size_t>(i) * w];
+    }
+    return rhs.transpose();
+}
+
 /// @brief 端点制御点と内部制御点を合成して全制御点行列を返す
 /// @param P_fixed 端点制御点（端点インデックスのみ有効）
 /// @param X_free  内部制御点 3×(k-2r+1)
@@ -533,42 +690,24 @@ Matrix3Xd MergeControlPoints(
 // 誤差評価と適応的ノット挿入
 // =========================================================================
 
-/// @brief NURBS 曲線C(t)を評価する
-/// @param m     B-スプラインの次数
-/// @param k     制御点の最大インデックス
-/// @param knots ノットベクトル
-/// @param P     制御点行列 3×(k+1)
-/// @param t     パラメータ値
-/// @return C(t)の座標値
-Vector3d EvalNurbs(
-        unsigned int m, unsigned int k,
-        const std::vector<double>& knots,
-        const Matrix3Xd& P, double t) {
-    Vector3d C = Vector3d::Zero();
-    for (unsigned int i = 0; i <= k; ++i) {
-        C += EvalBasis(static_cast<int>(i), m, t, knots) * P.col(i);
-    }
-    return C;
-}
-
 /// @brief 各サンプル点での近似誤差を計算する
 /// @param samples サンプル点列
-/// @param t_bar   コード長パラメータ
-/// @param m       B-スプラインの次数
-/// @param k       制御点の最大インデックス
-/// @param knots   ノットベクトル
+/// @param cache   基底関数キャッシュ
 /// @param P       制御点行列 3×(k+1)
 /// @return 各サンプルの誤差ベクトル (サイズ L+1)
 std::vector<double> ComputeErrors(
         const std::vector<Vector3d>& samples,
-        const std::vector<double>& t_bar,
-        unsigned int m, unsigned int k,
-        const std::vector<double>& knots,
+        const BasisCache& cache,
         const Matrix3Xd& P) {
+    const int m = cache.m;
     std::vector<double> errors(samples.size());
     for (size_t l = 0; l < samples.size(); ++l) {
-        errors[l] =
-            (samples[l] - EvalNurbs(m, k, knots, P, t_bar[l])).norm();
+        const double* N = cache.At(l);
+        Vector3d C = Vector3d::Zero();
+        for (int q = 0; q <= m; ++q) {
+            C += N[q] * P.col(cache.spans[l] - m + q);
+        }
+        errors[l] = (samples[l] - C).norm();
     }
     return errors;
 }
@@ -578,15 +717,16 @@ std::vector<double> ComputeErrors(
 /// @param errors サンプル毎の近似誤差
 /// @param t_bar  コード長パラメータ
 /// @param eps    許容誤差
-/// @return ノット挿入に成功した場合は true
-bool InsertKnot(
+/// @return 挿入したノットを含んでいた（挿入前の）ノットスパンのインデックス。
+///         挿入しなかった場合はstd::nullopt
+std::optional<int> InsertKnot(
         std::vector<double>& knots,
         const std::vector<double>& errors,
         const std::vector<double>& t_bar,
         double eps) {
     // 誤差最大のサンプルを特定する
     const auto it_max = std::max_element(errors.begin(), errors.end());
-    if (*it_max <= eps) return false;
+    if (*it_max <= eps) return std::nullopt;
 
     const size_t l_max =
         static_cast<size_t>(it_max - errors.begin());
@@ -596,14 +736,15 @@ bool InsertKnot(
     // 中点は既存ノットと必ず異なるため、重複チェックが不要
     const auto it_hi =
         std::upper_bound(knots.begin(), knots.end(), t);
-    if (it_hi == knots.begin() || it_hi == knots.end()) return false;
+    if (it_hi == knots.begin() || it_hi == knots.end()) return std::nullopt;
 
     const double t_hi = *it_hi;
     const double t_lo = *std::prev(it_hi);
-    if (t_hi - t_lo < 1e-12) return false;
+    if (t_hi - t_lo < 1e-12) return std::nullopt;
 
+    const auto span = static_cast<int>(std::prev(it_hi) - knots.begin());
     knots.insert(it_hi, (t_lo + t_hi) * 0.5);
-    return true;
+    return span;
 }
 
 
@@ -636,24 +777,22 @@ void RunApproxLoop(
 
     // Step 3: 初期ノットベクトルを平均化法で構築する
     auto knots = BuildKnotVector(m, k, t_bar);
+    // サンプル点の非ゼロ基底関数はノット挿入ごとに局所的に更新する
+    auto basis = BuildBasisCache(t_bar, m, k, knots);
 
     while (true) {
         // Step 4
         const Matrix3Xd P_fixed =
             FixEndpointControls(p0, pk, D, m, k, r, knots);
         // Step 5
-        const MatrixXd B_hat =
-            BuildBasisMatrix(m, k, r, t_bar, knots);
-        const MatrixXd R_mat =
-            ComputeResidual(samples, t_bar, P_fixed, m, k, r, knots);
+        const auto factor = FactorNormalEquations(basis, k, r);
         const Matrix3Xd X_free =
-            B_hat.colPivHouseholderQr().solve(R_mat).transpose();
+            SolveFreeControlPoints(samples, basis, factor, P_fixed, k, r);
         const Matrix3Xd P =
             MergeControlPoints(P_fixed, X_free, k, r);
 
         // Step 6: 誤差評価
-        const auto errors =
-            ComputeErrors(samples, t_bar, m, k, knots, P);
+        const auto errors = ComputeErrors(samples, basis, P);
         const double e_max =
             *std::max_element(errors.begin(), errors.end());
 
@@ -667,12 +806,297 @@ void RunApproxLoop(
         }
 
         // ノット挿入とkのインクリメント
-        if (!InsertKnot(knots, errors, t_bar, options.tolerance)) {
+        const auto span =
+            InsertKnot(knots, errors, t_bar, options.tolerance);
+        if (!span) {
             knots_out = std::move(knots);
             ctrl_out  = P;
             return;
         }
         ++k;
+        UpdateBasisCache(basis, t_bar, k, knots, *span);
+    }
+}
+
+
+
+
+// =========================================================================
+// 曲面近似
+// =========================================================================
+
+/// @brief 曲面近似における1方向分の状態
+/// @note 同じ方向の全ての点列（u方向なら各列）は共通のパラメータ・ノット・
+///       基底関数キャッシュを共有する
+struct SurfaceFitDirection {
+    /// @brief B-スプラインの次数
+    unsigned int m = 0;
+    /// @brief 制御点の最大インデックス
+    unsigned int k = 0;
+    /// @brief 制御点数の上限
+    unsigned int max_control_points = 0;
+    /// @brief 全点列で平均化したコード長パラメータ
+    std::vector<double> t_bar;
+    /// @brief ノットベクトル
+    std::vector<double> knots;
+    /// @brief サンプル点の基底関数キャッシュ
+    BasisCache basis;
+
+    /// @brief ノットを挿入可能か（制御点上限・劣決定の判定）
+    bool CanRefine() const {
+        return k + 1 < max_control_points
+            && k + 1 < static_cast<unsigned int>(t_bar.size()) - 1;
+    }
+};
+
+/// @brief 複数の点列のコード長パラメータを平均する
+/// @param lines 点列の集合（各点列のサイズは等しい）
+/// @return 平均化したコード長パラメータ
+/// @throw igesio::ComputationError 全ての点列が1点に縮退している場合
+/// @note 極などで1点に縮退した点列は平均から除外する
+std::vector<double> AveragedChordLengthParams(
+        const std::vector<std::vector<Vector3d>>& lines) {
+    std::vector<double> t_bar(lines.front().size(), 0.0);
+    size_t n_valid = 0;
+    for (const auto& line : lines) {
+        double total = 0.0;
+        for (size_t l = 1; l < line.size(); ++l) {
+            total += (line[l] - line[l - 1]).norm();
+        }
+        if (total < 1e-15) continue;
+        const auto t = ChordLengthParams(line);
+        for (size_t l = 0; l < t.size(); ++l) t_bar[l] += t[l];
+        ++n_valid;
+    }
+    if (n_valid == 0) {
+        throw igesio::ComputationError(
+            "AveragedChordLengthParams: 全ての点列が1点に縮退しています。");
+    }
+    for (auto& t : t_bar) t /= static_cast<double>(n_valid);
+    t_bar.front() = 0.0;
+    t_bar.back()  = 1.0;
+    return t_bar;
+}
+
+/// @brief 曲面近似の1方向分の初期状態を構築する
+/// @param lines      その方向の点列の集合
+/// @param m          B-スプラインの次数
+/// @param max_ctrl   制御点数の上限
+/// @param theta_tol  1制御点あたりの許容方向変化角 [rad]
+/// @return 初期状態（ノットベクトルと基底関数キャッシュを含む）
+SurfaceFitDirection InitSurfaceFitDirection(
+        const std::vector<std::vector<Vector3d>>& lines,
+        unsigned int m, unsigned int max_ctrl, double theta_tol) {
+    SurfaceFitDirection dir;
+    dir.m = m;
+    dir.max_control_points = max_ctrl;
+    dir.t_bar = AveragedChordLengthParams(lines);
+
+    // 初期制御点数は最も曲がりの大きい点列に合わせる
+    unsigned int k = 0;
+    for (const auto& line : lines) {
+        k = std::max(k, EstimateK(line, 1, m, theta_tol));
+    }
+    const unsigned int k_min = std::max(m, 2u);
+    const unsigned int k_cap = std::max(
+        k_min, (max_ctrl > 0u) ? max_ctrl - 1u : 0u);
+    dir.k = std::min({k, k_cap,
+                      static_cast<unsigned int>(dir.t_bar.size()) - 1});
+
+    dir.knots = BuildKnotVector(m, dir.k, dir.t_bar);
+    dir.basis = BuildBasisCache(dir.t_bar, m, dir.k, dir.knots);
+    return dir;
+}
+
+/// @brief 1方向の全ての点列を、共通のノットで並列に曲線近似する
+/// @param lines 点列の集合
+/// @param dir   その方向の状態
+/// @param ctrl  各点列の制御点（出力; 3×(k+1)）
+/// @param errors 各サンプルインデックスにおける全点列中の最大誤差（出力）
+/// @note 端点は補間する（r = 1）。係数行列は点列によらないため一度だけ分解する
+void FitLines(
+        const std::vector<std::vector<Vector3d>>& lines,
+        const SurfaceFitDirection& dir,
+        std::vector<Matrix3Xd>& ctrl,
+        std::vector<double>& errors) {
+    constexpr unsigned int r = 1;
+    const auto factor = FactorNormalEquations(dir.basis, dir.k, r);
+
+    ctrl.assign(lines.size(), Matrix3Xd());
+    std::vector<std::vector<double>> line_errors(lines.size());
+    igesio::ParallelFor(lines.size(), [&](size_t i) {
+        const auto& line = lines[i];
+        const Matrix3Xd P_fixed = FixEndpointControls(
+            line.front(), line.back(), EndpointDerivatives{},
+            dir.m, dir.k, r, dir.knots);
+        const Matrix3Xd X_free = SolveFreeControlPoints(
+            line, dir.basis, factor, P_fixed, dir.k, r);
+        ctrl[i] = MergeControlPoints(P_fixed, X_free, dir.k, r);
+        line_errors[i] = ComputeErrors(line, dir.basis, ctrl[i]);
+    });
+
+    errors.assign(dir.t_bar.size(), 0.0);
+    for (const auto& e : line_errors) {
+        for (size_t l = 0; l < e.size(); ++l) {
+            errors[l] = std::max(errors[l], e[l]);
+        }
+    }
+}
+
+/// @brief 点グリッドと近似曲面の最大誤差を計算する
+/// @param points 点グリッド Q_{i,j}
+/// @param u      u方向の状態
+/// @param v      v方向の状態
+/// @param P      制御点 (P[i].col(j) = P_{i,j})
+/// @return 全サンプル点での最大誤差
+double ComputeSurfaceError(
+        const std::vector<std::vector<Vector3d>>& points,
+        const SurfaceFitDirection& u,
+        const SurfaceFitDirection& v,
+        const std::vector<Matrix3Xd>& P) {
+    const int mu = u.basis.m, mv = v.basis.m;
+    std::vector<double> row_errors(points.size(), 0.0);
+    igesio::ParallelFor(points.size(), [&](size_t i) {
+        const double* Nu = u.basis.At(i);
+        const int i0 = u.basis.spans[i] - mu;
+        for (size_t j = 0; j < points[i].size(); ++j) {
+            const double* Nv = v.basis.At(j);
+            const int j0 = v.basis.spans[j] - mv;
+            Vector3d S = Vector3d::Zero();
+            for (int a = 0; a <= mu; ++a) {
+                Vector3d row = Vector3d::Zero();
+                for (int b = 0; b <= mv; ++b) {
+                    row += Nv[b] * P[i0 + a].col(j0 + b);
+                }
+                S += Nu[a] * row;
+            }
+            row_errors[i] = std::max(row_errors[i], (points[i][j] - S).norm());
+        }
+    });
+    return *std::max_element(row_errors.begin(), row_errors.end());
+}
+
+/// @brief 誤差が閾値を超える全てのノットスパンにノットを挿入する
+/// @param dir       細分する方向の状態（ノット・基底関数キャッシュが更新される）
+/// @param errors    各サンプルインデックスにおける最大誤差
+/// @param threshold 誤差の閾値（これ以上の誤差を含むスパンを細分する）
+/// @return 1つ以上のノットを挿入した場合はtrue
+/// @note 1反復あたりの求解コストがグリッド全体に比例するため、曲線近似と異なり
+///       1回の反復で複数のスパンを細分する。制御点数の上限を超えない範囲で、
+///       誤差の大きいスパンから順に中点を挿入する
+bool RefineSurfaceFitDirection(
+        SurfaceFitDirection& dir,
+        const std::vector<double>& errors,
+        double threshold) {
+    // スパンごとの最大誤差
+    std::vector<double> span_errors(dir.knots.size(), 0.0);
+    for (size_t l = 0; l < errors.size(); ++l) {
+        auto& e = span_errors[dir.basis.spans[l]];
+        e = std::max(e, errors[l]);
+    }
+    std::vector<int> spans;
+    for (size_t s = 0; s + 1 < dir.knots.size(); ++s) {
+        if (span_errors[s] >= threshold && span_errors[s] > 0.0
+                && dir.knots[s + 1] - dir.knots[s] >= 1e-12) {
+            spans.push_back(static_cast<int>(s));
+        }
+    }
+
+    // 上限・劣決定を超えない数だけ、誤差の大きいスパンを選ぶ
+    const unsigned int n_samples = static_cast<unsigned int>(dir.t_bar.size());
+    const unsigned int k_cap = std::min(
+        dir.max_control_points > 0u ? dir.max_control_points - 1u : 0u,
+        n_samples > 2u ? n_samples - 2u : 0u);
+    const size_t n_insert = std::min<size_t>(
+        spans.size(), k_cap > dir.k ? k_cap - dir.k : 0u);
+    std::partial_sort(spans.begin(), spans.begin() + n_insert, spans.end(),
+                      [&span_errors](int a, int b) {
+                          return span_errors[a] > span_errors[b];
+                      });
+    spans.resize(n_insert);
+
+    // 後ろのスパンから挿入することで、残りのスパンのインデックスを保つ
+    std::sort(spans.rbegin(), spans.rend());
+    for (const int s : spans) {
+        dir.knots.insert(dir.knots.begin() + s + 1,
+                         0.5 * (dir.knots[s] + dir.knots[s + 1]));
+        ++dir.k;
+        UpdateBasisCache(dir.basis, dir.t_bar, dir.k, dir.knots, s);
+    }
+    return !spans.empty();
+}
+
+/// @brief 曲面近似の反復ループを実行し、制御点とノットを確定する
+/// @param points  点グリッド Q_{i,j} ([i][j]; iがu方向)
+/// @param options 近似オプション
+/// @param u       u方向の状態（出力）
+/// @param v       v方向の状態（出力）
+/// @param P       制御点 (P[i].col(j) = P_{i,j}; 出力)
+/// @note u方向パスで各列 Q_{.,j} を近似して中間制御点 R_{i,j} を得た後、
+///       v方向パスで各行 R_{i,.} を近似する。B-スプライン基底は非負かつ
+///       1の分割であるため、曲面の誤差は両パスの誤差の和で抑えられる。
+///       このため誤差がε/2を超える方向の、ε/2を超えるスパンにノットを挿入する
+void RunSurfaceApproxLoop(
+        const std::vector<std::vector<Vector3d>>& points,
+        const i_ent::NurbsSurfaceApproxOptions& options,
+        SurfaceFitDirection& u,
+        SurfaceFitDirection& v,
+        std::vector<Matrix3Xd>& P) {
+    const size_t nu = points.size(), nv = points.front().size();
+
+    // u方向の点列 (列) を取り出す
+    std::vector<std::vector<Vector3d>> columns(nv, std::vector<Vector3d>(nu));
+    for (size_t i = 0; i < nu; ++i) {
+        for (size_t j = 0; j < nv; ++j) columns[j][i] = points[i][j];
+    }
+
+    u = InitSurfaceFitDirection(columns, options.u_degree,
+                                options.max_u_control_points,
+                                options.angle_per_segment);
+    v = InitSurfaceFitDirection(points, options.v_degree,
+                                options.max_v_control_points,
+                                options.angle_per_segment);
+
+    const double eps = options.tolerance;
+    std::vector<Matrix3Xd> R;
+    std::vector<double> errors_u, errors_v;
+    std::vector<std::vector<Vector3d>> rows;
+    while (true) {
+        // u方向パス: 各列を近似し、中間制御点 R_{i,j} = R[j].col(i) を得る
+        FitLines(columns, u, R, errors_u);
+
+        // v方向パス: 中間制御点の各行 R_{i,.} を近似する
+        rows.assign(u.k + 1, std::vector<Vector3d>(nv));
+        for (size_t j = 0; j < nv; ++j) {
+            for (unsigned int i = 0; i <= u.k; ++i) rows[i][j] = R[j].col(i);
+        }
+        FitLines(rows, v, P, errors_v);
+
+        // 終了判定
+        if (ComputeSurfaceError(points, u, v, P) <= eps) return;
+        const bool can_u = u.CanRefine(), can_v = v.CanRefine();
+        if (!can_u && !can_v) return;
+
+        // 誤差がε/2を超える方向を細分する。いずれも超えない（または上限に
+        // 達している）場合は、細分可能な方向のうち誤差の大きい方を細分する
+        const double e_u = *std::max_element(errors_u.begin(), errors_u.end());
+        const double e_v = *std::max_element(errors_v.begin(), errors_v.end());
+        bool inserted = false;
+        if (can_u && e_u > 0.5 * eps) {
+            inserted |= RefineSurfaceFitDirection(u, errors_u, 0.5 * eps);
+        }
+        if (can_v && e_v > 0.5 * eps) {
+            inserted |= RefineSurfaceFitDirection(v, errors_v, 0.5 * eps);
+        }
+        if (!inserted) {
+            // 誤差が大きい方向の誤差最大のスパンのみを細分する
+            if (can_u && (!can_v || e_u >= e_v)) {
+                inserted = RefineSurfaceFitDirection(u, errors_u, e_u);
+            } else {
+                inserted = RefineSurfaceFitDirection(v, errors_v, e_v);
+            }
+        }
+        if (!inserted) return;
     }
 }
 
@@ -794,4 +1218,119 @@ std::shared_ptr<RationalBSplineCurve> ApproximateWithNurbs(
         m, ctrl, knots, {}, std::array<double, 2>{0.0, 1.0});
 }
 
+std::shared_ptr<RationalBSplineSurface> ApproximateSurfaceWithNurbs(
+        const std::vector<std::vector<Vector3d>>& points,
+        const NurbsSurfaceApproxOptions& options) {
+    if (points.empty() || points.front().empty()) {
+        throw std::invalid_argument(
+            "ApproximateSurfaceWithNurbs: 点グリッドが空です。");
+    }
+    const size_t nv = points.front().size();
+    for (const auto& row : points) {
+        if (row.size() != nv) {
+            throw std::invalid_argument(
+                "ApproximateSurfaceWithNurbs: 点グリッドが矩形ではありません。");
+        }
+    }
+    // 各方向とも k_min = max(m, 2) に対し k_min+1 点以上が必要
+    if (options.u_degree == 0 || options.v_degree == 0
+            || points.size() < std::max(options.u_degree, 2u) + 1
+            || nv < std::max(options.v_degree, 2u) + 1) {
+        throw std::invalid_argument(
+            "ApproximateSurfaceWithNurbs: degree に対して入力点数が不足しています。");
+    }
+
+    SurfaceFitDirection u, v;
+    std::vector<Matrix3Xd> P;
+    RunSurfaceApproxLoop(points, options, u, v, P);
+
+    std::vector<std::vector<Vector3d>> ctrl(
+        u.k + 1, std::vector<Vector3d>(v.k + 1));
+    for (unsigned int i = 0; i <= u.k; ++i) {
+        for (unsigned int j = 0; j <= v.k; ++j) ctrl[i][j] = P[i].col(j);
+    }
+
+    // 重みは省略 (全1.0の多項式形式)
+    return MakeRationalBSplineSurface(
+        {u.m, v.m}, ctrl, u.knots, v.knots, {},
+        std::array<double, 4>{0.0, 1.0, 0.0, 1.0});
+}
+
+std::shared_ptr<RationalBSplineSurface> ApproximateSurfaceWithNurbs(
+        const ISurface& surface,
+        std::optional<std::array<double, 4>> param_range,
+        const NurbsSurfaceApproxOptions& options) {
+    // パラメータ範囲の解決
+    const auto range = param_range.value_or(surface.GetParameterRange());
+    if (!std::all_of(range.begin(), range.end(),
+                     [](double x) { return std::isfinite(x); })
+            || range[0] >= range[1] || range[2] >= range[3]) {
+        throw std::invalid_argument(
+            "ApproximateSurfaceWithNurbs: パラメータ範囲が無効です。");
+    }
+    const double du = range[1] - range[0];
+    const double dv = range[3] - range[2];
+    const auto eval = [&surface, &range, du, dv](double s, double t) {
+        const double u = std::clamp(range[0] + s * du, range[0], range[1]);
+        const double v = std::clamp(range[2] + t * dv, range[2], range[3]);
+        const auto p = surface.TryGetPointAt(u, v);
+        if (!p) {
+            throw std::invalid_argument(
+                "ApproximateSurfaceWithNurbs: 曲面の評価に失敗しました。");
+        }
+        return *p;
+    };
+
+    // 前処理: 粗いグリッドで ||S_uu||_∞, ||S_vv||_∞ と初期制御点数を推定する
+    constexpr unsigned int n_coarse = 20;
+    double max_uu = 0.0, max_vv = 0.0;
+    std::vector<std::vector<Vector3d>> coarse(
+        n_coarse + 1, std::vector<Vector3d>(n_coarse + 1));
+    for (unsigned int i = 0; i <= n_coarse; ++i) {
+        for (unsigned int j = 0; j <= n_coarse; ++j) {
+            const double s = static_cast<double>(i) / n_coarse;
+            const double t = static_cast<double>(j) / n_coarse;
+            coarse[i][j] = eval(s, t);
+            const auto d = surface.TryGetDerivatives(
+                range[0] + s * du, range[2] + t * dv, 2);
+            if (!d) continue;
+            max_uu = std::max(max_uu, (*d)(2, 0).norm() * du * du);
+            max_vv = std::max(max_vv, (*d)(0, 2).norm() * dv * dv);
+        }
+    }
+    std::vector<std::vector<Vector3d>> coarse_columns(
+        n_coarse + 1, std::vector<Vector3d>(n_coarse + 1));
+    unsigned int k_u = 0, k_v = 0;
+    for (unsigned int i = 0; i <= n_coarse; ++i) {
+        for (unsigned int j = 0; j <= n_coarse; ++j) {
+            coarse_columns[j][i] = coarse[i][j];
+        }
+        k_v = std::max(k_v, EstimateK(coarse[i], 1, options.v_degree,
+                                      options.angle_per_segment));
+    }
+    for (const auto& column : coarse_columns) {
+        k_u = std::max(k_u, EstimateK(column, 1, options.u_degree,
+                                      options.angle_per_segment));
+    }
+
+    // 各方向のサンプル数を決定し、等間隔グリッドをサンプリングする
+    const unsigned int L_max =
+        std::max(options.max_samples_per_direction, n_coarse);
+    const unsigned int L_u = std::min(
+        ComputeL(std::min(k_u, options.max_u_control_points), 1,
+                 max_uu, options.tolerance), L_max);
+    const unsigned int L_v = std::min(
+        ComputeL(std::min(k_v, options.max_v_control_points), 1,
+                 max_vv, options.tolerance), L_max);
+    std::vector<std::vector<Vector3d>> points(
+        L_u + 1, std::vector<Vector3d>(L_v + 1));
+    for (unsigned int i = 0; i <= L_u; ++i) {
+        for (unsigned int j = 0; j <= L_v; ++j) {
+            points[i][j] = eval(static_cast<double>(i) / L_u,
+                                static_cast<double>(j) / L_v);
+        }
+    }
+    return ApproximateSurfaceWithNurbs(points, options);
+}
+
 }  // namespace igesio::entities
@@ -0,0 +1,532 @@
+/**
+ * @file entities/curves/nurbs_conversion.cpp
+ * @brief 各種曲線・曲面のNURBSへの厳密変換で用いる区分的有理Bézier表現
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "./nurbs_conversion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "igesio/numerics/core/tolerance.h"
+#include "igesio/numerics/core/combinatorics.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+namespace i_ent = igesio::entities;
+namespace detail = igesio::entities::detail;
+
+using igesio::Matrix3Xd;
+using igesio::Matrix4d;
+using igesio::Vector3d;
+using igesio::Vector4d;
+using igesio::kPi;
+using detail::PiecewiseBezier;
+
+/// @brief 同次座標をデカルト座標に変換する
+Vector3d ToCartesian(const Vector4d& pw) {
+    return Vector3d{pw(0) / pw(3), pw(1) / pw(3), pw(2) / pw(3)};
+}
+
+/// @brief デカルト座標と重みから同次座標を作成する
+Vector4d ToHomogeneous(const Vector3d& p, const double w) {
+    return Vector4d{p(0) * w, p(1) * w, p(2) * w, w};
+}
+
+/// @brief 2点が (座標値の大きさに対して相対的に) 一致するか
+bool IsSamePoint(const Vector3d& a, const Vector3d& b) {
+    const double scale = 1.0 + std::max(a.norm(), b.norm());
+    return (a - b).norm() <= i_num::kGeometryTolerance * scale;
+}
+
+/// @brief 有理Bézierの制御点をde Casteljau法で分割する
+/// @param points 制御点 (同次座標)
+/// @param s 分割位置 (0 < s < 1)
+/// @return 分割後の {前半, 後半} の制御点
+std::pair<std::vector<Vector4d>, std::vector<Vector4d>>
+SplitBezier(const std::vector<Vector4d>& points, const double s) {
+    const size_t n = points.size();
+    std::vector<Vector4d> work = points;
+    std::vector<Vector4d> left(n), right(n);
+    left[0] = work[0];
+    right[n - 1] = work[n - 1];
+    for (size_t r = 1; r < n; ++r) {
+        for (size_t i = 0; i < n - r; ++i) {
+            work[i] = (1.0 - s) * work[i] + s * work[i + 1];
+        }
+        left[r] = work[0];
+        right[n - 1 - r] = work[n - 1 - r];
+    }
+    return {left, right};
+}
+
+/// @brief 2直線 a0 + λ da, b0 + μ db の最近接パラメータを求める
+/// @return {λ, μ}. 2直線が平行な場合は`std::nullopt`
+std::optional<std::pair<double, double>> IntersectLines(
+        const Vector3d& a0, const Vector3d& da,
+        const Vector3d& b0, const Vector3d& db) {
+    const double a11 = da.dot(da), a12 = -da.dot(db), a22 = db.dot(db);
+    const Vector3d rhs = b0 - a0;
+    const double b1 = da.dot(rhs), b2 = -db.dot(rhs);
+    const double det = a11 * a22 - a12 * a12;
+    if (std::abs(det) <= i_num::kAngleTolerance * a11 * a22) return std::nullopt;
+    return std::make_pair((b1 * a22 - a12 * b2) / det, (a11 * b2 - a12 * b1) / det);
+}
+
+/// @brief ノットを1つ挿入する (Boehmの方法)
+/// @param knots ノットベクトル (上書きされる)
+/// @param points 同次制御点 (上書きされる)
+/// @param p 次数
+/// @param u 挿入するノット
+/// @return 挿入できた場合はtrue
+bool InsertKnot(std::vector<double>& knots, std::vector<Vector4d>& points,
+                const int p, const double u) {
+    const int n = static_cast<int>(points.size());
+    // U[k] <= u < U[k+1] なるスパン. 定義域の終端ではU[k] < u <= U[k+1]を用いる
+    int k = static_cast<int>(
+        std::upper_bound(knots.begin(), knots.end(), u) - knots.begin()) - 1;
+    if (k > n - 1) {
+        k = static_cast<int>(
+            std::lower_bound(knots.begin(), knots.end(), u) - knots.begin()) - 1;
+    }
+    if (k < p || k > n - 1) return false;
+
+    std::vector<Vector4d> result(n + 1);
+    for (int i = 0; i <= k - p; ++i) result[i] = points[i];
+    for (int i = k - p + 1; i <= k; ++i) {
+        const double alpha = (u - knots[i]) / (knots[i + p] - knots[i]);
+        result[i] = alpha * points[i] + (1.0 - alpha) * points[i - 1];
+    }
+    for (int i = k + 1; i <= n; ++i) result[i] = points[i - 1];
+
+    points = std::move(result);
+    knots.insert(knots.begin() + k + 1, u);
+    return true;
+}
+
+/// @brief 同次座標のNURBSを区分的有理Bézierに分解する
+/// @param knots ノットベクトル
+/// @param points 同次制御点
+/// @param p 次数
+/// @param a パラメータ範囲の始点
+/// @param b パラメータ範囲の終点
+/// @return パラメータ範囲 [a, b] を各ノットで区切った区分的有理Bézier.
+///         パラメータは元のNURBSと一致する. 分解できない場合は`std::nullopt`
+/// @note ノット・制御点が同じであれば、区間の境界は常に同じになる
+///       (曲面の各行を分解する際に区間が揃う)
+std::optional<PiecewiseBezier> DecomposeToBezier(
+        std::vector<double> knots, std::vector<Vector4d> points,
+        const int p, double a, double b) {
+    if (p < 1) return std::nullopt;
+
+    // パラメータ範囲の端点をノットに揃える (浮動小数点誤差による微小区間の防止)
+    const double snap = i_num::kParameterTolerance
+                      * std::max(1.0, knots.back() - knots.front());
+    auto snap_to_knot = [&knots, snap](const double u) {
+        for (const double k : knots) {
+            if (std::abs(k - u) <= snap) return k;
+        }
+        return u;
+    };
+    a = snap_to_knot(a);
+    b = snap_to_knot(b);
+    if (!(a < b)) return std::nullopt;
+
+    // 範囲端点・内部ノットの多重度をp以上にする
+    std::vector<double> targets = {a};
+    for (const double k : knots) {
+        if (k > a && k < b && k != targets.back()) targets.push_back(k);
+    }
+    targets.push_back(b);
+    for (const double u : targets) {
+        auto multiplicity = std::count(knots.begin(), knots.end(), u);
+        for (; multiplicity < p; ++multiplicity) {
+            if (!InsertKnot(knots, points, p, u)) return std::nullopt;
+        }
+    }
+
+    // 各区間 [x0, x1] のBézier制御点 P_{k-p}, ..., P_k を取り出す
+    PiecewiseBezier result;
+    result.degree = static_cast<unsigned int>(p);
+    result.breakpoints = targets;
+    for (size_t i = 0; i + 1 < targets.size(); ++i) {
+        const int k = static_cast<int>(std::upper_bound(
+                knots.begin(), knots.end(), targets[i]) - knots.begin()) - 1;
+        result.segments.emplace_back(points.begin() + (k - p), points.begin() + k + 1);
+    }
+    return result;
+}
+
+/// @brief 同次座標の点にアフィン変換を適用する
+/// @param transform 同次変換行列
+/// @param pw 同次座標の点 (wx, wy, wz, w)
+/// @return (w(Rx + T), w)
+Vector4d TransformHomogeneous(const Matrix4d& transform, const Vector4d& pw) {
+    Vector4d moved = pw;
+    for (int r = 0; r < 3; ++r) {
+        moved(r) = transform(r, 0) * pw(0) + transform(r, 1) * pw(1)
+                 + transform(r, 2) * pw(2) + transform(r, 3) * pw(3);
+    }
+    return moved;
+}
+
+}  // namespace
+
+
+
+/**
+ * 区分的有理Bézierの構築
+ */
+
+std::vector<Vector4d> detail::PowerBasisToBezier(
+        const std::vector<Vector4d>& coeffs, const double h) {
+    const auto p = static_cast<unsigned int>(coeffs.size()) - 1;
+    std::vector<Vector4d> result(p + 1, Vector4d::Zero());
+    for (unsigned int k = 0; k <= p; ++k) {
+        double h_i = 1.0;
+        for (unsigned int i = 0; i <= k; ++i) {
+            const double ratio = i_num::BinomialCoefficient<double>(k, i)
+                               / i_num::BinomialCoefficient<double>(p, i);
+            result[k] += (ratio * h_i) * coeffs[i];
+            h_i *= h;
+        }
+    }
+    return result;
+}
+
+PiecewiseBezier detail::MakePolyline(
+        const std::vector<Vector3d>& points, const std::vector<double>& params) {
+    PiecewiseBezier polyline;
+    polyline.degree = 1;
+    polyline.breakpoints.push_back(params.front());
+    for (size_t i = 1; i < points.size(); ++i) {
+        if (!(params[i] > polyline.breakpoints.back())) continue;
+        polyline.segments.push_back({ToHomogeneous(points[i - 1], 1.0),
+                                     ToHomogeneous(points[i], 1.0)});
+        polyline.breakpoints.push_back(params[i]);
+    }
+    return polyline;
+}
+
+PiecewiseBezier detail::MakeUnitArc(const double start_angle, const double end_angle) {
+    const double sweep = end_angle - start_angle;
+    const auto n_segments = std::max(1, static_cast<int>(
+            std::ceil(sweep / (kPi / 2.0) - i_num::kAngleTolerance)));
+    const double delta = sweep / n_segments;
+    const double w_mid = std::cos(delta / 2.0);
+
+    PiecewiseBezier arc;
+    arc.degree = 2;
+    for (int i = 0; i <= n_segments; ++i) {
+        arc.breakpoints.push_back(start_angle + delta * i);
+    }
+    arc.breakpoints.back() = end_angle;
+    for (int i = 0; i < n_segments; ++i) {
+        const double a0 = arc.breakpoints[i];
+        const double a1 = arc.breakpoints[i + 1];
+        const double am = (a0 + a1) / 2.0;
+        arc.segments.push_back({
+            Vector4d{std::cos(a0), std::sin(a0), 0.0, 1.0},
+            Vector4d{std::cos(am), std::sin(am), 0.0, w_mid},
+            Vector4d{std::cos(a1), std::sin(a1), 0.0, 1.0}});
+    }
+    return arc;
+}
+
+std::optional<PiecewiseBezier> detail::ConicToBezier(
+        const ICurve& curve, const std::vector<double>& breakpoints) {
+    PiecewiseBezier result;
+    result.degree = 2;
+    result.breakpoints = breakpoints;
+    for (size_t i = 0; i + 1 < breakpoints.size(); ++i) {
+        const double t0 = breakpoints[i], t1 = breakpoints[i + 1];
+        const auto d0 = curve.TryGetDefinedDerivatives(t0, 1);
+        const auto d1 = curve.TryGetDefinedDerivatives(t1, 1);
+        const auto dm = curve.TryGetDefinedDerivatives((t0 + t1) / 2.0, 0);
+        if (!d0 || !d1 || !dm) return std::nullopt;
+        const Vector3d& p0 = (*d0)[0];
+        const Vector3d& p2 = (*d1)[0];
+        const Vector3d& shoulder = (*dm)[0];
+
+        // 中間制御点: 両端の接線の交点
+        const auto tangents = IntersectLines(p0, (*d0)[1], p2, (*d1)[1]);
+        if (!tangents || tangents->first <= 0.0 || tangents->second >= 0.0) {
+            return std::nullopt;
+        }
+        const Vector3d p1 = p0 + tangents->first * (*d0)[1];
+
+        // 重み: 直線P1-Sと弦P0-P2の交点Q = (1-a)P0 + aP2、S = (1-s)Q + sP1 より
+        //       r = √(a/(1-a)), w = s(1+r²) / (2r(1-s))
+        const auto chord = IntersectLines(p1, shoulder - p1, p0, p2 - p0);
+        if (!chord || chord->first <= 1.0) return std::nullopt;
+        const double a = chord->second;
+        const double s = 1.0 - 1.0 / chord->first;
+        if (a <= 0.0 || a >= 1.0 || s <= 0.0 || s >= 1.0) return std::nullopt;
+        const double r = std::sqrt(a / (1.0 - a));
+        const double w = s * (1.0 + r * r) / (2.0 * r * (1.0 - s));
+
+        result.segments.push_back({ToHomogeneous(p0, 1.0),
+                                   ToHomogeneous(p1, w),
+                                   ToHomogeneous(p2, 1.0)});
+    }
+    return result;
+}
+
+std::optional<PiecewiseBezier> detail::NurbsToBezier(
+        const RationalBSplineCurve& curve, const Matrix4d& transform) {
+    const auto& weights = curve.Weights();
+    const auto& cps = curve.ControlPoints();
+    std::vector<Vector4d> points;
+    for (size_t i = 0; i < weights.size(); ++i) {
+        points.push_back(ToHomogeneous(cps.col(i), weights[i]));
+    }
+    const auto [a, b] = curve.GetParameterRange();
+    auto result = DecomposeToBezier(curve.Knots(), std::move(points),
+                                    curve.Degree(), a, b);
+    if (!result) return std::nullopt;
+    ApplyAffine(*result, transform);
+    return result;
+}
+
+std::optional<PiecewiseBezier> detail::ModelSpaceBezier(const ICurve& curve) {
+    const auto nurbs = curve.ToNurbs();
+    if (!nurbs) return std::nullopt;
+    return NurbsToBezier(*nurbs, nurbs->GetTransformationMatrix().GetTransformation());
+}
+
+std::optional<detail::PiecewiseBezierSurface> detail::NurbsSurfaceToBezier(
+        const RationalBSplineSurface& surface, const Matrix4d& transform) {
+    const auto [p, q] = surface.Degrees();
+    const auto [n_u, n_v] = surface.NumControlPoints();
+    const auto& cps = surface.ControlPoints();
+    const auto range = surface.GetParameterRange();
+
+    // u方向: v方向の添字jごとの行 P(0..K1, j) を同じノットで分解する
+    std::vector<PiecewiseBezier> rows;
+    for (unsigned int j = 0; j < n_v; ++j) {
+        std::vector<Vector4d> points;
+        for (unsigned int i = 0; i < n_u; ++i) {
+            points.push_back(ToHomogeneous(cps.col(i * n_v + j),
+                                           surface.WeightAt(i, j)));
+        }
+        auto row = DecomposeToBezier(surface.UKnots(), std::move(points),
+                                     static_cast<int>(p), range[0], range[1]);
+        if (!row) return std::nullopt;
+        rows.push_back(std::move(*row));
+    }
+
+    // v方向: 各u区間の各制御点列 (u方向の添字k) を分解する
+    PiecewiseBezierSurface result;
+    result.u_degree = p;
+    result.v_degree = q;
+    result.u_breakpoints = rows.front().breakpoints;
+    const auto u_count = rows.front().segments.size();
+    std::vector<std::vector<PiecewiseBezier>> columns(u_count);
+    for (size_t iu = 0; iu < u_count; ++iu) {
+        for (unsigned int k = 0; k <= p; ++k) {
+            std::vector<Vector4d> points;
+            for (const auto& row : rows) points.push_back(row.segments[iu][k]);
+            auto column = DecomposeToBezier(surface.VKnots(), std::move(points),
+                                            static_cast<int>(q), range[2], range[3]);
+            if (!column) return std::nullopt;
+            columns[iu].push_back(std::move(*column));
+        }
+    }
+    result.v_breakpoints = columns.front().front().breakpoints;
+    const auto v_count = columns.front().front().segments.size();
+    for (size_t iu = 0; iu < u_count; ++iu) {
+        for (size_t iv = 0; iv < v_count; ++iv) {
+            std::vector<Vector4d> patch;
+            patch.reserve((p + 1) * (q + 1));
+            for (unsigned int i = 0; i <= p; ++i) {
+                for (unsigned int j = 0; j <= q; ++j) {
+                    patch.push_back(TransformHomogeneous(
+                            transform, columns[iu][i].segments[iv][j]));
+                }
+            }
+            result.patches.push_back(std::move(patch));
+        }
+    }
+    return result;
+}
+
+std::optional<detail::PiecewiseBezierSurface>
+detail::ModelSpaceBezierSurface(const ISurface& surface) {
+    const auto nurbs = surface.ToNurbs();
+    if (!nurbs) return std::nullopt;
+    return NurbsSurfaceToBezier(
+            *nurbs, nurbs->GetTransformationMatrix().GetTransformation());
+}
+
+
+
+/**
+ * 区分的有理Bézierの操作
+ */
+
+PiecewiseBezier detail::ElevateDegree(
+        const PiecewiseBezier& bezier, const unsigned int degree) {
+    PiecewiseBezier result = bezier;
+    for (auto p = bezier.degree; p < degree; ++p) {
+        for (auto& segment : result.segments) {
+            std::vector<Vector4d> elevated(p + 2);
+            elevated[0] = segment[0];
+            elevated[p + 1] = segment[p];
+            for (unsigned int i = 1; i <= p; ++i) {
+                const double alpha = static_cast<double>(i) / (p + 1);
+                elevated[i] = alpha * segment[i - 1] + (1.0 - alpha) * segment[i];
+            }
+            segment = std::move(elevated);
+        }
+    }
+    result.degree = std::max(bezier.degree, degree);
+    return result;
+}
+
+PiecewiseBezier detail::Refine(
+        const PiecewiseBezier& bezier, const std::vector<double>& params) {
+    PiecewiseBezier result;
+    result.degree = bezier.degree;
+    result.breakpoints.push_back(bezier.breakpoints.front());
+    for (size_t i = 0; i < bezier.segments.size(); ++i) {
+        const double t0 = bezier.breakpoints[i], t1 = bezier.breakpoints[i + 1];
+        const double tol = i_num::kParameterTolerance * std::max(1.0, t1 - t0);
+        std::vector<double> inner;
+        for (const double t : params) {
+            if (t > t0 + tol && t < t1 - tol) inner.push_back(t);
+        }
+        std::sort(inner.begin(), inner.end());
+        inner.erase(std::unique(inner.begin(), inner.end(),
+                [tol](double x, double y) { return y - x <= tol; }), inner.end());
+
+        // 残りの区間 [start, t1] を前から順に分割する
+        auto rest = bezier.segments[i];
+        double start = t0;
+        for (const double t : inner) {
+            auto [left, right] = SplitBezier(rest, (t - start) / (t1 - start));
+            result.segments.push_back(std::move(left));
+            result.breakpoints.push_back(t);
+            rest = std::move(right);
+            start = t;
+        }
+        result.segments.push_back(std::move(rest));
+        result.breakpoints.push_back(t1);
+    }
+    return result;
+}
+
+PiecewiseBezier detail::Reparameterize(
+        const PiecewiseBezier& bezier, const double start, const double end) {
+    const double t0 = bezier.breakpoints.front();
+    const double scale = (end - start) / (bezier.breakpoints.back() - t0);
+    PiecewiseBezier result = bezier;
+    for (auto& t : result.breakpoints) t = start + (t - t0) * scale;
+    result.breakpoints.front() = start;
+    result.breakpoints.back() = end;
+    if (end < start) {
+        std::reverse(result.breakpoints.begin(), result.breakpoints.end());
+        std::reverse(result.segments.begin(), result.segments.end());
+        for (auto& segment : result.segments) {
+            std::reverse(segment.begin(), segment.end());
+        }
+    }
+    return result;
+}
+
+void detail::ApplyAffine(PiecewiseBezier& bezier, const Matrix4d& transform) {
+    for (auto& segment : bezier.segments) {
+        for (auto& pw : segment) pw = TransformHomogeneous(transform, pw);
+    }
+}
+
+Vector3d detail::Evaluate(const PiecewiseBezier& bezier, const double t) {
+    const auto& bps = bezier.breakpoints;
+    auto i = static_cast<size_t>(
+            std::upper_bound(bps.begin(), bps.end(), t) - bps.begin());
+    i = std::clamp<size_t>(i, 1, bezier.segments.size()) - 1;
+    const double s = (t - bps[i]) / (bps[i + 1] - bps[i]);
+
+    std::vector<Vector4d> work = bezier.segments[i];
+    for (size_t r = 1; r < work.size(); ++r) {
+        for (size_t j = 0; j < work.size() - r; ++j) {
+            work[j] = (1.0 - s) * work[j] + s * work[j + 1];
+        }
+    }
+    return ToCartesian(work[0]);
+}
+
+std::optional<detail::HomogeneousNurbs>
+detail::Assemble(const PiecewiseBezier& bezier) {
+    if (bezier.segments.empty()) return std::nullopt;
+    const auto p = bezier.degree;
+
+    HomogeneousNurbs result;
+    result.degree = p;
+    for (size_t i = 0; i < bezier.segments.size(); ++i) {
+        auto segment = bezier.segments[i];
+        // 先頭区間は始点の重みを1に、以降は前区間の終点の重みに揃える
+        const double target_w = (i == 0) ? 1.0 : result.points.back()(3);
+        if (i > 0 && !IsSamePoint(ToCartesian(result.points.back()),
+                                  ToCartesian(segment[0]))) {
+            return std::nullopt;
+        }
+        const double scale = target_w / segment[0](3);
+        for (auto& pw : segment) pw *= scale;
+
+        if (i == 0) result.points.push_back(segment[0]);
+        result.points.insert(result.points.end(), segment.begin() + 1, segment.end());
+    }
+
+    // 端点は多重度p+1、区間の境界は多重度p
+    const auto& bps = bezier.breakpoints;
+    result.knots.assign(p + 1, bps.front());
+    for (size_t i = 1; i + 1 < bps.size(); ++i) {
+        result.knots.insert(result.knots.end(), p, bps[i]);
+    }
+    result.knots.insert(result.knots.end(), p + 1, bps.back());
+    return result;
+}
+
+
+
+/**
+ * NURBSエンティティの作成
+ */
+
+std::shared_ptr<i_ent::RationalBSplineCurve>
+detail::MakeCurve(const HomogeneousNurbs& nurbs) {
+    const auto n = static_cast<unsigned int>(nurbs.points.size());
+    std::vector<double> weights(n);
+    Matrix3Xd control_points(3, n);
+    for (unsigned int i = 0; i < n; ++i) {
+        weights[i] = nurbs.points[i](3);
+        const auto p = ToCartesian(nurbs.points[i]);
+        for (int r = 0; r < 3; ++r) control_points(r, i) = p(r);
+    }
+    return std::make_shared<RationalBSplineCurve>(
+            n - 1, nurbs.degree, nurbs.knots, weights, control_points,
+            std::array<double, 2>{nurbs.knots.front(), nurbs.knots.back()});
+}
+
+std::shared_ptr<i_ent::RationalBSplineSurface> detail::MakeSurface(
+        const HomogeneousNurbs& u_nurbs, const HomogeneousNurbs& v_nurbs,
+        const std::vector<std::vector<Vector4d>>& points) {
+    std::vector<std::vector<Vector3d>> control_points(points.size());
+    std::vector<std::vector<double>> weights(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        for (const auto& pw : points[i]) {
+            control_points[i].push_back(ToCartesian(pw));
+            weights[i].push_back(pw(3));
+        }
+    }
+    return MakeRationalBSplineSurface(
+            {u_nurbs.degree, v_nurbs.degree}, control_points,
+            u_nurbs.knots, v_nurbs.knots, weights,
+            std::array<double, 4>{u_nurbs.knots.front(), u_nurbs.knots.back(),
+                                  v_nurbs.knots.front(), v_nurbs.knots.back()});
+}
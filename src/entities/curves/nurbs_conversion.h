@@ -0,0 +1,197 @@
+/**
+ * @file entities/curves/nurbs_conversion.h
+ * @brief 各種曲線・曲面のNURBSへの厳密変換で用いる区分的有理Bézier表現
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note ICurve::ConvertToNurbs / ISurface::ConvertToNurbs の各実装で共通に
+ *       使用するため、共通のヘッダーファイルとして定義する. 公開APIには含めない.
+ */
+#ifndef IGESIO_ENTITIES_CURVES_NURBS_CONVERSION_H_
+#define IGESIO_ENTITIES_CURVES_NURBS_CONVERSION_H_
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/interfaces/i_curve.h"
+#include "igesio/entities/curves/rational_b_spline_curve.h"
+#include "igesio/entities/surfaces/rational_b_spline_surface.h"
+
+
+
+namespace igesio::entities::detail {
+
+/// @brief 区分的有理Bézier曲線
+/// @note 各区間の制御点は同次座標 (wx, wy, wz, w) で保持する.
+///       区間iはパラメータ範囲 [breakpoints[i], breakpoints[i+1]] に対応する
+struct PiecewiseBezier {
+    /// @brief 次数 p (全区間共通)
+    unsigned int degree = 0;
+    /// @brief 区間の境界パラメータ (昇順; サイズは区間数+1)
+    std::vector<double> breakpoints;
+    /// @brief 各区間の同次制御点 (各区間p+1個)
+    std::vector<std::vector<Vector4d>> segments;
+};
+
+/// @brief 有理Bézierパッチの集合 (NURBS曲面を各ノットで区切ったもの)
+/// @note パッチ (iu, iv) はパラメータ範囲 [u_breakpoints[iu], u_breakpoints[iu+1]]
+///       × [v_breakpoints[iv], v_breakpoints[iv+1]] に対応する
+struct PiecewiseBezierSurface {
+    /// @brief u方向の次数 p
+    unsigned int u_degree = 0;
+    /// @brief v方向の次数 q
+    unsigned int v_degree = 0;
+    /// @brief u方向の区間の境界パラメータ (昇順)
+    std::vector<double> u_breakpoints;
+    /// @brief v方向の区間の境界パラメータ (昇順)
+    std::vector<double> v_breakpoints;
+    /// @brief 各パッチの同次制御点 (wx, wy, wz, w)
+    /// @note patches[iu * (v方向の区間数) + iv][i * (q + 1) + j] がパッチ (iu, iv)
+    ///       の制御点P(i, j)に対応する
+    std::vector<std::vector<Vector4d>> patches;
+};
+
+/// @brief 同次座標の制御点列からなるNURBS (ノット・制御点の組)
+struct HomogeneousNurbs {
+    /// @brief 次数 p
+    unsigned int degree = 0;
+    /// @brief クランプされたノットベクトル
+    std::vector<double> knots;
+    /// @brief 同次制御点 (wx, wy, wz, w)
+    std::vector<Vector4d> points;
+};
+
+
+
+/**
+ * 区分的有理Bézierの構築
+ */
+
+/// @brief 多項式 C(s) = Σ a_i s^i (s ∈ [0, h]) をBézier制御点に変換する
+/// @param coeffs 同次座標の係数 a_0, ..., a_p
+/// @param h 区間長
+/// @return Bézier制御点 P_k = Σ_{i≤k} C(k,i)/C(p,i) a_i h^i (k = 0, ..., p)
+std::vector<Vector4d> PowerBasisToBezier(
+        const std::vector<Vector4d>&, const double);
+
+/// @brief 折れ線を1次の区分的Bézierで表す
+/// @param points 頂点の座標値
+/// @param params 各頂点に対応するパラメータ (昇順; pointsと同じサイズ)
+/// @return 1次の区分的Bézier. 長さ0の区間 (パラメータが等しい隣接頂点) は除く
+PiecewiseBezier MakePolyline(const std::vector<Vector3d>&, const std::vector<double>&);
+
+/// @brief xy平面上の単位円弧 (原点中心、半径1、z = 0) を作成する
+/// @param start_angle 始点の角度 θs [rad]
+/// @param end_angle 終点の角度 θe [rad] (θs < θe)
+/// @return 中心角π/2以下の有理2次Bézierに分割した円弧.
+///         区間の境界パラメータは角度 (θs, ..., θe) とする
+PiecewiseBezier MakeUnitArc(const double, const double);
+
+/// @brief 定義空間において平面上にある2次曲線 (円錐曲線) を有理2次Bézierで表す
+/// @param curve 2次曲線 (定義空間の導関数を使用する)
+/// @param breakpoints 区間の境界パラメータ (各区間で接線の回転角がπ未満であること)
+/// @return 区分的有理2次Bézier. 接線が平行となる等、構築できない場合は`std::nullopt`
+/// @note 各区間の端点と接線から中間制御点を、区間中央の点から重みを定める.
+///       形状は元の曲線と一致するが、区間内のパラメータは一致しない
+std::optional<PiecewiseBezier> ConicToBezier(
+        const ICurve&, const std::vector<double>&);
+
+/// @brief NURBS曲線を区分的有理Bézierに分解する
+/// @param curve NURBS曲線
+/// @param transform 制御点に適用するアフィン変換 (同次変換行列)
+/// @return パラメータ範囲 [V(0), V(1)] を各ノットで区切った区分的有理Bézier.
+///         パラメータは元の曲線と一致する. 分解できない場合は`std::nullopt`
+std::optional<PiecewiseBezier> NurbsToBezier(
+        const RationalBSplineCurve&, const Matrix4d& = Matrix4d::Identity());
+
+/// @brief 曲線のNURBS表現をモデル空間の区分的有理Bézierとして取得する
+/// @param curve 曲線 (ICurve::ToNurbs() で変換可能であること)
+/// @return 曲線自身の変換行列を適用した区分的有理Bézier.
+///         NURBSに変換できない場合は`std::nullopt`
+std::optional<PiecewiseBezier> ModelSpaceBezier(const ICurve&);
+
+/// @brief NURBS曲面を有理Bézierパッチに分解する
+/// @param surface NURBS曲面
+/// @param transform 制御点に適用するアフィン変換 (同次変換行列)
+/// @return パラメータ範囲を各ノットで区切った有理Bézierパッチの集合.
+///         パラメータは元の曲面と一致する. 分解できない場合は`std::nullopt`
+std::optional<PiecewiseBezierSurface> NurbsSurfaceToBezier(
+        const RationalBSplineSurface&, const Matrix4d& = Matrix4d::Identity());
+
+/// @brief 曲面のNURBS表現をモデル空間の有理Bézierパッチとして取得する
+/// @param surface 曲面 (ISurface::ToNurbs() で変換可能であること)
+/// @return 曲面自身の変換行列を適用した有理Bézierパッチの集合.
+///         パラメータはToNurbs()の結果と一致する.
+///         NURBSに変換できない場合は`std::nullopt`
+std::optional<PiecewiseBezierSurface> ModelSpaceBezierSurface(const ISurface&);
+
+
+
+/**
+ * 区分的有理Bézierの操作
+ */
+
+/// @brief 次数を上げる
+/// @param bezier 区分的有理Bézier
+/// @param degree 目標の次数 (現在の次数以上)
+/// @return 次数を上げた区分的有理Bézier (形状・パラメータは不変)
+PiecewiseBezier ElevateDegree(const PiecewiseBezier&, const unsigned int);
+
+/// @brief 指定したパラメータで区間を分割する
+/// @param bezier 区分的有理Bézier
+/// @param params 分割するパラメータ (範囲外・既存の境界と一致するものは無視する)
+/// @return 分割後の区分的有理Bézier (形状・パラメータは不変)
+PiecewiseBezier Refine(const PiecewiseBezier&, const std::vector<double>&);
+
+/// @brief パラメータ範囲をアフィン変換する
+/// @param bezier 区分的有理Bézier
+/// @param start 新しい始点のパラメータ
+/// @param end 新しい終点のパラメータ
+/// @return 始点がstart、終点がendに対応する区分的有理Bézier.
+///         start > endの場合は向きを反転し、[end, start]を昇順で持つ
+PiecewiseBezier Reparameterize(const PiecewiseBezier&, const double, const double);
+
+/// @brief 制御点にアフィン変換を適用する
+/// @param bezier 区分的有理Bézier (上書きされる)
+/// @param transform 同次変換行列
+void ApplyAffine(PiecewiseBezier&, const Matrix4d&);
+
+/// @brief 点 C(t) を計算する
+/// @param bezier 区分的有理Bézier
+/// @param t パラメータ値 (範囲外の場合は端の区間を外挿する)
+/// @return 点の座標値
+Vector3d Evaluate(const PiecewiseBezier&, const double);
+
+/// @brief 区分的有理Bézierを1本のNURBSにまとめる
+/// @param bezier 区分的有理Bézier
+/// @return 区間の境界で多重度pのノットを持つクランプされたNURBS.
+///         境界で隣接区間の端点が一致しない場合は`std::nullopt`
+/// @note 隣接区間で端点の重みが異なる場合は、後続区間の同次座標をスケーリングして
+///       揃える (有理Bézierは同次座標の定数倍で形状が変わらない)
+std::optional<HomogeneousNurbs> Assemble(const PiecewiseBezier&);
+
+
+
+/**
+ * NURBSエンティティの作成
+ */
+
+/// @brief 同次座標のNURBSからRationalBSplineCurveを作成する
+/// @param nurbs NURBS
+/// @return 作成したRationalBSplineCurve
+std::shared_ptr<RationalBSplineCurve> MakeCurve(const HomogeneousNurbs&);
+
+/// @brief 同次座標の制御点グリッドからRationalBSplineSurfaceを作成する
+/// @param u_nurbs u方向のノット・次数を与えるNURBS (制御点は使用しない)
+/// @param v_nurbs v方向のノット・次数を与えるNURBS (制御点は使用しない)
+/// @param points 同次制御点 ([i][j]: u方向i番目、v方向j番目)
+/// @return 作成したRationalBSplineSurface
+std::shared_ptr<RationalBSplineSurface> MakeSurface(
+        const HomogeneousNurbs&, const HomogeneousNurbs&,
+        const std::vector<std::vector<Vector4d>>&);
+
+}  // namespace igesio::entities::detail
+
+#endif  // IGESIO_ENTITIES_CURVES_NURBS_CONVERSION_H_
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "igesio/numerics/core/tolerance.h"
+#include "./nurbs_conversion.h"
 
 namespace {
 
@@ -576,6 +577,50 @@ ParametricSplineCurve::FindSegmentIndex(const double t) const {
 }
 
 
+
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<i_ent::RationalBSplineCurve>
+ParametricSplineCurve::ConvertToNurbs() const {
+    const unsigned int n_segments = NumberOfSegments();
+    if (n_segments == 0) return nullptr;
+
+    // 次数は全セグメントで0でない係数の最高次 (最低1次)
+    unsigned int degree = 1;
+    for (unsigned int i = 0; i < n_segments; ++i) {
+        const auto coef = Coefficients(i);
+        for (unsigned int k = 3; k > degree; --k) {
+            if (coef(0, k) != 0.0 || coef(1, k) != 0.0 || coef(2, k) != 0.0) {
+                degree = k;
+                break;
+            }
+        }
+    }
+
+    // 各セグメントの多項式 (s = t - T(i)) をBézier制御点に変換する
+    i_ent::detail::PiecewiseBezier bezier;
+    bezier.degree = degree;
+    bezier.breakpoints = breakpoints_;
+    for (unsigned int i = 0; i < n_segments; ++i) {
+        const auto coef = Coefficients(i);
+        std::vector<igesio::Vector4d> power(degree + 1);
+        for (unsigned int k = 0; k <= degree; ++k) {
+            power[k] = igesio::Vector4d{coef(0, k), coef(1, k), coef(2, k),
+                                        (k == 0) ? 1.0 : 0.0};
+        }
+        bezier.segments.push_back(i_ent::detail::PowerBasisToBezier(
+                power, breakpoints_[i + 1] - breakpoints_[i]));
+    }
+
+    const auto nurbs = i_ent::detail::Assemble(bezier);
+    if (!nurbs) return nullptr;
+    return i_ent::detail::MakeCurve(*nurbs);
+}
+
+
+
 /**
  * ファクトリ関数
  */
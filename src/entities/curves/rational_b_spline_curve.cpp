@@ -18,6 +18,7 @@
 #include "igesio/numerics/core/tolerance.h"
 #include "igesio/numerics/core/combinatorics.h"
 #include "./nurbs_basis_function.h"
+#include "./nurbs_conversion.h"
 
 namespace {
 
@@ -779,6 +780,20 @@ void RationalBSplineCurve::UpdatePlanarity() {
 
 
 
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<RationalBSplineCurve> RationalBSplineCurve::ConvertToNurbs() const {
+    auto curve = std::make_shared<RationalBSplineCurve>(
+            NumControlPoints() - 1, degree_, knots_, weights_, control_points_,
+            parameter_range_, is_periodic_);
+    curve->SetCurveType(GetCurveType());
+    return curve;
+}
+
+
+
 /**
  * ファクトリ関数
  */
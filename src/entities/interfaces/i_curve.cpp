@@ -7,10 +7,15 @@
  */
 #include "igesio/entities/interfaces/i_curve.h"
 
+#include <algorithm>
 #include <limits>
+#include <utility>
+#include <vector>
 
-#include "igesio/numerics/analysis/integration.h"
+#include "igesio/numerics/analysis/gauss_quadrature.h"
 #include "igesio/numerics/core/tolerance.h"
+#include "igesio/entities/entity_base.h"
+#include "igesio/entities/curves/rational_b_spline_curve.h"
 
 namespace {
 
@@ -28,6 +33,36 @@ using i_ent::CurveDerivatives;
 /// @brief 左側接線/右側接線を計算する際の微小パラメータ値h
 constexpr double kTangentH = 1e-7;
 
+/// @brief 弧長テーブルの区間を二分する最大の深さ
+constexpr int kArcLengthMaxDepth = 20;
+/// @brief 弧長テーブルの区間内でパラメータを逆算する際の最大反復回数
+constexpr int kArcLengthMaxIterations = 60;
+
+/// @brief ルジャンドル級数で表した区間内の弧長とその導関数を計算する
+/// @param coefficients ds/dξ のルジャンドル級数の係数 a_0, ..., a_D
+/// @param xi 区間を[-1, 1]に正規化した変数ξ
+/// @return {区間始点からの弧長 s(ξ), ds/dξ}
+/// @note ∫_{-1}^{ξ} P_j = (P_{j+1}(ξ) - P_{j-1}(ξ)) / (2j + 1) (j ≥ 1) を用いる
+template <size_t N>
+std::array<double, 2> EvaluateArcLengthSeries(
+        const std::array<double, N>& coefficients, const double xi) {
+    // P_0, ..., P_N を3項漸化式で計算する
+    std::array<double, N + 1> p;
+    p[0] = 1.0;
+    p[1] = xi;
+    for (size_t n = 1; n < N; ++n) {
+        p[n + 1] = ((2.0 * n + 1.0) * xi * p[n] - n * p[n - 1]) / (n + 1.0);
+    }
+
+    double s = coefficients[0] * (xi + 1.0);
+    double ds = coefficients[0];
+    for (size_t j = 1; j < N; ++j) {
+        s += coefficients[j] * (p[j + 1] - p[j - 1]) / (2.0 * j + 1.0);
+        ds += coefficients[j] * p[j];
+    }
+    return {s, ds};
+}
+
 }  // namespace
 
 
@@ -236,12 +271,191 @@ double ICurve::Length(const double start, const double end) const {
         return c1.norm();
     };
 
-    try {
-        return i_num::Integrate(integrand, {start, end});
-    } catch (const std::invalid_argument& e) {
-        // パラメータの問題で積分に失敗した場合は0を返す
-        return 0.0;
+    // std::functionを介さない適応型ガウス=クロンロッド求積法で積分する.
+    // 滑らかな区間は15点で収束し、角点付近のみ細分される
+    return i_num::AdaptiveGaussKronrod(integrand, {start, end}).value;
+}
+
+std::shared_ptr<const ICurve::ArcLengthTable> ICurve::GetArcLengthTable() const {
+    // 複合曲線の子の編集等も検知するよう、参照先を含めた形状キーで判定する
+    const auto key = i_ent::CombineGeometryKeyRecursive(0, *this);
+    return arc_length_table_.Get(key, [this]() { return ComputeArcLengthTable(); });
+}
+
+ICurve::ArcLengthTable ICurve::ComputeArcLengthTable() const {
+    if (!IsFinite()) {
+        throw std::out_of_range(
+            "Arc length parameterization is not available for a curve "
+            "with infinite parameter range.");
+    }
+
+    auto speeds = [this](const std::array<double, i_num::kGaussKronrodPoints>& t,
+                         std::array<double, i_num::kGaussKronrodPoints>& speed) {
+        for (size_t i = 0; i < i_num::kGaussKronrodPoints; ++i) {
+            auto deriv = TryGetDefinedDerivatives(t[i], 1);
+            speed[i] = deriv.has_value() ? (*deriv)[1].norm() : 0.0;
+        }
+    };
+
+    // 初期区間: 等分点に角点を加える (速さが不連続となる点を区間端に置く)
+    const auto [t_start, t_end] = GetParameterRange();
+    std::vector<double> breaks = GetCornerParams();
+    breaks.erase(std::remove_if(breaks.begin(), breaks.end(), [&](const double t) {
+        return !(t_start < t && t < t_end);
+    }), breaks.end());
+    for (unsigned int i = 0; i <= kArcLengthInitialSegments; ++i) {
+        breaks.push_back(t_start + (t_end - t_start) * i / kArcLengthInitialSegments);
+    }
+    std::sort(breaks.begin(), breaks.end());
+    breaks.erase(std::unique(breaks.begin(), breaks.end(), [](double a, double b) {
+        return i_num::IsApproxEqual(a, b);
+    }), breaks.end());
+    breaks.back() = t_end;
+
+    /// 近似待ちの区間
+    struct Pending {
+        double a, b;
+        int depth;
+    };
+
+    ArcLengthTable table;
+    double s_accumulated = 0.0;
+    for (size_t i = 0; i + 1 < breaks.size(); ++i) {
+        std::vector<Pending> stack = {{breaks[i], breaks[i + 1], 0}};
+        while (!stack.empty()) {
+            const auto seg = stack.back();
+            stack.pop_back();
+
+            // K15則の節点における速さから、速さのルジャンドル級数を求める.
+            // 求積の推定誤差と級数末尾の係数がともに小さければ区間を確定する
+            std::array<double, i_num::kGaussKronrodPoints> speed;
+            const auto quadrature = i_num::GaussKronrod15Batch(
+                [&](const std::array<double, i_num::kGaussKronrodPoints>& t,
+                    std::array<double, i_num::kGaussKronrodPoints>& fx) {
+                    speeds(t, fx);
+                    speed = fx;
+                }, {seg.a, seg.b});
+            auto coefficients =
+                i_num::LegendreCoefficientsFromKronrod15<kArcLengthFitDegree>(speed);
+            const double half = (seg.b - seg.a) / 2.0;
+            for (auto& c : coefficients) c *= half;
+
+            const double length = quadrature.value;
+            const double tol = kArcLengthRelTolerance * length;
+            const double tail = 2.0 * (std::abs(coefficients[kArcLengthFitDegree - 1])
+                                     + std::abs(coefficients[kArcLengthFitDegree]));
+            if ((tail <= tol && quadrature.error <= tol) ||
+                seg.depth >= kArcLengthMaxDepth) {
+                table.segments.push_back({seg.a, seg.b, s_accumulated,
+                                          s_accumulated + length, coefficients});
+                s_accumulated += length;
+                continue;
+            }
+
+            // パラメータ順に処理するため、右側を先に積む
+            const double mid = (seg.a + seg.b) / 2.0;
+            stack.push_back({mid, seg.b, seg.depth + 1});
+            stack.push_back({seg.a, mid, seg.depth + 1});
+        }
+    }
+
+    return table;
+}
+
+double ICurve::ParameterAtLength(const double s) const {
+    const auto table = GetArcLengthTable();
+    const auto& segments = table->segments;
+    // パラメータ範囲が退化している (t_start == t_end) 場合、テーブルは空となる
+    const double total = segments.empty() ? 0.0 : segments.back().s1;
+    // Length()の推定誤差程度の超過 (s = Length()を渡した場合など) は端点へ丸める
+    auto s_clamped = i_num::TryClampToRange(
+        s, 0.0, total, std::max(i_num::Tolerance().abs_tol,
+                                kArcLengthRelTolerance * total));
+    if (!s_clamped.has_value()) {
+        throw std::out_of_range(
+            "Arc length for ParameterAtLength() is out of range. Got s = " +
+            std::to_string(s) + ", curve length = " + std::to_string(total) + ".");
+    }
+
+    if (segments.empty()) return GetParameterRange()[0];
+
+    // s(t1) >= s となる最初の区間を二分探索する
+    const auto it = std::lower_bound(
+        segments.begin(), segments.end(), *s_clamped,
+        [](const ArcLengthSegment& seg, const double value) { return seg.s1 < value; });
+    const auto& seg = (it == segments.end()) ? segments.back() : *it;
+    const double target = *s_clamped - seg.s0;
+    const double length = seg.s1 - seg.s0;
+    if (length <= 0.0) return seg.t0;
+
+    // 区間内の級数をニュートン法で解く. 区間外へ出る場合は二分法に切り替える
+    double lo = -1.0, hi = 1.0;
+    double xi = std::clamp(2.0 * target / length - 1.0, lo, hi);
+    for (int i = 0; i < kArcLengthMaxIterations; ++i) {
+        const auto [s_xi, ds_xi] = EvaluateArcLengthSeries(seg.coefficients, xi);
+        const double residual = s_xi - target;
+        if (std::abs(residual) <= i_num::kParameterTolerance * length) break;
+        if (residual > 0.0) {
+            hi = xi;
+        } else {
+            lo = xi;
+        }
+        double next = (ds_xi > 0.0) ? xi - residual / ds_xi : lo;
+        if (!(lo < next && next < hi)) next = (lo + hi) / 2.0;
+        if (next == xi) break;
+        xi = next;
     }
+    return seg.t0 + (xi + 1.0) / 2.0 * (seg.t1 - seg.t0);
+}
+
+std::vector<double> ICurve::ParametersAtEqualArcLength(const unsigned int n) const {
+    if (n < 2) {
+        throw std::invalid_argument(
+            "ParametersAtEqualArcLength() requires at least 2 points. Got n = " +
+            std::to_string(n) + ".");
+    }
+    if (!IsFinite()) {
+        throw std::out_of_range(
+            "Arc length parameterization is not available for a curve "
+            "with infinite parameter range.");
+    }
+
+    const auto [t_start, t_end] = GetParameterRange();
+    // ParameterAtLengthが範囲判定に用いるテーブルの全長と揃える
+    const auto table = GetArcLengthTable();
+    const double total = table->segments.empty() ? 0.0 : table->segments.back().s1;
+    std::vector<double> params(n);
+    params.front() = t_start;
+    for (unsigned int i = 1; i + 1 < n; ++i) {
+        params[i] = ParameterAtLength(total * i / (n - 1));
+    }
+    params.back() = t_end;
+    return params;
+}
+
+std::vector<Vector3d> ICurve::PointsAtEqualArcLength(const unsigned int n) const {
+    const auto params = ParametersAtEqualArcLength(n);
+    std::vector<Vector3d> points;
+    points.reserve(params.size());
+    for (const auto t : params) points.push_back(GetPointAt(t));
+    return points;
+}
+
+std::shared_ptr<const i_ent::RationalBSplineCurve> ICurve::ToNurbs() const {
+    const auto key = i_ent::CombineGeometryKeyRecursive(0, *this);
+    return *nurbs_cache_.Get(key, [this]() {
+        auto curve = ConvertToNurbs();
+        if (curve) {
+            // 自身と同じ変換行列を参照させ、モデル空間での形状も一致させる
+            const auto* base = dynamic_cast<const i_ent::EntityBase*>(this);
+            if (base != nullptr) {
+                if (auto trans = base->GetTransformationMatrix().GetPointer()) {
+                    curve->OverwriteTransformationMatrix(trans);
+                }
+            }
+        }
+        return std::shared_ptr<const i_ent::RationalBSplineCurve>(curve);
+    });
 }
 
 
@@ -319,6 +533,25 @@ std::optional<Vector3d> ICurve::TryGetPointAt(const double t) const  {
     return Transform(TryGetDefinedPointAt(t), true);
 }
 
+std::vector<std::optional<Vector3d>>
+ICurve::TryGetPointsAt(const std::vector<double>& ts) const {
+    // M_entity (v' = Rv + T) を原点と基底ベクトルの変換から1回だけ求める
+    const Vector3d translation = *Transform(Vector3d::Zero(), true);
+    igesio::Matrix3d rotation;
+    for (int i = 0; i < 3; ++i) {
+        rotation.col(i) = *Transform(Vector3d::Unit(i), false);
+    }
+
+    std::vector<std::optional<Vector3d>> points;
+    points.reserve(ts.size());
+    for (const double t : ts) {
+        const auto p = TryGetDefinedPointAt(t);
+        points.push_back(p ? std::optional<Vector3d>(rotation * *p + translation)
+                           : std::nullopt);
+    }
+    return points;
+}
+
 std::optional<Vector3d> ICurve::TryGetTangentAt(const double t) const {
     return Transform(TryGetDefinedTangentAt(t), false);
 }
@@ -75,18 +75,22 @@ bool IRestrictedSurface::IsInDomain(const double u, const double v) const {
     // 最速パス: 境界なし
     if (outer_is_boundary_of_d_ && GetInnerBoundaryCount() == 0) return true;
 
-    BuildDomainCache();
+    const auto cache = GetDomainCache();
 
     const Vector3d pt(u, v, 0);
 
     // 外側境界チェック (明示指定かつキャッシュが有効なとき)
-    if (!outer_is_boundary_of_d_ && domain_cache_->outer) {
-        if (!i_num::IsPointInPolygon(pt, *domain_cache_->outer)) return false;
+    if (!outer_is_boundary_of_d_ && cache->outer) {
+        if (!i_num::IsPointInPolygon(pt, *cache->outer, *cache->outer_grid)) {
+            return false;
+        }
     }
 
     // 内側境界チェック (穴の内部ならfalse)
-    for (const auto& inner_poly : domain_cache_->inner) {
-        if (i_num::IsPointInPolygon(pt, inner_poly)) return false;
+    for (std::size_t i = 0; i < cache->inner.size(); ++i) {
+        if (i_num::IsPointInPolygon(pt, cache->inner[i], cache->inner_grids[i])) {
+            return false;
+        }
     }
 
     return true;
@@ -100,14 +104,13 @@ bool IRestrictedSurface::IsInDomain(const double u, const double v) const {
 
 const std::optional<i_num::CurveContainmentPolygons>&
 IRestrictedSurface::GetOuterDomainPolygon() const {
-    BuildDomainCache();
-    return domain_cache_->outer;
+    // キャッシュはdomain_cache_が保持し続けるため、参照は無効化まで有効
+    return GetDomainCache()->outer;
 }
 
 const std::vector<i_num::CurveContainmentPolygons>&
 IRestrictedSurface::GetInnerDomainPolygons() const {
-    BuildDomainCache();
-    return domain_cache_->inner;
+    return GetDomainCache()->inner;
 }
 
 
@@ -116,9 +119,12 @@ IRestrictedSurface::GetInnerDomainPolygons() const {
  * キャッシュの構築
  */
 
-void IRestrictedSurface::BuildDomainCache() const {
-    if (domain_cache_) return;
+std::shared_ptr<const IRestrictedSurface::DomainCache>
+IRestrictedSurface::GetDomainCache() const {
+    return domain_cache_.Get([this] { return ComputeDomainCache(); });
+}
 
+IRestrictedSurface::DomainCache IRestrictedSurface::ComputeDomainCache() const {
     DomainCache cache;
 
     // 外側境界 (明示指定のとき)。境界が未解決/退化/非閉でテッセレーションが例外を
@@ -150,7 +156,15 @@ void IRestrictedSurface::BuildDomainCache() const {
         }
     }
 
-    domain_cache_ = std::move(cache);
+    // 内外判定を高速化する格子 (IsInDomainで使用する)
+    if (cache.outer) {
+        cache.outer_grid = i_num::BuildPolygonContainmentGrid(*cache.outer);
+    }
+    cache.inner_grids.reserve(cache.inner.size());
+    for (const auto& inner : cache.inner) {
+        cache.inner_grids.push_back(i_num::BuildPolygonContainmentGrid(inner));
+    }
+    return cache;
 }
 
 
@@ -8,9 +8,15 @@
 #include "igesio/entities/interfaces/i_surface.h"
 
 #include <limits>
+#include <memory>
+#include <tuple>
 #include <utility>
 
+#include "igesio/numerics/analysis/gauss_quadrature.h"
 #include "igesio/numerics/core/tolerance.h"
+#include "igesio/entities/entity_base.h"
+#include "igesio/entities/surfaces/rational_b_spline_surface.h"
+#include "igesio/entities/surfaces/algorithms/curve_surface_inversion.h"
 
 namespace {
 
@@ -111,6 +117,33 @@ std::vector<double> ISurface::GetUCreaseParameters() const {
     return {};
 }
 
+std::shared_ptr<const i_ent::RationalBSplineSurface> ISurface::ToNurbs() const {
+    const auto key = i_ent::CombineGeometryKeyRecursive(0, *this);
+    return *nurbs_cache_.Get(key, [this]() {
+        auto surface = ConvertToNurbs();
+        if (surface) {
+            // 自身と同じ変換行列を参照させ、モデル空間での形状も一致させる
+            const auto* base = dynamic_cast<const i_ent::EntityBase*>(this);
+            if (base != nullptr) {
+                if (auto trans = base->GetTransformationMatrix().GetPointer()) {
+                    surface->OverwriteTransformationMatrix(trans);
+                }
+            }
+        }
+        return std::shared_ptr<const i_ent::RationalBSplineSurface>(surface);
+    });
+}
+
+std::shared_ptr<const i_ent::SurfacePointLocator>
+ISurface::GetPointLocator(const int u_samples, const int v_samples) const {
+    const auto key = std::make_tuple(
+            i_ent::CombineGeometryKeyRecursive(0, *this), u_samples, v_samples);
+    return *point_locator_cache_.Get(key, [&]() {
+        return std::make_shared<const i_ent::SurfacePointLocator>(
+                *this, u_samples, v_samples);
+    });
+}
+
 
 
 /**
@@ -257,13 +290,9 @@ double ISurface::Area(const double u_start, const double u_end,
         return cross_product.norm();
     };
 
-    // 数値積分を実行
-    try {
-        return i_num::Integrate(integrand, {u_start, u_end, v_start, v_end}, tol);
-    } catch (const std::invalid_argument&) {
-        // パラメータの問題で計算に失敗した場合は0を返す
-        return 0.0;
-    }
+    // 数値積分を実行 (std::functionを介さない適応型キュバチャ)
+    return i_num::AdaptiveCubature2D(
+        integrand, {u_start, u_end, v_start, v_end}, tol).value;
 }
 
 
@@ -40,10 +40,16 @@ i_ent::MeshEntity::MeshEntity(numerics::TriangleMeshd mesh)
 void i_ent::MeshEntity::SetMesh(numerics::TriangleMeshd mesh) {
     ThrowIfInvalid(mesh);
     mesh_ = std::move(mesh);
+    bvh_.Reset();
     // 形状編集としてリビジョンをバンプする (成功経路のみ)
     MarkGeometryModified();
 }
 
+const igesio::numerics::Bvh& i_ent::MeshEntity::GetBvh() const {
+    // BVHはbvh_が保持し続けるため、参照はSetMeshまで有効
+    return *bvh_.Get([this]() { return numerics::BuildMeshBvh(mesh_); });
+}
+
 igesio::numerics::BoundingBox i_ent::MeshEntity::GetDefinedBoundingBox() const {
     return numerics::ComputeBoundingBox(mesh_);
 }
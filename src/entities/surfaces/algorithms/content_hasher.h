@@ -0,0 +1,63 @@
+/**
+ * @file entities/surfaces/algorithms/content_hasher.h
+ * @brief 実行環境によらず安定したハッシュ (FNV-1a) の計算 (内部実装)
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 本ファイルは内部実装用であり、公開APIには含めない.
+ *       テッセレーションのパラメータのハッシュ (HashTessellationParams) と、
+ *       サイドカーファイルの内容ハッシュ (ComputeEntityContentHash) に用いる.
+ */
+#ifndef SRC_ENTITIES_SURFACES_ALGORITHMS_CONTENT_HASHER_H_
+#define SRC_ENTITIES_SURFACES_ALGORITHMS_CONTENT_HASHER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+
+
+namespace igesio::entities {
+
+/// @brief FNV-1a (64bit) によるハッシュの計算
+/// @note std::hashは実装依存のため、ファイルに保存する値には用いない.
+///       値はバイト順の同じ環境の間で一致する
+class ContentHasher {
+ public:
+    /// @brief バイト列を結合する
+    void AddBytes(const void* data, const std::size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            value_ ^= bytes[i];
+            value_ *= 0x100000001b3ULL;
+        }
+    }
+    /// @brief 算術型の値を結合する
+    template <typename T>
+    void Add(const T value) {
+        static_assert(std::is_arithmetic_v<T>, "ContentHasher::Add: arithmetic only.");
+        AddBytes(&value, sizeof(value));
+    }
+    /// @brief 実数値を結合する (-0.0は0.0として扱う)
+    void Add(const double value) {
+        const double normalized = (value == 0.0) ? 0.0 : value;
+        AddBytes(&normalized, sizeof(normalized));
+    }
+    /// @brief 文字列を結合する
+    void Add(const std::string& value) {
+        Add(static_cast<std::uint64_t>(value.size()));
+        AddBytes(value.data(), value.size());
+    }
+
+    /// @brief 現在のハッシュ値
+    std::uint64_t Value() const { return value_; }
+
+ private:
+    /// @brief ハッシュ値
+    std::uint64_t value_ = 0xcbf29ce484222325ULL;
+};
+
+}  // namespace igesio::entities
+
+#endif  // SRC_ENTITIES_SURFACES_ALGORITHMS_CONTENT_HASHER_H_
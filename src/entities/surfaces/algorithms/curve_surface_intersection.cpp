@@ -0,0 +1,253 @@
+/**
+ * @file entities/surfaces/algorithms/curve_surface_intersection.cpp
+ * @brief 曲線と曲面の交点計算の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/entities/surfaces/algorithms/curve_surface_intersection.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "igesio/common/parallel.h"
+#include "igesio/numerics/geometric/bvh.h"
+#include "entities/curves/algorithms/curve_segment_tree.h"
+#include "entities/surfaces/algorithms/surface_cell_tree.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+namespace i_ent = igesio::entities;
+using i_ent::ICurve;
+using i_ent::ISurface;
+using i_ent::CurveSegmentTree;
+using i_ent::SurfaceCellTree;
+using i_ent::SurfaceParamRange;
+using i_ent::CurveSurfaceIntersection;
+using i_ent::CurveSurfaceIntersectionParams;
+using igesio::Matrix3d;
+using igesio::Vector3d;
+
+/// @brief ガウス・ニュートン法の減衰係数 (正規方程式の対角に加える相対量)
+/// @note 接する交点・曲面上にある曲線でヤコビアンが退化しても反復を継続するために加える
+constexpr double kDamping = 1e-12;
+
+
+
+/// @brief 初期値 (t, u, v) から |C(t) - S(u, v)|^2 を最小化し、交点を求める
+/// @return 最終的な距離がtolerance以下の場合は交点、それ以外はnullopt
+/// @note 正規方程式 (J^T J + λI) Δ = -J^T r (J = [C' | -Su | -Sv]) による
+///       減衰付きガウス・ニュートン法. 制限面のドメイン外に出た場合は失敗とする
+std::optional<CurveSurfaceIntersection> Refine(
+        const ICurve& curve, const ISurface& surface, const SurfaceParamRange& pr,
+        double t, double u, double v,
+        const CurveSurfaceIntersectionParams& params) {
+    const auto t_range = curve.GetParameterRange();
+    for (int iter = 0; iter < params.max_iter; ++iter) {
+        const auto c = curve.TryGetDerivatives(t, 1);
+        const auto s = surface.TryGetDerivatives(u, v, 1);
+        if (!c || !s) return std::nullopt;
+
+        Matrix3d J;
+        J.col(0) = (*c)[1];
+        J.col(1) = -(*s)(1, 0);
+        J.col(2) = -(*s)(0, 1);
+        const Vector3d r = (*c)[0] - (*s)(0, 0);
+        Matrix3d A = J.transpose() * J;
+        const double trace = A.trace();
+        if (!(trace > 0.0)) break;  // 曲線・曲面とも導関数がゼロ
+        A.diagonal().array() += kDamping * trace;
+        const double det = A.determinant();
+        if (!(det > 0.0)) break;
+        const Vector3d delta = -(A.inverse() * (J.transpose() * r));
+
+        const double t_new = std::clamp(t + delta(0), t_range[0], t_range[1]);
+        const double u_new = std::clamp(u + delta(1), pr.u_min, pr.u_max);
+        const double v_new = std::clamp(v + delta(2), pr.v_min, pr.v_max);
+        const double step = std::max({std::abs(t_new - t), std::abs(u_new - u),
+                                      std::abs(v_new - v)});
+        t = t_new;
+        u = u_new;
+        v = v_new;
+        if (step <= params.convergence_tol) break;
+    }
+
+    const auto c = curve.TryGetPointAt(t);
+    const auto s = surface.TryGetDerivatives(u, v, 0);
+    if (!c || !s) return std::nullopt;
+    const Vector3d sp = (*s)(0, 0);
+    const double gap = (*c - sp).norm();
+    if (gap > params.tolerance) return std::nullopt;
+    return CurveSurfaceIntersection{0.5 * (*c + sp), t, u, v, gap};
+}
+
+/// @brief 重複解を除去し、tの昇順に並べる
+/// @param merge_dist 同じ接触点とみなしうる空間距離の上限 (広域判定の分解能)
+/// @note 空間距離がdedup_tol未満の解に加え、距離がmerge_dist未満かつ両解の
+///       パラメータの中点でも距離がtolerance以下の解を同じ接触点とみなし、
+///       gapの小さい方を残す (curve_curve_intersection.cppと同様)
+void DeduplicateAndSort(std::vector<CurveSurfaceIntersection>& results,
+                        const ICurve& curve, const ISurface& surface,
+                        const double merge_dist,
+                        const CurveSurfaceIntersectionParams& params) {
+    std::sort(results.begin(), results.end(),
+              [](const CurveSurfaceIntersection& a, const CurveSurfaceIntersection& b) {
+        if (a.t != b.t) return a.t < b.t;
+        return a.u < b.u || (a.u == b.u && a.v < b.v);
+    });
+    const auto same_contact = [&](const CurveSurfaceIntersection& a,
+                                  const CurveSurfaceIntersection& b) {
+        const double dist = (a.position - b.position).norm();
+        if (dist < params.dedup_tol) return true;
+        if (dist >= merge_dist) return false;
+        const auto c = curve.TryGetPointAt(0.5 * (a.t + b.t));
+        const auto s = surface.TryGetPointAt(0.5 * (a.u + b.u), 0.5 * (a.v + b.v));
+        return c && s && (*c - *s).norm() <= params.tolerance;
+    };
+
+    std::vector<CurveSurfaceIntersection> kept;
+    kept.reserve(results.size());
+    for (const auto& r : results) {
+        const auto it = std::find_if(kept.begin(), kept.end(),
+                [&](const CurveSurfaceIntersection& k) { return same_contact(k, r); });
+        if (it == kept.end()) {
+            kept.push_back(r);
+        } else if (r.gap < it->gap) {
+            *it = r;
+        }
+    }
+    results = std::move(kept);
+}
+
+/// @brief paramsを検証する
+/// @throw std::invalid_argument u_samples, v_samplesが1未満の場合
+void ValidateParams(const CurveSurfaceIntersectionParams& params,
+                    const char* function) {
+    if (params.u_samples < 1 || params.v_samples < 1) {
+        throw std::invalid_argument(std::string(function) +
+            ": u_samples and v_samples must be at least 1.");
+    }
+}
+
+/// @brief 曲線の折れ線化の許容距離を決定する
+double ChordToleranceFor(const ICurve& curve,
+                         const CurveSurfaceIntersectionParams& params) {
+    return params.chord_tolerance > 0.0
+            ? params.chord_tolerance : i_ent::DefaultChordTolerance(curve);
+}
+
+/// @brief 折れ線近似済みの曲線と、セル分割済みの曲面の交点を計算する
+std::vector<CurveSurfaceIntersection> IntersectTrees(
+        const ICurve& curve, const CurveSegmentTree& segments,
+        const ISurface& surface, const SurfaceCellTree& cells,
+        const CurveSurfaceIntersectionParams& params) {
+    std::vector<CurveSurfaceIntersection> results;
+    const Vector3d pad = Vector3d::Constant(
+            2.0 * segments.chord_tolerance + params.tolerance);
+
+    for (std::size_t e = 0; e < segments.EdgeCount(); ++e) {
+        const Vector3d& p0 = segments.points[e];
+        const Vector3d& p1 = segments.points[e + 1];
+        const Vector3d lower = p0.cwiseMin(p1) - pad;
+        const Vector3d upper = p0.cwiseMax(p1) + pad;
+        const Vector3d d = p1 - p0;
+        const double d_sq = d.squaredNorm();
+        i_num::QueryBvh(cells.bvh, [&](const Vector3d& lo, const Vector3d& hi) {
+            return (lo.array() <= upper.array()).all() &&
+                   (lower.array() <= hi.array()).all();
+        }, [&](const std::uint32_t cell) {
+            // 辺上でセルの代表点に最も近い点を曲線側の初期値とする
+            const double a = d_sq > 0.0
+                    ? std::clamp((cells.centers[cell] - p0).dot(d) / d_sq, 0.0, 1.0)
+                    : 0.0;
+            const double t = segments.params[e] +
+                    a * (segments.params[e + 1] - segments.params[e]);
+            const auto [u, v] = cells.centers_uv[cell];
+            if (auto hit = Refine(curve, surface, cells.range, t, u, v, params)) {
+                results.push_back(*hit);
+            }
+        });
+    }
+
+    DeduplicateAndSort(results, curve, surface, segments.chord_tolerance, params);
+    return results;
+}
+
+}  // namespace
+
+
+
+/**
+ * 曲線と曲面の交点計算
+ */
+
+std::vector<CurveSurfaceIntersection> i_ent::IntersectCurveWithSurface(
+        const ICurve& curve, const ISurface& surface,
+        const CurveSurfaceIntersectionParams& params) {
+    ValidateParams(params, "IntersectCurveWithSurface");
+    const auto segments = BuildCurveSegmentTree(
+            curve, ChordToleranceFor(curve, params), false);
+    const auto cells = BuildSurfaceCellTree(
+            surface, params.u_samples, params.v_samples);
+    return IntersectTrees(curve, segments, surface, cells, params);
+}
+
+std::vector<std::vector<CurveSurfaceIntersection>> i_ent::IntersectCurveSurfacePairs(
+        const std::vector<CurveSurfacePair>& pairs,
+        const CurveSurfaceIntersectionParams& params) {
+    ValidateParams(params, "IntersectCurveSurfacePairs");
+
+    // 組に現れる曲線・曲面を列挙する (同じ曲線・曲面の前処理は共有する)
+    std::vector<const ICurve*> curves;
+    std::vector<const ISurface*> surfaces;
+    std::unordered_map<const ICurve*, std::size_t> curve_indices;
+    std::unordered_map<const ISurface*, std::size_t> surface_indices;
+    std::vector<std::array<std::size_t, 2>> pair_indices(pairs.size());
+    for (std::size_t k = 0; k < pairs.size(); ++k) {
+        const auto* curve = pairs[k].curve.get();
+        const auto* surface = pairs[k].surface.get();
+        if (!curve || !surface) {
+            throw std::invalid_argument(
+                "IntersectCurveSurfacePairs: curves and surfaces must not be null.");
+        }
+        if (!curve->IsFinite()) {
+            throw std::invalid_argument(
+                "IntersectCurveSurfacePairs: curves must have a finite "
+                "parameter range.");
+        }
+        const auto [c_it, c_inserted] = curve_indices.emplace(curve, curves.size());
+        if (c_inserted) curves.push_back(curve);
+        const auto [s_it, s_inserted] =
+                surface_indices.emplace(surface, surfaces.size());
+        if (s_inserted) surfaces.push_back(surface);
+        pair_indices[k] = {c_it->second, s_it->second};
+    }
+
+    std::vector<CurveSegmentTree> segments(curves.size());
+    igesio::ParallelFor(curves.size(), [&](const std::size_t i) {
+        segments[i] = BuildCurveSegmentTree(
+                *curves[i], ChordToleranceFor(*curves[i], params), false);
+    });
+    std::vector<SurfaceCellTree> cells(surfaces.size());
+    igesio::ParallelFor(surfaces.size(), [&](const std::size_t i) {
+        cells[i] = BuildSurfaceCellTree(
+                *surfaces[i], params.u_samples, params.v_samples);
+    });
+
+    std::vector<std::vector<CurveSurfaceIntersection>> results(pairs.size());
+    igesio::ParallelFor(pairs.size(), [&](const std::size_t k) {
+        const auto [i, j] = pair_indices[k];
+        results[k] = IntersectTrees(
+                *curves[i], segments[i], *surfaces[j], cells[j], params);
+    });
+    return results;
+}
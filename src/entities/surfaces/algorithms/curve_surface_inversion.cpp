@@ -10,12 +10,14 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <optional>
 #include <utility>
 #include <vector>
 
 #include "igesio/numerics/core/tolerance.h"
+#include "igesio/numerics/geometric/bvh.h"
 #include "entities/curves/algorithms/polygonal_approximation.h"
 
 namespace {
@@ -120,27 +122,13 @@ std::optional<std::array<double, 2>> RunInversion(
     return std::nullopt;
 }
 
-/// @brief 格子サンプリングでPに最も近い初期パラメータ (u,v) を探す
+/// @brief 格子サンプルの最近傍探索でPに最も近い初期パラメータ (u,v) を探す
+/// @return 最も近いサンプル点の (u,v). サンプル点が無い場合はパラメータ範囲の中心
 std::array<double, 2> GridSearchInit(
-        const ISurface& surface, const Vector3d& p,
-        const ParamRange& pr, const CurveInversionParams& params) {
-    const double du = (pr.u_max - pr.u_min) / (params.grid_u + 1);
-    const double dv = (pr.v_max - pr.v_min) / (params.grid_v + 1);
-
-    std::array<double, 2> best = {0.5 * (pr.u_min + pr.u_max),
-                                  0.5 * (pr.v_min + pr.v_max)};
-    double best_dist = std::numeric_limits<double>::infinity();
-    for (int iu = 1; iu <= params.grid_u; ++iu) {
-        const double u = pr.u_min + iu * du;
-        for (int iv = 1; iv <= params.grid_v; ++iv) {
-            const double v = pr.v_min + iv * dv;
-            const auto pt = surface.TryGetPointAt(u, v);
-            if (!pt) continue;
-            const double dist = (*pt - p).norm();
-            if (dist < best_dist) { best_dist = dist; best = {u, v}; }
-        }
-    }
-    return best;
+        const i_ent::SurfacePointLocator& locator, const Vector3d& p,
+        const ParamRange& pr) {
+    if (const auto nearest = locator.FindNearestSample(p)) return *nearest;
+    return {0.5 * (pr.u_min + pr.u_max), 0.5 * (pr.v_min + pr.v_max)};
 }
 
 /// @brief 連続する2点間がseam (閉方向のラップ跳び) かどうかを判定する
@@ -163,6 +151,46 @@ bool IsSeamJump(const ISurface& surface,
 
 
 
+/**
+ * SurfacePointLocator
+ */
+
+i_ent::SurfacePointLocator::SurfacePointLocator(
+        const ISurface& surface, const int u_samples, const int v_samples)
+        : u_samples_(u_samples), v_samples_(v_samples) {
+    const ParamRange pr = GetEffectiveRange(surface, CharacteristicLength(surface));
+    const double du = (pr.u_max - pr.u_min) / (u_samples + 1);
+    const double dv = (pr.v_max - pr.v_min) / (v_samples + 1);
+    for (int iu = 1; iu <= u_samples; ++iu) {
+        const double u = pr.u_min + iu * du;
+        for (int iv = 1; iv <= v_samples; ++iv) {
+            const double v = pr.v_min + iv * dv;
+            const auto pt = surface.TryGetPointAt(u, v);
+            if (!pt || !pt->allFinite()) continue;
+            parameters_.push_back({u, v});
+            points_.push_back(*pt);
+        }
+    }
+    // サンプル点を大きさ0のボックスとして扱う
+    bvh_ = i_num::BuildBvh(points_, points_);
+}
+
+std::optional<std::array<double, 2>>
+i_ent::SurfacePointLocator::FindNearestSample(const Vector3d& point) const {
+    const auto nearest = i_num::FindNearestInBvh(
+            bvh_, point, [this, &point](const std::uint32_t i) {
+        return (points_[i] - point).squaredNorm();
+    });
+    if (!nearest) return std::nullopt;
+    return parameters_[*nearest];
+}
+
+
+
+/**
+ * 逆射影
+ */
+
 std::optional<std::array<double, 2>> i_ent::InvertPointOntoSurface(
         const ISurface& surface, const Vector3d& model_point,
         const std::array<double, 2>& init_uv,
@@ -173,11 +201,22 @@ std::optional<std::array<double, 2>> i_ent::InvertPointOntoSurface(
                         pr, L, params);
 }
 
+std::optional<std::array<double, 2>> i_ent::ProjectPointOntoSurface(
+        const ISurface& surface, const Vector3d& model_point,
+        const CurveInversionParams& params) {
+    const double L = CharacteristicLength(surface);
+    const ParamRange pr = GetEffectiveRange(surface, L);
+    const auto locator = surface.GetPointLocator(params.grid_u, params.grid_v);
+    const auto init = GridSearchInit(*locator, model_point, pr);
+    return RunInversion(surface, model_point, init[0], init[1], pr, L, params);
+}
+
 std::vector<i_ent::ParamSpaceArc> i_ent::InvertCurveOntoSurface(
         const ISurface& surface, const ICurve& model_curve,
         const CurveInversionParams& params) {
     const double L = CharacteristicLength(surface);
     const ParamRange pr = GetEffectiveRange(surface, L);
+    const auto locator = surface.GetPointLocator(params.grid_u, params.grid_v);
 
     // Cを折れ線近似して点列 (順序付き) を得る
     const auto poly = i_ent::ComputeApproximatePolygon(
@@ -202,11 +241,19 @@ std::vector<i_ent::ParamSpaceArc> i_ent::InvertCurveOntoSurface(
         const Vector3d& p = poly.vertices[i];
         const double r_i = poly.curve_params[i];
 
-        // 初期値: 直前解をウォームスタート、無ければ格子探索
-        const std::array<double, 2> init =
-                prev_uv ? *prev_uv : GridSearchInit(surface, p, pr, params);
-        const auto sol = RunInversion(surface, p, init[0], init[1],
-                                      pr, L, params);
+        // 初期値: 直前解をウォームスタート、無ければ格子探索.
+        // ウォームスタートが失敗した場合 (局所解・穴領域等) も格子探索からやり直す
+        std::optional<std::array<double, 2>> sol;
+        if (prev_uv) {
+            sol = RunInversion(surface, p, (*prev_uv)[0], (*prev_uv)[1],
+                               pr, L, params);
+        }
+        if (!sol) {
+            const auto init = GridSearchInit(*locator, p, pr);
+            if (!prev_uv || init != *prev_uv) {
+                sol = RunInversion(surface, p, init[0], init[1], pr, L, params);
+            }
+        }
 
         // 射影失敗 (pole等)
         if (!sol) {
@@ -0,0 +1,546 @@
+/**
+ * @file entities/surfaces/algorithms/minimum_distance.cpp
+ * @brief 曲線・曲面間の最短距離の計算の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/entities/surfaces/algorithms/minimum_distance.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Eigenvalues>
+
+#include "igesio/common/parallel.h"
+#include "igesio/numerics/geometric/bvh.h"
+#include "entities/curves/algorithms/curve_segment_tree.h"
+#include "entities/surfaces/algorithms/surface_cell_tree.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+namespace i_ent = igesio::entities;
+using i_ent::ICurve;
+using i_ent::ISurface;
+using i_ent::CurveSegmentTree;
+using i_ent::SurfaceCellTree;
+using i_ent::MinimumDistanceParams;
+using i_ent::MinimumDistanceResult;
+using igesio::Matrix4d;
+using igesio::Vector3d;
+using igesio::Vector4d;
+
+/// @brief 特異とみなす固有値の、最大固有値に対する比
+/// @note 平行な曲線・曲面では最短距離を与える点の組が一意でなく、ヘッセ行列が
+///       特異となる. その方向の成分はステップから除く
+constexpr double kSingularTol = 1e-10;
+/// @brief 停留点の判定に用いる、勾配の各成分の相対的な大きさの許容誤差
+/// @note 勾配の成分 (A'・r等) を、微分と残差の大きさの積で割った値 (方向余弦)
+constexpr double kStationaryTol = 1e-10;
+/// @brief 直線探索でステップ幅を半減する最大回数
+constexpr int kMaxLineSearch = 20;
+/// @brief 曲面のセル内で初期値を探す格子の一辺の点数
+/// @note 制限面では、セルの中心がドメイン外でもセル内の一部がドメイン内の
+///       場合があるため、セル内の複数の点から評価できる点を選ぶ
+constexpr int kSeedGrid = 3;
+
+
+
+/// @brief 部分パッチに分割した曲線または曲面
+/// @note 曲線の部分パッチは折れ線近似の各辺、曲面の部分パッチはuv格子の各セル.
+///       パラメータは2成分で表し、曲線では第2成分を常に0とする.
+///       制限面の境界曲線 S(B(t)) は、baseを持つ曲線として扱う
+struct PatchSet {
+    /// @brief 曲線 (曲面の場合はnullptr. 境界曲線の場合はuv空間の曲線B(t))
+    const ICurve* curve = nullptr;
+    /// @brief 曲面 (曲線の場合はnullptr)
+    const ISurface* surface = nullptr;
+    /// @brief 境界曲線の場合の基底曲面S (それ以外はnullptr)
+    const ISurface* base = nullptr;
+    /// @brief 境界曲線の場合に、curveの所有権を保持する
+    std::shared_ptr<const ICurve> boundary_curve;
+    /// @brief 境界曲線の場合に、baseの所有権を保持する
+    std::shared_ptr<const ISurface> base_surface;
+    /// @brief 曲線の折れ線近似とBVH
+    CurveSegmentTree segments;
+    /// @brief 曲面のセルとBVH
+    SurfaceCellTree cells;
+    /// @brief パラメータの範囲 {第1成分の最小値, 最大値, 第2成分の最小値, 最大値}
+    std::array<double, 4> bounds = {0.0, 0.0, 0.0, 0.0};
+    /// @brief 制限面の境界曲線 (外側境界・内側境界) の部分パッチ
+    /// @note 最短距離を与える点がトリム境界上にある場合、ドメイン内からの反復は
+    ///       境界の手前で止まりうるため、境界曲線上でも別途最小化する
+    std::vector<PatchSet> boundaries;
+
+    /// @brief 部分パッチのBVHを取得する
+    const i_num::Bvh& Bvh() const { return curve ? segments.bvh : cells.bvh; }
+};
+
+/// @brief パッチ上の点と、パラメータに関する2階までの微分
+/// @note 曲線では第2成分に関する微分 (d1, d01, d11) をゼロとする
+struct PatchPoint {
+    /// @brief 点
+    Vector3d point;
+    /// @brief 第1成分に関する微分
+    Vector3d d0;
+    /// @brief 第2成分に関する微分
+    Vector3d d1;
+    /// @brief 第1成分に関する2階微分
+    Vector3d d00;
+    /// @brief 第1・第2成分に関する2階微分
+    Vector3d d01;
+    /// @brief 第2成分に関する2階微分
+    Vector3d d11;
+};
+
+/// @brief 曲線の折れ線化の許容距離を決定する
+double ChordToleranceFor(const ICurve& curve, const MinimumDistanceParams& params) {
+    return params.chord_tolerance > 0.0
+            ? params.chord_tolerance : i_ent::DefaultChordTolerance(curve);
+}
+
+/// @brief 曲線を部分パッチに分割する
+PatchSet BuildPatchSet(const ICurve& curve, const MinimumDistanceParams& params) {
+    PatchSet set;
+    set.curve = &curve;
+    set.segments = i_ent::BuildCurveSegmentTree(
+            curve, ChordToleranceFor(curve, params), false);
+    const auto [t_min, t_max] = curve.GetParameterRange();
+    set.bounds = {t_min, t_max, 0.0, 0.0};
+    return set;
+}
+
+/// @brief 制限面の境界曲線 S(B(t)) を部分パッチに分割する
+/// @param base 基底曲面S
+/// @param uv_curve uv空間の境界曲線B(t)
+/// @return 境界曲線の部分パッチ. B(t)の範囲が無限の場合、または折れ線の頂点で
+///         Sを評価できない場合はnullopt
+/// @note uv空間で折れ線近似した頂点をSで写し、各辺のボックスは辺の中点と
+///       弧の中点のずれの2倍 (と曲線の許容距離の2倍) だけ拡大する
+std::optional<PatchSet> BuildBoundaryPatchSet(
+        const std::shared_ptr<const ISurface>& base,
+        const std::shared_ptr<const ICurve>& uv_curve,
+        const MinimumDistanceParams& params) {
+    if (!uv_curve->IsFinite()) return std::nullopt;
+    PatchSet set;
+    set.curve = uv_curve.get();
+    set.base = base.get();
+    set.boundary_curve = uv_curve;
+    set.base_surface = base;
+    set.segments = i_ent::BuildCurveSegmentTree(
+            *uv_curve, i_ent::DefaultChordTolerance(*uv_curve), true);
+    auto& seg = set.segments;
+    for (auto& p : seg.points) {
+        const auto q = base->TryGetPointAt(p.x(), p.y());
+        if (!q) return std::nullopt;
+        p = *q;
+    }
+
+    const double chord = params.chord_tolerance > 0.0 ? params.chord_tolerance : 0.0;
+    const auto edge_count = seg.EdgeCount();
+    std::vector<Vector3d> lowers(edge_count), uppers(edge_count);
+    for (std::size_t i = 0; i < edge_count; ++i) {
+        const Vector3d& p0 = seg.points[i];
+        const Vector3d& p1 = seg.points[i + 1];
+        double margin = 2.0 * chord;
+        const auto b = uv_curve->TryGetPointAt(0.5 * (seg.params[i] + seg.params[i + 1]));
+        const auto mid = b ? base->TryGetPointAt(b->x(), b->y()) : std::nullopt;
+        margin += mid ? 2.0 * (*mid - 0.5 * (p0 + p1)).norm() : (p1 - p0).norm();
+        lowers[i] = p0.cwiseMin(p1) - Vector3d::Constant(margin);
+        uppers[i] = p0.cwiseMax(p1) + Vector3d::Constant(margin);
+    }
+    seg.bvh = i_num::BuildBvh(lowers, uppers);
+    const auto [t_min, t_max] = uv_curve->GetParameterRange();
+    set.bounds = {t_min, t_max, 0.0, 0.0};
+    return set;
+}
+
+/// @brief 曲面を部分パッチに分割する
+/// @note 制限面 (およびその変換ビュー) では、基底曲面上の外側境界
+///       (明示されている場合) と内側境界の曲線も部分パッチに分割する
+PatchSet BuildPatchSet(const ISurface& surface, const MinimumDistanceParams& params) {
+    PatchSet set;
+    set.surface = &surface;
+    set.cells = i_ent::BuildSurfaceCellTree(
+            surface, params.u_samples, params.v_samples);
+    const auto& r = set.cells.range;
+    set.bounds = {r.u_min, r.u_max, r.v_min, r.v_max};
+
+    // 境界曲線は基底曲面 (変換ビューでは同じ配置のビュー) 上で評価する
+    const auto base = i_ent::GetPlacedBaseSurface(surface);
+    if (!base) return set;
+    const auto* rs = i_ent::AsRestrictedSurface(surface);
+    std::vector<std::shared_ptr<const ICurve>> uv_curves;
+    if (auto outer = rs->GetOuterUVBoundary()) uv_curves.push_back(outer);
+    for (std::size_t i = 0; i < rs->GetInnerBoundaryCount(); ++i) {
+        if (auto inner = rs->GetInnerUVBoundaryAt(i)) uv_curves.push_back(inner);
+    }
+    for (const auto& uv_curve : uv_curves) {
+        if (auto boundary = BuildBoundaryPatchSet(base, uv_curve, params)) {
+            set.boundaries.push_back(std::move(*boundary));
+        }
+    }
+    return set;
+}
+
+/// @brief パッチ上の点と微分を評価する
+/// @return 評価できない場合 (制限面のドメイン外等) はnullopt
+std::optional<PatchPoint> Evaluate(const PatchSet& set,
+                                   const std::array<double, 2>& x) {
+    const Vector3d zero = Vector3d::Zero();
+    if (set.curve && set.base) {
+        // S(B(t)) の微分 (連鎖律)
+        const auto b = set.curve->TryGetDerivatives(x[0], 2);
+        if (!b) return std::nullopt;
+        const auto s = set.base->TryGetDerivatives((*b)[0].x(), (*b)[0].y(), 2);
+        if (!s) return std::nullopt;
+        const double bu = (*b)[1].x(), bv = (*b)[1].y();
+        const Vector3d d0 = (*s)(1, 0) * bu + (*s)(0, 1) * bv;
+        const Vector3d d00 = (*s)(2, 0) * (bu * bu) + 2.0 * (*s)(1, 1) * (bu * bv) +
+                             (*s)(0, 2) * (bv * bv) + (*s)(1, 0) * (*b)[2].x() +
+                             (*s)(0, 1) * (*b)[2].y();
+        return PatchPoint{(*s)(0, 0), d0, zero, d00, zero, zero};
+    }
+    if (set.curve) {
+        const auto d = set.curve->TryGetDerivatives(x[0], 2);
+        if (!d) return std::nullopt;
+        return PatchPoint{(*d)[0], (*d)[1], zero, (*d)[2], zero, zero};
+    }
+    const auto d = set.surface->TryGetDerivatives(x[0], x[1], 2);
+    if (!d) return std::nullopt;
+    return PatchPoint{(*d)(0, 0), (*d)(1, 0), (*d)(0, 1),
+                      (*d)(2, 0), (*d)(1, 1), (*d)(0, 2)};
+}
+
+/// @brief 部分パッチの代表点を取得する
+Vector3d RepresentativePoint(const PatchSet& set, const std::uint32_t prim) {
+    if (set.curve) {
+        return 0.5 * (set.segments.points[prim] + set.segments.points[prim + 1]);
+    }
+    return set.cells.centers[prim];
+}
+
+/// @brief 部分パッチ内で、目標点に近い初期値のパラメータを選ぶ
+/// @note 曲線は辺上で目標点に最も近い点のパラメータを、曲面はセル内の
+///       kSeedGrid×kSeedGridの点のうち評価でき目標点に最も近い点の (u, v) を返す.
+///       曲面のセル内に評価できる点がない場合はセルの中心を返す
+std::array<double, 2> SeedParams(const PatchSet& set, const std::uint32_t prim,
+                                 const Vector3d& target) {
+    if (set.curve) {
+        const auto& seg = set.segments;
+        const Vector3d& p0 = seg.points[prim];
+        const Vector3d d = seg.points[prim + 1] - p0;
+        const double d_sq = d.squaredNorm();
+        const double a = d_sq > 0.0
+                ? std::clamp((target - p0).dot(d) / d_sq, 0.0, 1.0) : 0.0;
+        return {seg.params[prim] + a * (seg.params[prim + 1] - seg.params[prim]),
+                0.0};
+    }
+
+    const auto& cells = set.cells;
+    const auto [uc, vc] = cells.centers_uv[prim];
+    std::array<double, 2> seed = {uc, vc};
+    double best = std::numeric_limits<double>::infinity();
+    for (int j = 0; j < kSeedGrid; ++j) {
+        for (int i = 0; i < kSeedGrid; ++i) {
+            const double u = uc + cells.du * ((i + 0.5) / kSeedGrid - 0.5);
+            const double v = vc + cells.dv * ((j + 0.5) / kSeedGrid - 0.5);
+            const auto p = set.surface->TryGetPointAt(u, v);
+            if (!p) continue;
+            const double d = (*p - target).squaredNorm();
+            if (d < best) {
+                best = d;
+                seed = {u, v};
+            }
+        }
+    }
+    return seed;
+}
+
+/// @brief 対称行列mについて、m Δ = -g の解のうち特異な方向の成分を除いたものを求める
+/// @return mが半正定値でない (または固有値分解に失敗した) 場合はnullopt
+std::optional<Vector4d> SolveTruncated(const Matrix4d& m, const Vector4d& g) {
+    const Eigen::SelfAdjointEigenSolver<Matrix4d> solver(m);
+    if (solver.info() != Eigen::Success) return std::nullopt;
+    const auto& values = solver.eigenvalues();
+    const double max_value = values.maxCoeff();
+    if (!(max_value > 0.0) || values.minCoeff() < -kSingularTol * max_value) {
+        return std::nullopt;
+    }
+    Vector4d delta = Vector4d::Zero();
+    for (int i = 0; i < 4; ++i) {
+        if (values(i) <= kSingularTol * max_value) continue;
+        const auto v = solver.eigenvectors().col(i);
+        delta -= (v.dot(g) / values(i)) * v;
+    }
+    return delta;
+}
+
+/// @brief 初期値 (x_a, x_b) から |A(x_a) - B(x_b)|^2 / 2 を最小化する
+/// @return 収束 (または反復の上限に達) した点の組. 初期値で評価できない場合はnullopt
+/// @note ニュートン法 (ヘッセ行列が半正定値でない場合はガウス・ニュートン法)
+///       による. 特異な方向 (最短距離を与える点の組が連続する方向) には進まない.
+///       範囲の端で外向きに押される変数は固定し、パラメータは範囲内にクランプする.
+///       距離が減少しないステップは幅を半減して再試行する
+///       (制限面のドメイン外へ出るステップも同様)
+std::optional<MinimumDistanceResult> Refine(
+        const PatchSet& a, const PatchSet& b,
+        std::array<double, 2> x_a, std::array<double, 2> x_b,
+        const MinimumDistanceParams& params) {
+    auto pa = Evaluate(a, x_a);
+    auto pb = Evaluate(b, x_b);
+    if (!pa || !pb) return std::nullopt;
+
+    // 曲線の第2成分は変数から除く
+    const std::array<bool, 4> active = {true, a.surface != nullptr,
+                                        true, b.surface != nullptr};
+    const std::array<double, 4> lo = {a.bounds[0], a.bounds[2],
+                                      b.bounds[0], b.bounds[2]};
+    const std::array<double, 4> hi = {a.bounds[1], a.bounds[3],
+                                      b.bounds[1], b.bounds[3]};
+    double f = (pa->point - pb->point).squaredNorm();
+    for (int iter = 0; iter < params.max_iter && f > 0.0; ++iter) {
+        Eigen::Matrix<double, 3, 4> J;
+        J.col(0) = pa->d0;
+        J.col(1) = pa->d1;
+        J.col(2) = -pb->d0;
+        J.col(3) = -pb->d1;
+        const Vector3d r = pa->point - pb->point;
+        Matrix4d gn = J.transpose() * J;
+        Vector4d g = J.transpose() * r;
+        const double trace = gn.trace();
+        if (!(trace > 0.0)) break;  // 双方とも微分がゼロ
+
+        // ヘッセ行列 = J^T J + Σ r_k ∇²r_k (AとBのパラメータ間の2階微分はゼロ)
+        Matrix4d hessian = gn;
+        hessian(0, 0) += r.dot(pa->d00);
+        hessian(0, 1) += r.dot(pa->d01);
+        hessian(1, 1) += r.dot(pa->d11);
+        hessian(2, 2) -= r.dot(pb->d00);
+        hessian(2, 3) -= r.dot(pb->d01);
+        hessian(3, 3) -= r.dot(pb->d11);
+        hessian(1, 0) = hessian(0, 1);
+        hessian(3, 2) = hessian(2, 3);
+
+        // 範囲の端にあり、勾配が範囲外を向く変数は固定する (能動制約)
+        const std::array<double, 4> x = {x_a[0], x_a[1], x_b[0], x_b[1]};
+        for (int k = 0; k < 4; ++k) {
+            const bool blocked = (x[k] <= lo[k] && g(k) > 0.0) ||
+                                 (x[k] >= hi[k] && g(k) < 0.0);
+            if (active[k] && !blocked) continue;
+            for (auto* m : {&gn, &hessian}) {
+                m->row(k).setZero();
+                m->col(k).setZero();
+                (*m)(k, k) = trace;
+            }
+            g(k) = 0.0;
+        }
+        // 残差が両者の接空間に直交すれば (勾配の相対的な大きさで判定) 停留点
+        bool stationary = true;
+        for (int k = 0; k < 4; ++k) {
+            if (std::abs(g(k)) > kStationaryTol * J.col(k).norm() * r.norm()) {
+                stationary = false;
+            }
+        }
+        if (stationary) break;
+
+        auto delta = SolveTruncated(hessian, g);
+        if (!delta) delta = SolveTruncated(gn, g);
+        if (!delta) break;
+        const double delta_max = delta->cwiseAbs().maxCoeff();
+        if (!std::isfinite(delta_max) || delta_max <= params.convergence_tol) break;
+
+        // 距離が減少するまでステップ幅を半減する
+        bool accepted = false;
+        double step = 0.0;
+        double alpha = 1.0;
+        for (int k = 0; k < kMaxLineSearch && !accepted &&
+                alpha * delta_max > params.convergence_tol;
+             ++k, alpha *= 0.5) {
+            const std::array<double, 2> ya = {
+                    std::clamp(x_a[0] + alpha * (*delta)(0), lo[0], hi[0]),
+                    std::clamp(x_a[1] + alpha * (*delta)(1), lo[1], hi[1])};
+            const std::array<double, 2> yb = {
+                    std::clamp(x_b[0] + alpha * (*delta)(2), lo[2], hi[2]),
+                    std::clamp(x_b[1] + alpha * (*delta)(3), lo[3], hi[3])};
+            auto qa = Evaluate(a, ya);
+            auto qb = Evaluate(b, yb);
+            if (!qa || !qb) continue;
+            const double f_new = (qa->point - qb->point).squaredNorm();
+            if (!(f_new < f)) continue;
+
+            step = std::max({std::abs(ya[0] - x_a[0]), std::abs(ya[1] - x_a[1]),
+                             std::abs(yb[0] - x_b[0]), std::abs(yb[1] - x_b[1])});
+            x_a = ya;
+            x_b = yb;
+            pa = qa;
+            pb = qb;
+            f = f_new;
+            accepted = true;
+        }
+        if (!accepted || step <= params.convergence_tol) break;
+    }
+    return MinimumDistanceResult{std::sqrt(f), pa->point, pb->point, x_a, x_b};
+}
+
+/// @brief 結果のパラメータを、境界曲線の場合は曲面の (u, v) に変換する
+/// @note 境界曲線のパラメータtを、B(t)のuv座標に置き換える
+void ToSurfaceParams(const PatchSet& set, std::array<double, 2>& x) {
+    if (!set.base) return;
+    if (const auto b = set.curve->TryGetPointAt(x[0])) x = {b->x(), b->y()};
+}
+
+/// @brief 部分パッチに分割済みの2つの要素の最短距離を計算する (境界曲線を除く)
+std::optional<MinimumDistanceResult> ComputeMinimumDistanceCore(
+        const PatchSet& a, const PatchSet& b, const MinimumDistanceParams& params) {
+    std::optional<MinimumDistanceResult> best;
+    i_num::FindNearestPairInBvhs(a.Bvh(), b.Bvh(),
+            [&](const std::uint32_t prim_a, const std::uint32_t prim_b) {
+        // 相手の代表点に近いA側の点、そのA側の点に近いB側の点を初期値とする
+        const auto x_a = SeedParams(a, prim_a, RepresentativePoint(b, prim_b));
+        const auto p_a = Evaluate(a, x_a);
+        const auto x_b = SeedParams(
+                b, prim_b, p_a ? p_a->point : RepresentativePoint(a, prim_a));
+        const auto result = Refine(a, b, x_a, x_b, params);
+        if (!result) return std::numeric_limits<double>::infinity();
+        if (!best || result->distance < best->distance) best = result;
+        return result->distance * result->distance;
+    }, params.tolerance);
+    if (best) {
+        ToSurfaceParams(a, best->params_a);
+        ToSurfaceParams(b, best->params_b);
+    }
+    return best;
+}
+
+/// @brief 部分パッチに分割済みの2つの要素の最短距離を計算する
+/// @note 制限面では、ドメイン内部同士に加え、境界曲線を含む組も計算し、
+///       それらの最小を返す
+std::optional<MinimumDistanceResult> ComputeMinimumDistance(
+        const PatchSet& a, const PatchSet& b, const MinimumDistanceParams& params) {
+    auto best = ComputeMinimumDistanceCore(a, b, params);
+    auto update = [&best](const std::optional<MinimumDistanceResult>& result) {
+        if (result && (!best || result->distance < best->distance)) best = result;
+    };
+    for (const auto& boundary : a.boundaries) {
+        update(ComputeMinimumDistance(boundary, b, params));
+    }
+    for (const auto& boundary : b.boundaries) {
+        update(ComputeMinimumDistanceCore(a, boundary, params));
+    }
+    return best;
+}
+
+/// @brief paramsを検証する
+/// @throw std::invalid_argument u_samples, v_samplesが1未満の場合、
+///        またはtoleranceが負の場合
+void ValidateParams(const MinimumDistanceParams& params, const char* function) {
+    if (params.u_samples < 1 || params.v_samples < 1) {
+        throw std::invalid_argument(std::string(function) +
+            ": u_samples and v_samples must be at least 1.");
+    }
+    if (!(params.tolerance >= 0.0)) {
+        throw std::invalid_argument(std::string(function) +
+            ": tolerance must be non-negative.");
+    }
+}
+
+/// @brief 曲線のパラメータ範囲が有限であることを検証する
+/// @throw std::invalid_argument パラメータ範囲が無限の場合
+void ValidateCurve(const ICurve& curve, const char* function) {
+    if (!curve.IsFinite()) {
+        throw std::invalid_argument(std::string(function) +
+            ": curves must have a finite parameter range.");
+    }
+}
+
+}  // namespace
+
+
+
+/**
+ * 最短距離の計算
+ */
+
+std::optional<MinimumDistanceResult> i_ent::MinimumDistance(
+        const ICurve& curve_a, const ICurve& curve_b,
+        const MinimumDistanceParams& params) {
+    ValidateParams(params, "MinimumDistance");
+    ValidateCurve(curve_a, "MinimumDistance");
+    ValidateCurve(curve_b, "MinimumDistance");
+    return ComputeMinimumDistance(BuildPatchSet(curve_a, params),
+                                  BuildPatchSet(curve_b, params), params);
+}
+
+std::optional<MinimumDistanceResult> i_ent::MinimumDistance(
+        const ICurve& curve, const ISurface& surface,
+        const MinimumDistanceParams& params) {
+    ValidateParams(params, "MinimumDistance");
+    ValidateCurve(curve, "MinimumDistance");
+    return ComputeMinimumDistance(BuildPatchSet(curve, params),
+                                  BuildPatchSet(surface, params), params);
+}
+
+std::optional<MinimumDistanceResult> i_ent::MinimumDistance(
+        const ISurface& surface_a, const ISurface& surface_b,
+        const MinimumDistanceParams& params) {
+    ValidateParams(params, "MinimumDistance");
+    return ComputeMinimumDistance(BuildPatchSet(surface_a, params),
+                                  BuildPatchSet(surface_b, params), params);
+}
+
+std::vector<std::optional<MinimumDistanceResult>> i_ent::MinimumDistancePairs(
+        const std::vector<GeometryPair>& pairs,
+        const MinimumDistanceParams& params) {
+    ValidateParams(params, "MinimumDistancePairs");
+
+    // 組に現れる要素を列挙する (同じ要素の部分パッチは共有する)
+    std::vector<const IGeometry*> elements;
+    std::unordered_map<const IGeometry*, std::size_t> indices;
+    std::vector<std::array<std::size_t, 2>> pair_indices(pairs.size());
+    for (std::size_t k = 0; k < pairs.size(); ++k) {
+        const std::array<const IGeometry*, 2> items = {
+                pairs[k].first.get(), pairs[k].second.get()};
+        for (int side = 0; side < 2; ++side) {
+            const auto* item = items[side];
+            const auto* curve = dynamic_cast<const ICurve*>(item);
+            if (!curve && !dynamic_cast<const ISurface*>(item)) {
+                throw std::invalid_argument(
+                    "MinimumDistancePairs: elements must be non-null curves "
+                    "or surfaces.");
+            }
+            if (curve) ValidateCurve(*curve, "MinimumDistancePairs");
+            const auto [it, inserted] = indices.emplace(item, elements.size());
+            if (inserted) elements.push_back(item);
+            pair_indices[k][side] = it->second;
+        }
+    }
+
+    std::vector<PatchSet> sets(elements.size());
+    igesio::ParallelFor(elements.size(), [&](const std::size_t i) {
+        if (const auto* curve = dynamic_cast<const ICurve*>(elements[i])) {
+            sets[i] = BuildPatchSet(*curve, params);
+        } else {
+            sets[i] = BuildPatchSet(
+                    dynamic_cast<const ISurface&>(*elements[i]), params);
+        }
+    });
+
+    std::vector<std::optional<MinimumDistanceResult>> results(pairs.size());
+    igesio::ParallelFor(pairs.size(), [&](const std::size_t k) {
+        const auto [i, j] = pair_indices[k];
+        results[k] = ComputeMinimumDistance(sets[i], sets[j], params);
+    });
+    return results;
+}
@@ -12,13 +12,16 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <optional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "igesio/common/parallel.h"
 #include "igesio/numerics/geometric/polygon.h"
+#include "igesio/entities/surfaces/algorithms/surface_tessellation_tolerance.h"
 
 namespace igesio::entities {
 
@@ -30,6 +33,14 @@ namespace num = igesio::numerics;
 /// @note 14回で境界位置の誤差がエッジ長の 1/2^14 ≈ 6e-5 以下になる
 constexpr int kCrossingSearchIter = 14;
 
+/// @brief 葉の三角分割を並列に行う最小の葉の数
+/// @note これ未満の曲面は直列に処理する (スレッド生成のコストが上回るため.
+///       また、エンティティ単位の並列処理の内側で多数のスレッドを生成しないため)
+constexpr std::size_t kMinParallelLeaves = 4096;
+
+/// @brief 曲率による深さの見積もりを並列に行う最小のルート数
+constexpr std::size_t kMinParallelRoots = 256;
+
 /// @brief メモ化された格子点の評価結果
 struct VertexInfo {
     /// @brief トリム領域内かどうか (評価に成功した場合のみtrue)
@@ -38,6 +49,35 @@ struct VertexInfo {
     int col = -1;
 };
 
+/// @brief 頂点のキー. 格子点は {格子点のキー, -1}、交差点はサブ辺の
+///        両端点のキーの組 {min, max}
+using VertexKey = std::pair<int64_t, int64_t>;
+
+/// @brief VertexKeyのハッシュ関数
+struct VertexKeyHash {
+    std::size_t operator()(const VertexKey& key) const {
+        const auto a = static_cast<std::uint64_t>(key.first);
+        const auto b = static_cast<std::uint64_t>(key.second);
+        return std::hash<std::uint64_t>()(a * 0x9E3779B97F4A7C15ULL + b);
+    }
+};
+
+/// @brief 1つのルートセルの葉を三角分割した結果
+/// @note 頂点はルート内でのみ重複排除し、ルート内で最初に参照した順に並べる.
+///       ルート間で共有する頂点は、結合時 (MergeRoots) に重複排除する
+struct RootMesh {
+    /// @brief 各頂点のキー
+    std::vector<VertexKey> keys;
+    /// @brief 各頂点のデータ {x,y,z,nx,ny,nz,tu,tv}
+    std::vector<std::array<float, 8>> vertices;
+    /// @brief 三角形の頂点インデックス (ルート内の頂点番号)
+    std::vector<std::uint32_t> indices;
+    /// @brief 仮想格子点キー → 評価結果 のメモ
+    std::unordered_map<int64_t, VertexInfo> vmemo;
+    /// @brief サブ辺キー → 交差頂点番号 のメモ
+    std::map<VertexKey, int> cmemo;
+};
+
 /// @brief (u,v) の頂点データ {x,y,z,nx,ny,nz,tu,tv} を計算する
 /// @return トリム領域外または評価失敗の場合はstd::nullopt
 std::optional<std::array<float, 8>> ComputeVertexData(
@@ -98,14 +138,21 @@ class QuadtreeMesher {
     /// @param surface 対象の制限付き曲面
     /// @param base_div 基底グリッド分割数 (1以上にクランプ)
     /// @param max_depth 境界セル細分の最大深さ (0以上にクランプ)
+    /// @param tolerance 曲率による細分の許容量 (無効の場合は境界のみ細分する)
+    /// @param parallel ルートセル単位で並列に処理するか
     QuadtreeMesher(const IRestrictedSurface& surface, const int base_div,
-                   const int max_depth)
+                   const int max_depth,
+                   const TessellationTolerance& tolerance,
+                   const bool parallel)
             : surface_(surface),
+              tolerance_(tolerance),
+              parallel_(parallel),
               base_div_(std::max(1, base_div)),
               max_depth_(std::max(0, max_depth)),
               sub_(1 << max_depth_),
               nv_(base_div_ * sub_),
-              depth_(static_cast<size_t>(base_div_) * base_div_, 0) {
+              depth_(static_cast<size_t>(base_div_) * base_div_, 0),
+              boundary_marked_(depth_.size(), false) {
         const auto range = surface.GetParameterRange();
         const bool finite = std::isfinite(range[0]) && std::isfinite(range[1]) &&
                             std::isfinite(range[2]) && std::isfinite(range[3]);
@@ -126,9 +173,9 @@ class QuadtreeMesher {
 
     /// @brief メッシュを構築する
     void Build() {
+        MarkCurvatureDepths();
         MarkBoundaryRoots();
         SmoothDepths();
-        AllocateVertices();
         EmitAllLeaves();
     }
 
@@ -161,7 +208,7 @@ class QuadtreeMesher {
         return depth_[static_cast<size_t>(ri) * base_div_ + rj];
     }
 
-    /// @brief 頂点データを次の列に書き込む
+    /// @brief 頂点データをメッシュの次の列に書き込む
     /// @return 書き込んだ列インデックス
     int AddVertexData(const std::array<float, 8>& vdata) {
         const int col = n_verts_;
@@ -177,45 +224,90 @@ class QuadtreeMesher {
         return col;
     }
 
-    /// @brief 仮想格子点 (I,J) を評価し、結果をメモ化して返す
-    VertexInfo GetVertex(const int i, const int j) {
+    /// @brief 仮想格子点 (I,J) を評価し、結果をルート内でメモ化して返す
+    VertexInfo GetVertex(RootMesh& root, const int i, const int j) const {
         const int64_t key = VKey(i, j);
-        const auto it = vmemo_.find(key);
-        if (it != vmemo_.end()) return it->second;
+        const auto it = root.vmemo.find(key);
+        if (it != root.vmemo.end()) return it->second;
 
         const auto [u, v] = VirtToUV(i, j);
         const auto vd = ComputeVertexData(surface_, u, v, u_range_, v_range_);
         VertexInfo info;
-        if (vd) { info.valid = true; info.col = AddVertexData(*vd); }
-        vmemo_.emplace(key, info);
+        if (vd) {
+            info.valid = true;
+            info.col = static_cast<int>(root.vertices.size());
+            root.keys.emplace_back(key, -1);
+            root.vertices.push_back(*vd);
+        }
+        root.vmemo.emplace(key, info);
         return info;
     }
 
-    /// @brief サブ辺上の境界交差点を評価し、メモ化して返す
+    /// @brief サブ辺上の境界交差点を評価し、ルート内でメモ化して返す
     /// @param iv,jv 有効端の仮想格子座標
     /// @param ii,ji 無効端の仮想格子座標
-    /// @return 交差頂点の列インデックス (評価失敗は-1)
+    /// @return 交差頂点のルート内の番号 (評価失敗は-1)
     /// @note キーをサブ辺端点の (min,max) で正規化するため、辺を共有する隣接葉は
     ///       走査方向によらず同一の交差頂点を共有する
-    int GetCrossing(const int iv, const int jv, const int ii, const int ji) {
+    int GetCrossing(RootMesh& root, const int iv, const int jv,
+                    const int ii, const int ji) const {
         const int64_t kv = VKey(iv, jv);
         const int64_t ki = VKey(ii, ji);
-        const std::pair<int64_t, int64_t> key =
-                (kv < ki) ? std::pair<int64_t, int64_t>{kv, ki}
-                          : std::pair<int64_t, int64_t>{ki, kv};
-        const auto it = cmemo_.find(key);
-        if (it != cmemo_.end()) return it->second;
+        const VertexKey key = (kv < ki) ? VertexKey{kv, ki} : VertexKey{ki, kv};
+        const auto it = root.cmemo.find(key);
+        if (it != root.cmemo.end()) return it->second;
 
         const auto [u0, v0] = VirtToUV(iv, jv);
         const auto [u1, v1] = VirtToUV(ii, ji);
         const auto [uc, vc] = FindEdgeCrossing(surface_, u0, v0, u1, v1);
         const auto vd = ComputeVertexData(surface_, uc, vc, u_range_, v_range_);
-        const int col = vd ? AddVertexData(*vd) : -1;
-        cmemo_.emplace(key, col);
+        int col = -1;
+        if (vd) {
+            col = static_cast<int>(root.vertices.size());
+            root.keys.push_back(key);
+            root.vertices.push_back(*vd);
+        }
+        root.cmemo.emplace(key, col);
         return col;
     }
 
-    /// @brief トリム境界が通過するルートを最大深さでマークする
+    /// @brief 頂点がルートセルの境界上にある (隣接ルートと共有しうる) かどうか
+    bool IsOnRootBorder(const VertexKey& key) const {
+        const int64_t stride = nv_ + 1;
+        const int64_t i0 = key.first / stride, j0 = key.first % stride;
+        if (key.second < 0) return i0 % sub_ == 0 || j0 % sub_ == 0;
+        // 交差点: サブ辺がルートの境界線上にある場合のみ共有しうる
+        const int64_t i1 = key.second / stride, j1 = key.second % stride;
+        return (i0 == i1 && i0 % sub_ == 0) || (j0 == j1 && j0 % sub_ == 0);
+    }
+
+    /// @brief 許容量を満たすよう、基底曲面の曲率から各ルートの深さを決める
+    /// @note ドメイン外でも評価できるよう基底曲面で見積もる. 許容量が無効、
+    ///       または基底曲面が未解決の場合は全ルートを深さ0のままとする
+    void MarkCurvatureDepths() {
+        if (!tolerance_.IsEnabled()) return;
+        const auto base = surface_.GetBaseSurface();
+        if (!base) return;
+        const double du = (u_range_[1] - u_range_[0]) / base_div_;
+        const double dv = (v_range_[1] - v_range_[0]) / base_div_;
+        if (du == 0.0 || dv == 0.0) return;
+        // 各ルートは自身の深さのみを書き込むため、ルート単位で並列に見積もる
+        const std::size_t n_roots = depth_.size();
+        igesio::ParallelFor(n_roots, [&](const std::size_t index) {
+            const int ri = static_cast<int>(index) / base_div_;
+            const int rj = static_cast<int>(index) % base_div_;
+            const std::array<double, 2> ur = {u_range_[0] + ri * du,
+                                              u_range_[0] + (ri + 1) * du};
+            const std::array<double, 2> vr = {v_range_[0] + rj * dv,
+                                              v_range_[0] + (rj + 1) * dv};
+            depth_[index] =
+                    EstimateSubdivisionDepth(*base, ur, vr, tolerance_, max_depth_);
+        }, parallel_ ? kMinParallelRoots : n_roots);
+    }
+
+    /// @brief トリム境界が通過するルートを境界用の深さでマークする
+    /// @note 許容量が無効の場合は最大深さ、有効の場合は曲率による深さに
+    ///       kBoundaryExtraDepthを加えた深さ (最大深さでクランプ) とする
     /// @note 境界の包含多角形 (テッセレーション用) を流用するため、境界曲線の
     ///       例外・退化処理は不要 (構築失敗時は当該多角形が空となりスキップされる)
     void MarkBoundaryRoots() {
@@ -260,10 +352,21 @@ class QuadtreeMesher {
                     static_cast<int>(std::floor(fu)), 0, base_div_ - 1);
             const int rj = std::clamp(
                     static_cast<int>(std::floor(fv)), 0, base_div_ - 1);
-            depth_[static_cast<size_t>(ri) * base_div_ + rj] = max_depth_;
+            MarkBoundaryRoot(static_cast<size_t>(ri) * base_div_ + rj);
         }
     }
 
+    /// @brief 境界が通過するルートの深さを境界用の深さへ引き上げる
+    /// @param index ルートセルの添字 (ri * base_div_ + rj)
+    /// @note 同じルートを複数回マークしても、引き上げは1回のみ行う
+    void MarkBoundaryRoot(const size_t index) {
+        if (boundary_marked_[index]) return;
+        boundary_marked_[index] = true;
+        int& d = depth_[index];
+        d = tolerance_.IsEnabled()
+                ? std::min(max_depth_, d + kBoundaryExtraDepth) : max_depth_;
+    }
+
     /// @brief 隣接ルートの深さ差が1以下になるよう深さ場を緩和する (2:1バランス)
     void SmoothDepths() {
         bool changed = true;
@@ -284,49 +387,86 @@ class QuadtreeMesher {
         }
     }
 
-    /// @brief 全葉から見た頂点数の上界で頂点チャンネルを事前確保する
-    void AllocateVertices() {
-        int64_t est = 0;
-        for (int d : depth_) {
-            const int n = 1 << d;
-            // コーナー(n+1)^2 + 辺交差点・ハンギングノードの上界4n^2
-            est += static_cast<int64_t>(n + 1) * (n + 1)
-                 + static_cast<int64_t>(4) * n * n;
+    /// @brief 全ルートの葉を三角分割する
+    /// @note 各ルートは互いに独立に (頂点の評価を含めて) 三角分割できるため、
+    ///       ルート単位で並列に処理し、MergeRootsで結合する. 結合後の頂点・三角形の
+    ///       順序は、全ルートを順に直列で処理した場合と一致する
+    void EmitAllLeaves() {
+        const std::size_t n_roots = depth_.size();
+        std::size_t n_leaves = 0;
+        for (const int d : depth_) n_leaves += std::size_t{1} << (2 * d);
+
+        std::vector<RootMesh> roots(n_roots);
+        igesio::ParallelFor(n_roots, [&](const std::size_t index) {
+            EmitRoot(static_cast<int>(index) / base_div_,
+                     static_cast<int>(index) % base_div_, roots[index]);
+        }, (parallel_ && n_leaves >= kMinParallelLeaves) ? kDefaultMinParallelSize
+                                                         : n_roots);
+        MergeRoots(roots);
+    }
+
+    /// @brief 1つのルートセルの全ての葉を三角分割する
+    /// @param ri,rj ルートセル座標
+    /// @param root 結果の格納先
+    void EmitRoot(const int ri, const int rj, RootMesh& root) const {
+        const int level = RootDepth(ri, rj);
+        const int n = 1 << level;
+        const int leaf_size = sub_ >> level;
+        for (int li = 0; li < n; ++li) {
+            for (int lj = 0; lj < n; ++lj) {
+                EmitLeaf(root, ri * sub_ + li * leaf_size,
+                         rj * sub_ + lj * leaf_size, leaf_size,
+                         level, ri, rj, li, lj, n);
+            }
         }
-        mesh_.positions.resize(3, static_cast<int>(est));
-        mesh_.normals.resize(3, static_cast<int>(est));
-        mesh_.uvs.resize(2, static_cast<int>(est));
-        mesh_.indices.reserve(static_cast<size_t>(est) * 2);
     }
 
-    /// @brief 全ルートの葉を走査して三角形を生成する
-    void EmitAllLeaves() {
-        for (int ri = 0; ri < base_div_; ++ri) {
-            for (int rj = 0; rj < base_div_; ++rj) {
-                const int level = RootDepth(ri, rj);
-                const int n = 1 << level;
-                const int leaf_size = sub_ >> level;
-                for (int li = 0; li < n; ++li) {
-                    for (int lj = 0; lj < n; ++lj) {
-                        EmitLeaf(ri * sub_ + li * leaf_size,
-                                 rj * sub_ + lj * leaf_size, leaf_size,
-                                 level, ri, rj, li, lj, n);
-                    }
+    /// @brief ルートごとの三角分割を、ルートの順に1つのメッシュへ結合する
+    /// @note ルートの境界上の頂点のみが複数のルートに現れるため、それらのみを
+    ///       キーで重複排除する (各ルート内の頂点は既に重複排除済み)
+    void MergeRoots(std::vector<RootMesh>& roots) {
+        std::size_t n_vertices = 0, n_indices = 0;
+        for (const auto& root : roots) {
+            n_vertices += root.vertices.size();
+            n_indices += root.indices.size();
+        }
+        mesh_.positions.resize(3, static_cast<int>(n_vertices));
+        mesh_.normals.resize(3, static_cast<int>(n_vertices));
+        mesh_.uvs.resize(2, static_cast<int>(n_vertices));
+        mesh_.indices.reserve(n_indices);
+
+        std::unordered_map<VertexKey, int, VertexKeyHash> border;
+        std::vector<int> remap;
+        for (auto& root : roots) {
+            remap.resize(root.vertices.size());
+            for (std::size_t k = 0; k < root.vertices.size(); ++k) {
+                const auto& key = root.keys[k];
+                if (!IsOnRootBorder(key)) {
+                    remap[k] = AddVertexData(root.vertices[k]);
+                    continue;
                 }
+                const auto [it, inserted] = border.emplace(key, n_verts_);
+                if (inserted) AddVertexData(root.vertices[k]);
+                remap[k] = it->second;
+            }
+            for (const auto index : root.indices) {
+                mesh_.indices.push_back(static_cast<std::uint32_t>(remap[index]));
             }
+            root = RootMesh();
         }
     }
 
     /// @brief 1つの葉セルを三角分割してインデックスに追加する
+    /// @param root 結果の格納先 (葉が属するルート)
     /// @param i0,j0 葉の左下コーナーの仮想格子座標
     /// @param size 葉の一辺の仮想格子ステップ数
     /// @param level 葉が属するルートの深さ
     /// @param ri,rj ルートセル座標
     /// @param li,lj ルート内の葉インデックス
     /// @param n ルート内の一辺あたりの葉数 (= 2^level)
-    void EmitLeaf(const int i0, const int j0, const int size,
+    void EmitLeaf(RootMesh& root, const int i0, const int j0, const int size,
                   const int level, const int ri, const int rj,
-                  const int li, const int lj, const int n) {
+                  const int li, const int lj, const int n) const {
         // 各辺のハンギングノード: 当該辺がルート境界上にあり、かつ隣接ルートが
         // ちょうど1段細かい (level+1) ときのみ中点ノードを挿入する
         const bool h_bot = (lj == 0)     && RootDepth(ri, rj - 1) == level + 1;
@@ -354,26 +494,30 @@ class QuadtreeMesher {
         for (int k = 0; k < m; ++k) {
             const auto [ia, ja] = perim[k];
             const auto [ib, jb] = perim[(k + 1) % m];
-            const VertexInfo va = GetVertex(ia, ja);
-            const VertexInfo vb = GetVertex(ib, jb);
+            const VertexInfo va = GetVertex(root, ia, ja);
+            const VertexInfo vb = GetVertex(root, ib, jb);
             if (va.valid) poly[np++] = va.col;
             if (va.valid != vb.valid) {
-                const int cross = va.valid ? GetCrossing(ia, ja, ib, jb)
-                                           : GetCrossing(ib, jb, ia, ja);
+                const int cross = va.valid ? GetCrossing(root, ia, ja, ib, jb)
+                                           : GetCrossing(root, ib, jb, ia, ja);
                 if (cross >= 0) poly[np++] = cross;
             }
         }
 
         // poly[0] 基点でファン三角分割
         for (int k = 1; k + 1 < np; ++k) {
-            mesh_.indices.push_back(static_cast<std::uint32_t>(poly[0]));
-            mesh_.indices.push_back(static_cast<std::uint32_t>(poly[k]));
-            mesh_.indices.push_back(static_cast<std::uint32_t>(poly[k + 1]));
+            root.indices.push_back(static_cast<std::uint32_t>(poly[0]));
+            root.indices.push_back(static_cast<std::uint32_t>(poly[k]));
+            root.indices.push_back(static_cast<std::uint32_t>(poly[k + 1]));
         }
     }
 
     /// @brief 対象の制限付き曲面
     const IRestrictedSurface& surface_;
+    /// @brief 曲率による細分の許容量
+    const TessellationTolerance tolerance_;
+    /// @brief ルートセル単位で並列に処理するか
+    const bool parallel_;
     /// @brief 基底グリッド分割数
     const int base_div_;
     /// @brief 境界セル細分の最大深さ
@@ -388,15 +532,13 @@ class QuadtreeMesher {
     std::array<double, 2> v_range_;
     /// @brief 各ルートセルの四分木深さ
     std::vector<int> depth_;
+    /// @brief 各ルートセルが境界用の深さへ引き上げ済みか
+    std::vector<bool> boundary_marked_;
     /// @brief 構築中のメッシュ (positions/normals/uvsは上界サイズで確保し、
     ///        TakeMeshで確定済み頂点数へ切り詰める)
     num::TriangleMeshf mesh_;
     /// @brief 確定済み頂点数
     int n_verts_ = 0;
-    /// @brief 仮想格子点キー → 評価結果 のメモ
-    std::unordered_map<int64_t, VertexInfo> vmemo_;
-    /// @brief サブ辺キー → 交差頂点列インデックス のメモ
-    std::map<std::pair<int64_t, int64_t>, int> cmemo_;
 };
 
 }  // namespace
@@ -406,7 +548,8 @@ class QuadtreeMesher {
 numerics::TriangleMeshf TessellateRestrictedSurface(
         const IRestrictedSurface& surface,
         const RestrictedSurfaceMeshParams& params) {
-    QuadtreeMesher mesher(surface, params.base_div, params.max_depth);
+    QuadtreeMesher mesher(surface, params.base_div, params.max_depth,
+                          params.tolerance, params.parallel);
     mesher.Build();
     return mesher.TakeMesh();
 }
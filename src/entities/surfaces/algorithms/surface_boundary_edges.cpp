@@ -39,22 +39,33 @@ void FlushPolyline(std::vector<Vector3d>& current,
 /// @brief UV境界曲線B(t)を基底曲面Sで評価し、S(B(t))の折れ線群を生成する
 /// @param base 基底曲面S
 /// @param uv_curve UV空間の境界曲線B(t) (TryGetPointAtが(u,v,0)を返す)
-/// @param divisions 分割数
+/// @param params 生成パラメータ (分割数・許容量)
 /// @param loops 追加先のループ群
 /// @note Bの評価不能点、または基底曲面のドメイン外で折れ線を分割する
-/// @note 等間隔点に加えて境界曲線の角点も評価点に含め、S(B(t))が曲面の角を
-///       丸めず正確に通過するようにする
+/// @note 境界曲線の角点も評価点に含め、S(B(t))が曲面の角を丸めず正確に通過するようにする.
+///       許容量が有効な場合はDiscretizeCurveでS(B(t))を適応的に折れ線化し、
+///       無効な場合は等間隔点 (BuildCornerAwareSampleParams) で評価する
 void AppendSurfaceCurveLoop(const ISurface& base, const ICurve& uv_curve,
-                            const int divisions,
+                            const SurfaceBoundaryEdgeParams& params,
                             std::vector<std::vector<Vector3d>>& loops) {
     auto range = uv_curve.GetParameterRange();
     const double t0 = ClampInfinite(range[0], -kInfiniteParamClamp);
     const double t1 = ClampInfinite(range[1], kInfiniteParamClamp);
-    const auto params =
-            BuildCornerAwareSampleParams(uv_curve, t0, t1, divisions);
+
+    if (params.tolerance.IsEnabled()) {
+        CurveDiscretizationParams dp;
+        dp.tolerance = params.tolerance;
+        const auto polylines = DiscretizeCurve(
+                uv_curve, {t0, t1}, dp,
+                [&base](const Vector3d& uv) {
+                    return base.TryGetPointAt(uv.x(), uv.y());
+                });
+        for (const auto& polyline : polylines) loops.push_back(polyline.points);
+        return;
+    }
 
     std::vector<Vector3d> current;
-    for (const double t : params) {
+    for (const double t : BuildCornerAwareSampleParams(uv_curve, t0, t1, params.divisions)) {
         const auto uv = uv_curve.TryGetPointAt(t);
         std::optional<Vector3d> p;
         if (uv) p = base.TryGetPointAt(uv->x(), uv->y());
@@ -187,14 +198,14 @@ SurfaceBoundaryEdges ComputeRestrictedSurfaceEdges(
         auto rect = ComputeParametricSurfaceEdges(*base, params);
         for (auto& loop : rect.loops) edges.loops.push_back(std::move(loop));
     } else if (const auto outer = surface.GetOuterUVBoundary()) {
-        AppendSurfaceCurveLoop(*base, *outer, params.divisions, edges.loops);
+        AppendSurfaceCurveLoop(*base, *outer, params, edges.loops);
     }
 
     // 内側境界 (穴): 常にUV境界をS(B(t))で評価する
     const std::size_t n_inner = surface.GetInnerBoundaryCount();
     for (std::size_t i = 0; i < n_inner; ++i) {
         if (const auto inner = surface.GetInnerUVBoundaryAt(i)) {
-            AppendSurfaceCurveLoop(*base, *inner, params.divisions, edges.loops);
+            AppendSurfaceCurveLoop(*base, *inner, params, edges.loops);
         }
     }
     return edges;
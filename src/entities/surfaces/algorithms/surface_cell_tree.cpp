@@ -0,0 +1,136 @@
+/**
+ * @file entities/surfaces/algorithms/surface_cell_tree.cpp
+ * @brief 曲面のuv格子のセルとそのBVHの実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "entities/surfaces/algorithms/surface_cell_tree.h"
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "igesio/entities/views/surface_view.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+namespace i_ent = igesio::entities;
+using igesio::Vector3d;
+
+}  // namespace
+
+
+
+const i_ent::IRestrictedSurface* i_ent::AsRestrictedSurface(const ISurface& surface) {
+    if (const auto* view = dynamic_cast<const SurfaceView*>(&surface)) {
+        return dynamic_cast<const IRestrictedSurface*>(view->GetBase().get());
+    }
+    return dynamic_cast<const IRestrictedSurface*>(&surface);
+}
+
+std::shared_ptr<const i_ent::ISurface>
+i_ent::GetPlacedBaseSurface(const ISurface& surface) {
+    const auto* rs = AsRestrictedSurface(surface);
+    auto base = rs ? rs->GetBaseSurface() : nullptr;
+    if (!base) return nullptr;
+    if (const auto* view = dynamic_cast<const SurfaceView*>(&surface)) {
+        return std::make_shared<SurfaceView>(std::move(base), view->GetPlacement());
+    }
+    return base;
+}
+
+i_ent::SurfaceParamRange i_ent::GetEffectiveParamRange(const ISurface& surface) {
+    const auto r = surface.GetParameterRange();
+    const bool any_inf = !std::isfinite(r[0]) || !std::isfinite(r[1]) ||
+                         !std::isfinite(r[2]) || !std::isfinite(r[3]);
+    if (any_inf) {
+        if (const auto* rs = AsRestrictedSurface(surface)) {
+            if (auto b = GetRestrictedDomainUVBounds(*rs)) {
+                return {(*b)[0], (*b)[1], (*b)[2], (*b)[3]};
+            }
+        }
+    }
+
+    auto clamp_range = [](const double lo,
+                          const double hi) -> std::pair<double, double> {
+        const bool lo_inf = std::isinf(lo);
+        const bool hi_inf = std::isinf(hi);
+        if (!lo_inf && !hi_inf) return {lo, hi};
+        constexpr double kClamp = kInfiniteParamClamp;
+        if (!lo_inf &&  hi_inf) return {lo, lo + 2.0 * kClamp};
+        if ( lo_inf && !hi_inf) return {hi - 2.0 * kClamp, hi};
+        return {-kClamp, kClamp};
+    };
+    const auto [u_min, u_max] = clamp_range(r[0], r[1]);
+    const auto [v_min, v_max] = clamp_range(r[2], r[3]);
+    return {u_min, u_max, v_min, v_max};
+}
+
+i_ent::SurfaceCellTree i_ent::BuildSurfaceCellTree(
+        const ISurface& surface, const int u_samples, const int v_samples) {
+    const auto base = GetPlacedBaseSurface(surface);
+    const ISurface* eval = base ? base.get() : &surface;
+
+    SurfaceCellTree tree;
+    tree.range = GetEffectiveParamRange(surface);
+    const auto& pr = tree.range;
+    const int nu = u_samples;
+    const int nv = v_samples;
+    const double du = (pr.u_max - pr.u_min) / nu;
+    const double dv = (pr.v_max - pr.v_min) / nv;
+    tree.du = du;
+    tree.dv = dv;
+
+    // 格子点 (nu+1)×(nv+1) を評価する
+    std::vector<std::optional<Vector3d>> corners(
+            static_cast<std::size_t>((nu + 1) * (nv + 1)));
+    for (int j = 0; j <= nv; ++j) {
+        for (int i = 0; i <= nu; ++i) {
+            corners[j * (nu + 1) + i] = eval->TryGetPointAt(
+                    pr.u_min + i * du, pr.v_min + j * dv);
+        }
+    }
+
+    std::vector<Vector3d> lowers, uppers;
+    for (int j = 0; j < nv; ++j) {
+        for (int i = 0; i < nu; ++i) {
+            const double uc = pr.u_min + (i + 0.5) * du;
+            const double vc = pr.v_min + (j + 0.5) * dv;
+            const std::array<std::optional<Vector3d>, 4> quad = {
+                    corners[j * (nu + 1) + i], corners[j * (nu + 1) + i + 1],
+                    corners[(j + 1) * (nu + 1) + i],
+                    corners[(j + 1) * (nu + 1) + i + 1]};
+            const auto center = eval->TryGetPointAt(uc, vc);
+
+            std::vector<Vector3d> points;
+            for (const auto& p : quad) if (p) points.push_back(*p);
+            if (center) points.push_back(*center);
+            if (points.empty()) continue;
+
+            Vector3d lower = points.front(), upper = points.front();
+            for (const auto& p : points) {
+                lower = lower.cwiseMin(p);
+                upper = upper.cwiseMax(p);
+            }
+            double margin = 0.0;
+            if (points.size() == 5) {
+                const Vector3d bilinear =
+                        0.25 * (*quad[0] + *quad[1] + *quad[2] + *quad[3]);
+                margin = 2.0 * (*center - bilinear).norm();
+            } else {
+                margin = (upper - lower).norm();
+            }
+            lowers.push_back(lower - Vector3d::Constant(margin));
+            uppers.push_back(upper + Vector3d::Constant(margin));
+            tree.centers_uv.push_back({uc, vc});
+            tree.centers.push_back(center ? *center : points.front());
+        }
+    }
+    tree.bvh = i_num::BuildBvh(lowers, uppers);
+    return tree;
+}
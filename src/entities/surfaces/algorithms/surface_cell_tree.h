@@ -0,0 +1,90 @@
+/**
+ * @file entities/surfaces/algorithms/surface_cell_tree.h
+ * @brief 曲面のuv格子のセルとそのBVH (内部実装)
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 本ファイルは内部実装用であり、公開APIには含めない.
+ *       曲線×曲面の交差判定・曲線/曲面間の最短距離の広域判定 (broad phase) に用いる.
+ */
+#ifndef SRC_ENTITIES_SURFACES_ALGORITHMS_SURFACE_CELL_TREE_H_
+#define SRC_ENTITIES_SURFACES_ALGORITHMS_SURFACE_CELL_TREE_H_
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/geometric/bvh.h"
+#include "igesio/entities/interfaces/i_surface.h"
+#include "igesio/entities/interfaces/i_restricted_surface.h"
+
+
+
+namespace igesio::entities {
+
+/// @brief 有効なuvパラメータ範囲 (無限範囲をクランプ済み)
+struct SurfaceParamRange {
+    /// @brief uの最小値
+    double u_min;
+    /// @brief uの最大値
+    double u_max;
+    /// @brief vの最小値
+    double v_min;
+    /// @brief vの最大値
+    double v_max;
+};
+
+/// @brief 曲面のuv格子のセルと、そのバウンディングボックスのBVH
+struct SurfaceCellTree {
+    /// @brief 格子を張るuvパラメータ範囲
+    SurfaceParamRange range;
+    /// @brief セルのu方向の幅
+    double du = 0.0;
+    /// @brief セルのv方向の幅
+    double dv = 0.0;
+    /// @brief 各セルの中心の (u, v) (プリミティブ番号順)
+    std::vector<std::array<double, 2>> centers_uv;
+    /// @brief 各セルの代表点 (中心の点. 評価できない場合は評価できた隅の点)
+    std::vector<Vector3d> centers;
+    /// @brief セルのBVH (プリミティブ番号はcenters_uv/centersの添字)
+    /// @note 各セルのボックスは、セル内の曲面を含むよう拡大してある
+    numerics::Bvh bvh;
+};
+
+/// @brief 制限面を取得する (変換ビューは元の曲面を参照する)
+/// @param surface 対象の曲面
+/// @return 制限面 (SurfaceViewの場合は元の曲面が制限面であればそれ).
+///         それ以外はnullptr
+/// @note uv空間のドメインは配置に依存しないため、ビューの元の制限面で判定してよい
+const IRestrictedSurface* AsRestrictedSurface(const ISurface& surface);
+
+/// @brief 制限面の基底曲面を、surfaceと同じ空間で取得する
+/// @param surface 対象の曲面 (制限面、またはその変換ビュー)
+/// @return 基底曲面. surfaceがSurfaceViewの場合は同じ配置のビュー.
+///         制限面でない、または基底曲面が未解決の場合はnullptr
+std::shared_ptr<const ISurface> GetPlacedBaseSurface(const ISurface& surface);
+
+/// @brief 無限パラメータ範囲をクランプした有効範囲を返す
+/// @param surface 対象の曲面
+/// @return 有効なuvパラメータ範囲
+/// @note IntersectSurfaceWithLineと同じく、無限範囲の制限面はドメインのUV範囲を、
+///       それ以外は±kInfiniteParamClampを用いる
+SurfaceParamRange GetEffectiveParamRange(const ISurface& surface);
+
+/// @brief 曲面のuv格子のセルのBVHを構築する
+/// @param surface 対象の曲面
+/// @param u_samples u方向のセル数 (1以上)
+/// @param v_samples v方向のセル数 (1以上)
+/// @return セルとBVH
+/// @note 制限面 (およびその変換ビュー) は基底曲面上に構築する (ドメイン外の
+///       セルも含める).
+///       各セルのボックスは、中心の点の双線形補間からのずれの2倍だけ拡大する.
+///       一部の点を評価できないセルは、評価できた点のボックスをその対角線長
+///       だけ拡大する
+SurfaceCellTree BuildSurfaceCellTree(
+        const ISurface& surface, int u_samples, int v_samples);
+
+}  // namespace igesio::entities
+
+#endif  // SRC_ENTITIES_SURFACES_ALGORITHMS_SURFACE_CELL_TREE_H_
@@ -8,6 +8,7 @@
 #include "igesio/entities/surfaces/algorithms/surface_line_intersection.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 #include <optional>
@@ -17,6 +18,9 @@
 
 #include "igesio/numerics/core/tolerance.h"
 #include "igesio/entities/interfaces/i_restricted_surface.h"
+#include "igesio/entities/surfaces/rational_b_spline_surface.h"
+#include "igesio/entities/surfaces/algorithms/curve_surface_inversion.h"
+#include "./../../curves/nurbs_conversion.h"
 
 namespace {
 
@@ -24,9 +28,11 @@ namespace i_num = igesio::numerics;
 namespace i_ent = igesio::entities;
 using i_ent::ISurface;
 using i_ent::SurfaceLineIntersection;
+using i_ent::SurfaceLineIntersectionMethod;
 using i_ent::SurfaceLineIntersectionParams;
 using igesio::Matrix3d;
 using igesio::Vector3d;
+using igesio::Vector4d;
 /// @brief BoundingBox::DirectionType の短縮名
 using LineType = i_num::BoundingBox::DirectionType;
 
@@ -199,6 +205,272 @@ void Deduplicate(std::vector<SurfaceLineIntersection>& results,
     results.resize(write);
 }
 
+
+
+/**
+ * 制御網の再帰分割 (kSubdivision)
+ */
+
+/// @brief 再帰分割の対象領域 (有理Bézierパッチの部分パッチ)
+struct BezierRegion {
+    /// @brief 同次制御点 ([i * (q + 1) + j] が P(i, j))
+    std::vector<Vector4d> points;
+    /// @brief NURBS表現におけるuパラメータ範囲
+    double u0, u1;
+    /// @brief NURBS表現におけるvパラメータ範囲
+    double v0, v1;
+    /// @brief 分割の深さ
+    int depth;
+};
+
+/// @brief 領域の棄却判定に用いる、線に沿った座標系
+/// @note 線を含む直交2平面 (法線n1, n2) に対する符号付き距離と線パラメータで
+///       制御点を表す. 有理Bézierの凸包性 (重みが正) により、全制御点が
+///       いずれかの平面の片側にある、または線パラメータの範囲外にある領域は
+///       線と交差しない
+struct LineFrame {
+    /// @brief 線の始点
+    Vector3d p0;
+    /// @brief 線の方向ベクトル (p1 - p0)
+    Vector3d d;
+    /// @brief |d|^2
+    double d_sq;
+    /// @brief 線に直交する単位ベクトル
+    Vector3d n1, n2;
+    /// @brief 線パラメータの有効範囲
+    double t_lo, t_hi;
+    /// @brief 平面からの距離の許容誤差
+    double eps;
+};
+
+/// @brief 線に沿った座標系を作成する
+LineFrame MakeLineFrame(const Vector3d& p0, const Vector3d& d, const double d_sq,
+                        const LineType line_type, const double scale) {
+    // dと最も平行でない座標軸との外積で直交ベクトルを作る
+    int axis = 0;
+    for (int k = 1; k < 3; ++k) {
+        if (std::abs(d[k]) < std::abs(d[axis])) axis = k;
+    }
+    Vector3d e = Vector3d::Zero();
+    e[axis] = 1.0;
+    const Vector3d n1 = d.cross(e).normalized();
+    const Vector3d n2 = d.normalized().cross(n1);
+
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    const double t_lo = (line_type == LineType::kLine) ? -kInf : 0.0;
+    const double t_hi = (line_type == LineType::kSegment) ? 1.0 : kInf;
+    return {p0, d, d_sq, n1, n2, t_lo, t_hi,
+            i_num::kGeometryTolerance * (1.0 + scale)};
+}
+
+/// @brief 領域が線と交差しないことが確定するか (凸包による棄却判定)
+bool IsRejected(const BezierRegion& region, const LineFrame& frame) {
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    double a_min = kInf, a_max = -kInf, b_min = kInf, b_max = -kInf;
+    double t_min = kInf, t_max = -kInf;
+    for (const auto& pw : region.points) {
+        if (!(pw(3) > 0.0)) return false;  // 重みが正でない場合は凸包性が成り立たない
+        const Vector3d r = Vector3d(pw(0), pw(1), pw(2)) / pw(3) - frame.p0;
+        const double a = frame.n1.dot(r), b = frame.n2.dot(r);
+        const double t = frame.d.dot(r) / frame.d_sq;
+        a_min = std::min(a_min, a);
+        a_max = std::max(a_max, a);
+        b_min = std::min(b_min, b);
+        b_max = std::max(b_max, b);
+        t_min = std::min(t_min, t);
+        t_max = std::max(t_max, t);
+    }
+    const double eps_t = frame.eps / std::sqrt(frame.d_sq);
+    return a_max < -frame.eps || a_min > frame.eps ||
+           b_max < -frame.eps || b_min > frame.eps ||
+           t_max < frame.t_lo - eps_t || t_min > frame.t_hi + eps_t;
+}
+
+/// @brief 領域の制御網が平坦 (四隅の双線形補間で近似できる) か
+/// @param region 対象領域
+/// @param p u方向の次数
+/// @param q v方向の次数
+/// @param flatness 制御網の大きさに対する許容値の比
+bool IsFlat(const BezierRegion& region, const unsigned int p,
+            const unsigned int q, const double flatness) {
+    auto point = [&](const unsigned int i, const unsigned int j) {
+        const auto& pw = region.points[i * (q + 1) + j];
+        return Vector3d(Vector3d(pw(0), pw(1), pw(2)) / pw(3));
+    };
+    const Vector3d c00 = point(0, 0), c10 = point(p, 0);
+    const Vector3d c01 = point(0, q), c11 = point(p, q);
+
+    double deviation = 0.0;
+    Vector3d lower = c00, upper = c00;
+    for (unsigned int i = 0; i <= p; ++i) {
+        const double s = static_cast<double>(i) / p;
+        for (unsigned int j = 0; j <= q; ++j) {
+            const double r = static_cast<double>(j) / q;
+            const Vector3d x = point(i, j);
+            const Vector3d bilinear = (1.0 - s) * ((1.0 - r) * c00 + r * c01)
+                                    + s * ((1.0 - r) * c10 + r * c11);
+            deviation = std::max(deviation, (x - bilinear).norm());
+            lower = lower.cwiseMin(x);
+            upper = upper.cwiseMax(x);
+        }
+    }
+    return deviation <= flatness * (upper - lower).norm();
+}
+
+/// @brief 領域をu方向またはv方向の中央で2分割する (de Casteljau法)
+/// @param region 分割する領域
+/// @param p u方向の次数
+/// @param q v方向の次数
+/// @return {前半, 後半}
+std::pair<BezierRegion, BezierRegion> SplitRegion(
+        const BezierRegion& region, const unsigned int p, const unsigned int q) {
+    auto at = [q](const unsigned int i, const unsigned int j) {
+        return i * (q + 1) + j;
+    };
+    auto point = [&](const unsigned int i, const unsigned int j) {
+        const auto& pw = region.points[at(i, j)];
+        return Vector3d(Vector3d(pw(0), pw(1), pw(2)) / pw(3));
+    };
+    // 制御網の各方向の長さが大きい方向で分割する
+    double length_u = 0.0, length_v = 0.0;
+    for (unsigned int i = 0; i <= p; ++i) {
+        for (unsigned int j = 0; j <= q; ++j) {
+            if (i < p) length_u += (point(i + 1, j) - point(i, j)).norm();
+            if (j < q) length_v += (point(i, j + 1) - point(i, j)).norm();
+        }
+    }
+    const bool split_u = (p > 0 && length_u >= length_v) || q == 0;
+
+    BezierRegion first = region, second = region;
+    ++first.depth;
+    ++second.depth;
+    const unsigned int lines = split_u ? q + 1 : p + 1;
+    const unsigned int n = split_u ? p + 1 : q + 1;
+    for (unsigned int line = 0; line < lines; ++line) {
+        auto index = [&](const unsigned int k) {
+            return split_u ? at(k, line) : at(line, k);
+        };
+        std::vector<Vector4d> work(n);
+        for (unsigned int k = 0; k < n; ++k) work[k] = region.points[index(k)];
+        first.points[index(0)] = work[0];
+        second.points[index(n - 1)] = work[n - 1];
+        for (unsigned int r = 1; r < n; ++r) {
+            for (unsigned int k = 0; k < n - r; ++k) {
+                work[k] = 0.5 * (work[k] + work[k + 1]);
+            }
+            first.points[index(r)] = work[0];
+            second.points[index(n - 1 - r)] = work[n - 1 - r];
+        }
+    }
+    if (split_u) {
+        first.u1 = second.u0 = 0.5 * (region.u0 + region.u1);
+    } else {
+        first.v1 = second.v0 = 0.5 * (region.v0 + region.v1);
+    }
+    return {first, second};
+}
+
+/// @brief 元の曲面上で交点のパラメータ (u, v) を求め直す
+/// @param surface 元の曲面
+/// @param position 交点 (NURBS表現上で求めたもの)
+/// @param params 探索制御パラメータ (u_samples, v_samplesを初期値探索に使用する)
+/// @return 元の曲面のパラメータ (u, v). 求まらない場合は`std::nullopt`
+std::optional<std::array<double, 2>> RecoverParameters(
+        const ISurface& surface, const Vector3d& position,
+        const SurfaceLineIntersectionParams& params) {
+    // 格子サンプルの索引は曲面ごとにキャッシュされる
+    const auto locator = surface.GetPointLocator(params.u_samples, params.v_samples);
+    const auto nearest = locator->FindNearestSample(position);
+    if (!nearest) return std::nullopt;
+    if (auto uv = i_ent::InvertPointOntoSurface(surface, position, *nearest)) {
+        return uv;
+    }
+    return nearest;
+}
+
+/// @brief NURBS制御網の再帰分割により交点を求める
+/// @return 交点のリスト (重複除去済み・ソート前). 曲面をNURBSで表せない場合は
+///         `std::nullopt` (呼び出し側で格子法にフォールバックする)
+std::optional<std::vector<SurfaceLineIntersection>> IntersectBySubdivision(
+        const ISurface& surface, const Vector3d& p0, const Vector3d& d,
+        const double d_sq, const LineType line_type,
+        const SurfaceLineIntersectionParams& params) {
+    const auto nurbs = surface.ToNurbs();
+    if (!nurbs) return std::nullopt;
+    const auto bezier = i_ent::detail::NurbsSurfaceToBezier(
+            *nurbs, nurbs->GetTransformationMatrix().GetTransformation());
+    if (!bezier) return std::nullopt;
+    const auto p = bezier->u_degree, q = bezier->v_degree;
+    const auto nurbs_range = nurbs->GetParameterRange();
+    const ParamRange nurbs_pr{nurbs_range[0], nurbs_range[1],
+                              nurbs_range[2], nurbs_range[3]};
+
+    // 座標値の大きさ (棄却判定の許容誤差の基準)
+    double scale = p0.norm();
+    for (const auto& patch : bezier->patches) {
+        for (const auto& pw : patch) {
+            scale = std::max(scale, Vector3d(pw(0), pw(1), pw(2)).norm() / pw(3));
+        }
+    }
+    const auto frame = MakeLineFrame(p0, d, d_sq, line_type, scale);
+
+    // 各パッチを根として、棄却されない領域を平坦になるまで分割する
+    std::vector<SurfaceLineIntersection> nurbs_hits;
+    std::vector<BezierRegion> stack;
+    const auto v_count = bezier->v_breakpoints.size() - 1;
+    for (size_t k = 0; k < bezier->patches.size(); ++k) {
+        const auto iu = k / v_count, iv = k % v_count;
+        stack.push_back({bezier->patches[k],
+                         bezier->u_breakpoints[iu], bezier->u_breakpoints[iu + 1],
+                         bezier->v_breakpoints[iv], bezier->v_breakpoints[iv + 1], 0});
+    }
+    while (!stack.empty()) {
+        const auto region = std::move(stack.back());
+        stack.pop_back();
+        if (IsRejected(region, frame)) continue;
+
+        const bool at_limit = region.depth >= params.max_subdivision_depth;
+        if (at_limit || IsFlat(region, p, q, params.subdivision_flatness)) {
+            // 領域の中心から (NURBS表現上で) ニュートン法を開始する
+            const double u = 0.5 * (region.u0 + region.u1);
+            const double v = 0.5 * (region.v0 + region.v1);
+            if (const auto pt = nurbs->TryGetPointAt(u, v)) {
+                const double t_init = ProjectOntoLine(*pt, p0, d, d_sq);
+                if (const auto hit = RunNewton(*nurbs, p0, d, u, v, t_init,
+                                               nurbs_pr, params, line_type)) {
+                    nurbs_hits.push_back(*hit);
+                    continue;
+                }
+            }
+            if (at_limit) continue;
+        }
+        auto [first, second] = SplitRegion(region, p, q);
+        stack.push_back(std::move(second));
+        stack.push_back(std::move(first));
+    }
+
+    Deduplicate(nurbs_hits, params.dedup_tol);
+    if (dynamic_cast<const i_ent::RationalBSplineSurface*>(&surface)) {
+        return nurbs_hits;  // ToNurbsは元の曲面と同じパラメータ化を保つ
+    }
+
+    // NURBS表現のパラメータ化は元の曲面と一致するとは限らないため、
+    // 交点の位置から元の曲面のパラメータを求め、元の曲面上で仕上げる
+    const double extent = ComputeFallbackExtent(surface, p0, p0 + d);
+    const ParamRange pr = GetEffectiveParamRange(surface, extent);
+    std::vector<SurfaceLineIntersection> results;
+    for (const auto& hit : nurbs_hits) {
+        const auto uv = RecoverParameters(surface, hit.position, params);
+        if (!uv) continue;
+        if (const auto polished = RunNewton(surface, p0, d, (*uv)[0], (*uv)[1],
+                                            hit.t, pr, params, line_type)) {
+            results.push_back(*polished);
+        }
+    }
+    Deduplicate(results, params.dedup_tol);
+    return results;
+}
+
 }  // namespace
 
 
@@ -229,6 +501,17 @@ std::vector<SurfaceLineIntersection> i_ent::IntersectSurfaceWithLine(
         return {};
     }
 
+    // 制御網の再帰分割 (曲面をNURBSで表せない場合は格子法にフォールバックする)
+    if (params.method == SurfaceLineIntersectionMethod::kSubdivision) {
+        if (auto results = IntersectBySubdivision(
+                    surface, p0, d, d_sq, line_type, params)) {
+            std::sort(results->begin(), results->end(),
+                      [](const SurfaceLineIntersection& a,
+                         const SurfaceLineIntersection& b) { return a.t < b.t; });
+            return *results;
+        }
+    }
+
     // 有効パラメータ範囲の計算
     const double extent = ComputeFallbackExtent(surface, p0, p1);
     const ParamRange pr = GetEffectiveParamRange(surface, extent);
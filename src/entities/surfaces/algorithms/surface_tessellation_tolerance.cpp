@@ -0,0 +1,144 @@
+/**
+ * @file entities/surfaces/algorithms/surface_tessellation_tolerance.cpp
+ * @brief 曲面のテッセレーションの許容量に基づく分割数の推定の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/entities/surfaces/algorithms/surface_tessellation_tolerance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace {
+
+namespace i_ent = igesio::entities;
+using i_ent::ISurface;
+using i_ent::TessellationTolerance;
+using igesio::Vector3d;
+
+/// @brief 接線の長さをゼロとみなす閾値 (角度の見積もりを行わない)
+constexpr double kDegenerateTangent = 1e-12;
+
+/// @brief 曲面上の曲線の1・2階微分から、許容量を満たすのに必要な2分割の回数を求める
+/// @param d1 C' (線分全体をs ∈ [0,1]とした1階微分)
+/// @param d2 C'' (同2階微分)
+/// @param tol 許容量
+/// @return 必要な2分割の回数 (実数. 0以下は分割不要)
+double RequiredLevels(const Vector3d& d1, const Vector3d& d2,
+                      const TessellationTolerance& tol) {
+    double level = 0.0;
+    const double len = d1.norm();
+    if (tol.chord_height > 0.0) {
+        // |C''| / 8 / 4^d <= chord_height
+        const double sag = d2.norm() / 8.0;
+        if (sag > tol.chord_height) {
+            level = std::max(level, 0.5 * std::log2(sag / tol.chord_height));
+        }
+    }
+    if (tol.angle > 0.0 && len > kDegenerateTangent) {
+        // |C' × C''| / |C'|^2 / 2^d <= angle
+        const double turn = d1.cross(d2).norm() / (len * len);
+        if (turn > tol.angle) level = std::max(level, std::log2(turn / tol.angle));
+    }
+    if (tol.max_edge_length > 0.0 && len > tol.max_edge_length) {
+        level = std::max(level, std::log2(len / tol.max_edge_length));
+    }
+    return level;
+}
+
+/// @brief (u, v)での微分から、線分 (du, dv) の分割に必要な2分割の回数を求める
+/// @return 評価できない場合は0
+double RequiredLevelsAt(const ISurface& surface, const double u, const double v,
+                        const double du, const double dv,
+                        const TessellationTolerance& tol) {
+    const auto d = surface.TryGetDerivatives(u, v, 2);
+    if (!d) return 0.0;
+    const Vector3d d1 = (*d)(1, 0) * du + (*d)(0, 1) * dv;
+    const Vector3d d2 = (*d)(2, 0) * (du * du) + 2.0 * (*d)(1, 1) * (du * dv) +
+                        (*d)(0, 2) * (dv * dv);
+    return RequiredLevels(d1, d2, tol);
+}
+
+/// @brief 区間 [a, b] を再帰的に2分割し、分割点 (bを除く) を追加する
+void SubdivideInterval(const ISurface& surface, const bool along_u,
+                       const double a, const double b,
+                       const std::vector<double>& probes,
+                       const TessellationTolerance& tol,
+                       const int depth, std::vector<double>& stations) {
+    stations.push_back(a);
+    if (depth <= 0) return;
+
+    const double h = b - a;
+    const double m = 0.5 * (a + b);
+    bool split = false;
+    for (const double p : probes) {
+        for (const double s : {a, m, b}) {
+            const double level = along_u
+                    ? RequiredLevelsAt(surface, s, p, h, 0.0, tol)
+                    : RequiredLevelsAt(surface, p, s, 0.0, h, tol);
+            if (level > 0.0) {
+                split = true;
+                break;
+            }
+        }
+        if (split) break;
+    }
+    if (!split) return;
+
+    stations.pop_back();
+    SubdivideInterval(surface, along_u, a, m, probes, tol, depth - 1, stations);
+    SubdivideInterval(surface, along_u, m, b, probes, tol, depth - 1, stations);
+}
+
+}  // namespace
+
+
+
+int i_ent::EstimateSubdivisionDepth(
+        const ISurface& surface, const std::array<double, 2>& u_range,
+        const std::array<double, 2>& v_range,
+        const TessellationTolerance& tolerance, const int max_depth) {
+    if (!tolerance.IsEnabled() || max_depth <= 0) return 0;
+    const double du = u_range[1] - u_range[0];
+    const double dv = v_range[1] - v_range[0];
+
+    // 小矩形の辺 (u方向・v方向) と、ファン三角分割で生じる対角線について見積もる
+    double level = 0.0;
+    for (int j = 0; j <= 2; ++j) {
+        for (int i = 0; i <= 2; ++i) {
+            const double u = u_range[0] + 0.5 * i * du;
+            const double v = v_range[0] + 0.5 * j * dv;
+            const auto d = surface.TryGetDerivatives(u, v, 2);
+            if (!d) continue;
+            for (const auto& [su, sv] : {std::pair{du, 0.0}, std::pair{0.0, dv},
+                                         std::pair{du, dv}, std::pair{du, -dv}}) {
+                const Vector3d d1 = (*d)(1, 0) * su + (*d)(0, 1) * sv;
+                const Vector3d d2 = (*d)(2, 0) * (su * su) +
+                                    2.0 * (*d)(1, 1) * (su * sv) +
+                                    (*d)(0, 2) * (sv * sv);
+                level = std::max(level, RequiredLevels(d1, d2, tolerance));
+            }
+        }
+    }
+    return std::min(max_depth, static_cast<int>(std::ceil(level)));
+}
+
+std::vector<double> i_ent::ComputeAdaptiveStations(
+        const ISurface& surface, const bool along_u,
+        const std::array<double, 2>& range, const std::vector<double>& probes,
+        const TessellationTolerance& tolerance, const int max_depth) {
+    const int depth = tolerance.IsEnabled() ? std::max(0, max_depth) : 0;
+    const double span = range[1] - range[0];
+
+    std::vector<double> stations;
+    for (int k = 0; k < kAdaptiveInitialIntervals; ++k) {
+        const double a = range[0] + span * k / kAdaptiveInitialIntervals;
+        const double b = range[0] + span * (k + 1) / kAdaptiveInitialIntervals;
+        SubdivideInterval(surface, along_u, a, b, probes, tolerance, depth, stations);
+    }
+    stations.push_back(range[1]);
+    return stations;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file entities/surfaces/algorithms/tessellation_cache.cpp
+ * @brief テッセレーション結果のキャッシュの実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/entities/surfaces/algorithms/tessellation_cache.h"
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "igesio/entities/entity_base.h"
+#include "entities/surfaces/algorithms/content_hasher.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_num = igesio::numerics;
+
+/// @brief TessellateRestrictedSurfaceのパラメータのハッシュの種別値
+constexpr std::uint64_t kRestrictedSurfaceMeshTag = 0x5245535452494354ULL;
+/// @brief TessellateWatertightのパラメータのハッシュの種別値
+constexpr std::uint64_t kWatertightMeshTag = 0x5741544552544954ULL;
+
+/// @brief キーへ値を結合する (CombineGeometryKeyと同じboost::hash_combine方式)
+/// @note プロセス内の索引 (SlotHash) 専用. 保存する値にはContentHasherを用いる
+template <typename T>
+std::uint64_t Combine(std::uint64_t seed, const T& value) {
+    constexpr std::uint64_t kGolden = 0x9e3779b97f4a7c15ULL;
+    seed ^= static_cast<std::uint64_t>(std::hash<T>{}(value))
+            + kGolden + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+/// @brief 許容量をハッシュへ結合する
+void AddTolerance(i_ent::ContentHasher& hasher,
+                  const i_ent::TessellationTolerance& tolerance) {
+    hasher.Add(tolerance.chord_height);
+    hasher.Add(tolerance.angle);
+    hasher.Add(tolerance.max_edge_length);
+}
+
+}  // namespace
+
+
+
+/**
+ * キー
+ */
+
+i_ent::TessellationCacheKey i_ent::MakeTessellationCacheKey(
+        const IEntityIdentifier& entity, const std::uint64_t params) {
+    return {entity.GetID(), CombineGeometryKeyRecursive(0, entity), params};
+}
+
+std::uint64_t i_ent::HashTessellationParams(const RestrictedSurfaceMeshParams& params) {
+    ContentHasher hasher;
+    hasher.Add(kRestrictedSurfaceMeshTag);
+    hasher.Add(params.base_div);
+    hasher.Add(params.max_depth);
+    // parallelは出力に影響しないため含めない
+    AddTolerance(hasher, params.tolerance);
+    return hasher.Value();
+}
+
+std::uint64_t i_ent::HashTessellationParams(const WatertightMeshParams& params) {
+    ContentHasher hasher;
+    hasher.Add(kWatertightMeshTag);
+    AddTolerance(hasher, params.tolerance);
+    hasher.Add(params.max_depth);
+    hasher.Add(params.merge_tolerance);
+    return hasher.Value();
+}
+
+std::size_t i_ent::EstimateMeshMemory(const numerics::TriangleMeshf& mesh) {
+    std::size_t bytes = sizeof(mesh);
+    bytes += sizeof(float) * static_cast<std::size_t>(
+            mesh.positions.size() + mesh.normals.size() + mesh.uvs.size());
+    bytes += sizeof(std::uint32_t) * mesh.indices.capacity();
+    for (const auto& group : mesh.groups) {
+        bytes += sizeof(group) + group.name.capacity() + group.material_name.capacity();
+    }
+    return bytes;
+}
+
+std::size_t i_ent::TessellationCache::SlotHash::operator()(
+        const TessellationCacheKey& key) const {
+    return static_cast<std::size_t>(Combine(Combine(0, key.id), key.params));
+}
+
+
+
+/**
+ * TessellationCache
+ */
+
+std::shared_ptr<const i_num::TriangleMeshf>
+i_ent::TessellationCache::GetRestrictedSurfaceMesh(
+        const IRestrictedSurface& surface, const RestrictedSurfaceMeshParams& params) {
+    return GetOrBuild(
+            MakeTessellationCacheKey(surface, HashTessellationParams(params)),
+            [&]() { return TessellateRestrictedSurface(surface, params); });
+}
+
+std::shared_ptr<const i_num::TriangleMeshf> i_ent::TessellationCache::Find(
+        const TessellationCacheKey& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = index_.find(key);
+    if (it == index_.end() || it->second->key.geometry != key.geometry) {
+        ++stats_.misses;
+        return nullptr;
+    }
+    ++stats_.hits;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->mesh;
+}
+
+std::shared_ptr<const i_num::TriangleMeshf> i_ent::TessellationCache::Insert(
+        const TessellationCacheKey& key,
+        std::shared_ptr<const numerics::TriangleMeshf> mesh) {
+    if (!mesh) return mesh;
+    const std::size_t bytes = EstimateMeshMemory(*mesh);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (const auto it = index_.find(key); it != index_.end()) {
+        // 他のスレッドが先に登録した場合はその結果を返す
+        if (it->second->key.geometry == key.geometry) {
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return it->second->mesh;
+        }
+        // 形状の変更前の結果は再び参照されないため破棄する
+        EraseLocked(it->second);
+    }
+    if (bytes > memory_budget_) return mesh;
+
+    entries_.push_front({key, mesh, bytes});
+    index_.emplace(key, entries_.begin());
+    memory_usage_ += bytes;
+    EvictLocked();
+    return mesh;
+}
+
+std::vector<std::pair<std::uint64_t, std::shared_ptr<const i_num::TriangleMeshf>>>
+i_ent::TessellationCache::GetEntries(
+        const ObjectID& id, const std::uint64_t geometry) const {
+    std::vector<std::pair<std::uint64_t, std::shared_ptr<const i_num::TriangleMeshf>>> result;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : entries_) {
+        if (entry.key.id == id && entry.key.geometry == geometry) {
+            result.emplace_back(entry.key.params, entry.mesh);
+        }
+    }
+    return result;
+}
+
+void i_ent::TessellationCache::SetMemoryBudget(const std::size_t memory_budget) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    memory_budget_ = memory_budget;
+    EvictLocked();
+}
+
+std::size_t i_ent::TessellationCache::GetMemoryBudget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memory_budget_;
+}
+
+std::size_t i_ent::TessellationCache::GetMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memory_usage_;
+}
+
+std::size_t i_ent::TessellationCache::GetEntryCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+i_ent::TessellationCacheStats i_ent::TessellationCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void i_ent::TessellationCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    memory_usage_ = 0;
+    stats_ = {};
+}
+
+void i_ent::TessellationCache::EvictLocked() {
+    while (memory_usage_ > memory_budget_ && !entries_.empty()) {
+        EraseLocked(std::prev(entries_.end()));
+        ++stats_.evictions;
+    }
+}
+
+void i_ent::TessellationCache::EraseLocked(const std::list<Entry>::iterator it) {
+    memory_usage_ -= it->bytes;
+    index_.erase(it->key);
+    entries_.erase(it);
+}
+
+i_ent::TessellationCache& i_ent::GetSharedTessellationCache() {
+    static TessellationCache cache;
+    return cache;
+}
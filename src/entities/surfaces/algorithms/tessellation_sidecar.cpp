@@ -0,0 +1,508 @@
+/**
+ * @file entities/surfaces/algorithms/tessellation_sidecar.cpp
+ * @brief テッセレーション結果のディスクへの保存・読み込み (サイドカーファイル) の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * @note ファイルの形式 (値は全て実行環境のバイト順):
+ *       - ヘッダ: マジック (8byte), バージョン (u32), 予約 (u32),
+ *         レコード数 (u64), 索引の位置 (u64)
+ *       - レコード: 頂点数 (u64), フラグ (u32; bit0: 法線, bit1: UV), 面グループ数 (u32),
+ *         インデックス数 (u64), 位置・法線・UV (float), インデックス (u32),
+ *         面グループ (先頭の三角形 (u32), 三角形数 (u32), 名前・材質名 (長さ (u32) + 文字列))
+ *       - 索引: レコードごとに 内容ハッシュ (u64), パラメータのハッシュ (u64),
+ *         レコードの位置 (u64), レコードの大きさ (u64)
+ * @note 内容ハッシュ・パラメータのハッシュはいずれもFNV-1a (ContentHasher) であり、
+ *       標準ライブラリの実装によらず同じ値となる
+ */
+#include "igesio/entities/surfaces/algorithms/tessellation_sidecar.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "igesio/entities/entity_base.h"
+#include "entities/surfaces/algorithms/content_hasher.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_num = igesio::numerics;
+using i_ent::ContentHasher;
+
+/// @brief ファイル先頭のマジック
+constexpr char kMagic[8] = {'I', 'G', 'E', 'S', 'C', 'A', 'C', 'H'};
+/// @brief ファイル形式のバージョン
+/// @note バイト順の異なる環境のファイルは、この値が一致しないことで弾く.
+///       2: パラメータのハッシュをFNV-1a (HashTessellationParams) に変更
+constexpr std::uint32_t kVersion = 2;
+/// @brief ヘッダの大きさ [byte]
+constexpr std::size_t kHeaderSize = 32;
+/// @brief 索引の1要素の大きさ [byte]
+constexpr std::size_t kIndexEntrySize = 32;
+/// @brief レコードのフラグ: 法線を持つ
+constexpr std::uint32_t kHasNormals = 1u;
+/// @brief レコードのフラグ: UVを持つ
+constexpr std::uint32_t kHasUvs = 2u;
+
+
+
+/**
+ * 内容ハッシュ
+ */
+
+/// @brief エンティティ単体の内容 (型・フォーム番号・PDのポインタ以外の値) を結合する
+void AddOwnContent(ContentHasher& hasher, const i_ent::EntityBase& entity) {
+    hasher.Add(static_cast<int>(entity.GetType()));
+    hasher.Add(entity.GetFormNumber());
+    const auto params = entity.GetParameters();
+    hasher.Add(static_cast<std::uint64_t>(params.size()));
+    for (std::size_t i = 0; i < params.size(); ++i) {
+        const auto type = params.get_type(i);
+        hasher.Add(static_cast<int>(type));
+        switch (type) {
+            case igesio::CppParameterType::kBool:
+                hasher.Add(static_cast<int>(params.get<bool>(i)));
+                break;
+            case igesio::CppParameterType::kInt:
+                hasher.Add(params.get<int>(i));
+                break;
+            case igesio::CppParameterType::kDouble:
+                hasher.Add(params.get<double>(i));
+                break;
+            case igesio::CppParameterType::kString:
+                hasher.Add(params.get<std::string>(i));
+                break;
+            case igesio::CppParameterType::kPointer:
+                // 参照先のIDは読み込みごとに異なる. 形状に関わる参照先
+                // (物理従属子) の内容は別途結合する
+                break;
+        }
+    }
+}
+
+/// @brief エンティティ自身・DE変換チェーン・物理従属子の内容を再帰的に結合する
+///        (CombineGeometryKeyRecursiveと同じ走査)
+/// @return 走査した全てのエンティティがEntityBaseの場合はtrue
+bool AddContentRecursive(ContentHasher& hasher, const i_ent::IEntityIdentifier& entity) {
+    const auto* base = dynamic_cast<const i_ent::EntityBase*>(&entity);
+    if (base == nullptr) return false;
+    AddOwnContent(hasher, *base);
+
+    for (auto t = base->GetTransformationMatrix().GetPointer();
+         t != nullptr; t = t->GetRefTransformation()) {
+        const auto* t_base = dynamic_cast<const i_ent::EntityBase*>(t.get());
+        if (t_base == nullptr) return false;
+        AddOwnContent(hasher, *t_base);
+    }
+    const auto child_ids = base->GetChildIDs();
+    hasher.Add(static_cast<std::uint64_t>(child_ids.size()));
+    for (const auto& cid : child_ids) {
+        const auto child = base->GetChildEntity(cid);
+        // 未解決の参照は、解決後とは異なる内容として扱う
+        hasher.Add(static_cast<int>(child != nullptr));
+        if (child && !AddContentRecursive(hasher, *child)) return false;
+    }
+    return true;
+}
+
+
+
+/**
+ * ファイルの読み書き
+ */
+
+/// @brief バイト列への書き込み
+class Writer {
+ public:
+    /// @brief 算術型の値を書き込む
+    template <typename T>
+    void Write(const T value) {
+        static_assert(std::is_arithmetic_v<T>, "Writer::Write: arithmetic only.");
+        WriteBytes(&value, sizeof(value));
+    }
+    /// @brief 長さ付きの文字列を書き込む
+    void WriteString(const std::string& value) {
+        Write(static_cast<std::uint32_t>(value.size()));
+        WriteBytes(value.data(), value.size());
+    }
+    /// @brief バイト列を書き込む
+    void WriteBytes(const void* data, const std::size_t size) {
+        const auto* bytes = static_cast<const char*>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+    /// @brief 指定位置の値を上書きする
+    template <typename T>
+    void Overwrite(const std::size_t offset, const T value) {
+        std::memcpy(buffer_.data() + offset, &value, sizeof(value));
+    }
+
+    /// @brief 書き込んだバイト数
+    std::size_t Size() const { return buffer_.size(); }
+    /// @brief 書き込んだバイト列
+    const std::vector<char>& Buffer() const { return buffer_; }
+
+ private:
+    /// @brief バイト列
+    std::vector<char> buffer_;
+};
+
+/// @brief 範囲検査付きのバイト列からの読み込み
+class Reader {
+ public:
+    /// @brief コンストラクタ
+    Reader(const unsigned char* data, const std::size_t size)
+            : data_(data), size_(size) {}
+
+    /// @brief 読み込み位置を変更する
+    /// @return 位置が範囲外の場合はfalse
+    bool Seek(const std::size_t offset) {
+        if (offset > size_) return false;
+        pos_ = offset;
+        return true;
+    }
+    /// @brief 残りのバイト数
+    std::size_t Remaining() const { return size_ - pos_; }
+
+    /// @brief 算術型の値を読み込む
+    template <typename T>
+    bool Read(T& value) {
+        return ReadBytes(&value, sizeof(value));
+    }
+    /// @brief count個の値を読み込む
+    template <typename T>
+    bool ReadArray(T* values, const std::size_t count) {
+        if (count > Remaining() / sizeof(T)) return false;
+        return ReadBytes(values, count * sizeof(T));
+    }
+    /// @brief 長さ付きの文字列を読み込む
+    bool ReadString(std::string& value) {
+        std::uint32_t length = 0;
+        if (!Read(length) || length > Remaining()) return false;
+        value.assign(reinterpret_cast<const char*>(data_ + pos_), length);
+        pos_ += length;
+        return true;
+    }
+
+ private:
+    /// @brief バイト列を読み込む
+    bool ReadBytes(void* dst, const std::size_t size) {
+        if (size > Remaining()) return false;
+        if (size > 0) std::memcpy(dst, data_ + pos_, size);
+        pos_ += size;
+        return true;
+    }
+
+    /// @brief 先頭
+    const unsigned char* data_;
+    /// @brief 大きさ
+    std::size_t size_;
+    /// @brief 読み込み位置
+    std::size_t pos_ = 0;
+};
+
+/// @brief 読み込み専用にメモリマップしたファイル
+/// @note Windowsではファイル全体を読み込んで保持する
+class MappedFile {
+ public:
+    /// @brief コンストラクタ (開けない場合はData()がnullptrとなる)
+    explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+        std::ifstream ifs(path, std::ios::binary);
+        if (!ifs) return;
+        buffer_.assign(std::istreambuf_iterator<char>(ifs),
+                       std::istreambuf_iterator<char>());
+        if (buffer_.empty()) return;
+        data_ = reinterpret_cast<const unsigned char*>(buffer_.data());
+        size_ = buffer_.size();
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st {};
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* mapping = ::mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                                   PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                data_ = static_cast<const unsigned char*>(mapping);
+                size_ = static_cast<std::size_t>(st.st_size);
+            }
+        }
+        ::close(fd);
+#endif
+    }
+    /// @brief デストラクタ
+    ~MappedFile() {
+#ifndef _WIN32
+        if (data_ != nullptr) {
+            ::munmap(const_cast<unsigned char*>(data_), size_);
+        }
+#endif
+    }
+
+    // コピーを禁止
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @brief ファイルの内容の先頭 (開けなかった場合はnullptr)
+    const unsigned char* Data() const { return data_; }
+    /// @brief ファイルの大きさ [byte]
+    std::size_t Size() const { return size_; }
+
+ private:
+#ifdef _WIN32
+    /// @brief ファイルの内容
+    std::vector<char> buffer_;
+#endif
+    /// @brief ファイルの内容の先頭
+    const unsigned char* data_ = nullptr;
+    /// @brief ファイルの大きさ
+    std::size_t size_ = 0;
+};
+
+/// @brief メッシュをレコードとして書き込む
+void WriteRecord(Writer& writer, const i_num::TriangleMeshf& mesh) {
+    const auto vertex_count = static_cast<std::uint64_t>(mesh.positions.cols());
+    const bool has_normals = mesh.normals.cols() == mesh.positions.cols()
+                          && mesh.normals.size() > 0;
+    const bool has_uvs = mesh.uvs.cols() == mesh.positions.cols()
+                      && mesh.uvs.size() > 0;
+    writer.Write(vertex_count);
+    writer.Write((has_normals ? kHasNormals : 0u) | (has_uvs ? kHasUvs : 0u));
+    writer.Write(static_cast<std::uint32_t>(mesh.groups.size()));
+    writer.Write(static_cast<std::uint64_t>(mesh.indices.size()));
+    // Eigenの既定は列優先のため、各列 (頂点) の成分が連続する
+    writer.WriteBytes(mesh.positions.data(), sizeof(float) * mesh.positions.size());
+    if (has_normals) {
+        writer.WriteBytes(mesh.normals.data(), sizeof(float) * mesh.normals.size());
+    }
+    if (has_uvs) writer.WriteBytes(mesh.uvs.data(), sizeof(float) * mesh.uvs.size());
+    writer.WriteBytes(mesh.indices.data(), sizeof(std::uint32_t) * mesh.indices.size());
+    for (const auto& group : mesh.groups) {
+        writer.Write(group.first_triangle);
+        writer.Write(group.triangle_count);
+        writer.WriteString(group.name);
+        writer.WriteString(group.material_name);
+    }
+}
+
+/// @brief レコードからメッシュを読み込む
+/// @return 範囲外の参照等、不正な内容の場合はnullptr
+std::shared_ptr<const i_num::TriangleMeshf> ReadRecord(Reader& reader) {
+    std::uint64_t vertex_count = 0, index_count = 0;
+    std::uint32_t flags = 0, group_count = 0;
+    if (!reader.Read(vertex_count) || !reader.Read(flags)
+            || !reader.Read(group_count) || !reader.Read(index_count)) {
+        return nullptr;
+    }
+    // 要素数は残りのバイト数で制限してから確保する
+    if (vertex_count > reader.Remaining() / (3 * sizeof(float))
+            || index_count > reader.Remaining() / sizeof(std::uint32_t)
+            || index_count % 3 != 0) {
+        return nullptr;
+    }
+
+    auto mesh = std::make_shared<i_num::TriangleMeshf>();
+    const auto n = static_cast<Eigen::Index>(vertex_count);
+    mesh->positions.resize(3, n);
+    if (!reader.ReadArray(mesh->positions.data(), 3 * vertex_count)) return nullptr;
+    if (flags & kHasNormals) {
+        mesh->normals.resize(3, n);
+        if (!reader.ReadArray(mesh->normals.data(), 3 * vertex_count)) return nullptr;
+    }
+    if (flags & kHasUvs) {
+        mesh->uvs.resize(2, n);
+        if (!reader.ReadArray(mesh->uvs.data(), 2 * vertex_count)) return nullptr;
+    }
+    mesh->indices.resize(index_count);
+    if (!reader.ReadArray(mesh->indices.data(), index_count)) return nullptr;
+    for (const auto index : mesh->indices) {
+        if (index >= vertex_count) return nullptr;
+    }
+
+    const auto triangle_count = index_count / 3;
+    for (std::uint32_t g = 0; g < group_count; ++g) {
+        i_num::MeshGroup group;
+        if (!reader.Read(group.first_triangle) || !reader.Read(group.triangle_count)
+                || !reader.ReadString(group.name)
+                || !reader.ReadString(group.material_name)) {
+            return nullptr;
+        }
+        if (static_cast<std::uint64_t>(group.first_triangle)
+                + group.triangle_count > triangle_count) {
+            return nullptr;
+        }
+        mesh->groups.push_back(std::move(group));
+    }
+    return mesh;
+}
+
+/// @brief 索引の要素
+struct IndexEntry {
+    /// @brief エンティティの内容ハッシュ
+    std::uint64_t content = 0;
+    /// @brief テッセレーションのパラメータのハッシュ
+    std::uint64_t params = 0;
+    /// @brief レコードの位置
+    std::uint64_t offset = 0;
+    /// @brief レコードの大きさ
+    std::uint64_t size = 0;
+};
+
+}  // namespace
+
+
+
+/**
+ * 内容ハッシュ
+ */
+
+std::optional<std::uint64_t> i_ent::ComputeEntityContentHash(
+        const IEntityIdentifier& entity) {
+    ContentHasher hasher;
+    if (!AddContentRecursive(hasher, entity)) return std::nullopt;
+    return hasher.Value();
+}
+
+
+
+/**
+ * 保存・読み込み
+ */
+
+bool i_ent::SaveTessellationSidecar(
+        const std::string& path,
+        const std::vector<std::shared_ptr<IEntityIdentifier>>& entities,
+        const TessellationCache& cache) {
+    Writer writer;
+    writer.WriteBytes(kMagic, sizeof(kMagic));
+    writer.Write(kVersion);
+    writer.Write(std::uint32_t{0});
+    writer.Write(std::uint64_t{0});  // レコード数 (後で上書き)
+    writer.Write(std::uint64_t{0});  // 索引の位置 (後で上書き)
+
+    std::vector<IndexEntry> index;
+    std::set<std::pair<std::uint64_t, std::uint64_t>> written;
+    for (const auto& entity : entities) {
+        if (!entity) continue;
+        const auto entries = cache.GetEntries(
+                entity->GetID(), CombineGeometryKeyRecursive(0, *entity));
+        if (entries.empty()) continue;
+        const auto content = ComputeEntityContentHash(*entity);
+        if (!content) continue;
+
+        for (const auto& [params, mesh] : entries) {
+            // 同じ内容・パラメータの結果は1つのみ保存する
+            if (!mesh || !written.emplace(*content, params).second) continue;
+            const auto offset = writer.Size();
+            WriteRecord(writer, *mesh);
+            index.push_back({*content, params, offset, writer.Size() - offset});
+        }
+    }
+
+    const auto index_offset = writer.Size();
+    for (const auto& entry : index) {
+        writer.Write(entry.content);
+        writer.Write(entry.params);
+        writer.Write(entry.offset);
+        writer.Write(entry.size);
+    }
+    writer.Overwrite(16, static_cast<std::uint64_t>(index.size()));
+    writer.Overwrite(24, static_cast<std::uint64_t>(index_offset));
+
+    // 書き込み途中のファイルを読まないよう、一時ファイルへ書き込んでから置き換える
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream ofs(temp_path, std::ios::binary | std::ios::trunc);
+        if (!ofs) return false;
+        ofs.write(writer.Buffer().data(),
+                  static_cast<std::streamsize>(writer.Buffer().size()));
+        if (!ofs) return false;
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+std::size_t i_ent::LoadTessellationSidecar(
+        const std::string& path,
+        const std::vector<std::shared_ptr<IEntityIdentifier>>& entities,
+        TessellationCache& cache) {
+    const MappedFile file(path);
+    if (file.Data() == nullptr || file.Size() < kHeaderSize) return 0;
+
+    Reader reader(file.Data(), file.Size());
+    char magic[sizeof(kMagic)];
+    std::uint32_t version = 0, reserved = 0;
+    std::uint64_t record_count = 0, index_offset = 0;
+    reader.ReadArray(magic, sizeof(magic));
+    reader.Read(version);
+    reader.Read(reserved);
+    reader.Read(record_count);
+    reader.Read(index_offset);
+    if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || version != kVersion
+            || index_offset < kHeaderSize || index_offset > file.Size()
+            || record_count > (file.Size() - index_offset) / kIndexEntrySize) {
+        return 0;
+    }
+
+    // 内容ハッシュから索引の要素への対応
+    std::unordered_multimap<std::uint64_t, IndexEntry> records;
+    reader.Seek(index_offset);
+    for (std::uint64_t i = 0; i < record_count; ++i) {
+        IndexEntry entry;
+        reader.Read(entry.content);
+        reader.Read(entry.params);
+        reader.Read(entry.offset);
+        reader.Read(entry.size);
+        if (entry.offset < kHeaderSize || entry.offset > index_offset
+                || entry.size > index_offset - entry.offset) {
+            return 0;
+        }
+        records.emplace(entry.content, entry);
+    }
+    if (records.empty()) return 0;
+
+    // 同じ内容のエンティティが複数ある場合は、読み込んだメッシュを共有する
+    std::unordered_map<std::uint64_t, std::shared_ptr<const i_num::TriangleMeshf>> parsed;
+    std::size_t loaded = 0;
+    for (const auto& entity : entities) {
+        if (!entity) continue;
+        const auto content = ComputeEntityContentHash(*entity);
+        if (!content) continue;
+        const auto [first, last] = records.equal_range(*content);
+        if (first == last) continue;
+
+        const auto geometry = CombineGeometryKeyRecursive(0, *entity);
+        for (auto it = first; it != last; ++it) {
+            const auto& entry = it->second;
+            auto& mesh = parsed[entry.offset];
+            if (!mesh) {
+                Reader record(file.Data() + entry.offset,
+                              static_cast<std::size_t>(entry.size));
+                mesh = ReadRecord(record);
+                if (!mesh) continue;
+            }
+            cache.Insert({entity->GetID(), geometry, entry.params}, mesh);
+            ++loaded;
+        }
+    }
+    return loaded;
+}
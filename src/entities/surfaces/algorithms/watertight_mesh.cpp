@@ -0,0 +1,1087 @@
+/**
+ * @file entities/surfaces/algorithms/watertight_mesh.cpp
+ * @brief 複数の曲面の、共有境界で隙間なく接続された三角形メッシュ生成の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/entities/surfaces/algorithms/watertight_mesh.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "igesio/common/parallel.h"
+#include "igesio/numerics/geometric/bvh.h"
+#include "igesio/numerics/geometric/polygon_triangulation.h"
+#include "igesio/entities/interfaces/i_curve.h"
+#include "igesio/entities/interfaces/i_restricted_surface.h"
+#include "igesio/entities/views/surface_view.h"
+#include "entities/surfaces/algorithms/surface_cell_tree.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_num = igesio::numerics;
+using igesio::Vector2d;
+using igesio::Vector3d;
+using i_ent::ICurve;
+using i_ent::ISurface;
+using i_ent::TessellationTolerance;
+using i_ent::WatertightMeshParams;
+
+/// @brief ピースの射影・退化判定・包含ボックスに用いる折れ線の分割数
+constexpr int kProbeSegments = 16;
+/// @brief 点をピースへ射影する黄金分割探索の反復回数
+constexpr int kProjectionIterations = 48;
+/// @brief 格子の分割点を決める際の、他方向の標本数
+constexpr int kGridProbeCount = 8;
+/// @brief ピースの分割点がピースの端点と一致するとみなすパラメータの相対幅
+constexpr double kParamEps = 1e-9;
+
+
+
+/**
+ * 境界のピース
+ */
+
+/// @brief uv空間の境界の経路
+/// @note curveがnullptrの場合は、startからendへの線分 (t ∈ [0, 1]) とする
+struct UvPath {
+    /// @brief uv空間の境界曲線B(t)
+    std::shared_ptr<const ICurve> curve;
+    /// @brief 線分の始点
+    Vector2d start = Vector2d::Zero();
+    /// @brief 線分の終点
+    Vector2d end = Vector2d::Zero();
+
+    /// @brief B(t)を評価する
+    std::optional<Vector2d> At(const double t) const {
+        if (!curve) return Vector2d(start + t * (end - start));
+        const auto p = curve->TryGetPointAt(t);
+        if (!p) return std::nullopt;
+        return Vector2d{p->x(), p->y()};
+    }
+
+    /// @brief B'(t)を評価する
+    std::optional<Vector2d> DerivativeAt(const double t) const {
+        if (!curve) return Vector2d(end - start);
+        const auto d = curve->TryGetDerivatives(t, 1);
+        if (!d) return std::nullopt;
+        return Vector2d{(*d)[1].x(), (*d)[1].y()};
+    }
+};
+
+/// @brief 面
+struct Face {
+    /// @brief 評価に用いる曲面 (制限面の場合は配置済みの基底曲面)
+    std::shared_ptr<const ISurface> surface;
+    /// @brief 境界の経路
+    std::vector<UvPath> paths;
+    /// @brief 各境界ループを構成するピースの番号 (先頭は外側境界)
+    std::vector<std::vector<std::size_t>> loops;
+    /// @brief 格子に加えるuの値 (曲面の折れ目)
+    std::vector<double> creases;
+};
+
+/// @brief 境界ループを角点・他のピースの端点で区切った区間 (ピース)
+struct Piece {
+    /// @brief 面の番号
+    std::size_t face = 0;
+    /// @brief 面の経路の番号
+    std::size_t path = 0;
+    /// @brief パラメータ範囲の始点 (t0 < t1)
+    double t0 = 0.0;
+    /// @brief パラメータ範囲の終点
+    double t1 = 0.0;
+    /// @brief 始点の空間上の位置
+    Vector3d p0 = Vector3d::Zero();
+    /// @brief 終点の空間上の位置
+    Vector3d p1 = Vector3d::Zero();
+    /// @brief 折れ線の標本点のパラメータ (評価できた点のみ)
+    std::vector<double> sample_t;
+    /// @brief 折れ線の標本点の位置
+    std::vector<Vector3d> sample_p;
+    /// @brief 空間上で1点に退化しているか
+    bool degenerate = false;
+    /// @brief 始点・終点の頂点番号
+    int v0 = -1, v1 = -1;
+    /// @brief 共有辺の番号
+    int group = -1;
+    /// @brief 共有辺の代表のピースと向きが逆か
+    bool reversed = false;
+    /// @brief 離散化点のパラメータ (t0からt1の順)
+    std::vector<double> params;
+    /// @brief 離散化点の共有頂点の番号
+    std::vector<int> vertices;
+};
+
+/// @brief ピース上の点C(t) = S(B(t))を評価する
+std::optional<Vector3d> PointOn(const Face& face, const Piece& piece, const double t) {
+    const auto uv = face.paths[piece.path].At(t);
+    if (!uv) return std::nullopt;
+    return face.surface->TryGetPointAt(uv->x(), uv->y());
+}
+
+/// @brief ピース上の点C(t)と接線C'(t)を評価する
+std::optional<std::pair<Vector3d, Vector3d>> PointAndTangentOn(
+        const Face& face, const Piece& piece, const double t) {
+    const auto& path = face.paths[piece.path];
+    const auto uv = path.At(t);
+    const auto duv = path.DerivativeAt(t);
+    if (!uv || !duv) return std::nullopt;
+    const auto d = face.surface->TryGetDerivatives(uv->x(), uv->y(), 1);
+    if (!d) return std::nullopt;
+    return std::make_pair(Vector3d((*d)(0, 0)),
+                          Vector3d((*d)(1, 0) * duv->x() + (*d)(0, 1) * duv->y()));
+}
+
+/// @brief 点pと線分abの距離
+double DistanceToSegment(const Vector3d& p, const Vector3d& a, const Vector3d& b) {
+    const Vector3d ab = b - a;
+    const double len_sq = ab.squaredNorm();
+    const double s = (len_sq > 0.0) ? std::clamp((p - a).dot(ab) / len_sq, 0.0, 1.0) : 0.0;
+    return (p - (a + s * ab)).norm();
+}
+
+/// @brief ピースの端点・標本点を評価し、退化を判定する
+/// @return 端点が評価できない場合はfalse
+bool InitPiece(const Face& face, Piece& piece, const double tolerance) {
+    piece.sample_t.clear();
+    piece.sample_p.clear();
+    for (int k = 0; k <= kProbeSegments; ++k) {
+        const double t = (k == kProbeSegments) ? piece.t1
+                : piece.t0 + (piece.t1 - piece.t0) * k / kProbeSegments;
+        const auto p = PointOn(face, piece, t);
+        if (!p) {
+            if (k == 0 || k == kProbeSegments) return false;
+            continue;
+        }
+        piece.sample_t.push_back(t);
+        piece.sample_p.push_back(*p);
+    }
+    piece.p0 = piece.sample_p.front();
+    piece.p1 = piece.sample_p.back();
+    piece.degenerate = std::all_of(piece.sample_p.begin(), piece.sample_p.end(),
+            [&](const Vector3d& p) { return (p - piece.p0).norm() <= tolerance; });
+    return true;
+}
+
+/// @brief 点をピースへ射影する
+/// @return {パラメータ, 距離}. 評価できない場合はnullopt
+/// @note 標本点の折れ線で最も近い区間を求め、その前後の区間を含む範囲で
+///       距離を黄金分割探索により最小化する
+std::optional<std::pair<double, double>> ProjectOntoPiece(
+        const Face& face, const Piece& piece, const Vector3d& q) {
+    const auto& ts = piece.sample_t;
+    const auto& ps = piece.sample_p;
+    std::size_t nearest = 0;
+    double nearest_d = std::numeric_limits<double>::infinity();
+    for (std::size_t k = 0; k + 1 < ps.size(); ++k) {
+        const double d = DistanceToSegment(q, ps[k], ps[k + 1]);
+        if (d < nearest_d) {
+            nearest_d = d;
+            nearest = k;
+        }
+    }
+
+    const auto f = [&](const double t) {
+        const auto p = PointOn(face, piece, t);
+        return p ? (*p - q).squaredNorm() : std::numeric_limits<double>::infinity();
+    };
+    const double r = 0.5 * (std::sqrt(5.0) - 1.0);
+    double a = ts[nearest > 0 ? nearest - 1 : 0];
+    double b = ts[std::min(nearest + 2, ts.size() - 1)];
+    double c = b - r * (b - a), d = a + r * (b - a);
+    double fc = f(c), fd = f(d);
+    for (int k = 0; k < kProjectionIterations; ++k) {
+        if (fc < fd) {
+            b = d;
+            d = c;
+            fd = fc;
+            c = b - r * (b - a);
+            fc = f(c);
+        } else {
+            a = c;
+            c = d;
+            fc = fd;
+            d = a + r * (b - a);
+            fd = f(d);
+        }
+    }
+    const double t = 0.5 * (a + b);
+    const double dist_sq = f(t);
+    if (!std::isfinite(dist_sq)) return std::nullopt;
+    return std::make_pair(t, std::sqrt(dist_sq));
+}
+
+/// @brief 経路の区間 [t0, t1] を分割点で区切ったピースを追加する
+/// @param cuts 区間内の分割点 (順不同. 端点付近の値は無視する)
+/// @return 端点が評価できないピースがある場合はfalse
+bool AppendPieces(const Face& face, const std::size_t face_index,
+                  const std::size_t path, const double t0, const double t1,
+                  std::vector<double> cuts, const double tolerance,
+                  std::vector<Piece>& pieces, std::vector<std::size_t>& loop) {
+    const double eps = (t1 - t0) * kParamEps;
+    cuts.erase(std::remove_if(cuts.begin(), cuts.end(), [&](const double t) {
+        return !(t > t0 + eps && t < t1 - eps);
+    }), cuts.end());
+    cuts.push_back(t0);
+    cuts.push_back(t1);
+    std::sort(cuts.begin(), cuts.end());
+    cuts.erase(std::unique(cuts.begin(), cuts.end(), [eps](const double a, const double b) {
+        return b - a <= eps;
+    }), cuts.end());
+
+    for (std::size_t k = 0; k + 1 < cuts.size(); ++k) {
+        Piece piece;
+        piece.face = face_index;
+        piece.path = path;
+        piece.t0 = cuts[k];
+        piece.t1 = cuts[k + 1];
+        if (!InitPiece(face, piece, tolerance)) return false;
+        loop.push_back(pieces.size());
+        pieces.push_back(std::move(piece));
+    }
+    return true;
+}
+
+/// @brief 面の境界ループを角点で区切ったピースを構築する
+/// @param input 対象の曲面
+/// @param face_index 面の番号
+/// @param tolerance merge_tolerance
+/// @param face 構築した面 (出力)
+/// @param pieces 構築したピース (出力. face.loopsの番号はこの添字)
+/// @return 面を構築できない場合はfalse
+bool BuildFace(const std::shared_ptr<const ISurface>& input,
+               const std::size_t face_index, const double tolerance,
+               Face& face, std::vector<Piece>& pieces) {
+    if (!input) return false;
+    const auto* restricted = i_ent::AsRestrictedSurface(*input);
+    face.surface = restricted ? i_ent::GetPlacedBaseSurface(*input) : input;
+    if (!face.surface) return false;
+
+    // 折れ目は配置に依存しないため、ビューの元の曲面から取得する
+    const ISurface* unplaced = face.surface.get();
+    if (const auto* view = dynamic_cast<const i_ent::SurfaceView*>(unplaced)) {
+        unplaced = view->GetBase().get();
+    }
+
+    const auto range = face.surface->GetParameterRange();
+    const bool finite = std::all_of(range.begin(), range.end(),
+                                    [](const double x) { return std::isfinite(x); });
+    if (!restricted || restricted->IsOuterBoundaryOfD()) {
+        // 外側境界はパラメータ矩形 (反時計回り). v一定の辺は折れ目で区切る
+        if (!finite) return false;
+        const double u0 = range[0], u1 = range[1], v0 = range[2], v1 = range[3];
+        for (const double uc : unplaced->GetUCreaseParameters()) {
+            if (uc > u0 && uc < u1) face.creases.push_back(uc);
+        }
+        const std::array<Vector2d, 4> corners{
+                Vector2d{u0, v0}, Vector2d{u1, v0}, Vector2d{u1, v1}, Vector2d{u0, v1}};
+        face.loops.emplace_back();
+        for (std::size_t k = 0; k < 4; ++k) {
+            face.paths.push_back({nullptr, corners[k], corners[(k + 1) % 4]});
+            std::vector<double> cuts;
+            for (const double uc : face.creases) {
+                if (k == 0) cuts.push_back((uc - u0) / (u1 - u0));
+                if (k == 2) cuts.push_back((u1 - uc) / (u1 - u0));
+            }
+            if (!AppendPieces(face, face_index, face.paths.size() - 1, 0.0, 1.0,
+                              cuts, tolerance, pieces, face.loops.back())) {
+                return false;
+            }
+        }
+    } else {
+        const auto outer = restricted->GetOuterUVBoundary();
+        if (!outer) return false;
+        face.paths.push_back({outer});
+        face.loops.emplace_back();
+    }
+
+    // 境界曲線による外側境界と穴
+    std::vector<std::shared_ptr<const ICurve>> curves;
+    if (restricted) {
+        if (!restricted->IsOuterBoundaryOfD()) curves.push_back(face.paths[0].curve);
+        for (std::size_t i = 0; i < restricted->GetInnerBoundaryCount(); ++i) {
+            if (const auto inner = restricted->GetInnerUVBoundaryAt(i)) {
+                curves.push_back(inner);
+            }
+        }
+    }
+    for (std::size_t k = 0; k < curves.size(); ++k) {
+        const auto& curve = curves[k];
+        const auto t_range = curve->GetParameterRange();
+        if (!std::isfinite(t_range[0]) || !std::isfinite(t_range[1]) ||
+            !(t_range[1] > t_range[0])) {
+            return false;
+        }
+        std::size_t path = 0;
+        if (restricted->IsOuterBoundaryOfD() || k > 0) {
+            face.paths.push_back({curve});
+            face.loops.emplace_back();
+            path = face.paths.size() - 1;
+        }
+        if (!AppendPieces(face, face_index, path, t_range[0], t_range[1],
+                          curve->GetCornerParams(), tolerance, pieces,
+                          face.loops.back())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+
+/**
+ * 共有辺の検出と離散化
+ */
+
+/// @brief 素集合データ構造の代表元を求める (経路圧縮あり)
+int FindRoot(std::vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+/// @brief 点群の軸平行ボックス (各点を中心とする一辺2rの立方体) のBVHを構築する
+i_num::Bvh BuildPointBvh(const std::vector<Vector3d>& points, const double r) {
+    std::vector<Vector3d> lowers, uppers;
+    lowers.reserve(points.size());
+    uppers.reserve(points.size());
+    for (const auto& p : points) {
+        lowers.push_back(p - Vector3d::Constant(r));
+        uppers.push_back(p + Vector3d::Constant(r));
+    }
+    return i_num::BuildBvh(lowers, uppers);
+}
+
+/// @brief ボックスが重なるか
+bool BoxesOverlap(const Vector3d& l0, const Vector3d& u0,
+                  const Vector3d& l1, const Vector3d& u1) {
+    return (l0.array() <= u1.array()).all() && (l1.array() <= u0.array()).all();
+}
+
+/// @brief ピースの標本点を包含するボックス (標本点間のたわみの分を拡大する)
+std::pair<Vector3d, Vector3d> PieceBox(const Piece& piece, const double tolerance) {
+    Vector3d lower = piece.sample_p.front(), upper = lower;
+    double step = 0.0;
+    for (std::size_t k = 0; k < piece.sample_p.size(); ++k) {
+        lower = lower.cwiseMin(piece.sample_p[k]);
+        upper = upper.cwiseMax(piece.sample_p[k]);
+        if (k > 0) step = std::max(step, (piece.sample_p[k] - piece.sample_p[k - 1]).norm());
+    }
+    const Vector3d pad = Vector3d::Constant(tolerance + 0.5 * step);
+    return {lower - pad, upper + pad};
+}
+
+/// @brief 区間 [a, b] を許容量を満たすまで2分割する必要があるか
+bool NeedsSplit(const Face& face, const Piece& piece, const double a, const double b,
+                const TessellationTolerance& tol) {
+    const auto ea = PointAndTangentOn(face, piece, a);
+    const auto eb = PointAndTangentOn(face, piece, b);
+    if (!ea || !eb) return false;
+    const auto& [pa, da] = *ea;
+    const auto& [pb, db] = *eb;
+    if (tol.max_edge_length > 0.0 && (pb - pa).norm() > tol.max_edge_length) return true;
+    if (tol.angle > 0.0) {
+        const double len = da.norm() * db.norm();
+        if (len > 0.0 &&
+            std::acos(std::clamp(da.dot(db) / len, -1.0, 1.0)) > tol.angle) {
+            return true;
+        }
+    }
+    if (tol.chord_height > 0.0) {
+        for (const double s : {0.25, 0.5, 0.75}) {
+            const auto p = PointOn(face, piece, a + s * (b - a));
+            if (p && DistanceToSegment(*p, pa, pb) > tol.chord_height) return true;
+        }
+    }
+    return false;
+}
+
+/// @brief 区間 [a, b) の分割点を再帰的に追加する
+void SubdivideInterval(const Face& face, const Piece& piece, const double a,
+                       const double b, const TessellationTolerance& tol,
+                       const int depth, std::vector<double>& params) {
+    if (depth <= 0 || !NeedsSplit(face, piece, a, b, tol)) {
+        params.push_back(a);
+        return;
+    }
+    const double m = 0.5 * (a + b);
+    SubdivideInterval(face, piece, a, m, tol, depth - 1, params);
+    SubdivideInterval(face, piece, m, b, tol, depth - 1, params);
+}
+
+/// @brief 共有辺の代表のピースを離散化する
+/// @return 離散化点のパラメータ (t0, t1を含む昇順)
+std::vector<double> DiscretizePiece(const Face& face, const Piece& piece,
+                                    const WatertightMeshParams& params) {
+    if (piece.degenerate) return {piece.t0, piece.t1};
+    // 閉じたピース (両端が同じ頂点) は1区間では形状を捉えられないため、初期区間を増やす
+    const int initial = (piece.v0 == piece.v1) ? i_ent::kAdaptiveInitialIntervals : 1;
+    const int depth = params.tolerance.IsEnabled() ? params.max_depth : 0;
+    std::vector<double> result;
+    for (int k = 0; k < initial; ++k) {
+        const double a = piece.t0 + (piece.t1 - piece.t0) * k / initial;
+        const double b = (k + 1 == initial) ? piece.t1
+                : piece.t0 + (piece.t1 - piece.t0) * (k + 1) / initial;
+        SubdivideInterval(face, piece, a, b, params.tolerance, depth, result);
+    }
+    result.push_back(piece.t1);
+    return result;
+}
+
+
+
+/**
+ * 面の三角形分割
+ */
+
+/// @brief 面の境界ループ上の点
+struct LoopPoint {
+    /// @brief uv座標
+    Vector2d uv;
+    /// @brief 共有頂点の番号
+    int vertex;
+};
+
+/// @brief 面ごとのメッシュ
+struct FaceMesh {
+    /// @brief 面の内部の頂点 (格子点) の位置
+    std::vector<Vector3d> positions;
+    /// @brief 面の内部の頂点の法線
+    std::vector<Vector3d> normals;
+    /// @brief 共有頂点における面の法線 {頂点番号, 法線}
+    std::vector<std::pair<int, Vector3d>> shared_normals;
+    /// @brief 三角形 (0以上: 共有頂点の番号, 負: 内部の頂点kを-(k+1)で表す)
+    std::vector<std::array<int, 3>> triangles;
+};
+
+/// @brief (u, v)での位置と単位法線を評価する
+/// @return 評価できない場合はnullopt. 法線が定まらない場合はゼロベクトル
+std::optional<std::pair<Vector3d, Vector3d>> EvaluateVertex(
+        const ISurface& surface, const double u, const double v) {
+    const auto d = surface.TryGetDerivatives(u, v, 1);
+    if (!d) return std::nullopt;
+    const Vector3d n = (*d)(1, 0).cross((*d)(0, 1));
+    const double len = n.norm();
+    return std::make_pair(Vector3d((*d)(0, 0)),
+                          (len > 1e-12) ? Vector3d(n / len) : Vector3d::Zero());
+}
+
+/// @brief 点が多角形群の内部にあるか (偶奇規則)
+bool IsInsideLoops(const std::vector<std::vector<Vector2d>>& loops, const Vector2d& p) {
+    bool inside = false;
+    for (const auto& loop : loops) {
+        for (std::size_t k = 0, n = loop.size(); k < n; ++k) {
+            const auto& a = loop[k];
+            const auto& b = loop[(k + 1) % n];
+            if ((a.y() > p.y()) != (b.y() > p.y()) &&
+                p.x() < a.x() + (p.y() - a.y()) * (b.x() - a.x()) / (b.y() - a.y())) {
+                inside = !inside;
+            }
+        }
+    }
+    return inside;
+}
+
+/// @brief 線分abが閉矩形 [lo, hi] と交わるか
+bool SegmentIntersectsBox(const Vector2d& a, const Vector2d& b,
+                          const Vector2d& lo, const Vector2d& hi) {
+    double s0 = 0.0, s1 = 1.0;
+    const Vector2d d = b - a;
+    for (int axis = 0; axis < 2; ++axis) {
+        if (d[axis] == 0.0) {
+            if (a[axis] < lo[axis] || a[axis] > hi[axis]) return false;
+            continue;
+        }
+        double sa = (lo[axis] - a[axis]) / d[axis];
+        double sb = (hi[axis] - a[axis]) / d[axis];
+        if (sa > sb) std::swap(sa, sb);
+        s0 = std::max(s0, sa);
+        s1 = std::min(s1, sb);
+        if (s0 > s1) return false;
+    }
+    return true;
+}
+
+/// @brief 区間 [lo, hi] と交わる格子のセルの範囲 {最初, 最後} を返す
+std::pair<int, int> CellRange(const std::vector<double>& stations,
+                              const double lo, const double hi) {
+    const int first = static_cast<int>(
+            std::lower_bound(stations.begin() + 1, stations.end(), lo) -
+            (stations.begin() + 1));
+    const int last = static_cast<int>(
+            std::upper_bound(stations.begin(), stations.end() - 1, hi) -
+            stations.begin()) - 1;
+    return {first, last};
+}
+
+/// @brief 多角形の符号付き面積の2倍
+double SignedArea2(const std::vector<Vector2d>& points,
+                   const std::vector<std::uint32_t>& loop) {
+    double area = 0.0;
+    for (std::size_t k = 0, n = loop.size(); k < n; ++k) {
+        const auto& a = points[loop[k]];
+        const auto& b = points[loop[(k + 1) % n]];
+        area += a.x() * b.y() - b.x() * a.y();
+    }
+    return area;
+}
+
+/// @brief 1つの面を三角形分割する
+/// @note 境界から離れた格子のセルを残し (kept)、残りの領域 (境界と残したセルの間) を
+///       耳切り法で分割する. セルは境界と交わらず、8近傍のセルも境界と交わらない
+///       ものを残す (境界との間に極端に細い三角形が生じないようにするため)
+FaceMesh TessellateFace(const Face& face, const std::vector<Piece>& pieces,
+                        const WatertightMeshParams& params) {
+    FaceMesh result;
+    const ISurface& surface = *face.surface;
+
+    // 境界ループ (各ピースの離散化点を、終点を除いて連結する)
+    std::vector<std::vector<LoopPoint>> loops;
+    for (const auto& loop : face.loops) {
+        std::vector<LoopPoint> points;
+        for (const auto index : loop) {
+            const auto& piece = pieces[index];
+            const auto& path = face.paths[piece.path];
+            for (std::size_t k = 0; k + 1 < piece.params.size(); ++k) {
+                const auto uv = path.At(piece.params[k]);
+                if (!uv) continue;
+                points.push_back({*uv, piece.vertices[k]});
+            }
+        }
+        if (points.size() >= 3) loops.push_back(std::move(points));
+    }
+    if (loops.empty()) return result;
+
+    std::vector<std::vector<Vector2d>> uv_loops;
+    Vector2d lo = loops[0][0].uv, hi = lo;
+    for (const auto& loop : loops) {
+        uv_loops.emplace_back();
+        for (const auto& p : loop) {
+            uv_loops.back().push_back(p.uv);
+            lo = lo.cwiseMin(p.uv);
+            hi = hi.cwiseMax(p.uv);
+            if (const auto e = EvaluateVertex(surface, p.uv.x(), p.uv.y())) {
+                result.shared_normals.emplace_back(p.vertex, e->second);
+            }
+        }
+    }
+
+    // 許容量に基づくテンソル積格子
+    std::vector<double> su{lo.x(), hi.x()}, sv{lo.y(), hi.y()};
+    if (hi.x() > lo.x() && hi.y() > lo.y()) {
+        const auto probes = [](const double a, const double b) {
+            std::vector<double> values;
+            for (int k = 0; k <= kGridProbeCount; ++k) {
+                values.push_back(a + (b - a) * k / kGridProbeCount);
+            }
+            return values;
+        };
+        su = i_ent::ComputeAdaptiveStations(surface, true, {lo.x(), hi.x()},
+                probes(lo.y(), hi.y()), params.tolerance, params.max_depth);
+        sv = i_ent::ComputeAdaptiveStations(surface, false, {lo.y(), hi.y()},
+                probes(lo.x(), hi.x()), params.tolerance, params.max_depth);
+        for (const double uc : face.creases) {
+            if (uc > lo.x() && uc < hi.x()) su.push_back(uc);
+        }
+        std::sort(su.begin(), su.end());
+        su.erase(std::unique(su.begin(), su.end()), su.end());
+    }
+    const int nu = static_cast<int>(su.size()) - 1;
+    const int nv = static_cast<int>(sv.size()) - 1;
+    const auto cell = [nu](const int i, const int j) {
+        return static_cast<std::size_t>(j) * nu + i;
+    };
+
+    // 境界と交わるセル、および領域内のセル
+    std::vector<char> clean(static_cast<std::size_t>(nu) * nv, 1);
+    for (const auto& loop : uv_loops) {
+        for (std::size_t k = 0, n = loop.size(); k < n; ++k) {
+            const auto& a = loop[k];
+            const auto& b = loop[(k + 1) % n];
+            const auto [i0, i1] = CellRange(su, std::min(a.x(), b.x()), std::max(a.x(), b.x()));
+            const auto [j0, j1] = CellRange(sv, std::min(a.y(), b.y()), std::max(a.y(), b.y()));
+            for (int j = j0; j <= j1; ++j) {
+                for (int i = i0; i <= i1; ++i) {
+                    if (clean[cell(i, j)] && SegmentIntersectsBox(
+                            a, b, {su[i], sv[j]}, {su[i + 1], sv[j + 1]})) {
+                        clean[cell(i, j)] = 0;
+                    }
+                }
+            }
+        }
+    }
+    for (int j = 0; j < nv; ++j) {
+        for (int i = 0; i < nu; ++i) {
+            if (!clean[cell(i, j)]) continue;
+            const Vector2d center{0.5 * (su[i] + su[i + 1]), 0.5 * (sv[j] + sv[j + 1])};
+            if (!IsInsideLoops(uv_loops, center)) clean[cell(i, j)] = 0;
+        }
+    }
+    const auto is_clean = [&](const int i, const int j) {
+        return i >= 0 && i < nu && j >= 0 && j < nv && clean[cell(i, j)];
+    };
+    std::vector<char> kept(clean.size(), 0);
+    for (int j = 0; j < nv; ++j) {
+        for (int i = 0; i < nu; ++i) {
+            bool ok = true;
+            for (int dj = -1; dj <= 1 && ok; ++dj) {
+                for (int di = -1; di <= 1 && ok; ++di) ok = is_clean(i + di, j + dj);
+            }
+            kept[cell(i, j)] = ok;
+        }
+    }
+    const auto is_kept = [&](const int i, const int j) {
+        return i >= 0 && i < nu && j >= 0 && j < nv && kept[cell(i, j)];
+    };
+
+    // 格子点を評価し、評価できない点を持つセル、および対角のみで接するセル
+    // (残りの領域の境界が1点で交わる) を除く
+    const auto corner_key = [nu](const int i, const int j) {
+        return static_cast<std::int64_t>(j) * (nu + 1) + i;
+    };
+    std::unordered_map<std::int64_t, std::optional<std::pair<Vector3d, Vector3d>>> corners;
+    const auto corner = [&](const int i, const int j)
+            -> const std::optional<std::pair<Vector3d, Vector3d>>& {
+        const auto key = corner_key(i, j);
+        auto it = corners.find(key);
+        if (it == corners.end()) {
+            it = corners.emplace(key, EvaluateVertex(surface, su[i], sv[j])).first;
+        }
+        return it->second;
+    };
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int j = 0; j + 1 < nv; ++j) {
+            for (int i = 0; i + 1 < nu; ++i) {
+                const bool a = is_kept(i, j), b = is_kept(i + 1, j);
+                const bool c = is_kept(i, j + 1), d = is_kept(i + 1, j + 1);
+                if (a && d && !b && !c) {
+                    kept[cell(i, j)] = kept[cell(i + 1, j + 1)] = 0;
+                    changed = true;
+                } else if (b && c && !a && !d) {
+                    kept[cell(i + 1, j)] = kept[cell(i, j + 1)] = 0;
+                    changed = true;
+                }
+            }
+        }
+        for (int j = 0; j < nv; ++j) {
+            for (int i = 0; i < nu; ++i) {
+                if (!kept[cell(i, j)]) continue;
+                if (!corner(i, j) || !corner(i + 1, j) ||
+                    !corner(i, j + 1) || !corner(i + 1, j + 1)) {
+                    kept[cell(i, j)] = 0;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // 三角形分割の頂点 (境界ループの点、残したセルの角)
+    std::vector<Vector2d> points;
+    std::vector<int> refs;
+    std::unordered_map<std::int64_t, int> local_of_corner;
+    const auto corner_ref = [&](const int i, const int j) {
+        const auto key = corner_key(i, j);
+        const auto it = local_of_corner.find(key);
+        if (it != local_of_corner.end()) return it->second;
+        const auto& e = *corners.at(key);
+        const int ref = -static_cast<int>(result.positions.size()) - 1;
+        result.positions.push_back(e.first);
+        result.normals.push_back(e.second);
+        local_of_corner.emplace(key, ref);
+        return ref;
+    };
+
+    // 残したセルの領域の境界を、残りの領域が左側となる向きで辿る
+    std::unordered_map<std::int64_t, std::int64_t> next_corner;
+    for (int j = 0; j < nv; ++j) {
+        for (int i = 0; i < nu; ++i) {
+            if (!kept[cell(i, j)]) continue;
+            if (!is_kept(i, j - 1)) next_corner[corner_key(i + 1, j)] = corner_key(i, j);
+            if (!is_kept(i + 1, j)) next_corner[corner_key(i + 1, j + 1)] = corner_key(i + 1, j);
+            if (!is_kept(i, j + 1)) next_corner[corner_key(i, j + 1)] = corner_key(i + 1, j + 1);
+            if (!is_kept(i - 1, j)) next_corner[corner_key(i, j)] = corner_key(i, j + 1);
+        }
+    }
+
+    // 境界ループ (外側境界は正、穴は負) と残したセルの領域の境界 (向きで判定)
+    std::vector<std::pair<std::vector<std::uint32_t>, bool>> polygon_loops;
+    for (std::size_t l = 0; l < loops.size(); ++l) {
+        std::vector<std::uint32_t> indices;
+        for (const auto& p : loops[l]) {
+            indices.push_back(static_cast<std::uint32_t>(points.size()));
+            points.push_back(p.uv);
+            refs.push_back(p.vertex);
+        }
+        polygon_loops.emplace_back(std::move(indices), l == 0);
+    }
+    std::vector<std::int64_t> starts;
+    for (const auto& [from, to] : next_corner) starts.push_back(from);
+    std::sort(starts.begin(), starts.end());
+    std::unordered_map<std::int64_t, bool> visited;
+    for (const auto start : starts) {
+        if (visited[start]) continue;
+        std::vector<std::uint32_t> indices;
+        for (std::int64_t key = start; !visited[key]; key = next_corner.at(key)) {
+            visited[key] = true;
+            const int i = static_cast<int>(key % (nu + 1));
+            const int j = static_cast<int>(key / (nu + 1));
+            indices.push_back(static_cast<std::uint32_t>(points.size()));
+            points.push_back({su[i], sv[j]});
+            refs.push_back(corner_ref(i, j));
+        }
+        const bool positive = SignedArea2(points, indices) > 0.0;
+        polygon_loops.emplace_back(std::move(indices), positive);
+    }
+
+    // 負のループを、それを含む最小の正のループの穴とする
+    std::vector<std::size_t> outers;
+    for (std::size_t k = 0; k < polygon_loops.size(); ++k) {
+        if (polygon_loops[k].second) outers.push_back(k);
+    }
+    std::map<std::size_t, std::vector<std::vector<std::uint32_t>>> holes;
+    for (std::size_t k = 0; k < polygon_loops.size(); ++k) {
+        if (polygon_loops[k].second) continue;
+        const auto& loop = polygon_loops[k].first;
+        std::size_t owner = 0;
+        double owner_area = std::numeric_limits<double>::infinity();
+        for (const auto o : outers) {
+            const auto& outer = polygon_loops[o].first;
+            std::vector<Vector2d> outer_uv;
+            for (const auto index : outer) outer_uv.push_back(points[index]);
+            const double area = std::abs(SignedArea2(points, outer));
+            if (area < owner_area && IsInsideLoops({outer_uv}, points[loop[0]])) {
+                owner = o;
+                owner_area = area;
+            }
+        }
+        holes[owner].push_back(loop);
+    }
+
+    const auto add_triangle = [&](const int a, const int b, const int c) {
+        // 退化した境界 (特異点等) で同じ頂点を2度含む三角形は除く
+        if (a == b || b == c || c == a) return;
+        result.triangles.push_back({a, b, c});
+    };
+    for (const auto o : outers) {
+        for (const auto& tri : i_num::TriangulatePolygon(
+                points, polygon_loops[o].first, holes[o])) {
+            add_triangle(refs[tri[0]], refs[tri[1]], refs[tri[2]]);
+        }
+    }
+    for (int j = 0; j < nv; ++j) {
+        for (int i = 0; i < nu; ++i) {
+            if (!kept[cell(i, j)]) continue;
+            const int c00 = corner_ref(i, j), c10 = corner_ref(i + 1, j);
+            const int c01 = corner_ref(i, j + 1), c11 = corner_ref(i + 1, j + 1);
+            add_triangle(c00, c10, c11);
+            add_triangle(c00, c11, c01);
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+
+
+igesio::numerics::TriangleMeshf i_ent::TessellateWatertight(
+        const std::vector<std::shared_ptr<const ISurface>>& faces,
+        const WatertightMeshParams& params) {
+    if (!(params.merge_tolerance > 0.0)) {
+        throw std::invalid_argument(
+            "TessellateWatertight: merge_tolerance must be positive.");
+    }
+    if (params.max_depth < 0) {
+        throw std::invalid_argument(
+            "TessellateWatertight: max_depth must be non-negative.");
+    }
+    const double tol = params.merge_tolerance;
+
+    // 1. 各面の境界ループを角点で区切ったピースを構築する
+    std::vector<Face> face_data(faces.size());
+    std::vector<std::vector<Piece>> face_pieces(faces.size());
+    std::vector<char> face_valid(faces.size(), 0);
+    igesio::ParallelFor(faces.size(), [&](const std::size_t f) {
+        face_valid[f] = BuildFace(faces[f], f, tol, face_data[f], face_pieces[f]);
+    });
+
+    std::vector<Piece> pieces;
+    for (std::size_t f = 0; f < faces.size(); ++f) {
+        if (!face_valid[f]) {
+            face_data[f].loops.clear();
+            continue;
+        }
+        const std::size_t offset = pieces.size();
+        for (auto& loop : face_data[f].loops) {
+            for (auto& index : loop) index += offset;
+        }
+        for (auto& piece : face_pieces[f]) pieces.push_back(std::move(piece));
+    }
+
+    // 2. 他のピースの端点が内部に乗るピースを、その点で分割する (T字の解消)
+    {
+        std::vector<Vector3d> ends;
+        for (const auto& piece : pieces) {
+            ends.push_back(piece.p0);
+            ends.push_back(piece.p1);
+        }
+        const auto end_bvh = BuildPointBvh(ends, tol);
+        std::vector<std::vector<double>> cuts(pieces.size());
+        igesio::ParallelFor(pieces.size(), [&](const std::size_t i) {
+            const auto& piece = pieces[i];
+            if (piece.degenerate) return;
+            const auto& face = face_data[piece.face];
+            const auto [lower, upper] = PieceBox(piece, tol);
+            i_num::QueryBvh(end_bvh,
+                    [&](const Vector3d& l, const Vector3d& u) {
+                return BoxesOverlap(l, u, lower, upper);
+            }, [&](const std::uint32_t k) {
+                const auto& q = ends[k];
+                if ((q - piece.p0).norm() <= tol || (q - piece.p1).norm() <= tol) return;
+                const auto projection = ProjectOntoPiece(face, piece, q);
+                if (projection && projection->second <= tol) {
+                    cuts[i].push_back(projection->first);
+                }
+            });
+        });
+
+        std::vector<Piece> split;
+        for (auto& face : face_data) {
+            for (auto& loop : face.loops) {
+                std::vector<std::size_t> new_loop;
+                for (const auto index : loop) {
+                    auto& piece = pieces[index];
+                    if (cuts[index].empty()) {
+                        new_loop.push_back(split.size());
+                        split.push_back(std::move(piece));
+                        continue;
+                    }
+                    // 分割後のピースの評価は後で並列に行う
+                    auto& c = cuts[index];
+                    c.push_back(piece.t0);
+                    c.push_back(piece.t1);
+                    std::sort(c.begin(), c.end());
+                    const double eps = (piece.t1 - piece.t0) * kParamEps;
+                    c.erase(std::unique(c.begin(), c.end(),
+                            [eps](const double a, const double b) { return b - a <= eps; }),
+                            c.end());
+                    c.back() = piece.t1;
+                    for (std::size_t k = 0; k + 1 < c.size(); ++k) {
+                        Piece sub;
+                        sub.face = piece.face;
+                        sub.path = piece.path;
+                        sub.t0 = c[k];
+                        sub.t1 = c[k + 1];
+                        new_loop.push_back(split.size());
+                        split.push_back(std::move(sub));
+                    }
+                }
+                loop = std::move(new_loop);
+            }
+        }
+        pieces = std::move(split);
+        igesio::ParallelFor(pieces.size(), [&](const std::size_t i) {
+            if (pieces[i].sample_p.empty()) {
+                // 端点は分割元のピース上で評価できているため、失敗しない
+                InitPiece(face_data[pieces[i].face], pieces[i], tol);
+            }
+        });
+    }
+
+    // 3. 端点を距離tolでまとめて頂点とする
+    std::vector<Vector3d> shared_positions;
+    {
+        std::vector<Vector3d> ends;
+        for (const auto& piece : pieces) {
+            ends.push_back(piece.p0);
+            ends.push_back(piece.p1);
+        }
+        std::vector<int> parent(ends.size());
+        std::iota(parent.begin(), parent.end(), 0);
+        const auto bvh = BuildPointBvh(ends, 0.5 * tol);
+        for (std::size_t k = 0; k < ends.size(); ++k) {
+            const Vector3d lower = ends[k] - Vector3d::Constant(0.5 * tol);
+            const Vector3d upper = ends[k] + Vector3d::Constant(0.5 * tol);
+            i_num::QueryBvh(bvh, [&](const Vector3d& l, const Vector3d& u) {
+                return BoxesOverlap(l, u, lower, upper);
+            }, [&](const std::uint32_t m) {
+                if ((ends[m] - ends[k]).norm() > tol) return;
+                const int a = FindRoot(parent, static_cast<int>(k));
+                const int b = FindRoot(parent, static_cast<int>(m));
+                if (a != b) parent[std::max(a, b)] = std::min(a, b);
+            });
+        }
+        std::vector<int> vertex_of_root(ends.size(), -1);
+        for (std::size_t k = 0; k < ends.size(); ++k) {
+            const int root = FindRoot(parent, static_cast<int>(k));
+            if (vertex_of_root[root] < 0) {
+                vertex_of_root[root] = static_cast<int>(shared_positions.size());
+                shared_positions.push_back(ends[root]);
+            }
+            auto& piece = pieces[k / 2];
+            ((k % 2 == 0) ? piece.v0 : piece.v1) = vertex_of_root[root];
+        }
+    }
+
+    // 4. 両端の頂点が同じで、中点が互いに乗るピースを共有辺にまとめる
+    std::vector<std::vector<std::size_t>> groups;
+    {
+        std::map<std::pair<int, int>, std::vector<std::size_t>> by_ends;
+        for (std::size_t i = 0; i < pieces.size(); ++i) {
+            const auto& p = pieces[i];
+            by_ends[{std::min(p.v0, p.v1), std::max(p.v0, p.v1)}].push_back(i);
+        }
+        for (const auto& [key, members] : by_ends) {
+            for (const auto i : members) {
+                auto& master = pieces[i];
+                if (master.group >= 0) continue;
+                master.group = static_cast<int>(groups.size());
+                groups.push_back({i});
+                if (master.degenerate) continue;
+                const auto& master_face = face_data[master.face];
+                for (const auto j : members) {
+                    auto& other = pieces[j];
+                    if (other.group >= 0 || other.degenerate) continue;
+                    const auto& other_face = face_data[other.face];
+                    const auto mid = PointOn(other_face, other, 0.5 * (other.t0 + other.t1));
+                    if (!mid) continue;
+                    const auto on_master = ProjectOntoPiece(master_face, master, *mid);
+                    if (!on_master || on_master->second > tol) continue;
+                    // 向き: otherの1/4点・3/4点のmaster上での順序で判定する
+                    const auto q1 = PointOn(other_face, other, 0.75 * other.t0 + 0.25 * other.t1);
+                    const auto q3 = PointOn(other_face, other, 0.25 * other.t0 + 0.75 * other.t1);
+                    if (!q1 || !q3) continue;
+                    const auto s1 = ProjectOntoPiece(master_face, master, *q1);
+                    const auto s3 = ProjectOntoPiece(master_face, master, *q3);
+                    if (!s1 || !s3) continue;
+                    other.group = master.group;
+                    other.reversed = s1->first > s3->first;
+                    groups.back().push_back(j);
+                }
+            }
+        }
+    }
+
+    // 5. 共有辺を代表のピースで離散化し、他のピースへ射影する
+    {
+        std::vector<std::vector<double>> master_params(groups.size());
+        igesio::ParallelFor(groups.size(), [&](const std::size_t g) {
+            const auto& master = pieces[groups[g][0]];
+            master_params[g] = DiscretizePiece(face_data[master.face], master, params);
+        });
+        for (std::size_t g = 0; g < groups.size(); ++g) {
+            auto& master = pieces[groups[g][0]];
+            const auto& ts = master_params[g];
+            master.params = ts;
+            master.vertices.assign(ts.size(), master.v0);
+            master.vertices.back() = master.v1;
+            for (std::size_t k = 1; k + 1 < ts.size(); ++k) {
+                const auto p = PointOn(face_data[master.face], master, ts[k]);
+                master.vertices[k] = static_cast<int>(shared_positions.size());
+                shared_positions.push_back(p ? *p : master.p0);
+            }
+        }
+        igesio::ParallelFor(pieces.size(), [&](const std::size_t i) {
+            auto& piece = pieces[i];
+            const auto& master = pieces[groups[piece.group][0]];
+            if (&piece == &master) return;
+            const std::size_t n = master.vertices.size();
+            piece.vertices = master.vertices;
+            if (piece.reversed) std::reverse(piece.vertices.begin(), piece.vertices.end());
+            piece.params.assign(n, piece.t0);
+            piece.params.back() = piece.t1;
+            for (std::size_t k = 1; k + 1 < n; ++k) {
+                const double fallback = piece.t0 + (piece.t1 - piece.t0) * k / (n - 1);
+                const auto projection = ProjectOntoPiece(
+                        face_data[piece.face], piece,
+                        shared_positions[piece.vertices[k]]);
+                double t = projection ? projection->first : fallback;
+                // 射影の誤差で順序が入れ替わらないようにする
+                if (!(t > piece.params[k - 1] && t < piece.t1)) t = fallback;
+                piece.params[k] = t;
+            }
+        });
+    }
+
+    // 6. 各面を三角形分割する
+    std::vector<FaceMesh> meshes(faces.size());
+    igesio::ParallelFor(faces.size(), [&](const std::size_t f) {
+        if (face_valid[f]) meshes[f] = TessellateFace(face_data[f], pieces, params);
+    });
+
+    // 7. 1つのメッシュに統合する (参照されない頂点は除く)
+    const std::size_t n_shared = shared_positions.size();
+    std::vector<Vector3d> shared_normals(n_shared, Vector3d::Zero());
+    for (const auto& mesh : meshes) {
+        for (const auto& [vertex, normal] : mesh.shared_normals) {
+            shared_normals[vertex] += normal;
+        }
+    }
+    std::vector<Vector3d> positions, normals;
+    std::vector<int> shared_index(n_shared, -1);
+    numerics::TriangleMeshf result;
+    for (std::size_t f = 0; f < meshes.size(); ++f) {
+        const auto& mesh = meshes[f];
+        std::vector<int> local_index(mesh.positions.size(), -1);
+        const auto resolve = [&](const int ref) {
+            int& index = (ref >= 0) ? shared_index[ref] : local_index[-ref - 1];
+            if (index < 0) {
+                index = static_cast<int>(positions.size());
+                if (ref >= 0) {
+                    positions.push_back(shared_positions[ref]);
+                    normals.push_back(shared_normals[ref]);
+                } else {
+                    positions.push_back(mesh.positions[-ref - 1]);
+                    normals.push_back(mesh.normals[-ref - 1]);
+                }
+            }
+            return static_cast<std::uint32_t>(index);
+        };
+        numerics::MeshGroup group;
+        group.first_triangle = static_cast<std::uint32_t>(result.indices.size() / 3);
+        group.triangle_count = static_cast<std::uint32_t>(mesh.triangles.size());
+        for (const auto& tri : mesh.triangles) {
+            for (const int ref : tri) result.indices.push_back(resolve(ref));
+        }
+        result.groups.push_back(std::move(group));
+    }
+
+    // 法線が定まらない頂点 (特異点等) は、隣接する三角形の法線の面積重み平均とする
+    std::vector<Vector3d> fallback(positions.size(), Vector3d::Zero());
+    for (std::size_t k = 0; k + 2 < result.indices.size(); k += 3) {
+        const auto& a = positions[result.indices[k]];
+        const auto& b = positions[result.indices[k + 1]];
+        const auto& c = positions[result.indices[k + 2]];
+        const Vector3d n = (b - a).cross(c - a);
+        for (int m = 0; m < 3; ++m) fallback[result.indices[k + m]] += n;
+    }
+    result.positions.resize(3, static_cast<Eigen::Index>(positions.size()));
+    result.normals.resize(3, static_cast<Eigen::Index>(positions.size()));
+    for (std::size_t k = 0; k < positions.size(); ++k) {
+        Vector3d n = normals[k];
+        if (n.norm() <= 1e-12) n = fallback[k];
+        const double len = n.norm();
+        result.positions.col(k) = positions[k].cast<float>();
+        result.normals.col(k) = ((len > 1e-12) ? Vector3d(n / len)
+                                               : Vector3d::UnitZ()).cast<float>();
+    }
+    return result;
+}
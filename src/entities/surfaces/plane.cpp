@@ -273,9 +273,8 @@ PlaneFrame BoundedPlane::GetFrame() const {
 }
 
 void BoundedPlane::InvalidateGeometryCaches() const noexcept {
-    base_surface_.reset();
-    uv_boundary_.reset();
-    defined_bbox_.reset();
+    base_surface_.Reset();
+    boundary_cache_.Reset();
     InvalidateDomainCache();
 }
 
@@ -385,21 +384,20 @@ void BoundedPlane::PrepareGeometryCache() const {
 }
 
 std::shared_ptr<const i_ent::ISurface> BoundedPlane::GetBaseSurface() const {
-    if (!base_surface_) {
-        if (i_num::IsApproxZero(Vector3d(coefficients_[0], coefficients_[1],
-                                         coefficients_[2]).norm())) {
-            return nullptr;
-        }
-        base_surface_ = std::make_shared<Plane>(
+    if (i_num::IsApproxZero(Vector3d(coefficients_[0], coefficients_[1],
+                                     coefficients_[2]).norm())) {
+        return nullptr;
+    }
+    return *base_surface_.Get([this]() {
+        return std::make_shared<const Plane>(
                 coefficients_[0], coefficients_[1],
                 coefficients_[2], coefficients_[3]);
-    }
-    return base_surface_;
+    });
 }
 
 std::shared_ptr<const i_ent::ICurve> BoundedPlane::GetOuterUVBoundary() const {
-    EnsureBoundaryCache();
-    return uv_boundary_;
+    const auto cache = EnsureBoundaryCache();
+    return cache ? cache->uv_boundary : nullptr;
 }
 
 std::shared_ptr<const i_ent::ICurve>
@@ -410,22 +408,30 @@ BoundedPlane::GetInnerUVBoundaryAt(std::size_t index) const {
 }
 
 i_num::BoundingBox BoundedPlane::GetDefinedBoundingBox() const {
-    EnsureBoundaryCache();
-    if (defined_bbox_) return *defined_bbox_;
+    const auto cache = EnsureBoundaryCache();
+    if (cache && cache->defined_bbox) return *cache->defined_bbox;
     // 境界未解決時は基底曲面 (無限平面) のbboxにフォールバック
     auto base = GetBaseSurface();
     if (base) return base->GetDefinedBoundingBox();
     return i_num::BoundingBox();
 }
 
-void BoundedPlane::EnsureBoundaryCache() const {
-    if (uv_boundary_) return;
-
+std::shared_ptr<const BoundedPlane::BoundaryCache>
+BoundedPlane::EnsureBoundaryCache() const {
+    // 境界未解決の場合はキャッシュせず、解決後 (InvalidateGeometryCaches) に構築する
     auto boundary = boundary_.TryGetEntity<ICurve>();
-    if (!boundary) return;  // 境界未解決
+    if (!boundary) return nullptr;
+    return boundary_cache_.Get([this, &boundary]() {
+        return ComputeBoundaryCache(*boundary.value());
+    });
+}
+
+BoundedPlane::BoundaryCache
+BoundedPlane::ComputeBoundaryCache(const ICurve& boundary) const {
+    BoundaryCache cache;
     if (i_num::IsApproxZero(Vector3d(coefficients_[0], coefficients_[1],
                                      coefficients_[2]).norm())) {
-        return;  // 退化した平面
+        return cache;  // 退化した平面
     }
     const PlaneFrame f = GetFrame();
 
@@ -433,17 +439,17 @@ void BoundedPlane::EnsureBoundaryCache() const {
     const auto origin_m = Transform(std::optional<Vector3d>(f.origin), true);
     const auto eu_m = Transform(std::optional<Vector3d>(f.e_u), false);
     const auto ev_m = Transform(std::optional<Vector3d>(f.e_v), false);
-    if (!origin_m || !eu_m || !ev_m) return;
+    if (!origin_m || !eu_m || !ev_m) return cache;
 
     // 境界曲線をモデル空間で折れ線近似する
-    const double eps = ComputeChordTolerance(*boundary.value());
+    const double eps = ComputeChordTolerance(boundary);
     i_num::PolygonData poly;
     try {
-        poly = ComputeApproximatePolygon(*boundary.value(), {}, {}, eps);
+        poly = ComputeApproximatePolygon(boundary, {}, {}, eps);
     } catch (const std::exception&) {
-        return;
+        return cache;
     }
-    if (poly.vertices.size() < 2) return;
+    if (poly.vertices.size() < 2) return cache;
 
     // 各サンプルをモデル空間フレームへ内積射影して(u, v)化する
     std::vector<Vector2d> uv;
@@ -462,12 +468,12 @@ void BoundedPlane::EnsureBoundaryCache() const {
         uv.pop_back();
         def_points.pop_back();
     }
-    if (uv.size() < 2) return;
+    if (uv.size() < 2) return cache;
 
     try {
-        uv_boundary_ = MakeLinearPath(uv, /*is_closed=*/true);
+        cache.uv_boundary = MakeLinearPath(uv, /*is_closed=*/true);
     } catch (const std::exception&) {
-        return;
+        return cache;
     }
 
     // 定義空間点群の軸平行bbox
@@ -477,7 +483,8 @@ void BoundedPlane::EnsureBoundaryCache() const {
         mn = mn.cwiseMin(p);
         mx = mx.cwiseMax(p);
     }
-    defined_bbox_ = i_num::BoundingBox(mn, mx);
+    cache.defined_bbox = i_num::BoundingBox(mn, mx);
+    return cache;
 }
 
 std::shared_ptr<const i_ent::ICurve> BoundedPlane::GetBoundaryCurve() const {
@@ -18,6 +18,7 @@
 #include "igesio/numerics/core/tolerance.h"
 #include "igesio/numerics/core/combinatorics.h"
 #include "./../curves/nurbs_basis_function.h"
+#include "./../curves/nurbs_conversion.h"
 
 namespace {
 
@@ -1057,6 +1058,23 @@ void RationalBSplineSurface::UpdateClosedness() {
 
 
 
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<i_ent::RationalBSplineSurface>
+RationalBSplineSurface::ConvertToNurbs() const {
+    const auto [n_u, n_v] = NumControlPoints();
+    auto surface = std::make_shared<RationalBSplineSurface>(
+            n_u - 1, n_v - 1, degrees_.first, degrees_.second,
+            u_knots_, v_knots_, weights_, control_points_,
+            parameter_range_, is_u_periodic_, is_v_periodic_);
+    surface->SetSurfaceType(GetSurfaceType());
+    return surface;
+}
+
+
+
 /**
  * ファクトリ関数
  */
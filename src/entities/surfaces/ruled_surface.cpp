@@ -7,8 +7,10 @@
  */
 #include "igesio/entities/surfaces/ruled_surface.h"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
@@ -17,6 +19,7 @@
 
 #include "igesio/common/errors.h"
 #include "igesio/numerics/core/tolerance.h"
+#include "./../curves/nurbs_conversion.h"
 
 namespace {
 
@@ -41,6 +44,42 @@ igesio::ObjectID GetCurveID(const std::shared_ptr<i_ent::ICurve>& curve,
     return curve->GetID();
 }
 
+/// @brief NURBS変換時に母線の対応を確認する、各区間内の位置 (区間長に対する比)
+constexpr double kRulingCheckRatios[] = {0.25, 0.5, 0.75};
+/// @brief 曲線上の点に対応するパラメータを求める際の最大反復回数
+constexpr int kMaxPointInversionIterations = 50;
+
+/// @brief 2点が (座標値の大きさに対して相対的に) 一致するか
+bool IsSamePoint(const Vector3d& a, const Vector3d& b) {
+    const double scale = 1.0 + std::max(a.norm(), b.norm());
+    return (a - b).norm() <= i_num::kGeometryTolerance * scale;
+}
+
+/// @brief 曲線上の点 P に対応するパラメータ t (C(t) = P) を求める
+/// @param curve 曲線 (モデル空間で評価する)
+/// @param point 曲線上の点 P
+/// @param t_init 初期値
+/// @return C(t) = P となるパラメータ. 収束しない・Pが曲線上にない場合は`std::nullopt`
+/// @note f(t) = C'(t)·(C(t) - P) = 0 をニュートン法で解く
+std::optional<double> FindParameterOfPoint(
+        const i_ent::ICurve& curve, const Vector3d& point, const double t_init) {
+    const auto [t_min, t_max] = curve.GetParameterRange();
+    double t = t_init;
+    for (int i = 0; i < kMaxPointInversionIterations; ++i) {
+        const auto d = curve.TryGetDerivatives(t, 2);
+        if (!d) return std::nullopt;
+        const Vector3d diff = (*d)[0] - point;
+        const double df = (*d)[2].dot(diff) + (*d)[1].squaredNorm();
+        if (df <= 0.0) break;
+        const double step = (*d)[1].dot(diff) / df;
+        t = std::clamp(t - step, t_min, t_max);
+        if (std::abs(step) <= i_num::kParameterTolerance * (1.0 + std::abs(t))) break;
+    }
+    const auto p = curve.TryGetPointAt(t);
+    if (!p || !IsSamePoint(*p, point)) return std::nullopt;
+    return t;
+}
+
 }  // namespace
 
 
@@ -414,6 +453,71 @@ std::pair<double, double> RuledSurface::GetParametersTS(const double u) const {
 
 
 
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<i_ent::RationalBSplineSurface> RuledSurface::ConvertToNurbs() const {
+    if (!curve1_.IsPointerSet() || !curve2_.IsPointerSet()) return nullptr;
+    const auto curve1 = GetCurve1();
+    const auto curve2 = GetCurve2();
+    const auto bezier1 = i_ent::detail::ModelSpaceBezier(*curve1);
+    const auto bezier2 = i_ent::detail::ModelSpaceBezier(*curve2);
+    if (!bezier1 || !bezier2) return nullptr;
+
+    // u方向: C1はt = t_min + uΔt、C2はs = s_min + uΔs (反転時はs_max - uΔs) に対応
+    const auto [umin, umax, vmin, vmax] = GetParameterRange();
+    auto b1 = i_ent::detail::Reparameterize(*bezier1, umin, umax);
+    auto b2 = is_reversed_ ? i_ent::detail::Reparameterize(*bezier2, umax, umin)
+                           : i_ent::detail::Reparameterize(*bezier2, umin, umax);
+
+    // 次数と区間を揃える
+    const auto degree = std::max(b1.degree, b2.degree);
+    b1 = i_ent::detail::ElevateDegree(b1, degree);
+    b2 = i_ent::detail::ElevateDegree(b2, degree);
+    const auto breakpoints1 = b1.breakpoints;
+    b1 = i_ent::detail::Refine(b1, b2.breakpoints);
+    b2 = i_ent::detail::Refine(b2, breakpoints1);
+    if (b1.breakpoints.size() != b2.breakpoints.size()) return nullptr;
+    b2.breakpoints = b1.breakpoints;
+
+    // 同一パラメータの2点が元の曲面の同じ母線 (同じu) 上にあることを確認する
+    auto [tmin, tmax] = curve1->GetParameterRange();
+    for (size_t i = 0; i + 1 < b1.breakpoints.size(); ++i) {
+        for (const double ratio : kRulingCheckRatios) {
+            const double xi = b1.breakpoints[i]
+                            + ratio * (b1.breakpoints[i + 1] - b1.breakpoints[i]);
+            const Vector3d p1 = i_ent::detail::Evaluate(b1, xi);
+            const Vector3d p2 = i_ent::detail::Evaluate(b2, xi);
+            const auto t = FindParameterOfPoint(
+                    *curve1, p1, tmin + (xi - umin) / (umax - umin) * (tmax - tmin));
+            if (!t) return nullptr;
+            const double u = umin + (*t - tmin) / (tmax - tmin) * (umax - umin);
+            const auto q2 = curve2->TryGetPointAt(GetParametersTS(u).second);
+            if (!q2 || !IsSamePoint(*q2, p2)) return nullptr;
+        }
+    }
+
+    const auto u_nurbs1 = i_ent::detail::Assemble(b1);
+    const auto u_nurbs2 = i_ent::detail::Assemble(b2);
+    if (!u_nurbs1 || !u_nurbs2) return nullptr;
+
+    // v方向: S(u, v) = (1 - v) C1 + v C2 の1次式
+    i_ent::detail::HomogeneousNurbs v_nurbs;
+    v_nurbs.degree = 1;
+    v_nurbs.knots = {vmin, vmin, vmax, vmax};
+    std::vector<std::vector<igesio::Vector4d>> points;
+    for (size_t i = 0; i < u_nurbs1->points.size(); ++i) {
+        points.push_back({u_nurbs1->points[i], u_nurbs2->points[i]});
+    }
+
+    auto surface = i_ent::detail::MakeSurface(*u_nurbs1, v_nurbs, points);
+    surface->SetSurfaceType(i_ent::RationalBSplineSurfaceType::kRuledSurface);
+    return surface;
+}
+
+
+
 /**
  * ファクトリ関数
  */
@@ -17,6 +17,7 @@
 
 #include "igesio/numerics/core/tolerance.h"
 #include "igesio/entities/curves/algorithms.h"
+#include "./../curves/nurbs_conversion.h"
 
 namespace {
 
@@ -501,6 +502,49 @@ std::shared_ptr<const i_ent::ICurve> SurfaceOfRevolution::GetGeneratrix() const
 
 
 
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<i_ent::RationalBSplineSurface>
+SurfaceOfRevolution::ConvertToNurbs() const {
+    if (!HasAxis() || !HasGeneratrix()) return nullptr;
+
+    // u方向: モデル空間の母線、v方向: 回転角 [v_min, v_max] の単位円弧
+    const auto generatrix = i_ent::detail::ModelSpaceBezier(*GetGeneratrix());
+    if (!generatrix) return nullptr;
+    const auto [umin, umax, vmin, vmax] = GetParameterRange();
+    const auto u_nurbs = i_ent::detail::Assemble(*generatrix);
+    const auto v_nurbs = i_ent::detail::Assemble(
+            i_ent::detail::MakeUnitArc(vmin, vmax));
+    if (!u_nurbs || !v_nurbs) return nullptr;
+
+    // 母線の制御点Pを軸まわりに回転させる. Pの軸への射影をO、X = P - O、
+    // Y = D × X とすると、円弧の制御点 (c, s, W) に対応する制御点は
+    // O + (c X + s Y) / W、重みは w_P W となる
+    const auto& [P0, end_point] = GetAxis()->GetAnchorPoints();
+    const Vector3d D = (end_point - P0).normalized();
+    std::vector<std::vector<igesio::Vector4d>> points(u_nurbs->points.size());
+    for (size_t i = 0; i < u_nurbs->points.size(); ++i) {
+        const auto& pw = u_nurbs->points[i];
+        const double w = pw(3);
+        const Vector3d P{pw(0) / w, pw(1) / w, pw(2) / w};
+        const Vector3d O = P0 + D * D.dot(P - P0);
+        const Vector3d X = P - O;
+        const Vector3d Y = D.cross(X);
+        for (const auto& arc : v_nurbs->points) {
+            const Vector3d q = arc(3) * O + arc(0) * X + arc(1) * Y;
+            points[i].push_back(w * igesio::Vector4d{q(0), q(1), q(2), arc(3)});
+        }
+    }
+
+    auto surface = i_ent::detail::MakeSurface(*u_nurbs, *v_nurbs, points);
+    surface->SetSurfaceType(i_ent::RationalBSplineSurfaceType::kSurfaceOfRevolution);
+    return surface;
+}
+
+
+
 /**
  * ファクトリ関数
  */
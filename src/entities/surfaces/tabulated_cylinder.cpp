@@ -19,6 +19,7 @@
 
 #include "igesio/common/errors.h"
 #include "igesio/numerics/core/tolerance.h"
+#include "./../curves/nurbs_conversion.h"
 
 namespace {
 
@@ -459,6 +460,44 @@ double TabulatedCylinder::GetDirectrixParameterAtU(const double u) const {
 
 
 
+/**
+ * NURBS変換
+ */
+
+std::shared_ptr<i_ent::RationalBSplineSurface>
+TabulatedCylinder::ConvertToNurbs() const {
+    if (!directrix_.IsPointerSet()) return nullptr;
+
+    // u方向: t = t_min + u(t_max - t_min) に合わせてモデル空間の準線を再パラメータ化
+    const auto directrix = i_ent::detail::ModelSpaceBezier(*GetDirectrix());
+    if (!directrix) return nullptr;
+    const auto [umin, umax, vmin, vmax] = GetParameterRange();
+    const auto u_nurbs = i_ent::detail::Assemble(
+            i_ent::detail::Reparameterize(*directrix, umin, umax));
+    if (!u_nurbs) return nullptr;
+
+    // v方向: S(u, v) = C(t) + v D の1次式
+    i_ent::detail::HomogeneousNurbs v_nurbs;
+    v_nurbs.degree = 1;
+    v_nurbs.knots = {vmin, vmin, vmax, vmax};
+    const Vector3d D = GetDirection();
+    std::vector<std::vector<igesio::Vector4d>> points;
+    for (const auto& pw : u_nurbs->points) {
+        std::vector<igesio::Vector4d> row;
+        for (const double v : {vmin, vmax}) {
+            const Vector3d offset = pw(3) * v * D;
+            row.push_back(pw + igesio::Vector4d{offset(0), offset(1), offset(2), 0.0});
+        }
+        points.push_back(std::move(row));
+    }
+
+    auto surface = i_ent::detail::MakeSurface(*u_nurbs, v_nurbs, points);
+    surface->SetSurfaceType(i_ent::RationalBSplineSurfaceType::kTabulatedCylinder);
+    return surface;
+}
+
+
+
 /**
  * ファクトリ関数
  */
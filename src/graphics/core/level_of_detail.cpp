@@ -0,0 +1,125 @@
+/**
+ * @file graphics/core/level_of_detail.cpp
+ * @brief 面メッシュの詳細度 (LOD) の構築と、画面上の大きさによる選択
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/graphics/core/level_of_detail.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "igesio/numerics/meshes/algorithms/reordering.h"
+#include "igesio/graphics/core/mesh_staging.h"
+
+namespace {
+
+namespace i_graph = igesio::graphics;
+using igesio::Vector3d;
+using igesio::Vector4d;
+
+/// @brief 画面上の誤差が上限以下となる最も粗いレベルを返す
+/// @note 最も細かいレベルでも上限を超える場合は0を返す
+std::size_t CoarsestWithin(const std::vector<i_graph::LodLevel>& levels,
+                           const double projected_size, const double max_error) {
+    std::size_t result = 0;
+    for (std::size_t k = 0; k < levels.size(); ++k) {
+        if (levels[k].relative_error * projected_size <= max_error) result = k;
+    }
+    return result;
+}
+
+}  // namespace
+
+
+
+void i_graph::AppendLodLevel(
+        LodMeshStaging& staging, const numerics::TriangleMeshf& mesh,
+        const double relative_error) {
+    // 粗い許容量でも三角形が減らない (平面等) 場合は、細かいレベルで兼ねる
+    if (!staging.levels.empty()
+            && mesh.indices.size() >= staging.levels.back().index_count) {
+        staging.levels.back().relative_error = relative_error;
+        return;
+    }
+
+    // 生成順のメッシュを頂点キャッシュ・頂点フェッチの局所性の高い順へ並べ替える
+    auto optimized = mesh;
+    numerics::OptimizeForRendering(optimized);
+
+    const std::size_t vertex_offset = staging.vertices.size() / 8;
+    const auto vertices = BuildInterleavedVertices(optimized);
+    staging.vertices.insert(staging.vertices.end(), vertices.begin(), vertices.end());
+
+    LodLevel level;
+    level.index_offset = staging.indices.size();
+    level.index_count = optimized.indices.size();
+    level.relative_error = relative_error;
+    for (const auto index : optimized.indices) {
+        staging.indices.push_back(static_cast<gl::Uint>(index + vertex_offset));
+    }
+
+    // 外接球は最も細かいレベル (最初のレベル) の軸平行BBから求める
+    if (staging.levels.empty() && mesh.VertexCount() > 0) {
+        const Vector3d lower = mesh.positions.rowwise().minCoeff().cast<double>();
+        const Vector3d upper = mesh.positions.rowwise().maxCoeff().cast<double>();
+        staging.center = 0.5 * (lower + upper);
+        staging.radius = 0.5 * (upper - lower).norm();
+    }
+    staging.levels.push_back(level);
+}
+
+void i_graph::LodDrawState::Select(
+        const LodView& view, const Matrix4d& world_transform) {
+    current = SelectLodLevel(
+            levels, EstimateProjectedSize(view, world_transform, center, radius),
+            current, view.params);
+}
+
+double i_graph::EstimateProjectedSize(
+        const LodView& view, const Matrix4d& world_transform,
+        const Vector3d& center, const double radius) {
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+
+    // ワールド座標系での中心と半径 (変換の最大の拡大率を半径に掛ける)
+    const Vector4d c = world_transform * Vector4d(center.x(), center.y(), center.z(), 1.0);
+    double scale = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        scale = std::max(scale, world_transform.block<3, 1>(0, i).norm());
+    }
+    const double r = radius * scale;
+
+    // クリップ座標のwは、透視投影では視点からの奥行き、平行投影では1となる
+    const Vector4d eye = view.view.cast<double>() * Vector4d(c.x(), c.y(), c.z(), 1.0);
+    const Matrix4d projection = view.projection.cast<double>();
+    const double w = projection.row(3).dot(eye);
+    const double w_near = std::abs(projection.row(3).dot(
+            Vector4d(0.0, 0.0, -r, 0.0)));
+    // 視点が外接球の内側 (または背後) にある場合は最も細かいレベルとする
+    if (!(w > w_near) || !std::isfinite(w)) return kInf;
+
+    // 正規化デバイス座標の高さ2がビューポートの高さに対応する
+    return r * std::abs(projection(1, 1)) / w * view.viewport_height;
+}
+
+std::size_t i_graph::SelectLodLevel(
+        const std::vector<LodLevel>& levels, const double projected_size,
+        const std::size_t current, const LodSelectionParams& params) {
+    if (levels.empty() || !params.enabled) return 0;
+    if (!std::isfinite(projected_size)) return 0;
+    const std::size_t level = std::min(current, levels.size() - 1);
+    const double h = 1.0 + std::max(0.0, params.hysteresis);
+
+    // 粗いレベルへは、誤差が許容量より十分小さくなってから切り替える
+    const std::size_t coarser =
+            CoarsestWithin(levels, projected_size, params.max_screen_error / h);
+    if (coarser > level) return coarser;
+
+    // 細かいレベルへは、現在のレベルの誤差が許容量を十分超えてから切り替える
+    if (levels[level].relative_error * projected_size > params.max_screen_error * h) {
+        return CoarsestWithin(levels, projected_size, params.max_screen_error);
+    }
+    return level;
+}
@@ -39,6 +39,7 @@ static_assert(gl::kLineStrip == GL_LINE_STRIP, "gl::kLineStrip mismatch");
 static_assert(gl::kTriangles == GL_TRIANGLES, "gl::kTriangles mismatch");
 static_assert(gl::kPatches == GL_PATCHES, "gl::kPatches mismatch");
 static_assert(gl::kUnsignedByte == GL_UNSIGNED_BYTE, "gl::kUnsignedByte mismatch");
+static_assert(gl::kUnsignedShort == GL_UNSIGNED_SHORT, "gl::kUnsignedShort mismatch");
 static_assert(gl::kUnsignedInt == GL_UNSIGNED_INT, "gl::kUnsignedInt mismatch");
 static_assert(gl::kFloat == GL_FLOAT, "gl::kFloat mismatch");
 static_assert(gl::kRgb == GL_RGB, "gl::kRgb mismatch");
@@ -14,7 +14,7 @@
 #include <vector>
 
 #include "igesio/numerics/meshes/algorithms/edges.h"
-#include "igesio/numerics/meshes/algorithms/mesh_line_intersection.h"
+#include "igesio/numerics/meshes/algorithms/mesh_bvh.h"
 #include "igesio/entities/meshes/mesh_entity.h"
 
 namespace {
@@ -48,9 +48,9 @@ std::vector<Vector3d> TransformMeshVertices(
 /// @param ray ワールド空間のレイ (direction正規化済み)
 /// @param params 探索制御パラメータ (dedup_tolのみ使用する)
 /// @return 交差点のリスト (distance昇順). 変換行列が非可逆の場合は空リスト
-/// @note レイをローカル空間へ逆変換して全三角形と判定し、交点をワールドへ
-///       戻す. 距離はワールド空間で再計算するため、非一様スケールを含む
-///       変換でも正しい距離を返す
+/// @note レイをローカル空間へ逆変換してメッシュのBVH (MeshEntity::GetBvh)
+///       で判定し、交点をワールドへ戻す. 距離はワールド空間で再計算するため、
+///       非一様スケールを含む変換でも正しい距離を返す
 std::vector<i_graph::RayHit> IntersectMeshEntity(
         const i_ent::MeshEntity& entity, const Matrix4d& world_transform,
         const i_graph::Ray& ray, const i_graph::RayIntersectionParams& params) {
@@ -65,7 +65,8 @@ std::vector<i_graph::RayHit> IntersectMeshEntity(
     i_num::MeshIntersectionParams mesh_params;
     mesh_params.dedup_tol = params.dedup_tol;
     const auto local_hits = i_num::IntersectMeshWithLine(
-            entity.Mesh(), origin_local, origin_local + direction_local,
+            entity.Mesh(), entity.GetBvh(),
+            origin_local, origin_local + direction_local,
             i_num::BoundingBox::DirectionType::kRay, mesh_params);
 
     // ローカルのt昇順はワールドの距離昇順と一致する (同一レイ上の単調変換のため)
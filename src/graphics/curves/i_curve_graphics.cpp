@@ -13,6 +13,8 @@
 #include <utility>
 #include <vector>
 
+#include "igesio/graphics/surfaces/surface_mesh.h"  // GetDisplayTessellationTolerance
+
 namespace {
 
 using ICurveGraphics = igesio::graphics::ICurveGraphics;
@@ -98,17 +100,16 @@ void ICurveGraphics::DoSynchronize() {
     if (std::isinf(t_start)) t_start = -kInfiniteParamClamp;
     if (std::isinf(t_end))   t_end = kInfiniteParamClamp;
 
-    unsigned int segments = 50;  // TODO: GUIによるtessellationを設定可能にする
-    if (segments == 0) segments = 1;
-
-    for (unsigned int i = 0; i <= segments; ++i) {
-        double t = t_start + (t_end - t_start) * static_cast<double>(i) / segments;
-        auto point_opt = entity_->TryGetPointAt(t);
-
-        if (point_opt) {
-            vertices.push_back(static_cast<float>((*point_opt)[0]));
-            vertices.push_back(static_cast<float>((*point_opt)[1]));
-            vertices.push_back(static_cast<float>((*point_opt)[2]));
+    // 許容量に基づき折れ線化する. 評価できない点で分かれた折れ線は、
+    // 評価できた点のみを繋いだ1本の線として描画する
+    entities::CurveDiscretizationParams params;
+    params.tolerance = GetDisplayCurveTolerance(*entity_);
+    for (const auto& polyline :
+            entities::DiscretizeCurve(*entity_, {t_start, t_end}, params)) {
+        for (const auto& p : polyline.points) {
+            vertices.push_back(static_cast<float>(p[0]));
+            vertices.push_back(static_cast<float>(p[1]));
+            vertices.push_back(static_cast<float>(p[2]));
         }
     }
 
@@ -133,3 +134,14 @@ void ICurveGraphics::DoSynchronize() {
     gl_->BindBuffer(gl::kArrayBuffer, 0);
     gl_->BindVertexArray(0);
 }
+
+
+
+/**
+ * 描画用の許容量
+ */
+
+igesio::entities::TessellationTolerance igesio::graphics::GetDisplayCurveTolerance(
+        const entities::ICurve& curve) {
+    return GetDisplayTessellationTolerance(curve.GetBoundingBox());
+}
@@ -94,25 +94,24 @@ void i_graph::TriangleMeshGraphics::PrewarmCpu() {
     if (staged_ && staged_geometry_key_ == CurrentGeometryKey()) return;
 
     const auto& mesh = entity_->Mesh();
+    // 法線の補完とエッジ抽出で隣接関係を共有する (並べ替え前のmeshから構築する)
+    const auto adjacency = i_num::BuildMeshAdjacency(mesh);
 
-    // 法線が無い場合は面積重み平均で補う (コピーに対して計算する.
-    // entity_は読み取り専用のため書き戻さない)
-    i_num::TriangleMeshd recomputed;
-    const i_num::TriangleMeshd* source = &mesh;
-    if (!mesh.HasNormals()) {
-        recomputed = mesh;
-        i_num::RecomputeNormals(recomputed);
-        source = &recomputed;
-    }
+    // 法線の補完・並べ替えはコピーに対して行う (entity_は読み取り専用のため
+    // 書き戻さない). 法線が無い場合は面積重み平均で補う
+    i_num::TriangleMeshd staged = mesh;
+    if (!staged.HasNormals()) i_num::RecomputeNormals(staged, adjacency);
+    // 読み込み順のメッシュを、頂点キャッシュ・頂点フェッチの局所性の高い順へ並べ替える
+    i_num::OptimizeForRendering(staged);
 
     // 汎用曲面シェーダーのレイアウト (位置3+法線3+UV2) へinterleaveする.
     // GPU境界のためここで単精度へ変換する (CPU正準値はdoubleのまま)
-    staging_vertices_ = BuildInterleavedVertices(*source);
-    staging_indices_.assign(source->indices.begin(), source->indices.end());
+    staging_vertices_ = BuildInterleavedVertices(staged);
+    staging_indices_ = PackIndices(staged.indices, staged.VertexCount());
 
     // エッジ抽出 (kWireFrame用の全エッジとkShaded用の特徴エッジ.
     // 面法線は頂点位置から計算されるため、法線補完前のmeshで良い)
-    const auto edges = i_num::ExtractMeshEdges(mesh, kCreaseAngleCos);
+    const auto edges = i_num::ExtractMeshEdges(mesh, adjacency, kCreaseAngleCos);
     staging_all_edges_ = FlattenEdgeSegments(mesh.positions, edges.all_edges);
     staging_feature_edges_ =
             FlattenEdgeSegments(mesh.positions, edges.feature_edges);
@@ -129,7 +128,7 @@ void i_graph::TriangleMeshGraphics::DoSynchronize() {
 
     // 未準備ならCPUステージングを構築する
     if (!staged_) PrewarmCpu();
-    if (staging_indices_.empty()) return;  // 空メッシュは描画なし
+    if (staging_indices_.count == 0) return;  // 空メッシュは描画なし
 
     // VAO, VBO, EBOを生成
     gl_->GenVertexArrays(1, &vao_);
@@ -155,12 +154,12 @@ void i_graph::TriangleMeshGraphics::DoSynchronize() {
 
     // EBOへインデックスを転送
     gl_->BindBuffer(gl::kElementArrayBuffer, ebo_);
-    gl_->BufferData(gl::kElementArrayBuffer,
-                    staging_indices_.size() * sizeof(gl::Uint),
-                    staging_indices_.data(), gl::kStaticDraw);
+    gl_->BufferData(gl::kElementArrayBuffer, staging_indices_.bytes.size(),
+                    staging_indices_.bytes.data(), gl::kStaticDraw);
 
     gl_->BindVertexArray(0);
-    index_count_ = static_cast<int>(staging_indices_.size());
+    index_count_ = static_cast<int>(staging_indices_.count);
+    index_type_ = staging_indices_.type;
 
     // エッジ線分バッファを転送 (kWireFrame=全エッジ / kShaded=特徴エッジ.
     // 特徴エッジが無い場合は空のままとなり、Draw側のIsEmptyで描画されない)
@@ -173,7 +172,7 @@ void i_graph::TriangleMeshGraphics::DrawImpl(
         [[maybe_unused]] const std::pair<float, float>& viewport) const {
     if (vao_ == 0 || index_count_ <= 0) return;  // 未転送・空メッシュの自衛
     gl_->BindVertexArray(vao_);
-    gl_->DrawElements(gl::kTriangles, index_count_, gl::kUnsignedInt, 0);
+    gl_->DrawElements(gl::kTriangles, index_count_, index_type_, 0);
     gl_->BindVertexArray(0);
 }
 
@@ -8,6 +8,9 @@
 #include "igesio/graphics/renderer.h"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -22,6 +25,7 @@
 namespace {
 
 namespace i_graph = igesio::graphics;
+namespace i_num = igesio::numerics;
 namespace gl = igesio::graphics::gl;
 using EntityRenderer = igesio::graphics::EntityRenderer;
 
@@ -195,6 +199,59 @@ bool MayOverlapRect(const std::optional<igesio::numerics::BoundingBox>& bb,
              y_max < rect.y_min || y_min > rect.y_max);
 }
 
+/// @brief スクリーン矩形を通る視錐台 (BVHノードの粗カリング用)
+/// @note 矩形の4辺・near面・カメラ平面の6平面を、クリップ空間の不等式
+///       (例: x_c >= x_ndc_min * w_c) をワールド座標の同次線形式に書き直して
+///       保持する. ClipToPixelで射影でき矩形内に入る点は全平面の非負側にあるため、
+///       いずれかの平面の負側に完全に含まれるボックスは判定から除外してよい
+class RectFrustum {
+ public:
+    /// @brief コンストラクタ
+    /// @param vp VP行列
+    /// @param rect スクリーン矩形 [px]
+    /// @param w ビューポートの幅 [px]
+    /// @param h ビューポートの高さ [px]
+    RectFrustum(const igesio::Matrix4d& vp, const i_graph::ScreenRect& rect,
+                const int w, const int h) {
+        // 矩形をNDCへ変換する (y軸は画面座標と逆向き)
+        const double x0 = 2.0 * rect.x_min / static_cast<double>(w) - 1.0;
+        const double x1 = 2.0 * rect.x_max / static_cast<double>(w) - 1.0;
+        const double y0 = 1.0 - 2.0 * rect.y_max / static_cast<double>(h);
+        const double y1 = 1.0 - 2.0 * rect.y_min / static_cast<double>(h);
+        for (int c = 0; c < 4; ++c) {
+            const double x = vp(0, c), y = vp(1, c), z = vp(2, c), cw = vp(3, c);
+            planes_[0][c] = x - x0 * cw;
+            planes_[1][c] = x1 * cw - x;
+            planes_[2][c] = y - y0 * cw;
+            planes_[3][c] = y1 * cw - y;
+            planes_[4][c] = z + cw;  // near面
+            planes_[5][c] = cw;      // カメラ平面
+        }
+    }
+
+    /// @brief 軸平行ボックスが視錐台と重なる可能性があるか
+    /// @param lower ボックスの最小点
+    /// @param upper ボックスの最大点
+    /// @return いずれかの平面の負側に完全に含まれる場合のみfalse
+    bool MayOverlap(const igesio::Vector3d& lower,
+                    const igesio::Vector3d& upper) const {
+        for (const auto& plane : planes_) {
+            // 平面の正側へ最も寄った頂点で判定する
+            double value = plane[3];
+            for (int axis = 0; axis < 3; ++axis) {
+                value += plane[axis] * ((plane[axis] >= 0.0) ? upper[axis]
+                                                             : lower[axis]);
+            }
+            if (value < 0.0) return false;
+        }
+        return true;
+    }
+
+ private:
+    /// @brief 各平面の係数 (a, b, c, d). a*x + b*y + c*z + d >= 0 が内側
+    std::array<std::array<double, 4>, 6> planes_{};
+};
+
 /// @brief サンプル全体が矩形内に収まるか（内包判定）
 /// @return サンプルが存在し、かつ全点が射影可能で矩形内のときtrue
 bool ContainedInRect(const i_graph::SelectionSamples& s,
@@ -348,6 +405,7 @@ void EntityRenderer::Cleanup() {
     draw_list_.clear();
     visible_list_.clear();
     local_dirty_ = true;
+    pick_bvh_dirty_ = true;
 
     // シェーダープログラムの削除
     for (auto& [shader_id, program_id] : shader_programs_) {
@@ -393,8 +451,9 @@ void EntityRenderer::EnsureSynced() {
     SweepStaleGraphics(root);
     RebuildDrawList();
     UpdateAutoClipSphere();
-    // 可視集合が変わったためバケットの再構築が必要
+    // 可視集合が変わったためバケット・ピック用BVHの再構築が必要
     draw_buckets_dirty_ = true;
+    pick_bvh_dirty_ = true;
 
     synced_revision_ = root.Revision();
     synced_root_ = root.GetID();
@@ -447,6 +506,40 @@ void EntityRenderer::PrepareCpuGeometries() {
     draw_buckets_dirty_ = true;
 }
 
+void EntityRenderer::EnsurePickBvh() {
+    // 構造が変わっていなければ、同期キーの比較で形状の変化のみを検知する
+    // (ワールド変換の変化は構造再構築 (pick_bvh_dirty_) として現れる)
+    if (!pick_bvh_dirty_ && pick_bvh_keys_.size() == visible_list_.size()) {
+        bool changed = false;
+        for (std::size_t i = 0; i < visible_list_.size() && !changed; ++i) {
+            const auto* graphics = visible_list_[i].second;
+            changed = graphics != nullptr
+                   && graphics->CurrentGeometryKey() != pick_bvh_keys_[i];
+        }
+        if (!changed) return;
+    }
+
+    // BBの計算はエンティティの遅延キャッシュを読み書きしうるため直列に行う
+    pick_bounded_.clear();
+    pick_unbounded_.clear();
+    pick_bvh_keys_.assign(visible_list_.size(), 0);
+    std::vector<igesio::Vector3d> lowers, uppers;
+    for (std::size_t i = 0; i < visible_list_.size(); ++i) {
+        const auto* graphics = visible_list_[i].second;
+        if (graphics == nullptr) continue;
+        pick_bvh_keys_[i] = graphics->CurrentGeometryKey();
+        if (const auto bounds = graphics->GetWorldAxisAlignedBounds()) {
+            pick_bounded_.push_back(i);
+            lowers.push_back(bounds->first);
+            uppers.push_back(bounds->second);
+        } else {
+            pick_unbounded_.push_back(i);
+        }
+    }
+    pick_bvh_ = i_num::BuildBvh(lowers, uppers);
+    pick_bvh_dirty_ = false;
+}
+
 void EntityRenderer::ResyncGeometries() {
     // GPUへの転送 (Synchronize→DoSynchronize). PrepareCpuGeometriesで前倒し済みなら
     // 即転送される. 単一GLコンテキスト前提でこのスレッドで直列に行う.
@@ -551,6 +644,9 @@ void EntityRenderer::SetSettings(const GraphicsSettings& settings) {
 
     // 表示モード (即時のGL状態変更は不要; 次回Draw時のシェーダー型フィルタで反映)
     settings_.display_mode = settings.display_mode;
+
+    // LODの選択パラメータ (次回Draw時のレベル選択で反映)
+    settings_.lod = settings.lod;
 }
 
 void EntityRenderer::EnableAntialiasing(const bool enable) {
@@ -638,6 +734,7 @@ void EntityRenderer::Draw() {
     // (全シェーダーで共通)
     const DrawContext ctx{&scene_->ActiveSelection(), kSelectionColor,
                           false, settings_.display_mode};
+    SelectLevelsOfDetail();
     ExecuteDrawList(ctx);
 }
 
@@ -752,6 +849,20 @@ void EntityRenderer::WalkAssembly(
     }
 }
 
+void EntityRenderer::SelectLevelsOfDetail() {
+    // 現在のカメラで、各描画オブジェクトが描く詳細度 (LOD) を選択する.
+    // 複合ノードは子要素へカスケードする (EntityGraphics::SelectLevelOfDetail)
+    LodView view;
+    view.view = camera_.GetViewMatrix();
+    view.projection = camera_.GetProjectionMatrix(
+        static_cast<float>(display_width_) / display_height_);
+    view.viewport_height = static_cast<float>(display_height_);
+    view.params = settings_.lod;
+    for (const auto& [id, graphics] : visible_list_) {
+        graphics->SelectLevelOfDetail(view);
+    }
+}
+
 void EntityRenderer::ExecuteDrawList(const DrawContext& ctx) {
     const auto view_matrix = camera_.GetViewMatrix();
     const auto projection_matrix = camera_.GetProjectionMatrix(
@@ -897,6 +1008,9 @@ std::vector<i_graph::EntityHit> EntityRenderer::PickEntities(
     // GPU転送は不要なためResyncGeometriesは呼ばない
     PrepareCpuGeometries();
 
+    // 広域判定用のシーンBVHを可視リスト・形状と突き合わせる
+    EnsurePickBvh();
+
     // フォールバック深度: カメラのターゲットをレイへ射影した距離
     const igesio::Vector3d target = camera_.GetTarget().cast<double>();
     const igesio::Vector3d position = camera_.GetPosition().cast<double>();
@@ -904,10 +1018,31 @@ std::vector<i_graph::EntityHit> EntityRenderer::PickEntities(
     if (fallback_depth <= 0.0) fallback_depth = (target - position).norm();
     if (fallback_depth <= 0.0) fallback_depth = 1.0;  // 最終フォールバック
 
-    // 可視リストを走査する (draw_list_は複合を複数シェーダーへ重複登録するため、
-    // エンティティ毎に一意なこちらで二重判定を避ける)
-    for (const auto& [id, object] : visible_list_) {
-        if (!object || !object->CanIntersect()) continue;
+    // 曲線はレイから許容量以内でヒットするため、BVHのボックスを許容量だけ拡大して
+    // 走査する. 許容量は深度に対して単調 (透視: 比例, 正射影: 一定) なため、
+    // シーン最遠の深度とフォールバック深度のうち大きい方での値で全エンティティを覆う
+    double padding = 0.0;
+    if (!pick_bvh_.IsEmpty()) {
+        const auto& root = pick_bvh_.nodes[0];
+        double far_depth = fallback_depth;
+        for (int corner = 0; corner < 8; ++corner) {
+            const igesio::Vector3d v((corner & 1) ? root.upper[0] : root.lower[0],
+                                     (corner & 2) ? root.upper[1] : root.lower[1],
+                                     (corner & 4) ? root.upper[2] : root.lower[2]);
+            far_depth = std::max(far_depth, (v - ray.origin).dot(ray.direction));
+        }
+        padding = i_graph::PixelToWorldSize(
+                camera_, w, h, screen_x, screen_y, far_depth,
+                params.curve_hit_pixels);
+    }
+
+    // 可視リストの1要素を狭域判定し、distance昇順・重複除去済みのヒットを返す.
+    // (draw_list_は複合を複数シェーダーへ重複登録するため、エンティティ毎に
+    //  一意な可視リストの要素単位で判定して二重判定を避ける)
+    auto intersect = [&](const std::size_t index) {
+        std::vector<EntityHit> result;
+        const auto& [id, object] = visible_list_[index];
+        if (!object || !object->CanIntersect()) return result;
 
         // 代表深度: BB中心をレイへ射影。BBが無限/未定義ならフォールバック
         double depth = fallback_depth;
@@ -927,9 +1062,60 @@ std::vector<i_graph::EntityHit> EntityRenderer::PickEntities(
                 camera_, w, h, screen_x, screen_y, depth,
                 params.curve_hit_pixels);
 
-        for (const auto& rh : object->Intersect(ray, p)) {
-            hits.push_back({id, rh});
+        auto object_hits = object->Intersect(ray, p);
+        std::sort(object_hits.begin(), object_hits.end(),
+                  [](const RayHit& a, const RayHit& b) {
+                      return a.distance < b.distance;
+                  });
+        // position近接 (dedup_tol以内) のヒットは近い方のみ残す.
+        // IDは可視リスト内で一意のため、重複の比較は同一要素内で足りる
+        for (const auto& rh : object_hits) {
+            bool duplicate = false;
+            for (const auto& kept : result) {
+                if ((kept.hit.position - rh.position).norm() < params.dedup_tol) {
+                    duplicate = true;
+                    break;
+                }
+            }
+            if (!duplicate) result.push_back({id, rh});
         }
+        return result;
+    };
+    constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+    if (params.closest_hit_only) {
+        // BVHを手前から走査し、既知の最近傍より奥の部分木を打ち切る.
+        // 範囲を持たない要素は先に判定して打ち切り距離の初期値を得る
+        std::optional<EntityHit> closest;
+        auto update = [&](const std::size_t index) {
+            const auto object_hits = intersect(index);
+            if (!object_hits.empty() && (!closest ||
+                    object_hits.front().hit.distance < closest->hit.distance)) {
+                closest = object_hits.front();
+            }
+        };
+        for (const auto index : pick_unbounded_) update(index);
+        i_num::TraverseBvh(pick_bvh_, ray.origin, ray.direction, 0.0, kInfinity,
+                           padding, [&](const std::uint32_t prim, double& t_max) {
+            update(pick_bounded_[prim]);
+            if (closest) t_max = std::min(t_max, closest->hit.distance);
+            return false;
+        });
+        if (closest) hits.push_back(*closest);
+        return hits;
+    }
+
+    // 候補 (レイと交差しうる要素+範囲を持たない要素) のみを狭域判定する.
+    // 判定順は可視リストの順とする (結果を走査順に依存させない)
+    std::vector<std::size_t> candidates = pick_unbounded_;
+    i_num::TraverseBvh(pick_bvh_, ray.origin, ray.direction, 0.0, kInfinity,
+                       padding, [&](const std::uint32_t prim, double&) {
+        candidates.push_back(pick_bounded_[prim]);
+        return false;
+    });
+    std::sort(candidates.begin(), candidates.end());
+    for (const auto index : candidates) {
+        for (auto& hit : intersect(index)) hits.push_back(std::move(hit));
     }
 
     // distance昇順にソート
@@ -937,21 +1123,7 @@ std::vector<i_graph::EntityHit> EntityRenderer::PickEntities(
               [](const EntityHit& a, const EntityHit& b) {
                   return a.hit.distance < b.hit.distance;
               });
-
-    // 同一IDかつposition近接 (dedup_tol以内) のヒットは近い方のみ残す
-    std::vector<EntityHit> deduped;
-    for (const auto& hit : hits) {
-        bool duplicate = false;
-        for (const auto& kept : deduped) {
-            if (kept.id == hit.id &&
-                (kept.hit.position - hit.hit.position).norm() < params.dedup_tol) {
-                duplicate = true;
-                break;
-            }
-        }
-        if (!duplicate) deduped.push_back(hit);
-    }
-    return deduped;
+    return hits;
 }
 
 std::vector<igesio::ObjectID> EntityRenderer::PickEntitiesInRect(
@@ -979,7 +1151,23 @@ std::vector<igesio::ObjectID> EntityRenderer::PickEntitiesInRect(
     sp.adaptive_width = w;
     sp.adaptive_height = h;
 
-    for (const auto& [id, object] : visible_list_) {
+    // シーンBVHを矩形の視錐台で枝刈りして候補を絞る (範囲を持たない要素は常に候補).
+    // 判定順は可視リストの順とする (結果を走査順に依存させない)
+    EnsurePickBvh();
+    const RectFrustum frustum(vp, rect, w, h);
+    std::vector<std::size_t> candidates = pick_unbounded_;
+    i_num::QueryBvh(pick_bvh_,
+                    [&frustum](const igesio::Vector3d& lower,
+                               const igesio::Vector3d& upper) {
+                        return frustum.MayOverlap(lower, upper);
+                    },
+                    [&](const std::uint32_t prim) {
+                        candidates.push_back(pick_bounded_[prim]);
+                    });
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto index : candidates) {
+        const auto& [id, object] = visible_list_[index];
         if (!object) continue;
 
         // 粗カリングを先に行い、範囲外エンティティのサンプリングを省く
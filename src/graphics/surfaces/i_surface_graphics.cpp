@@ -12,16 +12,12 @@
 #include <vector>
 
 #include "igesio/entities/surfaces/algorithms/surface_boundary_edges.h"
-#include "igesio/graphics/core/mesh_staging.h"
 #include "igesio/graphics/surfaces/surface_mesh.h"
 
 namespace {
 
 using igesio::graphics::ISurfaceGraphics;
 
-/// @brief u/vパラメータのデフォルト分解能数
-constexpr int kDefaultDiv = 20;
-
 }  // namespace
 
 
@@ -52,8 +48,10 @@ void ISurfaceGraphics::DrawImpl(
         gl::Uint shader, const std::pair<float, float>& viewport) const {
     // VAOをバインドして描画
     gl_->BindVertexArray(vao_);
-    // glDrawElementsでインデックスバッファを用いた描画を行う
-    gl_->DrawElements(gl::kTriangles, indices_.size(), gl::kUnsignedInt, 0);
+    // glDrawElementsで、選択中のLODレベルのインデックス範囲のみを描く
+    const auto [offset, count] = lod_.CurrentRange(indices_.count);
+    gl_->DrawElements(gl::kTriangles, count, indices_.type,
+                      reinterpret_cast<const void*>(offset * indices_.IndexSize()));
     gl_->BindVertexArray(0);
 }
 
@@ -96,8 +94,8 @@ void ISurfaceGraphics::DoSynchronize() {
 
     // EBOにインデックスデータを転送
     gl_->BindBuffer(gl::kElementArrayBuffer, ebo_);
-    gl_->BufferData(gl::kElementArrayBuffer, indices_.size() * sizeof(gl::Uint),
-                    indices_.data(), gl::kStaticDraw);
+    gl_->BufferData(gl::kElementArrayBuffer, indices_.bytes.size(),
+                    indices_.bytes.data(), gl::kStaticDraw);
 
     // VAOのバインドを解除
     gl_->BindVertexArray(0);
@@ -121,13 +119,24 @@ void ISurfaceGraphics::Cleanup() {
 
     // 頂点・法線データとインデックスデータをクリア
     vertices_.clear();
-    indices_.clear();
+    indices_ = PackedIndices();
+    // 選択中のレベルは再同期後も維持する (LodDrawState::Assign)
+    lod_.levels.clear();
 }
 
 void ISurfaceGraphics::GenerateSurfaceData() {
-    // メッシュ生成本体はGL非依存の自由関数へ委譲する (単体テスト可能)
-    auto mesh = BuildGeneralSurfaceMesh(*entity_, kDefaultDiv, kDefaultDiv);
-    // SoAメッシュをシェーダーレイアウトへinterleaveする (GPU転送用ステージング)
-    vertices_ = BuildInterleavedVertices(mesh.mesh);
-    indices_ = std::move(mesh.mesh.indices);
+    // メッシュ生成本体はGL非依存の自由関数へ委譲する (単体テスト可能).
+    // 曲面の大きさに応じた許容量で、曲率の大きい範囲にのみ格子を集める.
+    // 許容量を段階的に粗くしたメッシュをLODレベルとして連結する
+    LodMeshStaging staging;
+    for (int level = 0; level < kDisplayLodLevelCount; ++level) {
+        const auto mesh = BuildGeneralSurfaceMesh(
+                *entity_, GetDisplayTessellationTolerance(*entity_, level));
+        // SoAメッシュをシェーダーレイアウトへinterleaveする (GPU転送用ステージング)
+        AppendLodLevel(staging, mesh.mesh, GetDisplayLodRelativeError(level));
+    }
+    vertices_ = std::move(staging.vertices);
+    // 頂点数が16ビットに収まる場合は16ビットのインデックスで転送する
+    indices_ = PackIndices(staging.indices, vertices_.size() / 8);
+    lod_.Assign(staging);
 }
@@ -15,7 +15,18 @@
 
 #include "igesio/entities/surfaces/algorithms/restricted_surface_mesh.h"
 #include "igesio/entities/surfaces/algorithms/surface_boundary_edges.h"
-#include "igesio/graphics/core/mesh_staging.h"
+#include "igesio/entities/surfaces/algorithms/tessellation_cache.h"
+#include "igesio/graphics/surfaces/surface_mesh.h"
+
+namespace {
+
+/// @brief 描画用テッセレーションの基底グリッド分割数
+/// @note 許容量による細分を前提に粗くとる (平坦な領域はこの粗さのまま)
+constexpr int kDisplayBaseDiv = 8;
+/// @brief 描画用テッセレーションの四分木の最大深さ (実効分割数 8 * 2^5 = 256 まで)
+constexpr int kDisplayMaxDepth = 5;
+
+}  // namespace
 
 
 
@@ -45,8 +56,11 @@ igesio::graphics::RestrictedSurfaceGraphics::~RestrictedSurfaceGraphics() {
 void igesio::graphics::RestrictedSurfaceGraphics::DrawImpl(
         gl::Uint /*shader*/,
         const std::pair<float, float>& /*viewport*/) const {
+    // 選択中のLODレベルのインデックス範囲のみを描く
+    const auto [offset, count] = lod_.CurrentRange(indices_.count);
     gl_->BindVertexArray(vao_);
-    gl_->DrawElements(gl::kTriangles, indices_.size(), gl::kUnsignedInt, 0);
+    gl_->DrawElements(gl::kTriangles, count, indices_.type,
+                      reinterpret_cast<const void*>(offset * indices_.IndexSize()));
     gl_->BindVertexArray(0);
 }
 
@@ -63,13 +77,31 @@ void igesio::graphics::RestrictedSurfaceGraphics::PrewarmCpu() {
     const std::uint64_t key = CurrentGeometryKey();
     if (cpu_ready_ && cpu_key_ == key) return;
 
-    // テッセレーションは制限付き曲面(143/144/108有界)共通のアルゴリズムへ委譲する
-    auto mesh = entities::TessellateRestrictedSurface(*entity_);
-    // GPU転送用にシェーダーレイアウトへinterleaveする (GL非依存のCPU処理)
-    pending_vertices_ = BuildInterleavedVertices(mesh);
-    pending_indices_ = std::move(mesh.indices);
+    // テッセレーションは制限付き曲面(143/144/108有界)共通のアルゴリズムへ委譲する.
+    // 曲面の大きさに応じた許容量で、曲率の大きいルートのみを細分する.
+    // 結果は共有キャッシュに保持し、形状が変わらない限り (ビューの再オープン・
+    // 再同期等) テッセレーションを省略する.
+    // 許容量を段階的に粗くしたメッシュをLODレベルとして連結する. 粗いレベルは
+    // 基底グリッドも粗くする (平坦な領域の三角形数は基底グリッドで決まるため)
+    pending_mesh_.Clear();
+    entities::RestrictedSurfaceMeshParams params;
+    params.max_depth = kDisplayMaxDepth;
+    for (int level = 0; level < kDisplayLodLevelCount; ++level) {
+        params.base_div = std::max(1, kDisplayBaseDiv >> level);
+        params.tolerance = GetDisplayTessellationTolerance(*entity_, level);
+        const auto mesh = entities::GetSharedTessellationCache()
+                .GetRestrictedSurfaceMesh(*entity_, params);
+        // GPU転送用にシェーダーレイアウトへinterleaveする (GL非依存のCPU処理)
+        AppendLodLevel(pending_mesh_, *mesh, GetDisplayLodRelativeError(level));
+    }
+    params.tolerance = GetDisplayTessellationTolerance(*entity_);
     // 境界エッジ (外周/内周トリム境界) をモデル空間の折れ線として計算する
-    pending_edge_loops_ = entities::ComputeRestrictedSurfaceEdges(*entity_).loops;
+    // (境界曲線は面と同じ弦高・角度の許容量で適応的に折れ線化する)
+    entities::SurfaceBoundaryEdgeParams edge_params;
+    edge_params.tolerance.chord_height = params.tolerance.chord_height;
+    edge_params.tolerance.angle = params.tolerance.angle;
+    pending_edge_loops_ =
+            entities::ComputeRestrictedSurfaceEdges(*entity_, edge_params).loops;
     cpu_ready_ = true;
     cpu_key_ = key;
 }
@@ -83,8 +115,9 @@ void igesio::graphics::RestrictedSurfaceGraphics::DoSynchronize() {
     PrewarmCpu();
 
     // ステージングを消費してGPUへ転送する
-    vertices_ = std::move(pending_vertices_);
-    indices_ = std::move(pending_indices_);
+    vertices_ = std::move(pending_mesh_.vertices);
+    indices_ = PackIndices(pending_mesh_.indices, vertices_.size() / 8);
+    lod_.Assign(pending_mesh_);
     edge_buffer_.Build(pending_edge_loops_);
 
     gl_->GenVertexArrays(1, &vao_);
@@ -109,14 +142,14 @@ void igesio::graphics::RestrictedSurfaceGraphics::DoSynchronize() {
     gl_->EnableVertexAttribArray(2);
 
     gl_->BindBuffer(gl::kElementArrayBuffer, ebo_);
-    gl_->BufferData(gl::kElementArrayBuffer,
-                    indices_.size() * sizeof(gl::Uint),
-                    indices_.data(), gl::kStaticDraw);
+    gl_->BufferData(gl::kElementArrayBuffer, indices_.bytes.size(),
+                    indices_.bytes.data(), gl::kStaticDraw);
 
     gl_->BindVertexArray(0);
 
     // ステージングは消費済み。次回 (編集による再同期) は再度PrewarmCpuで構築する。
     cpu_ready_ = false;
+    pending_mesh_.Clear();
     pending_edge_loops_.clear();
 }
 
@@ -136,7 +169,9 @@ void igesio::graphics::RestrictedSurfaceGraphics::Cleanup() {
     edge_buffer_.Cleanup();
 
     vertices_.clear();
-    indices_.clear();
+    indices_ = PackedIndices();
+    // 選択中のレベルは再同期後も維持する (LodDrawState::Assign)
+    lod_.levels.clear();
 }
 
 igesio::graphics::SelectionSamples
@@ -154,7 +189,7 @@ igesio::graphics::RestrictedSurfaceGraphics::GetSelectionSamples(
             result.polylines.push_back(std::move(pl));
         }
     } else if (auto outer = entity_->GetOuterUVBoundary()) {
-        AppendBoundaryWorldPolyline(*outer, params.curve_samples, result);
+        AppendBoundaryWorldPolyline(*outer, params, result);
     }
 
     // 内周 (穴) ループ
@@ -162,7 +197,7 @@ igesio::graphics::RestrictedSurfaceGraphics::GetSelectionSamples(
     for (size_t i = 0; i < n_inner; ++i) {
         auto inner = entity_->GetInnerUVBoundaryAt(i);
         if (!inner) continue;
-        AppendBoundaryWorldPolyline(*inner, params.curve_samples, result);
+        AppendBoundaryWorldPolyline(*inner, params, result);
     }
 
     // トリム領域内の内部グリッド点を追加する (IsInDomainで穴/外側を除外)
@@ -180,7 +215,7 @@ igesio::graphics::RestrictedSurfaceGraphics::GetSelectionSamples(
  */
 
 void igesio::graphics::RestrictedSurfaceGraphics::AppendBoundaryWorldPolyline(
-        const entities::ICurve& uv_boundary, int n_samples,
+        const entities::ICurve& uv_boundary, const SelectionSampleParams& params,
         SelectionSamples& result) const {
     auto base = entity_->GetBaseSurface();
     if (!base) return;
@@ -194,19 +229,22 @@ void igesio::graphics::RestrictedSurfaceGraphics::AppendBoundaryWorldPolyline(
     if (std::isinf(t0)) t0 = -kInfiniteParamClamp;
     if (std::isinf(t1)) t1 =  kInfiniteParamClamp;
 
-    // 角点を評価点に含め、選択用折れ線が境界の角を丸めず通るようにする
-    // (描画エッジComputeRestrictedSurfaceEdgesと同一のサンプル方針)
-    const int n = std::max(1, n_samples);
-    const auto params =
-            entities::BuildCornerAwareSampleParams(uv_boundary, t0, t1, n);
+    // 曲線の範囲選択サンプル (SampleCurve) と同じ折れ線化を、S(B(t))の
+    // ワールド座標に対して行う (角点は常に評価点に含まれる). UV空間の直線も
+    // S(B(t))では曲がりうるため、角度の許容量でも細分する
+    auto dp = MakeSelectionDiscretizationParams(params);
+    dp.tolerance.angle = kDisplayAngle;
+    dp.max_depth = std::max(0, params.adaptive_max_depth);
     std::vector<Vector3d> poly;
-    poly.reserve(params.size());
-    for (const double t : params) {
-        const auto uv = uv_boundary.TryGetPointAt(t);  // (u, v, 0)
-        if (!uv) continue;
-        const auto p = base->TryGetPointAt(uv->x(), uv->y());
-        if (!p) continue;
-        poly.push_back(ToWorld(wtd, *p));
+    for (const auto& polyline : entities::DiscretizeCurve(
+            uv_boundary, {t0, t1}, dp,
+            [&base, &wtd](const Vector3d& uv) -> std::optional<Vector3d> {
+                const auto p = base->TryGetPointAt(uv.x(), uv.y());
+                if (!p) return std::nullopt;
+                return ToWorld(wtd, *p);
+            })) {
+        // 評価できない点は飛ばして1本のループとする
+        poly.insert(poly.end(), polyline.points.begin(), polyline.points.end());
     }
     if (poly.size() >= 2) result.polylines.push_back(std::move(poly));
 }
@@ -26,6 +26,9 @@ using igesio::MatrixXf;
 using igesio::Vector3d;
 using igesio::entities::ISurface;
 
+/// @brief 適応的な分割で、他方向の標本値を取る一様分割数
+constexpr int kAdaptiveProbeDiv = 8;
+
 /// @brief u/vパラメータの値を計算する
 /// @param i インデックス
 /// @param div 分割数
@@ -47,22 +50,20 @@ struct USampleRow {
     bool bridge_to_next = true;
 };
 
-/// @brief 一様グリッドと折れ目を統合したuサンプル行を構築する
+/// @brief uの分割点と折れ目を統合したuサンプル行を構築する
 /// @param entity 対象の曲面
-/// @param u_div u方向の一様分割数
+/// @param u_range uのパラメータ範囲 {start, end}
+/// @param u_params uの分割点 (u_range[0], u_range[1]を含む昇順)
 /// @return uサンプル行のリスト (u昇順)
 std::vector<USampleRow> BuildUSampleRows(const ISurface& entity,
                                          const std::array<double, 2>& u_range,
-                                         const int u_div) {
+                                         const std::vector<double>& u_params) {
     const double umin = u_range[0], umax = u_range[1];
 
-    // 無限・退化範囲は従来通り一様サンプルのみ (折れ目挿入は行わない)
+    // 無限・退化範囲は従来通り分割点のみ (折れ目挿入は行わない)
     std::vector<USampleRow> rows;
     if (!std::isfinite(umin) || !std::isfinite(umax) || umax <= umin) {
-        for (int i = 0; i <= u_div; ++i) {
-            const double u = ComputeParam(i, u_div, u_range);
-            rows.push_back({u, u, true});
-        }
+        for (const double u : u_params) rows.push_back({u, u, true});
         return rows;
     }
 
@@ -79,14 +80,13 @@ std::vector<USampleRow> BuildUSampleRows(const ISurface& entity,
             [merge_tol](double a, double b) { return std::abs(a - b) <= merge_tol; }),
             creases.end());
 
-    // 一様グリッド点 ∪ 折れ目のステーションを構築 (折れ目近傍の格子点は吸収)
+    // 分割点 ∪ 折れ目のステーションを構築 (折れ目近傍の分割点は吸収)
     struct Station {
         double u;
         bool is_crease;
     };
     std::vector<Station> stations;
-    for (int i = 0; i <= u_div; ++i) {
-        const double u = umin + span * i / static_cast<double>(u_div);
+    for (const double u : u_params) {
         bool near_crease = false;
         for (const double uc : creases) {
             if (std::abs(u - uc) <= merge_tol) { near_crease = true; break; }
@@ -197,26 +197,45 @@ void BuildSurfaceIndices(const std::vector<USampleRow>& rows,
     }
 }
 
-}  // namespace
-
-
-
-GeneralSurfaceMesh BuildGeneralSurfaceMesh(
-        const entities::ISurface& surface, const int u_div, const int v_div) {
-    GeneralSurfaceMesh mesh;
-    mesh.v_div = v_div;
-
+/// @brief 無限範囲をクランプしたu/vのパラメータ範囲を取得する
+/// @return {u_range, v_range}
+/// @note 無限範囲はエッジ生成 (ComputeParametricSurfaceEdges) と同じ
+///       ±kInfiniteParamClampへクランプし、有限な可視メッシュを生成する
+///       (有限範囲はそのまま素通り)
+std::array<std::array<double, 2>, 2> GetClampedRanges(const ISurface& surface) {
     auto u_range = surface.GetURange();
     auto v_range = surface.GetVRange();
-    // 無限範囲はエッジ生成 (ComputeParametricSurfaceEdges) と同じ±kInfiniteParamClamp
-    // へクランプし、有限な可視メッシュを生成する (有限範囲はそのまま素通り)
     if (std::isinf(u_range[0])) u_range[0] = -kInfiniteParamClamp;
     if (std::isinf(u_range[1])) u_range[1] =  kInfiniteParamClamp;
     if (std::isinf(v_range[0])) v_range[0] = -kInfiniteParamClamp;
     if (std::isinf(v_range[1])) v_range[1] =  kInfiniteParamClamp;
+    return {u_range, v_range};
+}
+
+/// @brief 範囲を一様に分割した分割点を返す
+std::vector<double> UniformParams(const std::array<double, 2>& range, const int div) {
+    std::vector<double> params;
+    params.reserve(div + 1);
+    for (int i = 0; i <= div; ++i) params.push_back(ComputeParam(i, div, range));
+    return params;
+}
+
+/// @brief u/vの分割点から、テンソル積格子のメッシュを生成する
+/// @param surface 対象の曲面
+/// @param u_range uのパラメータ範囲 (テクスチャ座標の正規化に用いる)
+/// @param v_range vのパラメータ範囲 (同上)
+/// @param u_params uの分割点 (昇順. 折れ目の行はこれに加えて挿入する)
+/// @param v_params vの分割点 (昇順)
+GeneralSurfaceMesh BuildGridMesh(
+        const ISurface& surface,
+        const std::array<double, 2>& u_range, const std::array<double, 2>& v_range,
+        const std::vector<double>& u_params, const std::vector<double>& v_params) {
+    GeneralSurfaceMesh mesh;
+    const int v_div = static_cast<int>(v_params.size()) - 1;
+    mesh.v_div = v_div;
 
     // uサンプル行 (折れ目二重化済み) を構築する
-    const auto rows = BuildUSampleRows(surface, u_range, u_div);
+    const auto rows = BuildUSampleRows(surface, u_range, u_params);
     const int n_rows = static_cast<int>(rows.size());
     mesh.u_row_count = n_rows;
 
@@ -237,7 +256,7 @@ GeneralSurfaceMesh BuildGeneralSurfaceMesh(
     // 頂点・法線データを生成
     for (int i = 0; i < n_rows; ++i) {
         for (int j = 0; j <= v_div; ++j) {
-            const double v = ComputeParam(j, v_div, v_range);
+            const double v = v_params[j];
             auto pos_opt = surface.TryGetPointAt(rows[i].u, v);
             // 法線は折れ目対応のため片側評価のnormal_uで取得する
             auto normal_opt = surface.TryGetNormalAt(rows[i].normal_u, v);
@@ -275,4 +294,62 @@ GeneralSurfaceMesh BuildGeneralSurfaceMesh(
     return mesh;
 }
 
+}  // namespace
+
+
+
+GeneralSurfaceMesh BuildGeneralSurfaceMesh(
+        const entities::ISurface& surface, const int u_div, const int v_div) {
+    const auto [u_range, v_range] = GetClampedRanges(surface);
+    return BuildGridMesh(surface, u_range, v_range,
+                         UniformParams(u_range, u_div), UniformParams(v_range, v_div));
+}
+
+GeneralSurfaceMesh BuildGeneralSurfaceMesh(
+        const entities::ISurface& surface,
+        const entities::TessellationTolerance& tolerance,
+        const int max_depth) {
+    const auto [u_range, v_range] = GetClampedRanges(surface);
+    // 各方向の分割は、他方向の一様な標本値の上で評価する
+    const auto u_params = entities::ComputeAdaptiveStations(
+            surface, true, u_range, UniformParams(v_range, kAdaptiveProbeDiv),
+            tolerance, max_depth);
+    const auto v_params = entities::ComputeAdaptiveStations(
+            surface, false, v_range, UniformParams(u_range, kAdaptiveProbeDiv),
+            tolerance, max_depth);
+    return BuildGridMesh(surface, u_range, v_range, u_params, v_params);
+}
+
+entities::TessellationTolerance GetDisplayTessellationTolerance(
+        const entities::ISurface& surface, const int lod_level) {
+    return GetDisplayTessellationTolerance(surface.GetBoundingBox(), lod_level);
+}
+
+entities::TessellationTolerance GetDisplayTessellationTolerance(
+        const numerics::BoundingBox& bb, const int lod_level) {
+    const int level = std::max(0, lod_level);
+    entities::TessellationTolerance tolerance;
+    tolerance.angle = std::min(
+            kDisplayLodMaxAngle,
+            kDisplayAngle * std::pow(std::sqrt(kDisplayLodChordScale), level));
+    if (!bb.IsEmpty() && bb.IsFinite()) {
+        const auto vertices = bb.GetFiniteVertices();
+        if (!vertices.empty()) {
+            Vector3d lower = vertices.front(), upper = vertices.front();
+            for (const auto& p : vertices) {
+                lower = lower.cwiseMin(p);
+                upper = upper.cwiseMax(p);
+            }
+            tolerance.chord_height =
+                    GetDisplayLodRelativeError(level) * (upper - lower).norm();
+        }
+    }
+    return tolerance;
+}
+
+double GetDisplayLodRelativeError(const int lod_level) {
+    return kDisplayChordRatio
+         * std::pow(kDisplayLodChordScale, std::max(0, lod_level));
+}
+
 }  // namespace igesio::graphics
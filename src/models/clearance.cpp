@@ -0,0 +1,165 @@
+/**
+ * @file models/clearance.cpp
+ * @brief Assembly内のエンティティ間のクリアランスの一括計算の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/models/clearance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "igesio/numerics/geometric/bvh.h"
+#include "igesio/entities/entity_base.h"
+#include "igesio/entities/interfaces/i_curve.h"
+#include "igesio/entities/interfaces/i_geometry.h"
+#include "igesio/entities/interfaces/i_surface.h"
+#include "igesio/entities/views/curve_view.h"
+#include "igesio/entities/views/surface_view.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_num = igesio::numerics;
+namespace i_models = igesio::models;
+using igesio::ObjectID;
+using igesio::Vector3d;
+
+/// @brief クリアランスの計算対象
+struct Target {
+    /// @brief エンティティのID
+    ObjectID id;
+    /// @brief 所有するAssembly (skip_same_assemblyの判定に用いる)
+    const i_models::Assembly* owner = nullptr;
+    /// @brief ワールド配置のビュー (CurveViewまたはSurfaceView)
+    std::shared_ptr<const i_ent::IGeometry> view;
+    /// @brief ワールド空間のバウンディングボックス (有限でない場合はnullopt)
+    std::optional<std::pair<Vector3d, Vector3d>> box;
+};
+
+/// @brief ビューのワールド空間のバウンディングボックスを取得する
+/// @return {最小点, 最大点}. 空・無限の場合はnullopt
+std::optional<std::pair<Vector3d, Vector3d>> WorldBox(const i_ent::IGeometry& view) {
+    const auto bb = view.GetBoundingBox();
+    if (bb.IsEmpty() || !bb.IsFinite()) return std::nullopt;
+    const auto vertices = bb.GetFiniteVertices();
+    if (vertices.empty()) return std::nullopt;
+    Vector3d lower = vertices.front(), upper = vertices.front();
+    for (const auto& v : vertices) {
+        lower = lower.cwiseMin(v);
+        upper = upper.cwiseMax(v);
+    }
+    return std::make_pair(lower, upper);
+}
+
+}  // namespace
+
+
+
+std::vector<i_models::ClearanceResult> i_models::ComputeClearances(
+        const Assembly& assembly, const ClearanceParams& params) {
+    if (!(params.max_distance >= 0.0)) {
+        throw std::invalid_argument(
+            "ComputeClearances: max_distance must be non-negative.");
+    }
+
+    // 遅延幾何キャッシュを事前構築し、以降の並列計算を読み取りのみにする
+    assembly.PrepareGeometryCaches(true);
+
+    std::vector<Target> targets;
+    const auto entities = assembly.FindEntities(
+            [](const i_ent::IEntityIdentifier&) { return true; }, true);
+    for (const auto& entity : entities) {
+        if (!entity) continue;
+        // 物理従属のメンバは親を通じて評価する (GetWorldBoundingBoxと同じ規則)
+        const auto eb = std::dynamic_pointer_cast<const i_ent::EntityBase>(entity);
+        if (eb && eb->GetSubordinateEntitySwitch()
+                == i_ent::SubordinateEntitySwitch::kPhysicallyDependent) {
+            continue;
+        }
+
+        Target target;
+        target.id = entity->GetID();
+        if (dynamic_cast<const i_ent::ISurface*>(entity.get())) {
+            if (!params.include_surfaces) continue;
+            target.view = assembly.GetSurfaceView(target.id, CoordFrame::World());
+        } else if (const auto* curve =
+                    dynamic_cast<const i_ent::ICurve*>(entity.get())) {
+            if (!params.include_curves || !curve->IsFinite()) continue;
+            target.view = assembly.GetCurveView(target.id, CoordFrame::World());
+        }
+        if (!target.view) continue;
+        target.owner = assembly.FindOwner(target.id);
+        target.box = WorldBox(*target.view);
+        targets.push_back(std::move(target));
+    }
+
+    // 候補の組を列挙する. ボックスをmax_distanceだけ拡大したBVHで、
+    // ボックス間の距離がmax_distanceを超える組を除く (無限大では全ての組)
+    std::vector<std::pair<std::size_t, std::size_t>> candidates;
+    const auto accept = [&](const std::size_t i, const std::size_t j) {
+        if (params.skip_same_assembly && targets[i].owner == targets[j].owner) return;
+        candidates.emplace_back(std::min(i, j), std::max(i, j));
+    };
+    if (std::isfinite(params.max_distance)) {
+        std::vector<std::size_t> bounded;
+        std::vector<Vector3d> lowers, uppers;
+        const Vector3d pad = Vector3d::Constant(params.max_distance);
+        for (std::size_t i = 0; i < targets.size(); ++i) {
+            if (!targets[i].box) continue;
+            bounded.push_back(i);
+            lowers.push_back(targets[i].box->first - pad);
+            uppers.push_back(targets[i].box->second + pad);
+        }
+        const auto bvh = i_num::BuildBvh(lowers, uppers);
+        for (std::size_t i = 0; i < targets.size(); ++i) {
+            if (!targets[i].box) {
+                // ボックスが有限でない対象は、全ての対象と組にする
+                for (std::size_t j = 0; j < targets.size(); ++j) {
+                    if (j != i && (targets[j].box || j > i)) accept(i, j);
+                }
+                continue;
+            }
+            const auto& [lower, upper] = *targets[i].box;
+            i_num::QueryBvh(bvh,
+                    [&](const Vector3d& node_lower, const Vector3d& node_upper) {
+                return (node_lower.array() <= upper.array()).all() &&
+                       (lower.array() <= node_upper.array()).all();
+            }, [&](const std::uint32_t prim) {
+                if (bounded[prim] > i) accept(i, bounded[prim]);
+            });
+        }
+    } else {
+        for (std::size_t i = 0; i < targets.size(); ++i) {
+            for (std::size_t j = i + 1; j < targets.size(); ++j) accept(i, j);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<i_ent::GeometryPair> pairs;
+    pairs.reserve(candidates.size());
+    for (const auto& [i, j] : candidates) {
+        pairs.push_back({targets[i].view, targets[j].view});
+    }
+    const auto distances = i_ent::MinimumDistancePairs(pairs, params.distance);
+
+    std::vector<ClearanceResult> results;
+    for (std::size_t k = 0; k < candidates.size(); ++k) {
+        const auto& d = distances[k];
+        if (!d || d->distance > params.max_distance) continue;
+        const auto [i, j] = candidates[k];
+        results.push_back({targets[i].id, targets[j].id,
+                           d->distance, d->point_a, d->point_b});
+    }
+    std::stable_sort(results.begin(), results.end(),
+                     [](const ClearanceResult& a, const ClearanceResult& b) {
+        return a.distance < b.distance;
+    });
+    return results;
+}
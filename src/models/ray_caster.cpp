@@ -0,0 +1,402 @@
+/**
+ * @file models/ray_caster.cpp
+ * @brief Assemblyに対するヘッドレスなレイキャストの実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/models/ray_caster.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "igesio/common/parallel.h"
+#include "igesio/numerics/meshes/algorithms/mesh_bvh.h"
+#include "igesio/entities/entity_base.h"
+#include "igesio/entities/interfaces/i_curve.h"
+#include "igesio/entities/interfaces/i_geometry.h"
+#include "igesio/entities/interfaces/i_surface.h"
+#include "igesio/entities/interfaces/i_restricted_surface.h"
+#include "igesio/entities/meshes/mesh_entity.h"
+#include "igesio/entities/curves/algorithms/curve_line_intersection.h"
+#include "igesio/entities/surfaces/algorithms/tessellation_cache.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_num = igesio::numerics;
+namespace i_models = igesio::models;
+using igesio::Matrix4d;
+using igesio::Vector3d;
+using i_models::RayCastHit;
+
+/// @brief 線種 (レイ)
+constexpr auto kRay = i_num::BoundingBox::DirectionType::kRay;
+
+/// @brief 非制限曲面をuv格子でテッセレーションする
+/// @param surface 対象の曲面
+/// @param nu u方向の分割数
+/// @param nv v方向の分割数
+/// @return モデル空間の三角形メッシュ. パラメータ範囲が無限の場合は`std::nullopt`
+/// @note 評価できない格子点を含む三角形は除く
+std::optional<i_num::TriangleMeshd> TessellateSurfaceGrid(
+        const i_ent::ISurface& surface, const int nu, const int nv) {
+    if (!surface.IsFinite() || nu < 1 || nv < 1) return std::nullopt;
+    const auto r = surface.GetParameterRange();
+
+    // 格子点を評価する. 評価できない点は番号を持たない
+    constexpr auto kNone = std::numeric_limits<std::uint32_t>::max();
+    std::vector<Vector3d> points;
+    std::vector<std::uint32_t> vertex_of((nu + 1) * (nv + 1), kNone);
+    for (int j = 0; j <= nv; ++j) {
+        for (int i = 0; i <= nu; ++i) {
+            const auto p = surface.TryGetPointAt(
+                    r[0] + (r[1] - r[0]) * i / nu, r[2] + (r[3] - r[2]) * j / nv);
+            if (!p) continue;
+            vertex_of[j * (nu + 1) + i] = static_cast<std::uint32_t>(points.size());
+            points.push_back(*p);
+        }
+    }
+
+    i_num::TriangleMeshd mesh;
+    mesh.positions.resize(3, static_cast<Eigen::Index>(points.size()));
+    for (std::size_t k = 0; k < points.size(); ++k) {
+        mesh.positions.col(static_cast<Eigen::Index>(k)) = points[k];
+    }
+    const auto add_triangle = [&](const std::uint32_t a, const std::uint32_t b,
+                                  const std::uint32_t c) {
+        if (a == kNone || b == kNone || c == kNone) return;
+        mesh.indices.insert(mesh.indices.end(), {a, b, c});
+    };
+    for (int j = 0; j < nv; ++j) {
+        for (int i = 0; i < nu; ++i) {
+            const auto v00 = vertex_of[j * (nu + 1) + i];
+            const auto v10 = vertex_of[j * (nu + 1) + i + 1];
+            const auto v01 = vertex_of[(j + 1) * (nu + 1) + i];
+            const auto v11 = vertex_of[(j + 1) * (nu + 1) + i + 1];
+            add_triangle(v00, v10, v11);
+            add_triangle(v00, v11, v01);
+        }
+    }
+    return mesh;
+}
+
+/// @brief ヒットをdistance昇順に並べ、位置がtol未満の重複を除く (近い方を残す)
+void SortAndDeduplicate(std::vector<RayCastHit>& hits, const double tol) {
+    std::stable_sort(hits.begin(), hits.end(),
+                     [](const RayCastHit& a, const RayCastHit& b) {
+        return a.distance < b.distance;
+    });
+    std::vector<RayCastHit> kept;
+    kept.reserve(hits.size());
+    for (const auto& hit : hits) {
+        const bool duplicated = std::any_of(kept.begin(), kept.end(),
+                [&](const RayCastHit& k) {
+            return (k.position - hit.position).norm() < tol;
+        });
+        if (!duplicated) kept.push_back(hit);
+    }
+    hits = std::move(kept);
+}
+
+}  // namespace
+
+
+
+namespace igesio::models {
+
+/// @brief 判定対象のエンティティ
+struct RayCaster::Target {
+    /// @brief 狭域判定の種類
+    enum class Kind {
+        /// @brief 曲線 (IntersectCurveWithLine)
+        kCurve,
+        /// @brief 曲面 (IntersectSurfaceWithLine)
+        kSurface,
+        /// @brief メッシュ (MeshEntityのメッシュ、または曲面のテッセレーション)
+        kMesh,
+    };
+
+    /// @brief エンティティのID
+    ObjectID id;
+    /// @brief エンティティ (判定中の寿命を保証するために保持する)
+    std::shared_ptr<const entities::IEntityIdentifier> entity;
+    /// @brief 狭域判定の種類
+    Kind kind = Kind::kCurve;
+    /// @brief 曲線 (kCurveの場合)
+    const entities::ICurve* curve = nullptr;
+    /// @brief 曲面 (kSurfaceの場合)
+    const entities::ISurface* surface = nullptr;
+    /// @brief メッシュ (kMeshの場合. meshまたはtessellationを指す)
+    const numerics::TriangleMeshd* mesh = nullptr;
+    /// @brief meshのBVH (kMeshの場合. MeshEntity::GetBvhまたはtessellation_bvh)
+    const numerics::Bvh* mesh_bvh = nullptr;
+    /// @brief 曲面のテッセレーション (kTessellatedの曲面のみ)
+    std::unique_ptr<numerics::TriangleMeshd> tessellation;
+    /// @brief tessellationのBVH
+    numerics::Bvh tessellation_bvh;
+    /// @brief エンティティのモデル空間→ワールドの配置行列
+    Matrix4d placement = Matrix4d::Identity();
+    /// @brief placementの逆行列
+    Matrix4d inverse = Matrix4d::Identity();
+};
+
+}  // namespace igesio::models
+
+
+
+/**
+ * 構築
+ */
+
+i_models::RayCaster::RayCaster(const Assembly& assembly,
+                               const RayCasterParams& params)
+        : params_(params), revision_(assembly.Revision()) {
+    // 遅延幾何キャッシュを事前構築し、以降の並列クエリを読み取りのみにする
+    assembly.PrepareGeometryCaches(true);
+
+    const auto entities = assembly.FindEntities(
+            [](const i_ent::IEntityIdentifier&) { return true; }, true);
+    for (const auto& entity : entities) {
+        if (!entity) continue;
+        // 物理従属のメンバは親を通じて判定する (GetWorldBoundingBoxと同じ規則)
+        const auto eb = std::dynamic_pointer_cast<const i_ent::EntityBase>(entity);
+        if (eb && eb->GetSubordinateEntitySwitch()
+                == i_ent::SubordinateEntitySwitch::kPhysicallyDependent) {
+            continue;
+        }
+
+        Target target;
+        target.id = entity->GetID();
+        target.entity = entity;
+        if (const auto* mesh_entity =
+                    dynamic_cast<const i_ent::MeshEntity*>(entity.get())) {
+            if (!params_.include_meshes) continue;
+            target.kind = Target::Kind::kMesh;
+            target.mesh = &mesh_entity->Mesh();
+            target.mesh_bvh = &mesh_entity->GetBvh();
+        } else if (const auto* surface =
+                    dynamic_cast<const i_ent::ISurface*>(entity.get())) {
+            if (!params_.include_surfaces) continue;
+            target.kind = Target::Kind::kSurface;
+            target.surface = surface;
+        } else if (const auto* curve =
+                    dynamic_cast<const i_ent::ICurve*>(entity.get())) {
+            if (!params_.include_curves) continue;
+            target.kind = Target::Kind::kCurve;
+            target.curve = curve;
+        } else {
+            continue;
+        }
+
+        const auto placement =
+                assembly.ResolvePlacement(target.id, CoordFrame::World());
+        if (placement) target.placement = *placement;
+        target.inverse = target.placement.inverse();
+        if (!target.inverse.allFinite()) continue;  // 退化した配置では判定できない
+        targets_.push_back(std::move(target));
+    }
+
+    // 曲面のテッセレーションとそのBVHを並列に構築する
+    if (params_.surface_mode == SurfaceRayMode::kTessellated) {
+        ParallelFor(targets_.size(), [&](const std::size_t i) {
+            auto& target = targets_[i];
+            if (target.kind != Target::Kind::kSurface) return;
+            std::optional<numerics::TriangleMeshd> mesh;
+            if (const auto* rs = dynamic_cast<const i_ent::IRestrictedSurface*>(
+                        target.surface)) {
+                // 描画等と共有するキャッシュから取得する (形状が変わらない限り再利用)
+                const auto meshf = entities::GetSharedTessellationCache()
+                        .GetRestrictedSurfaceMesh(*rs, params_.restricted_mesh);
+                mesh.emplace();
+                mesh->positions = meshf->positions.cast<double>();
+                mesh->indices = meshf->indices;
+            } else {
+                mesh = TessellateSurfaceGrid(*target.surface,
+                        params_.surface_u_samples, params_.surface_v_samples);
+            }
+            if (!mesh) return;  // 無限範囲の曲面はkExactで判定する
+
+            target.tessellation =
+                    std::make_unique<numerics::TriangleMeshd>(std::move(*mesh));
+            target.tessellation_bvh = numerics::BuildMeshBvh(*target.tessellation);
+            target.kind = Target::Kind::kMesh;
+            target.mesh = target.tessellation.get();
+            target.mesh_bvh = &target.tessellation_bvh;
+        });
+    }
+
+    // ワールド空間のバウンディングボックスのBVHを構築する.
+    // 曲線はレイから許容量以内でヒットするため、ボックスを許容量だけ拡大する
+    // (非一様な配置では、線形部のフロベニウスノルムで許容量の拡大率を上から抑える)
+    std::vector<Vector3d> lowers, uppers;
+    for (std::size_t i = 0; i < targets_.size(); ++i) {
+        const auto& target = targets_[i];
+        const auto* geometry =
+                dynamic_cast<const i_ent::IGeometry*>(target.entity.get());
+        const auto bb = geometry ? std::optional(geometry->GetBoundingBox(
+                target.placement)) : std::nullopt;
+        const auto vertices = (bb && !bb->IsEmpty() && bb->IsFinite())
+                ? bb->GetFiniteVertices() : std::vector<Vector3d>{};
+        if (vertices.empty()) {
+            unbounded_.push_back(i);
+            continue;
+        }
+
+        Vector3d lower = vertices.front(), upper = vertices.front();
+        for (const auto& v : vertices) {
+            lower = lower.cwiseMin(v);
+            upper = upper.cwiseMax(v);
+        }
+        if (target.kind == Target::Kind::kCurve) {
+            const double pad = params_.curve_hit_tolerance *
+                    target.placement.topLeftCorner<3, 3>().norm();
+            lower -= Vector3d::Constant(pad);
+            upper += Vector3d::Constant(pad);
+        }
+        bounded_.push_back(i);
+        lowers.push_back(lower);
+        uppers.push_back(upper);
+    }
+    bvh_ = numerics::BuildBvh(lowers, uppers);
+}
+
+i_models::RayCaster::~RayCaster() = default;
+i_models::RayCaster::RayCaster(RayCaster&&) noexcept = default;
+i_models::RayCaster& i_models::RayCaster::operator=(RayCaster&&) noexcept = default;
+
+std::size_t i_models::RayCaster::GetTargetCount() const {
+    return targets_.size();
+}
+
+
+
+/**
+ * 判定
+ */
+
+std::vector<RayCastHit> i_models::RayCaster::IntersectTarget(
+        const Target& target, const Vector3d& origin,
+        const Vector3d& direction, const double max_distance) const {
+    // レイをモデル空間へ逆変換する. アフィン変換では線パラメータが保存されるため、
+    // 正規化済みのワールド方向に対する線パラメータがそのままワールド距離となる
+    const Vector3d p0 = (target.inverse * origin.homogeneous()).hnormalized();
+    const Vector3d p1 = p0 + target.inverse.topLeftCorner<3, 3>() * direction;
+    const auto to_world = [&](const Vector3d& local) -> Vector3d {
+        return (target.placement * local.homogeneous()).hnormalized();
+    };
+
+    std::vector<RayCastHit> hits;
+    const auto add = [&](const Vector3d& local, const double distance) {
+        if (distance < 0.0 || distance > max_distance) return;
+        hits.push_back({target.id, to_world(local), distance});
+    };
+    switch (target.kind) {
+        case Target::Kind::kCurve: {
+            entities::CurveLineIntersectionParams cp;
+            cp.curve_samples = params_.curve_samples;
+            cp.convergence_tol = params_.convergence_tol;
+            cp.dedup_tol = params_.dedup_tol;
+            cp.hit_tolerance = params_.curve_hit_tolerance;
+            for (const auto& h : entities::IntersectCurveWithLine(
+                    *target.curve, p0, p1, kRay, cp)) {
+                add(h.position, h.t_line);
+            }
+            break;
+        }
+        case Target::Kind::kSurface: {
+            entities::SurfaceLineIntersectionParams sp;
+            sp.method = params_.surface_method;
+            sp.u_samples = params_.surface_u_samples;
+            sp.v_samples = params_.surface_v_samples;
+            sp.convergence_tol = params_.convergence_tol;
+            sp.dedup_tol = params_.dedup_tol;
+            for (const auto& h : entities::IntersectSurfaceWithLine(
+                    *target.surface, p0, p1, kRay, sp)) {
+                add(h.position, h.t);
+            }
+            break;
+        }
+        case Target::Kind::kMesh: {
+            numerics::MeshIntersectionParams mp;
+            mp.dedup_tol = params_.dedup_tol;
+            for (const auto& h : numerics::IntersectMeshWithLine(
+                    *target.mesh, *target.mesh_bvh, p0, p1, kRay, mp)) {
+                add(h.position, h.t);
+            }
+            break;
+        }
+    }
+    SortAndDeduplicate(hits, params_.dedup_tol);
+    return hits;
+}
+
+std::vector<RayCastHit> i_models::RayCaster::CastRay(
+        const Ray& ray, const RayCastMode mode) const {
+    const double norm = ray.direction.norm();
+    if (!(norm > 0.0) || !(ray.max_distance >= 0.0)) return {};
+    const Vector3d direction = ray.direction / norm;
+
+    if (mode == RayCastMode::kFirstHit) {
+        // BVHを手前から走査し、既知の最近傍より奥の部分木を打ち切る.
+        // 範囲を持たない対象は先に判定して打ち切り距離の初期値を得る.
+        // 同じ距離のヒットは列挙順の早い対象を優先する
+        std::optional<RayCastHit> closest;
+        std::size_t closest_index = 0;
+        const auto update = [&](const std::size_t index) {
+            const double limit = closest ? closest->distance : ray.max_distance;
+            const auto hits = IntersectTarget(
+                    targets_[index], ray.origin, direction, limit);
+            if (hits.empty()) return;
+            if (!closest || hits.front().distance < closest->distance ||
+                    (hits.front().distance == closest->distance &&
+                     index < closest_index)) {
+                closest = hits.front();
+                closest_index = index;
+            }
+        };
+        for (const auto index : unbounded_) update(index);
+        numerics::TraverseBvh(bvh_, ray.origin, direction, 0.0, ray.max_distance,
+                              [&](const std::uint32_t prim, double& t_max) {
+            update(bounded_[prim]);
+            if (closest) t_max = std::min(t_max, closest->distance);
+            return false;
+        });
+        if (!closest) return {};
+        return {*closest};
+    }
+
+    // 候補 (レイと交差しうる対象+範囲を持たない対象) を列挙順に狭域判定する
+    std::vector<std::size_t> candidates = unbounded_;
+    numerics::TraverseBvh(bvh_, ray.origin, direction, 0.0, ray.max_distance,
+                          [&](const std::uint32_t prim, double&) {
+        candidates.push_back(bounded_[prim]);
+        return false;
+    });
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<RayCastHit> hits;
+    for (const auto index : candidates) {
+        for (auto& hit : IntersectTarget(
+                targets_[index], ray.origin, direction, ray.max_distance)) {
+            hits.push_back(std::move(hit));
+        }
+    }
+    std::stable_sort(hits.begin(), hits.end(),
+                     [](const RayCastHit& a, const RayCastHit& b) {
+        return a.distance < b.distance;
+    });
+    return hits;
+}
+
+std::vector<std::vector<RayCastHit>> i_models::RayCaster::CastRays(
+        const Ray* rays, const std::size_t count, const RayCastMode mode) const {
+    std::vector<std::vector<RayCastHit>> results(count);
+    ParallelFor(count, [&](const std::size_t i) {
+        results[i] = CastRay(rays[i], mode);
+    });
+    return results;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file models/tessellation.cpp
+ * @brief Assembly内の曲面の、隙間のない1つの三角形メッシュへの変換の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/models/tessellation.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "igesio/common/id_generator.h"
+#include "igesio/entities/entity_base.h"
+#include "igesio/entities/interfaces/i_surface.h"
+#include "igesio/entities/views/surface_view.h"
+#include "igesio/entities/surfaces/algorithms/tessellation_cache.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_models = igesio::models;
+
+/// @brief キーへ値を結合する (CombineGeometryKeyと同じboost::hash_combine方式)
+std::uint64_t Combine(std::uint64_t seed, const double value) {
+    constexpr std::uint64_t kGolden = 0x9e3779b97f4a7c15ULL;
+    seed ^= static_cast<std::uint64_t>(std::hash<double>{}(value))
+            + kGolden + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+}  // namespace
+
+
+
+igesio::numerics::TriangleMeshf i_models::TessellateAssembly(
+        const Assembly& assembly, const entities::WatertightMeshParams& params) {
+    // 遅延幾何キャッシュを事前構築し、以降の並列計算を読み取りのみにする
+    assembly.PrepareGeometryCaches(true);
+
+    // 形状キー: 各曲面の形状 (ID・リビジョン) とワールド配置を順に結合する
+    std::vector<ObjectID> ids;
+    std::vector<std::shared_ptr<const i_ent::ISurface>> faces;
+    std::uint64_t geometry = 0;
+    const auto entities = assembly.FindEntities(
+            [](const i_ent::IEntityIdentifier&) { return true; }, true);
+    for (const auto& entity : entities) {
+        if (!entity || !dynamic_cast<const i_ent::ISurface*>(entity.get())) continue;
+        // 物理従属のメンバは親を通じて分割される (GetWorldBoundingBoxと同じ規則)
+        const auto eb = std::dynamic_pointer_cast<const i_ent::EntityBase>(entity);
+        if (eb && eb->GetSubordinateEntitySwitch()
+                == i_ent::SubordinateEntitySwitch::kPhysicallyDependent) {
+            continue;
+        }
+        auto view = assembly.GetSurfaceView(entity->GetID(), CoordFrame::World());
+        if (!view) continue;
+        ids.push_back(entity->GetID());
+        faces.push_back(std::move(view));
+        geometry = i_ent::CombineGeometryKeyRecursive(geometry, *entity);
+        if (const auto placement =
+                    assembly.ResolvePlacement(entity->GetID(), CoordFrame::World())) {
+            for (Eigen::Index k = 0; k < placement->size(); ++k) {
+                geometry = Combine(geometry, (*placement)(k));
+            }
+        }
+    }
+
+    // 形状・配置が変わっていなければ前回の結果を再利用する
+    const i_ent::TessellationCacheKey key{
+            assembly.GetID(), geometry, i_ent::HashTessellationParams(params)};
+    const auto mesh = i_ent::GetSharedTessellationCache().GetOrBuild(key, [&]() {
+        auto result = i_ent::TessellateWatertight(faces, params);
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            result.groups[i].name = ToString(ids[i]);
+        }
+        return result;
+    });
+    return *mesh;
+}
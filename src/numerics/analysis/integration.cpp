@@ -13,7 +13,6 @@
 #include <stdexcept>
 #include <string>
 
-#include "igesio/numerics/core/constexpr_math.h"
 
 namespace {
 
@@ -25,9 +24,19 @@ namespace i_num = igesio::numerics;
 i_num::IntegrationOptions
 i_num::IntegrationOptions::GaussLegendre(
         const size_t n_points, const size_t max_recursion_depth) {
-    return IntegrationOptions{
-        IntegrateMethod::kGaussLegendre, n_points, max_recursion_depth
-    };
+    IntegrationOptions options;
+    options.method = IntegrateMethod::kGaussLegendre;
+    options.n_points = n_points;
+    options.max_recursion_depth = max_recursion_depth;
+    return options;
+}
+
+i_num::IntegrationOptions
+i_num::IntegrationOptions::GaussKronrod(const size_t max_subdivisions) {
+    IntegrationOptions options;
+    options.method = IntegrateMethod::kGaussKronrod;
+    options.max_subdivisions = max_subdivisions;
+    return options;
 }
 
 void i_num::IntegrationOptions::Check() const {
@@ -41,6 +50,13 @@ void i_num::IntegrationOptions::Check() const {
         }
         return;
     }
+    if (method == i_num::IntegrateMethod::kGaussKronrod) {
+        if (max_subdivisions == 0) {
+            throw std::invalid_argument(
+                "Integrate: max_subdivisions must be greater than 0.");
+        }
+        return;
+    }
     throw std::invalid_argument(
         "Integrate: Unsupported integration method.");
 }
@@ -52,67 +68,13 @@ void i_num::IntegrationOptions::Check() const {
 
 namespace {
 
-/// @brief 1点ガウス-ルジャンドル求積法の分点x_0
-constexpr std::array<double, 1> kGaussLegendre1Points = {
-    0.0
-};
-/// @brief 1点ガウス-ルジャンドル求積法の重みw_0
-constexpr std::array<double, 1> kGaussLegendre1Weights = {
-    2.0
-};
-/// @brief 2点ガウス-ルジャンドル求積法の分点x_i
-constexpr std::array<double, 2> kGaussLegendre2Points = {
-    -1.0 / i_num::sqrt_c(3.0), 1.0 / i_num::sqrt_c(3.0)
-};
-/// @brief 2点ガウス-ルジャンドル求積法の重みw_i
-constexpr std::array<double, 2> kGaussLegendre2Weights = {
-    1.0, 1.0
-};
-/// @brief 3点ガウス-ルジャンドル求積法の分点x_i
-constexpr std::array<double, 3> kGaussLegendre3Points = {
-    -i_num::sqrt_c(3.0 / 5.0), 0.0, i_num::sqrt_c(3.0 / 5.0)
-};
-/// @brief 3点ガウス-ルジャンドル求積法の重みw_i
-constexpr std::array<double, 3> kGaussLegendre3Weights = {
-    5.0 / 9.0, 8.0 / 9.0, 5.0 / 9.0
-};
-/// @brief 4点ガウス-ルジャンドル求積法の分点x_i
-constexpr std::array<double, 4> kGaussLegendre4Points = {
-    -1.0 / i_num::sqrt_c(3.0/7.0 + 2.0/7.0 * i_num::sqrt_c(6.0/5.0)),
-    -1.0 / i_num::sqrt_c(3.0/7.0 - 2.0/7.0 * i_num::sqrt_c(6.0/5.0)),
-     1.0 / i_num::sqrt_c(3.0/7.0 - 2.0/7.0 * i_num::sqrt_c(6.0/5.0)),
-     1.0 / i_num::sqrt_c(3.0/7.0 + 2.0/7.0 * i_num::sqrt_c(6.0/5.0))
-};
-/// @brief 4点ガウス-ルジャンドル求積法の重みw_i
-constexpr std::array<double, 4> kGaussLegendre4Weights = {
-    (18.0 - i_num::sqrt_c(30.0)) / 36.0,
-    (18.0 + i_num::sqrt_c(30.0)) / 36.0,
-    (18.0 + i_num::sqrt_c(30.0)) / 36.0,
-    (18.0 - i_num::sqrt_c(30.0)) / 36.0
-};
-/// @brief 5点ガウス-ルジャンドル求積法の分点x_i
-constexpr std::array<double, 5> kGaussLegendre5Points = {
-    -1.0 / 3.0 * i_num::sqrt_c(5.0 + 2.0 * i_num::sqrt_c(10.0 / 7.0)),
-    -1.0 / 3.0 * i_num::sqrt_c(5.0 - 2.0 * i_num::sqrt_c(10.0 / 7.0)),
-    0.0,
-    1.0 / 3.0 * i_num::sqrt_c(5.0 - 2.0 * i_num::sqrt_c(10.0 / 7.0)),
-    1.0 / 3.0 * i_num::sqrt_c(5.0 + 2.0 * i_num::sqrt_c(10.0 / 7.0))
-};
-/// @brief 5点ガウス-ルジャンドル求積法の重みw_i
-constexpr std::array<double, 5> kGaussLegendre5Weights = {
-    (322.0 - 13.0 * i_num::sqrt_c(70.0)) / 900.0,
-    (322.0 + 13.0 * i_num::sqrt_c(70.0)) / 900.0,
-    128.0 / 225.0,
-    (322.0 + 13.0 * i_num::sqrt_c(70.0)) / 900.0,
-    (322.0 - 13.0 * i_num::sqrt_c(70.0)) / 900.0
-};
-
 /// @brief ガウス=ルジャンドル求積法による数値積分
 /// @param f 被積分関数 f(x) (x ∈ [x_min, x_max])
 /// @param range 積分区間の範囲 [x_min, x_max]
 /// @param n_points ガウス点の数（デフォルトは5点）
 /// @return 積分値 ∫[x_min, x_max] f(x) dx
 /// @throw std::invalid_argument n_pointsがサポート範囲外の場合
+/// @note 分点・重みはgauss_quadrature.hの表 (1～20点) を使用する
 double GaussLegendreIntegrateImpl(
         const std::function<double(double)>& f,
         const std::array<double, 2>& range,
@@ -123,48 +85,10 @@ double GaussLegendreIntegrateImpl(
             std::to_string(i_num::kGaussLegendreIntegrateMaxPoints) + " points.");
     }
 
-    // 積分区間 [x_min, x_max] を t ∈ [-1, 1] に変換
-    // x = at + b,   a = (x_max - x_min) / 2, b = (x_max + x_min) / 2
-    double half_width = (range[1] - range[0]) / 2.0;
-    double center = (range[1] + range[0]) / 2.0;
-
-    // 積分値の計算
     //   ∫[x_min, x_max] f(x) dx
     // = ∫[-1, 1] f(at + b) * a dt
     // ≈ a * Σ[i=0 to n_points-1] w_i * f(a * x_i + b)
-    double integral = 0.0;
-    for (size_t i = 0; i < n_points; ++i) {
-        switch (n_points) {
-            case 1:
-                // 1点ガウス-ルジャンドル求積法
-                integral += kGaussLegendre1Weights[i] *
-                            f(half_width * kGaussLegendre1Points[i] + center);
-                break;
-            case 2:
-                // 2点ガウス-ルジャンドル求積法
-                integral += kGaussLegendre2Weights[i] *
-                            f(half_width * kGaussLegendre2Points[i] + center);
-                break;
-            case 3:
-                // 3点ガウス-ルジャンドル求積法
-                integral += kGaussLegendre3Weights[i] *
-                            f(half_width * kGaussLegendre3Points[i] + center);
-                break;
-            case 4:
-                // 4点ガウス-ルジャンドル求積法
-                integral += kGaussLegendre4Weights[i] *
-                            f(half_width * kGaussLegendre4Points[i] + center);
-                break;
-            case 5:
-                // 5点ガウス-ルジャンドル求積法
-                integral += kGaussLegendre5Weights[i] *
-                            f(half_width * kGaussLegendre5Points[i] + center);
-                break;
-            default:
-                integral += 0.0;  // 到達しないはず
-        }
-    }
-    return half_width * integral;
+    return i_num::GaussLegendreFixed(f, range, n_points);
 }
 
 }  // namespace
@@ -357,6 +281,12 @@ double i_num::Integrate(
 
     if (range[0] == range[1]) return 0.0;
 
+    // 適応型ガウス=クロンロッド求積法は区間の分割・向きの処理を内部で行う
+    if (options.method == IntegrateMethod::kGaussKronrod) {
+        return AdaptiveGaussKronrod(f, range, tolerance,
+                                    options.max_subdivisions).value;
+    }
+
     // 積分区間が逆の場合
     if (range[0] > range[1]) {
         return -Integrate(f, {range[1], range[0]}, tolerance, options);
@@ -376,6 +306,12 @@ double i_num::Integrate(
 
     if (range[0] == range[1] || range[2] == range[3]) return 0.0;
 
+    // 適応型ガウス=クロンロッド求積法は区間の分割・向きの処理を内部で行う
+    if (options.method == IntegrateMethod::kGaussKronrod) {
+        return AdaptiveGaussKronrod2D(f, range, tolerance,
+                                      options.max_subdivisions).value;
+    }
+
     // 積分区間が逆の場合
     if (range[0] > range[1] && range[2] > range[3]) {
         return Integrate(f, {range[1], range[0], range[3], range[2]},
@@ -0,0 +1,267 @@
+/**
+ * @file numerics/geometric/bvh.cpp
+ * @brief 軸平行バウンディングボックスの階層 (BVH) の構築
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/numerics/geometric/bvh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace i_num = igesio::numerics;
+using igesio::Vector3d;
+
+/// @brief ノードのボックスを拡大する相対量
+/// @note 根のボックスの対角長と座標の絶対値の最大値の和に乗じて使用する
+constexpr double kBoundsPadding = 1e-9;
+
+/// @brief 構築中に使用する軸平行ボックス
+struct Aabb {
+    /// @brief 最小点
+    Vector3d lower = Vector3d::Constant(std::numeric_limits<double>::infinity());
+    /// @brief 最大点
+    Vector3d upper = Vector3d::Constant(-std::numeric_limits<double>::infinity());
+
+    /// @brief ボックスを拡張して指定範囲を包含させる
+    /// @param l 包含させる範囲の最小点
+    /// @param u 包含させる範囲の最大点
+    void Extend(const Vector3d& l, const Vector3d& u) {
+        for (int axis = 0; axis < 3; ++axis) {
+            lower[axis] = std::min(lower[axis], l[axis]);
+            upper[axis] = std::max(upper[axis], u[axis]);
+        }
+    }
+
+    /// @brief 表面積の1/2を計算する (SAHの比較のみに使用するため定数倍は省く)
+    /// @return 表面積の1/2. 空のボックスの場合は0
+    double HalfArea() const {
+        if (lower[0] > upper[0]) return 0.0;
+        const Vector3d d = upper - lower;
+        return d[0] * d[1] + d[1] * d[2] + d[2] * d[0];
+    }
+};
+
+/// @brief 構築待ちのノード
+struct BuildTask {
+    /// @brief ノード番号
+    std::uint32_t node;
+    /// @brief primitive_indices内の範囲の先頭
+    std::uint32_t begin;
+    /// @brief primitive_indices内の範囲の末尾 (含まない)
+    std::uint32_t end;
+};
+
+/// @brief 分割位置
+struct Split {
+    /// @brief 分割軸
+    int axis = -1;
+    /// @brief 分割するビン境界 (ビン番号がこれ未満のプリミティブを左へ)
+    std::size_t bin = 0;
+    /// @brief SAHコスト
+    double cost = std::numeric_limits<double>::infinity();
+};
+
+/// @brief 重心の位置からビン番号を求める
+/// @param centroid 重心の座標値 (分割軸の成分)
+/// @param lower 重心範囲の最小値
+/// @param scale ビン数/重心範囲の幅
+/// @param bin_count ビン数
+/// @return ビン番号 [0, bin_count)
+std::size_t BinIndex(const double centroid, const double lower,
+                     const double scale, const std::size_t bin_count) {
+    const auto bin = static_cast<std::size_t>((centroid - lower) * scale);
+    return std::min(bin, bin_count - 1);
+}
+
+/// @brief SAHコストが最小となるビン境界を探す
+/// @param indices プリミティブ番号の並び
+/// @param task 分割対象の範囲
+/// @param centroids 各プリミティブの重心
+/// @param lowers 各プリミティブのボックスの最小点
+/// @param uppers 各プリミティブのボックスの最大点
+/// @param centroid_box 範囲内の重心を包含するボックス
+/// @param bin_count ビン数
+/// @return 最良の分割位置. 重心が全軸で一致する場合はaxis = -1
+Split FindSahSplit(const std::vector<std::uint32_t>& indices,
+                   const BuildTask& task,
+                   const std::vector<Vector3d>& centroids,
+                   const std::vector<Vector3d>& lowers,
+                   const std::vector<Vector3d>& uppers,
+                   const Aabb& centroid_box, const std::size_t bin_count) {
+    Split best;
+    std::vector<Aabb> bins(bin_count);
+    std::vector<std::size_t> counts(bin_count);
+    std::vector<double> right_areas(bin_count);
+    std::vector<std::size_t> right_counts(bin_count);
+    for (int axis = 0; axis < 3; ++axis) {
+        const double extent = centroid_box.upper[axis] - centroid_box.lower[axis];
+        if (!(extent > 0.0)) continue;
+        const double scale = static_cast<double>(bin_count) / extent;
+
+        std::fill(bins.begin(), bins.end(), Aabb{});
+        std::fill(counts.begin(), counts.end(), 0);
+        for (auto i = task.begin; i < task.end; ++i) {
+            const auto prim = indices[i];
+            const auto bin = BinIndex(centroids[prim][axis],
+                                      centroid_box.lower[axis], scale, bin_count);
+            bins[bin].Extend(lowers[prim], uppers[prim]);
+            ++counts[bin];
+        }
+
+        // 右側 (ビンb以降) の面積・個数を累積する
+        Aabb right;
+        std::size_t right_count = 0;
+        for (std::size_t b = bin_count - 1; b > 0; --b) {
+            right.Extend(bins[b].lower, bins[b].upper);
+            right_count += counts[b];
+            right_areas[b] = right.HalfArea();
+            right_counts[b] = right_count;
+        }
+
+        // 左側を累積しながら各境界のコストを評価する
+        Aabb left;
+        std::size_t left_count = 0;
+        for (std::size_t b = 1; b < bin_count; ++b) {
+            left.Extend(bins[b - 1].lower, bins[b - 1].upper);
+            left_count += counts[b - 1];
+            if (left_count == 0 || right_counts[b] == 0) continue;
+            const double cost = static_cast<double>(left_count) * left.HalfArea()
+                              + static_cast<double>(right_counts[b]) * right_areas[b];
+            if (cost < best.cost) {
+                best.axis = axis;
+                best.bin = b;
+                best.cost = cost;
+            }
+        }
+    }
+    return best;
+}
+
+}  // namespace
+
+
+
+i_num::Bvh i_num::BuildBvh(
+        const std::vector<Vector3d>& lowers, const std::vector<Vector3d>& uppers,
+        const BvhBuildParams& params) {
+    if (lowers.size() != uppers.size()) {
+        throw std::invalid_argument(
+            "BuildBvh: lowers and uppers must have the same size, but got "
+            + std::to_string(lowers.size()) + " and "
+            + std::to_string(uppers.size()));
+    }
+    if (lowers.size() > std::numeric_limits<std::uint32_t>::max() / 2) {
+        throw std::invalid_argument(
+            "BuildBvh: too many primitives (" + std::to_string(lowers.size()) + ")");
+    }
+    if (params.max_leaf_size == 0 || params.bin_count < 2) {
+        throw std::invalid_argument(
+            "BuildBvh: max_leaf_size must be positive and bin_count must be "
+            "at least 2, but got " + std::to_string(params.max_leaf_size)
+            + " and " + std::to_string(params.bin_count));
+    }
+
+    Bvh bvh;
+    const auto n = static_cast<std::uint32_t>(lowers.size());
+    if (n == 0) return bvh;
+
+    bvh.primitive_indices.resize(n);
+    std::iota(bvh.primitive_indices.begin(), bvh.primitive_indices.end(), 0u);
+    std::vector<Vector3d> centroids(n);
+    for (std::uint32_t i = 0; i < n; ++i) {
+        centroids[i] = (lowers[i] + uppers[i]) / 2.0;
+    }
+
+    // 深い木でも再帰の深さに依存しないよう、明示的なスタックで構築する
+    auto& indices = bvh.primitive_indices;
+    bvh.nodes.emplace_back();
+    std::vector<BuildTask> tasks = {{0, 0, n}};
+    while (!tasks.empty()) {
+        const auto task = tasks.back();
+        tasks.pop_back();
+
+        Aabb box, centroid_box;
+        for (auto i = task.begin; i < task.end; ++i) {
+            const auto prim = indices[i];
+            box.Extend(lowers[prim], uppers[prim]);
+            centroid_box.Extend(centroids[prim], centroids[prim]);
+        }
+        bvh.nodes[task.node].lower = box.lower;
+        bvh.nodes[task.node].upper = box.upper;
+
+        const auto count = task.end - task.begin;
+        if (count <= params.max_leaf_size) {
+            bvh.nodes[task.node].first = task.begin;
+            bvh.nodes[task.node].count = count;
+            continue;
+        }
+
+        // SAHで分割し、分割できない場合 (重心の一致等) は重心の中央値で二分する
+        auto mid = task.begin;
+        const auto split = FindSahSplit(indices, task, centroids, lowers, uppers,
+                                        centroid_box, params.bin_count);
+        if (split.axis >= 0) {
+            const double extent = centroid_box.upper[split.axis]
+                                - centroid_box.lower[split.axis];
+            const double scale = static_cast<double>(params.bin_count) / extent;
+            const auto it = std::partition(
+                    indices.begin() + task.begin, indices.begin() + task.end,
+                    [&](const std::uint32_t prim) {
+                        return BinIndex(centroids[prim][split.axis],
+                                        centroid_box.lower[split.axis], scale,
+                                        params.bin_count) < split.bin;
+                    });
+            mid = static_cast<std::uint32_t>(it - indices.begin());
+        }
+        if (mid == task.begin || mid == task.end) {
+            int axis = 0;
+            for (int a = 1; a < 3; ++a) {
+                if (centroid_box.upper[a] - centroid_box.lower[a] >
+                    centroid_box.upper[axis] - centroid_box.lower[axis]) {
+                    axis = a;
+                }
+            }
+            mid = task.begin + count / 2;
+            std::nth_element(
+                    indices.begin() + task.begin, indices.begin() + mid,
+                    indices.begin() + task.end,
+                    [&centroids, axis](const std::uint32_t l, const std::uint32_t r) {
+                        return centroids[l][axis] < centroids[r][axis];
+                    });
+        }
+
+        const auto left = static_cast<std::uint32_t>(bvh.nodes.size());
+        bvh.nodes.emplace_back();
+        bvh.nodes.emplace_back();
+        bvh.nodes[task.node].first = left;
+        bvh.nodes[task.node].count = 0;
+        tasks.push_back({left + 1, mid, task.end});
+        tasks.push_back({left, task.begin, mid});
+    }
+
+    // 走査時の丸め誤差に備え、全ノードのボックスを一様に拡大する
+    const auto& root = bvh.nodes[0];
+    const double magnitude = (root.upper - root.lower).norm();
+    double max_abs = 0.0;
+    for (int axis = 0; axis < 3; ++axis) {
+        max_abs = std::max({max_abs, std::abs(root.lower[axis]),
+                            std::abs(root.upper[axis])});
+    }
+    const double padding = kBoundsPadding * (magnitude + max_abs);
+    const Vector3d pad = Vector3d::Constant(padding);
+    for (auto& node : bvh.nodes) {
+        node.lower -= pad;
+        node.upper += pad;
+    }
+    return bvh;
+}
@@ -8,7 +8,9 @@
 #include "igesio/numerics/geometric/polygon.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
 #include <string>
@@ -19,6 +21,36 @@
 
 namespace {
 
+/// @brief 1辺のwinding numberへの寄与を計算する
+/// @param px 判定する点のx座標
+/// @param py 判定する点のy座標
+/// @param a 辺の始点
+/// @param b 辺の終点
+/// @return 点から+x方向への半直線と辺が上向きに交差し、点が辺の左側にあれば+1、
+///         下向きに交差し、点が辺の右側にあれば-1、それ以外は0
+int WindingContribution(
+        const double px, const double py,
+        const igesio::Vector3d& a, const igesio::Vector3d& b) {
+    const double ax = a[0], ay = a[1];
+    const double bx = b[0], by = b[1];
+    if (ay <= py) {
+        if (by > py) {
+            // 上向き交差: 点が辺の左側なら+1
+            if ((bx - ax) * (py - ay) - (by - ay) * (px - ax) > 0.0) {
+                return 1;
+            }
+        }
+    } else {
+        if (by <= py) {
+            // 下向き交差: 点が辺の右側なら-1
+            if ((bx - ax) * (py - ay) - (by - ay) * (px - ax) < 0.0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
 /// @brief Non-Zero Winding則に基づくwinding numberを計算する
 /// @param point 判定する点 (x, y 成分のみ使用)
 /// @param vertices 多角形の頂点列
@@ -28,26 +60,9 @@ int WindingNumber(
         const std::vector<igesio::Vector3d>& vertices) {
     int winding = 0;
     const int n = static_cast<int>(vertices.size());
-    const double px = point[0], py = point[1];
     for (int i = 0; i < n; ++i) {
-        const double ax = vertices[i][0], ay = vertices[i][1];
-        const double bx = vertices[(i + 1) % n][0];
-        const double by = vertices[(i + 1) % n][1];
-        if (ay <= py) {
-            if (by > py) {
-                // 上向き交差: 点が辺の左側なら+1
-                if ((bx - ax) * (py - ay) - (by - ay) * (px - ax) > 0.0) {
-                    ++winding;
-                }
-            }
-        } else {
-            if (by <= py) {
-                // 下向き交差: 点が辺の右側なら-1
-                if ((bx - ax) * (py - ay) - (by - ay) * (px - ax) < 0.0) {
-                    --winding;
-                }
-            }
-        }
+        winding += WindingContribution(
+                point[0], point[1], vertices[i], vertices[(i + 1) % n]);
     }
     return winding;
 }
@@ -118,12 +133,29 @@ std::vector<igesio::Vector3d> ExtractVerticesRange(
 /// @param param_start パラメータ範囲の開始値
 /// @param param_end パラメータ範囲の終了値
 /// @param is_wrap true の場合は折り返し (param_start > param_end) として処理する
+/// @param is_sorted true の場合はcurve_paramsが昇順であるとして二分探索で範囲を求める
+///        (結果は線形探索と同じ)
 /// @return 対応する頂点列 (param_start から param_end の順)
 std::vector<igesio::Vector3d> ExtractApproxByParam(
         const igesio::numerics::PolygonData& approx,
-        double param_start, double param_end, bool is_wrap) {
+        double param_start, double param_end, bool is_wrap,
+        bool is_sorted = false) {
     const int n = approx.Count();
     std::vector<igesio::Vector3d> result;
+    if (is_sorted) {
+        const auto& params = approx.curve_params;
+        const auto first = static_cast<int>(std::lower_bound(
+                params.begin(), params.begin() + n, param_start) - params.begin());
+        const auto last = static_cast<int>(std::upper_bound(
+                params.begin(), params.begin() + n, param_end) - params.begin());
+        if (!is_wrap) {
+            for (int i = first; i < last; ++i) result.push_back(approx.vertices[i]);
+            return result;
+        }
+        for (int i = first; i < n; ++i) result.push_back(approx.vertices[i]);
+        for (int i = 0; i < last; ++i) result.push_back(approx.vertices[i]);
+        return result;
+    }
     if (!is_wrap) {
         for (int i = 0; i < n; ++i) {
             const double p = approx.curve_params[i];
@@ -147,6 +179,240 @@ std::vector<igesio::Vector3d> ExtractApproxByParam(
     return result;
 }
 
+/// @brief 内包・外包多角形の間にある点を、最近傍辺に基づき詳細に判定する
+/// @param point 判定する点 (x, y 成分のみ使用)
+/// @param polygons 閉曲線C(u)の内包・外包・近似多角形
+/// @param circ_nearest 外包多角形の最近傍辺のインデックスと距離の二乗
+/// @param insc_nearest 内包多角形の最近傍辺のインデックスと距離の二乗
+/// @param approx_sorted 近似多角形のcurve_paramsが昇順か
+/// @return 点が曲線C(u)の内部に存在する場合 true
+bool IsPointInBoundaryZone(
+        const igesio::Vector3d& point,
+        const igesio::numerics::CurveContainmentPolygons& polygons,
+        const std::pair<int, double>& circ_nearest,
+        const std::pair<int, double>& insc_nearest,
+        const bool approx_sorted) {
+    using igesio::Vector3d;
+    using igesio::numerics::PolygonData;
+    const auto [circ_idx, circ_d] = circ_nearest;
+    const auto [insc_idx, insc_d] = insc_nearest;
+
+    const bool use_inscribed = (insc_d <= circ_d);
+    const PolygonData& nearest_poly = use_inscribed
+        ? polygons.inscribed : polygons.circumscribed;
+    const int nearest_edge = use_inscribed ? insc_idx : circ_idx;
+
+    // パラメータ範囲の取得: i_start > i_end の場合に折り返しとする
+    const auto [i_start, i_end] = nearest_poly.GetCurveParamIndex(nearest_edge);
+    const bool is_wrap = (i_start > i_end);
+
+    const std::vector<Vector3d> poly_verts = ExtractVerticesRange(
+        nearest_poly, i_start, i_end, is_wrap);
+    const double param_start = nearest_poly.curve_params[i_start];
+    const double param_end   = nearest_poly.curve_params[i_end];
+
+    // 近似多角形から対応するパラメータ範囲の頂点を取得
+    const std::vector<Vector3d> approx_verts = ExtractApproxByParam(
+        polygons.approximate, param_start, param_end, is_wrap, approx_sorted);
+
+    // poly_verts/approx_vertsが空の場合 (退化したトリム境界などで対応頂点が無い)、
+    // 再構成多角形を形成できない。下の`.end()-1`/`.rend()-1`は空 (デフォルト構築)
+    // vectorのvalue-initialized iteratorをseekしてクラッシュ (MSVCデバッグアサート
+    // "cannot seek value-initialized vector iterator") するため、ここで安全に返す。
+    // 退化したトリム境界は領域を囲まないため「外部」とみなす (C層: 退化データでも例外/
+    // 未定義動作を起こさない)。
+    if (poly_verts.empty() || approx_verts.empty()) {
+        return false;
+    }
+
+    // 再構成多角形の構築
+    // poly_verts (順方向, 末端除く) + approx_verts (逆方向, 末端除く) で閉多角形を形成する
+    std::vector<Vector3d> reconstructed;
+    reconstructed.insert(reconstructed.end(),
+        poly_verts.begin(), poly_verts.end() - 1);
+    reconstructed.insert(reconstructed.end(),
+        approx_verts.rbegin(), approx_verts.rend() - 1);
+
+    // 再構成多角形による内外判定
+    // 内包多角形の辺を使用: 内部→内部、外部→外部
+    // 外包多角形の辺を使用: 内部→外部 (反転)、外部→内部 (反転)
+    const bool inside = (WindingNumber(point, reconstructed) != 0);
+    return use_inscribed ? inside : !inside;
+}
+
+
+
+/**
+ * 格子による内外判定の高速化
+ */
+
+/// @brief 格子の1軸あたりの最大セル数
+constexpr int kMaxGridCellsPerAxis = 1024;
+
+/// @brief 座標値からセル番号を求める
+/// @param value 座標値
+/// @param min 格子の範囲の最小値
+/// @param inv セル幅の逆数
+/// @param count セル数
+/// @return セル番号 [0, count). 範囲外の座標値は端のセルへ丸める
+/// @note valueについて単調非減少であるため、区間 [a, b] 内の点のセル番号は
+///       [CellIndex(a), CellIndex(b)] に含まれる (辺とセルの対応付けに使用する)
+int CellIndex(const double value, const double min,
+              const double inv, const int count) {
+    const double f = std::floor((value - min) * inv);
+    if (!(f > 0.0)) return 0;
+    if (f >= static_cast<double>(count - 1)) return count - 1;
+    return static_cast<int>(f);
+}
+
+/// @brief 指定行と交わる辺のみを用いてwinding numberを計算する
+/// @note 点のy座標を含む辺は全て当該行に含まれるため、WindingNumberと同じ値となる
+int WindingNumberInRow(
+        const double px, const double py,
+        const std::vector<igesio::Vector3d>& vertices,
+        const igesio::numerics::PolygonEdgeGrid& edge_grid, const int row) {
+    const std::size_t n = vertices.size();
+    int winding = 0;
+    for (auto k = edge_grid.row_offsets[row]; k < edge_grid.row_offsets[row + 1]; ++k) {
+        const auto i = edge_grid.row_edges[k];
+        winding += WindingContribution(px, py, vertices[i], vertices[(i + 1) % n]);
+    }
+    return winding;
+}
+
+/// @brief 多角形の辺の索引を構築する
+/// @param polygon 対象の多角形
+/// @param grid 格子の範囲・分割数 (nx, ny等が設定済みであること)
+/// @return 辺の索引
+igesio::numerics::PolygonEdgeGrid BuildEdgeGrid(
+        const igesio::numerics::PolygonData& polygon,
+        const igesio::numerics::PolygonContainmentGrid& grid) {
+    igesio::numerics::PolygonEdgeGrid edge_grid;
+    const auto& v = polygon.vertices;
+    const std::size_t m = v.size();
+    const auto cell_count = static_cast<std::size_t>(grid.nx) * grid.ny;
+
+    // 各辺のバウンディングボックスが覆うセル範囲 [ix0, ix1] × [iy0, iy1]
+    std::vector<std::array<int, 4>> ranges(m);
+    for (std::size_t i = 0; i < m; ++i) {
+        const auto& a = v[i];
+        const auto& b = v[(i + 1) % m];
+        ranges[i] = {
+            CellIndex(std::min(a[0], b[0]), grid.x_min, grid.inv_cell_width, grid.nx),
+            CellIndex(std::max(a[0], b[0]), grid.x_min, grid.inv_cell_width, grid.nx),
+            CellIndex(std::min(a[1], b[1]), grid.y_min, grid.inv_cell_height, grid.ny),
+            CellIndex(std::max(a[1], b[1]), grid.y_min, grid.inv_cell_height, grid.ny)};
+    }
+
+    // 行・セルごとの辺の数を数え、CSR形式で辺番号を格納する
+    edge_grid.row_offsets.assign(grid.ny + 1, 0);
+    edge_grid.cell_offsets.assign(cell_count + 1, 0);
+    for (const auto& [ix0, ix1, iy0, iy1] : ranges) {
+        for (int iy = iy0; iy <= iy1; ++iy) {
+            ++edge_grid.row_offsets[iy + 1];
+            for (int ix = ix0; ix <= ix1; ++ix) {
+                ++edge_grid.cell_offsets[static_cast<std::size_t>(iy) * grid.nx + ix + 1];
+            }
+        }
+    }
+    for (int iy = 0; iy < grid.ny; ++iy) {
+        edge_grid.row_offsets[iy + 1] += edge_grid.row_offsets[iy];
+    }
+    for (std::size_t c = 0; c < cell_count; ++c) {
+        edge_grid.cell_offsets[c + 1] += edge_grid.cell_offsets[c];
+    }
+    edge_grid.row_edges.resize(edge_grid.row_offsets.back());
+    edge_grid.cell_edges.resize(edge_grid.cell_offsets.back());
+    auto row_fill = edge_grid.row_offsets;
+    auto cell_fill = edge_grid.cell_offsets;
+    for (std::size_t i = 0; i < m; ++i) {
+        const auto [ix0, ix1, iy0, iy1] = ranges[i];
+        for (int iy = iy0; iy <= iy1; ++iy) {
+            edge_grid.row_edges[row_fill[iy]++] = static_cast<std::uint32_t>(i);
+            for (int ix = ix0; ix <= ix1; ++ix) {
+                const auto c = static_cast<std::size_t>(iy) * grid.nx + ix;
+                edge_grid.cell_edges[cell_fill[c]++] = static_cast<std::uint32_t>(i);
+            }
+        }
+    }
+
+    // 辺と交わらないセルはwinding numberが一定のため、セル中心で求めておく.
+    // 中心が丸め誤差で隣のセルに属する場合 (極小のセル) は一定とみなさない.
+    edge_grid.cell_winding.assign(
+            cell_count, igesio::numerics::PolygonEdgeGrid::kVaryingWinding);
+    for (int iy = 0; iy < grid.ny; ++iy) {
+        const double cy = (grid.inv_cell_height > 0.0)
+                        ? grid.y_min + (iy + 0.5) / grid.inv_cell_height : grid.y_min;
+        if (CellIndex(cy, grid.y_min, grid.inv_cell_height, grid.ny) != iy) continue;
+        for (int ix = 0; ix < grid.nx; ++ix) {
+            const auto c = static_cast<std::size_t>(iy) * grid.nx + ix;
+            if (edge_grid.cell_offsets[c] != edge_grid.cell_offsets[c + 1]) continue;
+            const double cx = (grid.inv_cell_width > 0.0)
+                            ? grid.x_min + (ix + 0.5) / grid.inv_cell_width : grid.x_min;
+            if (CellIndex(cx, grid.x_min, grid.inv_cell_width, grid.nx) != ix) continue;
+            edge_grid.cell_winding[c] = WindingNumberInRow(cx, cy, v, edge_grid, iy);
+        }
+    }
+    return edge_grid;
+}
+
+/// @brief 格子を用いて、多角形の全辺の中から点に最も近い辺を探す
+/// @param point 判定する点 (x, y 成分のみ使用)
+/// @param polygon 対象の多角形
+/// @param grid 格子
+/// @param edge_grid polygonの辺の索引
+/// @param ix 点を含む (端へ丸めた) セルのx方向の番号
+/// @param iy 点を含むセルのy方向の番号
+/// @return (最近傍辺のインデックス, 距離の二乗). FindNearestEdgeと同じ結果
+///         (距離が等しい場合はインデックスが最小の辺)
+/// @note 点を含むセルから外側へ1周ずつ探索し、未探索のセルとの距離の下限が
+///       暫定の最小距離を超えた時点で打ち切る
+std::pair<int, double> FindNearestEdgeInGrid(
+        const igesio::Vector3d& point,
+        const igesio::numerics::PolygonData& polygon,
+        const igesio::numerics::PolygonContainmentGrid& grid,
+        const igesio::numerics::PolygonEdgeGrid& edge_grid,
+        const int ix, const int iy) {
+    const int m = polygon.Count();
+    double min_d = std::numeric_limits<double>::infinity();
+    int nearest = 0;
+    if (m == 0) return {nearest, min_d};
+
+    const auto visit = [&](const int cx, const int cy) {
+        if (cx < 0 || cy < 0 || cx >= grid.nx || cy >= grid.ny) return;
+        const auto c = static_cast<std::size_t>(cy) * grid.nx + cx;
+        for (auto k = edge_grid.cell_offsets[c]; k < edge_grid.cell_offsets[c + 1]; ++k) {
+            const auto i = static_cast<int>(edge_grid.cell_edges[k]);
+            const double d = PointSegmentDistSq(
+                point, polygon.vertices[i], polygon.vertices[(i + 1) % m]);
+            if (d < min_d || (d == min_d && i < nearest)) {
+                min_d = d;
+                nearest = i;
+            }
+        }
+    };
+
+    const int max_ring = std::max({ix, grid.nx - 1 - ix, iy, grid.ny - 1 - iy});
+    for (int r = 0; r <= max_ring; ++r) {
+        // 周rのセル内の点と、点との距離の下限
+        const double lower = (r - 1) * grid.cell_size - grid.slack;
+        if (r > 0 && lower > 0.0 && min_d < lower * lower) break;
+        if (r == 0) {
+            visit(ix, iy);
+            continue;
+        }
+        for (int cx = ix - r; cx <= ix + r; ++cx) {
+            visit(cx, iy - r);
+            visit(cx, iy + r);
+        }
+        for (int cy = iy - r + 1; cy <= iy + r - 1; ++cy) {
+            visit(ix - r, cy);
+            visit(ix + r, cy);
+        }
+    }
+    return {nearest, min_d};
+}
+
 }  // namespace
 
 
@@ -205,52 +471,109 @@ bool IsPointInPolygon(
 
     // 以降は詳細な判定
     // 内包・外包多角形の全辺から最近傍辺を探索
-    const auto [circ_idx, circ_d] = FindNearestEdge(
-        point, polygons.circumscribed);
-    const auto [insc_idx, insc_d] = FindNearestEdge(
-        point, polygons.inscribed);
-
-    const bool use_inscribed = (insc_d <= circ_d);
-    const PolygonData& nearest_poly = use_inscribed
-        ? polygons.inscribed : polygons.circumscribed;
-    const int nearest_edge = use_inscribed ? insc_idx : circ_idx;
+    return IsPointInBoundaryZone(
+        point, polygons,
+        FindNearestEdge(point, polygons.circumscribed),
+        FindNearestEdge(point, polygons.inscribed), false);
+}
 
-    // パラメータ範囲の取得: i_start > i_end の場合に折り返しとする
-    const auto [i_start, i_end] = nearest_poly.GetCurveParamIndex(nearest_edge);
-    const bool is_wrap = (i_start > i_end);
+PolygonContainmentGrid BuildPolygonContainmentGrid(
+        const CurveContainmentPolygons& polygons) {
+    PolygonContainmentGrid grid;
 
-    const std::vector<Vector3d> poly_verts = ExtractVerticesRange(
-        nearest_poly, i_start, i_end, is_wrap);
-    const double param_start = nearest_poly.curve_params[i_start];
-    const double param_end   = nearest_poly.curve_params[i_end];
+    // 外包・内包多角形の頂点を包含する範囲
+    double x_min = std::numeric_limits<double>::infinity(), x_max = -x_min;
+    double y_min = x_min, y_max = -x_min;
+    for (const auto* poly : {&polygons.circumscribed, &polygons.inscribed}) {
+        for (const auto& p : poly->vertices) {
+            if (!std::isfinite(p[0]) || !std::isfinite(p[1])) return grid;
+            x_min = std::min(x_min, p[0]);
+            x_max = std::max(x_max, p[0]);
+            y_min = std::min(y_min, p[1]);
+            y_max = std::max(y_max, p[1]);
+        }
+    }
+    if (x_min > x_max) return grid;  // 頂点なし
 
-    // 近似多角形から対応するパラメータ範囲の頂点を取得
-    const std::vector<Vector3d> approx_verts = ExtractApproxByParam(
-        polygons.approximate, param_start, param_end, is_wrap);
+    // セル数が辺の総数と同程度となるよう、範囲の縦横比に合わせて分割する
+    const double width = x_max - x_min, height = y_max - y_min;
+    const auto edges = static_cast<double>(
+            polygons.circumscribed.Count() + polygons.inscribed.Count());
+    const auto axis_count = [](const double n) {
+        return static_cast<int>(std::clamp(
+                std::ceil(n), 1.0, static_cast<double>(kMaxGridCellsPerAxis)));
+    };
+    if (width > 0.0 && height > 0.0) {
+        grid.nx = axis_count(std::sqrt(edges * width / height));
+        grid.ny = axis_count(std::sqrt(edges * height / width));
+    } else {
+        grid.nx = (width > 0.0) ? axis_count(edges) : 1;
+        grid.ny = (height > 0.0) ? axis_count(edges) : 1;
+    }
 
-    // poly_verts/approx_vertsが空の場合 (退化したトリム境界などで対応頂点が無い)、
-    // 再構成多角形を形成できない。下の`.end()-1`/`.rend()-1`は空 (デフォルト構築)
-    // vectorのvalue-initialized iteratorをseekしてクラッシュ (MSVCデバッグアサート
-    // "cannot seek value-initialized vector iterator") するため、ここで安全に返す。
-    // 退化したトリム境界は領域を囲まないため「外部」とみなす (C層: 退化データでも例外/
-    // 未定義動作を起こさない)。
-    if (poly_verts.empty() || approx_verts.empty()) {
-        return false;
+    grid.x_min = x_min;
+    grid.x_max = x_max;
+    grid.y_min = y_min;
+    grid.y_max = y_max;
+    grid.inv_cell_width = (width > 0.0) ? grid.nx / width : 0.0;
+    grid.inv_cell_height = (height > 0.0) ? grid.ny / height : 0.0;
+    if (width > 0.0 && height > 0.0) {
+        grid.cell_size = std::min(width / grid.nx, height / grid.ny);
+    } else {
+        grid.cell_size = std::max(width / grid.nx, height / grid.ny);
     }
+    const double max_abs = std::max({std::abs(x_min), std::abs(x_max),
+                                     std::abs(y_min), std::abs(y_max)});
+    grid.slack = 1e-9 * (std::hypot(width, height) + max_abs);
 
-    // 再構成多角形の構築
-    // poly_verts (順方向, 末端除く) + approx_verts (逆方向, 末端除く) で閉多角形を形成する
-    std::vector<Vector3d> reconstructed;
-    reconstructed.insert(reconstructed.end(),
-        poly_verts.begin(), poly_verts.end() - 1);
-    reconstructed.insert(reconstructed.end(),
-        approx_verts.rbegin(), approx_verts.rend() - 1);
+    grid.circumscribed = BuildEdgeGrid(polygons.circumscribed, grid);
+    grid.inscribed = BuildEdgeGrid(polygons.inscribed, grid);
+    const auto& params = polygons.approximate.curve_params;
+    grid.approximate_sorted =
+            params.size() >= polygons.approximate.vertices.size() &&
+            std::all_of(params.begin(), params.end(),
+                        [](const double t) { return !std::isnan(t); }) &&
+            std::is_sorted(params.begin(), params.end());
+    return grid;
+}
 
-    // 再構成多角形による内外判定
-    // 内包多角形の辺を使用: 内部→内部、外部→外部
-    // 外包多角形の辺を使用: 内部→外部 (反転)、外部→内部 (反転)
-    const bool inside = (WindingNumber(point, reconstructed) != 0);
-    return use_inscribed ? inside : !inside;
+bool IsPointInPolygon(
+        const Vector3d& point,
+        const CurveContainmentPolygons& polygons,
+        const PolygonContainmentGrid& grid) {
+    if (grid.IsEmpty()) return IsPointInPolygon(point, polygons);
+
+    // 範囲よりy方向の外側にある点は、いずれの辺とも交差しない (winding number = 0)
+    const double px = point[0], py = point[1];
+    if (!(py >= grid.y_min && py <= grid.y_max)) return false;
+
+    const bool in_x_range = (px >= grid.x_min && px <= grid.x_max);
+    const int ix = CellIndex(px, grid.x_min, grid.inv_cell_width, grid.nx);
+    const int iy = CellIndex(py, grid.y_min, grid.inv_cell_height, grid.ny);
+    const auto cell = static_cast<std::size_t>(iy) * grid.nx + ix;
+    const auto winding = [&](const PolygonData& polygon,
+                             const PolygonEdgeGrid& edge_grid) {
+        if (in_x_range) {
+            const int w = edge_grid.cell_winding[cell];
+            if (w != PolygonEdgeGrid::kVaryingWinding) return w;
+        }
+        return WindingNumberInRow(px, py, polygon.vertices, edge_grid, iy);
+    };
+
+    // 外包多角形の外部 → 外部
+    if (winding(polygons.circumscribed, grid.circumscribed) == 0) return false;
+
+    // 内包多角形の内部 → 内部
+    if (winding(polygons.inscribed, grid.inscribed) != 0) return true;
+
+    // 以降は詳細な判定 (最近傍辺を近傍のセルから探索する)
+    return IsPointInBoundaryZone(
+        point, polygons,
+        FindNearestEdgeInGrid(point, polygons.circumscribed, grid,
+                              grid.circumscribed, ix, iy),
+        FindNearestEdgeInGrid(point, polygons.inscribed, grid,
+                              grid.inscribed, ix, iy),
+        grid.approximate_sorted);
 }
 
 }  // namespace igesio::numerics
@@ -0,0 +1,346 @@
+/**
+ * @file numerics/geometric/polygon_triangulation.cpp
+ * @brief 穴あき多角形の三角形分割 (耳切り法) の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/numerics/geometric/polygon_triangulation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+
+namespace i_num = igesio::numerics;
+using igesio::Vector2d;
+
+/// @brief (b - a) × (c - a) (正ならa→b→cが反時計回り)
+double Cross(const Vector2d& a, const Vector2d& b, const Vector2d& c) {
+    return (b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x());
+}
+
+/// @brief 点pが三角形abcの内部または境界上にあるか (三角形の向きは問わない)
+bool IsInTriangle(const Vector2d& a, const Vector2d& b, const Vector2d& c,
+                  const Vector2d& p) {
+    const double d1 = Cross(a, b, p);
+    const double d2 = Cross(b, c, p);
+    const double d3 = Cross(c, a, p);
+    const bool has_neg = d1 < 0.0 || d2 < 0.0 || d3 < 0.0;
+    const bool has_pos = d1 > 0.0 || d2 > 0.0 || d3 > 0.0;
+    return !(has_neg && has_pos);
+}
+
+/// @brief 耳切り法による分割器
+/// @note 頂点を双方向連結リスト (nodes_) で保持する. 穴の併合で架ける橋の
+///       両端の頂点は、往路と復路で別のノードとして複製する
+class EarClipper {
+ public:
+    /// @brief コンストラクタ
+    /// @param points 頂点座標
+    explicit EarClipper(const std::vector<Vector2d>& points) : points_(points) {}
+
+    /// @brief ループから環状リストを作成する
+    /// @param loop 頂点番号の列
+    /// @param ccw trueの場合は反時計回り、falseの場合は時計回りに揃える
+    /// @return 環の先頭ノード. 3頂点未満の場合は-1
+    int CreateRing(const std::vector<std::uint32_t>& loop, const bool ccw) {
+        if (loop.size() < 3) return -1;
+        double area = 0.0;
+        for (std::size_t k = 0; k < loop.size(); ++k) {
+            const auto& a = Point(loop[k]);
+            const auto& b = Point(loop[(k + 1) % loop.size()]);
+            area += a.x() * b.y() - b.x() * a.y();
+        }
+        const bool reverse = (area > 0.0) != ccw;
+
+        const int first = static_cast<int>(nodes_.size());
+        const int n = static_cast<int>(loop.size());
+        for (int k = 0; k < n; ++k) {
+            const auto index = loop[reverse ? n - 1 - k : k];
+            nodes_.push_back({index, Point(index), first + (k + n - 1) % n,
+                              first + (k + 1) % n});
+        }
+        return first;
+    }
+
+    /// @brief 穴の環を外周の環に併合する
+    /// @param outer 外周の環の任意のノード
+    /// @param hole 穴の環 (時計回り) の任意のノード
+    void MergeHole(const int outer, const int hole) {
+        // 穴の最も右の頂点から橋を架ける
+        int m = hole;
+        for (int p = nodes_[hole].next; p != hole; p = nodes_[p].next) {
+            const auto& a = nodes_[p].p;
+            const auto& b = nodes_[m].p;
+            if (a.x() > b.x() || (a.x() == b.x() && a.y() < b.y())) m = p;
+        }
+        int bridge = FindBridge(m, outer);
+        if (bridge < 0) bridge = FindNearest(m, outer);
+        Splice(bridge, m);
+    }
+
+    /// @brief 環を耳切り法で分割する
+    /// @param ear 環の任意のノード
+    /// @param triangles 分割結果の追加先
+    /// @note 新たに生じる対角線が最短の耳から切る. 順に切るだけでは細長い帯状の
+    ///       多角形で1頂点からの扇状の分割となり、細い三角形が生じるため
+    void Clip(int ear, std::vector<std::array<std::uint32_t, 3>>& triangles) {
+        int count = 1;
+        for (int p = nodes_[ear].next; p != ear; p = nodes_[p].next) ++count;
+
+        // 候補 {耳の種類 (0: 真に凸, 1: 凸または共線), 対角線の長さの2乗, ノード, 版}.
+        // 版はノードの前後が変わるたびに増やし、古い候補を無効にする
+        using Candidate = std::tuple<int, double, int, int>;
+        std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> heap;
+        std::vector<int> version(nodes_.size(), 0);
+        const auto push = [&](const int i) {
+            const int prev = nodes_[i].prev;
+            const int next = nodes_[i].next;
+            for (int pass = 0; pass < 2; ++pass) {
+                if (IsEar(prev, i, next, pass)) {
+                    heap.emplace(pass, (nodes_[next].p - nodes_[prev].p).squaredNorm(),
+                                 i, version[i]);
+                    return;
+                }
+            }
+        };
+        push(ear);
+        for (int p = nodes_[ear].next; p != ear; p = nodes_[p].next) push(p);
+
+        const auto pop = [&]() {
+            while (!heap.empty()) {
+                const auto [pass, length, node, ver] = heap.top();
+                heap.pop();
+                if (ver == version[node]) return node;
+            }
+            return -1;
+        };
+        while (count > 3) {
+            int i = pop();
+            if (i < 0) {
+                // 前後以外の頂点の除去で耳となった頂点を拾うため、全ての頂点を再評価する
+                push(ear);
+                for (int p = nodes_[ear].next; p != ear; p = nodes_[p].next) push(p);
+                i = pop();
+            }
+            // 耳が見つからない場合 (自己交差等) は任意の頂点で続行する
+            if (i < 0) i = ear;
+
+            const int prev = nodes_[i].prev;
+            const int next = nodes_[i].next;
+            triangles.push_back({nodes_[prev].index, nodes_[i].index, nodes_[next].index});
+            Remove(i);
+            ++version[i];
+            --count;
+            ear = next;
+            ++version[prev];
+            ++version[next];
+            push(prev);
+            push(next);
+        }
+        triangles.push_back({nodes_[nodes_[ear].prev].index, nodes_[ear].index,
+                             nodes_[nodes_[ear].next].index});
+    }
+
+ private:
+    /// @brief 環状リストのノード
+    struct Node {
+        /// @brief 頂点番号
+        std::uint32_t index;
+        /// @brief 頂点座標
+        Vector2d p;
+        /// @brief 前のノード
+        int prev;
+        /// @brief 次のノード
+        int next;
+    };
+
+    /// @brief 頂点座標を取得する
+    const Vector2d& Point(const std::uint32_t index) const {
+        if (index >= points_.size()) {
+            throw std::out_of_range("TriangulatePolygon: vertex index "
+                                    + std::to_string(index) + " is out of range.");
+        }
+        return points_[index];
+    }
+
+    /// @brief ノードを環から取り除く
+    void Remove(const int i) {
+        nodes_[nodes_[i].prev].next = nodes_[i].next;
+        nodes_[nodes_[i].next].prev = nodes_[i].prev;
+    }
+
+    /// @brief ノードaの内角の内側に点bがあるか
+    bool IsLocallyInside(const int a, const Vector2d& b) const {
+        const auto& pa = nodes_[a].p;
+        const auto& prev = nodes_[nodes_[a].prev].p;
+        const auto& next = nodes_[nodes_[a].next].p;
+        if (Cross(prev, pa, next) >= 0.0) {
+            return Cross(pa, next, b) >= 0.0 && Cross(pa, b, prev) >= 0.0;
+        }
+        return !(Cross(pa, prev, b) > 0.0 && Cross(pa, b, next) > 0.0);
+    }
+
+    /// @brief ノードearが耳であるか
+    bool IsEar(const int prev, const int ear, const int next, const int pass) const {
+        const auto& a = nodes_[prev].p;
+        const auto& b = nodes_[ear].p;
+        const auto& c = nodes_[next].p;
+        const double area = Cross(a, b, c);
+        if (pass >= 2) return true;
+        if (area < 0.0 || (pass == 0 && area == 0.0)) return false;
+
+        // 反射頂点 (および共線の頂点) が三角形に含まれないこと.
+        // 橋の複製などで三角形の頂点と一致する点は除く
+        for (int q = nodes_[next].next; q != prev; q = nodes_[q].next) {
+            const auto& p = nodes_[q].p;
+            if (p == a || p == b || p == c) continue;
+            if (Cross(nodes_[nodes_[q].prev].p, p, nodes_[nodes_[q].next].p) > 0.0) {
+                continue;
+            }
+            if (IsInTriangle(a, b, c, p)) return false;
+        }
+        return true;
+    }
+
+    /// @brief 穴の頂点mから+x方向に見える外周のノードを探す (Eberlyの方法)
+    /// @return 橋の端点とするノード. 見つからない場合は-1
+    int FindBridge(const int m, const int outer) const {
+        const auto& h = nodes_[m].p;
+        double best_x = std::numeric_limits<double>::infinity();
+        int candidate = -1;
+        int p = outer;
+        do {
+            const int q = nodes_[p].next;
+            const auto& a = nodes_[p].p;
+            const auto& b = nodes_[q].p;
+            if (a.y() != b.y() && std::min(a.y(), b.y()) <= h.y() &&
+                h.y() <= std::max(a.y(), b.y())) {
+                const double x = a.x() + (h.y() - a.y()) * (b.x() - a.x()) / (b.y() - a.y());
+                if (x >= h.x() && x < best_x) {
+                    best_x = x;
+                    candidate = (a.x() > b.x()) ? p : q;
+                    if (x == h.x()) return candidate;
+                }
+            }
+            p = q;
+        } while (p != outer);
+        if (candidate < 0) return -1;
+
+        // 半直線との交点・候補・mの三角形に含まれる頂点があれば、
+        // 半直線となす角が最小の頂点を選ぶ (候補が隠されている場合)
+        const Vector2d cross_point{best_x, h.y()};
+        const Vector2d c = nodes_[candidate].p;
+        double tan_min = std::numeric_limits<double>::infinity();
+        int bridge = candidate;
+        p = candidate;
+        do {
+            const auto& pp = nodes_[p].p;
+            if (p != candidate && h.x() <= pp.x() && pp.x() <= c.x() &&
+                pp != h && IsInTriangle(h, cross_point, c, pp)) {
+                const double tan = std::abs(h.y() - pp.y()) / (pp.x() - h.x());
+                if (IsLocallyInside(p, h) &&
+                    (tan < tan_min ||
+                     (tan == tan_min && pp.x() > nodes_[bridge].p.x()))) {
+                    bridge = p;
+                    tan_min = tan;
+                }
+            }
+            p = nodes_[p].next;
+        } while (p != candidate);
+
+        // 同じ座標のノードが複数ある場合 (先の橋の複製) は、mが内角に入るものを選ぶ
+        if (!IsLocallyInside(bridge, h)) {
+            p = nodes_[bridge].next;
+            while (p != bridge) {
+                if (nodes_[p].p == nodes_[bridge].p && IsLocallyInside(p, h)) {
+                    return p;
+                }
+                p = nodes_[p].next;
+            }
+        }
+        return bridge;
+    }
+
+    /// @brief 外周のノードのうち、ノードmに最も近いものを返す
+    int FindNearest(const int m, const int outer) const {
+        int nearest = outer;
+        double best = std::numeric_limits<double>::infinity();
+        int p = outer;
+        do {
+            const double d = (nodes_[p].p - nodes_[m].p).squaredNorm();
+            if (d < best) {
+                best = d;
+                nearest = p;
+            }
+            p = nodes_[p].next;
+        } while (p != outer);
+        return nearest;
+    }
+
+    /// @brief 外周のノードaと穴のノードbを橋で結び、1つの環にする
+    /// @note a → b → (穴を一周) → b' → a' → (aの元の次) の順に繋ぐ
+    void Splice(const int a, const int b) {
+        const int a2 = static_cast<int>(nodes_.size());
+        const int b2 = a2 + 1;
+        nodes_.push_back(nodes_[a]);
+        nodes_.push_back(nodes_[b]);
+        const int an = nodes_[a].next;
+        const int bp = nodes_[b].prev;
+
+        nodes_[a].next = b;
+        nodes_[b].prev = a;
+        nodes_[bp].next = b2;
+        nodes_[b2].prev = bp;
+        nodes_[b2].next = a2;
+        nodes_[a2].prev = b2;
+        nodes_[a2].next = an;
+        nodes_[an].prev = a2;
+    }
+
+    /// @brief 頂点座標
+    const std::vector<Vector2d>& points_;
+    /// @brief 環状リストのノード
+    std::vector<Node> nodes_;
+};
+
+}  // namespace
+
+
+
+std::vector<std::array<std::uint32_t, 3>> i_num::TriangulatePolygon(
+        const std::vector<Vector2d>& points,
+        const std::vector<std::uint32_t>& outer,
+        const std::vector<std::vector<std::uint32_t>>& holes) {
+    std::vector<std::array<std::uint32_t, 3>> triangles;
+    EarClipper clipper(points);
+    const int start = clipper.CreateRing(outer, true);
+    if (start < 0) return triangles;
+
+    // 穴を、最も右の頂点のx座標の降順に併合する
+    std::vector<std::pair<double, int>> rings;
+    for (const auto& hole : holes) {
+        const int ring = clipper.CreateRing(hole, false);
+        if (ring < 0) continue;
+        double max_x = -std::numeric_limits<double>::infinity();
+        for (const auto index : hole) max_x = std::max(max_x, points[index].x());
+        rings.emplace_back(max_x, ring);
+    }
+    std::stable_sort(rings.begin(), rings.end(),
+                     [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (const auto& [x, ring] : rings) clipper.MergeHole(start, ring);
+
+    triangles.reserve(outer.size() + 2 * rings.size());
+    clipper.Clip(start, triangles);
+    return triangles;
+}
@@ -0,0 +1,312 @@
+/**
+ * @file numerics/meshes/algorithms/adjacency.cpp
+ * @brief 三角形メッシュの隣接関係の構築の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/numerics/meshes/algorithms/adjacency.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "igesio/common/parallel.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+
+/// @brief 基数ソートの1パスで扱うビット数
+constexpr unsigned int kRadixBits = 11;
+/// @brief 基数ソートの1パスのバケット数
+constexpr std::size_t kRadixBuckets = std::size_t{1} << kRadixBits;
+/// @brief 並列化の1チャンクの最小要素数
+constexpr std::size_t kMinChunkSize = 32768;
+
+/// @brief 要素数nを並列に処理するチャンクの数を決める
+std::size_t ChunkCount(const std::size_t n) {
+    std::size_t hw = std::thread::hardware_concurrency();
+    if (hw == 0) hw = 1;
+    return std::clamp<std::size_t>(n / kMinChunkSize, 1, hw);
+}
+
+/// @brief [0, n) をchunks個に分けたときの、チャンクcの範囲 [begin, end)
+std::pair<std::size_t, std::size_t> ChunkRange(
+        const std::size_t n, const std::size_t chunks, const std::size_t c) {
+    const std::size_t size = (n + chunks - 1) / chunks;
+    return {std::min(c * size, n), std::min((c + 1) * size, n)};
+}
+
+/// @brief 値vを表すのに必要なビット数 (最低1)
+unsigned int BitWidth(std::uint64_t v) {
+    unsigned int bits = 1;
+    while (v >>= 1) ++bits;
+    return bits;
+}
+
+/// @brief キー (と付随する値) を安定に並べるLSD基数ソート
+/// @param[in,out] keys キー (ビット [first_bit, last_bit) のみを比較する)
+/// @param[in,out] values 付随する値 (keysと同じ長さ. nullptrの場合はキーのみ)
+/// @param first_bit 比較する最下位ビット
+/// @param last_bit 比較する最上位ビットの次のビット
+void RadixSort(std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>* values,
+               const unsigned int first_bit, const unsigned int last_bit) {
+    i_num::detail::RadixSortKeys(keys, values, first_bit, last_bit,
+                                 ChunkCount(keys.size()));
+}
+
+/// @brief 並べたキー列の各ラン (同じキーの連続) の先頭位置を求める
+/// @param keys 並べたキー列
+/// @return ランの先頭位置 (昇順)
+std::vector<std::uint32_t> RunHeads(const std::vector<std::uint64_t>& keys) {
+    const std::size_t n = keys.size();
+    const std::size_t chunks = ChunkCount(n);
+    const auto is_head = [&keys](const std::size_t i) {
+        return i == 0 || keys[i] != keys[i - 1];
+    };
+
+    // チャンクごとにランの先頭を数え、累積和の位置へ書き込む
+    std::vector<std::size_t> counts(chunks + 1, 0);
+    igesio::ParallelFor(chunks, [&](const std::size_t c) {
+        const auto [begin, end] = ChunkRange(n, chunks, c);
+        for (std::size_t i = begin; i < end; ++i) counts[c + 1] += is_head(i);
+    }, 1);
+    for (std::size_t c = 0; c < chunks; ++c) counts[c + 1] += counts[c];
+
+    std::vector<std::uint32_t> heads(counts.back());
+    igesio::ParallelFor(chunks, [&](const std::size_t c) {
+        const auto [begin, end] = ChunkRange(n, chunks, c);
+        std::size_t out = counts[c];
+        for (std::size_t i = begin; i < end; ++i) {
+            if (is_head(i)) heads[out++] = static_cast<std::uint32_t>(i);
+        }
+    }, 1);
+    return heads;
+}
+
+/// @brief エッジを順序によらないキーへパックする
+/// @note キーは (小さい頂点番号 << vertex_bits) | 大きい頂点番号.
+///       長さゼロのエッジ (a == b) は、実在のエッジより大きい番兵とする
+class EdgeKeyPacker {
+ public:
+    /// @brief コンストラクタ
+    /// @param vertex_count 頂点数
+    explicit EdgeKeyPacker(const std::size_t vertex_count)
+        : vertex_bits_(BitWidth(vertex_count > 0 ? vertex_count - 1 : 0)) {}
+
+    /// @brief キーの有効ビット数
+    unsigned int KeyBits() const { return 2 * vertex_bits_; }
+    /// @brief 長さゼロのエッジを表す番兵 (全ビットが1. 実在のエッジは小<大のため重ならない)
+    std::uint64_t Sentinel() const {
+        return (KeyBits() >= 64) ? ~std::uint64_t{0}
+                                 : (std::uint64_t{1} << KeyBits()) - 1;
+    }
+    /// @brief エッジ (a, b) のキー
+    std::uint64_t Pack(const std::uint32_t a, const std::uint32_t b) const {
+        if (a == b) return Sentinel();
+        return (static_cast<std::uint64_t>(std::min(a, b)) << vertex_bits_)
+             | static_cast<std::uint64_t>(std::max(a, b));
+    }
+    /// @brief キーからエッジを戻す
+    std::array<std::uint32_t, 2> Unpack(const std::uint64_t key) const {
+        const std::uint64_t mask = (std::uint64_t{1} << vertex_bits_) - 1;
+        return {static_cast<std::uint32_t>(key >> vertex_bits_),
+                static_cast<std::uint32_t>(key & mask)};
+    }
+
+ private:
+    /// @brief 頂点番号のビット数
+    unsigned int vertex_bits_;
+};
+
+/// @brief 全三角形の辺のキーを並べる (長さゼロの辺は末尾から取り除く)
+/// @param indices 三角形インデックス
+/// @param packer エッジのキーへの変換
+/// @param[out] triangles 各キーの三角形番号 (nullptrの場合は求めない)
+/// @return 並べたキー列
+std::vector<std::uint64_t> SortedEdgeKeys(const std::vector<std::uint32_t>& indices,
+                                          const EdgeKeyPacker& packer,
+                                          std::vector<std::uint32_t>* triangles) {
+    const std::size_t triangle_count = indices.size() / 3;
+    std::vector<std::uint64_t> keys(3 * triangle_count);
+    if (triangles) triangles->resize(3 * triangle_count);
+    igesio::ParallelFor(triangle_count, [&](const std::size_t t) {
+        for (std::size_t k = 0; k < 3; ++k) {
+            keys[3 * t + k] = packer.Pack(indices[3 * t + k],
+                                          indices[3 * t + (k + 1) % 3]);
+            if (triangles) (*triangles)[3 * t + k] = static_cast<std::uint32_t>(t);
+        }
+    }, i_num::kMinParallelTriangleCount);
+    RadixSort(keys, triangles, 0, packer.KeyBits());
+
+    // 番兵 (長さゼロの辺) は最大値のため末尾に集まる
+    std::size_t valid = keys.size();
+    while (valid > 0 && keys[valid - 1] == packer.Sentinel()) --valid;
+    keys.resize(valid);
+    if (triangles) triangles->resize(valid);
+    return keys;
+}
+
+}  // namespace
+
+
+
+/**
+ * 基数ソート
+ */
+
+void i_num::detail::RadixSortKeys(
+        std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>* values,
+        const unsigned int first_bit, const unsigned int last_bit,
+        const std::size_t chunk_count) {
+    const std::size_t n = keys.size();
+    if (n < 2 || last_bit <= first_bit) return;
+    const std::size_t chunks = std::clamp<std::size_t>(chunk_count, 1, n);
+    const std::size_t passes = (last_bit - first_bit + kRadixBits - 1) / kRadixBits;
+    // 最後のパスはlast_bit以上のビットを含めない
+    const auto digit = [first_bit, last_bit](const std::uint64_t key,
+                                             const std::size_t pass) {
+        const unsigned int shift = first_bit + static_cast<unsigned int>(pass) * kRadixBits;
+        const unsigned int width = std::min(kRadixBits, last_bit - shift);
+        return static_cast<std::size_t>((key >> shift) & ((std::uint64_t{1} << width) - 1));
+    };
+
+    // 全パスの桁の数を1回の走査で数える. 桁の数は並べ替えで変わらないため、
+    // 全要素が同じ桁となるパス (並べ替えを省けるパス) の判定にのみ用いる
+    std::vector<std::size_t> totals(chunks * passes * kRadixBuckets, 0);
+    igesio::ParallelFor(chunks, [&](const std::size_t c) {
+        const auto [begin, end] = ChunkRange(n, chunks, c);
+        auto* counts = totals.data() + c * passes * kRadixBuckets;
+        for (std::size_t i = begin; i < end; ++i) {
+            for (std::size_t pass = 0; pass < passes; ++pass) {
+                ++counts[pass * kRadixBuckets + digit(keys[i], pass)];
+            }
+        }
+    }, 1);
+    std::vector<bool> skip(passes, false);
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        for (std::size_t d = 0; d < kRadixBuckets && !skip[pass]; ++d) {
+            std::size_t count = 0;
+            for (std::size_t c = 0; c < chunks; ++c) {
+                count += totals[(c * passes + pass) * kRadixBuckets + d];
+            }
+            skip[pass] = (count == n);
+        }
+    }
+
+    // 各パスの書き込み位置は、直前の散布後の並びについてチャンクごとに数え直す
+    // (チャンクの範囲に入るキーはパスごとに異なる)
+    std::vector<std::size_t> offsets(chunks * kRadixBuckets);
+    std::vector<std::uint64_t> key_buffer(n);
+    std::vector<std::uint32_t> value_buffer(values ? n : 0);
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        if (skip[pass]) continue;
+
+        // offsets[c * kRadixBuckets + d]: チャンクcの桁dの数 → 書き込み位置
+        std::fill(offsets.begin(), offsets.end(), 0);
+        igesio::ParallelFor(chunks, [&](const std::size_t c) {
+            const auto [begin, end] = ChunkRange(n, chunks, c);
+            auto* counts = offsets.data() + c * kRadixBuckets;
+            for (std::size_t i = begin; i < end; ++i) ++counts[digit(keys[i], pass)];
+        }, 1);
+        std::size_t running = 0;
+        for (std::size_t d = 0; d < kRadixBuckets; ++d) {
+            for (std::size_t c = 0; c < chunks; ++c) {
+                const std::size_t count = offsets[c * kRadixBuckets + d];
+                offsets[c * kRadixBuckets + d] = running;
+                running += count;
+            }
+        }
+
+        // (桁, チャンク) の順の累積和のため、各チャンクは独立に安定に散布できる
+        igesio::ParallelFor(chunks, [&](const std::size_t c) {
+            const auto [begin, end] = ChunkRange(n, chunks, c);
+            auto* positions = offsets.data() + c * kRadixBuckets;
+            for (std::size_t i = begin; i < end; ++i) {
+                const std::size_t pos = positions[digit(keys[i], pass)]++;
+                key_buffer[pos] = keys[i];
+                if (values) value_buffer[pos] = (*values)[i];
+            }
+        }, 1);
+        keys.swap(key_buffer);
+        if (values) values->swap(value_buffer);
+    }
+}
+
+
+
+/**
+ * 隣接関係
+ */
+
+i_num::MeshAdjacency i_num::BuildMeshAdjacency(
+        const std::vector<std::uint32_t>& indices, const std::size_t vertex_count,
+        const bool with_vertex_triangles) {
+    MeshAdjacency adjacency;
+    const std::size_t triangle_count = indices.size() / 3;
+
+    // 頂点→三角形: (頂点番号 << 32) | 三角形番号 を頂点番号の桁で安定に並べる
+    if (with_vertex_triangles) {
+        std::vector<std::uint64_t> keys(3 * triangle_count);
+        igesio::ParallelFor(triangle_count, [&](const std::size_t t) {
+            for (std::size_t k = 0; k < 3; ++k) {
+                keys[3 * t + k] = (static_cast<std::uint64_t>(indices[3 * t + k]) << 32) | t;
+            }
+        }, kMinParallelTriangleCount);
+        RadixSort(keys, nullptr, 32,
+                  32 + BitWidth(vertex_count > 0 ? vertex_count - 1 : 0));
+
+        auto& triangles = adjacency.vertex_triangles;
+        triangles.resize(keys.size());
+        igesio::ParallelFor(keys.size(), [&](const std::size_t i) {
+            triangles[i] = static_cast<std::uint32_t>(keys[i] & 0xffffffffULL);
+            keys[i] >>= 32;
+        }, 3 * kMinParallelTriangleCount);
+
+        // 各頂点の開始位置は、その頂点より小さい番号を持つ要素の数
+        auto& offsets = adjacency.vertex_offsets;
+        offsets.assign(vertex_count + 1, 0);
+        const auto heads = RunHeads(keys);
+        igesio::ParallelFor(heads.size(), [&](const std::size_t h) {
+            // このランの頂点と、前のランの頂点の間の頂点 (三角形なし) の開始位置を埋める
+            const auto vertex = static_cast<std::size_t>(keys[heads[h]]);
+            const std::size_t previous = (h == 0)
+                    ? 0 : static_cast<std::size_t>(keys[heads[h - 1]]) + 1;
+            for (std::size_t v = previous; v <= vertex; ++v) offsets[v] = heads[h];
+        }, kMinParallelTriangleCount);
+        const std::size_t last = heads.empty()
+                ? 0 : static_cast<std::size_t>(keys[heads.back()]) + 1;
+        for (std::size_t v = last; v <= vertex_count; ++v) {
+            offsets[v] = static_cast<std::uint32_t>(keys.size());
+        }
+    }
+
+    // エッジ→三角形: (エッジのキー, 三角形番号) をキーで安定に並べ、同じキーのランを1エッジとする
+    const EdgeKeyPacker packer(vertex_count);
+    const auto keys = SortedEdgeKeys(indices, packer, &adjacency.edge_triangles);
+    const auto heads = RunHeads(keys);
+    adjacency.edges.resize(heads.size());
+    adjacency.edge_offsets.resize(heads.size() + 1);
+    igesio::ParallelFor(heads.size(), [&](const std::size_t e) {
+        adjacency.edges[e] = packer.Unpack(keys[heads[e]]);
+        adjacency.edge_offsets[e] = heads[e];
+    }, kMinParallelTriangleCount);
+    adjacency.edge_offsets.back() = static_cast<std::uint32_t>(keys.size());
+    return adjacency;
+}
+
+std::vector<std::array<std::uint32_t, 2>> i_num::ExtractUniqueEdges(
+        const std::vector<std::uint32_t>& indices, const std::size_t vertex_count) {
+    const EdgeKeyPacker packer(vertex_count);
+    const auto keys = SortedEdgeKeys(indices, packer, nullptr);
+    const auto heads = RunHeads(keys);
+    std::vector<std::array<std::uint32_t, 2>> edges(heads.size());
+    igesio::ParallelFor(heads.size(), [&](const std::size_t e) {
+        edges[e] = packer.Unpack(keys[heads[e]]);
+    }, kMinParallelTriangleCount);
+    return edges;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file numerics/meshes/algorithms/reordering.cpp
+ * @brief 三角形メッシュの描画向けの並べ替えの実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/numerics/meshes/algorithms/reordering.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+namespace i_num = igesio::numerics;
+
+/// @brief キャッシュ内の位置による得点の減衰の指数
+constexpr double kCacheDecayPower = 1.5;
+/// @brief 直前の三角形の頂点 (キャッシュの先頭3つ) の得点
+/// @note 直前の三角形と同じ頂点を続けて使うと、ストリップ状に偏り
+///       キャッシュ全体を活かせないため、やや低くする
+constexpr double kLastTriangleScore = 0.75;
+/// @brief 残りの三角形数が少ない頂点を優先する得点の係数
+constexpr double kValenceBoostScale = 2.0;
+/// @brief 残りの三角形数が少ない頂点を優先する得点の指数
+constexpr double kValenceBoostPower = 0.5;
+
+/// @brief キャッシュに無い頂点を表す位置
+constexpr int kNotInCache = -1;
+
+/// @brief 頂点の得点を計算する
+/// @param cache_position キャッシュ内の位置 (無い場合はkNotInCache)
+/// @param remaining 未出力の三角形のうち、この頂点を含むものの数
+double VertexScore(const int cache_position, const std::uint32_t remaining) {
+    // 未出力の三角形が無い頂点は選択に寄与しない
+    if (remaining == 0) return -1.0;
+
+    double score = 0.0;
+    if (cache_position >= 0) {
+        if (cache_position < 3) {
+            score = kLastTriangleScore;
+        } else {
+            constexpr double kScaler =
+                    1.0 / static_cast<double>(i_num::kVertexCacheSize - 3);
+            score = std::pow(1.0 - (cache_position - 3) * kScaler,
+                             kCacheDecayPower);
+        }
+    }
+    return score + kValenceBoostScale
+                 * std::pow(static_cast<double>(remaining), -kValenceBoostPower);
+}
+
+}  // namespace
+
+
+
+std::vector<std::uint32_t> i_num::OptimizeVertexCache(
+        const std::vector<std::uint32_t>& indices, const std::size_t vertex_count) {
+    const std::size_t triangle_count = indices.size() / 3;
+    if (triangle_count == 0) return indices;
+
+    // 頂点ごとの、その頂点を含む三角形の一覧 (CSR形式)
+    std::vector<std::uint32_t> offsets(vertex_count + 1, 0);
+    for (std::size_t i = 0; i < triangle_count * 3; ++i) ++offsets[indices[i] + 1];
+    for (std::size_t v = 0; v < vertex_count; ++v) offsets[v + 1] += offsets[v];
+    std::vector<std::uint32_t> adjacency(triangle_count * 3);
+    {
+        auto cursor = offsets;
+        for (std::size_t i = 0; i < triangle_count * 3; ++i) {
+            adjacency[cursor[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+        }
+    }
+
+    std::vector<std::uint32_t> remaining(vertex_count);
+    for (std::size_t v = 0; v < vertex_count; ++v) {
+        remaining[v] = offsets[v + 1] - offsets[v];
+    }
+    std::vector<int> cache_position(vertex_count, kNotInCache);
+    std::vector<double> vertex_score(vertex_count);
+    for (std::size_t v = 0; v < vertex_count; ++v) {
+        vertex_score[v] = VertexScore(kNotInCache, remaining[v]);
+    }
+    std::vector<bool> emitted(triangle_count, false);
+    std::vector<double> triangle_score(triangle_count);
+    for (std::size_t t = 0; t < triangle_count; ++t) {
+        triangle_score[t] = vertex_score[indices[3 * t]]
+                          + vertex_score[indices[3 * t + 1]]
+                          + vertex_score[indices[3 * t + 2]];
+    }
+
+    std::vector<std::uint32_t> result;
+    result.reserve(indices.size());
+    // 直前の三角形の頂点を先頭とするキャッシュ (溢れた頂点の得点更新のため+3)
+    std::vector<std::uint32_t> cache, next_cache;
+    cache.reserve(kVertexCacheSize + 3);
+    next_cache.reserve(kVertexCacheSize + 3);
+
+    // 隣接する三角形が無い場合の再開位置 (入力順)
+    std::size_t restart = 0;
+    std::size_t best = 0;
+    bool has_best = false;
+    for (std::size_t n = 0; n < triangle_count; ++n) {
+        if (!has_best) {
+            while (emitted[restart]) ++restart;
+            best = restart;
+        }
+        emitted[best] = true;
+        const std::array<std::uint32_t, 3> tri = {
+            indices[3 * best], indices[3 * best + 1], indices[3 * best + 2]};
+        result.insert(result.end(), tri.begin(), tri.end());
+
+        // 三角形の頂点をキャッシュの先頭へ移し、残りの三角形数を減らす
+        next_cache.clear();
+        for (const auto v : tri) {
+            if (std::find(next_cache.begin(), next_cache.end(), v)
+                    == next_cache.end()) {
+                next_cache.push_back(v);
+            }
+            --remaining[v];
+        }
+        for (const auto v : cache) {
+            if (std::find(next_cache.begin(), next_cache.end(), v)
+                    == next_cache.end()) {
+                next_cache.push_back(v);
+            }
+        }
+
+        // キャッシュ内 (および溢れた) 頂点の得点を更新し、それらを含む
+        // 未出力の三角形から次の三角形を選ぶ
+        for (std::size_t k = 0; k < next_cache.size(); ++k) {
+            const auto v = next_cache[k];
+            cache_position[v] = (k < kVertexCacheSize)
+                    ? static_cast<int>(k) : kNotInCache;
+            const double score = VertexScore(cache_position[v], remaining[v]);
+            const double delta = score - vertex_score[v];
+            vertex_score[v] = score;
+            for (auto a = offsets[v]; a < offsets[v + 1]; ++a) {
+                const auto t = adjacency[a];
+                if (!emitted[t]) triangle_score[t] += delta;
+            }
+        }
+        has_best = false;
+        double best_score = 0.0;
+        for (std::size_t k = 0; k < next_cache.size() && k < kVertexCacheSize; ++k) {
+            const auto v = next_cache[k];
+            for (auto a = offsets[v]; a < offsets[v + 1]; ++a) {
+                const auto t = adjacency[a];
+                if (!emitted[t] && triangle_score[t] > best_score) {
+                    best_score = triangle_score[t];
+                    best = t;
+                    has_best = true;
+                }
+            }
+        }
+
+        if (next_cache.size() > kVertexCacheSize) next_cache.resize(kVertexCacheSize);
+        std::swap(cache, next_cache);
+    }
+
+    // 三角形を成さない端数のインデックスはそのまま残す
+    result.insert(result.end(), indices.begin() + triangle_count * 3, indices.end());
+    return result;
+}
+
+std::vector<std::uint32_t> i_num::ComputeVertexFetchRemap(
+        const std::vector<std::uint32_t>& indices, const std::size_t vertex_count) {
+    constexpr auto kUnassigned = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> remap(vertex_count, kUnassigned);
+    std::uint32_t next = 0;
+    for (const auto index : indices) {
+        if (remap[index] == kUnassigned) remap[index] = next++;
+    }
+    // 参照されない頂点は後ろに元の順で並べる
+    for (auto& r : remap) {
+        if (r == kUnassigned) r = next++;
+    }
+    return remap;
+}
+
+double i_num::ComputeAverageCacheMissRatio(
+        const std::vector<std::uint32_t>& indices, const std::size_t vertex_count,
+        const std::size_t cache_size) {
+    const std::size_t triangle_count = indices.size() / 3;
+    if (triangle_count == 0) return 0.0;
+
+    // 各頂点がキャッシュへ入った時刻. 時刻の差がcache_size未満ならキャッシュ内
+    std::vector<std::size_t> stamp(vertex_count, 0);
+    std::vector<bool> loaded(vertex_count, false);
+    std::size_t time = 0;
+    std::size_t misses = 0;
+    for (std::size_t i = 0; i < triangle_count * 3; ++i) {
+        const auto v = indices[i];
+        if (loaded[v] && time - stamp[v] < cache_size) continue;
+        loaded[v] = true;
+        stamp[v] = time++;
+        ++misses;
+    }
+    return static_cast<double>(misses) / static_cast<double>(triangle_count);
+}
@@ -0,0 +1,906 @@
+/**
+ * @file numerics/meshes/algorithms/simplification.cpp
+ * @brief 三角形メッシュの二次誤差尺度 (QEM) による簡略化の実装
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#include "igesio/numerics/meshes/algorithms/simplification.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "igesio/common/parallel.h"
+#include "igesio/numerics/meshes/algorithms/adjacency.h"
+#include "igesio/numerics/meshes/algorithms/edges.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+using igesio::Vector2d;
+using igesio::Vector3d;
+
+/// @brief 除去した三角形・無効な頂点を表す値
+constexpr std::uint32_t kInvalid = std::numeric_limits<std::uint32_t>::max();
+
+/// @brief 二次形式の係数行列を特異とみなす行列式の相対しきい値
+/// @note 平坦な領域では係数行列の階数が落ちるため、最適位置の代わりに
+///       辺の端点・中点から選ぶ
+constexpr double kSingularDeterminant = 1e-10;
+
+/// @brief 縮約後の面法線と、入力メッシュでの面法線とのなす角の余弦の下限
+constexpr double kMinNormalCos = 0.5;
+
+/// @brief 頂点の種別 (特徴線に対する縮約の制約)
+enum class VertexKind : std::uint8_t {
+    /// @brief 特徴線に接しない頂点 (任意の位置へ動かしてよい)
+    kInterior,
+    /// @brief 特徴線の途中の頂点 (特徴線に沿ってのみ縮約する)
+    kFeature,
+    /// @brief 特徴線の端点・分岐点、クラスタ境界の頂点 (動かさない)
+    kLocked
+};
+
+/// @brief 辺 (頂点の組) を順序によらない64bitのキーへパックする
+std::uint64_t EdgeKey(const std::uint32_t a, const std::uint32_t b) {
+    return (static_cast<std::uint64_t>(std::min(a, b)) << 32)
+         | static_cast<std::uint64_t>(std::max(a, b));
+}
+
+/// @brief 点から平面群までの距離の2乗和を表す二次形式
+/// @note Q(p) = p^T A p + 2 b^T p + c (Aは対称行列のため上三角のみ持つ)
+class Quadric {
+ public:
+    Quadric() = default;
+
+    /// @brief 平面 n·p + d = 0 までの距離の2乗に重みを掛けた二次形式を作成する
+    /// @param n 平面の単位法線
+    /// @param d 平面の定数項
+    /// @param weight 重み
+    static Quadric FromPlane(const Vector3d& n, const double d, const double weight) {
+        Quadric q;
+        q.a_ = {weight * n.x() * n.x(), weight * n.x() * n.y(), weight * n.x() * n.z(),
+                weight * n.y() * n.y(), weight * n.y() * n.z(), weight * n.z() * n.z()};
+        q.b_ = {weight * n.x() * d, weight * n.y() * d, weight * n.z() * d};
+        q.c_ = weight * d * d;
+        return q;
+    }
+
+    /// @brief 二次形式を加える
+    Quadric& operator+=(const Quadric& other) {
+        for (std::size_t i = 0; i < a_.size(); ++i) a_[i] += other.a_[i];
+        for (std::size_t i = 0; i < b_.size(); ++i) b_[i] += other.b_[i];
+        c_ += other.c_;
+        return *this;
+    }
+    /// @brief 二次形式の和を求める
+    Quadric operator+(const Quadric& other) const {
+        Quadric q = *this;
+        q += other;
+        return q;
+    }
+
+    /// @brief 点pでの値を求める (丸め誤差による負値は0とする)
+    double Evaluate(const Vector3d& p) const {
+        const double x = p.x(), y = p.y(), z = p.z();
+        const double value = a_[0] * x * x + a_[3] * y * y + a_[5] * z * z
+                           + 2.0 * (a_[1] * x * y + a_[2] * x * z + a_[4] * y * z)
+                           + 2.0 * (b_[0] * x + b_[1] * y + b_[2] * z) + c_;
+        return std::max(value, 0.0);
+    }
+
+    /// @brief 値を最小にする点を求める
+    /// @return 最小点. 係数行列が特異に近い場合はstd::nullopt
+    std::optional<Vector3d> Minimize() const {
+        const double trace = a_[0] + a_[3] + a_[5];
+        if (!(trace > 0.0)) return std::nullopt;
+
+        // 余因子行列による逆行列で A p = -b を解く
+        const double c00 = a_[3] * a_[5] - a_[4] * a_[4];
+        const double c01 = a_[2] * a_[4] - a_[1] * a_[5];
+        const double c02 = a_[1] * a_[4] - a_[2] * a_[3];
+        const double det = a_[0] * c00 + a_[1] * c01 + a_[2] * c02;
+        if (std::abs(det) <= kSingularDeterminant * trace * trace * trace) {
+            return std::nullopt;
+        }
+        const double c11 = a_[0] * a_[5] - a_[2] * a_[2];
+        const double c12 = a_[1] * a_[2] - a_[0] * a_[4];
+        const double c22 = a_[0] * a_[3] - a_[1] * a_[1];
+        return Vector3d(-(c00 * b_[0] + c01 * b_[1] + c02 * b_[2]) / det,
+                        -(c01 * b_[0] + c11 * b_[1] + c12 * b_[2]) / det,
+                        -(c02 * b_[0] + c12 * b_[1] + c22 * b_[2]) / det);
+    }
+
+ private:
+    /// @brief Aの上三角 (a00, a01, a02, a11, a12, a22)
+    std::array<double, 6> a_ = {};
+    /// @brief b
+    std::array<double, 3> b_ = {};
+    /// @brief c
+    double c_ = 0.0;
+};
+
+/// @brief 簡略化の作業用メッシュ
+/// @note 三角形の番号は入力メッシュと同じに保ち、除去した三角形は
+///       先頭の頂点をkInvalidとする
+struct WorkMesh {
+    /// @brief 頂点位置
+    std::vector<Vector3d> positions;
+    /// @brief 頂点法線 (空=法線なし)
+    std::vector<Vector3d> normals;
+    /// @brief テクスチャ座標 (空=UVなし)
+    std::vector<Vector2d> uvs;
+    /// @brief 頂点の二次形式
+    std::vector<Quadric> quadrics;
+    /// @brief 頂点の種別
+    std::vector<VertexKind> kinds;
+    /// @brief 三角形
+    std::vector<std::array<std::uint32_t, 3>> triangles;
+    /// @brief 三角形ごとの、入力メッシュでの単位面法線 (退化三角形はゼロベクトル)
+    /// @note 縮約で頂点を付け替えても三角形はおおむね同じ領域を覆うため、
+    ///       縮約の繰り返しによる面の向きのずれの基準とする
+    std::vector<Vector3d> face_normals;
+    /// @brief 特徴線の辺 (EdgeKeyでパックしたもの)
+    std::unordered_set<std::uint64_t> feature_edges;
+
+    /// @brief 辺が特徴線か
+    bool IsFeatureEdge(const std::uint32_t a, const std::uint32_t b) const {
+        return feature_edges.count(EdgeKey(a, b)) > 0;
+    }
+};
+
+/// @brief 三角形の (正規化していない) 面法線を求める
+Vector3d TriangleNormal(const Vector3d& p0, const Vector3d& p1, const Vector3d& p2) {
+    return (p1 - p0).cross(p2 - p0);
+}
+
+/// @brief 辺縮約による作業用メッシュの簡略化
+class EdgeCollapser {
+ public:
+    /// @brief コンストラクタ
+    /// @param mesh 対象の作業用メッシュ (Runで直接書き換える)
+    explicit EdgeCollapser(WorkMesh& mesh) : mesh_(mesh) {}
+
+    /// @brief 辺縮約を繰り返す
+    /// @param target_triangle_count 目標の三角形数 (0=縮約できなくなるまで)
+    /// @param max_cost 許容する縮約のコスト (二次形式の値) の上限
+    /// @return 行った縮約のコストの最大値
+    double Run(const std::size_t target_triangle_count, const double max_cost) {
+        const auto vertex_count = mesh_.positions.size();
+        vertex_triangles_.assign(vertex_count, {});
+        stamps_.assign(vertex_count, 0);
+        removed_.assign(vertex_count, 0);
+        alive_count_ = 0;
+        std::vector<std::uint64_t> edges;
+        for (std::size_t t = 0; t < mesh_.triangles.size(); ++t) {
+            const auto& tri = mesh_.triangles[t];
+            if (tri[0] == kInvalid) continue;
+            ++alive_count_;
+            for (int k = 0; k < 3; ++k) {
+                vertex_triangles_[tri[k]].push_back(static_cast<std::uint32_t>(t));
+                edges.push_back(EdgeKey(tri[k], tri[(k + 1) % 3]));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        for (const auto key : edges) {
+            Push(static_cast<std::uint32_t>(key >> 32),
+                 static_cast<std::uint32_t>(key & 0xffffffffULL));
+        }
+
+        double max_accepted = 0.0;
+        while (alive_count_ > target_triangle_count && !queue_.empty()) {
+            const Candidate c = queue_.top();
+            queue_.pop();
+            // 端点が縮約・移動済みの候補は古いため捨てる
+            if (removed_[c.remove] || removed_[c.keep]) continue;
+            if (stamps_[c.remove] != c.remove_stamp ||
+                stamps_[c.keep] != c.keep_stamp) continue;
+            if (c.cost > max_cost) break;
+            if (!IsValid(c)) continue;
+            Collapse(c);
+            max_accepted = std::max(max_accepted, c.cost);
+        }
+        return max_accepted;
+    }
+
+ private:
+    /// @brief 縮約の候補 (頂点removeを頂点keepへ統合し、keepをpositionへ動かす)
+    struct Candidate {
+        /// @brief コスト (統合後の二次形式のpositionでの値)
+        double cost;
+        /// @brief 取り除く頂点
+        std::uint32_t remove;
+        /// @brief 残す頂点
+        std::uint32_t keep;
+        /// @brief 候補作成時のremoveの更新番号
+        std::uint32_t remove_stamp;
+        /// @brief 候補作成時のkeepの更新番号
+        std::uint32_t keep_stamp;
+        /// @brief 縮約後の位置
+        Vector3d position;
+        /// @brief 属性 (法線・UV) の補間係数 (keep→removeの向き. 0=keepのまま)
+        double t;
+
+        /// @brief 優先度の比較 (コストの昇順. 同じコストでは頂点番号で決める)
+        bool operator>(const Candidate& other) const {
+            if (cost != other.cost) return cost > other.cost;
+            if (remove != other.remove) return remove > other.remove;
+            return keep > other.keep;
+        }
+    };
+
+    /// @brief 辺 (a, b) の最良の縮約を求めて候補に加える
+    void Push(const std::uint32_t a, const std::uint32_t b) {
+        if (const auto c = Evaluate(a, b)) queue_.push(*c);
+    }
+
+    /// @brief 辺 (a, b) の最良の縮約を求める
+    /// @return 縮約の候補. 特徴線の制約により縮約できない場合はstd::nullopt
+    std::optional<Candidate> Evaluate(const std::uint32_t a, const std::uint32_t b) const {
+        const auto ka = mesh_.kinds[a];
+        const auto kb = mesh_.kinds[b];
+        const Quadric q = mesh_.quadrics[a] + mesh_.quadrics[b];
+
+        // 一方の頂点を他方の位置へ寄せる縮約
+        const auto half = [&](const std::uint32_t remove, const std::uint32_t keep) {
+            const auto& p = mesh_.positions[keep];
+            return Candidate{q.Evaluate(p), remove, keep,
+                             stamps_[remove], stamps_[keep], p, 0.0};
+        };
+
+        if (ka == VertexKind::kLocked && kb == VertexKind::kLocked) return std::nullopt;
+        if (ka != VertexKind::kInterior && kb != VertexKind::kInterior) {
+            // 特徴線上の頂点同士は特徴線に沿ってのみ縮約する
+            if (!mesh_.IsFeatureEdge(a, b)) return std::nullopt;
+            if (ka == VertexKind::kLocked) return half(b, a);
+            if (kb == VertexKind::kLocked) return half(a, b);
+            const auto ab = half(a, b), ba = half(b, a);
+            return (ab.cost <= ba.cost) ? ab : ba;
+        }
+        if (ka != VertexKind::kInterior) return half(b, a);
+        if (kb != VertexKind::kInterior) return half(a, b);
+
+        // 両端とも内部の頂点: 最適位置・端点・中点のうち最良の位置へ寄せる
+        const auto& pa = mesh_.positions[a];
+        const auto& pb = mesh_.positions[b];
+        std::array<Vector3d, 4> points = {pa, pb, 0.5 * (pa + pb), pa};
+        std::size_t n_points = 3;
+        if (const auto optimum = q.Minimize()) points[n_points++] = *optimum;
+        Vector3d best = pa;
+        double best_cost = std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < n_points; ++i) {
+            const double cost = q.Evaluate(points[i]);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best = points[i];
+            }
+        }
+        const Vector3d edge = pb - pa;
+        const double length2 = edge.squaredNorm();
+        const double t = (length2 > 0.0)
+                ? std::clamp((best - pa).dot(edge) / length2, 0.0, 1.0) : 0.0;
+        return Candidate{best_cost, b, a, stamps_[b], stamps_[a], best, t};
+    }
+
+    /// @brief 頂点の三角形一覧から除去済みの三角形を取り除く
+    void CompactTriangles(const std::uint32_t v) {
+        auto& list = vertex_triangles_[v];
+        list.erase(std::remove_if(list.begin(), list.end(), [this](std::uint32_t t) {
+            return mesh_.triangles[t][0] == kInvalid;
+        }), list.end());
+    }
+
+    /// @brief 頂点に隣接する頂点の一覧 (昇順) を求める
+    std::vector<std::uint32_t> Neighbors(const std::uint32_t v) const {
+        std::vector<std::uint32_t> result;
+        for (const auto t : vertex_triangles_[v]) {
+            const auto& tri = mesh_.triangles[t];
+            if (tri[0] == kInvalid) continue;
+            for (const auto u : tri) {
+                if (u != v) result.push_back(u);
+            }
+        }
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    /// @brief 縮約がメッシュの多様体性・面の向きを保つか
+    bool IsValid(const Candidate& c) {
+        CompactTriangles(c.remove);
+        CompactTriangles(c.keep);
+
+        // link condition: 両端に共通して隣接する頂点は、辺を共有する三角形の
+        // 対頂点に限る (それ以外があると縮約で非多様体の辺ができる)
+        std::size_t shared = 0;
+        for (const auto t : vertex_triangles_[c.remove]) {
+            const auto& tri = mesh_.triangles[t];
+            if (std::find(tri.begin(), tri.end(), c.keep) != tri.end()) ++shared;
+        }
+        if (shared == 0) return false;
+        const auto remove_neighbors = Neighbors(c.remove);
+        const auto keep_neighbors = Neighbors(c.keep);
+        std::vector<std::uint32_t> common;
+        std::set_intersection(remove_neighbors.begin(), remove_neighbors.end(),
+                              keep_neighbors.begin(), keep_neighbors.end(),
+                              std::back_inserter(common));
+        if (common.size() != shared) return false;
+
+        // 特徴線に沿った縮約で、特徴線の閉路を潰さない
+        if (mesh_.kinds[c.remove] == VertexKind::kFeature) {
+            for (const auto x : remove_neighbors) {
+                if (x != c.keep && mesh_.IsFeatureEdge(c.remove, x) &&
+                    mesh_.IsFeatureEdge(c.keep, x)) {
+                    return false;
+                }
+            }
+        }
+
+        // 縮約後に残る三角形の面の向きが反転しないこと
+        const auto flips = [&](const std::uint32_t moved, const std::uint32_t other) {
+            for (const auto t : vertex_triangles_[moved]) {
+                const auto& tri = mesh_.triangles[t];
+                if (std::find(tri.begin(), tri.end(), other) != tri.end()) continue;
+                std::array<Vector3d, 3> p;
+                for (int k = 0; k < 3; ++k) p[k] = mesh_.positions[tri[k]];
+                const Vector3d before = TriangleNormal(p[0], p[1], p[2]);
+                if (before.squaredNorm() == 0.0) continue;
+                for (int k = 0; k < 3; ++k) {
+                    if (tri[k] == moved) p[k] = c.position;
+                }
+                const Vector3d after = TriangleNormal(p[0], p[1], p[2]);
+                if (before.dot(after) <= 0.0) return true;
+                // 縮約の繰り返しで少しずつ傾いて折り返すことも防ぐ
+                const auto& reference = mesh_.face_normals[t];
+                if (reference.squaredNorm() > 0.0 &&
+                    reference.dot(after) < kMinNormalCos * after.norm()) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        if (flips(c.remove, c.keep)) return false;
+        if (c.position != mesh_.positions[c.keep] && flips(c.keep, c.remove)) {
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief 縮約を行い、残した頂点に接する辺の候補を更新する
+    void Collapse(const Candidate& c) {
+        const auto remove = c.remove, keep = c.keep;
+        const auto remove_neighbors = Neighbors(remove);
+
+        // removeを含む三角形のうち、辺を共有するものは除去し、残りはkeepへ付け替える
+        for (const auto t : vertex_triangles_[remove]) {
+            auto& tri = mesh_.triangles[t];
+            if (std::find(tri.begin(), tri.end(), keep) != tri.end()) {
+                tri[0] = kInvalid;
+                --alive_count_;
+                continue;
+            }
+            for (auto& v : tri) {
+                if (v == remove) v = keep;
+            }
+            vertex_triangles_[keep].push_back(t);
+        }
+        vertex_triangles_[remove].clear();
+        CompactTriangles(keep);
+
+        // 位置・属性・二次形式を統合する
+        mesh_.positions[keep] = c.position;
+        if (c.t > 0.0) {
+            if (!mesh_.normals.empty()) {
+                const Vector3d n = (1.0 - c.t) * mesh_.normals[keep]
+                                 + c.t * mesh_.normals[remove];
+                if (n.squaredNorm() > 0.0) mesh_.normals[keep] = n.normalized();
+            }
+            if (!mesh_.uvs.empty()) {
+                mesh_.uvs[keep] = (1.0 - c.t) * mesh_.uvs[keep] + c.t * mesh_.uvs[remove];
+            }
+        }
+        mesh_.quadrics[keep] += mesh_.quadrics[remove];
+
+        // 特徴線の辺をkeepへ付け替える (keepとの辺は縮約で消える)
+        if (mesh_.kinds[remove] != VertexKind::kInterior) {
+            for (const auto x : remove_neighbors) {
+                const auto key = EdgeKey(remove, x);
+                if (mesh_.feature_edges.erase(key) > 0 && x != keep) {
+                    mesh_.feature_edges.insert(EdgeKey(keep, x));
+                }
+            }
+        }
+
+        removed_[remove] = 1;
+        ++stamps_[remove];
+        ++stamps_[keep];
+        for (const auto n : Neighbors(keep)) Push(keep, n);
+    }
+
+    /// @brief 対象の作業用メッシュ
+    WorkMesh& mesh_;
+    /// @brief 頂点ごとの、その頂点を含む三角形の一覧 (除去済みを含みうる)
+    std::vector<std::vector<std::uint32_t>> vertex_triangles_;
+    /// @brief 頂点ごとの更新番号 (縮約で位置・二次形式が変わるたびに増やす)
+    std::vector<std::uint32_t> stamps_;
+    /// @brief 頂点が縮約で取り除かれたか
+    std::vector<std::uint8_t> removed_;
+    /// @brief 残っている三角形の数
+    std::size_t alive_count_ = 0;
+    /// @brief 縮約の候補 (コストの小さい順)
+    std::priority_queue<Candidate, std::vector<Candidate>,
+                        std::greater<Candidate>> queue_;
+};
+
+/// @brief 入力メッシュから作業用メッシュ (二次形式・特徴線・頂点の種別) を作成する
+WorkMesh BuildWorkMesh(const i_num::TriangleMeshd& mesh,
+                       const i_num::MeshSimplificationParams& params) {
+    WorkMesh work;
+    const auto vertex_count = mesh.VertexCount();
+    const auto triangle_count = mesh.TriangleCount();
+    work.positions.resize(vertex_count);
+    for (std::size_t v = 0; v < vertex_count; ++v) {
+        work.positions[v] = mesh.positions.col(static_cast<Eigen::Index>(v));
+    }
+    if (mesh.HasNormals()) {
+        work.normals.resize(vertex_count);
+        for (std::size_t v = 0; v < vertex_count; ++v) {
+            work.normals[v] = mesh.normals.col(static_cast<Eigen::Index>(v));
+        }
+    }
+    if (mesh.HasUVs()) {
+        work.uvs.resize(vertex_count);
+        for (std::size_t v = 0; v < vertex_count; ++v) {
+            work.uvs[v] = mesh.uvs.col(static_cast<Eigen::Index>(v));
+        }
+    }
+
+    // 退化三角形 (同じ頂点を含むもの) は初めから除去済みとする
+    work.triangles.resize(triangle_count);
+    for (std::size_t t = 0; t < triangle_count; ++t) {
+        auto& tri = work.triangles[t];
+        tri = {mesh.indices[3 * t], mesh.indices[3 * t + 1], mesh.indices[3 * t + 2]};
+        if (tri[0] == tri[1] || tri[1] == tri[2] || tri[2] == tri[0]) tri[0] = kInvalid;
+    }
+
+    // 各頂点に隣接面の平面の二次形式を加える
+    auto& face_normals = work.face_normals;
+    face_normals.assign(triangle_count, Vector3d::Zero());
+    work.quadrics.assign(vertex_count, Quadric());
+    for (std::size_t t = 0; t < triangle_count; ++t) {
+        const auto& tri = work.triangles[t];
+        if (tri[0] == kInvalid) continue;
+        const auto& p0 = work.positions[tri[0]];
+        const Vector3d n = TriangleNormal(p0, work.positions[tri[1]],
+                                          work.positions[tri[2]]);
+        const double length = n.norm();
+        if (!(length > 0.0)) continue;
+        face_normals[t] = n / length;
+        const auto q = Quadric::FromPlane(face_normals[t], -face_normals[t].dot(p0), 1.0);
+        for (const auto v : tri) work.quadrics[v] += q;
+    }
+
+    work.kinds.assign(vertex_count, VertexKind::kInterior);
+    if (!params.preserve_features) return work;
+
+    // 特徴線: 特徴エッジと、異なる面グループの三角形が共有する辺
+    const auto adjacency = i_num::BuildMeshAdjacency(mesh);
+    for (const auto& edge : i_num::ExtractMeshEdges(mesh, adjacency,
+                                                    params.crease_angle_cos)
+                                    .feature_edges) {
+        work.feature_edges.insert(EdgeKey(edge[0], edge[1]));
+    }
+    if (!mesh.groups.empty()) {
+        constexpr int kNoGroup = -1;
+        std::vector<int> triangle_groups(triangle_count, kNoGroup);
+        for (std::size_t g = 0; g < mesh.groups.size(); ++g) {
+            const std::size_t first = mesh.groups[g].first_triangle;
+            const std::size_t last = std::min<std::size_t>(
+                    first + mesh.groups[g].triangle_count, triangle_count);
+            for (std::size_t t = first; t < last; ++t) {
+                triangle_groups[t] = static_cast<int>(g);
+            }
+        }
+        for (std::size_t e = 0; e < adjacency.EdgeCount(); ++e) {
+            const auto begin = adjacency.edge_offsets[e];
+            const auto end = adjacency.edge_offsets[e + 1];
+            const int group = triangle_groups[adjacency.edge_triangles[begin]];
+            for (auto a = begin + 1; a < end; ++a) {
+                if (triangle_groups[adjacency.edge_triangles[a]] != group) {
+                    const auto& edge = adjacency.edges[e];
+                    work.feature_edges.insert(EdgeKey(edge[0], edge[1]));
+                    break;
+                }
+            }
+        }
+    }
+
+    // 特徴線の辺を含み隣接面に垂直な平面の二次形式を加え、特徴線からの
+    // ずれを誤差に含める
+    std::vector<std::uint32_t> feature_degrees(vertex_count, 0);
+    for (std::size_t t = 0; t < triangle_count; ++t) {
+        const auto& tri = work.triangles[t];
+        if (tri[0] == kInvalid || face_normals[t].squaredNorm() == 0.0) continue;
+        for (int k = 0; k < 3; ++k) {
+            const auto a = tri[k], b = tri[(k + 1) % 3];
+            if (!work.IsFeatureEdge(a, b)) continue;
+            const Vector3d n = (work.positions[b] - work.positions[a])
+                                       .cross(face_normals[t]);
+            const double length = n.norm();
+            if (!(length > 0.0)) continue;
+            const auto q = Quadric::FromPlane(n / length,
+                                              -n.dot(work.positions[a]) / length, 1.0);
+            work.quadrics[a] += q;
+            work.quadrics[b] += q;
+        }
+    }
+    // 特徴線の端点・分岐点と、特徴線が折り目のしきい値より鋭く曲がる頂点
+    // (正方形の角等) は固定し、それ以外の特徴線上の頂点は特徴線に沿って動かす
+    std::vector<std::array<std::uint32_t, 2>> feature_neighbors(vertex_count);
+    for (const auto key : work.feature_edges) {
+        const auto a = static_cast<std::uint32_t>(key >> 32);
+        const auto b = static_cast<std::uint32_t>(key & 0xffffffffULL);
+        if (feature_degrees[a] < 2) feature_neighbors[a][feature_degrees[a]] = b;
+        if (feature_degrees[b] < 2) feature_neighbors[b][feature_degrees[b]] = a;
+        ++feature_degrees[a];
+        ++feature_degrees[b];
+    }
+    for (std::size_t v = 0; v < vertex_count; ++v) {
+        if (feature_degrees[v] == 0) continue;
+        work.kinds[v] = VertexKind::kLocked;
+        if (feature_degrees[v] != 2) continue;
+        const Vector3d d0 = work.positions[v] - work.positions[feature_neighbors[v][0]];
+        const Vector3d d1 = work.positions[feature_neighbors[v][1]] - work.positions[v];
+        const double lengths = d0.norm() * d1.norm();
+        if (lengths > 0.0 && d0.dot(d1) >= params.crease_angle_cos * lengths) {
+            work.kinds[v] = VertexKind::kFeature;
+        }
+    }
+    return work;
+}
+
+/// @brief 10bitの値のビットを3つおきに広げる (Mortonコード用)
+std::uint32_t SpreadBits(std::uint32_t x) {
+    x &= 0x3ffu;
+    x = (x | (x << 16)) & 0x030000ffu;
+    x = (x | (x << 8)) & 0x0300f00fu;
+    x = (x | (x << 4)) & 0x030c30c3u;
+    x = (x | (x << 2)) & 0x09249249u;
+    return x;
+}
+
+/// @brief 三角形を重心のMortonコード順に並べ、空間的に近いクラスタへ分ける
+/// @param work 作業用メッシュ
+/// @param cluster_size 1クラスタあたりの三角形数
+/// @return クラスタごとの三角形番号の一覧
+std::vector<std::vector<std::uint32_t>> PartitionTriangles(
+        const WorkMesh& work, const std::size_t cluster_size) {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> codes;
+    std::vector<Vector3d> centroids;
+    Vector3d lower = Vector3d::Constant(std::numeric_limits<double>::infinity());
+    Vector3d upper = -lower;
+    for (std::size_t t = 0; t < work.triangles.size(); ++t) {
+        const auto& tri = work.triangles[t];
+        if (tri[0] == kInvalid) continue;
+        const Vector3d c = (work.positions[tri[0]] + work.positions[tri[1]]
+                          + work.positions[tri[2]]) / 3.0;
+        lower = lower.cwiseMin(c);
+        upper = upper.cwiseMax(c);
+        centroids.push_back(c);
+        codes.emplace_back(0, static_cast<std::uint32_t>(t));
+    }
+    const Vector3d extent = upper - lower;
+    for (std::size_t i = 0; i < codes.size(); ++i) {
+        std::array<std::uint32_t, 3> q;
+        for (int k = 0; k < 3; ++k) {
+            const double s = (extent[k] > 0.0)
+                    ? (centroids[i][k] - lower[k]) / extent[k] : 0.0;
+            q[k] = static_cast<std::uint32_t>(std::clamp(s * 1023.0, 0.0, 1023.0));
+        }
+        codes[i].first = SpreadBits(q[0]) | (SpreadBits(q[1]) << 1)
+                       | (SpreadBits(q[2]) << 2);
+    }
+    std::sort(codes.begin(), codes.end());
+
+    std::vector<std::vector<std::uint32_t>> clusters;
+    for (std::size_t i = 0; i < codes.size(); i += cluster_size) {
+        const auto end = std::min(i + cluster_size, codes.size());
+        auto& cluster = clusters.emplace_back();
+        cluster.reserve(end - i);
+        for (std::size_t j = i; j < end; ++j) cluster.push_back(codes[j].second);
+    }
+    return clusters;
+}
+
+/// @brief クラスタを簡略化するための局所的な作業用メッシュ
+struct ClusterMesh {
+    /// @brief 局所の頂点番号から作業用メッシュの頂点番号への対応
+    std::vector<std::uint32_t> vertices;
+    /// @brief 頂点の結果を作業用メッシュへ書き戻すか
+    /// @note クラスタの三角形のみが持つ頂点 (クラスタ境界でない頂点) に限る
+    std::vector<std::uint8_t> owned;
+    /// @brief 局所の作業用メッシュ
+    /// @note 先頭のcluster_size個がクラスタの三角形. 残りはクラスタ境界の頂点に
+    ///       接する他のクラスタの三角形で、縮約の可否 (link condition) の判定にのみ
+    ///       用いる (頂点は全て固定のため変更されない)
+    WorkMesh local;
+    /// @brief クラスタの三角形数
+    std::size_t cluster_size = 0;
+};
+
+/// @brief クラスタの局所的な作業用メッシュを作成する
+/// @param work 作業用メッシュ (読み取りのみ)
+/// @param cluster クラスタの三角形番号の一覧
+/// @param cluster_index クラスタの番号
+/// @param triangle_clusters 三角形ごとのクラスタの番号
+/// @param offsets, adjacency 頂点ごとの、その頂点を含む三角形の一覧 (CSR形式)
+/// @param border 頂点がクラスタ境界 (複数のクラスタの三角形が共有する) か
+ClusterMesh ExtractCluster(const WorkMesh& work, const std::vector<std::uint32_t>& cluster,
+                           const std::uint32_t cluster_index,
+                           const std::vector<std::uint32_t>& triangle_clusters,
+                           const std::vector<std::uint32_t>& offsets,
+                           const std::vector<std::uint32_t>& adjacency,
+                           const std::vector<std::uint8_t>& border) {
+    ClusterMesh result;
+    result.cluster_size = cluster.size();
+
+    // クラスタ境界の頂点に接する他のクラスタの三角形
+    std::vector<std::uint32_t> triangles = cluster;
+    std::vector<std::uint32_t> own_vertices;
+    own_vertices.reserve(3 * cluster.size());
+    for (const auto t : cluster) {
+        for (const auto v : work.triangles[t]) {
+            own_vertices.push_back(v);
+            if (!border[v]) continue;
+            for (auto a = offsets[v]; a < offsets[v + 1]; ++a) {
+                if (triangle_clusters[adjacency[a]] != cluster_index) {
+                    triangles.push_back(adjacency[a]);
+                }
+            }
+        }
+    }
+    std::sort(triangles.begin() + cluster.size(), triangles.end());
+    triangles.erase(std::unique(triangles.begin() + cluster.size(), triangles.end()),
+                    triangles.end());
+    std::sort(own_vertices.begin(), own_vertices.end());
+    own_vertices.erase(std::unique(own_vertices.begin(), own_vertices.end()),
+                       own_vertices.end());
+
+    // 局所の頂点番号を振る
+    auto& vertices = result.vertices;
+    for (const auto t : triangles) {
+        for (const auto v : work.triangles[t]) vertices.push_back(v);
+    }
+    std::sort(vertices.begin(), vertices.end());
+    vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+    const auto local_index = [&vertices](const std::uint32_t v) {
+        return static_cast<std::uint32_t>(
+                std::lower_bound(vertices.begin(), vertices.end(), v) - vertices.begin());
+    };
+
+    auto& local = result.local;
+    const auto n = vertices.size();
+    local.positions.resize(n);
+    local.quadrics.resize(n);
+    local.kinds.resize(n);
+    result.owned.resize(n);
+    if (!work.normals.empty()) local.normals.resize(n);
+    if (!work.uvs.empty()) local.uvs.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto v = vertices[i];
+        result.owned[i] = !border[v] &&
+                std::binary_search(own_vertices.begin(), own_vertices.end(), v);
+        local.positions[i] = work.positions[v];
+        local.quadrics[i] = work.quadrics[v];
+        local.kinds[i] = result.owned[i] ? work.kinds[v] : VertexKind::kLocked;
+        if (!work.normals.empty()) local.normals[i] = work.normals[v];
+        if (!work.uvs.empty()) local.uvs[i] = work.uvs[v];
+    }
+    local.triangles.resize(triangles.size());
+    local.face_normals.resize(triangles.size());
+    for (std::size_t i = 0; i < triangles.size(); ++i) {
+        const auto& tri = work.triangles[triangles[i]];
+        local.face_normals[i] = work.face_normals[triangles[i]];
+        for (int k = 0; k < 3; ++k) {
+            local.triangles[i][k] = local_index(tri[k]);
+            if (work.IsFeatureEdge(tri[k], tri[(k + 1) % 3])) {
+                local.feature_edges.insert(EdgeKey(local_index(tri[k]),
+                                                   local_index(tri[(k + 1) % 3])));
+            }
+        }
+    }
+    return result;
+}
+
+/// @brief 簡略化したクラスタを作業用メッシュへ書き戻す
+/// @param[in,out] work 作業用メッシュ. クラスタの三角形と、クラスタが所有する
+///                頂点のみを書き換える (クラスタ間で書き込み先は重ならない)
+/// @param cluster クラスタの三角形番号の一覧
+/// @param cluster_mesh 簡略化したクラスタ
+/// @param[out] feature_edges 簡略化後のクラスタの三角形が持つ特徴線の辺
+void WriteBackCluster(WorkMesh& work, const std::vector<std::uint32_t>& cluster,
+                      const ClusterMesh& cluster_mesh,
+                      std::vector<std::uint64_t>& feature_edges) {
+    const auto& vertices = cluster_mesh.vertices;
+    const auto& local = cluster_mesh.local;
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+        if (!cluster_mesh.owned[i]) continue;
+        const auto v = vertices[i];
+        work.positions[v] = local.positions[i];
+        work.quadrics[v] = local.quadrics[i];
+        if (!work.normals.empty()) work.normals[v] = local.normals[i];
+        if (!work.uvs.empty()) work.uvs[v] = local.uvs[i];
+    }
+    feature_edges.clear();
+    for (std::size_t i = 0; i < cluster.size(); ++i) {
+        const auto& tri = local.triangles[i];
+        auto& dst = work.triangles[cluster[i]];
+        if (tri[0] == kInvalid) {
+            dst[0] = kInvalid;
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            dst[k] = vertices[tri[k]];
+            if (local.IsFeatureEdge(tri[k], tri[(k + 1) % 3])) {
+                feature_edges.push_back(EdgeKey(vertices[tri[k]],
+                                                vertices[tri[(k + 1) % 3]]));
+            }
+        }
+    }
+}
+
+/// @brief クラスタごとに並列に簡略化する
+/// @return 行った縮約のコストの最大値
+double SimplifyClusters(WorkMesh& work, const i_num::MeshSimplificationParams& params,
+                        const double max_cost) {
+    const auto clusters = PartitionTriangles(work, params.cluster_triangle_count);
+    if (clusters.size() < 2) return 0.0;
+
+    // 頂点ごとの三角形の一覧 (CSR形式) と、三角形ごとのクラスタの番号
+    const auto vertex_count = work.positions.size();
+    std::vector<std::uint32_t> triangle_clusters(work.triangles.size(), kInvalid);
+    std::vector<std::uint32_t> offsets(vertex_count + 1, 0);
+    for (std::size_t c = 0; c < clusters.size(); ++c) {
+        for (const auto t : clusters[c]) {
+            triangle_clusters[t] = static_cast<std::uint32_t>(c);
+            for (const auto v : work.triangles[t]) ++offsets[v + 1];
+        }
+    }
+    for (std::size_t v = 0; v < vertex_count; ++v) offsets[v + 1] += offsets[v];
+    std::vector<std::uint32_t> adjacency(offsets.back());
+    {
+        auto cursor = offsets;
+        for (const auto& cluster : clusters) {
+            for (const auto t : cluster) {
+                for (const auto v : work.triangles[t]) adjacency[cursor[v]++] = t;
+            }
+        }
+    }
+
+    // 複数のクラスタの三角形が共有する頂点をクラスタ境界とする
+    std::vector<std::uint8_t> border(vertex_count, 0);
+    for (std::size_t v = 0; v < vertex_count; ++v) {
+        for (auto a = offsets[v]; a < offsets[v + 1]; ++a) {
+            if (triangle_clusters[adjacency[a]] != triangle_clusters[adjacency[offsets[v]]]) {
+                border[v] = 1;
+                break;
+            }
+        }
+    }
+
+    // 各クラスタの抽出 (読み取りのみ)・簡略化・書き戻し (書き込み先は互いに
+    // 重ならない) をそれぞれ並列に行う. 抽出を全て終えてから書き戻すため、
+    // 他のクラスタの書き戻し途中の状態は読まない
+    std::vector<ClusterMesh> cluster_meshes(clusters.size());
+    igesio::ParallelFor(clusters.size(), [&](const std::size_t c) {
+        cluster_meshes[c] = ExtractCluster(work, clusters[c], static_cast<std::uint32_t>(c),
+                                           triangle_clusters, offsets, adjacency, border);
+    }, 1);
+
+    // 目標の三角形数はクラスタの三角形数に比例して割り振る
+    std::size_t total = 0;
+    for (const auto& cluster : clusters) total += cluster.size();
+    std::vector<double> costs(clusters.size(), 0.0);
+    igesio::ParallelFor(clusters.size(), [&](const std::size_t c) {
+        auto& cluster_mesh = cluster_meshes[c];
+        const std::size_t target = (params.target_triangle_count == 0) ? 0
+                : (clusters[c].size() * params.target_triangle_count + total - 1) / total;
+        const auto halo_count = cluster_mesh.local.triangles.size() - clusters[c].size();
+        costs[c] = EdgeCollapser(cluster_mesh.local).Run(target + halo_count, max_cost);
+    }, 1);
+
+    std::vector<std::vector<std::uint64_t>> feature_edges(clusters.size());
+    igesio::ParallelFor(clusters.size(), [&](const std::size_t c) {
+        WriteBackCluster(work, clusters[c], cluster_meshes[c], feature_edges[c]);
+    }, 1);
+
+    work.feature_edges.clear();
+    for (const auto& edges : feature_edges) {
+        work.feature_edges.insert(edges.begin(), edges.end());
+    }
+    return *std::max_element(costs.begin(), costs.end());
+}
+
+/// @brief 作業用メッシュから出力のメッシュを作成する
+/// @param work 簡略化後の作業用メッシュ
+/// @param source 入力メッシュ (面グループの参照に用いる)
+i_num::TriangleMeshd ToTriangleMesh(const WorkMesh& work,
+                                    const i_num::TriangleMeshd& source) {
+    // 参照される頂点のみを元の順序で残す
+    std::vector<std::uint32_t> remap(work.positions.size(), kInvalid);
+    for (const auto& tri : work.triangles) {
+        if (tri[0] == kInvalid) continue;
+        for (const auto v : tri) remap[v] = 0;
+    }
+    std::uint32_t vertex_count = 0;
+    for (auto& r : remap) {
+        if (r != kInvalid) r = vertex_count++;
+    }
+
+    i_num::TriangleMeshd mesh;
+    mesh.positions.resize(3, vertex_count);
+    if (!work.normals.empty()) mesh.normals.resize(3, vertex_count);
+    if (!work.uvs.empty()) mesh.uvs.resize(2, vertex_count);
+    for (std::size_t v = 0; v < remap.size(); ++v) {
+        if (remap[v] == kInvalid) continue;
+        const auto col = static_cast<Eigen::Index>(remap[v]);
+        mesh.positions.col(col) = work.positions[v];
+        if (!work.normals.empty()) mesh.normals.col(col) = work.normals[v];
+        if (!work.uvs.empty()) mesh.uvs.col(col) = work.uvs[v];
+    }
+
+    // 残った三角形を元の順序で並べ、面グループの範囲を付け直す
+    std::vector<std::uint32_t> alive_before(work.triangles.size() + 1, 0);
+    for (std::size_t t = 0; t < work.triangles.size(); ++t) {
+        const auto& tri = work.triangles[t];
+        const bool alive = (tri[0] != kInvalid);
+        alive_before[t + 1] = alive_before[t] + (alive ? 1 : 0);
+        if (!alive) continue;
+        for (const auto v : tri) mesh.indices.push_back(remap[v]);
+    }
+    for (const auto& group : source.groups) {
+        const std::size_t first = std::min<std::size_t>(
+                group.first_triangle, work.triangles.size());
+        const std::size_t last = std::min<std::size_t>(
+                first + group.triangle_count, work.triangles.size());
+        auto& g = mesh.groups.emplace_back(group);
+        g.first_triangle = alive_before[first];
+        g.triangle_count = alive_before[last] - alive_before[first];
+    }
+    return mesh;
+}
+
+}  // namespace
+
+
+
+i_num::TriangleMeshd i_num::SimplifyMesh(const TriangleMeshd& mesh,
+                                         const MeshSimplificationParams& params,
+                                         double* result_error) {
+    if (result_error) *result_error = 0.0;
+    if (mesh.TriangleCount() == 0) return mesh;
+
+    auto work = BuildWorkMesh(mesh, params);
+    const double max_cost = params.max_error * params.max_error;
+
+    // クラスタ並列で大まかに簡略化した後、クラスタ境界を含めて全体を仕上げる
+    double cost = 0.0;
+    if (params.parallel && params.cluster_triangle_count > 0 &&
+        mesh.TriangleCount() >= 2 * params.cluster_triangle_count) {
+        cost = SimplifyClusters(work, params, max_cost);
+    }
+    cost = std::max(cost, EdgeCollapser(work).Run(params.target_triangle_count, max_cost));
+
+    if (result_error) *result_error = std::sqrt(cost);
+    return ToTriangleMesh(work, mesh);
+}
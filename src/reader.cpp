@@ -11,12 +11,14 @@
 #include <cstdlib>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "igesio/common/parallel.h"
 #include "igesio/utils/iges_string_utils.h"
 #include "igesio/utils/iges_binary_reader.h"
 #include "igesio/entities/factory.h"
@@ -354,38 +356,13 @@ void BuildInitialTree(i_model::Assembly& root) {
     (void)root;
 }
 
-/// @brief ベース曲線Bが省略された Type 142 についてBをC・Sから再構築する
-///
-/// BPTR=0 (CATIA 等) の CurveOnAParametricSurfaceは、参照解決後にモデル空間曲線Cと
-/// 曲面Sからパラメータ空間のベース曲線 B = S^{-1}∘C を再構築できる. 再構築したBは
-/// 出力時に DE/BPTR を付与するためルート直下へ登録する.
-/// @param root 全エンティティが登録され参照解決済みのルート Assembly
-void ReconstructOmittedBaseCurves(i_model::Assembly& root) {
-    // 反復中にentities_を変更しないよう、対象のType 142を先に収集する
-    std::vector<std::shared_ptr<i_ent::CurveOnAParametricSurface>> targets;
-    for (const auto& [id, entity] : root.GetEntities()) {
-        if (auto cos = std::dynamic_pointer_cast<
-                i_ent::CurveOnAParametricSurface>(entity)) {
-            targets.push_back(cos);
-        }
-    }
-    // 各Type 142についてBを再構築し、生成できたBをモデルへ登録する.
-    // 再構築不要 (Bが省略されていない) / 失敗の場合はnullptrが返る.
-    for (auto& cos : targets) {
-        auto base = cos->ReconstructOmittedBaseCurve();
-        if (auto eb = std::dynamic_pointer_cast<i_ent::EntityBase>(base)) {
-            root.AddEntity(eb);
-        }
-    }
-}
-
 }  // namespace
 
 
 
 i_model::IgesData igesio::ConvertFromIntermediate(
         const models::IntermediateIgesData& intermediate,
-        const bool prepare_caches) {
+        const bool prepare_caches, const bool reconstruct_base_curves) {
     i_model::IgesData iges;
     iges.description = intermediate.start_section;
     iges.global_section = intermediate.global_section;
@@ -472,7 +449,10 @@ i_model::IgesData igesio::ConvertFromIntermediate(
 
     // ベース曲線Bが省略されたType 142 (CATIA等) について、参照解決済みの
     // モデル空間曲線Cと曲面SからB = S^{-1}∘Cを再構築する.
-    ReconstructOmittedBaseCurves(iges.Root());
+    // 遅延させる場合は、呼び出し側が必要に応じてReconstructOmittedBaseCurvesを呼ぶ.
+    if (reconstruct_base_curves) {
+        ReconstructOmittedBaseCurves(iges.Root());
+    }
 
     // 読み込んだエンティティから初期ツリー(子Assembly階層)を導出する
     BuildInitialTree(iges.Root());
@@ -487,10 +467,38 @@ i_model::IgesData igesio::ConvertFromIntermediate(
 
 i_model::IgesData igesio::ReadIges(const std::string& file_path,
                                    const bool validate_strictly,
-                                   const bool prepare_caches) {
+                                   const bool prepare_caches,
+                                   const bool reconstruct_base_curves) {
     // IGESファイルを読み込み、中間データ構造を生成
     auto intermediate = ReadIgesIntermediate(file_path, validate_strictly);
 
     // 中間データ構造からIgesDataクラスを生成
-    return ConvertFromIntermediate(intermediate, prepare_caches);
+    return ConvertFromIntermediate(
+            intermediate, prepare_caches, reconstruct_base_curves);
+}
+
+void igesio::ReconstructOmittedBaseCurves(models::Assembly& root) {
+    // 反復中にentities_を変更しないよう、対象のType 142を先に収集する
+    std::vector<std::shared_ptr<i_ent::CurveOnAParametricSurface>> targets;
+    for (const auto& [id, entity] : root.GetEntities()) {
+        auto cos = std::dynamic_pointer_cast<i_ent::CurveOnAParametricSurface>(entity);
+        if (cos && cos->IsBaseCurveOmitted()) targets.push_back(cos);
+    }
+
+    // 逆射影は互いに独立なため並列に行う (同じ曲面Sを参照するType 142の間では
+    // 曲面の格子サンプル索引が共有され、その構築は一度だけ行われる)
+    std::vector<std::optional<std::vector<iio::Vector3d>>> uv_points(targets.size());
+    iio::ParallelFor(targets.size(), [&](const std::size_t i) {
+        uv_points[i] = targets[i]->InvertOmittedBaseCurve();
+    });
+
+    // Bの生成 (IDの発行) とモデルへの登録は、並列実行の順序に依存しないよう
+    // 収集順に逐次行う (逐次に再構築した場合と同じ順序). 失敗した場合はnullptrが返る.
+    for (std::size_t i = 0; i < targets.size(); ++i) {
+        if (!uv_points[i]) continue;
+        auto base = targets[i]->ReconstructOmittedBaseCurve(*uv_points[i]);
+        if (auto eb = std::dynamic_pointer_cast<i_ent::EntityBase>(base)) {
+            root.AddEntity(eb);
+        }
+    }
 }
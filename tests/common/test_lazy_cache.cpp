@@ -0,0 +1,157 @@
+/**
+ * @file common/test_lazy_cache.cpp
+ * @brief common/lazy_cache.hのテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * テスト対象:
+ *   - igesio::LazyCache<T, Key>::Get(key, build) / Get(build)
+ *   - igesio::LazyCache<T, Key>::Peek(key) / Reset()
+ *   - コピー時の値の共有
+ *
+ * 並列実行のテストは、構築回数 (atomicで計数) と全スレッドが同じ値を得ることを
+ * 検証する。データ競合の検出はIGESIO_ENABLE_TSANを有効にしたビルドで行う。
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "igesio/common/lazy_cache.h"
+#include "igesio/common/parallel.h"
+
+namespace {
+
+/// @brief 並列パスを強制する閾値
+constexpr std::size_t kForceParallel = 0;
+
+}  // namespace
+
+
+
+/**
+ * 構築と再利用
+ */
+
+// 初回のGetで構築し、以降は同じ値を返す
+TEST(LazyCacheTest, BuildsOnceAndReuses) {
+    igesio::LazyCache<std::vector<int>> cache;
+    int builds = 0;
+    const auto build = [&builds]() {
+        ++builds;
+        return std::vector<int>{1, 2, 3};
+    };
+
+    EXPECT_EQ(cache.Peek(), nullptr);
+    const auto first = cache.Get(build);
+    const auto second = cache.Get(build);
+    EXPECT_EQ(builds, 1);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(*first, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(cache.Peek().get(), first.get());
+}
+
+// キーが変化した場合は再構築し、置き換え前の値は取得済みのポインタから参照できる
+TEST(LazyCacheTest, RebuildsWhenKeyChanges) {
+    igesio::LazyCache<int, std::uint64_t> cache;
+    int builds = 0;
+
+    const auto v1 = cache.Get(1, [&builds]() { ++builds; return 10; });
+    EXPECT_EQ(*cache.Get(1, [&builds]() { ++builds; return -1; }), 10);
+    const auto v2 = cache.Get(2, [&builds]() { ++builds; return 20; });
+
+    EXPECT_EQ(builds, 2);
+    EXPECT_EQ(*v1, 10);
+    EXPECT_EQ(*v2, 20);
+    EXPECT_EQ(cache.Peek(1), nullptr);
+    ASSERT_NE(cache.Peek(2), nullptr);
+    EXPECT_EQ(*cache.Peek(2), 20);
+}
+
+// Resetで破棄した後のGetは再構築する
+TEST(LazyCacheTest, ResetDiscardsValue) {
+    igesio::LazyCache<int> cache;
+    int builds = 0;
+    cache.Get([&builds]() { return ++builds; });
+    cache.Reset();
+    EXPECT_EQ(cache.Peek(), nullptr);
+    EXPECT_EQ(*cache.Get([&builds]() { return ++builds; }), 2);
+}
+
+// 構築関数の例外は呼び出し側へ伝播し、何も保持しない
+TEST(LazyCacheTest, ExceptionLeavesCacheEmpty) {
+    igesio::LazyCache<int> cache;
+    EXPECT_THROW(cache.Get([]() -> int { throw std::runtime_error("fail"); }),
+                 std::runtime_error);
+    EXPECT_EQ(cache.Peek(), nullptr);
+    EXPECT_EQ(*cache.Get([]() { return 7; }), 7);
+}
+
+// コピーはコピー元の値を共有し、以降の無効化は互いに影響しない
+TEST(LazyCacheTest, CopySharesValue) {
+    igesio::LazyCache<int> cache;
+    const auto original = cache.Get([]() { return 5; });
+
+    igesio::LazyCache<int> copy(cache);
+    EXPECT_EQ(copy.Peek().get(), original.get());
+
+    copy.Reset();
+    EXPECT_EQ(copy.Peek(), nullptr);
+    EXPECT_EQ(cache.Peek().get(), original.get());
+
+    igesio::LazyCache<int> assigned;
+    assigned = cache;
+    EXPECT_EQ(assigned.Peek().get(), original.get());
+}
+
+
+
+/**
+ * 並列実行
+ */
+
+// 複数スレッドから同時にGetしても構築は一度だけで、全スレッドが同じ値を得る
+TEST(LazyCacheTest, ConcurrentGetBuildsOnce) {
+    constexpr std::size_t kCount = 256;
+    igesio::LazyCache<std::vector<double>> cache;
+    std::atomic<int> builds{0};
+    std::vector<const std::vector<double>*> seen(kCount, nullptr);
+
+    igesio::ParallelFor(kCount, [&](const std::size_t i) {
+        const auto value = cache.Get([&builds]() {
+            builds.fetch_add(1, std::memory_order_relaxed);
+            return std::vector<double>(1000, 1.5);
+        });
+        seen[i] = value.get();
+    }, kForceParallel);
+
+    EXPECT_EQ(builds.load(), 1);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        EXPECT_EQ(seen[i], seen[0]) << "index " << i;
+    }
+    EXPECT_EQ(seen[0]->size(), 1000u);
+}
+
+// 読み出しと無効化が並行しても、各スレッドは常に構築済みの値を得る
+TEST(LazyCacheTest, ConcurrentGetAndReset) {
+    constexpr std::size_t kCount = 512;
+    igesio::LazyCache<int> cache;
+    std::atomic<int> mismatches{0};
+
+    igesio::ParallelFor(kCount, [&](const std::size_t i) {
+        if (i % 8 == 0) {
+            cache.Reset();
+            return;
+        }
+        if (*cache.Get([]() { return 42; }) != 42) {
+            mismatches.fetch_add(1, std::memory_order_relaxed);
+        }
+    }, kForceParallel);
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
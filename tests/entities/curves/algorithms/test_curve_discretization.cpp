@@ -0,0 +1,212 @@
+/**
+ * @file tests/entities/curves/algorithms/test_curve_discretization.cpp
+ * @brief DiscretizeCurve (entities/curves/algorithms) のテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 検証する不変量:
+ *       - 直線部は分割せず、角点・直線部の端点を必ず頂点に含む
+ *       - 曲線部は弦高・角度・辺長 (写像後・スクリーン空間を含む) の許容量を満たす
+ *       - 評価できない点で折れ線を分割する
+ *       - ICurve::TryGetPointsAt はTryGetPointAtと同じ値を返す
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/curves/circular_arc.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/curves/linear_path.h"
+#include "igesio/entities/transformations/transformation_matrix.h"
+#include "igesio/entities/curves/algorithms/curve_discretization.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+using igesio::Vector2d;
+using igesio::Vector3d;
+using i_ent::CurveDiscretizationParams;
+using i_ent::DiscretizeCurve;
+
+constexpr double kPi = 3.14159265358979323846;
+
+/// @brief 全ての頂点数の合計
+std::size_t CountPoints(const std::vector<i_ent::CurvePolyline>& polylines) {
+    std::size_t count = 0;
+    for (const auto& polyline : polylines) count += polyline.points.size();
+    return count;
+}
+
+}  // namespace
+
+
+
+/**
+ * 直線部・角点
+ */
+
+// 線分は両端の2点のみとなる
+TEST(DiscretizeCurveTest, LineIsNotSubdivided) {
+    const auto line = i_ent::MakeLine(Vector3d(0., 0., 0.), Vector3d(10., 5., 0.));
+    CurveDiscretizationParams params;
+    params.tolerance.chord_height = 1e-3;
+    params.tolerance.angle = 0.1;
+
+    const auto polylines = DiscretizeCurve(*line, line->GetParameterRange(), params);
+    ASSERT_EQ(polylines.size(), 1u);
+    ASSERT_EQ(polylines[0].points.size(), 2u);
+    EXPECT_TRUE(polylines[0].points[0].isApprox(Vector3d(0., 0., 0.)));
+    EXPECT_TRUE(polylines[0].points[1].isApprox(Vector3d(10., 5., 0.)));
+
+    // 辺長の上限を指定した場合は上限以下に分割する
+    params.tolerance.max_edge_length = 3.;
+    const auto split = DiscretizeCurve(*line, line->GetParameterRange(), params);
+    ASSERT_EQ(split.size(), 1u);
+    EXPECT_GT(split[0].points.size(), 2u);
+    for (std::size_t i = 0; i + 1 < split[0].points.size(); ++i) {
+        EXPECT_LE((split[0].points[i + 1] - split[0].points[i]).norm(), 3.);
+    }
+}
+
+// 折れ線は頂点 (角点) のみとなる
+TEST(DiscretizeCurveTest, LinearPathKeepsOnlyCorners) {
+    const std::vector<Vector2d> vertices = {
+        {0., 0.}, {3., 0.}, {3., 2.}, {1., 4.}};
+    const auto path = i_ent::MakeLinearPath(vertices);
+    CurveDiscretizationParams params;
+    params.tolerance.chord_height = 1e-4;
+
+    const auto polylines = DiscretizeCurve(*path, path->GetParameterRange(), params);
+    ASSERT_EQ(polylines.size(), 1u);
+    ASSERT_EQ(polylines[0].points.size(), vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+        EXPECT_TRUE(polylines[0].points[i].isApprox(
+                Vector3d(vertices[i].x(), vertices[i].y(), 0.)));
+    }
+}
+
+
+
+/**
+ * 曲線部
+ */
+
+// 円は弦高の許容量を満たし、許容量を小さくすると頂点が増える
+TEST(DiscretizeCurveTest, CircleSatisfiesChordHeight) {
+    const double radius = 5.;
+    const auto circle = i_ent::MakeCircle(Vector2d(1., 2.), radius);
+    const auto range = circle->GetParameterRange();
+
+    std::size_t previous = 0;
+    for (const double chord : {1e-1, 1e-2, 1e-3}) {
+        CurveDiscretizationParams params;
+        params.tolerance.chord_height = chord;
+        params.max_depth = 16;
+        const auto polylines = DiscretizeCurve(*circle, range, params);
+        ASSERT_EQ(polylines.size(), 1u);
+        const auto& points = polylines[0].points;
+        EXPECT_TRUE(points.front().isApprox(points.back()));
+
+        // 各辺の弦高 (半径 - 中心から辺の中点までの距離)
+        for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+            const Vector3d mid = 0.5 * (points[i] + points[i + 1]);
+            const double sagitta = radius - (mid - Vector3d(1., 2., 0.)).norm();
+            EXPECT_LE(sagitta, chord * (1. + 1e-9));
+        }
+        EXPECT_GT(points.size(), previous);
+        previous = points.size();
+    }
+    // 弦高1e-3を満たす一様分割の最小の頂点数 (π/acos(1 - 1e-3/5) ≈ 222) の2倍以内
+    EXPECT_LT(previous, 2 * 223u);
+}
+
+// 角度の許容量を満たす
+TEST(DiscretizeCurveTest, ArcSatisfiesAngle) {
+    const auto circle = i_ent::MakeCircle(Vector2d(0., 0.), 1.);
+    CurveDiscretizationParams params;
+    params.tolerance.angle = kPi / 18.;  // 10度
+
+    const auto polylines = DiscretizeCurve(*circle, circle->GetParameterRange(), params);
+    ASSERT_EQ(polylines.size(), 1u);
+    const auto& points = polylines[0].points;
+    for (std::size_t i = 1; i + 1 < points.size(); ++i) {
+        const Vector3d d0 = points[i] - points[i - 1];
+        const Vector3d d1 = points[i + 1] - points[i];
+        const double angle = std::acos(d0.normalized().dot(d1.normalized()));
+        EXPECT_LE(angle, kPi / 18. + 1e-9);
+    }
+}
+
+// スクリーン空間の許容量は、射影後の大きさに応じて分割を変える
+TEST(DiscretizeCurveTest, ScreenToleranceFollowsProjection) {
+    const auto circle = i_ent::MakeCircle(Vector2d(0., 0.), 1.);
+    const auto range = circle->GetParameterRange();
+    const auto count_with_scale = [&](const double scale) {
+        CurveDiscretizationParams params;
+        params.screen.chord_height = 0.5;
+        params.screen.project = [scale](const Vector3d& p) -> std::optional<Vector2d> {
+            return Vector2d(scale * p.x(), scale * p.y());
+        };
+        return CountPoints(DiscretizeCurve(*circle, range, params));
+    };
+    // 画面上で大きく表示されるほど細かく分割する
+    EXPECT_LT(count_with_scale(10.), count_with_scale(1000.));
+}
+
+
+
+/**
+ * 写像・評価
+ */
+
+// 写像できない点で折れ線を分割する
+TEST(DiscretizeCurveTest, SplitsAtUnmappablePoints) {
+    const auto line = i_ent::MakeLine(Vector3d(-1., 0., 0.), Vector3d(1., 0., 0.));
+    CurveDiscretizationParams params;
+    params.initial_segments = 8;
+    params.max_depth = 4;
+    // |x| < 0.3 を写像できない区間とする
+    const auto polylines = DiscretizeCurve(
+            *line, line->GetParameterRange(), params,
+            [](const Vector3d& p) -> std::optional<Vector3d> {
+                if (std::abs(p.x()) < 0.3) return std::nullopt;
+                return p;
+            });
+    // 直線部は1区間から始まるが、写像できない区間の境界を細分して2本に分かれる
+    ASSERT_EQ(polylines.size(), 2u);
+    EXPECT_LT(polylines[0].points.back().x(), -0.3 + 1e-12);
+    EXPECT_GT(polylines[1].points.front().x(), 0.3 - 1e-12);
+    EXPECT_GT(polylines[0].points.back().x(), -0.5);
+    EXPECT_LT(polylines[1].points.front().x(), 0.5);
+
+    EXPECT_THROW(DiscretizeCurve(*line, {0., std::numeric_limits<double>::infinity()}),
+                 std::invalid_argument);
+    EXPECT_TRUE(DiscretizeCurve(*line, {1., 0.}).empty());
+}
+
+// まとめて評価した点は個別に評価した点と一致する (変換行列あり)
+TEST(DiscretizeCurveTest, BatchedEvaluationMatchesPointwise) {
+    auto circle = i_ent::MakeCircle(Vector2d(1., 0.), 2.);
+    ASSERT_TRUE(circle->OverwriteTransformationMatrix(i_ent::MakeRotation(
+            0.7, Vector3d(1., 1., 0.), Vector3d(0., 3., 1.))));
+
+    const auto range = circle->GetParameterRange();
+    std::vector<double> ts;
+    for (int i = 0; i <= 10; ++i) ts.push_back(range[0] + (range[1] - range[0]) * i / 10.);
+    ts.push_back(range[1] + 1.);  // 範囲外
+
+    const auto points = circle->TryGetPointsAt(ts);
+    ASSERT_EQ(points.size(), ts.size());
+    for (std::size_t i = 0; i < ts.size(); ++i) {
+        const auto expected = circle->TryGetPointAt(ts[i]);
+        ASSERT_EQ(points[i].has_value(), expected.has_value());
+        if (expected) {
+            EXPECT_TRUE(points[i]->isApprox(*expected, 1e-12));
+        }
+    }
+}
@@ -0,0 +1,245 @@
+/**
+ * @file entities/curves/test_curve_curve_intersection.cpp
+ * @brief curve_curve_intersection.h のテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * ### 対象関数
+ * - igesio::entities::IntersectCurves
+ *   - 線分・円・折れ線の横断交差、接する交点、交差なし
+ *   - 重なる (同一直線上の) 線分
+ *   - planar (パラメータ空間) での判定
+ * - igesio::entities::IntersectCurvePairs
+ *   - 各組の結果がIntersectCurvesと一致すること・引数の検証
+ *
+ * TODO: CompositeCurve・NURBS曲線どうしの交差は未検証
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/curves/circular_arc.h"
+#include "igesio/entities/curves/linear_path.h"
+#include "igesio/entities/curves/algorithms/curve_curve_intersection.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+using i_ent::CurveCurveIntersection;
+using i_ent::CurveCurveIntersectionParams;
+using i_ent::IntersectCurves;
+using igesio::Vector2d;
+using igesio::Vector3d;
+
+/// @brief 位置比較の許容誤差
+constexpr double kPosTol = 1e-6;
+
+/// @brief 交点位置が期待値と一致するか検証するヘルパー
+void ExpectPositionNear(const Vector3d& actual, const Vector3d& expected,
+                        const double tol = kPosTol) {
+    EXPECT_NEAR(actual.x(), expected.x(), tol);
+    EXPECT_NEAR(actual.y(), expected.y(), tol);
+    EXPECT_NEAR(actual.z(), expected.z(), tol);
+}
+
+/// @brief 交点がそれぞれの曲線上の点であることを検証するヘルパー
+void ExpectOnBothCurves(const CurveCurveIntersection& hit,
+                        const i_ent::ICurve& curve1,
+                        const i_ent::ICurve& curve2) {
+    ExpectPositionNear(curve1.GetPointAt(hit.t1), hit.position);
+    ExpectPositionNear(curve2.GetPointAt(hit.t2), hit.position);
+    EXPECT_LE(hit.gap, CurveCurveIntersectionParams{}.tolerance);
+}
+
+/// @brief 原点中心・半径2・z=0平面上の円
+std::shared_ptr<i_ent::CircularArc> MakeCircleR2(const double cx = 0.0) {
+    return i_ent::MakeCircle(Vector2d{cx, 0.}, 2.0, 0.0);
+}
+
+}  // namespace
+
+
+
+/**
+ * IntersectCurves: 横断交差
+ */
+
+// 交差する2線分: 交点とパラメータを返す
+TEST(IntersectCurvesTest, CrossingSegments) {
+    const auto seg1 = i_ent::MakeLine(Vector3d{-1., 0., 0.}, Vector3d{3., 0., 0.});
+    const auto seg2 = i_ent::MakeLine(Vector3d{0., -1., 0.}, Vector3d{0., 1., 0.});
+    const auto hits = IntersectCurves(*seg1, *seg2);
+
+    ASSERT_EQ(hits.size(), 1u);
+    ExpectPositionNear(hits[0].position, Vector3d::Zero());
+    EXPECT_NEAR(hits[0].t1, 0.25, 1e-9);
+    EXPECT_NEAR(hits[0].t2, 0.5, 1e-9);
+    ExpectOnBothCurves(hits[0], *seg1, *seg2);
+}
+
+// 円を貫く線分: 2交点をt1昇順で返す
+TEST(IntersectCurvesTest, SegmentThroughCircle) {
+    const auto seg = i_ent::MakeLine(Vector3d{-5., 0., 0.}, Vector3d{5., 0., 0.});
+    const auto circle = MakeCircleR2();
+    const auto hits = IntersectCurves(*seg, *circle);
+
+    ASSERT_EQ(hits.size(), 2u);
+    ExpectPositionNear(hits[0].position, Vector3d{-2., 0., 0.});
+    ExpectPositionNear(hits[1].position, Vector3d{2., 0., 0.});
+    EXPECT_LT(hits[0].t1, hits[1].t1);
+    for (const auto& hit : hits) ExpectOnBothCurves(hit, *seg, *circle);
+}
+
+// 2つの円: (1, ±√3, 0) で交差する (閉曲線どうし)
+TEST(IntersectCurvesTest, TwoCircles) {
+    const auto c1 = MakeCircleR2(0.0);
+    const auto c2 = MakeCircleR2(2.0);
+    const auto hits = IntersectCurves(*c1, *c2);
+
+    ASSERT_EQ(hits.size(), 2u);
+    ExpectPositionNear(hits[0].position, Vector3d{1., std::sqrt(3.0), 0.});
+    ExpectPositionNear(hits[1].position, Vector3d{1., -std::sqrt(3.0), 0.});
+    for (const auto& hit : hits) ExpectOnBothCurves(hit, *c1, *c2);
+}
+
+// 円を複数回横切る折れ線: 各辺の交点を全て返す
+TEST(IntersectCurvesTest, PolylineCrossingCircleManyTimes) {
+    const auto zigzag = i_ent::MakeLinearPath(std::vector<Vector2d>{
+            {-3., -3.}, {-1., 3.}, {0., -3.}, {1., 3.}, {3., -3.}}, false);
+    const auto circle = MakeCircleR2();
+    const auto hits = IntersectCurves(*zigzag, *circle);
+
+    ASSERT_EQ(hits.size(), 8u);
+    for (const auto& hit : hits) {
+        EXPECT_NEAR(hit.position.norm(), 2.0, kPosTol);
+        ExpectOnBothCurves(hit, *zigzag, *circle);
+    }
+}
+
+
+
+/**
+ * IntersectCurves: 接触・重なり・交差なし
+ */
+
+// 円に接する線分: 接点を1つ返す
+TEST(IntersectCurvesTest, TangentSegment) {
+    const auto seg = i_ent::MakeLine(Vector3d{-5., 2., 0.}, Vector3d{5., 2., 0.});
+    const auto circle = MakeCircleR2();
+    const auto hits = IntersectCurves(*seg, *circle);
+
+    ASSERT_EQ(hits.size(), 1u);
+    // 接点は解が浅いため、位置の精度はtoleranceの平方根程度となる
+    ExpectPositionNear(hits[0].position, Vector3d{0., 2., 0.}, 1e-2);
+    EXPECT_LE(hits[0].gap, CurveCurveIntersectionParams{}.tolerance);
+}
+
+// 離れた曲線: 交点なし
+TEST(IntersectCurvesTest, DisjointCurves) {
+    const auto seg = i_ent::MakeLine(Vector3d{-5., 3., 0.}, Vector3d{5., 3., 0.});
+    const auto circle = MakeCircleR2();
+    EXPECT_TRUE(IntersectCurves(*seg, *circle).empty());
+
+    // ねじれの位置にある線分 (xy平面上では交差する)
+    const auto skew1 = i_ent::MakeLine(Vector3d{-1., 0., 0.}, Vector3d{1., 0., 0.});
+    const auto skew2 = i_ent::MakeLine(Vector3d{0., -1., 1.}, Vector3d{0., 1., 1.});
+    EXPECT_TRUE(IntersectCurves(*skew1, *skew2).empty());
+}
+
+// 同一直線上で重なる線分: 重なり区間の端点を返す
+TEST(IntersectCurvesTest, OverlappingSegmentsReturnOverlapEnds) {
+    const auto seg1 = i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{2., 0., 0.});
+    const auto seg2 = i_ent::MakeLine(Vector3d{1., 0., 0.}, Vector3d{3., 0., 0.});
+    const auto hits = IntersectCurves(*seg1, *seg2);
+
+    ASSERT_EQ(hits.size(), 2u);
+    ExpectPositionNear(hits[0].position, Vector3d{1., 0., 0.});
+    ExpectPositionNear(hits[1].position, Vector3d{2., 0., 0.});
+}
+
+// 端点どうしが接続する折れ線: 接続点を返す (トリムループの継ぎ目の検証)
+TEST(IntersectCurvesTest, ConnectedEndpoints) {
+    const auto seg1 = i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{1., 0., 0.});
+    const auto seg2 = i_ent::MakeLine(Vector3d{1., 0., 0.}, Vector3d{1., 1., 0.});
+    const auto hits = IntersectCurves(*seg1, *seg2);
+
+    ASSERT_EQ(hits.size(), 1u);
+    ExpectPositionNear(hits[0].position, Vector3d{1., 0., 0.});
+    EXPECT_NEAR(hits[0].t1, 1.0, 1e-9);
+    EXPECT_NEAR(hits[0].t2, 0.0, 1e-9);
+}
+
+
+
+/**
+ * IntersectCurves: パラメータ空間 (planar) での判定
+ */
+
+// z座標の異なる線分は、planarではxy平面上の交点を返す
+TEST(IntersectCurvesTest, PlanarIgnoresZ) {
+    const auto seg1 = i_ent::MakeLine(Vector3d{-1., 0., 0.}, Vector3d{1., 0., 0.});
+    const auto seg2 = i_ent::MakeLine(Vector3d{0.5, -1., 1.}, Vector3d{0.5, 1., 1.});
+    CurveCurveIntersectionParams params;
+    params.planar = true;
+    const auto hits = IntersectCurves(*seg1, *seg2, params);
+
+    ASSERT_EQ(hits.size(), 1u);
+    ExpectPositionNear(hits[0].position, Vector3d{0.5, 0., 0.});
+    EXPECT_NEAR(hits[0].t1, 0.75, 1e-9);
+    EXPECT_NEAR(hits[0].t2, 0.5, 1e-9);
+}
+
+// パラメータ範囲が無限の曲線は例外
+TEST(IntersectCurvesTest, ThrowsForInfiniteCurve) {
+    const auto line = i_ent::MakeUnboundedLine(Vector3d::Zero(), Vector3d::UnitX());
+    const auto circle = MakeCircleR2();
+    EXPECT_THROW(IntersectCurves(*line, *circle), std::invalid_argument);
+}
+
+
+
+/**
+ * IntersectCurvePairs
+ */
+
+// 各組の結果がIntersectCurvesと一致する (曲線を複数の組で共有する)
+TEST(IntersectCurvePairsTest, MatchesSingleQueries) {
+    std::vector<std::shared_ptr<const i_ent::ICurve>> curves = {
+            MakeCircleR2(0.0), MakeCircleR2(2.0), MakeCircleR2(5.0),
+            i_ent::MakeLine(Vector3d{-5., 0., 0.}, Vector3d{8., 0., 0.}),
+            i_ent::MakeLine(Vector3d{1., -3., 0.}, Vector3d{1., 3., 0.})};
+    std::vector<i_ent::CurvePair> pairs;
+    for (size_t i = 0; i < curves.size(); ++i) {
+        for (size_t j = i + 1; j < curves.size(); ++j) {
+            pairs.push_back({curves[i], curves[j]});
+        }
+    }
+
+    const auto results = i_ent::IntersectCurvePairs(pairs);
+    ASSERT_EQ(results.size(), pairs.size());
+    size_t total = 0;
+    for (size_t k = 0; k < pairs.size(); ++k) {
+        const auto expected = IntersectCurves(*pairs[k].first, *pairs[k].second);
+        ASSERT_EQ(results[k].size(), expected.size()) << "pair " << k;
+        for (size_t h = 0; h < expected.size(); ++h) {
+            ExpectPositionNear(results[k][h].position, expected[h].position);
+            EXPECT_DOUBLE_EQ(results[k][h].t1, expected[h].t1);
+            EXPECT_DOUBLE_EQ(results[k][h].t2, expected[h].t2);
+        }
+        total += expected.size();
+    }
+    EXPECT_GT(total, 0u);  // 判定が自明 (全て交差なし) でないこと
+}
+
+// nullptrを含む組は例外
+TEST(IntersectCurvePairsTest, ThrowsForNullCurve) {
+    std::vector<i_ent::CurvePair> pairs = {{MakeCircleR2(), nullptr}};
+    EXPECT_THROW(i_ent::IntersectCurvePairs(pairs), std::invalid_argument);
+    EXPECT_TRUE(i_ent::IntersectCurvePairs({}).empty());
+}
@@ -15,7 +15,9 @@
  *     SetCreationType(), SetPreferredRepresentation(),
  *     HasBaseCurve(), IsBaseCurveOmitted(), SetCurves()
  *   [ベース曲線の再構築]
- *     ReconstructOmittedBaseCurve()
+ *     ReconstructOmittedBaseCurve(), InvertOmittedBaseCurve()
+ *   [弧長パラメータ化]
+ *     ParametersAtEqualArcLength() (Cのパラメータ範囲がBと異なる場合)
  *
  * NOTE:
  *   - 曲面フィクスチャは双一次B-Spline S(u,v) = (2u, v, 0) (定義域[0,1]²)
@@ -42,11 +44,13 @@
 #include "igesio/numerics/core/tolerance.h"
 #include "igesio/entities/curves/curve_on_a_parametric_surface.h"
 #include "igesio/entities/curves/line.h"
+#include "igesio/entities/curves/rational_b_spline_curve.h"
 #include "igesio/entities/surfaces/rational_b_spline_surface.h"
 
 namespace {
 
 namespace i_ent = igesio::entities;
+using igesio::Matrix3Xd;
 using igesio::Vector3d;
 using i_ent::CurveOnSurface;
 using i_ent::CurveCreationType;
@@ -568,3 +572,80 @@ TEST(CurveOnSurfaceReconstructTest,
     EXPECT_FALSE(parts.cos->HasBaseCurve());
     EXPECT_TRUE(parts.cos->IsBaseCurveOmitted());
 }
+
+// 逆射影と生成を分けて呼び出した場合も、一括の再構築と同じBが得られる
+TEST(CurveOnSurfaceReconstructTest,
+     InvertOmittedBaseCurve_ThenReconstructMatchesOneShot) {
+    const auto parts = MakeCosWithOmittedB(/*resolve=*/true);
+    const auto uv_points = parts.cos->InvertOmittedBaseCurve();
+    ASSERT_TRUE(uv_points.has_value());
+    ASSERT_GE(uv_points->size(), 2u);
+    EXPECT_TRUE(parts.cos->IsBaseCurveOmitted());  // 逆射影のみでは変更しない
+
+    const auto base = parts.cos->ReconstructOmittedBaseCurve(*uv_points);
+    ASSERT_NE(base, nullptr);
+    EXPECT_TRUE(parts.cos->HasBaseCurve());
+
+    const auto reference = MakeCosWithOmittedB(/*resolve=*/true);
+    ASSERT_NE(reference.cos->ReconstructOmittedBaseCurve(), nullptr);
+    const auto [t0, t1] = parts.cos->GetParameterRange();
+    for (int i = 0; i <= 4; ++i) {
+        const double t = t0 + (t1 - t0) * i / 4.0;
+        ExpectVectorNear(EvalAt(*parts.cos, t), EvalAt(*reference.cos, t), kApproxTol);
+    }
+
+    // 再構築後は対象外となる
+    EXPECT_FALSE(parts.cos->InvertOmittedBaseCurve().has_value());
+    EXPECT_EQ(parts.cos->ReconstructOmittedBaseCurve(*uv_points), nullptr);
+}
+
+// Bが設定済み・S/Cが未解決の場合はstd::nulloptを返す
+TEST(CurveOnSurfaceReconstructTest, InvertOmittedBaseCurve_ReturnsNulloptWhenNotApplicable) {
+    EXPECT_FALSE(MakeDefaultCos()->InvertOmittedBaseCurve().has_value());
+    const auto parts = MakeCosWithOmittedB(/*resolve=*/false);
+    EXPECT_FALSE(parts.cos->InvertOmittedBaseCurve().has_value());
+}
+
+
+
+/**
+ * 弧長パラメータ化のテスト (CとBのパラメータ範囲が異なる場合)
+ */
+
+// 弧長パラメータはBの定義域 (GetParameterRange) の値で返る
+TEST(CurveOnSurfaceArcLengthTest, ParametersAtEqualArcLength_UsesBaseCurveDomain) {
+    // C(t) = S(B(t)) と同じ線分だが、パラメータ範囲を [0, 10] とする
+    Matrix3Xd cps(3, 2);
+    cps.col(0) = Vector3d(0.4, 0.2, 0.0);
+    cps.col(1) = Vector3d(1.6, 0.5, 0.0);
+    const auto curve = i_ent::MakeRationalBSplineCurve(
+        1, cps, {0.0, 0.0, 10.0, 10.0}, {}, std::array<double, 2>{0.0, 10.0});
+    const auto cos = i_ent::MakeCurveOnAParametricSurface(
+        MakeBilinearSurface(), MakeParamLine(0.2, 0.2, 0.8, 0.5), curve);
+    ASSERT_NE(cos, nullptr);
+    const auto [t0, t1] = cos->GetParameterRange();
+    ASSERT_DOUBLE_EQ(t0, 0.0);
+    ASSERT_DOUBLE_EQ(t1, 1.0);
+
+    // S(B(t)) は等速のため、等弧長のパラメータは等間隔となる
+    const auto params = cos->ParametersAtEqualArcLength(5);
+    ASSERT_EQ(params.size(), 5u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_NEAR(params[i], i / 4.0, kTol) << "i = " << i;
+    }
+    const auto points = cos->PointsAtEqualArcLength(5);
+    ExpectVectorNear(points[2], Vector3d(1.0, 0.35, 0.0), kTol);
+}
+
+// Bが未解決 (パラメータ範囲が {0, 0}) の場合は長さ0の曲線として扱う
+TEST(CurveOnSurfaceArcLengthTest, ParametersAtEqualArcLength_DegenerateRange) {
+    const auto parts = MakeCosWithOmittedB(/*resolve=*/false);
+    const auto [t0, t1] = parts.cos->GetParameterRange();
+    ASSERT_EQ(t0, t1);
+
+    EXPECT_EQ(parts.cos->ParameterAtLength(0.0), t0);
+    EXPECT_THROW(parts.cos->ParameterAtLength(1.0), std::out_of_range);
+    const auto params = parts.cos->ParametersAtEqualArcLength(3);
+    ASSERT_EQ(params.size(), 3u);
+    for (const auto t : params) EXPECT_EQ(t, t0);
+}
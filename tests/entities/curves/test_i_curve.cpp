@@ -9,13 +9,18 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <limits>
+#include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "igesio/numerics/core/tolerance.h"
 #include "igesio/numerics/analysis/integration.h"
 #include "igesio/entities/interfaces/i_curve.h"
+#include "igesio/entities/transformations/transformation_matrix.h"
 #include "./curves_for_testing.h"
 
 namespace {
@@ -24,6 +29,7 @@ namespace i_num = igesio::numerics;
 namespace i_ent = igesio::entities;
 using i_ent::ICurve;
 using igesio::Vector3d;
+using igesio::Matrix3Xd;
 
 /// @brief INSTANTIATE_TEST_SUITE_P用のテストパラメータ構造体
 struct TestParamT {
@@ -425,6 +431,263 @@ TEST(ICurveTest, LengthWithRange) {
     }
 }
 
+// ICurve::ParameterAtLength() のテスト
+TEST(ICurveTest, ParameterAtLength) {
+    // テスト用の曲線で、逆算したパラメータまでの長さが指定した弧長に一致することを確認
+    auto curves = igesio::tests::CreateAllTestCurves();
+    for (const auto& curve : curves) {
+        SCOPED_TRACE("Curve: " + curve.name);
+        ASSERT_TRUE(curve.curve != nullptr)
+                << "Curve '" << curve.name << "' is nullptr.";
+
+        if (!curve.curve->IsFinite()) {
+            // 無限長の曲線は弧長パラメータ化できない
+            EXPECT_THROW(curve.curve->ParameterAtLength(0.0), std::out_of_range);
+            continue;
+        }
+        const double length = curve.curve->Length();
+        auto [start, end] = curve.curve->GetParameterRange();
+        if (length <= 0.0) continue;
+
+        const double tol = i_num::Tolerance().abs_tol;
+        EXPECT_DOUBLE_EQ(curve.curve->ParameterAtLength(0.0), start);
+        EXPECT_NEAR(curve.curve->Length(start, curve.curve->ParameterAtLength(length)),
+                    length, tol);
+        for (const double r : {0.1, 0.25, 0.5, 0.75, 0.9}) {
+            const double t = curve.curve->ParameterAtLength(r * length);
+            ASSERT_GT(t, start);
+            ASSERT_LT(t, end);
+            EXPECT_NEAR(curve.curve->Length(start, t), r * length, tol)
+                    << "r = " << r << ", t = " << t;
+        }
+
+        // 範囲外の弧長
+        EXPECT_THROW(curve.curve->ParameterAtLength(-1.0), std::out_of_range);
+        EXPECT_THROW(curve.curve->ParameterAtLength(length * 1.01), std::out_of_range);
+    }
+
+    // 形状の変更後はテーブルが再構築されることを確認
+    Matrix3Xd cps(3, 4);
+    cps.col(0) = Vector3d(0.0, 0.0, 0.0);
+    cps.col(1) = Vector3d(1.0, 2.0, 0.0);
+    cps.col(2) = Vector3d(3.0, 2.0, 0.0);
+    cps.col(3) = Vector3d(4.0, 0.0, 0.0);
+    auto nurbs = i_ent::MakeRationalBSplineCurve(
+        3, cps, {0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0}, {},
+        std::array<double, 2>{0.0, 1.0});
+    const double t_before = nurbs->ParameterAtLength(1.0);
+    EXPECT_NEAR(nurbs->Length(0.0, t_before), 1.0, 1e-6);
+    nurbs->SetControlPointAt(1, Vector3d(1.0, 6.0, 0.0));
+    const double t_after = nurbs->ParameterAtLength(1.0);
+    EXPECT_NE(t_before, t_after);
+    EXPECT_NEAR(nurbs->Length(0.0, t_after), 1.0, 1e-6);
+
+    // 子エンティティ (CompositeCurveの構成曲線) の編集後も再構築されることを確認
+    auto segment = i_ent::MakeRationalBSplineCurve(
+        3, cps, {0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0}, {},
+        std::array<double, 2>{0.0, 1.0});
+    auto composite = i_ent::MakeCompositeCurve(
+            {segment, i_ent::MakeLine({4.0, 0.0, 0.0}, {5.0, 0.0, 0.0})});
+    const auto [c_start, c_end] = composite->GetParameterRange();
+    const double c_before = composite->ParameterAtLength(2.0);
+    EXPECT_NEAR(composite->Length(c_start, c_before), 2.0, 1e-6);
+    segment->SetControlPointAt(1, Vector3d(1.0, 6.0, 0.0));
+    const double c_after = composite->ParameterAtLength(2.0);
+    EXPECT_NE(c_before, c_after);
+    EXPECT_NEAR(composite->Length(c_start, c_after), 2.0, 1e-6);
+    const auto c_params = composite->ParametersAtEqualArcLength(5);
+    EXPECT_NEAR(composite->Length(c_start, c_params[2]),
+                composite->Length(c_start, c_end) / 2.0, 1e-6);
+    EXPECT_DOUBLE_EQ(c_params.back(), c_end);
+}
+
+// ICurve::PointsAtEqualArcLength() のテスト
+TEST(ICurveTest, PointsAtEqualArcLength) {
+    // 半径1.5の円: 等弧長の点は等間隔の弦を持つ
+    auto curves = igesio::tests::CreateCircularArcs();
+    const unsigned int n = 13;
+    auto points = curves[0].curve->PointsAtEqualArcLength(n);
+    ASSERT_EQ(points.size(), n);
+    EXPECT_TRUE(i_num::IsApproxEqual(points.front(), curves[0].curve->GetStartPoint()));
+    EXPECT_TRUE(i_num::IsApproxEqual(points.back(), curves[0].curve->GetEndPoint()));
+    const double chord = 2.0 * 1.5 * std::sin(igesio::kPi / (n - 1));
+    for (unsigned int i = 0; i + 1 < n; ++i) {
+        EXPECT_NEAR((points[i + 1] - points[i]).norm(), chord, 1e-6) << "i = " << i;
+    }
+
+    // CompositeCurve (角点を含む): 隣接パラメータ間の長さが等しいことを確認
+    curves = igesio::tests::CreateCompositeCurves();
+    auto params = curves[0].curve->ParametersAtEqualArcLength(9);
+    ASSERT_EQ(params.size(), 9u);
+    const double spacing = curves[0].curve->Length() / 8.0;
+    for (size_t i = 0; i + 1 < params.size(); ++i) {
+        EXPECT_NEAR(curves[0].curve->Length(params[i], params[i + 1]), spacing, 1e-6)
+                << "i = " << i;
+    }
+
+    EXPECT_THROW(curves[0].curve->ParametersAtEqualArcLength(1), std::invalid_argument);
+}
+
+/// @brief 点から曲線 (モデル空間) までの距離を計算する
+/// @note 密な標本点で最近点の近傍を求め、その前後の区間を黄金分割探索する
+double DistanceToCurve(const ICurve& curve, const Vector3d& point) {
+    constexpr int kSamples = 200;
+    auto [tmin, tmax] = curve.GetParameterRange();
+    auto distance = [&](const double t) {
+        return (curve.GetPointAt(std::clamp(t, tmin, tmax)) - point).norm();
+    };
+    int nearest = 0;
+    double nearest_distance = std::numeric_limits<double>::infinity();
+    for (int i = 0; i <= kSamples; ++i) {
+        const double d = distance(tmin + (tmax - tmin) * i / kSamples);
+        if (d < nearest_distance) {
+            nearest = i;
+            nearest_distance = d;
+        }
+    }
+    double a = tmin + (tmax - tmin) * std::max(nearest - 1, 0) / kSamples;
+    double b = tmin + (tmax - tmin) * std::min(nearest + 1, kSamples) / kSamples;
+    const double ratio = (std::sqrt(5.0) - 1.0) / 2.0;
+    for (int i = 0; i < 80; ++i) {
+        const double c = b - ratio * (b - a), d = a + ratio * (b - a);
+        if (distance(c) < distance(d)) {
+            b = d;
+        } else {
+            a = c;
+        }
+    }
+    return std::min(nearest_distance, distance((a + b) / 2.0));
+}
+
+/// @brief NURBS変換結果が元の曲線と同一形状であることを確認する
+void ExpectSameShape(const ICurve& curve, const i_ent::RationalBSplineCurve& nurbs,
+                     const std::string& name) {
+    auto [tmin, tmax] = curve.GetParameterRange();
+    auto [vmin, vmax] = nurbs.GetParameterRange();
+    EXPECT_NEAR(vmin, tmin, 1e-12) << name;
+    EXPECT_NEAR(vmax, tmax, 1e-12) << name;
+    EXPECT_TRUE(i_num::IsApproxEqual(nurbs.GetStartPoint(), curve.GetStartPoint(), 1e-9))
+            << name << ": start " << nurbs.GetStartPoint().transpose()
+            << " vs " << curve.GetStartPoint().transpose();
+    EXPECT_TRUE(i_num::IsApproxEqual(nurbs.GetEndPoint(), curve.GetEndPoint(), 1e-9))
+            << name << ": end " << nurbs.GetEndPoint().transpose()
+            << " vs " << curve.GetEndPoint().transpose();
+
+    // NURBS上の点がすべて元の曲線上にあることを確認
+    constexpr int kChecks = 40;
+    double max_distance = 0.0;
+    for (int i = 0; i <= kChecks; ++i) {
+        const double v = vmin + (vmax - vmin) * i / kChecks;
+        max_distance = std::max(max_distance,
+                                DistanceToCurve(curve, nurbs.GetPointAt(v)));
+    }
+    EXPECT_LT(max_distance, 1e-8) << name;
+}
+
+// ICurve::ToNurbs() のテスト
+TEST(ICurveTest, ToNurbs) {
+    for (const auto& test_curve : igesio::tests::CreateAllTestCurves()) {
+        const auto& curve = test_curve.curve;
+        const auto nurbs = curve->ToNurbs();
+
+        // 有限のNURBSで表せない曲線 (点列・半直線・直線・複合曲線・面上曲線)
+        const auto line = std::dynamic_pointer_cast<i_ent::Line>(curve);
+        const bool expect_convertible =
+                (line == nullptr || line->GetLineType() == i_ent::LineType::kSegment)
+                && !std::dynamic_pointer_cast<i_ent::CopiousData>(curve)
+                && !std::dynamic_pointer_cast<i_ent::CompositeCurve>(curve)
+                && !std::dynamic_pointer_cast<i_ent::CurveOnAParametricSurface>(curve);
+        if (!expect_convertible) {
+            EXPECT_EQ(nurbs, nullptr) << test_curve.name;
+            continue;
+        }
+        ASSERT_NE(nurbs, nullptr) << test_curve.name;
+        ExpectSameShape(*curve, *nurbs, test_curve.name);
+
+        // 多項式で表される曲線はパラメータ化も一致する
+        if (std::dynamic_pointer_cast<i_ent::ParametricSplineCurve>(curve)
+            || std::dynamic_pointer_cast<i_ent::LinearPath>(curve)
+            || std::dynamic_pointer_cast<i_ent::RationalBSplineCurve>(curve) || line) {
+            auto [tmin, tmax] = curve->GetParameterRange();
+            for (int i = 0; i <= 10; ++i) {
+                const double t = tmin + (tmax - tmin) * i / 10.0;
+                EXPECT_TRUE(i_num::IsApproxEqual(
+                        nurbs->GetPointAt(t), curve->GetPointAt(t), 1e-9))
+                        << test_curve.name << ": t = " << t;
+            }
+        }
+    }
+}
+
+// ICurve::ToNurbs() のテスト (円錐曲線)
+TEST(ICurveTest, ToNurbsConicArcs) {
+    std::vector<std::pair<std::string, std::shared_ptr<i_ent::ConicArc>>> conics = {
+        {"parabola (axis X)", i_ent::MakeParabolicArc(0.5, -2.0, 3.0)},
+        {"parabola (axis Y)", i_ent::MakeParabolicArc(-1.5, 1.0, -2.0,
+                                                      i_ent::ConicAxis::kY, 0.5)},
+        {"hyperbola (axis X)", i_ent::MakeHyperbolicArc(2.0, 1.0, -1.2, 1.0)},
+        {"hyperbola (axis Y)", i_ent::MakeHyperbolicArc(1.0, 3.0, -0.5, 1.3,
+                                                        i_ent::ConicAxis::kY, -1.0)},
+        {"ellipse arc", i_ent::MakeEllipticArc(3.0, 1.0, 0.3, 4.0, 2.0)},
+    };
+    const std::vector<i_ent::RationalBSplineCurveType> types = {
+        i_ent::RationalBSplineCurveType::kParabolicArc,
+        i_ent::RationalBSplineCurveType::kParabolicArc,
+        i_ent::RationalBSplineCurveType::kHyperbolicArc,
+        i_ent::RationalBSplineCurveType::kHyperbolicArc,
+        i_ent::RationalBSplineCurveType::kEllipticArc,
+    };
+    for (size_t i = 0; i < conics.size(); ++i) {
+        const auto& [name, conic] = conics[i];
+        const auto nurbs = conic->ToNurbs();
+        ASSERT_NE(nurbs, nullptr) << name;
+        EXPECT_EQ(nurbs->Degree(), 2) << name;
+        EXPECT_EQ(nurbs->GetCurveType(), types[i]) << name;
+        ExpectSameShape(*conic, *nurbs, name);
+    }
+}
+
+// ICurve::ToNurbs() のキャッシュのテスト
+TEST(ICurveTest, ToNurbsCache) {
+    auto arc = i_ent::MakeCircularArc(igesio::Vector2d(1.0, 2.0), 2.0, 0.0, 3.0, 0.5);
+    const auto first = arc->ToNurbs();
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(arc->ToNurbs(), first);
+
+    // 変換行列を設定すると再構築され、変換結果も同じ変換行列を参照する
+    igesio::Matrix3d rotation = igesio::Matrix3d::Zero();
+    rotation(0, 1) = -1.0;
+    rotation(1, 0) = 1.0;
+    rotation(2, 2) = 1.0;
+    auto transform = i_ent::MakeTransformationMatrix(rotation, Vector3d(0.0, 0.0, 4.0));
+    ASSERT_TRUE(arc->OverwriteTransformationMatrix(transform));
+    const auto second = arc->ToNurbs();
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(second, first);
+    EXPECT_EQ(second->GetTransformationMatrix().GetPointer(), transform);
+    ExpectSameShape(*arc, *second, "transformed arc");
+
+    // 変換行列の差し替えも検知する
+    ASSERT_TRUE(arc->OverwriteTransformationMatrix(
+            i_ent::MakeTransformationMatrix(rotation, Vector3d(1.0, 0.0, 0.0))));
+    const auto third = arc->ToNurbs();
+    EXPECT_NE(third, second);
+    EXPECT_EQ(arc->ToNurbs(), third);
+    ExpectSameShape(*arc, *third, "moved arc");
+
+    // 形状の変更 (NURBS曲線自身の編集)
+    auto spline = std::dynamic_pointer_cast<i_ent::RationalBSplineCurve>(
+            igesio::tests::CreateRationalBSplineCurve().back().curve);
+    ASSERT_NE(spline, nullptr);
+    const auto before = spline->ToNurbs();
+    auto [vmin, vmax] = spline->GetParameterRange();
+    spline->SetParameterRange({vmin, (vmin + vmax) / 2.0});
+    const auto after = spline->ToNurbs();
+    ASSERT_NE(after, nullptr);
+    EXPECT_NE(after, before);
+    EXPECT_NEAR(after->GetParameterRange()[1], (vmin + vmax) / 2.0, 1e-12);
+}
+
 // ICurve::GetBoundingBox() のテスト
 TEST(ICurveTest, GetBoundingBox) {
     auto curves = igesio::tests::CreateAllTestCurves();
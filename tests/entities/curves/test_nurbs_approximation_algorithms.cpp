@@ -1,6 +1,6 @@
 /**
  * @file entities/curves/test_nurbs_approximation_algorithms.cpp
- * @brief ApproximateWithNurbs のテスト
+ * @brief ApproximateWithNurbs / ApproximateSurfaceWithNurbs のテスト
  * @author Yayoi Habami
  * @date 2026-04-11
  * @copyright 2026 Yayoi Habami
@@ -19,6 +19,7 @@
 #include "igesio/entities/curves/circular_arc.h"
 #include "igesio/entities/curves/line.h"
 #include "igesio/entities/curves/rational_b_spline_curve.h"
+#include "igesio/entities/surfaces/surface_of_revolution.h"
 
 namespace {
 
@@ -587,3 +588,128 @@ TEST(ApproximateWithNurbsFromCurveTest, Options_MaxControlPointsBinding) {
     EXPECT_LE(n_ctrl, static_cast<int>(opts.max_control_points))
         << "制御点数 " << n_ctrl << " が上限 " << opts.max_control_points << " を超えている";
 }
+
+
+
+// =========================================================================
+// ApproximateSurfaceWithNurbs
+// =========================================================================
+
+namespace {
+
+/// @brief 高さ関数 z = f(x, y) の点グリッドを作成する
+/// @param nx, ny 各方向の分割数
+std::vector<std::vector<Vector3d>> MakeHeightGrid(
+        unsigned int nx, unsigned int ny) {
+    std::vector<std::vector<Vector3d>> grid(nx + 1, std::vector<Vector3d>(ny + 1));
+    for (unsigned int i = 0; i <= nx; ++i) {
+        for (unsigned int j = 0; j <= ny; ++j) {
+            const double x = 3.0 * i / nx, y = 2.0 * j / ny;
+            grid[i][j] = Vector3d{x, y, std::sin(x) * std::cos(y)};
+        }
+    }
+    return grid;
+}
+
+}  // namespace
+
+/// @brief 矩形でないグリッド・点数不足は例外
+TEST(ApproximateSurfaceWithNurbsTest, InvalidInput) {
+    auto grid = MakeHeightGrid(10, 10);
+    grid[3].pop_back();
+    EXPECT_THROW(i_ent::ApproximateSurfaceWithNurbs(grid),
+                 std::invalid_argument);
+    EXPECT_THROW(i_ent::ApproximateSurfaceWithNurbs(MakeHeightGrid(10, 2)),
+                 std::invalid_argument);
+    EXPECT_THROW(i_ent::ApproximateSurfaceWithNurbs(
+                     std::vector<std::vector<Vector3d>>{}),
+                 std::invalid_argument);
+}
+
+/// @brief 出力の基本仕様: 次数、パラメータ範囲、4隅の補間
+TEST(ApproximateSurfaceWithNurbsTest, Output_BasicSpec) {
+    const auto grid = MakeHeightGrid(30, 20);
+    i_ent::NurbsSurfaceApproxOptions opts;
+    opts.v_degree = 2;
+    const auto result = i_ent::ApproximateSurfaceWithNurbs(grid, opts);
+    ASSERT_NE(result, nullptr);
+
+    EXPECT_EQ(result->Degrees(), std::make_pair(3u, 2u));
+    const auto range = result->GetParameterRange();
+    EXPECT_DOUBLE_EQ(range[0], 0.0);
+    EXPECT_DOUBLE_EQ(range[1], 1.0);
+    EXPECT_DOUBLE_EQ(range[2], 0.0);
+    EXPECT_DOUBLE_EQ(range[3], 1.0);
+
+    const std::array<std::array<double, 2>, 4> corners = {{
+        {0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}}};
+    for (const auto& c : corners) {
+        const auto p = result->TryGetPointAt(c[0], c[1]);
+        ASSERT_TRUE(p.has_value());
+        const auto& q = grid[c[0] == 0.0 ? 0 : 30][c[1] == 0.0 ? 0 : 20];
+        EXPECT_LT((*p - q).norm(), 1e-10);
+    }
+}
+
+/// @brief 高さ関数グリッドを許容誤差内で近似する
+TEST(ApproximateSurfaceWithNurbsTest, Accuracy_HeightField) {
+    i_ent::NurbsSurfaceApproxOptions opts;
+    opts.tolerance = 1e-5;
+    const auto result = i_ent::ApproximateSurfaceWithNurbs(
+        MakeHeightGrid(60, 40), opts);
+    ASSERT_NE(result, nullptr);
+
+    // 近似曲面上の点の z と、その (x, y) における真値との差を確認する
+    // (グリッドの外側にあたる近似曲面の端部もxy範囲内に収まる)
+    double max_err = 0.0;
+    for (int i = 0; i <= 50; ++i) {
+        for (int j = 0; j <= 50; ++j) {
+            const auto p = result->TryGetPointAt(i / 50.0, j / 50.0);
+            ASSERT_TRUE(p.has_value());
+            max_err = std::max(max_err, std::abs(
+                (*p)[2] - std::sin((*p)[0]) * std::cos((*p)[1])));
+        }
+    }
+    EXPECT_LT(max_err, 2 * opts.tolerance);
+}
+
+/// @brief 制御点数の上限が方向ごとに守られる
+TEST(ApproximateSurfaceWithNurbsTest, Options_MaxControlPointsBinding) {
+    i_ent::NurbsSurfaceApproxOptions opts;
+    opts.tolerance            = 1e-12;
+    opts.max_u_control_points = 6;
+    opts.max_v_control_points = 5;
+    const auto result = i_ent::ApproximateSurfaceWithNurbs(
+        MakeHeightGrid(40, 40), opts);
+    ASSERT_NE(result, nullptr);
+    const auto [n_u, n_v] = result->NumControlPoints();
+    EXPECT_LE(n_u, opts.max_u_control_points);
+    EXPECT_LE(n_v, opts.max_v_control_points);
+}
+
+/// @brief ISurface版: 回転曲面（円筒の一部）を許容誤差内で近似する
+TEST(ApproximateSurfaceWithNurbsTest, Accuracy_SurfaceOfRevolution) {
+    const auto axis = std::make_shared<i_ent::Line>(
+        Vector3d{0.0, 0.0, 0.0}, Vector3d{0.0, 0.0, 1.0});
+    const auto generatrix = std::make_shared<i_ent::Line>(
+        Vector3d{1.0, 0.0, 0.0}, Vector3d{1.0, 0.0, 2.0});
+    const auto cylinder = i_ent::MakeSurfaceOfRevolution(
+        axis, generatrix, 0.0, kPi);
+
+    i_ent::NurbsSurfaceApproxOptions opts;
+    opts.tolerance = 1e-4;
+    const auto result = i_ent::ApproximateSurfaceWithNurbs(
+        *cylinder, std::nullopt, opts);
+    ASSERT_NE(result, nullptr);
+
+    double max_err = 0.0;
+    for (int i = 0; i <= 40; ++i) {
+        for (int j = 0; j <= 40; ++j) {
+            const auto p = result->TryGetPointAt(i / 40.0, j / 40.0);
+            ASSERT_TRUE(p.has_value());
+            max_err = std::max(max_err,
+                               std::abs(std::hypot((*p)[0], (*p)[1]) - 1.0));
+        }
+    }
+    EXPECT_LT(max_err, 2 * opts.tolerance);
+}
@@ -8,6 +8,7 @@
  *       - `MeshEntity` のコンストラクタ (検証付き)
  *       - `Mesh` / `SetMesh` (リビジョンバンプ・不正メッシュの拒否)
  *       - `GetDefinedBoundingBox`
+ *       - `GetBvh` (遅延構築・キャッシュ・SetMeshでの再構築)
  *       - 識別子 (GetType / IsSupported)
  * @note Assemblyへの保存・WriteIgesスキップは非IGESエンティティ一般として
  *       tests/models/test_non_iges_entity.cppで検証済みのため対象外.
@@ -88,6 +89,20 @@ TEST(MeshEntityTest, SetMeshBumpsGeometryRevision) {
     EXPECT_TRUE(bb.Contains({1.5, 1.5, 0.0}));
 }
 
+// GetBvhは初回に構築して同じBVHを返し、SetMesh後は新しいメッシュから再構築する
+TEST(MeshEntityTest, GetBvhIsCachedUntilSetMesh) {
+    i_ent::MeshEntity entity(MakeUnitQuad());
+
+    const auto& bvh = entity.GetBvh();
+    EXPECT_EQ(bvh.PrimitiveCount(), 2u);
+    EXPECT_EQ(&entity.GetBvh(), &bvh);
+
+    auto single = MakeUnitQuad();
+    single.indices = {0, 1, 2};
+    entity.SetMesh(std::move(single));
+    EXPECT_EQ(entity.GetBvh().PrimitiveCount(), 1u);
+}
+
 
 
 /**
@@ -16,6 +16,10 @@
 #include <utility>
 #include <vector>
 
+#include "igesio/entities/curves/circular_arc.h"
+#include "igesio/entities/curves/curve_on_a_parametric_surface.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/curves/linear_path.h"
 #include "igesio/entities/curves/rational_b_spline_curve.h"
 
 #include "igesio/entities/surfaces/plane.h"
@@ -244,6 +248,69 @@ inline surface_vec CreateAllTestSurfaces() {
     return all_surfaces;
 }
 
+
+
+/**
+ * 個別のテスト (交差・最短距離・レイキャスト等) で共有する曲面
+ */
+
+/// @brief y=5 の平面 (RationalBSplineSurface, u/v ∈ [0,1], x/z ∈ [-5,5])
+inline std::shared_ptr<entities::RationalBSplineSurface> MakeYFivePlane() {
+    return entities::MakeRationalBSplineSurface(
+        {1, 1},                                              // 次数 {M1, M2}
+        {{Vector3d(-5., 5.,  5.), Vector3d( 5., 5.,  5.)},   // P(0,j)
+         {Vector3d(-5., 5., -5.), Vector3d( 5., 5., -5.)}},  // P(1,j)
+        {0., 0., 1., 1.},                                    // Uノット
+        {0., 0., 1., 1.});                                   // Vノット
+}
+
+/// @brief z軸を回転軸とする半径2・高さ4の円柱面 (SurfaceOfRevolution)
+/// @note S(u,v) = (2*cos(v), 2*sin(v), 4*u), u∈[0,1], v∈[0,2π]
+inline std::shared_ptr<entities::SurfaceOfRevolution> MakeCylinder() {
+    auto axis = entities::MakeLine(Vector3d{0., 0., 0.}, Vector3d{0., 0., 1.});
+    auto generatrix = entities::MakeLine(Vector3d{2., 0., 0.}, Vector3d{2., 0., 4.});
+    return entities::MakeSurfaceOfRevolution(axis, generatrix, 0.0, 2.0 * kPi);
+}
+
+/// @brief y=5 の平面を、UV矩形 [0.2,0.8]^2 の外側境界と [0.4,0.6]^2 の穴でトリムした曲面
+/// @note 空間上では |x|,|z| <= 3 の正方形から |x|,|z| < 1 の正方形を除いた領域
+inline std::shared_ptr<entities::TrimmedSurface> MakeTrimmedPlaneWithHole() {
+    const auto uv_rect = [](const double lo, const double hi) {
+        return entities::MakeLinearPath(std::vector<Vector2d>{
+                {lo, lo}, {hi, lo}, {hi, hi}, {lo, hi}}, true);
+    };
+    const auto plane = MakeYFivePlane();
+    auto [outer, o_] = entities::MakeCurveOnAParametricSurface(plane, uv_rect(0.2, 0.8));
+    auto [hole, h_] = entities::MakeCurveOnAParametricSurface(plane, uv_rect(0.4, 0.6));
+    auto ts = std::make_shared<entities::TrimmedSurface>(plane, outer);
+    ts->AddInnerBoundary(hole);
+    return ts;
+}
+
+/// @brief 円形の穴のあるトリム面と、その基底平面
+struct TrimmedPlane {
+    /// @brief 基底平面
+    std::shared_ptr<entities::RationalBSplineSurface> plane;
+    /// @brief トリム面
+    std::shared_ptr<entities::TrimmedSurface> trimmed;
+};
+
+/// @brief 平面 z=0 (|x|,|y| <= 2) を、中心の円でくり抜いたトリム面を作成する
+/// @note 基底平面 (物理従属子) の変更を検知するテストのため、基底平面も返す
+inline TrimmedPlane MakeTrimmedPlane() {
+    TrimmedPlane result;
+    result.plane = entities::MakeRationalBSplineSurface(
+        {1, 1},
+        {{Vector3d(-2., -2., 0.), Vector3d(2., -2., 0.)},
+         {Vector3d(-2., 2., 0.), Vector3d(2., 2., 0.)}},
+        {0., 0., 1., 1.}, {0., 0., 1., 1.});
+    auto [hole, h_] = entities::MakeCurveOnAParametricSurface(
+            result.plane, entities::MakeCircle(Vector2d{0.5, 0.5}, 0.25));
+    result.trimmed = std::make_shared<entities::TrimmedSurface>(result.plane, nullptr);
+    result.trimmed->AddInnerBoundary(hole);
+    return result;
+}
+
 }  // namespace igesio::tests
 
 #endif  // IGESIO_TESTS_ENTITIES_SURFACES_SURFACES_FOR_TESTING_H_
@@ -0,0 +1,229 @@
+/**
+ * @file entities/surfaces/test_curve_surface_intersection.cpp
+ * @brief curve_surface_intersection.h のテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * ### 対象関数
+ * - igesio::entities::IntersectCurveWithSurface
+ *   - 平面・円柱面・波打つB-Spline曲面と線分・円の交差、接する交点
+ *   - TrimmedSurface のドメイン外 (穴・外側境界の外) の交点の除外
+ * - igesio::entities::IntersectCurveSurfacePairs
+ *   - 各組の結果がIntersectCurveWithSurfaceと一致すること・引数の検証
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/curves/circular_arc.h"
+#include "igesio/entities/surfaces/rational_b_spline_surface.h"
+#include "igesio/entities/surfaces/algorithms/curve_surface_intersection.h"
+#include "./surfaces_for_testing.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_test = igesio::tests;
+using i_ent::CurveSurfaceIntersection;
+using i_ent::CurveSurfaceIntersectionParams;
+using i_ent::IntersectCurveWithSurface;
+using igesio::Vector2d;
+using igesio::Vector3d;
+
+/// @brief 位置比較の許容誤差
+constexpr double kPosTol = 1e-6;
+
+/// @brief 交点位置が期待値と一致するか検証するヘルパー
+void ExpectPositionNear(const Vector3d& actual, const Vector3d& expected,
+                        const double tol = kPosTol) {
+    EXPECT_NEAR(actual.x(), expected.x(), tol);
+    EXPECT_NEAR(actual.y(), expected.y(), tol);
+    EXPECT_NEAR(actual.z(), expected.z(), tol);
+}
+
+/// @brief 交点が曲線上かつ曲面上の点であることを検証するヘルパー
+void ExpectOnCurveAndSurface(const CurveSurfaceIntersection& hit,
+                             const i_ent::ICurve& curve,
+                             const i_ent::ISurface& surface) {
+    ExpectPositionNear(curve.GetPointAt(hit.t), hit.position);
+    ExpectPositionNear(surface.GetPointAt(hit.u, hit.v), hit.position);
+    EXPECT_LE(hit.gap, CurveSurfaceIntersectionParams{}.tolerance);
+}
+
+/// @brief x方向に波打つ双3次×1次のB-Spline曲面 (x ∈ [0,11], y ∈ [0,1])
+/// @note 制御点のz座標が±1を交互に取るため、z=0の線分と多数回交差する
+std::shared_ptr<i_ent::RationalBSplineSurface> MakeWavySurface() {
+    std::vector<std::vector<Vector3d>> points;
+    for (int i = 0; i < 12; ++i) {
+        const double z = (i % 2 == 0) ? 1.0 : -1.0;
+        points.push_back({Vector3d(i, 0., z), Vector3d(i, 1., z)});
+    }
+    std::vector<double> u_knots = {0., 0., 0., 0.};
+    for (int k = 1; k <= 8; ++k) u_knots.push_back(k / 9.0);
+    u_knots.insert(u_knots.end(), {1., 1., 1., 1.});
+    return i_ent::MakeRationalBSplineSurface(
+        {3, 1}, points, u_knots, {0., 0., 1., 1.});
+}
+
+}  // namespace
+
+
+
+/**
+ * IntersectCurveWithSurface
+ */
+
+// 平面を貫く線分: 交点1つ
+TEST(IntersectCurveWithSurfaceTest, SegmentThroughPlane) {
+    const auto plane = i_test::MakeYFivePlane();
+    const auto seg = i_ent::MakeLine(Vector3d{1., 0., 2.}, Vector3d{1., 10., 2.});
+    const auto hits = IntersectCurveWithSurface(*seg, *plane);
+
+    ASSERT_EQ(hits.size(), 1u);
+    ExpectPositionNear(hits[0].position, Vector3d{1., 5., 2.});
+    EXPECT_NEAR(hits[0].t, 0.5, 1e-9);
+    ExpectOnCurveAndSurface(hits[0], *seg, *plane);
+
+    // 平面に届かない線分
+    const auto short_seg = i_ent::MakeLine(Vector3d{1., 0., 2.}, Vector3d{1., 4., 2.});
+    EXPECT_TRUE(IntersectCurveWithSurface(*short_seg, *plane).empty());
+}
+
+// 平面を2回横切る円: t昇順で2交点を返す
+TEST(IntersectCurveWithSurfaceTest, CircleAcrossPlane) {
+    const auto plane = i_test::MakeYFivePlane();
+    // 中心 (0,4,0)・半径2・z=0平面上の円は y=5 と (±√3, 5, 0) で交わる
+    const auto circle = i_ent::MakeCircle(Vector2d{0., 4.}, 2.0, 0.0);
+    const auto hits = IntersectCurveWithSurface(*circle, *plane);
+
+    ASSERT_EQ(hits.size(), 2u);
+    EXPECT_LT(hits[0].t, hits[1].t);
+    ExpectPositionNear(hits[0].position, Vector3d{std::sqrt(3.0), 5., 0.});
+    ExpectPositionNear(hits[1].position, Vector3d{-std::sqrt(3.0), 5., 0.});
+    for (const auto& hit : hits) ExpectOnCurveAndSurface(hit, *circle, *plane);
+}
+
+// 平面に接する円: 接点を1つ返す
+TEST(IntersectCurveWithSurfaceTest, CircleTangentToPlane) {
+    const auto plane = i_test::MakeYFivePlane();
+    const auto circle = i_ent::MakeCircle(Vector2d{0., 3.}, 2.0, 0.0);
+    const auto hits = IntersectCurveWithSurface(*circle, *plane);
+
+    ASSERT_EQ(hits.size(), 1u);
+    // 接点は解が浅いため、位置の精度はtoleranceの平方根程度となる
+    ExpectPositionNear(hits[0].position, Vector3d{0., 5., 0.}, 1e-2);
+    EXPECT_LE(hits[0].gap, CurveSurfaceIntersectionParams{}.tolerance);
+}
+
+// 円柱面を貫く線分: 両側の2交点
+TEST(IntersectCurveWithSurfaceTest, SegmentThroughCylinder) {
+    const auto cylinder = i_test::MakeCylinder();
+    const auto seg = i_ent::MakeLine(Vector3d{-5., 0., 2.}, Vector3d{5., 0., 2.});
+    const auto hits = IntersectCurveWithSurface(*seg, *cylinder);
+
+    ASSERT_EQ(hits.size(), 2u);
+    ExpectPositionNear(hits[0].position, Vector3d{-2., 0., 2.});
+    ExpectPositionNear(hits[1].position, Vector3d{2., 0., 2.});
+    for (const auto& hit : hits) ExpectOnCurveAndSurface(hit, *seg, *cylinder);
+}
+
+// 波打つ曲面と多数回交差する線分: 全ての交点が z=0 上にある
+TEST(IntersectCurveWithSurfaceTest, SegmentThroughWavySurface) {
+    const auto wavy = MakeWavySurface();
+    const auto seg = i_ent::MakeLine(Vector3d{0., 0.5, 0.}, Vector3d{11., 0.5, 0.});
+    const auto hits = IntersectCurveWithSurface(*seg, *wavy);
+
+    // 制御点のz座標が11回符号を変えるため、曲面は z=0 を複数回横切る
+    ASSERT_GE(hits.size(), 5u);
+    for (size_t i = 0; i < hits.size(); ++i) {
+        EXPECT_NEAR(hits[i].position.z(), 0.0, kPosTol);
+        ExpectOnCurveAndSurface(hits[i], *seg, *wavy);
+        if (i > 0) {
+            EXPECT_LT(hits[i - 1].t, hits[i].t);
+        }
+    }
+}
+
+// トリム面: ドメイン内の交点のみを返す (穴・外側境界の外の交点は除外する)
+TEST(IntersectCurveWithSurfaceTest, TrimmedSurfaceExcludesOutsideDomain) {
+    const auto ts = i_test::MakeTrimmedPlaneWithHole();
+
+    const auto in_domain = i_ent::MakeLine(Vector3d{0., 0., 2.}, Vector3d{0., 10., 2.});
+    const auto hits = IntersectCurveWithSurface(*in_domain, *ts);
+    ASSERT_EQ(hits.size(), 1u);
+    ExpectPositionNear(hits[0].position, Vector3d{0., 5., 2.});
+    EXPECT_TRUE(ts->IsInDomain(hits[0].u, hits[0].v));
+
+    const auto through_hole = i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{0., 10., 0.});
+    EXPECT_TRUE(IntersectCurveWithSurface(*through_hole, *ts).empty());
+
+    const auto outside = i_ent::MakeLine(Vector3d{0., 0., 4.5}, Vector3d{0., 10., 4.5});
+    EXPECT_TRUE(IntersectCurveWithSurface(*outside, *ts).empty());
+}
+
+// 不正な引数は例外
+TEST(IntersectCurveWithSurfaceTest, ThrowsForInvalidArguments) {
+    const auto plane = i_test::MakeYFivePlane();
+    const auto seg = i_ent::MakeLine(Vector3d{1., 0., 2.}, Vector3d{1., 10., 2.});
+    CurveSurfaceIntersectionParams params;
+    params.u_samples = 0;
+    EXPECT_THROW(IntersectCurveWithSurface(*seg, *plane, params),
+                 std::invalid_argument);
+
+    const auto line = i_ent::MakeUnboundedLine(Vector3d::Zero(), Vector3d::UnitY());
+    EXPECT_THROW(IntersectCurveWithSurface(*line, *plane), std::invalid_argument);
+}
+
+
+
+/**
+ * IntersectCurveSurfacePairs
+ */
+
+// 各組の結果がIntersectCurveWithSurfaceと一致する (曲線・曲面を複数の組で共有する)
+TEST(IntersectCurveSurfacePairsTest, MatchesSingleQueries) {
+    std::vector<std::shared_ptr<const i_ent::ICurve>> curves = {
+            i_ent::MakeLine(Vector3d{1., 0., 2.}, Vector3d{1., 10., 2.}),
+            i_ent::MakeLine(Vector3d{-5., 0., 2.}, Vector3d{5., 0., 2.}),
+            i_ent::MakeCircle(Vector2d{0., 4.}, 2.0, 0.0)};
+    std::vector<std::shared_ptr<const i_ent::ISurface>> surfaces = {
+            i_test::MakeYFivePlane(), i_test::MakeCylinder(), i_test::MakeTrimmedPlaneWithHole()};
+    std::vector<i_ent::CurveSurfacePair> pairs;
+    for (const auto& curve : curves) {
+        for (const auto& surface : surfaces) pairs.push_back({curve, surface});
+    }
+
+    const auto results = i_ent::IntersectCurveSurfacePairs(pairs);
+    ASSERT_EQ(results.size(), pairs.size());
+    size_t total = 0;
+    for (size_t k = 0; k < pairs.size(); ++k) {
+        const auto expected = IntersectCurveWithSurface(
+                *pairs[k].curve, *pairs[k].surface);
+        ASSERT_EQ(results[k].size(), expected.size()) << "pair " << k;
+        for (size_t h = 0; h < expected.size(); ++h) {
+            ExpectPositionNear(results[k][h].position, expected[h].position);
+            EXPECT_DOUBLE_EQ(results[k][h].t, expected[h].t);
+        }
+        total += expected.size();
+    }
+    EXPECT_GT(total, 0u);  // 判定が自明 (全て交差なし) でないこと
+}
+
+// nullptrを含む組・不正なパラメータは例外
+TEST(IntersectCurveSurfacePairsTest, ThrowsForInvalidArguments) {
+    const auto seg = i_ent::MakeLine(Vector3d{1., 0., 2.}, Vector3d{1., 10., 2.});
+    std::vector<i_ent::CurveSurfacePair> pairs = {{seg, nullptr}};
+    EXPECT_THROW(i_ent::IntersectCurveSurfacePairs(pairs), std::invalid_argument);
+
+    CurveSurfaceIntersectionParams params;
+    params.v_samples = 0;
+    EXPECT_THROW(i_ent::IntersectCurveSurfacePairs({}, params),
+                 std::invalid_argument);
+    EXPECT_TRUE(i_ent::IntersectCurveSurfacePairs({}).empty());
+}
@@ -7,7 +7,9 @@
  *
  * ### 対象関数
  * - igesio::entities::InvertPointOntoSurface
+ * - igesio::entities::ProjectPointOntoSurface
  * - igesio::entities::InvertCurveOntoSurface
+ * - igesio::entities::SurfacePointLocator / ISurface::GetPointLocator
  *
  * TODO: seam/pole による弧分割 (split_at_discontinuities=true) の検証.
  *       seam を跨ぐ「曲面上の曲線」フィクスチャの構築が複雑なため、
@@ -17,7 +19,9 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <limits>
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "igesio/numerics/core/matrix.h"
@@ -25,46 +29,29 @@
 #include "igesio/entities/curves/line.h"
 #include "igesio/entities/surfaces/rational_b_spline_surface.h"
 #include "igesio/entities/surfaces/surface_of_revolution.h"
+#include "igesio/entities/transformations/transformation_matrix.h"
 #include "igesio/entities/surfaces/algorithms/curve_surface_inversion.h"
+#include "./surfaces_for_testing.h"
 
 namespace {
 
 namespace i_ent = igesio::entities;
+namespace i_test = igesio::tests;
 using i_ent::InvertPointOntoSurface;
+using i_ent::ProjectPointOntoSurface;
 using i_ent::InvertCurveOntoSurface;
 using igesio::Vector3d;
 
 /// @brief 位置一致の許容誤差 (受理許容より十分小さい)
 constexpr double kUVTol = 1e-5;
 
-/// @brief y=5 の平面 (RationalBSplineSurface, u/v ∈ [0,1], x/z ∈ [-5,5])
-/// @note 変換なし (定義空間 = ワールド空間). 矩形パッチのため (u,v)→(x,z) は線形
-std::shared_ptr<i_ent::RationalBSplineSurface> MakeYFivePlane() {
-    return i_ent::MakeRationalBSplineSurface(
-        {1, 1},                                              // 次数 {M1, M2}
-        {{Vector3d(-5., 5.,  5.), Vector3d( 5., 5.,  5.)},   // P(0,j)
-         {Vector3d(-5., 5., -5.), Vector3d( 5., 5., -5.)}},  // P(1,j)
-        {0., 0., 1., 1.},                                    // Uノット
-        {0., 0., 1., 1.});                                   // Vノット
-}
-
-/// @brief z軸を回転軸とする半径2・高さ4の円柱面 (SurfaceOfRevolution)
-/// @note S(u,v) = (2*cos(v), 2*sin(v), 4*u), u∈[0,1], v∈[0,2π]
-std::shared_ptr<i_ent::SurfaceOfRevolution> MakeCylinder() {
-    auto axis = i_ent::MakeLine(
-        Vector3d{0., 0., 0.}, Vector3d{0., 0., 1.});
-    auto generatrix = i_ent::MakeLine(
-        Vector3d{2., 0., 0.}, Vector3d{2., 0., 4.});
-    return i_ent::MakeSurfaceOfRevolution(axis, generatrix, 0.0, 2.0 * igesio::kPi);
-}
-
 }  // namespace
 
 
 
 /// @brief 平面上の既知点を逆射影し、元の (u,v) を復元できる (代表値)
 TEST(CurveSurfaceInversion, InvertPoint_RecoversKnownUV_OnPlane) {
-    auto surface = MakeYFivePlane();
+    auto surface = i_test::MakeYFivePlane();
     const std::array<std::array<double, 2>, 3> uvs = {{
         {0.2, 0.3}, {0.5, 0.5}, {0.85, 0.1}}};
     for (const auto& q : uvs) {
@@ -78,7 +65,7 @@ TEST(CurveSurfaceInversion, InvertPoint_RecoversKnownUV_OnPlane) {
 
 /// @brief 平面上の境界値 (u,v) = (0,1) を逆射影で復元できる
 TEST(CurveSurfaceInversion, InvertPoint_RecoversBoundaryUV_OnPlane) {
-    auto surface = MakeYFivePlane();
+    auto surface = i_test::MakeYFivePlane();
     const Vector3d p = surface->GetPointAt(0.0, 1.0);
     const auto sol = InvertPointOntoSurface(*surface, p, {0.5, 0.5});
     ASSERT_TRUE(sol.has_value());
@@ -88,7 +75,7 @@ TEST(CurveSurfaceInversion, InvertPoint_RecoversBoundaryUV_OnPlane) {
 
 /// @brief 曲面 (円柱) 上の既知点を逆射影し、元の (u,v) を復元できる
 TEST(CurveSurfaceInversion, InvertPoint_RecoversKnownUV_OnCylinder) {
-    auto surface = MakeCylinder();
+    auto surface = i_test::MakeCylinder();
     const Vector3d p = surface->GetPointAt(0.5, 1.0);
     // 真値近傍を初期値に与える (周期方向の別解を避ける)
     const auto sol = InvertPointOntoSurface(*surface, p, {0.4, 0.9});
@@ -99,7 +86,7 @@ TEST(CurveSurfaceInversion, InvertPoint_RecoversKnownUV_OnCylinder) {
 
 /// @brief 曲面から大きく離れた点は逆射影に失敗する (nullopt)
 TEST(CurveSurfaceInversion, InvertPoint_FailsWhenPointFarFromSurface) {
-    auto surface = MakeYFivePlane();
+    auto surface = i_test::MakeYFivePlane();
     // y=5 平面から大きく離れた点 (残差が受理許容を超える)
     const auto sol = InvertPointOntoSurface(
         *surface, Vector3d(0.0, 100.0, 0.0), {0.5, 0.5});
@@ -108,7 +95,7 @@ TEST(CurveSurfaceInversion, InvertPoint_FailsWhenPointFarFromSurface) {
 
 /// @brief 平面上のモデル空間直線を逆射影し、端点の (u,v) を復元できる
 TEST(CurveSurfaceInversion, InvertCurve_RecoversEndpointUV_OnPlane) {
-    auto surface = MakeYFivePlane();
+    auto surface = i_test::MakeYFivePlane();
     const Vector3d p0 = surface->GetPointAt(0.2, 0.3);
     const Vector3d p1 = surface->GetPointAt(0.7, 0.6);
     const auto curve = i_ent::MakeLine(p0, p1);
@@ -125,3 +112,88 @@ TEST(CurveSurfaceInversion, InvertCurve_RecoversEndpointUV_OnPlane) {
     // パラメータ空間サンプルは z=0 平面上にある
     for (const auto& q : uv) EXPECT_NEAR(q.z(), 0.0, 1e-12);
 }
+
+
+
+
+/**
+ * 格子サンプルの索引と初期値探索
+ */
+
+/// @brief 索引の最近傍探索が、同じ格子の総当たり探索と一致する
+TEST(CurveSurfaceInversion, PointLocator_MatchesBruteForceGrid) {
+    auto surface = i_test::MakeCylinder();
+    constexpr int kU = 12, kV = 30;
+    const i_ent::SurfacePointLocator locator(*surface, kU, kV);
+    ASSERT_EQ(locator.SampleCount(), static_cast<size_t>(kU * kV));
+
+    std::mt19937 engine(1);
+    std::uniform_real_distribution<double> coord(-3.0, 3.0);
+    std::uniform_real_distribution<double> height(-1.0, 5.0);
+    for (int trial = 0; trial < 100; ++trial) {
+        const Vector3d p(coord(engine), coord(engine), height(engine));
+        std::array<double, 2> expected = {0.0, 0.0};
+        double best = std::numeric_limits<double>::infinity();
+        for (int iu = 1; iu <= kU; ++iu) {
+            const double u = static_cast<double>(iu) / (kU + 1);
+            for (int iv = 1; iv <= kV; ++iv) {
+                const double v = 2.0 * igesio::kPi * iv / (kV + 1);
+                const double d = (surface->GetPointAt(u, v) - p).norm();
+                if (d < best) { best = d; expected = {u, v}; }
+            }
+        }
+        const auto nearest = locator.FindNearestSample(p);
+        ASSERT_TRUE(nearest.has_value());
+        EXPECT_NEAR((*nearest)[0], expected[0], 1e-12) << "trial " << trial;
+        EXPECT_NEAR((*nearest)[1], expected[1], 1e-12) << "trial " << trial;
+    }
+}
+
+/// @brief 索引は形状と格子サンプル数ごとにキャッシュされ、形状の変更で再構築される
+TEST(CurveSurfaceInversion, PointLocator_CachedPerGeometry) {
+    auto surface = i_test::MakeYFivePlane();
+    const auto first = surface->GetPointLocator(10, 10);
+    EXPECT_EQ(surface->GetPointLocator(10, 10), first);
+    EXPECT_NE(surface->GetPointLocator(10, 8), first);
+
+    const auto coarse = surface->GetPointLocator(10, 8);
+    const auto trans = i_ent::MakeTranslation(Vector3d{0., 10., 0.});
+    surface->OverwriteTransformationMatrix(trans);
+    const auto moved = surface->GetPointLocator(10, 8);
+    EXPECT_NE(moved, coarse);
+
+    // 移動後の形状で探索する (y=15 の平面上の点)
+    const auto sol = ProjectPointOntoSurface(*surface, surface->GetPointAt(0.3, 0.8));
+    ASSERT_TRUE(sol.has_value());
+    EXPECT_NEAR((*sol)[0], 0.3, kUVTol);
+    EXPECT_NEAR((*sol)[1], 0.8, kUVTol);
+}
+
+/// @brief 初期値を与えずに曲面上の点を逆射影できる
+TEST(CurveSurfaceInversion, ProjectPoint_RecoversKnownUV_OnCylinder) {
+    auto surface = i_test::MakeCylinder();
+    for (const auto& q : std::vector<std::array<double, 2>>{
+            {0.5, 1.0}, {0.05, 4.0}, {0.9, 6.0}}) {
+        const auto sol = ProjectPointOntoSurface(
+            *surface, surface->GetPointAt(q[0], q[1]));
+        ASSERT_TRUE(sol.has_value());
+        EXPECT_NEAR((*sol)[0], q[0], kUVTol);
+        EXPECT_NEAR((*sol)[1], q[1], kUVTol);
+    }
+}
+
+/// @brief 同じ曲面上の複数の曲線の逆射影で、キャッシュされた索引を共有する
+TEST(CurveSurfaceInversion, InvertCurve_SharesPointLocatorAcrossCurves) {
+    auto surface = i_test::MakeCylinder();
+    const auto locator = surface->GetPointLocator(20, 20);
+    for (const double v : {0.5, 2.0, 3.5}) {
+        const auto curve = i_ent::MakeLine(surface->GetPointAt(0.1, v),
+                                           surface->GetPointAt(0.9, v));
+        const auto arcs = InvertCurveOntoSurface(*surface, *curve);
+        ASSERT_EQ(arcs.size(), 1u);
+        EXPECT_NEAR(arcs.front().uv_points.front().x(), 0.1, kUVTol);
+        EXPECT_NEAR(arcs.front().uv_points.back().x(), 0.9, kUVTol);
+        EXPECT_NEAR(arcs.front().uv_points.back().y(), v, kUVTol);
+    }
+    EXPECT_EQ(surface->GetPointLocator(20, 20), locator);
+}
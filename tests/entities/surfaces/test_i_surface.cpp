@@ -13,12 +13,18 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "igesio/numerics/core/tolerance.h"
 #include "igesio/entities/interfaces/i_surface.h"
 #include "igesio/entities/curves/circular_arc.h"
 #include "igesio/entities/curves/line.h"
+#include "igesio/entities/surfaces/plane.h"
+#include "igesio/entities/surfaces/rational_b_spline_surface.h"
+#include "igesio/entities/surfaces/ruled_surface.h"
 #include "igesio/entities/surfaces/surface_of_revolution.h"
+#include "igesio/entities/surfaces/tabulated_cylinder.h"
+#include "igesio/entities/surfaces/trimmed_surface.h"
 #include "./surfaces_for_testing.h"
 
 namespace {
@@ -504,6 +510,127 @@ TEST(ISurfaceTest, GetBoundingBox) {
 }
 
 
+/// @brief 点から曲面 (モデル空間) までの距離を計算する
+/// @note 粗いグリッドで最近点の近傍を求め、パターン探索で局所的に改善する
+double DistanceToSurface(const ISurface& surface, const Vector3d& point) {
+    constexpr int kGrid = 16;
+    auto [umin, umax, vmin, vmax] = surface.GetParameterRange();
+    auto distance = [&](const double u, const double v) {
+        return (surface.GetPointAt(std::clamp(u, umin, umax),
+                                   std::clamp(v, vmin, vmax)) - point).norm();
+    };
+    double best_u = umin, best_v = vmin;
+    double best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i <= kGrid; ++i) {
+        for (int j = 0; j <= kGrid; ++j) {
+            const double u = umin + (umax - umin) * i / kGrid;
+            const double v = vmin + (vmax - vmin) * j / kGrid;
+            const double d = distance(u, v);
+            if (d < best) {
+                best = d;
+                best_u = u;
+                best_v = v;
+            }
+        }
+    }
+    double du = (umax - umin) / kGrid, dv = (vmax - vmin) / kGrid;
+    while (du > 1e-12 * (umax - umin) || dv > 1e-12 * (vmax - vmin)) {
+        bool improved = false;
+        for (const auto& [su, sv] : std::vector<std::pair<double, double>>{
+                {du, 0.0}, {-du, 0.0}, {0.0, dv}, {0.0, -dv},
+                {du, dv}, {-du, -dv}, {du, -dv}, {-du, dv}}) {
+            const double u = std::clamp(best_u + su, umin, umax);
+            const double v = std::clamp(best_v + sv, vmin, vmax);
+            const double d = distance(u, v);
+            if (d < best) {
+                best = d;
+                best_u = u;
+                best_v = v;
+                improved = true;
+            }
+        }
+        if (!improved) {
+            du /= 2.0;
+            dv /= 2.0;
+        }
+    }
+    return best;
+}
+
+// ISurface::ToNurbs() のテスト
+TEST(ISurfaceTest, ToNurbs) {
+    for (const auto& test_surface : igesio::tests::CreateAllTestSurfaces()) {
+        SCOPED_TRACE("Surface: " + test_surface.name);
+        const auto& surface = test_surface.surface;
+        ASSERT_NE(surface, nullptr);
+        const auto nurbs = surface->ToNurbs();
+
+        // 無限平面・トリム面はNURBSで表さない
+        if (std::dynamic_pointer_cast<i_ent::Plane>(surface)
+            || std::dynamic_pointer_cast<i_ent::TrimmedSurface>(surface)) {
+            EXPECT_EQ(nurbs, nullptr);
+            continue;
+        }
+        // 線織面は2曲線の母線が対応する場合のみ変換可能
+        if (nurbs == nullptr) {
+            EXPECT_NE(std::dynamic_pointer_cast<i_ent::RuledSurface>(surface), nullptr);
+            continue;
+        }
+        EXPECT_EQ(surface->ToNurbs(), nurbs);
+
+        // 四隅が元の曲面の四隅と対応する
+        auto [umin, umax, vmin, vmax] = surface->GetParameterRange();
+        auto [nu_min, nu_max, nv_min, nv_max] = nurbs->GetParameterRange();
+        for (const auto& [ru, rv] : std::vector<std::pair<int, int>>{
+                {0, 0}, {0, 1}, {1, 0}, {1, 1}}) {
+            const auto expected = surface->GetPointAt(ru ? umax : umin, rv ? vmax : vmin);
+            const auto actual = nurbs->GetPointAt(ru ? nu_max : nu_min,
+                                                  rv ? nv_max : nv_min);
+            EXPECT_TRUE(igesio::numerics::IsApproxEqual(actual, expected, 1e-9))
+                << "corner (" << ru << ", " << rv << "): " << actual.transpose()
+                << " vs " << expected.transpose();
+        }
+
+        // NURBS曲面上の点がすべて元の曲面上にあることを確認
+        constexpr int kChecks = 5;
+        double max_distance = 0.0;
+        for (int i = 0; i <= kChecks; ++i) {
+            for (int j = 0; j <= kChecks; ++j) {
+                const double u = nu_min + (nu_max - nu_min) * i / kChecks;
+                const double v = nv_min + (nv_max - nv_min) * j / kChecks;
+                max_distance = std::max(max_distance,
+                        DistanceToSurface(*surface, nurbs->GetPointAt(u, v)));
+            }
+        }
+        EXPECT_LT(max_distance, 1e-7);
+    }
+}
+
+// ISurface::ToNurbs() のテスト (線織面の母線の対応)
+TEST(ISurfaceTest, ToNurbsRuledSurfaceRulings) {
+    // 同じ中心角の円弧どうしはNURBSのパラメータ化も一致するため変換できる
+    auto arc = i_ent::MakeCircularArc(Vector2d(0.0, 0.0), 1.0, 0.0, igesio::kPi);
+    auto outer_arc = i_ent::MakeCircularArc(
+            Vector2d(0.0, 0.0), 2.0, 0.0, igesio::kPi, 1.0);
+    auto matched = i_ent::MakeRuledSurface(arc, outer_arc);
+    const auto nurbs = matched->ToNurbs();
+    ASSERT_NE(nurbs, nullptr);
+    auto [nu_min, nu_max, nv_min, nv_max] = nurbs->GetParameterRange();
+    for (int i = 0; i <= 4; ++i) {
+        for (int j = 0; j <= 4; ++j) {
+            const double u = nu_min + (nu_max - nu_min) * i / 4.0;
+            const double v = nv_min + (nv_max - nv_min) * j / 4.0;
+            EXPECT_LT(DistanceToSurface(*matched, nurbs->GetPointAt(u, v)), 1e-7);
+        }
+    }
+
+    // 円弧 (有理2次表現のパラメータ) と線分 (角度に比例するパラメータ) では
+    // 母線が対応しないため変換しない
+    auto line = i_ent::MakeLine(Vector3d(2.0, 0.0, 1.0), Vector3d(-2.0, 0.0, 1.0));
+    EXPECT_EQ(i_ent::MakeRuledSurface(arc, line)->ToNurbs(), nullptr);
+}
+
+
 
 /**
  * GetUCreaseParameters() の基底デフォルト
@@ -0,0 +1,234 @@
+/**
+ * @file entities/surfaces/test_minimum_distance.cpp
+ * @brief minimum_distance.h のテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * ### 対象関数
+ * - igesio::entities::MinimumDistance
+ *   - 曲線×曲線: ねじれの位置の線分、端点どうし、円と線分、交差する曲線
+ *   - 曲線×曲面: 平面と線分・円
+ *   - 曲面×曲面: 平面と円柱面
+ *   - TrimmedSurfaceの穴を通る線分 (トリム境界上の最近点)
+ * - igesio::entities::MinimumDistancePairs
+ *   - 各組の結果がMinimumDistanceと一致すること・引数の検証
+ *
+ * TODO: 自由曲面どうしの内部の最近点 (多数の局所解を持つ場合) は未検証
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/curves/circular_arc.h"
+#include "igesio/entities/surfaces/algorithms/minimum_distance.h"
+#include "./surfaces_for_testing.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_test = igesio::tests;
+using i_ent::MinimumDistance;
+using i_ent::MinimumDistanceResult;
+using igesio::Vector2d;
+using igesio::Vector3d;
+
+/// @brief 距離・位置比較の許容誤差
+constexpr double kTol = 1e-6;
+
+/// @brief 位置が期待値と一致するか検証するヘルパー
+void ExpectPositionNear(const Vector3d& actual, const Vector3d& expected,
+                        const double tol = kTol) {
+    EXPECT_NEAR(actual.x(), expected.x(), tol);
+    EXPECT_NEAR(actual.y(), expected.y(), tol);
+    EXPECT_NEAR(actual.z(), expected.z(), tol);
+}
+
+/// @brief 結果の点が各パラメータの点と一致し、距離が点間の距離と一致するか検証する
+void ExpectConsistent(const MinimumDistanceResult& result,
+                      const i_ent::ICurve& curve, const i_ent::ISurface& surface) {
+    ExpectPositionNear(curve.GetPointAt(result.params_a[0]), result.point_a);
+    ExpectPositionNear(
+            surface.GetPointAt(result.params_b[0], result.params_b[1]),
+            result.point_b);
+    EXPECT_NEAR((result.point_a - result.point_b).norm(), result.distance, 1e-12);
+}
+
+}  // namespace
+
+
+
+/**
+ * MinimumDistance: 曲線×曲線
+ */
+
+// ねじれの位置にある線分: 共通垂線の足を返す
+TEST(MinimumDistanceTest, SkewSegments) {
+    const auto seg1 = i_ent::MakeLine(Vector3d{-1., 0., 0.}, Vector3d{1., 0., 0.});
+    const auto seg2 = i_ent::MakeLine(Vector3d{0., -1., 2.}, Vector3d{0., 1., 2.});
+    const auto result = MinimumDistance(*seg1, *seg2);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_NEAR(result->distance, 2.0, kTol);
+    ExpectPositionNear(result->point_a, Vector3d{0., 0., 0.});
+    ExpectPositionNear(result->point_b, Vector3d{0., 0., 2.});
+    EXPECT_NEAR(result->params_a[0], 0.5, kTol);
+    EXPECT_NEAR(result->params_b[0], 0.5, kTol);
+}
+
+// 最近点が端点どうしとなる線分: パラメータ範囲の端にクランプする
+TEST(MinimumDistanceTest, SegmentsClosestAtEndpoints) {
+    const auto seg1 = i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{1., 0., 0.});
+    const auto seg2 = i_ent::MakeLine(Vector3d{3., 1., 0.}, Vector3d{5., 1., 0.});
+    const auto result = MinimumDistance(*seg1, *seg2);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_NEAR(result->distance, std::sqrt(5.0), kTol);
+    ExpectPositionNear(result->point_a, Vector3d{1., 0., 0.});
+    ExpectPositionNear(result->point_b, Vector3d{3., 1., 0.});
+}
+
+// 円と、円の外側の線分: 円上の最近点 (2, 0, 0) を返す
+TEST(MinimumDistanceTest, CircleAndSegment) {
+    const auto circle = i_ent::MakeCircle(Vector2d{0., 0.}, 2.0, 0.0);
+    const auto seg = i_ent::MakeLine(Vector3d{5., -5., 0.}, Vector3d{5., 5., 0.});
+    const auto result = MinimumDistance(*circle, *seg);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_NEAR(result->distance, 3.0, kTol);
+    ExpectPositionNear(result->point_a, Vector3d{2., 0., 0.});
+    ExpectPositionNear(result->point_b, Vector3d{5., 0., 0.});
+}
+
+// 交差する曲線: 距離0
+TEST(MinimumDistanceTest, IntersectingCurvesHaveZeroDistance) {
+    const auto circle = i_ent::MakeCircle(Vector2d{0., 0.}, 2.0, 0.0);
+    const auto seg = i_ent::MakeLine(Vector3d{-5., 1., 0.}, Vector3d{5., 1., 0.});
+    const auto result = MinimumDistance(*circle, *seg);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_NEAR(result->distance, 0.0, kTol);
+    EXPECT_NEAR(std::abs(result->point_a.x()), std::sqrt(3.0), 1e-4);
+    EXPECT_NEAR(result->point_a.y(), 1.0, 1e-4);
+}
+
+// パラメータ範囲が無限の曲線・不正なパラメータは例外
+TEST(MinimumDistanceTest, ThrowsForInvalidArguments) {
+    const auto line = i_ent::MakeUnboundedLine(Vector3d::Zero(), Vector3d::UnitX());
+    const auto circle = i_ent::MakeCircle(Vector2d{0., 0.}, 2.0, 0.0);
+    EXPECT_THROW(MinimumDistance(*line, *circle), std::invalid_argument);
+
+    i_ent::MinimumDistanceParams params;
+    params.u_samples = 0;
+    EXPECT_THROW(MinimumDistance(*circle, *i_test::MakeYFivePlane(), params),
+                 std::invalid_argument);
+    params = {};
+    params.tolerance = -1.0;
+    EXPECT_THROW(MinimumDistance(*circle, *circle, params), std::invalid_argument);
+}
+
+
+
+/**
+ * MinimumDistance: 曲線×曲面・曲面×曲面
+ */
+
+// 平面と線分・円: 平面に最も近い点を返す
+TEST(MinimumDistanceTest, CurvesAndPlane) {
+    const auto plane = i_test::MakeYFivePlane();
+
+    const auto seg = i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{1., 2., 0.});
+    const auto seg_result = MinimumDistance(*seg, *plane);
+    ASSERT_TRUE(seg_result.has_value());
+    EXPECT_NEAR(seg_result->distance, 3.0, kTol);
+    ExpectPositionNear(seg_result->point_a, Vector3d{1., 2., 0.});
+    ExpectPositionNear(seg_result->point_b, Vector3d{1., 5., 0.});
+    ExpectConsistent(*seg_result, *seg, *plane);
+
+    const auto circle = i_ent::MakeCircle(Vector2d{0., 1.}, 2.0, 0.0);
+    const auto circle_result = MinimumDistance(*circle, *plane);
+    ASSERT_TRUE(circle_result.has_value());
+    EXPECT_NEAR(circle_result->distance, 2.0, kTol);
+    ExpectPositionNear(circle_result->point_a, Vector3d{0., 3., 0.}, 1e-4);
+    ExpectConsistent(*circle_result, *circle, *plane);
+}
+
+// 平面と円柱面: 円柱の母線と平面の距離
+TEST(MinimumDistanceTest, PlaneAndCylinder) {
+    const auto plane = i_test::MakeYFivePlane();
+    const auto cylinder = i_test::MakeCylinder();
+    const auto result = MinimumDistance(*cylinder, *plane);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_NEAR(result->distance, 3.0, kTol);
+    EXPECT_NEAR(result->point_a.y(), 2.0, 1e-4);
+    EXPECT_NEAR(result->point_a.head<2>().norm(), 2.0, kTol);
+    EXPECT_NEAR(result->point_b.y(), 5.0, kTol);
+    ExpectPositionNear(
+            cylinder->GetPointAt(result->params_a[0], result->params_a[1]),
+            result->point_a);
+}
+
+// トリム面の穴を通る線分: 穴の境界上の点が最近点となる
+TEST(MinimumDistanceTest, SegmentThroughTrimmedHole) {
+    const auto trimmed = i_test::MakeTrimmedPlaneWithHole();
+    const auto seg = i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{0., 10., 0.});
+    const auto result = MinimumDistance(*seg, *trimmed);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_NEAR(result->distance, 1.0, kTol);
+    EXPECT_NEAR(result->point_b.y(), 5.0, kTol);
+    EXPECT_NEAR(std::max(std::abs(result->point_b.x()),
+                         std::abs(result->point_b.z())), 1.0, kTol);
+
+    // 穴の外を通る線分は面と交差する
+    const auto crossing = i_ent::MakeLine(Vector3d{2., 0., 0.}, Vector3d{2., 10., 0.});
+    const auto crossing_result = MinimumDistance(*crossing, *trimmed);
+    ASSERT_TRUE(crossing_result.has_value());
+    EXPECT_NEAR(crossing_result->distance, 0.0, kTol);
+}
+
+
+
+/**
+ * MinimumDistancePairs
+ */
+
+// 各組の結果がMinimumDistanceと一致する (要素を複数の組で共有する)
+TEST(MinimumDistancePairsTest, MatchesSingleQueries) {
+    const auto plane = i_test::MakeYFivePlane();
+    const auto cylinder = i_test::MakeCylinder();
+    const auto circle = i_ent::MakeCircle(Vector2d{0., 0.}, 2.0, 0.0);
+    const auto seg = i_ent::MakeLine(Vector3d{5., -5., 0.}, Vector3d{5., 5., 0.});
+    const std::vector<i_ent::GeometryPair> pairs = {
+            {circle, seg}, {seg, plane}, {plane, cylinder},
+            {circle, plane}, {cylinder, seg}};
+
+    const auto results = i_ent::MinimumDistancePairs(pairs);
+    ASSERT_EQ(results.size(), pairs.size());
+    ASSERT_TRUE(results[0] && results[1] && results[2] && results[3] && results[4]);
+    EXPECT_DOUBLE_EQ(results[0]->distance, MinimumDistance(*circle, *seg)->distance);
+    EXPECT_DOUBLE_EQ(results[1]->distance, MinimumDistance(*seg, *plane)->distance);
+    EXPECT_DOUBLE_EQ(results[2]->distance,
+                     MinimumDistance(*plane, *cylinder)->distance);
+    EXPECT_DOUBLE_EQ(results[3]->distance, MinimumDistance(*circle, *plane)->distance);
+    // 曲面×曲線の順の組は、曲面側をpoint_aとして返す
+    EXPECT_NEAR(results[4]->distance, 3.0, kTol);
+    EXPECT_NEAR(results[4]->point_b.x(), 5.0, kTol);
+}
+
+// nullptr・曲線でも曲面でもない要素を含む組は例外
+TEST(MinimumDistancePairsTest, ThrowsForInvalidElements) {
+    const auto circle = i_ent::MakeCircle(Vector2d{0., 0.}, 2.0, 0.0);
+    EXPECT_THROW(i_ent::MinimumDistancePairs({{circle, nullptr}}),
+                 std::invalid_argument);
+    const auto line = i_ent::MakeUnboundedLine(Vector3d::Zero(), Vector3d::UnitX());
+    EXPECT_THROW(i_ent::MinimumDistancePairs({{circle, line}}),
+                 std::invalid_argument);
+    EXPECT_TRUE(i_ent::MinimumDistancePairs({}).empty());
+}
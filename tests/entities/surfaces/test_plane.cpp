@@ -11,7 +11,7 @@
  *     (無限範囲・アフィン偏導関数・無限OBB) / Transform / PD読込 / ValidatePD
  *   [BoundedPlane (Form 1/-1)] MakeBoundedPlane / IRestrictedSurfaceフック /
  *     内外判定 (円・矩形・傾き平面) / 偏導関数の域ゲート / 有界BBox /
- *     キャッシュ無効化 / グレースフル劣化 / ValidatePD
+ *     キャッシュ無効化・並列問い合わせ / グレースフル劣化 / ValidatePD
  *   [EntityFactory] form番号による Plane/BoundedPlaneの振り分け
  *
  * TODO:
@@ -32,6 +32,7 @@
 
 #include "igesio/common/errors.h"
 #include "igesio/common/iges_parameter_vector.h"
+#include "igesio/common/parallel.h"
 #include "igesio/numerics/core/matrix.h"
 #include "igesio/entities/entity_type.h"
 #include "igesio/entities/factory.h"
@@ -489,6 +490,34 @@ TEST(BoundedPlaneCache, PrepareThenConsistent) {
     EXPECT_FALSE(bp->IsInDomain(5.0, 0.0));
 }
 
+// 事前構築なしで複数スレッドから同時に問い合わせても、各キャッシュ
+// (基底平面・UV境界・領域多角形) を共有して直列の結果と一致する
+TEST(BoundedPlaneCache, ConcurrentQueriesWithoutPrepare) {
+    const auto lazy = i_ent::MakeBoundedPlane(
+            0.0, 0.0, 1.0, 0.0, MakeZ0Circle(0.0, 0.0, 2.0));
+    const auto serial = i_ent::MakeBoundedPlane(
+            0.0, 0.0, 1.0, 0.0, MakeZ0Circle(0.0, 0.0, 2.0));
+
+    constexpr size_t kGrid = 20;
+    std::vector<char> in_domain(kGrid * kGrid, 0);
+    std::vector<const i_ent::ISurface*> bases(kGrid * kGrid, nullptr);
+    igesio::ParallelFor(kGrid * kGrid, [&](const size_t k) {
+        const double u = -3.0 + 6.0 * (k % kGrid + 0.5) / kGrid;
+        const double v = -3.0 + 6.0 * (k / kGrid + 0.5) / kGrid;
+        in_domain[k] = lazy->IsInDomain(u, v) ? 1 : 0;
+        bases[k] = lazy->GetBaseSurface().get();
+        (void)lazy->GetDefinedBoundingBox();
+    }, 0);
+
+    for (size_t k = 0; k < kGrid * kGrid; ++k) {
+        const double u = -3.0 + 6.0 * (k % kGrid + 0.5) / kGrid;
+        const double v = -3.0 + 6.0 * (k / kGrid + 0.5) / kGrid;
+        EXPECT_EQ(in_domain[k] != 0, serial->IsInDomain(u, v))
+                << "(u, v) = (" << u << ", " << v << ")";
+        EXPECT_EQ(bases[k], bases[0]);  // 基底平面は一度だけ構築される
+    }
+}
+
 // 境界の参照が未解決のまま: 制限を構築できないため内外判定は常にtrue (制限なし扱い)
 TEST(BoundedPlaneGraceful, UnresolvedBoundaryNoRestriction) {
     const auto circle = MakeZ0Circle(0.0, 0.0, 2.0);
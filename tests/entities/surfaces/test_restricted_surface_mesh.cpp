@@ -15,6 +15,8 @@
  *       - 細帯の救済 (細分の有無で被覆面積が対比)
  *       - パラメータ (max_depth=0 / 不正値クランプ)
  *       - 退化 (空ドメイン / 閉曲面基底) ・平面健全性・決定性
+ *       - 並列処理 (直列処理と頂点・三角形の順序まで一致)
+ *       - 許容量による適応的な分割 (平面での三角形数の削減 / 曲面での細分)
  *
  * TODO: 境界曲線が未解決の TrimmedSurface (GetParameterRange が投げる) は本関数の
  *       対象外 (呼び出し側責務) のため未カバー。
@@ -429,3 +431,78 @@ TEST(TessellateRestrictedSurface, Deterministic_SameInputProducesSameMesh) {
                     0.0f, kAreaTol);
     }
 }
+
+TEST(TessellateRestrictedSurface, Parallel_MatchesSerialExactly) {
+    auto plane = MakePlane();
+    auto ts = BuildTrimmed(plane, MakeUvRectLoop(0.1, 0.1, 0.9, 0.9),
+                           {MakeUvCircle({0.5, 0.5}, 0.15),
+                            MakeUvRectLoop(0.2, 0.2, 0.3, 0.7)});
+    // 並列化の閾値を超える葉の数となるよう、全ルートを細分する
+    RestrictedSurfaceMeshParams params{/*base_div=*/16, /*max_depth=*/3};
+    params.tolerance.max_edge_length = 0.1;
+    params.parallel = false;
+    const auto serial = i_ent::TessellateRestrictedSurface(*ts, params);
+    params.parallel = true;
+    const auto parallel = i_ent::TessellateRestrictedSurface(*ts, params);
+
+    // ルート単位の結合はルートの順に行うため、頂点・三角形の順序まで一致する
+    AssertValidMeshShape(parallel);
+    ASSERT_GT(parallel.indices.size(), 3u * 4096u);
+    EXPECT_EQ(parallel.indices, serial.indices);
+    ASSERT_EQ(parallel.positions.cols(), serial.positions.cols());
+    EXPECT_TRUE(parallel.positions == serial.positions);
+    EXPECT_TRUE(parallel.normals == serial.normals);
+    EXPECT_TRUE(parallel.uvs == serial.uvs);
+    // ルートの境界上の頂点も重複しない (クラックフリー)
+    for (const auto& [edge, used] : EdgeUseCount(parallel)) {
+        EXPECT_LE(used, 2) << "non-manifold edge used " << used << " times";
+    }
+}
+
+
+
+/**
+ * 許容量による適応的な分割 (tolerance)
+ */
+
+TEST(TessellateRestrictedSurface, Tolerance_PlanarBaseUsesFewerTriangles) {
+    auto plane = MakePlane();
+    auto ts = BuildTrimmed(plane, MakeUvRectLoop(0.1, 0.1, 0.9, 0.9),
+                           {MakeUvCircle({0.35, 0.6}, 0.12)});
+    RestrictedSurfaceMeshParams params{/*base_div=*/8, /*max_depth=*/5};
+    const auto legacy = i_ent::TessellateRestrictedSurface(*ts, params);
+
+    // 平面では曲率による細分が起きず、境界のルートもmax_depthまで細分しない
+    params.tolerance.chord_height = 1e-3;
+    const auto adaptive = i_ent::TessellateRestrictedSurface(*ts, params);
+
+    AssertValidMeshShape(adaptive);
+    EXPECT_LT(adaptive.indices.size(), legacy.indices.size());
+    // 被覆面積は従来の分割と同程度 (境界の折れ線近似の差のみ)
+    const auto range = ts->GetParameterRange();
+    EXPECT_NEAR(MeshUVArea(adaptive, range), MeshUVArea(legacy, range), 5e-3);
+    // 深さの異なるルートの間でもクラックが生じない
+    for (const auto& [edge, used] : EdgeUseCount(adaptive)) {
+        EXPECT_LE(used, 2) << "non-manifold edge used " << used << " times";
+    }
+}
+
+TEST(TessellateRestrictedSurface, Tolerance_CurvedBaseRefinesWithTighterChord) {
+    auto closed = MakeClosedBaseSurface();
+    auto ts = BuildTrimmed(closed, nullptr);
+    RestrictedSurfaceMeshParams params{/*base_div=*/4, /*max_depth=*/6};
+    const auto uniform = i_ent::TessellateRestrictedSurface(*ts, params);
+
+    params.tolerance.chord_height = 1e-1;
+    const auto coarse = i_ent::TessellateRestrictedSurface(*ts, params);
+    params.tolerance.chord_height = 1e-2;
+    const auto fine = i_ent::TessellateRestrictedSurface(*ts, params);
+
+    AssertValidMeshShape(fine);
+    // 未トリムでも曲率に応じて細分され、許容量が厳しいほど細かくなる
+    EXPECT_GT(coarse.indices.size(), uniform.indices.size());
+    EXPECT_GT(fine.indices.size(), coarse.indices.size());
+    for (const auto& [edge, used] : EdgeUseCount(fine)) {
+        EXPECT_LE(used, 2) << "non-manifold edge used " << used << " times";
+    }
+}
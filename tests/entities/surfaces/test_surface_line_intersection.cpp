@@ -7,6 +7,7 @@
  *
  * ### 対象関数
  * - igesio::entities::IntersectSurfaceWithLine
+ *   - kGridNewton (既定) / kSubdivision (NURBS制御網の再帰分割)
  *
  * TODO: TrimmedSurface の穴領域テスト（CurveOnAParametricSurfaceの構築が複雑なため未実装）
  * TODO: 無限パラメータ範囲の直接的な検証（フォールバック値がBBサイズ依存のため複雑）
@@ -24,12 +25,15 @@
 #include "igesio/entities/surfaces/surface_of_revolution.h"
 #include "igesio/entities/transformations/transformation_matrix.h"
 #include "igesio/entities/surfaces/algorithms/surface_line_intersection.h"
+#include "./surfaces_for_testing.h"
 
 namespace {
 
 namespace i_num = igesio::numerics;
 namespace i_ent = igesio::entities;
+namespace i_test = igesio::tests;
 using i_ent::SurfaceLineIntersection;
+using i_ent::SurfaceLineIntersectionMethod;
 using i_ent::SurfaceLineIntersectionParams;
 using i_ent::IntersectSurfaceWithLine;
 using igesio::Vector3d;
@@ -47,17 +51,6 @@ void ExpectPositionNear(const Vector3d& actual, const Vector3d& expected,
     EXPECT_NEAR(actual.z(), expected.z(), tol);
 }
 
-/// @brief y=5 の平面 (RationalBSplineSurface, u/v ∈ [0,1], x/z ∈ [-5,5])
-/// @note 変換なし（定義空間 = ワールド空間）
-std::shared_ptr<i_ent::RationalBSplineSurface> MakeYFivePlane() {
-    return i_ent::MakeRationalBSplineSurface(
-        {1, 1},                                              // 次数 {M1, M2}
-        {{Vector3d(-5., 5.,  5.), Vector3d( 5., 5.,  5.)},   // P(0,j)
-         {Vector3d(-5., 5., -5.), Vector3d( 5., 5., -5.)}},  // P(1,j)
-        {0., 0., 1., 1.},                                    // Uノット
-        {0., 0., 1., 1.});                                   // Vノット
-}
-
 /// @brief y=0 の平面 (RationalBSplineSurface, u/v ∈ [0,1], x/z ∈ [-5,5])
 /// @note 変換行列で移動・回転するための基底として使用する
 std::shared_ptr<i_ent::RationalBSplineSurface> MakeYZeroPlane() {
@@ -69,14 +62,20 @@ std::shared_ptr<i_ent::RationalBSplineSurface> MakeYZeroPlane() {
         {0., 0., 1., 1.});                                   // Vノット
 }
 
-/// @brief z軸を回転軸とする半径2・高さ4の円柱面 (SurfaceOfRevolution)
-/// @note S(u,v) = (2*cos(v), 2*sin(v), 4*u), u∈[0,1], v∈[0,2π]
-std::shared_ptr<i_ent::SurfaceOfRevolution> MakeCylinder() {
-    auto axis      = i_ent::MakeLine(
-        Vector3d{0., 0., 0.}, Vector3d{0., 0., 1.});
-    auto generatrix = i_ent::MakeLine(
-        Vector3d{2., 0., 0.}, Vector3d{2., 0., 4.});
-    return i_ent::MakeSurfaceOfRevolution(axis, generatrix, 0.0, 2.0 * igesio::kPi);
+/// @brief x方向に波打つ双3次×1次のB-Spline曲面 (u/v ∈ [0,1], x ∈ [0,11], y ∈ [0,1])
+/// @note 制御点のz座標がuに沿って±1を交互に取るため、y=一定の直線 z=0 と
+///       多数回交差する
+std::shared_ptr<i_ent::RationalBSplineSurface> MakeWavySurface() {
+    std::vector<std::vector<Vector3d>> points;
+    for (int i = 0; i < 12; ++i) {
+        const double z = (i % 2 == 0) ? 1.0 : -1.0;
+        points.push_back({Vector3d(i, 0., z), Vector3d(i, 1., z)});
+    }
+    std::vector<double> u_knots = {0., 0., 0., 0.};
+    for (int k = 1; k <= 8; ++k) u_knots.push_back(k / 9.0);
+    u_knots.insert(u_knots.end(), {1., 1., 1., 1.});
+    return i_ent::MakeRationalBSplineSurface(
+        {3, 1}, points, u_knots, {0., 0., 1., 1.});
 }
 
 /// @brief デフォルトの探索パラメータ (テスト用・サンプル数を増やしてある)
@@ -97,7 +96,7 @@ SurfaceLineIntersectionParams MakeParams(const int n = 20) {
 
 /// @brief y=5 の平面に法線方向のレイが正確に交差する
 TEST(IntersectSurfaceWithLineTest, PlaneHit_RayNormal) {
-    const auto plane = MakeYFivePlane();
+    const auto plane = i_test::MakeYFivePlane();
     // p0=(0,0,0), p1=(0,1,0): +y方向のレイ
     const auto hits = IntersectSurfaceWithLine(
         *plane, Vector3d{0., 0., 0.}, Vector3d{0., 1., 0.},
@@ -110,7 +109,7 @@ TEST(IntersectSurfaceWithLineTest, PlaneHit_RayNormal) {
 
 /// @brief 平面に平行なレイは交差しない
 TEST(IntersectSurfaceWithLineTest, PlaneNoHit_Parallel) {
-    const auto plane = MakeYFivePlane();
+    const auto plane = i_test::MakeYFivePlane();
     // y=0 を通る x方向のレイは y=5 の平面と平行
     const auto hits = IntersectSurfaceWithLine(
         *plane, Vector3d{0., 0., 0.}, Vector3d{1., 0., 0.},
@@ -121,7 +120,7 @@ TEST(IntersectSurfaceWithLineTest, PlaneNoHit_Parallel) {
 
 /// @brief kSegment で平面に届かない場合は交差しない
 TEST(IntersectSurfaceWithLineTest, PlaneNoHit_SegmentTooShort) {
-    const auto plane = MakeYFivePlane();
+    const auto plane = i_test::MakeYFivePlane();
     // p0=(0,0,0), p1=(0,1,0) のkSegment → t∈[0,1] で y=1 まで: 届かない
     const auto hits = IntersectSurfaceWithLine(
         *plane, Vector3d{0., 0., 0.}, Vector3d{0., 1., 0.},
@@ -132,7 +131,7 @@ TEST(IntersectSurfaceWithLineTest, PlaneNoHit_SegmentTooShort) {
 
 /// @brief kLine では t<0 側も交差として検出される
 TEST(IntersectSurfaceWithLineTest, PlaneHit_LineNegativeT) {
-    const auto plane = MakeYFivePlane();
+    const auto plane = i_test::MakeYFivePlane();
     // p0=(0,10,0), p1=(0,9,0): -y方向のkLine
     // t=5 で y=10+5*(-1)=5 → 交差
     const auto hits = IntersectSurfaceWithLine(
@@ -145,7 +144,7 @@ TEST(IntersectSurfaceWithLineTest, PlaneHit_LineNegativeT) {
 
 /// @brief p0 == p1 (方向ベクトルがゼロ) の場合は空リストを返す
 TEST(IntersectSurfaceWithLineTest, EmptyResult_ZeroDirection) {
-    const auto plane = MakeYFivePlane();
+    const auto plane = i_test::MakeYFivePlane();
     const auto hits = IntersectSurfaceWithLine(
         *plane, Vector3d{0., 0., 0.}, Vector3d{0., 0., 0.},
         LineType::kRay, MakeParams());
@@ -155,7 +154,7 @@ TEST(IntersectSurfaceWithLineTest, EmptyResult_ZeroDirection) {
 
 /// @brief p0 に NaN が含まれる場合は例外を投げる
 TEST(IntersectSurfaceWithLineTest, Throws_InvalidArg_NaN) {
-    const auto plane = MakeYFivePlane();
+    const auto plane = i_test::MakeYFivePlane();
     EXPECT_THROW(
         IntersectSurfaceWithLine(
             *plane,
@@ -173,7 +172,7 @@ TEST(IntersectSurfaceWithLineTest, Throws_InvalidArg_NaN) {
 
 /// @brief 円柱を貫通するレイが2交点を返し、t昇順に並ぶ
 TEST(IntersectSurfaceWithLineTest, Cylinder_TwoHits) {
-    const auto cylinder = MakeCylinder();
+    const auto cylinder = i_test::MakeCylinder();
     // p0=(-10,0,2), p1=(0,0,2): +x方向のレイ、高さ z=2
     const auto hits = IntersectSurfaceWithLine(
         *cylinder,
@@ -189,7 +188,7 @@ TEST(IntersectSurfaceWithLineTest, Cylinder_TwoHits) {
 
 /// @brief BBとの事前判定で外れる場合は空リスト
 TEST(IntersectSurfaceWithLineTest, Cylinder_NoHit_BBoxReject) {
-    const auto cylinder = MakeCylinder();
+    const auto cylinder = i_test::MakeCylinder();
     // y方向にずれたレイ (円柱のBBの外を通る)
     const auto hits = IntersectSurfaceWithLine(
         *cylinder,
@@ -207,7 +206,7 @@ TEST(IntersectSurfaceWithLineTest, Cylinder_NoHit_BBoxReject) {
 
 /// @brief 複数の初期点が同一の収束解を返した場合、1点に重複除去される
 TEST(IntersectSurfaceWithLineTest, Dedup_SameSolution) {
-    const auto plane = MakeYFivePlane();
+    const auto plane = i_test::MakeYFivePlane();
     // サンプル数を増やして同一解が多数生成されても重複除去後は1点
     SurfaceLineIntersectionParams p = MakeParams(50);
     const auto hits = IntersectSurfaceWithLine(
@@ -266,3 +265,114 @@ TEST(IntersectSurfaceWithLineTest, WithTransform_Rotation) {
     ExpectPositionNear(hits[0].position, Vector3d{0., 0., 0.});
     EXPECT_NEAR(hits[0].t, 1.0, kPosTol);
 }
+
+
+
+/**
+ * 再帰分割 (kSubdivision) による交差テスト
+ */
+
+/// @brief kSubdivisionの探索パラメータ
+SurfaceLineIntersectionParams MakeSubdivisionParams() {
+    SurfaceLineIntersectionParams p;
+    p.method = SurfaceLineIntersectionMethod::kSubdivision;
+    return p;
+}
+
+/// @brief NURBS曲面では格子法と同じ交点 (位置・uv・t) を返す
+TEST(IntersectSurfaceWithLineTest, Subdivision_PlaneMatchesGrid) {
+    const auto plane = i_test::MakeYFivePlane();
+    const Vector3d p0{1., 0., -2.}, p1{1.5, 1., -1.5};
+    const auto grid = IntersectSurfaceWithLine(
+        *plane, p0, p1, LineType::kRay, MakeParams());
+    const auto hits = IntersectSurfaceWithLine(
+        *plane, p0, p1, LineType::kRay, MakeSubdivisionParams());
+
+    ASSERT_EQ(grid.size(), 1u);
+    ASSERT_EQ(hits.size(), 1u);
+    ExpectPositionNear(hits[0].position, grid[0].position);
+    EXPECT_NEAR(hits[0].u, grid[0].u, kPosTol);
+    EXPECT_NEAR(hits[0].v, grid[0].v, kPosTol);
+    EXPECT_NEAR(hits[0].t, grid[0].t, kPosTol);
+}
+
+/// @brief NURBSへ変換される曲面では、元の曲面のパラメータで交点を返す
+TEST(IntersectSurfaceWithLineTest, Subdivision_CylinderMatchesGrid) {
+    const auto cylinder = i_test::MakeCylinder();
+    const Vector3d p0{-10., 0.5, 2.5}, p1{0., 0.3, 1.5};
+    const auto grid = IntersectSurfaceWithLine(
+        *cylinder, p0, p1, LineType::kLine, MakeParams());
+    const auto hits = IntersectSurfaceWithLine(
+        *cylinder, p0, p1, LineType::kLine, MakeSubdivisionParams());
+
+    ASSERT_EQ(grid.size(), 2u);
+    ASSERT_EQ(hits.size(), grid.size());
+    for (size_t i = 0; i < hits.size(); ++i) {
+        ExpectPositionNear(hits[i].position, grid[i].position);
+        EXPECT_NEAR(hits[i].t, grid[i].t, kPosTol);
+        // (u, v) は元の曲面 (SurfaceOfRevolution) のパラメータであること
+        const auto pt = cylinder->TryGetPointAt(hits[i].u, hits[i].v);
+        ASSERT_TRUE(pt.has_value());
+        ExpectPositionNear(*pt, hits[i].position);
+    }
+}
+
+/// @brief 変換行列を持つ曲面でもワールド空間の交点を返す
+TEST(IntersectSurfaceWithLineTest, Subdivision_WithTransform) {
+    auto plane = MakeYZeroPlane();
+    Matrix3d rz90;
+    rz90 <<  0., -1., 0.,
+             1.,  0., 0.,
+             0.,  0., 1.;
+    const auto trans = i_ent::MakeTransformationMatrix(rz90, Vector3d{0., 0., 1.});
+    plane->OverwriteTransformationMatrix(trans);
+
+    const auto hits = IntersectSurfaceWithLine(
+        *plane, Vector3d{1., 0., 0.}, Vector3d{0., 0., 0.},
+        LineType::kRay, MakeSubdivisionParams());
+
+    ASSERT_EQ(hits.size(), 1u);
+    ExpectPositionNear(hits[0].position, Vector3d{0., 0., 0.});
+    EXPECT_NEAR(hits[0].t, 1.0, kPosTol);
+}
+
+/// @brief 粗い格子では見落とす交点も、再帰分割では全て求める
+TEST(IntersectSurfaceWithLineTest, Subdivision_FindsRootsMissedByCoarseGrid) {
+    const auto wavy = MakeWavySurface();
+    const Vector3d p0{-1., 0.5, 0.}, p1{12., 0.5, 0.};
+
+    auto fine = MakeParams(60);
+    fine.v_samples = 3;  // 曲面はv方向に一様
+    const auto coarse_hits = IntersectSurfaceWithLine(
+        *wavy, p0, p1, LineType::kSegment, MakeParams(3));
+    const auto fine_hits = IntersectSurfaceWithLine(
+        *wavy, p0, p1, LineType::kSegment, fine);
+    auto params = MakeSubdivisionParams();
+    params.u_samples = params.v_samples = 3;  // NURBS曲面では使用されない
+    const auto hits = IntersectSurfaceWithLine(
+        *wavy, p0, p1, LineType::kSegment, params);
+
+    ASSERT_GT(fine_hits.size(), coarse_hits.size());
+    ASSERT_EQ(hits.size(), fine_hits.size());
+    for (size_t i = 0; i < hits.size(); ++i) {
+        ExpectPositionNear(hits[i].position, fine_hits[i].position);
+        EXPECT_NEAR(hits[i].position.z(), 0.0, kPosTol);
+        if (i > 0) {
+            EXPECT_LT(hits[i - 1].t, hits[i].t);
+        }
+    }
+}
+
+/// @brief 線種の範囲外の交点は返さない
+TEST(IntersectSurfaceWithLineTest, Subdivision_RespectsLineType) {
+    const auto cylinder = i_test::MakeCylinder();
+    // 円柱内部から+x方向: 半直線は1交点、線分 (長さ1) は交点なし、直線は2交点
+    const Vector3d p0{0., 0., 2.}, p1{1., 0., 2.};
+    const auto params = MakeSubdivisionParams();
+    EXPECT_EQ(IntersectSurfaceWithLine(
+        *cylinder, p0, p1, LineType::kRay, params).size(), 1u);
+    EXPECT_TRUE(IntersectSurfaceWithLine(
+        *cylinder, p0, p1, LineType::kSegment, params).empty());
+    EXPECT_EQ(IntersectSurfaceWithLine(
+        *cylinder, p0, p1, LineType::kLine, params).size(), 2u);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file tests/entities/surfaces/test_surface_tessellation_tolerance.cpp
+ * @brief entities/surfaces/algorithms/surface_tessellation_tolerance.hのテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * テスト対象:
+ *   - EstimateSubdivisionDepth: 平面では分割不要、円筒では弦高から求まる深さ、
+ *                               最大辺長による分割、max_depthによるクランプ
+ *   - ComputeAdaptiveStations: 直線方向は初期区間のまま、円周方向は弦高を満たす
+ *                              まで分割、許容量が無効の場合は初期区間のみ
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/surfaces/surface_of_revolution.h"
+#include "igesio/entities/surfaces/algorithms/surface_tessellation_tolerance.h"
+#include "./surfaces_for_testing.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_test = igesio::tests;
+using igesio::Vector3d;
+using igesio::kPi;
+using i_ent::TessellationTolerance;
+
+/// @brief 基底NURBS平面 S(u,v)=(-5+10u, 5, 5-10v), D=[0,1]² を作成する
+std::shared_ptr<i_ent::ISurface> MakePlane() {
+    return i_test::CreateRationalBSplineSurfaces()[0].surface;
+}
+
+/// @brief 半径1・高さ2の円筒 (u: 母線方向, v: 回転角 [0, 2π])
+std::shared_ptr<i_ent::ISurface> MakeYAxisCylinder() {
+    auto axis = i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{0., 1., 0.});
+    auto gen = i_ent::MakeLine(Vector3d{1., 0., 0.}, Vector3d{1., 2., 0.});
+    return i_ent::MakeSurfaceOfRevolution(axis, gen, 0., 2. * kPi);
+}
+
+/// @brief 弦高の許容量のみを指定した許容量を作成する
+TessellationTolerance ChordTolerance(const double chord_height) {
+    TessellationTolerance tol;
+    tol.chord_height = chord_height;
+    return tol;
+}
+
+}  // namespace
+
+
+
+/**
+ * EstimateSubdivisionDepth
+ */
+
+// 平面は弦高・角度の許容量では分割不要
+TEST(SurfaceTessellationToleranceTest, PlaneNeedsNoSubdivision) {
+    const auto plane = MakePlane();
+    auto tol = ChordTolerance(1e-6);
+    tol.angle = 1e-3;
+    EXPECT_EQ(i_ent::EstimateSubdivisionDepth(*plane, {0., 1.}, {0., 1.}, tol, 8), 0);
+}
+
+// 円筒: 円周全体 (2π) を2^d等分した弦高 |C''|/8/4^d が許容量以下となる最小のd
+TEST(SurfaceTessellationToleranceTest, CylinderDepthFromChordHeight) {
+    const auto cylinder = MakeYAxisCylinder();
+    const auto range = cylinder->GetParameterRange();
+    const std::array<double, 2> u_range{range[0], range[1]};
+    const std::array<double, 2> v_range{range[2], range[3]};
+
+    // |C''| = (2π)² → 0.5·log2((2π)²/8/0.01) ≈ 4.47 → 5
+    EXPECT_EQ(i_ent::EstimateSubdivisionDepth(
+            *cylinder, u_range, v_range, ChordTolerance(0.01), 8), 5);
+    // 許容量を1/4にすると1段深くなる
+    EXPECT_EQ(i_ent::EstimateSubdivisionDepth(
+            *cylinder, u_range, v_range, ChordTolerance(0.0025), 8), 6);
+    // max_depthでクランプされる
+    EXPECT_EQ(i_ent::EstimateSubdivisionDepth(
+            *cylinder, u_range, v_range, ChordTolerance(0.01), 3), 3);
+    // 許容量が無効の場合は0
+    EXPECT_EQ(i_ent::EstimateSubdivisionDepth(
+            *cylinder, u_range, v_range, TessellationTolerance{}, 8), 0);
+}
+
+// 最大辺長: 平面でも、対角線 (10√2) が上限以下となるまで分割する
+TEST(SurfaceTessellationToleranceTest, PlaneDepthFromMaxEdgeLength) {
+    const auto plane = MakePlane();
+    TessellationTolerance tol;
+    tol.max_edge_length = 1.0;
+    // log2(10√2) ≈ 3.82 → 4
+    EXPECT_EQ(i_ent::EstimateSubdivisionDepth(*plane, {0., 1.}, {0., 1.}, tol, 8), 4);
+}
+
+
+
+/**
+ * ComputeAdaptiveStations
+ */
+
+// 円筒の母線方向 (直線) は初期区間のまま、円周方向は弦高を満たすまで分割する
+TEST(SurfaceTessellationToleranceTest, CylinderStationsRefineOnlyAroundCircle) {
+    const auto cylinder = MakeYAxisCylinder();
+    const auto range = cylinder->GetParameterRange();
+    const std::array<double, 2> u_range{range[0], range[1]};
+    const std::array<double, 2> v_range{range[2], range[3]};
+    const auto tol = ChordTolerance(0.01);
+
+    const auto u_stations = i_ent::ComputeAdaptiveStations(
+            *cylinder, true, u_range, {v_range[0], v_range[1]}, tol, 8);
+    EXPECT_EQ(u_stations.size(),
+              static_cast<std::size_t>(i_ent::kAdaptiveInitialIntervals + 1));
+
+    // 各初期区間 (π/2) を8等分して弦高 (π/2/8)²/8 ≈ 0.0048 <= 0.01
+    const auto v_stations = i_ent::ComputeAdaptiveStations(
+            *cylinder, false, v_range, {u_range[0], u_range[1]}, tol, 8);
+    ASSERT_EQ(v_stations.size(), 33u);
+    EXPECT_DOUBLE_EQ(v_stations.front(), v_range[0]);
+    EXPECT_DOUBLE_EQ(v_stations.back(), v_range[1]);
+    for (std::size_t k = 1; k < v_stations.size(); ++k) {
+        const double step = v_stations[k] - v_stations[k - 1];
+        ASSERT_GT(step, 0.0);
+        // 半径1の円弧の実際の弦高
+        EXPECT_LE(1.0 - std::cos(0.5 * step), 0.01);
+    }
+}
+
+// 許容量が無効の場合は初期区間の等分点のみを返す
+TEST(SurfaceTessellationToleranceTest, DisabledToleranceReturnsInitialIntervals) {
+    const auto cylinder = MakeYAxisCylinder();
+    const auto v_stations = i_ent::ComputeAdaptiveStations(
+            *cylinder, false, {0., 2. * kPi}, {0.5},
+            TessellationTolerance{}, 8);
+    ASSERT_EQ(v_stations.size(),
+              static_cast<std::size_t>(i_ent::kAdaptiveInitialIntervals + 1));
+    for (std::size_t k = 0; k < v_stations.size(); ++k) {
+        EXPECT_NEAR(v_stations[k],
+                    2. * kPi * k / i_ent::kAdaptiveInitialIntervals, 1e-12);
+    }
+}
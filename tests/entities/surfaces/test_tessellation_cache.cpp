@@ -0,0 +1,165 @@
+/**
+ * @file tests/entities/surfaces/test_tessellation_cache.cpp
+ * @brief TessellationCache (entities/surfaces/algorithms) のテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 検証する不変量:
+ *       - 同じエンティティ・パラメータでは再テッセレーションしない (同じ結果を共有)
+ *       - 形状 (物理従属子を含む) の変更・パラメータの違いで別の結果となり、
+ *         形状の変更前の結果は破棄される
+ *       - メモリ上限による最も長く参照されていないエントリの破棄、上限0での無効化
+ *       - 複数スレッドからの同時参照
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "igesio/common/parallel.h"
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/surfaces/algorithms/tessellation_cache.h"
+
+#include "./surfaces_for_testing.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_test = igesio::tests;
+using igesio::Vector3d;
+using i_ent::RestrictedSurfaceMeshParams;
+using i_ent::TessellationCache;
+
+}  // namespace
+
+
+
+/**
+ * 再利用と無効化
+ */
+
+// 同じエンティティ・パラメータの2回目以降はキャッシュから同じ結果を返す
+TEST(TessellationCacheTest, ReusesResultForUnchangedGeometry) {
+    TessellationCache cache;
+    const auto target = i_test::MakeTrimmedPlane();
+
+    const auto first = cache.GetRestrictedSurfaceMesh(*target.trimmed);
+    const auto second = cache.GetRestrictedSurfaceMesh(*target.trimmed);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_GT(first->TriangleCount(), 0u);
+
+    const auto stats = cache.GetStats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(cache.GetEntryCount(), 1u);
+    EXPECT_EQ(cache.GetMemoryUsage(), i_ent::EstimateMeshMemory(*first));
+
+    // 結果は直接のテッセレーションと一致する
+    const auto direct = i_ent::TessellateRestrictedSurface(*target.trimmed);
+    EXPECT_EQ(first->indices, direct.indices);
+    EXPECT_TRUE(first->positions.isApprox(direct.positions));
+}
+
+// 基底曲面 (物理従属子) の形状を変更すると再テッセレーションし、古い結果を破棄する
+TEST(TessellationCacheTest, RebuildsWhenChildGeometryChanges) {
+    TessellationCache cache;
+    const auto target = i_test::MakeTrimmedPlane();
+    const auto before = cache.GetRestrictedSurfaceMesh(*target.trimmed);
+    const auto before_key = i_ent::MakeTessellationCacheKey(
+            *target.trimmed, i_ent::HashTessellationParams(RestrictedSurfaceMeshParams{}));
+
+    target.plane->SetControlPointAt(1, 1, Vector3d(2., 2., 1.));
+    const auto after = cache.GetRestrictedSurfaceMesh(*target.trimmed);
+    EXPECT_NE(before, after);
+    EXPECT_EQ(cache.GetStats().misses, 2u);
+    EXPECT_EQ(cache.GetEntryCount(), 1u);
+    EXPECT_EQ(cache.GetMemoryUsage(), i_ent::EstimateMeshMemory(*after));
+
+    // 変更前のキーでは見つからない (同じID・パラメータのエントリは置き換わる)
+    EXPECT_EQ(cache.Find(before_key), nullptr);
+
+    // 変更前に取得した結果は有効なまま
+    EXPECT_GT(before->TriangleCount(), 0u);
+}
+
+// パラメータが異なる場合は別のエントリとなる
+TEST(TessellationCacheTest, SeparatesEntriesByParams) {
+    TessellationCache cache;
+    const auto target = i_test::MakeTrimmedPlane();
+    RestrictedSurfaceMeshParams coarse;
+    coarse.base_div = 4;
+    RestrictedSurfaceMeshParams fine;
+    fine.base_div = 16;
+
+    const auto a = cache.GetRestrictedSurfaceMesh(*target.trimmed, coarse);
+    const auto b = cache.GetRestrictedSurfaceMesh(*target.trimmed, fine);
+    EXPECT_NE(a, b);
+    EXPECT_LT(a->TriangleCount(), b->TriangleCount());
+    EXPECT_EQ(cache.GetEntryCount(), 2u);
+    EXPECT_EQ(cache.GetRestrictedSurfaceMesh(*target.trimmed, coarse), a);
+    EXPECT_NE(i_ent::HashTessellationParams(coarse), i_ent::HashTessellationParams(fine));
+}
+
+
+
+/**
+ * メモリ上限
+ */
+
+// 上限を超えると、最も長く参照されていないエントリから破棄する
+TEST(TessellationCacheTest, EvictsLeastRecentlyUsed) {
+    const auto a = i_test::MakeTrimmedPlane();
+    const auto b = i_test::MakeTrimmedPlane();
+    const auto c = i_test::MakeTrimmedPlane();
+    const auto bytes = i_ent::EstimateMeshMemory(
+            i_ent::TessellateRestrictedSurface(*a.trimmed));
+    // 2つ分だけ保持できる上限 (3つの結果はいずれも同じ大きさ)
+    TessellationCache cache(2 * bytes + bytes / 2);
+
+    const auto mesh_a = cache.GetRestrictedSurfaceMesh(*a.trimmed);
+    cache.GetRestrictedSurfaceMesh(*b.trimmed);
+    // aを参照し直すと、次の登録ではbが破棄される
+    EXPECT_EQ(cache.GetRestrictedSurfaceMesh(*a.trimmed), mesh_a);
+    cache.GetRestrictedSurfaceMesh(*c.trimmed);
+    EXPECT_EQ(cache.GetEntryCount(), 2u);
+    EXPECT_EQ(cache.GetStats().evictions, 1u);
+    EXPECT_LE(cache.GetMemoryUsage(), cache.GetMemoryBudget());
+
+    const auto misses = cache.GetStats().misses;
+    cache.GetRestrictedSurfaceMesh(*a.trimmed);
+    EXPECT_EQ(cache.GetStats().misses, misses);
+    cache.GetRestrictedSurfaceMesh(*b.trimmed);
+    EXPECT_EQ(cache.GetStats().misses, misses + 1);
+
+    // 上限を0にすると全て破棄し、以降は保持しない
+    cache.SetMemoryBudget(0);
+    EXPECT_EQ(cache.GetEntryCount(), 0u);
+    EXPECT_EQ(cache.GetMemoryUsage(), 0u);
+    EXPECT_NE(cache.GetRestrictedSurfaceMesh(*a.trimmed), nullptr);
+    EXPECT_EQ(cache.GetEntryCount(), 0u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetStats().misses, 0u);
+}
+
+
+
+/**
+ * 並列
+ */
+
+// 複数スレッドから同時に参照しても、全員が同じ登録済みの結果を得る
+TEST(TessellationCacheTest, ConcurrentRequestsShareOneEntry) {
+    TessellationCache cache;
+    const auto target = i_test::MakeTrimmedPlane();
+    std::vector<std::shared_ptr<const igesio::numerics::TriangleMeshf>> results(16);
+    igesio::ParallelFor(results.size(), [&](const std::size_t i) {
+        results[i] = cache.GetRestrictedSurfaceMesh(*target.trimmed);
+    });
+
+    EXPECT_EQ(cache.GetEntryCount(), 1u);
+    const auto registered = cache.GetRestrictedSurfaceMesh(*target.trimmed);
+    for (const auto& mesh : results) EXPECT_EQ(mesh, registered);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file tests/entities/surfaces/test_tessellation_sidecar.cpp
+ * @brief テッセレーション結果のサイドカーファイル (entities/surfaces/algorithms) のテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 検証する不変量:
+ *       - 内容ハッシュはIDに依存せず、内容 (物理従属子を含む) の変更で変わる
+ *       - 保存した結果を別のキャッシュ・別のエンティティ (同じ内容) へ読み込むと、
+ *         再テッセレーションせず同じメッシュを得る
+ *       - 内容の異なるエンティティ・存在しない/破損したファイルからは何も読み込まない
+ */
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/surfaces/algorithms/tessellation_sidecar.h"
+
+#include "./surfaces_for_testing.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_test = igesio::tests;
+using igesio::Vector3d;
+using i_ent::TessellationCache;
+
+/// @brief テスト用の一時ファイルのパス
+std::string TempSidecarPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path()
+            / (name + i_ent::kTessellationSidecarExtension)).string();
+}
+
+}  // namespace
+
+
+
+/**
+ * 内容ハッシュ
+ */
+
+// 同じ内容で作成したエンティティは同じ値となり、形状の変更で値が変わる
+TEST(TessellationSidecarTest, ContentHashIgnoresIdAndTracksChildren) {
+    const auto a = i_test::MakeTrimmedPlane();
+    const auto b = i_test::MakeTrimmedPlane();
+    ASSERT_NE(a.trimmed->GetID(), b.trimmed->GetID());
+
+    const auto hash_a = i_ent::ComputeEntityContentHash(*a.trimmed);
+    ASSERT_TRUE(hash_a.has_value());
+    EXPECT_EQ(hash_a, i_ent::ComputeEntityContentHash(*b.trimmed));
+    EXPECT_NE(hash_a, i_ent::ComputeEntityContentHash(*a.plane));
+
+    // 物理従属子 (基底曲面) の変更も検知する
+    b.plane->SetControlPointAt(1, 1, Vector3d(2., 2., 1.));
+    EXPECT_NE(hash_a, i_ent::ComputeEntityContentHash(*b.trimmed));
+}
+
+// ファイルに保存するパラメータのハッシュは、標準ライブラリの実装によらず固定の値となる
+TEST(TessellationSidecarTest, ParamsHashIsStable) {
+    // 種別値 (u64)・base_div・max_depth (int)・許容量 (double x3) のFNV-1a
+    EXPECT_EQ(i_ent::HashTessellationParams(i_ent::RestrictedSurfaceMeshParams{}),
+              0x8caef2fc14a9a3dfULL);
+}
+
+
+
+/**
+ * 保存・読み込み
+ */
+
+// 保存した結果は、同じ内容の別のエンティティ・別のキャッシュで再利用される
+TEST(TessellationSidecarTest, RoundTripSkipsTessellation) {
+    const auto path = TempSidecarPath("igesio_test_sidecar_round_trip");
+    const auto original = i_test::MakeTrimmedPlane();
+    TessellationCache saved_cache;
+    const auto saved = saved_cache.GetRestrictedSurfaceMesh(*original.trimmed);
+    ASSERT_TRUE(i_ent::SaveTessellationSidecar(path, {original.trimmed}, saved_cache));
+
+    // 読み直したモデルに相当する、同じ内容で新たに作成したエンティティ
+    const auto reloaded = i_test::MakeTrimmedPlane();
+    TessellationCache cache;
+    EXPECT_EQ(i_ent::LoadTessellationSidecar(path, {reloaded.trimmed}, cache), 1u);
+    const auto mesh = cache.GetRestrictedSurfaceMesh(*reloaded.trimmed);
+    EXPECT_EQ(cache.GetStats().misses, 0u);
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+
+    ASSERT_NE(mesh, nullptr);
+    EXPECT_EQ(mesh->indices, saved->indices);
+    EXPECT_EQ(mesh->positions, saved->positions);
+    EXPECT_EQ(mesh->normals, saved->normals);
+    EXPECT_EQ(mesh->uvs, saved->uvs);
+    ASSERT_EQ(mesh->groups.size(), saved->groups.size());
+    for (std::size_t i = 0; i < mesh->groups.size(); ++i) {
+        EXPECT_EQ(mesh->groups[i].name, saved->groups[i].name);
+        EXPECT_EQ(mesh->groups[i].triangle_count, saved->groups[i].triangle_count);
+    }
+    std::filesystem::remove(path);
+}
+
+// 内容の変わったエンティティには読み込まない
+TEST(TessellationSidecarTest, SkipsChangedEntities) {
+    const auto path = TempSidecarPath("igesio_test_sidecar_changed");
+    const auto original = i_test::MakeTrimmedPlane();
+    TessellationCache saved_cache;
+    saved_cache.GetRestrictedSurfaceMesh(*original.trimmed);
+    ASSERT_TRUE(i_ent::SaveTessellationSidecar(path, {original.trimmed}, saved_cache));
+
+    const auto changed = i_test::MakeTrimmedPlane();
+    changed.plane->SetControlPointAt(1, 1, Vector3d(2., 2., 1.));
+    TessellationCache cache;
+    EXPECT_EQ(i_ent::LoadTessellationSidecar(path, {changed.trimmed}, cache), 0u);
+    EXPECT_EQ(cache.GetEntryCount(), 0u);
+    std::filesystem::remove(path);
+}
+
+// 存在しない・破損したファイルからは何も読み込まない
+TEST(TessellationSidecarTest, RejectsMissingOrCorruptFiles) {
+    const auto path = TempSidecarPath("igesio_test_sidecar_corrupt");
+    const auto target = i_test::MakeTrimmedPlane();
+    TessellationCache cache;
+    std::filesystem::remove(path);
+    EXPECT_EQ(i_ent::LoadTessellationSidecar(path, {target.trimmed}, cache), 0u);
+
+    // 正しいファイルを途中で切り詰める
+    TessellationCache saved_cache;
+    saved_cache.GetRestrictedSurfaceMesh(*target.trimmed);
+    ASSERT_TRUE(i_ent::SaveTessellationSidecar(path, {target.trimmed}, saved_cache));
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size / 2);
+    EXPECT_EQ(i_ent::LoadTessellationSidecar(path, {target.trimmed}, cache), 0u);
+
+    // 先頭が異なるファイル
+    {
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+        ofs << std::string(64, 'x');
+    }
+    EXPECT_EQ(i_ent::LoadTessellationSidecar(path, {target.trimmed}, cache), 0u);
+    EXPECT_EQ(cache.GetEntryCount(), 0u);
+    std::filesystem::remove(path);
+}
@@ -12,6 +12,7 @@
  *       - TrimmedSurface フック: GetBaseSurface / GetOuterUVBoundary /
  *         GetInnerBoundaryCount / GetInnerUVBoundaryAt
  *       - キャッシュ無効化 (PrepareGeometryCache / Set/Add/Remove系)
+ *       - 事前構築なしでの複数スレッドからの同時問い合わせ
  *       - エラー系・グレースフル劣化 (未解決参照)
  *
  * TODO: ValidatePD()は本変更で不変のため未カバー。
@@ -26,6 +27,7 @@
 #include <vector>
 
 #include "igesio/common/errors.h"
+#include "igesio/common/parallel.h"
 #include "igesio/common/iges_parameter_vector.h"
 #include "igesio/numerics/core/matrix.h"
 #include "igesio/entities/entity_type.h"
@@ -392,6 +394,38 @@ TEST(TrimmedSurfaceCache, SetOuterNullRevertsToUntrimmed) {
     EXPECT_TRUE(ts->IsInDomain(0.1, 0.5));  // 制限なしへ復帰
 }
 
+// PrepareGeometryCacheを経ずに複数スレッドから同時に問い合わせても、
+// キャッシュは一度だけ構築され、事前構築した場合と同じ結果を返す
+TEST(TrimmedSurfaceCache, ConcurrentQueriesWithoutPrepare) {
+    auto plane = MakePlane();
+    auto outer = MakeBoundary142(plane, MakeUvCircle(Vector2d{0.5, 0.5}, 0.4));
+    auto hole = MakeBoundary142(plane, MakeUvRectLoop(0.4, 0.4, 0.6, 0.6));
+    auto prepared = std::make_shared<TrimmedSurface>(plane, outer);
+    prepared->AddInnerBoundary(hole);
+    prepared->PrepareGeometryCache();
+    auto lazy = std::make_shared<TrimmedSurface>(plane, outer);
+    lazy->AddInnerBoundary(hole);
+
+    constexpr size_t kGrid = 24;
+    std::vector<char> in_domain(kGrid * kGrid, 0);
+    std::vector<char> has_derivs(kGrid * kGrid, 0);
+    igesio::ParallelFor(kGrid * kGrid, [&](const size_t k) {
+        const double u = (k % kGrid + 0.5) / kGrid;
+        const double v = (k / kGrid + 0.5) / kGrid;
+        in_domain[k] = lazy->IsInDomain(u, v) ? 1 : 0;
+        has_derivs[k] = lazy->TryGetDefinedDerivatives(u, v, 1).has_value() ? 1 : 0;
+    }, 0);
+
+    for (size_t k = 0; k < kGrid * kGrid; ++k) {
+        const double u = (k % kGrid + 0.5) / kGrid;
+        const double v = (k / kGrid + 0.5) / kGrid;
+        EXPECT_EQ(in_domain[k] != 0, prepared->IsInDomain(u, v))
+                << "(u, v) = (" << u << ", " << v << ")";
+        EXPECT_EQ(has_derivs[k] != 0,
+                  prepared->TryGetDefinedDerivatives(u, v, 1).has_value());
+    }
+}
+
 
 
 /**
@@ -0,0 +1,254 @@
+/**
+ * @file tests/entities/surfaces/test_watertight_mesh.cpp
+ * @brief TessellateWatertight (entities/surfaces/algorithms) のテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note 検証する不変量:
+ *       - 閉じた形状 (側面・上下の蓋からなる円柱) では全ての辺がちょうど2回使われる
+ *         (隙間・T字接合がない). 側面の継ぎ目も同じ頂点で接続される
+ *       - 離散化の細かさが異なる面・T字に接する面の間に境界辺が残らない
+ *       - 同じ位置の頂点が重複しない (共有境界の頂点は1つ)
+ *       - 面グループ (facesの順)・不正な引数
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/entities/curves/circular_arc.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/curves/curve_on_a_parametric_surface.h"
+#include "igesio/entities/surfaces/rational_b_spline_surface.h"
+#include "igesio/entities/surfaces/surface_of_revolution.h"
+#include "igesio/entities/surfaces/trimmed_surface.h"
+#include "igesio/entities/surfaces/algorithms/watertight_mesh.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+using igesio::Vector2d;
+using igesio::Vector3d;
+using i_ent::WatertightMeshParams;
+using igesio::numerics::TriangleMeshf;
+using Faces = std::vector<std::shared_ptr<const i_ent::ISurface>>;
+
+/// @brief 双一次の平面 S(u,v) (u, v ∈ [0,1]. 角 S(0,0)=p00, S(1,0)=p10 等)
+std::shared_ptr<i_ent::RationalBSplineSurface> MakeQuad(
+        const Vector3d& p00, const Vector3d& p10,
+        const Vector3d& p01, const Vector3d& p11) {
+    return i_ent::MakeRationalBSplineSurface(
+        {1, 1}, {{p00, p10}, {p01, p11}}, {0., 0., 1., 1.}, {0., 0., 1., 1.});
+}
+
+/// @brief 平面z=zの正方形 |x|,|y| <= 2 を、半径1の円 (中心は原点) でトリムした円板
+std::shared_ptr<i_ent::TrimmedSurface> MakeDisk(const double z) {
+    const auto plane = MakeQuad({-2., -2., z}, {2., -2., z}, {-2., 2., z}, {2., 2., z});
+    auto [outer, o_] = i_ent::MakeCurveOnAParametricSurface(
+            plane, i_ent::MakeCircle(Vector2d{0.5, 0.5}, 0.25));
+    return std::make_shared<i_ent::TrimmedSurface>(plane, outer);
+}
+
+/// @brief z軸周りの半径1、高さ1の円柱の側面
+std::shared_ptr<i_ent::SurfaceOfRevolution> MakeUnitCylinder() {
+    return i_ent::MakeSurfaceOfRevolution(
+            Vector3d{0., 0., 0.}, Vector3d{0., 0., 1.},
+            i_ent::MakeLine(Vector3d{1., 0., 0.}, Vector3d{1., 0., 1.})).first;
+}
+
+/// @brief 無向辺ごとの使用回数
+std::map<std::pair<std::uint32_t, std::uint32_t>, int> EdgeUseCount(
+        const TriangleMeshf& mesh) {
+    std::map<std::pair<std::uint32_t, std::uint32_t>, int> count;
+    for (std::size_t k = 0; k < mesh.indices.size(); k += 3) {
+        for (int m = 0; m < 3; ++m) {
+            const auto a = mesh.indices[k + m];
+            const auto b = mesh.indices[k + (m + 1) % 3];
+            count[{std::min(a, b), std::max(a, b)}]++;
+        }
+    }
+    return count;
+}
+
+/// @brief 頂点の位置
+Vector3d PositionOf(const TriangleMeshf& mesh, const std::uint32_t i) {
+    return mesh.positions.col(i).cast<double>();
+}
+
+/// @brief 出力構造 (列数・インデックス範囲・退化三角形なし) と頂点の重複なしを検証する
+void ExpectValidMesh(const TriangleMeshf& mesh) {
+    ASSERT_EQ(mesh.normals.cols(), mesh.positions.cols());
+    EXPECT_EQ(mesh.uvs.cols(), 0);
+    ASSERT_EQ(mesh.indices.size() % 3, 0u);
+    for (std::size_t k = 0; k < mesh.indices.size(); k += 3) {
+        const auto a = mesh.indices[k], b = mesh.indices[k + 1], c = mesh.indices[k + 2];
+        ASSERT_LT(std::max({a, b, c}), mesh.VertexCount());
+        EXPECT_TRUE(a != b && b != c && c != a);
+    }
+    for (std::size_t i = 0; i < mesh.VertexCount(); ++i) {
+        EXPECT_NEAR(mesh.normals.col(i).norm(), 1.0f, 1e-4f);
+        for (std::size_t j = i + 1; j < mesh.VertexCount(); ++j) {
+            EXPECT_GT((PositionOf(mesh, i) - PositionOf(mesh, j)).norm(), 1e-5)
+                    << "duplicated vertices " << i << ", " << j;
+        }
+    }
+}
+
+/// @brief 面グループが入力の面を順に覆うことを検証する
+void ExpectGroupsCoverFaces(const TriangleMeshf& mesh, const std::size_t face_count) {
+    ASSERT_EQ(mesh.groups.size(), face_count);
+    std::uint32_t next = 0;
+    for (const auto& group : mesh.groups) {
+        EXPECT_EQ(group.first_triangle, next);
+        EXPECT_GT(group.triangle_count, 0u);
+        next += group.triangle_count;
+    }
+    EXPECT_EQ(next, mesh.TriangleCount());
+}
+
+}  // namespace
+
+
+
+/**
+ * 閉じた形状
+ */
+
+// 側面と上下の蓋からなる円柱: 全ての辺がちょうど2回使われる
+TEST(WatertightMeshTest, ClosedCylinderHasNoBoundaryEdges) {
+    const Faces faces{MakeUnitCylinder(), MakeDisk(0.0), MakeDisk(1.0)};
+    const auto mesh = i_ent::TessellateWatertight(faces);
+
+    ExpectValidMesh(mesh);
+    ExpectGroupsCoverFaces(mesh, faces.size());
+    for (const auto& [edge, used] : EdgeUseCount(mesh)) {
+        EXPECT_EQ(used, 2) << "edge " << edge.first << "-" << edge.second << ": "
+                           << PositionOf(mesh, edge.first).transpose() << " / "
+                           << PositionOf(mesh, edge.second).transpose();
+    }
+
+    // 表面積は側面と上下の蓋の和 (2π + 2π) に近い (重なり・扇状の分割がない)
+    double area = 0.0;
+    for (std::size_t k = 0; k < mesh.indices.size(); k += 3) {
+        const auto a = PositionOf(mesh, mesh.indices[k]);
+        area += 0.5 * (PositionOf(mesh, mesh.indices[k + 1]) - a)
+                .cross(PositionOf(mesh, mesh.indices[k + 2]) - a).norm();
+    }
+    EXPECT_NEAR(area, 4.0 * std::acos(-1.0), 0.1);
+
+    // 全ての頂点が円柱の表面上にある
+    for (std::size_t i = 0; i < mesh.VertexCount(); ++i) {
+        const auto p = PositionOf(mesh, i);
+        const double r = std::hypot(p.x(), p.y());
+        EXPECT_TRUE(std::abs(r - 1.0) < 1e-5 || std::abs(p.z()) < 1e-6 ||
+                    std::abs(p.z() - 1.0) < 1e-6) << p.transpose();
+        EXPECT_LE(r, 1.0 + 1e-5);
+    }
+}
+
+// 許容量を細かくすると境界の離散化も細かくなり、閉じた形状が保たれる
+TEST(WatertightMeshTest, TighterToleranceRefinesSharedEdges) {
+    const Faces faces{MakeUnitCylinder(), MakeDisk(0.0), MakeDisk(1.0)};
+    WatertightMeshParams coarse;
+    WatertightMeshParams fine;
+    fine.tolerance.chord_height = 1e-3;
+    const auto coarse_mesh = i_ent::TessellateWatertight(faces, coarse);
+    const auto fine_mesh = i_ent::TessellateWatertight(faces, fine);
+
+    EXPECT_GT(fine_mesh.VertexCount(), coarse_mesh.VertexCount());
+    for (const auto& [edge, used] : EdgeUseCount(fine_mesh)) {
+        EXPECT_EQ(used, 2);
+    }
+}
+
+
+
+/**
+ * 開いた形状
+ */
+
+// 離散化の細かさが異なる隣接面 (一方に円形の穴): 共有辺に境界辺が残らない
+TEST(WatertightMeshTest, SharedEdgeBetweenDifferentlyRefinedFaces) {
+    const auto left = MakeQuad({-2., -2., 0.}, {0., -2., 0.}, {-2., 2., 0.}, {0., 2., 0.});
+    const auto right_plane = MakeQuad({0., -2., 0.}, {2., -2., 0.}, {0., 2., 0.}, {2., 2., 0.});
+    auto [hole, h_] = i_ent::MakeCurveOnAParametricSurface(
+            right_plane, i_ent::MakeCircle(Vector2d{0.5, 0.5}, 0.25));
+    auto right = std::make_shared<i_ent::TrimmedSurface>(right_plane, nullptr);
+    right->AddInnerBoundary(hole);
+
+    WatertightMeshParams params;
+    params.tolerance.chord_height = 1e-3;
+    const Faces faces{left, right};
+    const auto mesh = i_ent::TessellateWatertight(faces, params);
+
+    ExpectValidMesh(mesh);
+    ExpectGroupsCoverFaces(mesh, faces.size());
+    for (const auto& [edge, used] : EdgeUseCount(mesh)) {
+        ASSERT_LE(used, 2);
+        if (used == 2) continue;
+        // 境界辺は外周または穴の上にある
+        const Vector3d m = 0.5 * (PositionOf(mesh, edge.first) + PositionOf(mesh, edge.second));
+        const bool on_outer = std::abs(std::abs(m.x()) - 2.) < 1e-5 ||
+                              std::abs(std::abs(m.y()) - 2.) < 1e-5;
+        // 穴はuv空間の円 (空間上は半径0.5×1の楕円)
+        const bool on_hole = std::hypot((m.x() - 1.) / 0.5, m.y()) < 1. + 1e-4;
+        EXPECT_TRUE(on_outer || on_hole) << m.transpose();
+    }
+}
+
+// 一方の面の辺の途中に他方の2つの面の角が接する (T字): 辺が分割されて共有される
+TEST(WatertightMeshTest, SplitsEdgeAtTJunction) {
+    const Faces faces{
+        MakeQuad({-2., -2., 0.}, {0., -2., 0.}, {-2., 2., 0.}, {0., 2., 0.}),
+        MakeQuad({0., -2., 0.}, {2., -2., 0.}, {0., 0., 0.}, {2., 0., 0.}),
+        MakeQuad({0., 0., 0.}, {2., 0., 0.}, {0., 2., 0.}, {2., 2., 0.})};
+    const auto mesh = i_ent::TessellateWatertight(faces);
+
+    ExpectValidMesh(mesh);
+    ExpectGroupsCoverFaces(mesh, faces.size());
+    int boundary = 0;
+    for (const auto& [edge, used] : EdgeUseCount(mesh)) {
+        ASSERT_LE(used, 2);
+        if (used == 2) continue;
+        ++boundary;
+        const Vector3d m = 0.5 * (PositionOf(mesh, edge.first) + PositionOf(mesh, edge.second));
+        EXPECT_TRUE(std::abs(std::abs(m.x()) - 2.) < 1e-9 ||
+                    std::abs(std::abs(m.y()) - 2.) < 1e-9) << m.transpose();
+    }
+    EXPECT_GT(boundary, 0);
+}
+
+
+
+/**
+ * 引数
+ */
+
+// 空の入力・nullptrの面・不正なパラメータ
+TEST(WatertightMeshTest, EmptyAndInvalidInput) {
+    const auto empty = i_ent::TessellateWatertight({});
+    EXPECT_EQ(empty.VertexCount(), 0u);
+    EXPECT_EQ(empty.TriangleCount(), 0u);
+
+    const auto with_null = i_ent::TessellateWatertight({nullptr, MakeDisk(0.0)});
+    ASSERT_EQ(with_null.groups.size(), 2u);
+    EXPECT_EQ(with_null.groups[0].triangle_count, 0u);
+    EXPECT_GT(with_null.groups[1].triangle_count, 0u);
+
+    WatertightMeshParams params;
+    params.merge_tolerance = 0.0;
+    EXPECT_THROW(i_ent::TessellateWatertight({MakeDisk(0.0)}, params),
+                 std::invalid_argument);
+    params = {};
+    params.max_depth = -1;
+    EXPECT_THROW(i_ent::TessellateWatertight({MakeDisk(0.0)}, params),
+                 std::invalid_argument);
+}
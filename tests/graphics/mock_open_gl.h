@@ -39,6 +39,10 @@ class MockOpenGL : public IOpenGL {
     int draw_arrays_calls = 0;
     /// @brief DrawElementsの呼び出し回数
     int draw_elements_calls = 0;
+    /// @brief DrawElementsに渡されたインデックス数の列 (LODの観測用)
+    std::vector<gl::Sizei> draw_elements_counts;
+    /// @brief 直近のDrawElementsに渡されたインデックスの型
+    gl::Enum last_draw_elements_type = 0;
     /// @brief GenVertexArraysの呼び出し回数 (描画オブジェクト生成の観測用)
     int gen_vertex_arrays_calls = 0;
     /// @brief DeleteVertexArraysの呼び出し回数 (Sweep等のGPU資源解放の観測用)
@@ -204,8 +208,11 @@ class MockOpenGL : public IOpenGL {
     void BlendFunc(gl::Enum, gl::Enum) override {}
     void Clear(gl::Bitfield) override {}
     void ClearColor(gl::Float, gl::Float, gl::Float, gl::Float) override {}
-    void DrawElements(gl::Enum, gl::Sizei, gl::Enum, const void*) override {
+    void DrawElements(gl::Enum, gl::Sizei count, gl::Enum type,
+                      const void*) override {
         ++draw_elements_calls;
+        draw_elements_counts.push_back(count);
+        last_draw_elements_type = type;
     }
     void Viewport(gl::Int, gl::Int, gl::Sizei, gl::Sizei) override {}
     void GetIntegerv(gl::Enum pname, gl::Int* data) override {
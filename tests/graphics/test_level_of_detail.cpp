@@ -0,0 +1,307 @@
+/**
+ * @file tests/graphics/test_level_of_detail.cpp
+ * @brief 面メッシュの詳細度 (LOD) の構築・選択と、描画クラスでの切り替えのテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * テスト対象:
+ *   igesio::graphics::AppendLodLevel / EstimateProjectedSize / SelectLodLevel
+ *   - 正常系 (代表値): レベルの連結 (頂点番号のオフセット)・外接球
+ *   - 正常系 (退化): 三角形数が減らないレベルを直前のレベルへ統合すること
+ *   - 正常系 (代表値): 画面上の大きさが距離に反比例すること
+ *   - 正常系 (境界値): ヒステリシスにより、許容量の境界付近の往復で
+ *     レベルが切り替わらないこと
+ *   RestrictedSurfaceGraphics::SelectLevelOfDetail / EntityRenderer::Draw
+ *   - 遠方から見た場合に、DrawElementsのインデックス数が減ること
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "mock_open_gl.h"
+
+#include "igesio/common/errors.h"
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/entities/surfaces/trimmed_surface.h"
+#include "igesio/models/assembly.h"
+#include "igesio/models/scene.h"
+#include "igesio/graphics/core/camera.h"
+#include "igesio/graphics/core/draw_context.h"
+#include "igesio/graphics/core/level_of_detail.h"
+#include "igesio/graphics/factory.h"
+#include "igesio/graphics/renderer.h"
+
+#include "../entities/surfaces/surfaces_for_testing.h"
+#include "../numerics/meshes_for_testing.h"
+
+
+
+namespace {
+
+namespace i_graph = igesio::graphics;
+namespace i_ent = igesio::entities;
+namespace i_mod = igesio::models;
+namespace i_num = igesio::numerics;
+namespace i_test = igesio::tests;
+using i_graph::test::MockOpenGL;
+using i_graph::ShaderId;
+using igesio::Matrix4d;
+using igesio::Vector3d;
+using igesio::Vector3f;
+
+/// @brief xy平面上の矩形 [0, w] x [0, h] を、n x n 分割した格子メッシュを作成する
+i_num::TriangleMeshf MakeGrid(const float w, const float h, const int n) {
+    return i_test::MakeGridMesh<float>(n, [w, h, n](const int i, const int j) {
+        return Vector3d(w * i / n, h * j / n, 0.0);
+    });
+}
+
+/// @brief 原点を注視するカメラのビューを作成する
+/// @param distance 視点の原点からの距離 (z軸上)
+/// @param viewport_height [px] ビューポートの高さ
+i_graph::LodView MakeView(const float distance, const float viewport_height) {
+    const i_graph::Camera camera(Vector3f(0.0f, 0.0f, distance),
+                                 Vector3f(0.0f, 0.0f, 0.0f),
+                                 Vector3f(0.0f, 1.0f, 0.0f));
+    i_graph::LodView view;
+    view.view = camera.GetViewMatrix();
+    view.projection = camera.GetProjectionMatrix(1.0f);
+    view.viewport_height = viewport_height;
+    return view;
+}
+
+/// @brief 相対誤差が4倍ずつ粗くなる3レベル
+std::vector<i_graph::LodLevel> MakeLevels() {
+    return {{0, 600, 0.001}, {600, 150, 0.004}, {750, 36, 0.016}};
+}
+
+/// @brief 未トリムのTrimmedSurface (フリーフォームNURBS基底) を生成する
+std::shared_ptr<i_ent::TrimmedSurface> MakeUntrimmedSurface() {
+    auto base = i_test::CreateRationalBSplineSurfaces()[1].surface;  // freeform
+    return i_ent::MakeTrimmedSurface(base, nullptr, {});
+}
+
+}  // namespace
+
+
+
+/**
+ * AppendLodLevel
+ */
+
+// 2つ目以降のレベルは、頂点番号を先行レベルの頂点数だけずらして連結する
+TEST(AppendLodLevel, ConcatenatesLevelsWithVertexOffset) {
+    const auto fine = MakeGrid(4.0f, 2.0f, 4);
+    const auto coarse = MakeGrid(4.0f, 2.0f, 1);
+    i_graph::LodMeshStaging staging;
+
+    i_graph::AppendLodLevel(staging, fine, 0.001);
+    i_graph::AppendLodLevel(staging, coarse, 0.004);
+
+    ASSERT_EQ(staging.levels.size(), 2u);
+    EXPECT_EQ(staging.levels[0].index_offset, 0u);
+    EXPECT_EQ(staging.levels[0].index_count, fine.indices.size());
+    EXPECT_EQ(staging.levels[1].index_offset, fine.indices.size());
+    EXPECT_EQ(staging.levels[1].index_count, coarse.indices.size());
+    EXPECT_DOUBLE_EQ(staging.levels[1].relative_error, 0.004);
+
+    // 各レベルは描画向けに並べ替えられるが、自身の頂点のみを参照する
+    const std::size_t n_fine = fine.VertexCount();
+    const std::size_t n_total = n_fine + coarse.VertexCount();
+    EXPECT_EQ(staging.vertices.size(), n_total * 8);
+    for (std::size_t k = 0; k < staging.indices.size(); ++k) {
+        const bool is_fine = k < fine.indices.size();
+        EXPECT_EQ(staging.indices[k] < n_fine, is_fine) << "index " << k;
+        EXPECT_LT(staging.indices[k], n_total);
+    }
+
+    // 外接球は最初のレベルの軸平行BBから求める
+    EXPECT_TRUE(staging.center.isApprox(Vector3d(2.0, 1.0, 0.0)));
+    EXPECT_NEAR(staging.radius, 0.5 * std::sqrt(20.0), 1e-9);
+}
+
+// 三角形数が減らないレベルは追加せず、直前のレベルの相対誤差を引き上げる
+TEST(AppendLodLevel, MergesLevelWithoutReduction) {
+    const auto mesh = MakeGrid(1.0f, 1.0f, 2);
+    i_graph::LodMeshStaging staging;
+
+    i_graph::AppendLodLevel(staging, mesh, 0.001);
+    i_graph::AppendLodLevel(staging, mesh, 0.004);
+
+    ASSERT_EQ(staging.levels.size(), 1u);
+    EXPECT_DOUBLE_EQ(staging.levels[0].relative_error, 0.004);
+    EXPECT_EQ(staging.indices.size(), mesh.indices.size());
+    EXPECT_EQ(staging.vertices.size(), mesh.VertexCount() * 8);
+}
+
+
+
+/**
+ * EstimateProjectedSize
+ */
+
+// 透視投影では画面上の大きさは距離に反比例し、ビューポートの高さに比例する
+TEST(EstimateProjectedSize, ScalesWithDistanceAndViewport) {
+    const Matrix4d identity = Matrix4d::Identity();
+    const Vector3d center = Vector3d::Zero();
+
+    const double near = i_graph::EstimateProjectedSize(
+            MakeView(100.0f, 600.0f), identity, center, 1.0);
+    const double far = i_graph::EstimateProjectedSize(
+            MakeView(200.0f, 600.0f), identity, center, 1.0);
+    const double tall = i_graph::EstimateProjectedSize(
+            MakeView(100.0f, 1200.0f), identity, center, 1.0);
+    EXPECT_GT(near, 0.0);
+    EXPECT_NEAR(near / far, 2.0, 1e-4);
+    EXPECT_NEAR(tall / near, 2.0, 1e-4);
+
+    // 変換行列の拡大率を半径に反映する
+    Matrix4d scaled = identity;
+    scaled.topLeftCorner<3, 3>() *= 3.0;
+    EXPECT_NEAR(i_graph::EstimateProjectedSize(
+            MakeView(100.0f, 600.0f), scaled, center, 1.0) / near, 3.0, 1e-4);
+
+    // 視点が外接球の内側にある場合は無限大 (最も細かいレベルを選ばせる)
+    EXPECT_EQ(i_graph::EstimateProjectedSize(
+                      MakeView(0.5f, 600.0f), identity, center, 1.0),
+              std::numeric_limits<double>::infinity());
+}
+
+
+
+/**
+ * SelectLodLevel
+ */
+
+// 画面上の誤差が許容量以下の最も粗いレベルを選ぶ
+TEST(SelectLodLevel, PicksCoarsestLevelWithinScreenError) {
+    const auto levels = MakeLevels();
+    i_graph::LodSelectionParams params;
+    params.hysteresis = 0.0;
+
+    EXPECT_EQ(i_graph::SelectLodLevel(levels, 50.0, 0, params), 2u);
+    EXPECT_EQ(i_graph::SelectLodLevel(levels, 200.0, 0, params), 1u);
+    EXPECT_EQ(i_graph::SelectLodLevel(levels, 800.0, 2, params), 0u);
+    // 最も細かいレベルでも許容量を超える場合は最も細かいレベル
+    EXPECT_EQ(i_graph::SelectLodLevel(levels, 1e6, 2, params), 0u);
+}
+
+// 境界 (レベル1の誤差が1pxとなる250px) 付近を往復してもレベルが切り替わらない
+TEST(SelectLodLevel, HysteresisPreventsPopping) {
+    const auto levels = MakeLevels();
+    const i_graph::LodSelectionParams params;  // 許容量1px, ヒステリシス0.25
+
+    // 細かいレベルからは、誤差が1/1.25px以下となるまで粗くしない
+    std::size_t current = 0;
+    for (const double size : {260.0, 240.0, 260.0, 240.0}) {
+        current = i_graph::SelectLodLevel(levels, size, current, params);
+        EXPECT_EQ(current, 0u) << "size " << size;
+    }
+    current = i_graph::SelectLodLevel(levels, 190.0, current, params);
+    EXPECT_EQ(current, 1u);
+
+    // 粗いレベルからは、誤差が1.25pxを超えるまで細かくしない
+    for (const double size : {240.0, 260.0, 240.0, 300.0}) {
+        current = i_graph::SelectLodLevel(levels, size, current, params);
+        EXPECT_EQ(current, 1u) << "size " << size;
+    }
+    current = i_graph::SelectLodLevel(levels, 320.0, current, params);
+    EXPECT_EQ(current, 0u);
+}
+
+// 無効・空・大きさが不明な場合は最も細かいレベル
+TEST(SelectLodLevel, FallsBackToFinestLevel) {
+    const auto levels = MakeLevels();
+    i_graph::LodSelectionParams disabled;
+    disabled.enabled = false;
+
+    EXPECT_EQ(i_graph::SelectLodLevel(levels, 1.0, 2, disabled), 0u);
+    EXPECT_EQ(i_graph::SelectLodLevel({}, 1.0, 0), 0u);
+    EXPECT_EQ(i_graph::SelectLodLevel(
+            levels, std::numeric_limits<double>::infinity(), 2), 0u);
+}
+
+
+
+/**
+ * 描画クラス・レンダラ
+ */
+
+// 遠方から見た場合は粗いレベルのインデックス範囲のみを描く
+TEST(SurfaceLevelOfDetail, FarViewDrawsFewerIndices) {
+    auto gl = std::make_shared<MockOpenGL>();
+    auto graphics = i_graph::CreateEntityGraphics(MakeUntrimmedSurface(), gl);
+    ASSERT_NE(graphics, nullptr);
+    const i_graph::DrawContext ctx{};
+    const std::pair<float, float> vp{800.0f, 600.0f};
+
+    // 選択前は最も細かいレベル
+    graphics->Draw(1u, ShaderId::kGeneralSurface, vp, ctx);
+    ASSERT_FALSE(gl->draw_elements_counts.empty());
+    const auto finest = gl->draw_elements_counts.back();
+
+    // 遠方 (画面上で数px) では最も粗いレベル
+    graphics->SelectLevelOfDetail(MakeView(1e5f, 600.0f));
+    graphics->Draw(1u, ShaderId::kGeneralSurface, vp, ctx);
+    const auto coarse = gl->draw_elements_counts.back();
+    EXPECT_LT(coarse, finest);
+    EXPECT_GT(coarse, 0);
+    EXPECT_EQ(coarse % 3, 0);
+
+    // 画面上で十分大きければ最も細かいレベルへ戻る
+    graphics->SelectLevelOfDetail(MakeView(1e5f, 1e9f));
+    graphics->Draw(1u, ShaderId::kGeneralSurface, vp, ctx);
+    EXPECT_EQ(gl->draw_elements_counts.back(), finest);
+
+    // LODを無効にすると常に最も細かいレベル
+    auto view = MakeView(1e5f, 600.0f);
+    view.params.enabled = false;
+    graphics->SelectLevelOfDetail(view);
+    graphics->Draw(1u, ShaderId::kGeneralSurface, vp, ctx);
+    EXPECT_EQ(gl->draw_elements_counts.back(), finest);
+}
+
+// レンダラはDraw毎にカメラからレベルを選択する (要Initialize・失敗時はskip)
+TEST(SurfaceLevelOfDetail, RendererSelectsLevelFromCamera) {
+    auto gl = std::make_shared<MockOpenGL>();
+    i_graph::EntityRenderer renderer(gl);
+    try {
+        renderer.Initialize();
+    } catch (const igesio::ImplementationError& e) {
+        GTEST_SKIP() << "シェーダー初期化不可 (GLSL未解決の可能性): " << e.what();
+    }
+
+    auto root = i_mod::MakeAssembly();
+    root->AddEntity(MakeUntrimmedSurface());
+    i_mod::Scene scene(root);
+    renderer.SetScene(&scene);
+    renderer.SetDisplayMode(i_graph::DisplayMode::kNoEdge);
+
+    const auto draw = [&]() {
+        gl->draw_elements_counts.clear();
+        renderer.Draw();
+        long long total = 0;
+        for (const auto count : gl->draw_elements_counts) total += count;
+        return total;
+    };
+
+    // 全体表示では最も細かいレベルに近く、遠方では粗いレベルを描く
+    renderer.FitView();
+    const auto fitted = draw();
+    ASSERT_GT(fitted, 0);
+    const auto& camera = renderer.Camera();
+    const Vector3f dir = camera.GetPosition() - camera.GetTarget();
+    renderer.Camera().SetPosition(camera.GetTarget() + 1e4f * dir);
+    EXPECT_LT(draw(), fitted);
+
+    // LODを無効にすると遠方でも最も細かいレベル
+    auto settings = renderer.Settings();
+    settings.lod.enabled = false;
+    renderer.SetSettings(settings);
+    EXPECT_GE(draw(), fitted);
+}
@@ -11,12 +11,16 @@
  *     {x, y, z, nx, ny, nz, u, v} が正しいこと (float / double両方)
  *   - 正常系 (境界値): 空メッシュで空の列が返ること
  *   - 正常系 (退化): 法線・UVチャンネルが無い場合にゼロ埋めされること
+ *   igesio::graphics::PackIndices()
+ *   - 正常系 (境界値): 頂点数65535までは16ビット、65536以上は32ビットとなること
  *
  * TODO: 事前条件を持たない純粋関数のためエラー系は対象外
  *       (チャンネル列数不整合の検査はnumerics::Validateの責務)。
  */
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <cstring>
 #include <vector>
 
 #include "igesio/numerics/meshes/triangle_mesh.h"
@@ -132,3 +136,37 @@ TEST(BuildInterleavedVertices, MissingChannels_ZeroFilled) {
         EXPECT_NEAR(v[k], 0.0f, kTol) << "slot " << k;
     }
 }
+
+
+
+/**
+ * PackIndices
+ */
+
+// 頂点数が16ビットに収まる場合は16ビット、収まらない場合は32ビットで詰める
+TEST(PackIndices, SelectsShortIndicesBelowLimit) {
+    const std::vector<std::uint32_t> indices = {0, 1, 65534, 2, 65534, 3};
+
+    const auto short_packed = i_graph::PackIndices(indices, 65535);
+    EXPECT_EQ(short_packed.type, i_graph::gl::kUnsignedShort);
+    EXPECT_EQ(short_packed.count, indices.size());
+    ASSERT_EQ(short_packed.bytes.size(), indices.size() * 2);
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        std::uint16_t value;
+        std::memcpy(&value, short_packed.bytes.data() + 2 * i, sizeof(value));
+        EXPECT_EQ(value, indices[i]);
+    }
+
+    const auto int_packed = i_graph::PackIndices(indices, 65536);
+    EXPECT_EQ(int_packed.type, i_graph::gl::kUnsignedInt);
+    ASSERT_EQ(int_packed.bytes.size(), indices.size() * 4);
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        std::uint32_t value;
+        std::memcpy(&value, int_packed.bytes.data() + 4 * i, sizeof(value));
+        EXPECT_EQ(value, indices[i]);
+    }
+
+    const auto empty = i_graph::PackIndices(std::vector<std::uint32_t>{}, 0);
+    EXPECT_EQ(empty.count, 0u);
+    EXPECT_TRUE(empty.bytes.empty());
+}
@@ -10,6 +10,9 @@
  *       - ツリーから削除されたエンティティはヒットしない (旧実装のバグの回帰)
  *       - 非表示 (visible=false)・抑制 (suppressed) のエンティティはヒットしない
  *       - DisplayFilterで除外された型はヒットしない
+ *       - シーンBVHによる広域判定: 後から追加したエンティティもヒットする
+ *         (BVHの再構築)・遠方のエンティティは候補から外れる・
+ *         closest_hit_onlyで最も近いヒットのみを返す
  *
  * NOTE: レイは円弧 (中心原点・半径1・z=0平面の1/4円) 上の45°点を-Z方向に貫く
  *       固定レイを用いる. ピック前のDraw呼び出しは不要 (EnsureSyncedが
@@ -40,10 +43,11 @@ using igesio::Vector2d;
 using igesio::Vector3d;
 using i_graph::test::MockOpenGL;
 
-/// @brief ピック対象の円弧 (中心原点・半径1・z=0平面の1/4円)
-std::shared_ptr<i_ent::CircularArc> MakeArc() {
+/// @brief ピック対象の円弧 (中心原点・半径1・z=zt平面の1/4円)
+/// @param zt 円弧を置く平面のz座標
+std::shared_ptr<i_ent::CircularArc> MakeArc(const double zt = 0.0) {
     return i_ent::MakeCircularArc(
-        Vector2d(0.0, 0.0), Vector2d(1.0, 0.0), Vector2d(0.0, 1.0), 0.0);
+        Vector2d(0.0, 0.0), Vector2d(1.0, 0.0), Vector2d(0.0, 1.0), zt);
 }
 
 /// @brief 円弧上の45°点を-Z方向へ貫くレイ
@@ -139,3 +143,61 @@ TEST(PickingReconcileTest, Pick_FilteredTypeNotHit) {
     renderer.SetDisplayFilter(i_graph::DisplayFilter{});
     EXPECT_FALSE(Pick(renderer).empty());  // 解除で復帰する
 }
+
+
+
+/**
+ * シーンBVHによる広域判定
+ */
+
+// ピック後に追加したエンティティもヒットする (BVHが構造変化で再構築される).
+// レイから遠いエンティティは候補から外れ、ヒットに現れない
+TEST(PickingReconcileTest, Pick_SceneBvhFollowsStructureChange) {
+    auto gl = std::make_shared<MockOpenGL>();
+    i_graph::EntityRenderer renderer(gl);
+
+    auto root = i_mod::MakeAssembly();
+    auto far_arc = i_ent::MakeCircularArc(
+        Vector2d(100.0, 100.0), Vector2d(101.0, 100.0), Vector2d(100.0, 101.0), 0.0);
+    root->AddEntity(far_arc);
+    i_mod::Scene scene(root);
+    renderer.SetScene(&scene);
+
+    EXPECT_TRUE(Pick(renderer).empty());  // 遠方の円弧のみではヒットしない
+
+    auto arc = MakeArc();
+    root->AddEntity(arc);
+    const auto hits = Pick(renderer);
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_EQ(hits.front().id, arc->GetID());
+}
+
+// 奥行き方向に重なる円弧は全てヒットし、closest_hit_onlyでは最も近いもののみ返す
+TEST(PickingReconcileTest, Pick_ClosestHitOnlyReturnsNearest) {
+    auto gl = std::make_shared<MockOpenGL>();
+    i_graph::EntityRenderer renderer(gl);
+
+    auto root = i_mod::MakeAssembly();
+    auto back = MakeArc(-2.0);
+    auto middle = MakeArc(-1.0);
+    auto front = MakeArc(0.0);
+    root->AddEntity(back);
+    root->AddEntity(front);
+    root->AddEntity(middle);
+    i_mod::Scene scene(root);
+    renderer.SetScene(&scene);
+
+    const auto all = Pick(renderer);
+    ASSERT_EQ(all.size(), 3u);
+    EXPECT_EQ(all[0].id, front->GetID());
+    EXPECT_EQ(all[1].id, middle->GetID());
+    EXPECT_EQ(all[2].id, back->GetID());
+
+    i_graph::RayIntersectionParams params;
+    params.closest_hit_only = true;
+    const auto closest = renderer.PickEntities(
+            MakeRayThroughArc(), 640.0, 360.0, params);
+    ASSERT_EQ(closest.size(), 1u);
+    EXPECT_EQ(closest.front().id, front->GetID());
+    EXPECT_NEAR(closest.front().hit.distance, all.front().hit.distance, 1e-9);
+}
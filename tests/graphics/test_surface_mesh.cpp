@@ -12,6 +12,7 @@
  *   - ② 母線/準線の角でリングが二重化され、稜線で法線が不連続になること
  *        (ハードエッジ化)
  *   - 退行: 滑らかな曲面では二重化が起きず、満杯のメッシュが生成されること
+ *   - 許容量による適応的な格子: 曲率のある方向のみが分割され、角は維持されること
  *
  * NOTE:
  *   GL非依存の純粋関数のため、モックGLを介さず直接メッシュデータを検証する.
@@ -206,3 +207,41 @@ TEST(SurfaceMeshTest, SmoothCylinderHasNoHardEdgeAndFullMesh) {
         static_cast<std::size_t>(2 * (mesh.u_row_count - 1) * mesh.v_div);
     EXPECT_EQ(mesh.mesh.indices.size(), expected_tris * 3);
 }
+
+
+
+/**
+ * 許容量による適応的な格子
+ */
+
+// 円筒: 母線方向 (直線) は初期区間のまま、円周方向のみ弦高を満たすまで分割する
+TEST(SurfaceMeshTest, AdaptiveGridRefinesOnlyCurvedDirection_ForCylinder) {
+    auto axis = i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{0., 1., 0.});
+    auto gen = i_ent::MakeLine(Vector3d{1., 0., 0.}, Vector3d{1., 2., 0.});
+    auto surf = i_ent::MakeSurfaceOfRevolution(axis, gen, 0., 2. * kPi);
+    i_ent::TessellationTolerance tol;
+    tol.chord_height = 0.01;
+
+    const auto mesh = i_graph::BuildGeneralSurfaceMesh(*surf, tol);
+    EXPECT_EQ(mesh.u_row_count, i_ent::kAdaptiveInitialIntervals + 1);
+    // 各初期区間 (π/2) を8等分: 弦高 1-cos(π/32) ≈ 0.0048 <= 0.01
+    EXPECT_EQ(mesh.v_div, 32);
+    EXPECT_EQ(CountHardEdgePairs(mesh), 0);
+    const std::size_t expected_tris =
+        static_cast<std::size_t>(2 * (mesh.u_row_count - 1) * mesh.v_div);
+    EXPECT_EQ(mesh.mesh.indices.size(), expected_tris * 3);
+}
+
+// 段付きSoR: 適応的な格子でも角のハードエッジが維持される
+TEST(SurfaceMeshTest, AdaptiveGridKeepsHardEdge_ForSteppedSoR) {
+    auto axis = i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{0., 1., 0.});
+    auto gen = i_ent::MakeLinearPath(std::vector<Vector3d>{
+        Vector3d{1., 0., 0.}, Vector3d{1., 2., 0.},
+        Vector3d{2., 2., 0.}, Vector3d{2., 4., 0.}});
+    auto surf = i_ent::MakeSurfaceOfRevolution(axis, gen, 0., 2. * kPi);
+
+    const auto mesh = i_graph::BuildGeneralSurfaceMesh(
+            *surf, i_graph::GetDisplayTessellationTolerance(*surf));
+    EXPECT_GT(mesh.u_row_count, i_ent::kAdaptiveInitialIntervals + 1);
+    EXPECT_GT(CountHardEdgePairs(mesh), 0);
+}
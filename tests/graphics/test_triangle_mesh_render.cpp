@@ -99,6 +99,8 @@ TEST(TriangleMeshRenderTest, RendererDrawsMeshEntity) {
 
     renderer.Draw();
     EXPECT_GT(gl->draw_elements_calls, 0);
+    // 頂点数が16ビットに収まるため16ビットのインデックスで描画する
+    EXPECT_EQ(gl->last_draw_elements_type, i_graph::gl::kUnsignedShort);
 }
 
 // 法線なしメッシュも描画できる (PrewarmCpuが面積重み平均で補う)
@@ -0,0 +1,75 @@
+/**
+ * @file tests/models/models_for_testing.h
+ * @brief models配下のテストで使用する変換行列・Assemblyの定義
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#ifndef IGESIO_TESTS_MODELS_MODELS_FOR_TESTING_H_
+#define IGESIO_TESTS_MODELS_MODELS_FOR_TESTING_H_
+
+#include <memory>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/models/assembly.h"
+#include "../entities/surfaces/surfaces_for_testing.h"
+
+namespace igesio::tests {
+
+/// @brief 並進のみの同次変換行列を生成する
+inline Matrix4d MakeTranslation(const Vector3d& t) {
+    Matrix4d m = Matrix4d::Identity();
+    m.topRightCorner<3, 1>() = t;
+    return m;
+}
+
+/// @brief 回転 R(angle, axis) と並進 t からなる同次変換行列を生成する
+/// @param angle 回転角度 [rad] (0なら回転は単位行列)
+/// @param axis 回転軸 (正規化前で可。ゼロベクトル不可)
+/// @param t 並進ベクトル
+inline Matrix4d MakeTransform(const double angle, const Vector3d& axis,
+                              const Vector3d& t) {
+    Matrix4d m = Matrix4d::Identity();
+    if (angle != 0.0) {
+        m.topLeftCorner<3, 3>() = AngleAxisd(angle, axis.normalized()).toRotationMatrix();
+    }
+    m.topRightCorner<3, 1>() = t;
+    return m;
+}
+
+/// @brief 空間検索 (レイキャスト・クリアランス等) のテスト用のシーン
+/// @note ルート: y=5の平面 (plane) と y=3 のx方向の線分 (line).
+///       子Assembly (z方向に並進): 任意のエンティティ (child)
+struct TestScene {
+    /// @brief ルートAssembly
+    std::shared_ptr<models::Assembly> root;
+    /// @brief y=5の平面 (MakeYFivePlane) のID
+    ObjectID plane;
+    /// @brief 線分 (-1,3,0)-(1,3,0) のID
+    ObjectID line;
+    /// @brief 子Assemblyに追加したエンティティのID
+    ObjectID child;
+};
+
+/// @brief テスト用のシーンを生成する
+/// @param child_entity 子Assemblyに追加するエンティティ
+/// @param child_z 子Assemblyのz方向の並進量
+template <typename T>
+TestScene MakeTestScene(const std::shared_ptr<T>& child_entity, const double child_z) {
+    TestScene scene;
+    scene.root = models::MakeAssembly("root");
+    scene.plane = scene.root->AddEntity(MakeYFivePlane());
+    scene.line = scene.root->AddEntity(
+            entities::MakeLine(Vector3d{-1., 3., 0.}, Vector3d{1., 3., 0.}));
+
+    auto child = models::MakeAssembly("child");
+    scene.child = child->AddEntity(child_entity);
+    child->SetGlobalTransform(MakeTranslation(Vector3d{0., 0., child_z}));
+    scene.root->AddChildAssembly(child);
+    return scene;
+}
+
+}  // namespace igesio::tests
+
+#endif  // IGESIO_TESTS_MODELS_MODELS_FOR_TESTING_H_
@@ -46,6 +46,7 @@
 #include "igesio/entities/views/surface_view.h"
 #include "igesio/models/assembly.h"
 #include "igesio/models/iges_data.h"
+#include "./models_for_testing.h"
 
 namespace {
 
@@ -53,6 +54,7 @@ namespace fs = std::filesystem;
 namespace i_ent = igesio::entities;
 namespace i_mdl = igesio::models;
 namespace i_num = igesio::numerics;
+namespace i_test = igesio::tests;
 using igesio::ObjectID;
 using igesio::Matrix4d;
 using igesio::Vector3d;
@@ -74,28 +76,6 @@ const std::string kCubePath =
         fs::path(__FILE__).parent_path().parent_path()
             .append("test_data").append("single_rounded_cube.iges").string();
 
-/// @brief 並進のみの同次変換行列を生成する
-igesio::Matrix4d MakeTranslation(const Vector3d& t) {
-    igesio::Matrix4d m = igesio::Matrix4d::Identity();
-    m.topRightCorner<3, 1>() = t;
-    return m;
-}
-
-/// @brief 回転 R(angle, axis) と並進 t からなる同次変換行列を生成する
-/// @param angle 回転角度 [rad] (0なら回転は単位行列)
-/// @param axis 回転軸 (正規化前で可。ゼロベクトル不可)
-/// @param t 並進ベクトル
-igesio::Matrix4d MakeTransform(const double angle, const Vector3d& axis,
-                               const Vector3d& t) {
-    igesio::Matrix4d m = igesio::Matrix4d::Identity();
-    if (angle != 0.0) {
-        m.topLeftCorner<3, 3>() =
-            igesio::AngleAxisd(angle, axis.normalized()).toRotationMatrix();
-    }
-    m.topRightCorner<3, 1>() = t;
-    return m;
-}
-
 /// @brief 始点・終点を持つ線分エンティティ (M_entityは単位) を生成する
 std::shared_ptr<Line> MakeLine(const Vector3d& start, const Vector3d& end) {
     return i_ent::MakeLine(start, end);
@@ -231,18 +211,18 @@ TEST_F(AssemblyCoordsTest, CoordFrame_FactoriesSetKind) {
 
 // kDefinitionは配置概念がないためnullopt
 TEST_F(AssemblyCoordsTest, ResolvePlacement_DefinitionReturnsNullopt) {
-    auto c = BuildChain(MakeTranslation({1, 2, 3}),
-                        MakeTranslation({4, 0, 0}),
-                        MakeTranslation({0, 5, 0}));
+    auto c = BuildChain(i_test::MakeTranslation({1, 2, 3}),
+                        i_test::MakeTranslation({4, 0, 0}),
+                        i_test::MakeTranslation({0, 5, 0}));
     EXPECT_FALSE(
         c.root->ResolvePlacement(c.line_id, CoordFrame::Definition()).has_value());
 }
 
 // kEntityLocalは単位行列 (M_entityのみ・Assembly非依存)
 TEST_F(AssemblyCoordsTest, ResolvePlacement_EntityLocalReturnsIdentity) {
-    auto c = BuildChain(MakeTranslation({1, 2, 3}),
-                        MakeTranslation({4, 0, 0}),
-                        MakeTranslation({0, 5, 0}));
+    auto c = BuildChain(i_test::MakeTranslation({1, 2, 3}),
+                        i_test::MakeTranslation({4, 0, 0}),
+                        i_test::MakeTranslation({0, 5, 0}));
     const auto pl = c.root->ResolvePlacement(c.line_id, CoordFrame::EntityLocal());
     ASSERT_TRUE(pl.has_value());
     EXPECT_TRUE(i_num::IsApproxEqual(*pl, kIdentity4));
@@ -250,9 +230,9 @@ TEST_F(AssemblyCoordsTest, ResolvePlacement_EntityLocalReturnsIdentity) {
 
 // kWorldはルートから所有ノードまでの大域変換の積 G_root·G_a·G_b
 TEST_F(AssemblyCoordsTest, ResolvePlacement_WorldComposesRootToOwner) {
-    const Matrix4d g_root = MakeTranslation({1, 2, 3});
-    const Matrix4d g_a = MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
-    const Matrix4d g_b = MakeTranslation({0, 5, 0});
+    const Matrix4d g_root = i_test::MakeTranslation({1, 2, 3});
+    const Matrix4d g_a = i_test::MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
+    const Matrix4d g_b = i_test::MakeTranslation({0, 5, 0});
     auto c = BuildChain(g_root, g_a, g_b);
 
     const auto pl = c.root->ResolvePlacement(c.line_id, CoordFrame::World());
@@ -264,9 +244,9 @@ TEST_F(AssemblyCoordsTest, ResolvePlacement_WorldComposesRootToOwner) {
 // RelativeTo(直近の親a): 基準aのG_aは含めず、owner(b)のG_bのみ
 TEST_F(AssemblyCoordsTest,
        ResolvePlacement_RelativeToImmediateParentExcludesBaseG) {
-    const Matrix4d g_root = MakeTranslation({1, 2, 3});
-    const Matrix4d g_a = MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
-    const Matrix4d g_b = MakeTranslation({0, 5, 0});
+    const Matrix4d g_root = i_test::MakeTranslation({1, 2, 3});
+    const Matrix4d g_a = i_test::MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
+    const Matrix4d g_b = i_test::MakeTranslation({0, 5, 0});
     auto c = BuildChain(g_root, g_a, g_b);
 
     const auto pl =
@@ -277,9 +257,9 @@ TEST_F(AssemblyCoordsTest,
 
 // RelativeTo(root): rootのG_rootは含めず、G_a·G_b
 TEST_F(AssemblyCoordsTest, ResolvePlacement_RelativeToRootExcludesRootG) {
-    const Matrix4d g_root = MakeTranslation({1, 2, 3});
-    const Matrix4d g_a = MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
-    const Matrix4d g_b = MakeTranslation({0, 5, 0});
+    const Matrix4d g_root = i_test::MakeTranslation({1, 2, 3});
+    const Matrix4d g_a = i_test::MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
+    const Matrix4d g_b = i_test::MakeTranslation({0, 5, 0});
     auto c = BuildChain(g_root, g_a, g_b);
 
     const auto pl = c.root->ResolvePlacement(
@@ -291,9 +271,9 @@ TEST_F(AssemblyCoordsTest, ResolvePlacement_RelativeToRootExcludesRootG) {
 
 // RelativeTo(自身の所有ノードb): 単位行列 (G_bも含めず即終了)
 TEST_F(AssemblyCoordsTest, ResolvePlacement_RelativeToSelfOwnerReturnsIdentity) {
-    auto c = BuildChain(MakeTranslation({1, 2, 3}),
-                        MakeTranslation({4, 0, 0}),
-                        MakeTranslation({0, 5, 0}));
+    auto c = BuildChain(i_test::MakeTranslation({1, 2, 3}),
+                        i_test::MakeTranslation({4, 0, 0}),
+                        i_test::MakeTranslation({0, 5, 0}));
     const auto pl =
         c.root->ResolvePlacement(c.line_id, CoordFrame::RelativeTo(c.b->GetID()));
     ASSERT_TRUE(pl.has_value());
@@ -302,9 +282,9 @@ TEST_F(AssemblyCoordsTest, ResolvePlacement_RelativeToSelfOwnerReturnsIdentity)
 
 // 呼び出すノード (root / 所有ノードb) によらず結果は同一 (逆引きインデックス経由)
 TEST_F(AssemblyCoordsTest, ResolvePlacement_SameResultRegardlessOfCallingNode) {
-    const Matrix4d g_root = MakeTranslation({1, 2, 3});
-    const Matrix4d g_a = MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
-    const Matrix4d g_b = MakeTranslation({0, 5, 0});
+    const Matrix4d g_root = i_test::MakeTranslation({1, 2, 3});
+    const Matrix4d g_a = i_test::MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
+    const Matrix4d g_b = i_test::MakeTranslation({0, 5, 0});
     auto c = BuildChain(g_root, g_a, g_b);
 
     const auto from_root =
@@ -345,9 +325,9 @@ TEST_F(AssemblyCoordsTest, ResolvePlacement_ThrowsWhenRelativeBaseNotAncestor) {
 
 // ビューのサンプル点がResolvePlacementおよび手計算と一致する (配線整合)
 TEST_F(AssemblyCoordsTest, GetCurveView_PointMatchesResolvedPlacement) {
-    const Matrix4d g_root = MakeTranslation({1, 2, 3});
-    const Matrix4d g_a = MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
-    const Matrix4d g_b = MakeTranslation({0, 5, 0});
+    const Matrix4d g_root = i_test::MakeTranslation({1, 2, 3});
+    const Matrix4d g_a = i_test::MakeTransform(kPiHalf, {0, 0, 1}, {4, 0, 0});
+    const Matrix4d g_b = i_test::MakeTranslation({0, 5, 0});
     auto c = BuildChain(g_root, g_a, g_b);
 
     const auto pl = c.root->ResolvePlacement(c.line_id, CoordFrame::World());
@@ -372,7 +352,7 @@ TEST_F(AssemblyCoordsTest, GetCurveView_PointMatchesResolvedPlacement) {
 TEST_F(AssemblyCoordsTest,
        GetCurveView_DerivativeAppliesRotationToVectorNotTranslation) {
     auto root = MakeAssembly();
-    const Matrix4d p = MakeTransform(kPiHalf, {0, 0, 1}, {10, 20, 30});
+    const Matrix4d p = i_test::MakeTransform(kPiHalf, {0, 0, 1}, {10, 20, 30});
     root->SetGlobalTransform(p);
     auto line = MakeLine({0, 0, 0}, {1, 0, 0});
     const auto id = root->AddEntity(line);
@@ -457,7 +437,7 @@ TEST_F(AssemblyCoordsTest, GetSurfaceView_PointMatchesResolvedPlacement) {
     ASSERT_NE(surf, nullptr);
 
     auto root = MakeAssembly();
-    root->SetGlobalTransform(MakeTransform(kPiHalf, {0, 0, 1}, {1, 2, 3}));
+    root->SetGlobalTransform(i_test::MakeTransform(kPiHalf, {0, 0, 1}, {1, 2, 3}));
     const auto id = root->AddEntity(surface);
 
     const auto pl = root->ResolvePlacement(id, CoordFrame::World());
@@ -532,7 +512,7 @@ TEST_F(AssemblyCoordsTest,
        GetWorldBoundingBox_NestedChildAppliesGlobalTransform) {
     auto root = MakeAssembly();
     auto child = MakeAssembly();
-    child->SetGlobalTransform(MakeTranslation({10, 0, 0}));
+    child->SetGlobalTransform(i_test::MakeTranslation({10, 0, 0}));
     child->AddEntity(MakeLine({0, 0, 0}, {1, 1, 1}));
     root->AddChildAssembly(child);
 
@@ -0,0 +1,142 @@
+/**
+ * @file tests/models/test_clearance.cpp
+ * @brief models/clearance.hのテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * テスト対象:
+ *   - ComputeClearances: 全ての組の距離順の列挙、子Assemblyの大域変換、
+ *                        max_distanceによる除外、skip_same_assembly、
+ *                        判定対象の絞り込み、トリム面の穴、不正な引数
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/models/assembly.h"
+#include "igesio/models/clearance.h"
+#include "./models_for_testing.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_test = igesio::tests;
+namespace i_mdl = igesio::models;
+using igesio::ObjectID;
+using igesio::Vector3d;
+using i_mdl::ClearanceParams;
+using i_mdl::ClearanceResult;
+using i_mdl::ComputeClearances;
+
+/// @brief 距離の比較の許容誤差
+constexpr double kTol = 1e-6;
+
+/// @brief 結果が {a, b} の組 (順不同) であるかを判定する
+/// @note 組の中の順序はAssemblyの列挙順に依存するため、順序を問わずに比較する
+bool IsPair(const ClearanceResult& result, const ObjectID& a, const ObjectID& b) {
+    return (result.id_a == a && result.id_b == b) ||
+           (result.id_a == b && result.id_b == a);
+}
+
+/// @brief 結果のうち、指定IDのエンティティ側の最近点を取得する
+Vector3d PointOf(const ClearanceResult& result, const ObjectID& id) {
+    return result.id_a == id ? result.point_a : result.point_b;
+}
+
+/// @brief テスト用のシーンを生成する
+/// @note 子Assembly (z方向に+20並進): lineと同じ線分 (child; ワールドではz=20)
+i_test::TestScene MakeScene() {
+    return i_test::MakeTestScene(
+            i_ent::MakeLine(Vector3d{-1., 3., 0.}, Vector3d{1., 3., 0.}), 20.0);
+}
+
+}  // namespace
+
+
+
+/**
+ * ComputeClearances
+ */
+
+// 全ての組を距離の昇順に返す (子Assemblyの大域変換を反映する)
+TEST(ClearanceTest, AllPairsSortedByDistance) {
+    const auto scene = MakeScene();
+    const auto results = ComputeClearances(*scene.root);
+
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_TRUE(IsPair(results[0], scene.plane, scene.line));
+    EXPECT_NEAR(results[0].distance, 2.0, kTol);
+    EXPECT_NEAR(PointOf(results[0], scene.plane).y(), 5.0, kTol);
+    EXPECT_NEAR(PointOf(results[0], scene.line).y(), 3.0, kTol);
+
+    // 平面の端 (z=5) と、z=20の線分
+    EXPECT_TRUE(IsPair(results[1], scene.plane, scene.child));
+    EXPECT_NEAR(results[1].distance, std::sqrt(4.0 + 225.0), kTol);
+    EXPECT_NEAR(PointOf(results[1], scene.child).z(), 20.0, kTol);
+
+    EXPECT_TRUE(IsPair(results[2], scene.line, scene.child));
+    EXPECT_NEAR(results[2].distance, 20.0, kTol);
+}
+
+// max_distanceより離れた組を除く
+TEST(ClearanceTest, MaxDistanceFiltersPairs) {
+    const auto scene = MakeScene();
+    ClearanceParams params;
+    params.max_distance = 5.0;
+    const auto results = ComputeClearances(*scene.root, params);
+
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(IsPair(results[0], scene.plane, scene.line));
+    EXPECT_NEAR(results[0].distance, 2.0, kTol);
+
+    params.max_distance = 1.0;
+    EXPECT_TRUE(ComputeClearances(*scene.root, params).empty());
+}
+
+// 同じAssembly内の組の除外・判定対象の絞り込み
+TEST(ClearanceTest, ParamsFilterPairs) {
+    const auto scene = MakeScene();
+    ClearanceParams params;
+    params.skip_same_assembly = true;
+    const auto between = ComputeClearances(*scene.root, params);
+    ASSERT_EQ(between.size(), 2u);
+    EXPECT_TRUE(IsPair(between[0], scene.plane, scene.child));
+    EXPECT_TRUE(IsPair(between[1], scene.line, scene.child));
+
+    params.skip_same_assembly = false;
+    params.include_surfaces = false;
+    const auto curves = ComputeClearances(*scene.root, params);
+    ASSERT_EQ(curves.size(), 1u);
+    EXPECT_TRUE(IsPair(curves[0], scene.line, scene.child));
+}
+
+// 子Assemblyのトリム面の穴を通る線分: 穴の境界までの距離
+TEST(ClearanceTest, SegmentThroughTrimmedHoleInChildAssembly) {
+    auto root = i_mdl::MakeAssembly("root");
+    const auto seg = root->AddEntity(
+            i_ent::MakeLine(Vector3d{0., 0., 0.}, Vector3d{0., 30., 0.}));
+    auto child = i_mdl::MakeAssembly("child");
+    const auto trimmed = child->AddEntity(i_test::MakeTrimmedPlaneWithHole());
+    child->SetGlobalTransform(i_test::MakeTranslation(Vector3d{0., 10., 0.}));
+    root->AddChildAssembly(child);
+
+    const auto results = ComputeClearances(*root);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(IsPair(results[0], seg, trimmed));
+    EXPECT_NEAR(results[0].distance, 1.0, kTol);
+    EXPECT_NEAR(PointOf(results[0], trimmed).y(), 15.0, kTol);
+}
+
+// max_distanceが負の場合は例外
+TEST(ClearanceTest, ThrowsForNegativeMaxDistance) {
+    const auto scene = MakeScene();
+    ClearanceParams params;
+    params.max_distance = -1.0;
+    EXPECT_THROW(ComputeClearances(*scene.root, params), std::invalid_argument);
+}
@@ -36,6 +36,7 @@
 #include "igesio/models/assembly.h"
 #include "igesio/models/iges_data.h"
 #include "igesio/models/flatten.h"
+#include "./models_for_testing.h"
 
 namespace {
 
@@ -43,6 +44,7 @@ namespace fs = std::filesystem;
 namespace i_ent = igesio::entities;
 namespace i_mdl = igesio::models;
 namespace i_num = igesio::numerics;
+namespace i_test = igesio::tests;
 using igesio::ObjectID;
 using igesio::Matrix3d;
 using igesio::Matrix4d;
@@ -57,25 +59,6 @@ constexpr double kTol = 1e-9;
 /// @brief π/2 (回転角に使用)
 constexpr double kPiHalf = 1.57079632679489661923;
 
-/// @brief 並進のみの同次変換行列を生成する
-igesio::Matrix4d MakeTranslation(const Vector3d& t) {
-    igesio::Matrix4d m = igesio::Matrix4d::Identity();
-    m.topRightCorner<3, 1>() = t;
-    return m;
-}
-
-/// @brief 回転 R(angle, axis) と並進 t からなる同次変換行列を生成する
-igesio::Matrix4d MakeTransform(const double angle, const Vector3d& axis,
-                               const Vector3d& t) {
-    igesio::Matrix4d m = igesio::Matrix4d::Identity();
-    if (angle != 0.0) {
-        m.topLeftCorner<3, 3>() =
-            igesio::AngleAxisd(angle, axis.normalized()).toRotationMatrix();
-    }
-    m.topRightCorner<3, 1>() = t;
-    return m;
-}
-
 /// @brief 始点・終点を持つ線分エンティティ (M_entityは単位) を生成する
 std::shared_ptr<Line> MakeLine(const Vector3d& start, const Vector3d& end) {
     return i_ent::MakeLine(start, end);
@@ -123,7 +106,7 @@ TEST(MaterializeTest, IdentityPlacementKeepsTransformNull) {
 // 並進配置: 新124を生成し、畳み込み後の変換と点が配置適用と一致する
 TEST(MaterializeTest, FoldsTranslationIntoNew124) {
     auto line = MakeLine({0, 0, 0}, {1, 0, 0});  // M_entity単位
-    const Matrix4d p = MakeTranslation({1, 2, 3});
+    const Matrix4d p = i_test::MakeTranslation({1, 2, 3});
     const auto res = i_mdl::Materialize(*line, p);
 
     ASSERT_NE(res.transform, nullptr);
@@ -152,7 +135,7 @@ TEST(MaterializeTest, ComposesWithExistingMEntity) {
             i_ent::MakeTransformationMatrix(r, t_ent)));
     const Matrix4d m_entity = line->GetTransformationMatrix().GetTransformation();
 
-    const Matrix4d p = MakeTranslation({0, 10, 0});
+    const Matrix4d p = i_test::MakeTranslation({0, 10, 0});
     const auto res = i_mdl::Materialize(*line, p);
     ASSERT_NE(res.transform, nullptr);
 
@@ -174,7 +157,7 @@ TEST(MaterializeTest, ComposesWithExistingMEntity) {
 // 回転配置: 接線は回転のみ適用され並進は乗らない
 TEST(MaterializeTest, RotationAppliesToVectorNotTranslation) {
     auto line = MakeLine({0, 0, 0}, {1, 0, 0});
-    const Matrix4d p = MakeTransform(kPiHalf, {0, 0, 1}, {10, 20, 30});
+    const Matrix4d p = i_test::MakeTransform(kPiHalf, {0, 0, 1}, {10, 20, 30});
     const auto res = i_mdl::Materialize(*line, p);
 
     auto clone = std::dynamic_pointer_cast<const i_ent::ICurve>(res.entity);
@@ -198,7 +181,7 @@ TEST(MaterializeTest, RotationAppliesToVectorNotTranslation) {
 TEST(FlattenTest, ProducesFlatTreeWithoutChildAssemblies) {
     i_mdl::IgesData src;
     auto child = MakeAssembly();
-    child->SetGlobalTransform(MakeTranslation({10, 0, 0}));
+    child->SetGlobalTransform(i_test::MakeTranslation({10, 0, 0}));
     child->AddEntity(MakeLine({0, 0, 0}, {1, 0, 0}));
     src.Root().AddChildAssembly(child);
 
@@ -221,7 +204,7 @@ TEST(FlattenTest, CopiesDescription) {
 TEST(FlattenTest, FoldedWorldPointMatchesAssemblyView) {
     i_mdl::IgesData src;
     auto child = MakeAssembly();
-    child->SetGlobalTransform(MakeTransform(kPiHalf, {0, 0, 1}, {1, 2, 3}));
+    child->SetGlobalTransform(i_test::MakeTransform(kPiHalf, {0, 0, 1}, {1, 2, 3}));
     auto line = MakeLine({0, 0, 0}, {1, 0, 0});
     const auto line_id = child->AddEntity(line);
     src.Root().AddChildAssembly(child);
@@ -247,7 +230,7 @@ TEST(FlattenTest, FoldedWorldPointMatchesAssemblyView) {
 TEST(FlattenTest, EmitsGeneratedTransformAndClosure) {
     i_mdl::IgesData src;
     auto child = MakeAssembly();
-    child->SetGlobalTransform(MakeTranslation({7, 0, 0}));
+    child->SetGlobalTransform(i_test::MakeTranslation({7, 0, 0}));
     child->AddEntity(MakeLine({0, 0, 0}, {1, 0, 0}));
     src.Root().AddChildAssembly(child);
 
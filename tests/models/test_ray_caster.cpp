@@ -0,0 +1,241 @@
+/**
+ * @file tests/models/test_ray_caster.cpp
+ * @brief models/ray_caster.hのテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * テスト対象:
+ *   - RayCaster::CastRay: 曲線・曲面・メッシュのヒット、kFirstHit/kAllHits、
+ *                         子Assemblyの大域変換、max_distance、ゼロ方向
+ *   - RayCaster::CastRays: 各レイの結果がCastRayと一致すること
+ *   - SurfaceRayMode::kTessellated: kExactとの一致 (平面)、トリム穴の除外
+ *   - RayCasterParams: 判定対象の絞り込み
+ *
+ * TODO: 非一様スケールを含む配置での曲線の許容量は未検証
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/meshes/mesh_entity.h"
+#include "igesio/models/assembly.h"
+#include "igesio/models/ray_caster.h"
+#include "./models_for_testing.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_test = igesio::tests;
+namespace i_mdl = igesio::models;
+namespace i_num = igesio::numerics;
+using igesio::ObjectID;
+using igesio::Vector3d;
+using i_mdl::Ray;
+using i_mdl::RayCaster;
+using i_mdl::RayCasterParams;
+using i_mdl::RayCastHit;
+using i_mdl::RayCastMode;
+
+/// @brief 位置比較の許容誤差
+constexpr double kPosTol = 1e-6;
+
+/// @brief 位置が期待値と一致するか検証するヘルパー
+void ExpectPositionNear(const Vector3d& actual, const Vector3d& expected,
+                        const double tol = kPosTol) {
+    EXPECT_NEAR(actual.x(), expected.x(), tol);
+    EXPECT_NEAR(actual.y(), expected.y(), tol);
+    EXPECT_NEAR(actual.z(), expected.z(), tol);
+}
+
+/// @brief z=0平面上の正方形 [-1,1]^2 のメッシュ (4頂点・2三角形)
+std::shared_ptr<i_ent::MeshEntity> MakeSquareMesh() {
+    i_num::TriangleMeshd mesh;
+    mesh.positions.resize(3, 4);
+    mesh.positions << -1.0,  1.0, 1.0, -1.0,
+                      -1.0, -1.0, 1.0,  1.0,
+                       0.0,  0.0, 0.0,  0.0;
+    mesh.indices = {0, 1, 2, 0, 2, 3};
+    return std::make_shared<i_ent::MeshEntity>(std::move(mesh));
+}
+
+/// @brief テスト用のシーンを生成する
+/// @note 子Assembly (z方向に+10並進): z=0の正方形メッシュ (child; ワールドではz=10)
+i_test::TestScene MakeScene() {
+    return i_test::MakeTestScene(MakeSquareMesh(), 10.0);
+}
+
+}  // namespace
+
+
+
+/**
+ * CastRay
+ */
+
+// kAllHits: 線分 (距離3) と平面 (距離5) を距離順に返す
+TEST(RayCasterTest, AllHitsSortedByDistance) {
+    const auto scene = MakeScene();
+    const RayCaster caster(*scene.root);
+    EXPECT_EQ(caster.GetTargetCount(), 3u);
+    EXPECT_EQ(caster.GetRevision(), scene.root->Revision());
+
+    const auto hits = caster.CastRay(
+            Ray{Vector3d::Zero(), Vector3d::UnitY()}, RayCastMode::kAllHits);
+    ASSERT_EQ(hits.size(), 2u);
+    EXPECT_EQ(hits[0].id, scene.line);
+    EXPECT_NEAR(hits[0].distance, 3.0, kPosTol);
+    ExpectPositionNear(hits[0].position, Vector3d{0., 3., 0.});
+    EXPECT_EQ(hits[1].id, scene.plane);
+    EXPECT_NEAR(hits[1].distance, 5.0, kPosTol);
+    ExpectPositionNear(hits[1].position, Vector3d{0., 5., 0.});
+}
+
+// kFirstHit: 最も近いヒットのみを返す (方向ベクトルは正規化不要)
+TEST(RayCasterTest, FirstHitReturnsClosest) {
+    const auto scene = MakeScene();
+    const RayCaster caster(*scene.root);
+
+    const auto hits = caster.CastRay(Ray{Vector3d::Zero(), Vector3d{0., 4., 0.}});
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_EQ(hits[0].id, scene.line);
+    EXPECT_NEAR(hits[0].distance, 3.0, kPosTol);
+
+    // 線分の外側を通るレイは平面に当たる
+    const auto beside = caster.CastRay(Ray{Vector3d{2., 0., 0.}, Vector3d::UnitY()});
+    ASSERT_EQ(beside.size(), 1u);
+    EXPECT_EQ(beside[0].id, scene.plane);
+    ExpectPositionNear(beside[0].position, Vector3d{2., 5., 0.});
+}
+
+// 子Assemblyの大域変換がワールド配置に反映される
+TEST(RayCasterTest, MeshInTransformedChildAssembly) {
+    const auto scene = MakeScene();
+    const RayCaster caster(*scene.root);
+
+    const auto hits = caster.CastRay(Ray{Vector3d{0.5, -0.5, 0.}, Vector3d::UnitZ()});
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_EQ(hits[0].id, scene.child);
+    EXPECT_NEAR(hits[0].distance, 10.0, kPosTol);
+    ExpectPositionNear(hits[0].position, Vector3d{0.5, -0.5, 10.});
+
+    // ローカル座標 (z=0) を通るレイは当たらない
+    EXPECT_TRUE(caster.CastRay(
+            Ray{Vector3d{-5., 0.5, 0.}, Vector3d::UnitX()},
+            RayCastMode::kAllHits).empty());
+}
+
+// max_distanceより遠いヒット・ゼロ方向のレイは返さない
+TEST(RayCasterTest, MaxDistanceAndZeroDirection) {
+    const auto scene = MakeScene();
+    const RayCaster caster(*scene.root);
+
+    const auto hits = caster.CastRay(
+            Ray{Vector3d::Zero(), Vector3d::UnitY(), 4.0}, RayCastMode::kAllHits);
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_EQ(hits[0].id, scene.line);
+
+    EXPECT_TRUE(caster.CastRay(Ray{Vector3d::Zero(), Vector3d::UnitZ(), 9.0}).empty());
+    EXPECT_TRUE(caster.CastRay(Ray{Vector3d::Zero(), Vector3d::Zero()}).empty());
+}
+
+// 判定対象の種類を絞り込める
+TEST(RayCasterTest, ParamsFilterTargets) {
+    const auto scene = MakeScene();
+    RayCasterParams params;
+    params.include_curves = false;
+    params.include_meshes = false;
+    const RayCaster caster(*scene.root, params);
+    EXPECT_EQ(caster.GetTargetCount(), 1u);
+
+    const auto hits = caster.CastRay(Ray{Vector3d::Zero(), Vector3d::UnitY()});
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_EQ(hits[0].id, scene.plane);
+}
+
+
+
+/**
+ * SurfaceRayMode
+ */
+
+// kTessellated: 平面ではkExactと同じ交点を返す
+TEST(RayCasterTest, TessellatedMatchesExactOnPlane) {
+    const auto scene = MakeScene();
+    RayCasterParams params;
+    params.surface_mode = i_mdl::SurfaceRayMode::kTessellated;
+    const RayCaster tessellated(*scene.root, params);
+    const RayCaster exact(*scene.root);
+
+    for (const auto& origin : {Vector3d{2., 0., 0.}, Vector3d{-3.3, 0., 4.1}}) {
+        const Ray ray{origin, Vector3d::UnitY()};
+        const auto t_hits = tessellated.CastRay(ray);
+        const auto e_hits = exact.CastRay(ray);
+        ASSERT_EQ(t_hits.size(), 1u);
+        ASSERT_EQ(e_hits.size(), 1u);
+        EXPECT_EQ(t_hits[0].id, scene.plane);
+        EXPECT_NEAR(t_hits[0].distance, e_hits[0].distance, kPosTol);
+        ExpectPositionNear(t_hits[0].position, e_hits[0].position);
+    }
+}
+
+// トリム曲面の穴を通るレイはヒットしない (kExact/kTessellatedの両方)
+TEST(RayCasterTest, TrimmedSurfaceHoleIsMissed) {
+    auto root = i_mdl::MakeAssembly("root");
+    const auto id = root->AddEntity(i_test::MakeTrimmedPlaneWithHole());
+
+    for (const auto mode : {i_mdl::SurfaceRayMode::kExact,
+                            i_mdl::SurfaceRayMode::kTessellated}) {
+        RayCasterParams params;
+        params.surface_mode = mode;
+        const RayCaster caster(*root, params);
+
+        EXPECT_TRUE(caster.CastRay(Ray{Vector3d::Zero(), Vector3d::UnitY()}).empty());
+        EXPECT_TRUE(caster.CastRay(Ray{Vector3d{4., 0., 0.}, Vector3d::UnitY()}).empty());
+        const auto hits = caster.CastRay(Ray{Vector3d{2., 0., 0.}, Vector3d::UnitY()});
+        ASSERT_EQ(hits.size(), 1u);
+        EXPECT_EQ(hits[0].id, id);
+        ExpectPositionNear(hits[0].position, Vector3d{2., 5., 0.}, 1e-4);
+    }
+}
+
+
+
+/**
+ * CastRays
+ */
+
+// 各レイの結果がCastRayと一致する
+TEST(RayCasterTest, CastRaysMatchesCastRay) {
+    const auto scene = MakeScene();
+    const RayCaster caster(*scene.root);
+
+    std::vector<Ray> rays;
+    for (int i = -6; i <= 6; ++i) {
+        for (int j = -6; j <= 6; ++j) {
+            rays.push_back(Ray{Vector3d{0.5 * i, 0., 0.5 * j}, Vector3d::UnitY()});
+            rays.push_back(Ray{Vector3d{0.25 * i, 0.25 * j, 0.}, Vector3d::UnitZ()});
+        }
+    }
+
+    for (const auto mode : {RayCastMode::kFirstHit, RayCastMode::kAllHits}) {
+        const auto results = caster.CastRays(rays, mode);
+        ASSERT_EQ(results.size(), rays.size());
+        std::size_t total = 0;
+        for (std::size_t k = 0; k < rays.size(); ++k) {
+            const auto expected = caster.CastRay(rays[k], mode);
+            ASSERT_EQ(results[k].size(), expected.size()) << "ray " << k;
+            for (std::size_t h = 0; h < expected.size(); ++h) {
+                EXPECT_EQ(results[k][h].id, expected[h].id);
+                EXPECT_DOUBLE_EQ(results[k][h].distance, expected[h].distance);
+            }
+            total += expected.size();
+        }
+        EXPECT_GT(total, 0u);  // 判定が自明 (全て交差なし) でないこと
+    }
+    EXPECT_TRUE(caster.CastRays(nullptr, 0).empty());
+}
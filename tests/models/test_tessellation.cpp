@@ -0,0 +1,113 @@
+/**
+ * @file tests/models/test_tessellation.cpp
+ * @brief models/tessellation.hのテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * テスト対象:
+ *   - TessellateAssembly: 子Assemblyの大域変換を適用した部品間の共有境界の接続、
+ *                         面グループの名前 (エンティティのID)、曲線の除外、
+ *                         共有テッセレーションキャッシュによる再利用
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/surfaces/rational_b_spline_surface.h"
+#include "igesio/entities/surfaces/algorithms/tessellation_cache.h"
+#include "igesio/models/assembly.h"
+#include "igesio/models/tessellation.h"
+
+namespace {
+
+namespace i_ent = igesio::entities;
+namespace i_mdl = igesio::models;
+using igesio::Matrix4d;
+using igesio::Vector3d;
+
+/// @brief z=0 の正方形 [0,2]×[0,2] (RationalBSplineSurface, u/v ∈ [0,1])
+std::shared_ptr<i_ent::RationalBSplineSurface> MakeSquare() {
+    return i_ent::MakeRationalBSplineSurface(
+        {1, 1},
+        {{Vector3d(0., 0., 0.), Vector3d(2., 0., 0.)},
+         {Vector3d(0., 2., 0.), Vector3d(2., 2., 0.)}},
+        {0., 0., 1., 1.}, {0., 0., 1., 1.});
+}
+
+}  // namespace
+
+
+
+// 子Assembly (x方向に+2並進) の正方形と、ルートの正方形が辺 x=2 を共有する
+TEST(TessellationTest, ConnectsFacesAcrossAssemblies) {
+    auto root = i_mdl::MakeAssembly("root");
+    const auto left = root->AddEntity(MakeSquare());
+    root->AddEntity(i_ent::MakeLine(Vector3d{0., 0., 1.}, Vector3d{1., 0., 1.}));
+
+    auto child = i_mdl::MakeAssembly("child");
+    const auto right = child->AddEntity(MakeSquare());
+    Matrix4d transform = Matrix4d::Identity();
+    transform(0, 3) = 2.0;
+    child->SetGlobalTransform(transform);
+    root->AddChildAssembly(child);
+
+    const auto mesh = i_mdl::TessellateAssembly(*root);
+
+    // 曲線は対象外. 面グループの名前はエンティティのID
+    ASSERT_EQ(mesh.groups.size(), 2u);
+    const auto& g0 = mesh.groups[0].name;
+    const auto& g1 = mesh.groups[1].name;
+    EXPECT_TRUE((g0 == ToString(left) && g1 == ToString(right)) ||
+                (g0 == ToString(right) && g1 == ToString(left)));
+    for (const auto& group : mesh.groups) EXPECT_GT(group.triangle_count, 0u);
+
+    // 共有辺 (x=2) の頂点は共有され、境界辺は外周 [0,4]×[0,2] のみ
+    std::map<std::pair<std::uint32_t, std::uint32_t>, int> count;
+    for (std::size_t k = 0; k < mesh.indices.size(); k += 3) {
+        for (int m = 0; m < 3; ++m) {
+            const auto a = mesh.indices[k + m];
+            const auto b = mesh.indices[k + (m + 1) % 3];
+            count[{std::min(a, b), std::max(a, b)}]++;
+        }
+    }
+    for (const auto& [edge, used] : count) {
+        ASSERT_LE(used, 2);
+        if (used == 2) continue;
+        const Vector3d m = 0.5 * (mesh.positions.col(edge.first) +
+                                  mesh.positions.col(edge.second)).cast<double>();
+        EXPECT_TRUE(std::abs(m.x()) < 1e-6 || std::abs(m.x() - 4.) < 1e-6 ||
+                    std::abs(m.y()) < 1e-6 || std::abs(m.y() - 2.) < 1e-6)
+                << m.transpose();
+    }
+}
+
+// 形状・配置が変わらなければ再計算せず、配置を変えると再計算する
+TEST(TessellationTest, ReusesCachedResultUntilPlacementChanges) {
+    auto root = i_mdl::MakeAssembly("root");
+    root->AddEntity(MakeSquare());
+    auto child = i_mdl::MakeAssembly("child");
+    child->AddEntity(MakeSquare());
+    root->AddChildAssembly(child);
+
+    auto& cache = i_ent::GetSharedTessellationCache();
+    const auto first = i_mdl::TessellateAssembly(*root);
+    const auto misses = cache.GetStats().misses;
+    const auto second = i_mdl::TessellateAssembly(*root);
+    EXPECT_EQ(cache.GetStats().misses, misses);
+    EXPECT_EQ(first.indices, second.indices);
+
+    Matrix4d transform = Matrix4d::Identity();
+    transform(0, 3) = 2.0;
+    child->SetGlobalTransform(transform);
+    const auto moved = i_mdl::TessellateAssembly(*root);
+    EXPECT_EQ(cache.GetStats().misses, misses + 1);
+    EXPECT_GT(moved.positions.row(0).maxCoeff(), 3.9f);
+}
@@ -0,0 +1,78 @@
+/**
+ * @file tests/numerics/meshes_for_testing.h
+ * @brief 三角形メッシュ (numerics/meshes) を扱うテストで使用するメッシュの定義
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ */
+#ifndef IGESIO_TESTS_NUMERICS_MESHES_FOR_TESTING_H_
+#define IGESIO_TESTS_NUMERICS_MESHES_FOR_TESTING_H_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "igesio/numerics/core/matrix.h"
+#include "igesio/numerics/meshes/triangle_mesh.h"
+
+namespace igesio::tests {
+
+/// @brief n x n 分割した格子メッシュを作成する
+/// @tparam Scalar メッシュの座標の型
+/// @param n 分割数
+/// @param position 格子点 (i, j) (0 ≤ i, j ≤ n) の座標
+/// @param with_attributes trueの場合、法線 (0, 0, 1)・UV (i/n, j/n) も設定する
+/// @param shuffle_seed 指定した場合、三角形をこのシードの乱数でランダムな順序に並べる
+/// @note 頂点番号は j * (n + 1) + i. 各格子は (v0, v1, v3), (v0, v3, v2)
+///       (v0: (i, j), v1: (i+1, j), v2: (i, j+1), v3: (i+1, j+1)) の2つの三角形とする
+template <typename Scalar = double>
+numerics::TriangleMeshT<Scalar> MakeGridMesh(
+        const int n, const std::function<Vector3d(int, int)>& position,
+        const bool with_attributes = false,
+        const std::optional<unsigned int> shuffle_seed = std::nullopt) {
+    numerics::TriangleMeshT<Scalar> mesh;
+    mesh.positions.resize(3, (n + 1) * (n + 1));
+    if (with_attributes) {
+        mesh.normals.resize(3, (n + 1) * (n + 1));
+        mesh.uvs.resize(2, (n + 1) * (n + 1));
+    }
+    for (int j = 0; j <= n; ++j) {
+        for (int i = 0; i <= n; ++i) {
+            const int v = j * (n + 1) + i;
+            const Vector3d p = position(i, j);
+            mesh.positions.col(v) << static_cast<Scalar>(p(0)),
+                                     static_cast<Scalar>(p(1)),
+                                     static_cast<Scalar>(p(2));
+            if (!with_attributes) continue;
+            mesh.normals.col(v) << Scalar(0), Scalar(0), Scalar(1);
+            mesh.uvs.col(v) << static_cast<Scalar>(static_cast<double>(i) / n),
+                               static_cast<Scalar>(static_cast<double>(j) / n);
+        }
+    }
+
+    std::vector<std::array<std::uint32_t, 3>> triangles;
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            const std::uint32_t v0 = j * (n + 1) + i;
+            const std::uint32_t v1 = v0 + 1, v2 = v0 + n + 1, v3 = v2 + 1;
+            triangles.push_back({v0, v1, v3});
+            triangles.push_back({v0, v3, v2});
+        }
+    }
+    if (shuffle_seed.has_value()) {
+        std::mt19937 engine(*shuffle_seed);
+        std::shuffle(triangles.begin(), triangles.end(), engine);
+    }
+    for (const auto& tri : triangles) {
+        mesh.indices.insert(mesh.indices.end(), tri.begin(), tri.end());
+    }
+    return mesh;
+}
+
+}  // namespace igesio::tests
+
+#endif  // IGESIO_TESTS_NUMERICS_MESHES_FOR_TESTING_H_
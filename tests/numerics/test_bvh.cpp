@@ -0,0 +1,388 @@
+/**
+ * @file tests/numerics/test_bvh.cpp
+ * @brief numerics/geometric/bvh.h (BuildBvh / TraverseBvh) の検証
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note テスト対象:
+ *       - `BuildBvh`
+ *         - 正常系: 全プリミティブを1回ずつ含む・葉の最大サイズ・
+ *           親ノードのボックスが子を包含する・重心が一致する入力
+ *         - 異常系: サイズ不一致・不正な制御パラメータ
+ *       - `TraverseBvh`: 線と交差するボックスの漏れがないこと・打ち切り・
+ *         ボックスの拡大 (padding)
+ *       - `QueryBvh`: 判定を通過するボックスの漏れがないこと
+ *       - `FindNearestInBvh`: 総当たりと同じ最近傍を返すこと
+ *       - `FindNearestPairInBvhs`: 総当たりと同じ最近接対を返すこと・許容量による打ち切り
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "igesio/numerics/geometric/bvh.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+using igesio::Vector3d;
+using i_num::Bvh;
+using i_num::BvhBuildParams;
+
+/// @brief 乱数で配置したボックス列
+struct Boxes {
+    /// @brief 最小点
+    std::vector<Vector3d> lowers;
+    /// @brief 最大点
+    std::vector<Vector3d> uppers;
+};
+
+/// @brief [-10, 10]^3に大きさ1程度のボックスを乱数で配置する
+/// @param count ボックス数
+/// @param seed 乱数のシード
+Boxes MakeRandomBoxes(const std::size_t count, const unsigned int seed) {
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<double> position(-10.0, 10.0);
+    std::uniform_real_distribution<double> size(0.0, 1.0);
+    Boxes boxes;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vector3d lower(position(engine), position(engine), position(engine));
+        boxes.lowers.push_back(lower);
+        boxes.uppers.push_back(
+                lower + Vector3d(size(engine), size(engine), size(engine)));
+    }
+    return boxes;
+}
+
+/// @brief ボックスbがボックスaに包含されるか
+bool Contains(const Vector3d& a_lower, const Vector3d& a_upper,
+              const Vector3d& b_lower, const Vector3d& b_upper) {
+    for (int axis = 0; axis < 3; ++axis) {
+        if (b_lower[axis] < a_lower[axis] || b_upper[axis] > a_upper[axis]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief BVHの構造的な整合性を検証する
+/// @param bvh 検証対象
+/// @param boxes 構築に用いたボックス列
+/// @param max_leaf_size 葉の最大サイズ
+void ExpectWellFormed(const Bvh& bvh, const Boxes& boxes,
+                      const std::size_t max_leaf_size) {
+    ASSERT_EQ(bvh.PrimitiveCount(), boxes.lowers.size());
+    std::vector<int> seen(boxes.lowers.size(), 0);
+    for (std::size_t i = 0; i < bvh.nodes.size(); ++i) {
+        const auto& node = bvh.nodes[i];
+        if (node.IsLeaf()) {
+            EXPECT_LE(node.count, max_leaf_size);
+            for (auto k = node.first; k < node.first + node.count; ++k) {
+                const auto prim = bvh.primitive_indices[k];
+                ++seen[prim];
+                EXPECT_TRUE(Contains(node.lower, node.upper,
+                                     boxes.lowers[prim], boxes.uppers[prim]));
+            }
+            continue;
+        }
+        ASSERT_LT(node.first + 1, bvh.nodes.size());
+        EXPECT_GT(node.first, i);  // 子は親より後に配置される (循環しない)
+        for (const auto child : {node.first, node.first + 1}) {
+            EXPECT_TRUE(Contains(node.lower, node.upper,
+                                 bvh.nodes[child].lower, bvh.nodes[child].upper));
+        }
+    }
+    for (const auto count : seen) EXPECT_EQ(count, 1);
+}
+
+}  // namespace
+
+
+
+/**
+ * BuildBvh
+ */
+
+// プリミティブが無い場合は空のBVH
+TEST(BuildBvhTest, EmptyInputYieldsEmptyBvh) {
+    const auto bvh = i_num::BuildBvh({}, {});
+    EXPECT_TRUE(bvh.IsEmpty());
+    EXPECT_EQ(bvh.PrimitiveCount(), 0u);
+}
+
+// 乱数配置のボックスから整合したBVHを構築する
+TEST(BuildBvhTest, BuildsWellFormedHierarchy) {
+    const auto boxes = MakeRandomBoxes(1000, 1);
+    for (const std::size_t leaf_size : {1u, 4u, 8u}) {
+        BvhBuildParams params;
+        params.max_leaf_size = leaf_size;
+        const auto bvh = i_num::BuildBvh(boxes.lowers, boxes.uppers, params);
+        ExpectWellFormed(bvh, boxes, leaf_size);
+    }
+}
+
+// 全ボックスが一致する (重心で分割できない) 場合も葉の最大サイズを守る
+TEST(BuildBvhTest, SplitsCoincidentBoxesByCount) {
+    Boxes boxes;
+    for (int i = 0; i < 37; ++i) {
+        boxes.lowers.emplace_back(0.0, 0.0, 0.0);
+        boxes.uppers.emplace_back(1.0, 1.0, 1.0);
+    }
+    const auto bvh = i_num::BuildBvh(boxes.lowers, boxes.uppers);
+    ExpectWellFormed(bvh, boxes, BvhBuildParams{}.max_leaf_size);
+}
+
+// lowersとuppersのサイズ不一致、不正な制御パラメータはstd::invalid_argument
+TEST(BuildBvhTest, ThrowsInvalidArgumentForInvalidInput) {
+    const auto boxes = MakeRandomBoxes(4, 2);
+    EXPECT_THROW(i_num::BuildBvh(boxes.lowers, {}), std::invalid_argument);
+
+    BvhBuildParams zero_leaf;
+    zero_leaf.max_leaf_size = 0;
+    EXPECT_THROW(i_num::BuildBvh(boxes.lowers, boxes.uppers, zero_leaf),
+                 std::invalid_argument);
+
+    BvhBuildParams one_bin;
+    one_bin.bin_count = 1;
+    EXPECT_THROW(i_num::BuildBvh(boxes.lowers, boxes.uppers, one_bin),
+                 std::invalid_argument);
+}
+
+
+
+/**
+ * TraverseBvh
+ */
+
+// 線と交差する全ボックスのプリミティブを訪問する (総当たりとの比較)
+TEST(TraverseBvhTest, VisitsEveryIntersectedBox) {
+    const auto boxes = MakeRandomBoxes(500, 3);
+    const auto bvh = i_num::BuildBvh(boxes.lowers, boxes.uppers);
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+
+    std::mt19937 engine(4);
+    std::uniform_real_distribution<double> position(-12.0, 12.0);
+    for (int trial = 0; trial < 200; ++trial) {
+        const Vector3d origin(position(engine), position(engine), position(engine));
+        Vector3d direction(position(engine), position(engine), position(engine));
+        if (trial % 10 == 0) direction[trial % 3] = 0.0;  // 軸に平行な成分を含む
+
+        std::set<std::uint32_t> visited;
+        i_num::TraverseBvh(bvh, origin, direction, 0.0, kInf,
+                           [&](const std::uint32_t prim, double&) {
+            visited.insert(prim);
+            return false;
+        });
+
+        // 総当たりのスラブ判定で交差するボックスが訪問済みであること
+        for (std::uint32_t prim = 0; prim < boxes.lowers.size(); ++prim) {
+            double t_min = 0.0, t_max = kInf;
+            bool hit = true;
+            for (int axis = 0; axis < 3 && hit; ++axis) {
+                if (direction[axis] == 0.0) {
+                    hit = origin[axis] >= boxes.lowers[prim][axis] &&
+                          origin[axis] <= boxes.uppers[prim][axis];
+                    continue;
+                }
+                double t0 = (boxes.lowers[prim][axis] - origin[axis]) / direction[axis];
+                double t1 = (boxes.uppers[prim][axis] - origin[axis]) / direction[axis];
+                if (t0 > t1) std::swap(t0, t1);
+                t_min = std::max(t_min, t0);
+                t_max = std::min(t_max, t1);
+                hit = t_min <= t_max;
+            }
+            if (hit) {
+                EXPECT_EQ(visited.count(prim), 1u)
+                    << "trial " << trial << ": primitive " << prim << " was skipped";
+            }
+        }
+    }
+}
+
+// 処理がtrueを返すと走査を打ち切る
+TEST(TraverseBvhTest, StopsWhenVisitorReturnsTrue) {
+    const auto boxes = MakeRandomBoxes(500, 5);
+    const auto bvh = i_num::BuildBvh(boxes.lowers, boxes.uppers);
+
+    int visits = 0;
+    i_num::TraverseBvh(bvh, Vector3d(-20.0, 0.5, 0.5), Vector3d(1.0, 0.0, 0.0),
+                       -std::numeric_limits<double>::infinity(),
+                       std::numeric_limits<double>::infinity(),
+                       [&](const std::uint32_t, double&) {
+        ++visits;
+        return true;
+    });
+    EXPECT_LE(visits, 1);
+}
+
+// paddingを指定すると、線から距離padding以内を通過するボックスも訪問する
+TEST(TraverseBvhTest, PaddingWidensVisitedBoxes) {
+    Boxes boxes;
+    boxes.lowers.emplace_back(0.0, 0.5, -1.0);
+    boxes.uppers.emplace_back(1.0, 1.0, 1.0);
+    const auto bvh = i_num::BuildBvh(boxes.lowers, boxes.uppers);
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+
+    // 線 y = 0.3 (z方向) はボックスから0.2離れている
+    auto count = [&](const double padding) {
+        int visits = 0;
+        i_num::TraverseBvh(bvh, Vector3d(0.5, 0.3, -5.0), Vector3d(0.0, 0.0, 1.0),
+                           0.0, kInf, padding,
+                           [&](const std::uint32_t, double&) {
+            ++visits;
+            return false;
+        });
+        return visits;
+    };
+    EXPECT_EQ(count(0.0), 0);
+    EXPECT_EQ(count(0.1), 0);
+    EXPECT_EQ(count(0.25), 1);
+}
+
+
+
+/**
+ * QueryBvh
+ */
+
+// 判定を通過する全ボックスのプリミティブを訪問する (総当たりとの比較)
+TEST(QueryBvhTest, VisitsEveryOverlappingBox) {
+    const auto boxes = MakeRandomBoxes(500, 6);
+    const auto bvh = i_num::BuildBvh(boxes.lowers, boxes.uppers);
+
+    // 半空間 x + y <= c とボックスが重なるか (最小点側の頂点で判定)
+    for (const double c : {-15.0, -3.0, 0.0, 7.5}) {
+        auto overlaps = [c](const Vector3d& lower, const Vector3d&) {
+            return lower[0] + lower[1] <= c;
+        };
+        std::set<std::uint32_t> visited;
+        i_num::QueryBvh(bvh, overlaps,
+                        [&](const std::uint32_t prim) { visited.insert(prim); });
+        for (std::uint32_t prim = 0; prim < boxes.lowers.size(); ++prim) {
+            if (overlaps(boxes.lowers[prim], boxes.uppers[prim])) {
+                EXPECT_EQ(visited.count(prim), 1u) << "c = " << c;
+            }
+        }
+    }
+}
+
+
+
+/**
+ * FindNearestInBvh
+ */
+
+// 点群の最近傍が総当たりの結果と一致する (同じ距離では番号が最小のもの)
+TEST(FindNearestInBvhTest, MatchesBruteForce) {
+    std::mt19937 engine(7);
+    std::uniform_real_distribution<double> position(-10.0, 10.0);
+    std::vector<Vector3d> points;
+    for (int i = 0; i < 400; ++i) {
+        points.emplace_back(position(engine), position(engine), position(engine));
+    }
+    points.push_back(points[17]);  // 同一点 (番号の小さい17番を返すこと)
+    const auto bvh = i_num::BuildBvh(points, points);
+    auto distance_sq = [&](const Vector3d& q) {
+        return [&points, q](const std::uint32_t prim) {
+            return (points[prim] - q).squaredNorm();
+        };
+    };
+
+    for (int trial = 0; trial < 200; ++trial) {
+        const Vector3d q(position(engine), position(engine), position(engine));
+        std::uint32_t expected = 0;
+        for (std::uint32_t prim = 1; prim < points.size(); ++prim) {
+            if ((points[prim] - q).squaredNorm() <
+                (points[expected] - q).squaredNorm()) {
+                expected = prim;
+            }
+        }
+        const auto nearest = i_num::FindNearestInBvh(bvh, q, distance_sq(q));
+        ASSERT_TRUE(nearest.has_value());
+        EXPECT_EQ(*nearest, expected) << "trial " << trial;
+    }
+
+    const auto tie = i_num::FindNearestInBvh(bvh, points[17], distance_sq(points[17]));
+    ASSERT_TRUE(tie.has_value());
+    EXPECT_EQ(*tie, 17u);
+    EXPECT_FALSE(i_num::FindNearestInBvh(
+            Bvh{}, Vector3d::Zero(), [](std::uint32_t) { return 0.0; }).has_value());
+}
+
+
+
+/**
+ * FindNearestPairInBvhs
+ */
+
+// 2つの点群の最近接対が総当たりの結果と一致する
+TEST(FindNearestPairInBvhsTest, MatchesBruteForce) {
+    std::mt19937 engine(11);
+    std::uniform_real_distribution<double> position(-10.0, 10.0);
+    for (int trial = 0; trial < 20; ++trial) {
+        std::vector<Vector3d> points_a, points_b;
+        const Vector3d offset(position(engine), 0.0, 0.0);
+        for (int i = 0; i < 150; ++i) {
+            points_a.emplace_back(position(engine), position(engine), position(engine));
+            points_b.emplace_back(
+                    Vector3d(position(engine), position(engine), position(engine)) +
+                    2.0 * offset);
+        }
+        const auto bvh_a = i_num::BuildBvh(points_a, points_a);
+        const auto bvh_b = i_num::BuildBvh(points_b, points_b);
+        std::size_t evaluated = 0;
+        const auto distance_sq = [&](const std::uint32_t a, const std::uint32_t b) {
+            ++evaluated;
+            return (points_a[a] - points_b[b]).squaredNorm();
+        };
+
+        std::pair<std::uint32_t, std::uint32_t> expected = {0, 0};
+        for (std::uint32_t a = 0; a < points_a.size(); ++a) {
+            for (std::uint32_t b = 0; b < points_b.size(); ++b) {
+                if ((points_a[a] - points_b[b]).squaredNorm() <
+                    (points_a[expected.first] - points_b[expected.second])
+                        .squaredNorm()) {
+                    expected = {a, b};
+                }
+            }
+        }
+        const auto nearest = i_num::FindNearestPairInBvhs(bvh_a, bvh_b, distance_sq);
+        ASSERT_TRUE(nearest.has_value());
+        EXPECT_EQ(*nearest, expected) << "trial " << trial;
+        // 分枝限定により、総当たりより少ない組の評価で済むこと
+        EXPECT_LT(evaluated, points_a.size() * points_b.size());
+    }
+
+    const auto bvh = i_num::BuildBvh({Vector3d::Zero()}, {Vector3d::Zero()});
+    EXPECT_FALSE(i_num::FindNearestPairInBvhs(
+            Bvh{}, bvh, [](std::uint32_t, std::uint32_t) { return 0.0; }).has_value());
+}
+
+// 許容量を与えると、最短距離との差が許容量未満の組で打ち切る
+TEST(FindNearestPairInBvhsTest, ToleranceBoundsTheError) {
+    std::vector<Vector3d> points_a, points_b;
+    for (int i = 0; i < 100; ++i) {
+        points_a.emplace_back(0.01 * i, 0.0, 0.0);
+        points_b.emplace_back(0.01 * i, 1.0 + 1e-4 * i, 0.0);
+    }
+    const auto bvh_a = i_num::BuildBvh(points_a, points_a);
+    const auto bvh_b = i_num::BuildBvh(points_b, points_b);
+    const auto distance_sq = [&](const std::uint32_t a, const std::uint32_t b) {
+        return (points_a[a] - points_b[b]).squaredNorm();
+    };
+
+    const auto exact = i_num::FindNearestPairInBvhs(bvh_a, bvh_b, distance_sq);
+    ASSERT_TRUE(exact.has_value());
+    EXPECT_EQ(*exact, (std::pair<std::uint32_t, std::uint32_t>{0, 0}));
+
+    const auto approx = i_num::FindNearestPairInBvhs(bvh_a, bvh_b, distance_sq, 0.05);
+    ASSERT_TRUE(approx.has_value());
+    EXPECT_LE(std::sqrt(distance_sq(approx->first, approx->second)), 1.0 + 0.05);
+}
@@ -222,3 +222,159 @@ TEST(IntegrationTest, Integrate2DGaussLegendreAutoIntervals) {
         EXPECT_TRUE(error_msg3.empty()) << description << ": " << error_msg3;
     }
 }
+
+
+
+/**
+ * テンプレート版 (gauss_quadrature.h) のテスト
+ */
+
+// n点ガウス=ルジャンドル求積法が2n-1次の多項式を厳密に積分することの検証
+TEST(IntegrationTest, GaussLegendreFixedPolynomialExactness) {
+    const std::array<double, 2> range = {-0.5, 1.5};
+    for (size_t n = 1; n <= i_num::kGaussLegendreTableMaxPoints; ++n) {
+        // f(x) = x^(2n-1) + x^(2n-2)
+        const int deg = static_cast<int>(2 * n - 1);
+        auto f = [deg](const double x) {
+            return std::pow(x, deg) + std::pow(x, deg - 1);
+        };
+        const double exact =
+            (std::pow(range[1], deg + 1) - std::pow(range[0], deg + 1)) / (deg + 1)
+          + (std::pow(range[1], deg) - std::pow(range[0], deg)) / deg;
+
+        EXPECT_NEAR(i_num::GaussLegendreFixed(f, range, n), exact,
+                    1e-12 * std::max(1.0, std::fabs(exact))) << "n: " << n;
+    }
+
+    // コンパイル時指定版は実行時指定版と一致する
+    EXPECT_DOUBLE_EQ(i_num::GaussLegendreFixed<20>(f_x_3, range),
+                     i_num::GaussLegendreFixed(f_x_3, range, 20));
+}
+
+// 適応型ガウス=クロンロッド求積法の精度と誤差推定の検証
+TEST(IntegrationTest, AdaptiveGaussKronrod) {
+    const std::vector<std::array<double, 2>> test_ranges = {
+        {-3.0, -1.0}, {-1.0, 1.0}, {0.0, 1.0}, {50.0, 100.0}, {1.0, -2.0}
+    };
+    const auto tol = i_num::Tolerance(1e-8);
+
+    for (const auto& range : test_ranges) {
+        const double exact = int_f_x_3(range[1]) - int_f_x_3(range[0]);
+        auto result = i_num::AdaptiveGaussKronrod(f_x_3, range, tol);
+        EXPECT_TRUE(result.converged);
+        auto error_msg = CheckError(result.value, exact, tol);
+        EXPECT_TRUE(error_msg.empty()) << error_msg;
+        // 推定誤差は実際の誤差の上界となる
+        EXPECT_GE(result.error + 1e-15, std::fabs(result.value - exact));
+        EXPECT_EQ(result.n_evaluations % i_num::kGaussKronrodPoints, 0u);
+    }
+
+    // 滑らかな多項式は1区間 (15点) で収束する
+    auto poly = i_num::AdaptiveGaussKronrod(f_x_2, {-1.0, 1.0}, tol);
+    EXPECT_EQ(poly.n_evaluations, i_num::kGaussKronrodPoints);
+    EXPECT_NEAR(poly.value, int_f_x_2(1.0) - int_f_x_2(-1.0), 1e-12);
+
+    // 不連続を含む関数: 分割が不連続点付近に集中し、収束する
+    auto step = [](const double x) { return (x < 0.3) ? 1.0 : 2.0; };
+    auto step_result = i_num::AdaptiveGaussKronrod(step, {0.0, 1.0}, tol);
+    EXPECT_TRUE(step_result.converged);
+    EXPECT_NEAR(step_result.value, 0.3 + 2.0 * 0.7, 1e-7);
+}
+
+// バッチ評価版が15点をまとめて評価することの検証
+TEST(IntegrationTest, AdaptiveGaussKronrodBatch) {
+    size_t n_calls = 0;
+    auto batch = [&n_calls](const std::array<double, 15>& x,
+                            std::array<double, 15>& fx) {
+        ++n_calls;
+        for (size_t i = 0; i < x.size(); ++i) fx[i] = f_x_3(x[i]);
+    };
+    const auto tol = i_num::Tolerance(1e-10);
+    auto result = i_num::AdaptiveGaussKronrodBatch(batch, {0.0, 10.0}, tol);
+    EXPECT_EQ(result.n_evaluations, n_calls * i_num::kGaussKronrodPoints);
+    EXPECT_NEAR(result.value, int_f_x_3(10.0) - int_f_x_3(0.0), 1e-10);
+}
+
+// 2重積分 (逐次積分) の検証
+TEST(IntegrationTest, AdaptiveGaussKronrod2D) {
+    const std::vector<std::array<double, 4>> test_ranges = {
+        {-2.0, -1.0, -2.0, -1.0}, {-1.0, 1.0, -1.0, 1.0}, {1.0, 2.0, 2.0, 1.0}
+    };
+    const auto tol = i_num::Tolerance(1e-8);
+    for (const auto& range : test_ranges) {
+        auto result = i_num::AdaptiveGaussKronrod2D(f_xy_3, range, tol);
+        auto error_msg = CheckError(result.value, int_f_xy_3(range), tol);
+        EXPECT_TRUE(error_msg.empty()) << error_msg;
+        EXPECT_TRUE(result.converged);
+    }
+
+    // 円板の指示関数 (トリム領域を模擬): 面積 π/4 (単位円の1/4)
+    auto disk = [](const double x, const double y) {
+        return (x * x + y * y <= 1.0) ? 1.0 : 0.0;
+    };
+    auto area = i_num::AdaptiveGaussKronrod2D(disk, {0.0, 1.0, 0.0, 1.0},
+                                               i_num::Tolerance(1e-6));
+    EXPECT_NEAR(area.value, std::atan(1.0), 1e-3);
+}
+
+// AdaptiveCubature2Dの検証
+TEST(IntegrationTest, AdaptiveCubature2D) {
+    const std::vector<std::array<double, 4>> test_ranges = {
+        {-2.0, -1.0, -2.0, -1.0}, {-1.0, 1.0, -1.0, 1.0}, {1.0, 2.0, 2.0, 1.0}
+    };
+    const auto tol = i_num::Tolerance(1e-8);
+    for (const auto& range : test_ranges) {
+        auto result = i_num::AdaptiveCubature2D(f_xy_3, range, tol);
+        auto error_msg = CheckError(result.value, int_f_xy_3(range), tol);
+        EXPECT_TRUE(error_msg.empty()) << error_msg;
+        EXPECT_TRUE(result.converged);
+    }
+
+    // 円板の指示関数 (トリム領域を模擬): 面積 π/4 (単位円の1/4)
+    auto disk = [](const double x, const double y) {
+        return (x * x + y * y <= 1.0) ? 1.0 : 0.0;
+    };
+    auto area = i_num::AdaptiveCubature2D(disk, {0.0, 1.0, 0.0, 1.0},
+                                          i_num::Tolerance(1e-3));
+    EXPECT_TRUE(area.converged);
+    EXPECT_NEAR(area.value, std::atan(1.0), 1e-3);
+}
+
+// IntegrationOptions::GaussKronrod経由でのIntegrateの検証
+TEST(IntegrationTest, IntegrateGaussKronrodOption) {
+    const auto tol = i_num::Tolerance(1e-8);
+    const auto options = i_num::IntegrationOptions::GaussKronrod();
+    EXPECT_NO_THROW(options.Check());
+
+    const double exact1 = int_f_x_3(3.0) - int_f_x_3(-1.0);
+    EXPECT_TRUE(CheckError(i_num::Integrate(f_x_3, {-1.0, 3.0}, tol, options),
+                           exact1, tol).empty());
+    EXPECT_TRUE(CheckError(i_num::Integrate(f_x_3, {3.0, -1.0}, tol, options),
+                           -exact1, tol).empty());
+
+    const std::array<double, 4> range = {-1.0, 1.0, 0.0, 2.0};
+    EXPECT_TRUE(CheckError(i_num::Integrate(f_xy_2, range, tol, options),
+                           int_f_xy_2(range), tol).empty());
+
+    auto invalid = i_num::IntegrationOptions::GaussKronrod(0);
+    EXPECT_THROW(invalid.Check(), std::invalid_argument);
+}
+
+// LegendreCoefficientsFromKronrod15の検証
+TEST(IntegrationTest, LegendreCoefficientsFromKronrod15) {
+    // f(x) = x^3 + 1 = P_0 + (3/5)P_1 + (2/5)P_3
+    std::array<double, i_num::kGaussKronrodPoints> fx;
+    auto result = i_num::GaussKronrod15Batch(
+        [&fx](const std::array<double, i_num::kGaussKronrodPoints>& x,
+              std::array<double, i_num::kGaussKronrodPoints>& values) {
+            for (size_t i = 0; i < x.size(); ++i) values[i] = x[i] * x[i] * x[i] + 1.0;
+            fx = values;
+        }, {-1.0, 1.0});
+    EXPECT_NEAR(result.value, 2.0, 1e-14);
+
+    auto c = i_num::LegendreCoefficientsFromKronrod15<6>(fx);
+    const std::array<double, 7> expected = {1.0, 0.6, 0.0, 0.4, 0.0, 0.0, 0.0};
+    for (size_t j = 0; j < c.size(); ++j) {
+        EXPECT_NEAR(c[j], expected[j], 1e-14) << "j = " << j;
+    }
+}
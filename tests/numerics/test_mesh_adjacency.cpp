@@ -0,0 +1,236 @@
+/**
+ * @file tests/numerics/test_mesh_adjacency.cpp
+ * @brief 三角形メッシュの隣接関係と、それを共有する法線・エッジ抽出の検証
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note テスト対象:
+ *       - `BuildMeshAdjacency`
+ *         - 頂点→三角形・エッジ→三角形の一覧が、素朴な列挙と一致すること
+ *         - 退化三角形・どの三角形にも属さない頂点を扱えること
+ *       - `detail::RadixSortKeys`
+ *         - チャンク数によらず、std::stable_sortと同じ (安定な) 結果を与えること
+ *       - `ExtractUniqueEdges` / `ExtractMeshEdges` / `RecomputeNormals`
+ *         - 並列化の対象となる大規模なメッシュで、std::sortによる列挙・
+ *           直列の加算と同じ結果を与えること
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/numerics/meshes/algorithms.h"
+
+#include "meshes_for_testing.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+namespace i_test = igesio::tests;
+using igesio::Vector3d;
+using i_num::TriangleMeshd;
+using Edge = std::array<std::uint32_t, 2>;
+
+/// @brief n x n 分割した波打つ格子メッシュ (三角形はランダムな順序) を作成する
+TriangleMeshd MakeShuffledGrid(const int n, const unsigned int seed) {
+    return i_test::MakeGridMesh(
+            n, [](const int i, const int j) {
+                return Vector3d(i, j, ((i * 7 + j * 3) % 5) * 0.3);
+            }, /*with_attributes=*/false, seed);
+}
+
+/// @brief 全三角形の辺を (エッジ, 三角形番号) として列挙し、std::sortで並べる
+std::vector<std::pair<Edge, std::uint32_t>> SortedEdgeRecords(
+        const TriangleMeshd& mesh) {
+    std::vector<std::pair<Edge, std::uint32_t>> records;
+    for (std::size_t t = 0; t < mesh.TriangleCount(); ++t) {
+        for (int k = 0; k < 3; ++k) {
+            const auto a = mesh.indices[3 * t + k];
+            const auto b = mesh.indices[3 * t + (k + 1) % 3];
+            if (a == b) continue;
+            records.push_back({{std::min(a, b), std::max(a, b)},
+                               static_cast<std::uint32_t>(t)});
+        }
+    }
+    std::sort(records.begin(), records.end());
+    return records;
+}
+
+/// @brief 頂点法線を直列の加算で求める (RecomputeNormalsの直列経路と同じ計算)
+i_num::TriangleMeshd::Matrix3X ScatterNormals(const TriangleMeshd& mesh) {
+    i_num::TriangleMeshd::Matrix3X normals;
+    normals.setZero(3, mesh.positions.cols());
+    for (std::size_t t = 0; t < mesh.TriangleCount(); ++t) {
+        const Vector3d p0 = mesh.positions.col(mesh.indices[3 * t]);
+        const Vector3d cross =
+                (Vector3d(mesh.positions.col(mesh.indices[3 * t + 1])) - p0).cross(
+                 Vector3d(mesh.positions.col(mesh.indices[3 * t + 2])) - p0);
+        for (int k = 0; k < 3; ++k) normals.col(mesh.indices[3 * t + k]) += cross;
+    }
+    for (Eigen::Index c = 0; c < normals.cols(); ++c) {
+        const double norm = normals.col(c).norm();
+        if (norm > 0.0) normals.col(c) /= norm;
+    }
+    return normals;
+}
+
+}  // namespace
+
+
+
+/**
+ * BuildMeshAdjacency
+ */
+
+// 退化三角形・孤立頂点を含む小さなメッシュの隣接関係
+TEST(MeshAdjacencyTest, SmallMeshWithDegenerateTriangle) {
+    TriangleMeshd mesh;
+    mesh.positions.resize(3, 5);
+    mesh.positions << 0, 1, 1, 0, 5,
+                      0, 0, 1, 1, 5,
+                      0, 0, 0, 0, 5;
+    // 正方形の2枚 + 頂点0を重複した退化三角形. 頂点4はどの三角形にも属さない
+    mesh.indices = {0, 1, 2, 0, 2, 3, 1, 1, 2};
+    const auto adjacency = i_num::BuildMeshAdjacency(mesh);
+
+    ASSERT_EQ(adjacency.VertexCount(), 5u);
+    const std::vector<std::uint32_t> expected_offsets = {0, 2, 5, 8, 9, 9};
+    EXPECT_EQ(adjacency.vertex_offsets, expected_offsets);
+    const std::vector<std::uint32_t> expected_triangles = {0, 1, 0, 2, 2, 0, 1, 2, 1};
+    EXPECT_EQ(adjacency.vertex_triangles, expected_triangles);
+    EXPECT_EQ(adjacency.VertexTriangleCount(4), 0u);
+
+    const std::vector<Edge> expected_edges = {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {2, 3}};
+    EXPECT_EQ(adjacency.edges, expected_edges);
+    EXPECT_EQ(i_num::ExtractUniqueEdges(mesh), expected_edges);
+    // (1, 2) は正方形の1枚と退化三角形の2辺が共有する
+    EXPECT_EQ(adjacency.EdgeTriangleCount(3), 3u);
+    EXPECT_EQ(adjacency.EdgeTriangleCount(1), 2u);
+    EXPECT_EQ(adjacency.edge_offsets.back(), adjacency.edge_triangles.size());
+
+    // エッジのみの構築は頂点→三角形を持たず、エッジ→三角形は同じ
+    const auto edges_only = i_num::BuildMeshAdjacency(mesh, false);
+    EXPECT_EQ(edges_only.VertexCount(), 0u);
+    EXPECT_EQ(edges_only.edges, adjacency.edges);
+    EXPECT_EQ(edges_only.edge_offsets, adjacency.edge_offsets);
+    EXPECT_EQ(edges_only.edge_triangles, adjacency.edge_triangles);
+}
+
+// 空のメッシュ
+TEST(MeshAdjacencyTest, EmptyMesh) {
+    TriangleMeshd mesh;
+    mesh.positions.resize(3, 2);
+    const auto adjacency = i_num::BuildMeshAdjacency(mesh);
+    EXPECT_EQ(adjacency.vertex_offsets, std::vector<std::uint32_t>(3, 0));
+    EXPECT_TRUE(adjacency.edges.empty());
+    EXPECT_EQ(adjacency.edge_offsets, std::vector<std::uint32_t>(1, 0));
+    EXPECT_TRUE(i_num::ExtractUniqueEdges(mesh).empty());
+}
+
+
+
+/**
+ * 基数ソート
+ */
+
+// 複数チャンクでの散布 (並列化の経路) も、std::stable_sortと一致する
+TEST(MeshAdjacencyTest, RadixSortMatchesStableSortForAnyChunkCount) {
+    // ビット [4, 30) のみを比較する. 下位4ビット・ビット30以上は比較しないため
+    // 安定性を確認できる. 最上位の桁 (ビット [26, 30)) は全要素で同じとし、
+    // 並べ替えを省くパスも通す
+    std::mt19937_64 engine(11);
+    std::vector<std::uint64_t> input(100000);
+    for (auto& key : input) {
+        key = (engine() & 0x03fffff0ULL) | (engine() & 0xfULL)
+            | (engine() & 0xffff0000c0000000ULL);
+    }
+    std::vector<std::uint32_t> input_values(input.size());
+    for (std::size_t i = 0; i < input_values.size(); ++i) {
+        input_values[i] = static_cast<std::uint32_t>(i);
+    }
+
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> expected;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        expected.push_back({input[i], input_values[i]});
+    }
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return ((a.first >> 4) & 0x3ffffffULL) < ((b.first >> 4) & 0x3ffffffULL);
+    });
+
+    for (const std::size_t chunks : {1u, 2u, 3u, 7u}) {
+        SCOPED_TRACE("chunks = " + std::to_string(chunks));
+        auto keys = input;
+        auto values = input_values;
+        i_num::detail::RadixSortKeys(keys, &values, 4, 30, chunks);
+        ASSERT_EQ(keys.size(), expected.size());
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            ASSERT_EQ(keys[i], expected[i].first) << "i = " << i;
+            ASSERT_EQ(values[i], expected[i].second) << "i = " << i;
+        }
+
+        // キーのみ
+        auto keys_only = input;
+        i_num::detail::RadixSortKeys(keys_only, nullptr, 4, 30, chunks);
+        EXPECT_EQ(keys_only, keys);
+    }
+}
+
+
+
+/**
+ * 大規模なメッシュ (並列化の対象)
+ */
+
+// 隣接関係・エッジ・法線が、素朴な列挙・直列の加算と一致する
+TEST(MeshAdjacencyTest, LargeMeshMatchesSerialReference) {
+    auto mesh = MakeShuffledGrid(200, 7);
+    ASSERT_GE(mesh.TriangleCount(), i_num::kMinParallelTriangleCount);
+    const auto adjacency = i_num::BuildMeshAdjacency(mesh);
+
+    // エッジ→三角形
+    const auto records = SortedEdgeRecords(mesh);
+    ASSERT_EQ(adjacency.edge_triangles.size(), records.size());
+    std::vector<Edge> expected_edges;
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(adjacency.edge_triangles[i], records[i].second);
+        if (i == 0 || records[i].first != records[i - 1].first) {
+            expected_edges.push_back(records[i].first);
+        }
+    }
+    EXPECT_EQ(adjacency.edges, expected_edges);
+    EXPECT_EQ(i_num::ExtractUniqueEdges(mesh), expected_edges);
+
+    // 頂点→三角形
+    for (std::size_t v = 0; v < adjacency.VertexCount(); ++v) {
+        for (auto a = adjacency.vertex_offsets[v]; a < adjacency.vertex_offsets[v + 1]; ++a) {
+            const auto t = adjacency.vertex_triangles[a];
+            const auto* tri = &mesh.indices[3 * t];
+            EXPECT_TRUE(tri[0] == v || tri[1] == v || tri[2] == v);
+            if (a > adjacency.vertex_offsets[v]) {
+                EXPECT_LE(adjacency.vertex_triangles[a - 1], t);
+            }
+        }
+    }
+    EXPECT_EQ(adjacency.vertex_offsets.back(), mesh.indices.size());
+
+    // 法線は直列の加算とビット単位で一致する
+    i_num::RecomputeNormals(mesh, adjacency);
+    EXPECT_TRUE(mesh.normals == ScatterNormals(mesh));
+
+    // 特徴エッジは境界 (格子の外周) と折り目
+    const auto edges = i_num::ExtractMeshEdges(mesh, adjacency, 0.5);
+    EXPECT_EQ(edges.all_edges, expected_edges);
+    std::size_t boundary = 0;
+    for (std::size_t e = 0; e < adjacency.EdgeCount(); ++e) {
+        if (adjacency.EdgeTriangleCount(e) == 1) ++boundary;
+    }
+    EXPECT_EQ(boundary, 4u * 200u);
+    EXPECT_GE(edges.feature_edges.size(), boundary);
+    EXPECT_EQ(i_num::ExtractMeshEdges(mesh, 0.5).feature_edges, edges.feature_edges);
+}
@@ -0,0 +1,229 @@
+/**
+ * @file tests/numerics/test_mesh_bvh.cpp
+ * @brief BVHを用いた三角形メッシュと直線/半直線/線分の交差判定の検証
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note テスト対象:
+ *       - `BuildMeshBvh`
+ *       - `IntersectMeshWithLine` (BVH版) / `FindClosestMeshHit` / `HasMeshHit`
+ *         - 線形走査版と同じ結果を返すこと (乱数の三角形群・各線種)
+ *         - 共有エッジ上の重複除去
+ *         - 単精度メッシュ・空メッシュ
+ *       - 一括判定 (`IntersectMeshWithLines` / `FindClosestMeshHits` / `HasMeshHits`)
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/numerics/meshes/algorithms.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+using igesio::Vector3d;
+using i_num::BoundingBox;
+using i_num::TriangleMeshd;
+using DT = BoundingBox::DirectionType;
+
+/// @brief 数値比較の許容誤差
+constexpr double kTol = 1e-12;
+
+/// @brief 乱数で配置した三角形群 (互いに独立した頂点を持つ) を作成する
+/// @param count 三角形数
+/// @param seed 乱数のシード
+TriangleMeshd MakeTriangleSoup(const int count, const unsigned int seed) {
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<double> center(-5.0, 5.0);
+    std::uniform_real_distribution<double> offset(-0.8, 0.8);
+    TriangleMeshd mesh;
+    mesh.positions.resize(3, 3 * count);
+    for (int i = 0; i < count; ++i) {
+        const Vector3d c(center(engine), center(engine), center(engine));
+        for (int k = 0; k < 3; ++k) {
+            mesh.positions.col(3 * i + k) =
+                    c + Vector3d(offset(engine), offset(engine), offset(engine));
+            mesh.indices.push_back(static_cast<std::uint32_t>(3 * i + k));
+        }
+    }
+    return mesh;
+}
+
+/// @brief 原点中心・半径2の球面を緯度経度で分割したメッシュを作成する
+/// @note 隣接三角形が頂点・エッジを共有する閉じたメッシュ
+TriangleMeshd MakeSphere(const int n_lat, const int n_lon) {
+    TriangleMeshd mesh;
+    mesh.positions.resize(3, (n_lat + 1) * n_lon);
+    for (int i = 0; i <= n_lat; ++i) {
+        const double theta = igesio::kPi * i / n_lat;
+        for (int j = 0; j < n_lon; ++j) {
+            const double phi = 2.0 * igesio::kPi * j / n_lon;
+            mesh.positions.col(i * n_lon + j) = 2.0 * Vector3d(
+                    std::sin(theta) * std::cos(phi),
+                    std::sin(theta) * std::sin(phi), std::cos(theta));
+        }
+    }
+    for (int i = 0; i < n_lat; ++i) {
+        for (int j = 0; j < n_lon; ++j) {
+            const auto a = static_cast<std::uint32_t>(i * n_lon + j);
+            const auto b = static_cast<std::uint32_t>(i * n_lon + (j + 1) % n_lon);
+            const auto c = a + n_lon, d = b + n_lon;
+            mesh.indices.insert(mesh.indices.end(), {a, c, b, b, c, d});
+        }
+    }
+    return mesh;
+}
+
+/// @brief 2つの交差点のリストが一致することを確認する
+void ExpectSameHits(const std::vector<i_num::MeshRayHit>& actual,
+                    const std::vector<i_num::MeshRayHit>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].triangle_index, expected[i].triangle_index);
+        EXPECT_NEAR(actual[i].t, expected[i].t, kTol);
+        EXPECT_NEAR(actual[i].barycentric_u, expected[i].barycentric_u, kTol);
+        EXPECT_NEAR(actual[i].barycentric_v, expected[i].barycentric_v, kTol);
+    }
+}
+
+/// @brief 乱数の線について、BVH版の各クエリが線形走査版と一致することを確認する
+void ExpectConsistentWithLinearScan(const TriangleMeshd& mesh,
+                                    const unsigned int seed) {
+    const auto bvh = i_num::BuildMeshBvh(mesh);
+    ASSERT_EQ(bvh.PrimitiveCount(), mesh.TriangleCount());
+
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<double> position(-6.0, 6.0);
+    int total_hits = 0;
+    for (int trial = 0; trial < 300; ++trial) {
+        const Vector3d p0(position(engine), position(engine), position(engine));
+        Vector3d p1(position(engine), position(engine), position(engine));
+        if (trial % 7 == 0) p1[trial % 3] = p0[trial % 3];  // 軸に平行な成分を含む
+        for (const auto type : {DT::kSegment, DT::kRay, DT::kLine}) {
+            const auto expected = i_num::IntersectMeshWithLine(mesh, p0, p1, type);
+            const auto actual = i_num::IntersectMeshWithLine(mesh, bvh, p0, p1, type);
+            ExpectSameHits(actual, expected);
+
+            const auto closest = i_num::FindClosestMeshHit(mesh, bvh, p0, p1, type);
+            ASSERT_EQ(closest.has_value(), !expected.empty());
+            if (closest) {
+                EXPECT_EQ(closest->triangle_index, expected.front().triangle_index);
+                EXPECT_NEAR(closest->t, expected.front().t, kTol);
+            }
+            EXPECT_EQ(i_num::HasMeshHit(mesh, bvh, p0, p1, type), !expected.empty());
+            total_hits += static_cast<int>(expected.size());
+        }
+    }
+    EXPECT_GT(total_hits, 0);  // 判定が自明 (全て非交差) でないこと
+}
+
+}  // namespace
+
+
+
+/**
+ * 単一の線による判定
+ */
+
+// 乱数配置の三角形群で、BVH版の全クエリが線形走査版と一致する
+TEST(MeshBvhTest, MatchesLinearScanOnTriangleSoup) {
+    ExpectConsistentWithLinearScan(MakeTriangleSoup(400, 1), 2);
+}
+
+// 頂点・エッジを共有する閉じたメッシュで、BVH版の全クエリが線形走査版と一致する
+TEST(MeshBvhTest, MatchesLinearScanOnClosedMesh) {
+    ExpectConsistentWithLinearScan(MakeSphere(24, 32), 3);
+}
+
+// 共有エッジ上のヒットは線形走査版と同様に1つへ重複除去される
+TEST(MeshBvhTest, DeduplicatesHitOnSharedEdge) {
+    TriangleMeshd mesh;
+    mesh.positions.resize(3, 4);
+    mesh.positions.col(0) = Vector3d(0.0, 0.0, 0.0);
+    mesh.positions.col(1) = Vector3d(1.0, 0.0, 0.0);
+    mesh.positions.col(2) = Vector3d(1.0, 1.0, 0.0);
+    mesh.positions.col(3) = Vector3d(0.0, 1.0, 0.0);
+    mesh.indices = {0, 1, 2, 0, 2, 3};
+    const auto bvh = i_num::BuildMeshBvh(mesh);
+
+    const Vector3d p0(0.5, 0.5, 1.0);
+    const Vector3d p1(0.5, 0.5, 0.0);
+    const auto hits = i_num::IntersectMeshWithLine(mesh, bvh, p0, p1, DT::kRay);
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_NEAR(hits[0].t, 1.0, kTol);
+
+    const auto closest = i_num::FindClosestMeshHit(mesh, bvh, p0, p1, DT::kRay);
+    ASSERT_TRUE(closest.has_value());
+    EXPECT_EQ(closest->triangle_index, hits[0].triangle_index);
+}
+
+// 単精度メッシュでも倍精度と同じ交差点を求める
+TEST(MeshBvhTest, SupportsSinglePrecisionMesh) {
+    const auto mesh = MakeSphere(8, 12);
+    i_num::TriangleMeshf mesh_f;
+    mesh_f.positions = mesh.positions.cast<float>();
+    mesh_f.indices = mesh.indices;
+    const auto bvh = i_num::BuildMeshBvh(mesh_f);
+
+    const Vector3d p0(0.1, 0.2, -5.0);
+    const Vector3d p1(0.1, 0.2, 5.0);
+    const auto hits = i_num::IntersectMeshWithLine(mesh_f, bvh, p0, p1, DT::kSegment);
+    ASSERT_EQ(hits.size(), 2u);
+    EXPECT_LT(hits[0].position.z(), 0.0);
+    EXPECT_GT(hits[1].position.z(), 0.0);
+}
+
+// 空メッシュ・長さゼロの方向ベクトルではヒットしない
+TEST(MeshBvhTest, EmptyMeshAndZeroDirectionYieldNoHit) {
+    const TriangleMeshd empty;
+    const auto empty_bvh = i_num::BuildMeshBvh(empty);
+    EXPECT_TRUE(empty_bvh.IsEmpty());
+    EXPECT_TRUE(i_num::IntersectMeshWithLine(
+            empty, empty_bvh, Vector3d::Zero(), Vector3d::UnitZ(), DT::kLine).empty());
+
+    const auto mesh = MakeSphere(8, 12);
+    const auto bvh = i_num::BuildMeshBvh(mesh);
+    EXPECT_FALSE(i_num::FindClosestMeshHit(
+            mesh, bvh, Vector3d::Zero(), Vector3d::Zero(), DT::kLine).has_value());
+    EXPECT_FALSE(i_num::HasMeshHit(
+            mesh, bvh, Vector3d::Zero(), Vector3d::Zero(), DT::kLine));
+}
+
+
+
+/**
+ * 複数の線による一括判定
+ */
+
+// 一括判定の各結果が、線ごとの判定結果と一致する
+TEST(MeshBvhTest, BatchedQueriesMatchSingleQueries) {
+    const auto mesh = MakeSphere(16, 24);
+    const auto bvh = i_num::BuildMeshBvh(mesh);
+
+    std::vector<i_num::MeshLineQuery> lines;
+    for (int i = 0; i < 50; ++i) {
+        const double a = 0.13 * i;
+        lines.push_back({Vector3d(0.1 * std::cos(a), 3.0 * std::sin(a), -4.0),
+                         Vector3d(0.0, 0.0, 0.0)});
+    }
+
+    const auto all = i_num::IntersectMeshWithLines(mesh, bvh, lines, DT::kRay);
+    const auto closest = i_num::FindClosestMeshHits(mesh, bvh, lines, DT::kRay);
+    const auto any = i_num::HasMeshHits(mesh, bvh, lines, DT::kSegment);
+    ASSERT_EQ(all.size(), lines.size());
+    ASSERT_EQ(closest.size(), lines.size());
+    ASSERT_EQ(any.size(), lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        ExpectSameHits(all[i], i_num::IntersectMeshWithLine(
+                mesh, bvh, lines[i].p0, lines[i].p1, DT::kRay));
+        ASSERT_EQ(closest[i].has_value(), !all[i].empty());
+        if (closest[i]) {
+            EXPECT_EQ(closest[i]->triangle_index, all[i].front().triangle_index);
+        }
+        EXPECT_EQ(any[i], i_num::HasMeshHit(
+                mesh, bvh, lines[i].p0, lines[i].p1, DT::kSegment));
+    }
+}
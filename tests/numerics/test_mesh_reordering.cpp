@@ -0,0 +1,262 @@
+/**
+ * @file tests/numerics/test_mesh_reordering.cpp
+ * @brief 三角形メッシュの描画向けの並べ替え・頂点属性の量子化の検証
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note テスト対象:
+ *       - `OptimizeVertexCache` / `ComputeAverageCacheMissRatio`
+ *         - 三角形の集合と向きを保ち、ランダムな順序よりACMRを下げること
+ *       - `ComputeVertexFetchRemap` / `OptimizeForRendering`
+ *         - 頂点が最初に参照される順に並び、各三角形の頂点座標を保つこと
+ *         - 面グループの三角形範囲を保つこと
+ *       - `QuantizeSnorm16` / `EncodeOctahedral` / `QuantizePositions`
+ *         - 量子化誤差が上限以下であること
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/numerics/meshes/algorithms.h"
+
+#include "meshes_for_testing.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+namespace i_test = igesio::tests;
+using igesio::Vector3d;
+using i_num::TriangleMeshd;
+
+/// @brief n x n 分割した格子メッシュ (三角形はランダムな順序) を作成する
+/// @param n 分割数
+/// @param seed 三角形の順序を決める乱数のシード
+TriangleMeshd MakeShuffledGrid(const int n, const unsigned int seed) {
+    return i_test::MakeGridMesh(
+            n, [](const int i, const int j) { return Vector3d(i, j, 0.1 * i * j); },
+            /*with_attributes=*/true, seed);
+}
+
+/// @brief 三角形の頂点番号を、巡回順を保って最小の番号が先頭となるよう回転する
+std::array<std::uint32_t, 3> Canonical(const std::uint32_t a, const std::uint32_t b,
+                                       const std::uint32_t c) {
+    if (a <= b && a <= c) return {a, b, c};
+    if (b <= a && b <= c) return {b, c, a};
+    return {c, a, b};
+}
+
+/// @brief 三角形の集合 (巡回順を保った正規形の整列済み列) を求める
+std::vector<std::array<std::uint32_t, 3>> TriangleSet(
+        const std::vector<std::uint32_t>& indices) {
+    std::vector<std::array<std::uint32_t, 3>> set;
+    for (std::size_t t = 0; t + 2 < indices.size(); t += 3) {
+        set.push_back(Canonical(indices[t], indices[t + 1], indices[t + 2]));
+    }
+    std::sort(set.begin(), set.end());
+    return set;
+}
+
+/// @brief 各三角形の頂点座標 (巡回順を保った正規形) の整列済み列を求める
+std::vector<std::array<double, 9>> TriangleCoordinates(const TriangleMeshd& mesh) {
+    std::vector<std::array<double, 9>> result;
+    for (std::size_t t = 0; t < mesh.TriangleCount(); ++t) {
+        std::array<std::array<double, 3>, 3> corners;
+        for (int k = 0; k < 3; ++k) {
+            const auto v = mesh.indices[3 * t + k];
+            corners[k] = {mesh.positions(0, v), mesh.positions(1, v),
+                          mesh.positions(2, v)};
+        }
+        const auto first = std::min_element(corners.begin(), corners.end());
+        std::rotate(corners.begin(), first, corners.end());
+        std::array<double, 9> flat;
+        for (int k = 0; k < 9; ++k) flat[k] = corners[k / 3][k % 3];
+        result.push_back(flat);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+}  // namespace
+
+
+
+/**
+ * 頂点キャッシュ最適化
+ */
+
+// 三角形の集合・向きを保ち、ランダムな順序よりキャッシュミスを大きく減らす
+TEST(OptimizeVertexCacheTest, ReducesCacheMissesOfShuffledGrid) {
+    const auto mesh = MakeShuffledGrid(64, 1);
+    const auto n = mesh.VertexCount();
+
+    const auto optimized = i_num::OptimizeVertexCache(mesh.indices, n);
+    ASSERT_EQ(optimized.size(), mesh.indices.size());
+    EXPECT_EQ(TriangleSet(optimized), TriangleSet(mesh.indices));
+
+    const double before = i_num::ComputeAverageCacheMissRatio(mesh.indices, n);
+    const double after = i_num::ComputeAverageCacheMissRatio(optimized, n);
+    // 格子 (頂点あたり約2三角形) のACMRの下限は約0.5
+    EXPECT_GT(before, 2.0);
+    EXPECT_LT(after, 0.8);
+}
+
+// 端数のインデックス・空の入力・孤立した三角形
+TEST(OptimizeVertexCacheTest, HandlesDegenerateInput) {
+    EXPECT_TRUE(i_num::OptimizeVertexCache({}, 0).empty());
+    EXPECT_EQ(i_num::ComputeAverageCacheMissRatio({}, 0), 0.0);
+
+    // 互いに頂点を共有しない三角形と、三角形を成さない端数
+    const std::vector<std::uint32_t> indices = {0, 1, 2, 3, 4, 5, 6, 7, 8, 1};
+    const auto optimized = i_num::OptimizeVertexCache(indices, 9);
+    ASSERT_EQ(optimized.size(), indices.size());
+    EXPECT_EQ(TriangleSet(optimized), TriangleSet(indices));
+    EXPECT_EQ(optimized.back(), 1u);
+}
+
+
+
+/**
+ * 頂点フェッチ最適化
+ */
+
+// 頂点は最初に参照される順に並び、参照されない頂点は後ろに残る
+TEST(ComputeVertexFetchRemapTest, OrdersByFirstUse) {
+    const std::vector<std::uint32_t> indices = {3, 1, 4, 1, 4, 0};
+    const auto remap = i_num::ComputeVertexFetchRemap(indices, 6);
+    const std::vector<std::uint32_t> expected = {3, 1, 4, 0, 2, 5};
+    EXPECT_EQ(remap, expected);
+}
+
+// 並べ替え後も各三角形の頂点座標を保ち、頂点は最初に参照される順に並ぶ
+TEST(OptimizeForRenderingTest, PreservesGeometryAndOrdersVertices) {
+    auto mesh = MakeShuffledGrid(16, 2);
+    const auto original = mesh;
+
+    i_num::OptimizeForRendering(mesh);
+    ASSERT_EQ(mesh.VertexCount(), original.VertexCount());
+    ASSERT_EQ(mesh.indices.size(), original.indices.size());
+    EXPECT_EQ(TriangleCoordinates(mesh), TriangleCoordinates(original));
+
+    // 各頂点の法線・UVは位置と同じ対応で並べ替えられる
+    for (Eigen::Index c = 0; c < mesh.positions.cols(); ++c) {
+        EXPECT_NEAR(mesh.uvs(0, c), mesh.positions(0, c) / 16.0, 1e-12);
+        EXPECT_NEAR(mesh.uvs(1, c), mesh.positions(1, c) / 16.0, 1e-12);
+    }
+
+    // インデックス列で初めて現れる頂点番号は、0から順に増える
+    std::uint32_t next = 0;
+    for (const auto index : mesh.indices) {
+        ASSERT_LE(index, next);
+        if (index == next) ++next;
+    }
+    EXPECT_LT(i_num::ComputeAverageCacheMissRatio(mesh.indices, mesh.VertexCount()),
+              i_num::ComputeAverageCacheMissRatio(original.indices,
+                                                  original.VertexCount()));
+}
+
+// 面グループの三角形範囲の内側でのみ並べ替える
+TEST(OptimizeForRenderingTest, KeepsTrianglesWithinGroups) {
+    auto mesh = MakeShuffledGrid(8, 3);
+    const std::uint32_t half = static_cast<std::uint32_t>(mesh.TriangleCount() / 2);
+    mesh.groups.push_back({"a", "", 0, half});
+    mesh.groups.push_back(
+            {"b", "", half, static_cast<std::uint32_t>(mesh.TriangleCount()) - half});
+    const auto original = mesh;
+
+    i_num::OptimizeForRendering(mesh);
+    for (const auto& group : original.groups) {
+        const auto range = [&group](const TriangleMeshd& m) {
+            TriangleMeshd sub;
+            sub.positions = m.positions;
+            sub.indices.assign(m.indices.begin() + 3 * group.first_triangle,
+                               m.indices.begin() + 3 * (group.first_triangle
+                                                        + group.triangle_count));
+            return TriangleCoordinates(sub);
+        };
+        EXPECT_EQ(range(mesh), range(original)) << group.name;
+
+        // 範囲ごとに頂点を局所番号へ詰めても、三角形の順序は
+        // 全体の頂点番号のまま最適化した場合と一致する
+        const auto expected = i_num::OptimizeVertexCache(
+                std::vector<std::uint32_t>(
+                        original.indices.begin() + 3 * group.first_triangle,
+                        original.indices.begin() + 3 * (group.first_triangle
+                                                        + group.triangle_count)),
+                original.VertexCount());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            const auto actual = mesh.indices[3 * group.first_triangle + i];
+            ASSERT_EQ(mesh.positions.col(actual), original.positions.col(expected[i]))
+                    << group.name << ", i = " << i;
+        }
+    }
+}
+
+
+
+/**
+ * 量子化
+ */
+
+// snorm16の往復誤差は1/32767の半分以下、範囲外はクランプする
+TEST(QuantizationTest, Snorm16RoundTrip) {
+    for (const double value : {-1.0, -0.5, -1e-6, 0.0, 0.123456, 0.9999, 1.0}) {
+        const double restored = i_num::DequantizeSnorm16(i_num::QuantizeSnorm16(value));
+        EXPECT_LE(std::abs(restored - value), 0.5 / 32767.0 + 1e-15) << value;
+    }
+    EXPECT_EQ(i_num::QuantizeSnorm16(2.0), 32767);
+    EXPECT_EQ(i_num::QuantizeSnorm16(-2.0), -32767);
+    EXPECT_EQ(i_num::DequantizeSnorm16(-32768), -1.0);
+}
+
+// 八面体符号化の往復で、方向の誤差は1e-4 rad未満 (両半球・座標軸方向)
+TEST(QuantizationTest, OctahedralNormalRoundTrip) {
+    std::vector<Vector3d> directions = {
+        {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1},
+        {1, 1, 1}, {-1, 2, -3}, {0.3, -0.2, -0.9}};
+    std::mt19937 engine(4);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    for (int i = 0; i < 1000; ++i) {
+        directions.emplace_back(normal(engine), normal(engine), normal(engine));
+    }
+    for (const auto& d : directions) {
+        const Vector3d n = d.normalized();
+        const Vector3d restored = i_num::DecodeOctahedral(i_num::EncodeOctahedral(n));
+        EXPECT_NEAR(restored.norm(), 1.0, 1e-12);
+        EXPECT_LT(std::acos(std::min(1.0, n.dot(restored))), 1e-4)
+                << n.transpose();
+    }
+    // ゼロベクトルは+z方向となる
+    EXPECT_TRUE(i_num::DecodeOctahedral(i_num::EncodeOctahedral(Vector3d::Zero()))
+                        .isApprox(Vector3d(0, 0, 1)));
+}
+
+// 位置の量子化誤差はバウンディングボックスの辺の長さの1/65534以下
+TEST(QuantizationTest, PositionsWithinBoundingBoxResolution) {
+    const auto mesh = MakeShuffledGrid(10, 5);  // x, y: [0, 10], z: [0, 10]
+    const auto quantized = i_num::QuantizePositions(mesh);
+    ASSERT_EQ(quantized.values.size(), 3 * mesh.VertexCount());
+    for (std::size_t v = 0; v < mesh.VertexCount(); ++v) {
+        const Vector3d p = mesh.positions.col(static_cast<Eigen::Index>(v));
+        EXPECT_LE((quantized.Dequantize(v) - p).cwiseAbs().maxCoeff(),
+                  10.0 / 65534.0 + 1e-12);
+    }
+
+    // 厚みの無い軸は0とする
+    TriangleMeshd flat;
+    flat.positions.resize(3, 2);
+    flat.positions << 0.0, 2.0,
+                      1.0, 1.0,
+                      5.0, 5.0;
+    const auto q = i_num::QuantizePositions(flat);
+    EXPECT_EQ(q.scale.y(), 0.0);
+    EXPECT_TRUE(q.Dequantize(1).isApprox(Vector3d(2.0, 1.0, 5.0)));
+
+    EXPECT_EQ(i_num::QuantizeNormals(mesh).size(), 2 * mesh.VertexCount());
+    EXPECT_TRUE(i_num::QuantizeNormals(flat).empty());
+}
@@ -0,0 +1,235 @@
+/**
+ * @file tests/numerics/test_mesh_simplification.cpp
+ * @brief 三角形メッシュの二次誤差尺度 (QEM) による簡略化の検証
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ * @note テスト対象:
+ *       - `SimplifyMesh`
+ *         - 目標の三角形数まで減らし、面の向きを反転させないこと
+ *         - 境界・面グループの境界 (特徴線) を保つこと
+ *         - 誤差の上限を守ること (平面は誤差なしで大きく減らせること)
+ *         - クラスタ並列の経路でも同じ条件を満たすこと
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "igesio/numerics/meshes/triangle_mesh.h"
+#include "igesio/numerics/meshes/algorithms.h"
+
+#include "meshes_for_testing.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+namespace i_test = igesio::tests;
+using igesio::Vector3d;
+using i_num::TriangleMeshd;
+
+/// @brief [0, n]×[0, n] の高さ場の格子メッシュを作成する
+/// @param n 分割数
+/// @param amplitude 高さ z = amplitude * sin(x/4) * cos(y/4) の振幅 (0=平面)
+TriangleMeshd MakeHeightField(const int n, const double amplitude) {
+    return i_test::MakeGridMesh(
+            n, [amplitude](const int i, const int j) {
+                return Vector3d(i, j, amplitude * std::sin(i / 4.0) * std::cos(j / 4.0));
+            }, /*with_attributes=*/true);
+}
+
+/// @brief メッシュの三角形の頂点位置を取得する
+Vector3d Corner(const TriangleMeshd& mesh, const std::size_t t, const int k) {
+    return mesh.positions.col(mesh.indices[3 * t + k]);
+}
+
+/// @brief 全三角形の面法線が+z側を向くか (高さ場で面が反転していないか)
+bool AllFacesUp(const TriangleMeshd& mesh) {
+    for (std::size_t t = 0; t < mesh.TriangleCount(); ++t) {
+        const Vector3d n = (Corner(mesh, t, 1) - Corner(mesh, t, 0))
+                                   .cross(Corner(mesh, t, 2) - Corner(mesh, t, 0));
+        if (!(n.z() > 0.0)) return false;
+    }
+    return true;
+}
+
+/// @brief 全三角形をxy平面へ投影した面積の合計
+double ProjectedArea(const TriangleMeshd& mesh) {
+    double area = 0.0;
+    for (std::size_t t = 0; t < mesh.TriangleCount(); ++t) {
+        const Vector3d n = (Corner(mesh, t, 1) - Corner(mesh, t, 0))
+                                   .cross(Corner(mesh, t, 2) - Corner(mesh, t, 0));
+        area += 0.5 * n.z();
+    }
+    return area;
+}
+
+/// @brief 境界辺 (1枚の三角形のみが持つ辺) の頂点が、正方形 [0, n]^2 の外周上にあるか
+bool BoundaryOnSquare(const TriangleMeshd& mesh, const double n) {
+    const auto edges = i_num::ExtractMeshEdges(mesh, -1.0).feature_edges;
+    const auto on_square = [&](const Vector3d& p) {
+        return std::abs(p.x()) < 1e-9 || std::abs(p.x() - n) < 1e-9 ||
+               std::abs(p.y()) < 1e-9 || std::abs(p.y() - n) < 1e-9;
+    };
+    for (const auto& e : edges) {
+        if (!on_square(mesh.positions.col(e[0])) ||
+            !on_square(mesh.positions.col(e[1]))) {
+            return false;
+        }
+    }
+    return !edges.empty();
+}
+
+}  // namespace
+
+
+
+/**
+ * 目標の三角形数
+ */
+
+// 目標の三角形数以下まで減らし、面の向き・境界・属性の整合を保つ
+TEST(MeshSimplificationTest, ReachesTargetTriangleCount) {
+    const auto mesh = MakeHeightField(48, 2.0);
+    i_num::MeshSimplificationParams params;
+    params.target_triangle_count = 500;
+    params.parallel = false;
+    double error = -1.0;
+    const auto result = i_num::SimplifyMesh(mesh, params, &error);
+
+    EXPECT_TRUE(i_num::Validate(result).is_valid);
+    EXPECT_LE(result.TriangleCount(), 500u);
+    EXPECT_GT(result.TriangleCount(), 0u);
+    EXPECT_LT(result.VertexCount(), mesh.VertexCount());
+    EXPECT_EQ(result.normals.cols(), result.positions.cols());
+    EXPECT_EQ(result.uvs.cols(), result.positions.cols());
+    EXPECT_GT(error, 0.0);
+    EXPECT_TRUE(AllFacesUp(result));
+    EXPECT_TRUE(BoundaryOnSquare(result, 48.0));
+    EXPECT_NEAR(ProjectedArea(result), 48.0 * 48.0, 1e-6);
+}
+
+// 単精度のメッシュも簡略化できる
+TEST(MeshSimplificationTest, SimplifiesFloatMesh) {
+    const auto mesh = i_num::CastScalar<float>(MakeHeightField(16, 1.0));
+    i_num::MeshSimplificationParams params;
+    params.target_triangle_count = 100;
+    const auto result = i_num::SimplifyMesh(mesh, params);
+    EXPECT_TRUE(i_num::Validate(result).is_valid);
+    EXPECT_LE(result.TriangleCount(), 100u);
+}
+
+
+
+/**
+ * 特徴線の保持
+ */
+
+// 正方形の角 (特徴線の端点) は動かず、境界は正方形の外周上に残る
+TEST(MeshSimplificationTest, PreservesBoundaryCorners) {
+    const auto mesh = MakeHeightField(16, 0.0);
+    const auto result = i_num::SimplifyMesh(mesh, {});
+
+    EXPECT_TRUE(BoundaryOnSquare(result, 16.0));
+    EXPECT_NEAR(ProjectedArea(result), 16.0 * 16.0, 1e-9);
+    for (const auto& corner : {Vector3d(0, 0, 0), Vector3d(16, 0, 0),
+                               Vector3d(0, 16, 0), Vector3d(16, 16, 0)}) {
+        bool found = false;
+        for (Eigen::Index v = 0; v < result.positions.cols(); ++v) {
+            found = found || (result.positions.col(v) - corner).norm() < 1e-12;
+        }
+        EXPECT_TRUE(found) << corner.transpose();
+    }
+}
+
+// 特徴線を保持しない場合は境界も縮約する (平面は最小限まで減る)
+TEST(MeshSimplificationTest, CollapsesBoundaryWithoutFeatures) {
+    const auto mesh = MakeHeightField(16, 0.0);
+    i_num::MeshSimplificationParams params;
+    params.preserve_features = false;
+    const auto preserved = i_num::SimplifyMesh(mesh, {});
+    const auto collapsed = i_num::SimplifyMesh(mesh, params);
+    EXPECT_TRUE(i_num::Validate(collapsed).is_valid);
+    EXPECT_LT(collapsed.TriangleCount(), preserved.TriangleCount());
+}
+
+// 面グループの境界を越えて縮約せず、グループの範囲を付け直す
+TEST(MeshSimplificationTest, PreservesGroupBoundaries) {
+    constexpr int kN = 24;
+    auto mesh = MakeHeightField(kN, 1.0);
+    // 下半分 (y < kN/2) と上半分を別のグループとする
+    const auto half = static_cast<std::uint32_t>(mesh.TriangleCount() / 2);
+    mesh.groups.push_back({"lower", "", 0, half});
+    mesh.groups.push_back({"upper", "", half, half});
+
+    i_num::MeshSimplificationParams params;
+    params.target_triangle_count = 200;
+    const auto result = i_num::SimplifyMesh(mesh, params);
+
+    ASSERT_EQ(result.groups.size(), 2u);
+    EXPECT_EQ(result.groups[0].first_triangle, 0u);
+    EXPECT_EQ(result.groups[1].first_triangle, result.groups[0].triangle_count);
+    EXPECT_EQ(result.groups[0].triangle_count + result.groups[1].triangle_count,
+              result.TriangleCount());
+    for (std::size_t t = 0; t < result.TriangleCount(); ++t) {
+        const double y = (Corner(result, t, 0).y() + Corner(result, t, 1).y()
+                        + Corner(result, t, 2).y()) / 3.0;
+        if (t < result.groups[0].triangle_count) {
+            EXPECT_LT(y, kN / 2.0);
+        } else {
+            EXPECT_GT(y, kN / 2.0);
+        }
+    }
+}
+
+
+
+/**
+ * 誤差の上限
+ */
+
+// 平面は誤差なしで大きく減らせ、曲面は誤差の上限で縮約が止まる
+TEST(MeshSimplificationTest, RespectsMaxError) {
+    i_num::MeshSimplificationParams params;
+    params.max_error = 1e-9;
+    double error = -1.0;
+    const auto plane = i_num::SimplifyMesh(MakeHeightField(32, 0.0), params, &error);
+    EXPECT_LE(error, 1e-9);
+    EXPECT_LE(plane.TriangleCount(), 64u);
+
+    const auto curved = MakeHeightField(32, 2.0);
+    params.max_error = 0.05;
+    const auto fine = i_num::SimplifyMesh(curved, params, &error);
+    EXPECT_LE(error, 0.05);
+    params.max_error = 0.5;
+    const auto coarse = i_num::SimplifyMesh(curved, params, &error);
+    EXPECT_LE(error, 0.5);
+    EXPECT_LT(fine.TriangleCount(), curved.TriangleCount());
+    EXPECT_LT(coarse.TriangleCount(), fine.TriangleCount());
+}
+
+
+
+/**
+ * クラスタ並列
+ */
+
+// クラスタ並列の経路でも目標の三角形数・面の向き・境界を保つ
+TEST(MeshSimplificationTest, ClusterParallelMatchesConstraints) {
+    const auto mesh = MakeHeightField(64, 2.0);
+    i_num::MeshSimplificationParams params;
+    params.target_triangle_count = 800;
+    params.cluster_triangle_count = 1024;
+    const auto parallel = i_num::SimplifyMesh(mesh, params);
+    params.parallel = false;
+    const auto serial = i_num::SimplifyMesh(mesh, params);
+
+    for (const auto* result : {&parallel, &serial}) {
+        EXPECT_TRUE(i_num::Validate(*result).is_valid);
+        EXPECT_LE(result->TriangleCount(), 800u);
+        EXPECT_TRUE(AllFacesUp(*result));
+        EXPECT_TRUE(BoundaryOnSquare(*result, 64.0));
+        EXPECT_NEAR(ProjectedArea(*result), 64.0 * 64.0, 1e-6);
+    }
+}
@@ -8,6 +8,8 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <limits>
+#include <random>
 #include <stdexcept>
 #include <vector>
 
@@ -100,6 +102,73 @@ i_num::CurveContainmentPolygons MakeUnitCirclePolygons() {
     return {MakeCircumscribed(), MakeInscribed(), MakeApproximate()};
 }
 
+/// @brief 波打つ閉曲線 r(t) = 1 + 0.3 sin(7t) の多角形を構築する (頂点数の多い境界)
+/// @param n 近似多角形の頂点数 (外包・内包多角形はその半分)
+/// @note 外包多角形は曲線を1.05倍、内包多角形は0.95倍に拡大縮小した点列とし、
+///       外包多角形はon_curve=true/falseの頂点を交互に持つ
+i_num::CurveContainmentPolygons MakeWavyPolygons(const int n) {
+    i_num::CurveContainmentPolygons polygons;
+    const auto point = [](const double t, const double scale) {
+        const double r = scale * (1.0 + 0.3 * std::sin(7.0 * t));
+        return Vector3d(r * std::cos(t), r * std::sin(t), 0.0);
+    };
+    for (int k = 0; k < n; ++k) {
+        const double t = 2.0 * kPi * k / n;
+        polygons.approximate.vertices.push_back(point(t, 1.0));
+        polygons.approximate.on_curve.push_back(true);
+        polygons.approximate.curve_params.push_back(t);
+        if (k % 2 != 0) continue;
+        const bool on_curve = (k % 4 == 0);
+        polygons.circumscribed.vertices.push_back(point(t, 1.05));
+        polygons.circumscribed.on_curve.push_back(on_curve);
+        polygons.circumscribed.curve_params.push_back(on_curve ? t : 0.0);
+        polygons.inscribed.vertices.push_back(point(t, 0.95));
+        polygons.inscribed.on_curve.push_back(true);
+        polygons.inscribed.curve_params.push_back(t);
+    }
+    return polygons;
+}
+
+/// @brief 格子版の判定が、格子を用いない判定と全ての点で一致することを確認する
+/// @param polygons 対象の多角形
+/// @param points 判定する点のリスト
+void ExpectGridMatchesLinear(const i_num::CurveContainmentPolygons& polygons,
+                             const std::vector<Vector3d>& points) {
+    const auto grid = i_num::BuildPolygonContainmentGrid(polygons);
+    ASSERT_FALSE(grid.IsEmpty());
+    int inside = 0;
+    for (const auto& p : points) {
+        const bool expected = i_num::IsPointInPolygon(p, polygons);
+        EXPECT_EQ(i_num::IsPointInPolygon(p, polygons, grid), expected)
+            << "point = (" << p.x() << ", " << p.y() << ")";
+        if (expected) ++inside;
+    }
+    // 判定が自明 (全て内部/全て外部) でないこと
+    EXPECT_GT(inside, 0);
+    EXPECT_LT(inside, static_cast<int>(points.size()));
+}
+
+/// @brief 多角形の範囲を含む矩形内の乱数点と、全多角形の頂点・辺の中点を列挙する
+std::vector<Vector3d> MakeQueryPoints(
+        const i_num::CurveContainmentPolygons& polygons, const double extent,
+        const int count, const unsigned int seed) {
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<double> coord(-extent, extent);
+    std::vector<Vector3d> points;
+    for (int i = 0; i < count; ++i) {
+        points.emplace_back(coord(engine), coord(engine), 0.0);
+    }
+    for (const auto* poly : {&polygons.circumscribed, &polygons.inscribed,
+                             &polygons.approximate}) {
+        const auto& v = poly->vertices;
+        for (size_t i = 0; i < v.size(); ++i) {
+            points.push_back(v[i]);
+            points.push_back((v[i] + v[(i + 1) % v.size()]) / 2.0);
+        }
+    }
+    return points;
+}
+
 }  // namespace
 
 
@@ -314,3 +383,50 @@ TEST(IsPointInPolygonTest, BoundaryZone_InsideCurve_WrapAround_ReturnsTrue) {
     const auto polygons = MakeUnitCirclePolygons();
     EXPECT_TRUE(i_num::IsPointInPolygon(Vector3d(0.91, -0.37, 0.0), polygons));
 }
+
+
+
+/**
+ * BuildPolygonContainmentGrid / IsPointInPolygon (格子版) のテスト
+ */
+
+/// @brief 単位円の多角形で、格子版の判定が格子を用いない判定と一致する
+TEST(PolygonContainmentGridTest, MatchesLinearOnUnitCircle) {
+    const auto polygons = MakeUnitCirclePolygons();
+    ExpectGridMatchesLinear(polygons, MakeQueryPoints(polygons, 1.5, 2000, 1));
+}
+
+/// @brief 頂点数の多い境界で、格子版の判定が格子を用いない判定と一致する
+/// (境界付近の点は近傍のセルのみから最近傍辺を探索する)
+TEST(PolygonContainmentGridTest, MatchesLinearOnDenseBoundary) {
+    const auto polygons = MakeWavyPolygons(1000);
+    const auto grid = i_num::BuildPolygonContainmentGrid(polygons);
+    EXPECT_GT(grid.nx * grid.ny, 100);
+    EXPECT_TRUE(grid.approximate_sorted);
+    ExpectGridMatchesLinear(polygons, MakeQueryPoints(polygons, 1.6, 2000, 2));
+}
+
+/// @brief 格子の範囲外の点・有限でない座標の点は外部と判定する
+TEST(PolygonContainmentGridTest, PointsOutsideGridAreOutside) {
+    const auto polygons = MakeUnitCirclePolygons();
+    const auto grid = i_num::BuildPolygonContainmentGrid(polygons);
+    EXPECT_FALSE(i_num::IsPointInPolygon(Vector3d(5.0, 0.0, 0.0), polygons, grid));
+    EXPECT_FALSE(i_num::IsPointInPolygon(Vector3d(-5.0, 0.0, 0.0), polygons, grid));
+    EXPECT_FALSE(i_num::IsPointInPolygon(Vector3d(0.0, 5.0, 0.0), polygons, grid));
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(i_num::IsPointInPolygon(Vector3d(nan, 0.0, 0.0), polygons, grid));
+    EXPECT_FALSE(i_num::IsPointInPolygon(Vector3d(0.0, nan, 0.0), polygons, grid));
+}
+
+/// @brief 有限でない頂点を含む場合は無効な格子となり、格子を用いない判定に委譲する
+TEST(PolygonContainmentGridTest, NonFiniteVertexYieldsEmptyGrid) {
+    auto polygons = MakeUnitCirclePolygons();
+    polygons.inscribed.vertices[0].x() = std::numeric_limits<double>::infinity();
+    const auto grid = i_num::BuildPolygonContainmentGrid(polygons);
+    EXPECT_TRUE(grid.IsEmpty());
+    for (const auto& p : {Vector3d(0.0, 0.0, 0.0), Vector3d(0.95, 0.4, 0.0),
+                          Vector3d(2.0, 0.0, 0.0)}) {
+        EXPECT_EQ(i_num::IsPointInPolygon(p, polygons, grid),
+                  i_num::IsPointInPolygon(p, polygons));
+    }
+}
@@ -0,0 +1,185 @@
+/**
+ * @file numerics/test_polygon_triangulation.cpp
+ * @brief numerics/geometric/polygon_triangulation.hのテスト
+ * @author Yayoi Habami
+ * @date 2026-10-18
+ * @copyright 2026 Yayoi Habami
+ *
+ * テスト対象:
+ *   - TriangulatePolygon: 三角形数 (n + 2h - 2)・面積の保存・向き (反時計回り)・
+ *                         入力の辺をちょうど1回ずつ含むこと (凹多角形・穴・
+ *                         共線の頂点・時計回りの入力)、範囲外の頂点番号
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "igesio/numerics/geometric/polygon_triangulation.h"
+
+namespace {
+
+namespace i_num = igesio::numerics;
+using igesio::Vector2d;
+using Triangles = std::vector<std::array<std::uint32_t, 3>>;
+using Loop = std::vector<std::uint32_t>;
+
+/// @brief 三角形の符号付き面積
+double SignedArea(const std::vector<Vector2d>& points,
+                  const std::array<std::uint32_t, 3>& tri) {
+    const auto& a = points[tri[0]];
+    const auto& b = points[tri[1]];
+    const auto& c = points[tri[2]];
+    return 0.5 * ((b.x() - a.x()) * (c.y() - a.y()) -
+                  (b.y() - a.y()) * (c.x() - a.x()));
+}
+
+/// @brief 全三角形の符号付き面積の和
+double TotalArea(const std::vector<Vector2d>& points, const Triangles& triangles) {
+    double area = 0.0;
+    for (const auto& tri : triangles) area += SignedArea(points, tri);
+    return area;
+}
+
+/// @brief 無向辺ごとの使用回数
+std::map<std::pair<std::uint32_t, std::uint32_t>, int> EdgeUseCount(
+        const Triangles& triangles) {
+    std::map<std::pair<std::uint32_t, std::uint32_t>, int> count;
+    for (const auto& tri : triangles) {
+        for (int k = 0; k < 3; ++k) {
+            const auto a = tri[k], b = tri[(k + 1) % 3];
+            count[{std::min(a, b), std::max(a, b)}]++;
+        }
+    }
+    return count;
+}
+
+/// @brief 入力のループの辺がちょうど1回、それ以外の辺が2回使われることを検証する
+void ExpectBoundaryEdgesUsedOnce(const Triangles& triangles,
+                                 const std::vector<Loop>& loops) {
+    auto count = EdgeUseCount(triangles);
+    for (const auto& loop : loops) {
+        for (std::size_t k = 0; k < loop.size(); ++k) {
+            const auto a = loop[k], b = loop[(k + 1) % loop.size()];
+            const auto key = std::make_pair(std::min(a, b), std::max(a, b));
+            EXPECT_EQ(count[key], 1) << "boundary edge " << a << "-" << b;
+            count.erase(key);
+        }
+    }
+    for (const auto& [edge, used] : count) {
+        EXPECT_EQ(used, 2) << "interior edge " << edge.first << "-" << edge.second;
+    }
+}
+
+/// @brief 全ての三角形が反時計回り (面積が負でない) であることを検証する
+void ExpectCounterClockwise(const std::vector<Vector2d>& points,
+                            const Triangles& triangles) {
+    for (const auto& tri : triangles) {
+        EXPECT_GE(SignedArea(points, tri), 0.0);
+    }
+}
+
+}  // namespace
+
+
+
+/**
+ * TriangulatePolygon
+ */
+
+// 正方形: 2つの反時計回りの三角形
+TEST(PolygonTriangulationTest, Square) {
+    const std::vector<Vector2d> points{{0., 0.}, {1., 0.}, {1., 1.}, {0., 1.}};
+    const Loop outer{0, 1, 2, 3};
+    const auto triangles = i_num::TriangulatePolygon(points, outer);
+
+    ASSERT_EQ(triangles.size(), 2u);
+    ExpectCounterClockwise(points, triangles);
+    EXPECT_NEAR(TotalArea(points, triangles), 1.0, 1e-12);
+    ExpectBoundaryEdgesUsedOnce(triangles, {outer});
+}
+
+// 時計回りの入力も反時計回りの三角形になる
+TEST(PolygonTriangulationTest, ClockwiseInput) {
+    const std::vector<Vector2d> points{{0., 0.}, {1., 0.}, {1., 1.}, {0., 1.}};
+    const Loop outer{3, 2, 1, 0};
+    const auto triangles = i_num::TriangulatePolygon(points, outer);
+
+    ASSERT_EQ(triangles.size(), 2u);
+    ExpectCounterClockwise(points, triangles);
+    EXPECT_NEAR(TotalArea(points, triangles), 1.0, 1e-12);
+}
+
+// 凹多角形 (櫛形)
+TEST(PolygonTriangulationTest, ConcaveComb) {
+    const std::vector<Vector2d> points{
+        {0., 0.}, {5., 0.}, {5., 3.}, {4., 3.}, {4., 1.}, {3., 1.},
+        {3., 3.}, {2., 3.}, {2., 1.}, {1., 1.}, {1., 3.}, {0., 3.}};
+    Loop outer(points.size());
+    for (std::size_t k = 0; k < points.size(); ++k) outer[k] = k;
+    const auto triangles = i_num::TriangulatePolygon(points, outer);
+
+    ASSERT_EQ(triangles.size(), points.size() - 2);
+    ExpectCounterClockwise(points, triangles);
+    // 5×3 から 1×2 の切り欠き2つを除く
+    EXPECT_NEAR(TotalArea(points, triangles), 15.0 - 4.0, 1e-12);
+    ExpectBoundaryEdgesUsedOnce(triangles, {outer});
+}
+
+// 辺上の共線の頂点は除かれずに三角形の頂点となる
+TEST(PolygonTriangulationTest, CollinearVerticesAreKept) {
+    const std::vector<Vector2d> points{
+        {0., 0.}, {0.5, 0.}, {1., 0.}, {1., 0.5}, {1., 1.},
+        {0.5, 1.}, {0., 1.}, {0., 0.5}};
+    const Loop outer{0, 1, 2, 3, 4, 5, 6, 7};
+    const auto triangles = i_num::TriangulatePolygon(points, outer);
+
+    ASSERT_EQ(triangles.size(), 6u);
+    ExpectCounterClockwise(points, triangles);
+    EXPECT_NEAR(TotalArea(points, triangles), 1.0, 1e-12);
+    ExpectBoundaryEdgesUsedOnce(triangles, {outer});
+}
+
+// 穴が2つある多角形: n + 2h - 2 個の三角形で、穴を覆わない
+TEST(PolygonTriangulationTest, PolygonWithTwoHoles) {
+    const std::vector<Vector2d> points{
+        {0., 0.}, {6., 0.}, {6., 4.}, {0., 4.},   // 外周
+        {1., 1.}, {2., 1.}, {2., 3.}, {1., 3.},   // 穴1 (反時計回り)
+        {4., 1.}, {4., 3.}, {5., 3.}, {5., 1.}};  // 穴2 (時計回り)
+    const Loop outer{0, 1, 2, 3};
+    const std::vector<Loop> holes{{4, 5, 6, 7}, {8, 9, 10, 11}};
+    const auto triangles = i_num::TriangulatePolygon(points, outer, holes);
+
+    ASSERT_EQ(triangles.size(), 12u + 2u * 2u - 2u);
+    ExpectCounterClockwise(points, triangles);
+    EXPECT_NEAR(TotalArea(points, triangles), 24.0 - 2.0 - 2.0, 1e-12);
+    ExpectBoundaryEdgesUsedOnce(triangles, {outer, holes[0], holes[1]});
+}
+
+// 穴の頂点と外周の頂点が同じx座標に並ぶ場合 (橋の探索の縮退)
+TEST(PolygonTriangulationTest, HoleAlignedWithOuterVertices) {
+    const std::vector<Vector2d> points{
+        {0., 0.}, {2., 0.}, {4., 0.}, {4., 2.}, {4., 4.}, {2., 4.}, {0., 4.},
+        {1., 2.}, {2., 1.}, {3., 2.}, {2., 3.}};
+    const Loop outer{0, 1, 2, 3, 4, 5, 6};
+    const std::vector<Loop> holes{{7, 8, 9, 10}};
+    const auto triangles = i_num::TriangulatePolygon(points, outer, holes);
+
+    ASSERT_EQ(triangles.size(), 11u);
+    ExpectCounterClockwise(points, triangles);
+    EXPECT_NEAR(TotalArea(points, triangles), 16.0 - 2.0, 1e-12);
+    ExpectBoundaryEdgesUsedOnce(triangles, {outer, holes[0]});
+}
+
+// 3頂点未満の外周は空、範囲外の頂点番号は例外
+TEST(PolygonTriangulationTest, DegenerateAndInvalidInput) {
+    const std::vector<Vector2d> points{{0., 0.}, {1., 0.}, {1., 1.}};
+    EXPECT_TRUE(i_num::TriangulatePolygon(points, {0, 1}).empty());
+    EXPECT_THROW(i_num::TriangulatePolygon(points, {0, 1, 5}), std::out_of_range);
+}
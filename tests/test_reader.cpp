@@ -8,10 +8,16 @@
 #include <gtest/gtest.h>
 
 #include <filesystem>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "igesio/common/errors.h"
+#include "igesio/common/iges_parameter_vector.h"
 #include "igesio/reader.h"
+#include "igesio/entities/curves/curve_on_a_parametric_surface.h"
+#include "igesio/entities/curves/line.h"
+#include "igesio/entities/surfaces/rational_b_spline_surface.h"
 
 namespace {
 
@@ -25,6 +31,28 @@ const std::string kTestIgesDirPath =
 const std::string kSingleRoundCubePath =
         fs::path(kTestIgesDirPath).append("single_rounded_cube.iges").string();
 
+/// @brief 双一次B-Splineサーフェス S(u,v) = (sx*u, v, z) を構築する
+std::shared_ptr<iio::entities::RationalBSplineSurface>
+MakeBilinearSurface(const double sx, const double z) {
+    return iio::entities::MakeRationalBSplineSurface(
+        {1, 1},
+        {{iio::Vector3d(0.0, 0.0, z), iio::Vector3d(0.0, 1.0, z)},
+         {iio::Vector3d(sx, 0.0, z), iio::Vector3d(sx, 1.0, z)}},
+        {0.0, 0.0, 1.0, 1.0}, {0.0, 0.0, 1.0, 1.0});
+}
+
+/// @brief BPTR=0 (ベース曲線省略) のType 142を構築する (参照は未解決)
+std::shared_ptr<iio::entities::CurveOnAParametricSurface> MakeCosWithOmittedB(
+        const iio::ObjectID& surface_id, const iio::ObjectID& curve_id) {
+    namespace i_ent = iio::entities;
+    return std::make_shared<i_ent::CurveOnAParametricSurface>(
+        i_ent::RawEntityDE::ByDefault(i_ent::EntityType::kCurveOnAParametricSurface),
+        iio::IGESParameterVector{
+            static_cast<int>(i_ent::CurveCreationType::kUnspecified),
+            surface_id, iio::IDGenerator::UnsetID(), curve_id,
+            static_cast<int>(i_ent::PreferredRepresentation::kUnspecified)});
+}
+
 }  // namespace
 
 
@@ -93,3 +121,63 @@ TEST(ReadIgesIntermediateTest, InvalidDEParameter) {
             << " Actual message: " << message;
     }
 }
+
+
+
+/*******************************************************************************
+ * ReconstructOmittedBaseCurvesのテスト
+ *****************************************************************************/
+
+// 曲面を共有するものを含む複数のType 142について、Bを再構築してモデルへ登録する
+TEST(ReconstructOmittedBaseCurvesTest, RebuildsAndRegistersAllBaseCurves) {
+    namespace i_ent = iio::entities;
+    const auto surface_a = MakeBilinearSurface(2.0, 0.0);
+    const auto surface_b = MakeBilinearSurface(1.0, 3.0);
+
+    std::vector<std::shared_ptr<i_ent::EntityBase>> entities = {surface_a, surface_b};
+    std::vector<std::shared_ptr<i_ent::CurveOnAParametricSurface>> targets;
+    for (int i = 0; i < 6; ++i) {
+        // 偶数番目はsurface_a、奇数番目はsurface_b上の線分
+        const bool on_a = (i % 2 == 0);
+        const double sx = on_a ? 2.0 : 1.0, z = on_a ? 0.0 : 3.0;
+        const double v = 0.1 + 0.12 * i;
+        const auto curve = std::make_shared<i_ent::Line>(
+            iio::Vector3d(0.1 * sx, v, z), iio::Vector3d(0.9 * sx, v + 0.05, z));
+        const auto cos = MakeCosWithOmittedB(
+            (on_a ? surface_a : surface_b)->GetID(), curve->GetID());
+        entities.push_back(curve);
+        entities.push_back(cos);
+        targets.push_back(cos);
+    }
+    iio::models::IgesData iges;
+    iges.Root().AddEntities(entities);
+
+    iio::ReconstructOmittedBaseCurves(iges.Root());
+    for (const auto& cos : targets) {
+        ASSERT_TRUE(cos->HasBaseCurve());
+        EXPECT_FALSE(cos->IsBaseCurveOmitted());
+        EXPECT_NE(iges.Root().GetEntity(cos->GetBaseCurve()->GetID()), nullptr);
+
+        // S(B(t))の始点がCの始点を再現する
+        const auto curve = cos->GetCurve();
+        const auto actual = cos->TryGetDefinedDerivatives(cos->GetParameterRange()[0], 0);
+        const auto expected = curve->TryGetDefinedDerivatives(
+                curve->GetParameterRange()[0], 0);
+        ASSERT_TRUE(actual.has_value() && expected.has_value());
+        EXPECT_LT(((*actual)[0] - (*expected)[0]).norm(), 1e-2);
+    }
+    const auto count = iges.Root().GetEntities().size();
+
+    // 再構築済みのType 142は対象外となる (2回目の呼び出しでは何も登録しない)
+    iio::ReconstructOmittedBaseCurves(iges.Root());
+    EXPECT_EQ(iges.Root().GetEntities().size(), count);
+}
+
+// reconstruct_base_curves = falseでも読み込みが成功する
+TEST(ReconstructOmittedBaseCurvesTest, ReadIgesWithDeferredReconstruction) {
+    auto deferred = iio::ReadIges(kSingleRoundCubePath, false, false, false);
+    const auto eager = iio::ReadIges(kSingleRoundCubePath, false, false, true);
+    EXPECT_EQ(deferred.Root().GetEntities().size(),
+              eager.Root().GetEntities().size());
+    EXPECT_NO_THROW(iio::ReconstructOmittedBaseCurves(deferred.Root()));
+}